@@ -16,6 +16,9 @@
 #include <common/debug.h>
 #include <context.h>
 #include <drivers/auth/auth_mod.h>
+#if LOAD_IMAGE_STREAM_HASH
+#include <drivers/auth/crypto_mod.h>
+#endif
 #include <lib/el3_runtime/context_mgmt.h>
 #include <lib/utils.h>
 #include <plat/common/platform.h>
@@ -47,6 +50,45 @@ static int bl1_fwu_image_reset(unsigned int image_id,
 			unsigned int flags);
 __dead2 static void bl1_fwu_done(void *client_cookie, void *reserved);
 
+#if LOAD_IMAGE_STREAM_HASH
+/*
+ * Image whose digest the crypto module is calculating or holds. Its blocks are
+ * hashed as they are copied, so that its authentication reuses the digest.
+ */
+static unsigned int fwu_hash_image_id = INVALID_IMAGE_ID;
+
+static void bl1_fwu_hash_block(unsigned int image_id, uintptr_t block,
+			       unsigned int block_size, bool first, bool last)
+{
+	if (first) {
+		fwu_hash_image_id = (crypto_mod_hash_stream_start() == 0) ?
+				    image_id : INVALID_IMAGE_ID;
+	}
+
+	if (fwu_hash_image_id != image_id) {
+		return;
+	}
+
+	if (crypto_mod_hash_stream_update((void *)block, block_size) != 0) {
+		fwu_hash_image_id = INVALID_IMAGE_ID;
+		return;
+	}
+
+	if (last && (crypto_mod_hash_stream_finish() != 0)) {
+		fwu_hash_image_id = INVALID_IMAGE_ID;
+	}
+}
+
+/* Forget the digest of an image whose copy is cleared */
+static void bl1_fwu_hash_discard(unsigned int image_id)
+{
+	if (fwu_hash_image_id == image_id) {
+		crypto_mod_hash_stream_discard();
+		fwu_hash_image_id = INVALID_IMAGE_ID;
+	}
+}
+#endif /* LOAD_IMAGE_STREAM_HASH */
+
 /*
  * This keeps track of last executed secure image id.
  */
@@ -351,6 +393,11 @@ static int bl1_fwu_image_copy(unsigned int image_id,
 	/* Everything looks sane. Go ahead and copy the block of data. */
 	dest_addr = desc->image_info.image_base + desc->copied_size;
 	(void)memcpy((void *) dest_addr, (const void *) image_src, block_size);
+#if LOAD_IMAGE_STREAM_HASH
+	/* Hash the copy in secure memory while it is still in the cache */
+	bl1_fwu_hash_block(image_id, dest_addr, block_size,
+			   desc->copied_size == 0U, block_size == remaining);
+#endif
 	flush_dcache_range(dest_addr, block_size);
 
 	desc->copied_size += block_size;
@@ -453,6 +500,9 @@ static int bl1_fwu_image_auth(unsigned int image_id,
 		 * some malicious code that can somehow be executed later.
 		 */
 		if (desc->state == IMAGE_STATE_COPIED) {
+#if LOAD_IMAGE_STREAM_HASH
+			bl1_fwu_hash_discard(image_id);
+#endif
 			/* Clear the memory.*/
 			zero_normalmem((void *)base_addr, total_size);
 			flush_dcache_range(base_addr, total_size);
@@ -470,6 +520,17 @@ static int bl1_fwu_image_auth(unsigned int image_id,
 		return -EAUTH;
 	}
 
+	/*
+	 * Each FWU SMC may be the last one before a reset, so write the NV
+	 * counters raised by this image straight away.
+	 */
+	result = auth_mod_flush_nv_ctrs();
+	if (result != 0) {
+		ERROR("BL1-FWU: Failed to update the NV counters (%d)\n",
+		      result);
+		plat_error_handler(result);
+	}
+
 	/* Indicate that image is in authenticated state. */
 	desc->state = IMAGE_STATE_AUTHENTICATED;
 
@@ -719,6 +780,9 @@ static int bl1_fwu_image_reset(unsigned int image_id, unsigned int flags)
 			assert(GET_SECURITY_STATE(desc->ep_info.h.attr)
 				== SECURE);
 
+#if LOAD_IMAGE_STREAM_HASH
+			bl1_fwu_hash_discard(image_id);
+#endif
 			zero_normalmem((void *)desc->image_info.image_base,
 					desc->copied_size);
 			flush_dcache_range(desc->image_info.image_base,
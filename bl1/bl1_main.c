@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2013-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -18,6 +18,8 @@
 #include <drivers/auth/auth_mod.h>
 #include <drivers/auth/crypto_mod.h>
 #include <drivers/console.h>
+#include <drivers/io/io_storage.h>
+#include <lib/boot_timeline.h>
 #include <lib/bootmarker_capture.h>
 #include <lib/cpus/errata.h>
 #include <lib/pmf/pmf.h>
@@ -74,6 +76,7 @@ void bl1_main(void)
 #if ENABLE_RUNTIME_INSTRUMENTATION
 	PMF_CAPTURE_TIMESTAMP(bl_svc, BL1_ENTRY, PMF_CACHE_MAINT);
 #endif
+	BOOT_TIMELINE_MARK(BOOT_TL_EV_ENTRY, 0U);
 
 	/* Announce our arrival */
 	NOTICE(FIRMWARE_WELCOME_STR);
@@ -125,7 +128,9 @@ void bl1_main(void)
 	bl1_plat_mboot_init();
 
 	/* Perform platform setup in BL1. */
+	BOOT_TIMELINE_START(BOOT_TL_EV_PLAT_SETUP, 0U);
 	bl1_platform_setup();
+	BOOT_TIMELINE_END(BOOT_TL_EV_PLAT_SETUP, 0U);
 
 #if ENABLE_PAUTH
 	/* Store APIAKey_EL1 key */
@@ -149,6 +154,7 @@ void bl1_main(void)
 	bl1_plat_mboot_finish();
 
 	bl1_prepare_next_image(image_id);
+	io_stats_report();
 
 #if ENABLE_RUNTIME_INSTRUMENTATION
 	PMF_CAPTURE_TIMESTAMP(bl_svc, BL1_EXIT, PMF_CACHE_MAINT);
@@ -196,6 +202,13 @@ static void bl1_load_bl2(void)
 		plat_error_handler(err);
 	}
 
+	/* Write the NV counters raised while authenticating BL2. */
+	err = auth_mod_flush_nv_ctrs();
+	if (err != 0) {
+		ERROR("Failed to update the NV counters (%d)\n", err);
+		plat_error_handler(err);
+	}
+
 	NOTICE("BL1: Booting BL2\n");
 }
 
@@ -53,3 +53,7 @@ endif
 ifeq (${ENABLE_PMF},1)
 BL2_SOURCES		+=	lib/pmf/pmf_main.c
 endif
+
+ifeq (${FAST_REBOOT},1)
+BL2_SOURCES		+=	common/fast_reboot.c
+endif
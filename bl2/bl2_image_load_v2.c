@@ -1,10 +1,11 @@
 /*
- * Copyright (c) 2016-2022, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2016-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
 #include <assert.h>
+#include <stdbool.h>
 #include <stdint.h>
 
 #include <arch.h>
@@ -13,11 +14,144 @@
 #include <common/bl_common.h>
 #include <common/debug.h>
 #include <common/desc_image_load.h>
+#include <common/fast_reboot.h>
 #include <drivers/auth/auth_mod.h>
+#include <lib/bootmarker_capture.h>
+#include <lib/pmf/pmf.h>
 #include <plat/common/platform.h>
 
 #include <platform_def.h>
 
+#if BL2_PIPELINED_LOAD
+#if ENABLE_RUNTIME_INSTRUMENTATION
+PMF_DECLARE_CAPTURE_TIMESTAMP(bl_svc)
+#define BL2_LOAD_TIMESTAMP(_tid)	\
+	PMF_CAPTURE_TIMESTAMP(bl_svc, (_tid), PMF_CACHE_MAINT)
+#else
+#define BL2_LOAD_TIMESTAMP(_tid)
+#endif
+
+/* Requests for the image being authenticated and the one being read ahead */
+static image_load_req_t load_reqs[2];
+static unsigned int cur_req;
+
+/*
+ * Image following the one being authenticated. Its pre-load hook has already
+ * been called and, if 'preload_started' is set, its read is in flight.
+ */
+static const bl_load_info_node_t *preloaded_node;
+static bool preload_started;
+
+/*******************************************************************************
+ * Return true if the pre image load hook has already been called for 'node'
+ * so that its read could be started ahead of time.
+ ******************************************************************************/
+static bool bl2_image_preloaded(const bl_load_info_node_t *node)
+{
+	return node == preloaded_node;
+}
+
+/*******************************************************************************
+ * Return true if the read of 'node' may be started while the previous image is
+ * being authenticated. Images that need platform setup first, that are not
+ * loaded at all or that are used in place, are handled in order.
+ ******************************************************************************/
+static bool bl2_can_preload(const bl_load_info_node_t *node)
+{
+	if (node == NULL) {
+		return false;
+	}
+
+	return (node->image_info->h.attr &
+		(IMAGE_ATTRIB_PLAT_SETUP | IMAGE_ATTRIB_SKIP_LOADING |
+		 IMAGE_ATTRIB_IN_PLACE)) == 0U;
+}
+
+/*******************************************************************************
+ * Pipelined version of load_auth_image(). Once the current image has been read,
+ * the read of the next image in the list is started so that it overlaps with
+ * the authentication of the current one. If any step fails, the current image
+ * is loaded again through load_auth_image() so that the usual error handling
+ * and alternate image instances apply.
+ ******************************************************************************/
+static int bl2_load_auth_image_pipelined(const bl_load_info_node_t *node)
+{
+	image_load_req_t *req = &load_reqs[cur_req];
+	image_load_req_t *next_req = &load_reqs[cur_req ^ 1U];
+	const bl_load_info_node_t *next = node->next_load_info;
+	bool started = bl2_image_preloaded(node) && preload_started;
+	int err;
+
+	preloaded_node = NULL;
+	preload_started = false;
+
+	/*
+	 * There is no read to overlap with for an image used in place, or on a
+	 * fast reboot where the images are kept in memory.
+	 */
+	if (((node->image_info->h.attr & IMAGE_ATTRIB_IN_PLACE) != 0U) ||
+	    fast_reboot_is_active()) {
+		return load_auth_image(node->image_id, node->image_info);
+	}
+
+	if (!started) {
+		BL2_LOAD_TIMESTAMP(BL2_IMAGE_READ_START);
+		err = load_auth_image_start(node->image_id, node->image_info,
+					    req);
+		if (err != 0) {
+			goto fallback;
+		}
+	}
+
+	err = load_auth_image_wait(req);
+	BL2_LOAD_TIMESTAMP(BL2_IMAGE_READ_END);
+	if (err != 0) {
+		goto fallback;
+	}
+
+	/* Start reading the next image while this one is authenticated */
+	if (bl2_can_preload(next)) {
+		err = bl2_plat_handle_pre_image_load(next->image_id);
+		if (err != 0) {
+			ERROR("BL2: Failure in pre image load handling (%i)\n",
+			      err);
+			plat_error_handler(err);
+		}
+		preloaded_node = next;
+
+		BL2_LOAD_TIMESTAMP(BL2_IMAGE_READ_START);
+		preload_started = (load_auth_image_start(next->image_id,
+							 next->image_info,
+							 next_req) == 0);
+	}
+
+	BL2_LOAD_TIMESTAMP(BL2_IMAGE_AUTH_START);
+	err = load_auth_image_finish(req);
+	BL2_LOAD_TIMESTAMP(BL2_IMAGE_AUTH_END);
+	if (err == 0) {
+		if (preload_started) {
+			cur_req ^= 1U;
+		}
+
+		return 0;
+	}
+
+fallback:
+	/* Do not leave a read in flight behind the synchronous load */
+	if (preload_started) {
+		(void)load_auth_image_wait(next_req);
+		preload_started = false;
+	}
+
+	return load_auth_image(node->image_id, node->image_info);
+}
+#else
+static bool bl2_image_preloaded(const bl_load_info_node_t *node)
+{
+	return false;
+}
+#endif /* BL2_PIPELINED_LOAD */
+
 /*******************************************************************************
  * This function loads SCP_BL2/BL3x images and returns the ep_info for
  * the next executable image.
@@ -57,17 +191,26 @@ struct entry_point_info *bl2_load_images(void)
 			}
 		}
 
-		err = bl2_plat_handle_pre_image_load(bl2_node_info->image_id);
-		if (err != 0) {
-			ERROR("BL2: Failure in pre image load handling (%i)\n", err);
-			plat_error_handler(err);
+		/* The hook has already run if the image was read ahead */
+		if (!bl2_image_preloaded(bl2_node_info)) {
+			err = bl2_plat_handle_pre_image_load(
+					bl2_node_info->image_id);
+			if (err != 0) {
+				ERROR("BL2: Failure in pre image load handling (%i)\n",
+				      err);
+				plat_error_handler(err);
+			}
 		}
 
 		if ((bl2_node_info->image_info->h.attr &
 		    IMAGE_ATTRIB_SKIP_LOADING) == 0U) {
 			INFO("BL2: Loading image id %u\n", bl2_node_info->image_id);
+#if BL2_PIPELINED_LOAD
+			err = bl2_load_auth_image_pipelined(bl2_node_info);
+#else
 			err = load_auth_image(bl2_node_info->image_id,
 				bl2_node_info->image_info);
+#endif
 			if (err != 0) {
 				ERROR("BL2: Failed to load image id %u (%i)\n",
 				      bl2_node_info->image_id, err);
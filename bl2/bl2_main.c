@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2013-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -17,6 +17,8 @@
 #include <drivers/auth/crypto_mod.h>
 #include <drivers/console.h>
 #include <drivers/fwu/fwu.h>
+#include <drivers/io/io_storage.h>
+#include <lib/boot_timeline.h>
 #include <lib/bootmarker_capture.h>
 #include <lib/extensions/pauth.h>
 #include <lib/pmf/pmf.h>
@@ -94,10 +96,12 @@ void bl2_setup(u_register_t arg0, u_register_t arg1, u_register_t arg2,
 void bl2_main(void)
 {
 	entry_point_info_t *next_bl_ep_info;
+	int rc;
 
 #if ENABLE_RUNTIME_INSTRUMENTATION
 	PMF_CAPTURE_TIMESTAMP(bl_svc, BL2_ENTRY, PMF_CACHE_MAINT);
 #endif
+	BOOT_TIMELINE_MARK(BOOT_TL_EV_ENTRY, 0U);
 
 	NOTICE("BL2: %s\n", build_version_string);
 	NOTICE("BL2: %s\n", build_message);
@@ -123,6 +127,16 @@ void bl2_main(void)
 	/* Load the subsequent bootloader images. */
 	next_bl_ep_info = bl2_load_images();
 
+	/* Write the NV counters raised while authenticating the images. */
+	rc = auth_mod_flush_nv_ctrs();
+	if (rc != 0) {
+		ERROR("Failed to update the NV counters (%d)\n", rc);
+		plat_error_handler(rc);
+	}
+
+	boot_timeline_report();
+	io_stats_report();
+
 	/* Teardown the Measured Boot backend */
 	bl2_plat_mboot_finish();
 
@@ -1,5 +1,5 @@
 #
-# Copyright (c) 2013-2024, Arm Limited and Contributors. All rights reserved.
+# Copyright (c) 2013-2026, Arm Limited and Contributors. All rights reserved.
 #
 # SPDX-License-Identifier: BSD-3-Clause
 #
@@ -61,6 +61,20 @@ BL31_SOURCES		+=	lib/pmf/pmf_main.c				\
 				${VENDOR_EL3_SRCS}
 endif
 
+ifneq ($(filter 1,${ENABLE_PSCI_STAT} ${PSCI_CPU_ON_BATCH}),)
+BL31_SOURCES		+=	${VENDOR_EL3_SRCS}
+endif
+
+ifeq (${LIB_BENCH},1)
+include lib/lib_bench/lib_bench.mk
+BL31_SOURCES		+=	${LIB_BENCH_SOURCES}				\
+				${VENDOR_EL3_SRCS}
+endif
+
+ifeq (${PMF_TRACE}, 1)
+BL31_SOURCES		+=	lib/pmf/pmf_trace.c
+endif
+
 include lib/debugfs/debugfs.mk
 ifeq (${USE_DEBUGFS},1)
 BL31_SOURCES		+=	${DEBUGFS_SRCS}					\
@@ -75,6 +89,29 @@ ifeq (${EL3_EXCEPTION_HANDLING},1)
 BL31_SOURCES		+=	bl31/ehf.c
 endif
 
+ifeq (${DEFERRED_WORK},1)
+BL31_SOURCES		+=	bl31/deferred_work.c
+endif
+
+ifeq (${EL3_PROFILING},1)
+BL31_SOURCES		+=	bl31/el3_prof.c
+endif
+
+ifeq (${COHORT_LOCKS},1)
+BL31_SOURCES		+=	lib/locks/cohort/cohort_lock.c
+endif
+
+ifeq (${FAST_REBOOT},1)
+BL31_SOURCES		+=	common/fast_reboot.c
+endif
+
+ifeq (${PARALLEL_CACHE_MAINT},1)
+ifeq (${EL3_EXCEPTION_HANDLING},0)
+  $(error EL3_EXCEPTION_HANDLING must be 1 for PARALLEL_CACHE_MAINT support)
+endif
+BL31_SOURCES		+=	lib/cache_maint/parallel_cache_maint.c
+endif
+
 ifeq (${FFH_SUPPORT},1)
 BL31_SOURCES		+=	bl31/aarch64/ea_delegate.S
 endif
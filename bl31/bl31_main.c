@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2013-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -18,9 +18,12 @@
 #include <common/feat_detect.h>
 #include <common/runtime_svc.h>
 #include <drivers/console.h>
+#include <lib/boot_timeline.h>
 #include <lib/bootmarker_capture.h>
+#include <lib/cache_maint/parallel_cache_maint.h>
 #include <lib/el3_runtime/context_debug.h>
 #include <lib/el3_runtime/context_mgmt.h>
+#include <lib/extensions/mpam.h>
 #include <lib/pmf/pmf.h>
 #include <lib/runtime_instr.h>
 #include <plat/common/platform.h>
@@ -132,6 +135,11 @@ void bl31_main(void)
 	/* Init per-world context registers for non-secure world */
 	manage_extensions_nonsecure_per_world();
 
+#if ENABLE_MPAM_PARTITIONING
+	/* Isolate the Non-secure partitions from the other worlds */
+	mpam_partition_init();
+#endif
+
 	NOTICE("BL31: %s\n", build_version_string);
 	NOTICE("BL31: %s\n", build_message);
 
@@ -143,6 +151,7 @@ void bl31_main(void)
 #if ENABLE_RUNTIME_INSTRUMENTATION
 	PMF_CAPTURE_TIMESTAMP(bl_svc, BL31_ENTRY, PMF_CACHE_MAINT);
 #endif
+	BOOT_TIMELINE_MARK(BOOT_TL_EV_ENTRY, 0U);
 
 #ifdef SUPPORT_UNKNOWN_MPID
 	if (unsupported_mpid_flag == 0) {
@@ -151,7 +160,9 @@ void bl31_main(void)
 #endif
 
 	/* Perform platform setup in BL31 */
+	BOOT_TIMELINE_START(BOOT_TL_EV_PLAT_SETUP, 0U);
 	bl31_platform_setup();
+	BOOT_TIMELINE_END(BOOT_TL_EV_PLAT_SETUP, 0U);
 
 	/* Initialise helper libraries */
 	bl31_lib_init();
@@ -161,6 +172,10 @@ void bl31_main(void)
 	ehf_init();
 #endif
 
+#if PARALLEL_CACHE_MAINT
+	parallel_cache_maint_init();
+#endif
+
 	/* Initialize the runtime services e.g. psci. */
 	INFO("BL31: Initializing runtime services\n");
 	runtime_svc_init();
@@ -185,8 +200,10 @@ void bl31_main(void)
 		INFO("BL31: Initializing BL32\n");
 
 		console_flush();
+		BOOT_TIMELINE_START(BOOT_TL_EV_BL32_INIT, 0U);
 		int32_t rc = (*bl32_init)();
 
+		BOOT_TIMELINE_END(BOOT_TL_EV_BL32_INIT, 0U);
 		if (rc == 0) {
 			WARN("BL31: BL32 initialization failed\n");
 		}
@@ -201,8 +218,10 @@ void bl31_main(void)
 		INFO("BL31: Initializing RMM\n");
 
 		console_flush();
+		BOOT_TIMELINE_START(BOOT_TL_EV_RMM_INIT, 0U);
 		int32_t rc = (*rmm_init)();
 
+		BOOT_TIMELINE_END(BOOT_TL_EV_RMM_INIT, 0U);
 		if (rc == 0) {
 			WARN("BL31: RMM initialization failed\n");
 		}
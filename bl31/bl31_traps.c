@@ -12,6 +12,107 @@
 #include <bl31/sync_handle.h>
 #include <context.h>
 #include <lib/el3_runtime/context_mgmt.h>
+#include <lib/utils_def.h>
+#include <plat/common/platform.h>
+#if EL3_FAST_SYSREG_TRAP
+#include <plat/common/plat_trng.h>
+#endif
+
+#include <platform_def.h>
+
+#if EL3_FAST_SYSREG_TRAP
+/* Words of entropy cached per CPU for the RNDR and RNDRRS traps */
+#ifndef PLAT_RNG_TRAP_CACHE_WORDS
+#define PLAT_RNG_TRAP_CACHE_WORDS	8U
+#endif
+
+struct rng_trap_cache {
+	uint64_t words[PLAT_RNG_TRAP_CACHE_WORDS];
+	unsigned int avail;
+};
+
+static struct rng_trap_cache rng_trap_caches[PLATFORM_CORE_COUNT];
+
+/*
+ * Take a word from the entropy cache of this CPU, refilled in one go from
+ * plat_get_entropy() when empty. Only this CPU accesses its cache, with
+ * interrupts masked.
+ */
+static bool rng_trap_cache_get(uint64_t *out)
+{
+	struct rng_trap_cache *cache = &rng_trap_caches[plat_my_core_pos()];
+
+	if (cache->avail == 0U) {
+		while ((cache->avail < PLAT_RNG_TRAP_CACHE_WORDS) &&
+		       plat_get_entropy(&cache->words[cache->avail])) {
+			cache->avail++;
+		}
+		if (cache->avail == 0U) {
+			return false;
+		}
+	}
+
+	cache->avail--;
+	*out = cache->words[cache->avail];
+	cache->words[cache->avail] = 0ULL;
+
+	return true;
+}
+
+/*
+ * Emulate RNDR and RNDRRS from the entropy cache. As for the instructions,
+ * PSTATE.NZCV is cleared on success, and on failure the result is 0 with
+ * PSTATE.Z set.
+ */
+static int rng_trap_fast(uint64_t esr_el3, u_register_t *val)
+{
+	u_register_t spsr = read_spsr_el3() & ~(u_register_t)SPSR_NZCV;
+	uint64_t rnd;
+
+	if (is_sysreg_iss_write(esr_el3)) {
+		return TRAP_RET_UNHANDLED;
+	}
+
+	if (rng_trap_cache_get(&rnd)) {
+		*val = rnd;
+	} else {
+		*val = 0U;
+		spsr |= SPSR_Z_BIT;
+	}
+	write_spsr_el3(spsr);
+
+	return TRAP_RET_CONTINUE;
+}
+
+/*
+ * Trapped system register accesses emulated on the fast path, keyed by the
+ * ISS encoding of the register.
+ */
+static const struct sysreg_fast_trap {
+	uint64_t opcode;
+	int (*handler)(uint64_t esr_el3, u_register_t *val);
+} sysreg_fast_traps[] = {
+	{ ISS_SYSREG_OPCODE_RNDR, rng_trap_fast },
+	{ ISS_SYSREG_OPCODE_RNDRRS, rng_trap_fast },
+};
+
+int handle_sysreg_trap_fast(uint64_t esr_el3, cpu_context_t *ctx)
+{
+	uint64_t opcode = esr_el3 & ISS_SYSREG_OPCODE_MASK;
+	unsigned int rt = get_sysreg_iss_rt(esr_el3);
+	u_register_t xzr;
+
+	for (unsigned int i = 0U; i < ARRAY_SIZE(sysreg_fast_traps); i++) {
+		if (sysreg_fast_traps[i].opcode == opcode) {
+			return sysreg_fast_traps[i].handler(esr_el3,
+				(rt == 31U) ? &xzr :
+				&ctx->gpregs_ctx.ctx_regs[rt]);
+		}
+	}
+
+	return TRAP_RET_UNHANDLED;
+}
+#endif /* EL3_FAST_SYSREG_TRAP */
 
 int handle_sysreg_trap(uint64_t esr_el3, cpu_context_t *ctx)
 {
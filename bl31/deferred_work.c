@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <assert.h>
+#include <errno.h>
+
+#include <arch_helpers.h>
+#include <bl31/deferred_work.h>
+#include <lib/cassert.h>
+#include <plat/common/platform.h>
+
+#include <platform_def.h>
+
+/*
+ * With DEFERRED_WORK, each CPU has a small queue of work that does not need to
+ * be done inside the SMC that produced it. The queue is run when the CPU is
+ * about to suspend or power down, and before it returns to the Normal world
+ * through cm_prepare_el3_exit_ns(). A run stops once it has taken longer than
+ * the budget, leaving the rest of the queue for the next safe point.
+ *
+ * A queue is only accessed by its CPU with interrupts masked, so no lock is
+ * needed. Work may be dropped when the queue is full: it must only be used for
+ * processing that the subsystem would otherwise do later anyway.
+ */
+
+/* Number of pending work items per CPU */
+#ifndef PLAT_DEFERRED_WORK_ENTRIES
+#define PLAT_DEFERRED_WORK_ENTRIES	U(8)
+#endif
+
+/* Time after which a run leaves the remaining work for the next one */
+#ifndef PLAT_DEFERRED_WORK_BUDGET_US
+#define PLAT_DEFERRED_WORK_BUDGET_US	U(20)
+#endif
+
+CASSERT(PLAT_DEFERRED_WORK_ENTRIES != 0U, assert_deferred_work_entries);
+
+typedef struct deferred_work {
+	deferred_work_fn_t fn;
+	void *arg;
+} deferred_work_t;
+
+typedef struct dw_queue {
+	deferred_work_t work[PLAT_DEFERRED_WORK_ENTRIES];
+	unsigned int head;
+	unsigned int count;
+} __aligned(CACHE_WRITEBACK_GRANULE) dw_queue_t;
+
+static dw_queue_t dw_queues[PLATFORM_CORE_COUNT];
+
+/*
+ * Queue fn(arg) to run on the current CPU at its next safe point. Work that is
+ * already pending with the same argument is only queued once. Return 0 on
+ * success, or -ENOSPC if the queue is full.
+ */
+int deferred_work_queue(deferred_work_fn_t fn, void *arg)
+{
+	dw_queue_t *q = &dw_queues[plat_my_core_pos()];
+	deferred_work_t *w;
+	unsigned int i;
+
+	assert(fn != NULL);
+
+	for (i = 0U; i < q->count; i++) {
+		w = &q->work[(q->head + i) % PLAT_DEFERRED_WORK_ENTRIES];
+		if ((w->fn == fn) && (w->arg == arg)) {
+			return 0;
+		}
+	}
+
+	if (q->count == PLAT_DEFERRED_WORK_ENTRIES) {
+		return -ENOSPC;
+	}
+
+	w = &q->work[(q->head + q->count) % PLAT_DEFERRED_WORK_ENTRIES];
+	w->fn = fn;
+	w->arg = arg;
+	q->count++;
+
+	return 0;
+}
+
+/*
+ * Run the work queued on the current CPU in order, until the queue is empty or
+ * the budget is spent. At least one item is run per call. Work may queue more
+ * work, which then runs at a later safe point if the budget is spent.
+ */
+void deferred_work_run(void)
+{
+	dw_queue_t *q = &dw_queues[plat_my_core_pos()];
+	uint64_t start, budget;
+
+	if (q->count == 0U) {
+		return;
+	}
+
+	budget = (read_cntfrq_el0() * PLAT_DEFERRED_WORK_BUDGET_US) / 1000000U;
+	start = read_cntpct_el0();
+
+	do {
+		deferred_work_t w = q->work[q->head];
+
+		q->head = (q->head + 1U) % PLAT_DEFERRED_WORK_ENTRIES;
+		q->count--;
+
+		w.fn(w.arg);
+	} while ((q->count != 0U) && ((read_cntpct_el0() - start) < budget));
+}
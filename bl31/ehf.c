@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -19,6 +19,7 @@
 #include <lib/el3_runtime/context_mgmt.h>
 #include <lib/el3_runtime/cpu_data.h>
 #include <lib/el3_runtime/pubsub_events.h>
+#include <lib/pmf/pmf_trace.h>
 #include <plat/common/platform.h>
 
 /* Output EHF logs as verbose */
@@ -450,6 +451,8 @@ static uint64_t ehf_el3_interrupt_handler(uint32_t id, uint32_t flags,
 		panic();
 	}
 
+	PMF_TRACE_EVENT(PMF_TRACE_EHF_INTR, intr_raw, pri);
+
 	/*
 	 * Call registered handler. Pass the raw interrupt value to registered
 	 * handlers.
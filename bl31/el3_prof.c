@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <arch.h>
+#include <arch_helpers.h>
+#include <bl31/el3_prof.h>
+#include <bl31/interrupt_mgmt.h>
+#include <drivers/arm/gic_common.h>
+#include <lib/cassert.h>
+#include <plat/common/platform.h>
+#include <platform_def.h>
+
+/*
+ * With EL3_PROFILING, the secure physical timer interrupts the SMC handlers
+ * EL3_PROF_HZ times per second of EL3 execution, and the interrupted PCs are
+ * recorded in a ring per CPU, for tools/el3_prof/el3_prof_report.py to map to
+ * the symbols of BL31 on the host from a dump of el3_prof_bufs.
+ *
+ * The timer only runs while the SMC handlers do: it is paused, keeping the
+ * time left before the next sample, when they return.
+ */
+
+/* Interrupt ID of the secure physical timer, PPI 13 */
+#ifndef PLAT_EL3_PROF_INTID
+#define PLAT_EL3_PROF_INTID	U(29)
+#endif
+
+#ifndef EL3_PROF_HZ
+#define EL3_PROF_HZ		U(10000)
+#endif
+
+/*
+ * Size in bytes of the buffer of each CPU, to be passed to the report tool if
+ * it is changed
+ */
+#ifndef EL3_PROF_BUF_SIZE
+#define EL3_PROF_BUF_SIZE	U(4096)
+#endif
+
+#define EL3_PROF_BUF_PCS	((EL3_PROF_BUF_SIZE / sizeof(uint64_t)) - 1U)
+
+struct el3_prof_buf {
+	uint64_t head;		/* Samples taken so far */
+	uint64_t pcs[EL3_PROF_BUF_PCS];
+} __aligned(CACHE_WRITEBACK_GRANULE);
+
+CASSERT(sizeof(struct el3_prof_buf) == EL3_PROF_BUF_SIZE,
+	assert_el3_prof_buf_size);
+
+struct el3_prof_buf el3_prof_bufs[PLATFORM_CORE_COUNT];
+
+/* Ticks between two samples, and ticks left before the next one per CPU */
+static uint32_t el3_prof_period;
+static uint32_t el3_prof_left[PLATFORM_CORE_COUNT];
+
+/*******************************************************************************
+ * Route the timer interrupt to EL3 on this CPU. Called on every cold and warm
+ * boot, as the timer is reset with the CPU.
+ ******************************************************************************/
+void el3_prof_init(void)
+{
+	unsigned int id = PLAT_EL3_PROF_INTID;
+
+	write_cntps_ctl_el1(0U);
+
+	if (el3_prof_period == 0U) {
+		el3_prof_period = plat_get_syscnt_freq2() / EL3_PROF_HZ;
+		if (el3_prof_period == 0U) {
+			el3_prof_period = 1U;
+		}
+	}
+	el3_prof_left[plat_my_core_pos()] = el3_prof_period;
+
+	plat_ic_set_interrupt_type(id, INTR_TYPE_EL3);
+	plat_ic_set_interrupt_priority(id, GIC_HIGHEST_SEC_PRIORITY);
+	plat_ic_enable_interrupt(id);
+}
+
+/* Start the timer before a SMC handler runs with FIQs unmasked */
+void el3_prof_resume(void)
+{
+	write_cntps_tval_el1(el3_prof_left[plat_my_core_pos()]);
+	write_cntps_ctl_el1(CNTP_CTL_ENABLE_BIT);
+}
+
+/* Stop the timer after a SMC handler has returned with FIQs masked */
+void el3_prof_pause(void)
+{
+	int32_t left = (int32_t)read_cntps_tval_el1();
+
+	write_cntps_ctl_el1(0U);
+	isb();
+
+	el3_prof_left[plat_my_core_pos()] = (left > 0) ? (uint32_t)left : 1U;
+}
+
+/*******************************************************************************
+ * Called from the FIQ vector of EL3 with the PC it interrupted. Return 0 if
+ * the timer did not fire, so that the interrupt is left to el3_exit().
+ ******************************************************************************/
+int el3_prof_sample(uintptr_t pc)
+{
+	struct el3_prof_buf *buf;
+
+	if (get_cntp_ctl_istatus(read_cntps_ctl_el1()) == 0U) {
+		return 0;
+	}
+
+	/*
+	 * Stop sampling when the caches have been turned off to power down the
+	 * CPU, the samples would not be coherent.
+	 */
+	if ((read_sctlr_el3() & SCTLR_C_BIT) == 0U) {
+		write_cntps_ctl_el1(0U);
+		isb();
+		return 1;
+	}
+
+	buf = &el3_prof_bufs[plat_my_core_pos()];
+	buf->pcs[buf->head % EL3_PROF_BUF_PCS] = pc;
+	buf->head++;
+
+	write_cntps_tval_el1(el3_prof_period);
+	isb();
+
+	return 1;
+}
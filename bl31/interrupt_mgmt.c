@@ -12,6 +12,8 @@
 #include <lib/el3_runtime/context_mgmt.h>
 #include <plat/common/platform.h>
 
+#include <platform_def.h>
+
 /*******************************************************************************
  * Local structure and corresponding array to keep track of the state of the
  * registered interrupt handlers for each interrupt type.
@@ -42,6 +44,21 @@ typedef struct {
 
 static intr_type_desc_t intr_type_descs[MAX_INTR_TYPES];
 
+#if EL3_FAST_INTR
+/* Number of EL3 interrupts that can have a fast handler */
+#ifndef PLAT_EL3_FAST_INTR_MAX
+#define PLAT_EL3_FAST_INTR_MAX		4U
+#endif
+
+typedef struct {
+	uint32_t id;
+	el3_fast_intr_handler_t handler;
+} fast_intr_desc_t;
+
+static fast_intr_desc_t fast_intr_descs[PLAT_EL3_FAST_INTR_MAX];
+static unsigned int fast_intr_count;
+#endif /* EL3_FAST_INTR */
+
 /*******************************************************************************
  * This function validates the interrupt type.
  ******************************************************************************/
@@ -230,3 +247,80 @@ interrupt_type_handler_t get_interrupt_type_handler(uint32_t type)
 	return intr_type_descs[type].handler;
 }
 
+#if EL3_FAST_INTR
+/*******************************************************************************
+ * This function registers a fast handler for an EL3 interrupt, serviced
+ * entirely at EL3. Its interrupt is handled on entry from a lower EL without
+ * saving the context of the interrupted world, instead of going through the
+ * handler of the EL3 interrupt type.
+ ******************************************************************************/
+int32_t register_el3_fast_intr_handler(uint32_t id,
+				       el3_fast_intr_handler_t handler)
+{
+	if (handler == NULL)
+		return -EINVAL;
+
+	for (unsigned int i = 0U; i < fast_intr_count; i++) {
+		if (fast_intr_descs[i].id == id)
+			return -EALREADY;
+	}
+
+	if (fast_intr_count == PLAT_EL3_FAST_INTR_MAX)
+		return -ENOMEM;
+
+	fast_intr_descs[fast_intr_count].id = id;
+	fast_intr_descs[fast_intr_count].handler = handler;
+
+	/* Make the entry visible to the other CPUs before the count */
+	dmbish();
+	fast_intr_count++;
+
+	return 0;
+}
+
+/*******************************************************************************
+ * This function is called on entry from a lower EL, on the EL3 runtime stack
+ * and before the context of the interrupted world is saved. If the pending
+ * interrupt has a fast handler, it is acknowledged, handled and ended, and 1
+ * is returned to return to the lower EL straight away. Otherwise, 0 is returned
+ * to take the full interrupt entry.
+ ******************************************************************************/
+int el3_fast_intr_dispatch(void)
+{
+	el3_fast_intr_handler_t handler = NULL;
+	uint32_t id, intr_raw;
+
+	if (plat_ic_get_pending_interrupt_type() != INTR_TYPE_EL3)
+		return 0;
+
+	id = plat_ic_get_pending_interrupt_id();
+	for (unsigned int i = 0U; i < fast_intr_count; i++) {
+		if (fast_intr_descs[i].id == id) {
+			handler = fast_intr_descs[i].handler;
+			break;
+		}
+	}
+
+	if (handler == NULL)
+		return 0;
+
+	intr_raw = plat_ic_acknowledge_interrupt();
+	if (plat_ic_get_interrupt_id(intr_raw) == INTR_ID_UNAVAILABLE)
+		return 1;
+
+	if (plat_ic_get_interrupt_id(intr_raw) != id) {
+		/*
+		 * A higher priority interrupt was signalled in the meantime.
+		 * Pend it again and end it, for the full entry to take it.
+		 */
+		plat_ic_set_interrupt_pending(plat_ic_get_interrupt_id(intr_raw));
+		plat_ic_end_of_interrupt(intr_raw);
+		return 0;
+	}
+
+	handler(intr_raw);
+	plat_ic_end_of_interrupt(intr_raw);
+
+	return 1;
+}
+#endif /* EL3_FAST_INTR */
@@ -83,3 +83,13 @@ $(eval $(call assert_boolean,RESET_TO_SP_MIN))
 SP_MIN_WITH_SECURE_FIQ 	?= 0
 $(eval $(call add_define,SP_MIN_WITH_SECURE_FIQ))
 $(eval $(call assert_boolean,SP_MIN_WITH_SECURE_FIQ))
+
+# Flag to dispatch the hot SMCs, PSCI CPU_SUSPEND and those the platform lists,
+# without saving the banked registers of the caller. It is default disabled.
+SP_MIN_FAST_SMC		?= 0
+$(eval $(call add_define,SP_MIN_FAST_SMC))
+$(eval $(call assert_boolean,SP_MIN_FAST_SMC))
+
+ifeq (${SP_MIN_FAST_SMC}-${ENABLE_RUNTIME_INSTRUMENTATION},1-1)
+  $(error SP_MIN_FAST_SMC is not supported with ENABLE_RUNTIME_INSTRUMENTATION)
+endif
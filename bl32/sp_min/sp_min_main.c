@@ -42,6 +42,21 @@ static void *sp_min_cpu_ctx_ptr[PLATFORM_CORE_COUNT];
 /* SP_MIN only stores the non secure smc context */
 static smc_ctx_t sp_min_smc_context[PLATFORM_CORE_COUNT];
 
+#if SP_MIN_FAST_SMC
+/*
+ * SMCs dispatched without saving and restoring the banked registers of the
+ * caller, see sp_min_handle_fast_smc. Their handlers must only run in monitor
+ * mode, and not return to another context than the caller's.
+ */
+const uint32_t sp_min_fast_smc_fids[] = {
+	PSCI_CPU_SUSPEND_AARCH32,
+#ifdef PLAT_SP_MIN_FAST_SMC_FIDS
+	PLAT_SP_MIN_FAST_SMC_FIDS
+#endif
+};
+const unsigned int sp_min_fast_smc_fids_num = ARRAY_SIZE(sp_min_fast_smc_fids);
+#endif /* SP_MIN_FAST_SMC */
+
 /******************************************************************************
  * Define the smccc helper library APIs
  *****************************************************************************/
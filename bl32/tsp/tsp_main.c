@@ -217,6 +217,14 @@ smc_args_t *tsp_smc_handler(uint64_t func,
 	uint32_t linear_id = plat_my_core_pos();
 	u_register_t dit;
 
+	/*
+	 * Return straight away, without the statistics, logging and TSPD
+	 * round trip below, so that only the world switch is measured.
+	 */
+	if (TSP_BARE_FID(func) == TSP_NOP) {
+		return set_smc_args(func, 0, read_cntpct_el0(), 0, 0, 0, 0, 0);
+	}
+
 	/* Update this cpu's statistics */
 	tsp_stats[linear_id].smc_count++;
 	tsp_stats[linear_id].eret_count++;
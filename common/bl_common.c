@@ -1,11 +1,12 @@
 /*
- * Copyright (c) 2013-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2013-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
 #include <assert.h>
 #include <errno.h>
+#include <stdbool.h>
 #include <string.h>
 
 #include <arch.h>
@@ -14,8 +15,13 @@
 #include <common/bl_common.h>
 #include <common/build_message.h>
 #include <common/debug.h>
+#include <common/fast_reboot.h>
 #include <drivers/auth/auth_mod.h>
+#if LOAD_IMAGE_STREAM_HASH
+#include <drivers/auth/crypto_mod.h>
+#endif
 #include <drivers/io/io_storage.h>
+#include <lib/boot_timeline.h>
 #include <lib/utils.h>
 #include <lib/xlat_tables/xlat_tables_defs.h>
 #include <plat/common/platform.h>
@@ -61,30 +67,39 @@ uintptr_t page_align(uintptr_t value, unsigned dir)
 }
 
 /*******************************************************************************
- * Internal function to load an image at a specific address given
- * an image ID and extents of free memory.
- *
- * If the load is successful then the image information is updated.
+ * Internal function to release the handles obtained by open_image().
+ ******************************************************************************/
+static void close_image(uintptr_t dev_handle, uintptr_t image_handle)
+{
+	(void)io_close(image_handle);
+	/* Ignore improbable/unrecoverable error in 'close' */
+
+	/* TODO: Consider maintaining open device connection from this bootloader stage */
+	(void)io_dev_close(dev_handle);
+	/* Ignore improbable/unrecoverable error in 'dev_close' */
+}
+
+/*******************************************************************************
+ * Internal function to open an image given an image ID and check that it fits
+ * in the memory described by 'image_data'. On success, the device and image
+ * handles are left open for the caller and the image size is updated.
  *
  * Returns 0 on success, a negative error code otherwise.
  ******************************************************************************/
-static int load_image(unsigned int image_id, image_info_t *image_data)
+static int open_image(unsigned int image_id, image_info_t *image_data,
+		      uintptr_t *dev_handle, uintptr_t *image_handle)
 {
-	uintptr_t dev_handle;
-	uintptr_t image_handle;
 	uintptr_t image_spec;
-	uintptr_t image_base;
 	size_t image_size;
-	size_t bytes_read;
 	int io_result;
 
 	assert(image_data != NULL);
 	assert(image_data->h.version >= VERSION_2);
 
-	image_base = image_data->image_base;
+	io_stats_set_image(image_id);
 
 	/* Obtain a reference to the image by querying the platform layer */
-	io_result = plat_get_image_source(image_id, &dev_handle, &image_spec);
+	io_result = plat_get_image_source(image_id, dev_handle, &image_spec);
 	if (io_result != 0) {
 		WARN("Failed to obtain reference to image id=%u (%i)\n",
 			image_id, io_result);
@@ -92,17 +107,18 @@ static int load_image(unsigned int image_id, image_info_t *image_data)
 	}
 
 	/* Attempt to access the image */
-	io_result = io_open(dev_handle, image_spec, &image_handle);
+	io_result = io_open(*dev_handle, image_spec, image_handle);
 	if (io_result != 0) {
 		WARN("Failed to access image id=%u (%i)\n",
 			image_id, io_result);
 		return io_result;
 	}
 
-	INFO("Loading image id=%u at address 0x%lx\n", image_id, image_base);
+	INFO("Loading image id=%u at address 0x%lx\n", image_id,
+	     image_data->image_base);
 
 	/* Find the size of the image */
-	io_result = io_size(image_handle, &image_size);
+	io_result = io_size(*image_handle, &image_size);
 	if ((io_result != 0) || (image_size == 0U)) {
 		WARN("Failed to determine the size of the image id=%u (%i)\n",
 			image_id, io_result);
@@ -122,35 +138,193 @@ static int load_image(unsigned int image_id, image_info_t *image_data)
 	 */
 	image_data->image_size = (uint32_t)image_size;
 
+	return 0;
+
+exit:
+	close_image(*dev_handle, *image_handle);
+
+	return io_result;
+}
+
+#if LOAD_IMAGE_STREAM_HASH
+/*
+ * Size of the chunks in which images are read so that each chunk is hashed
+ * while it is still in the data cache.
+ */
+#ifndef PLAT_LOAD_IMAGE_CHUNK_SIZE
+#define PLAT_LOAD_IMAGE_CHUNK_SIZE	U(0x10000)
+#endif
+
+/*******************************************************************************
+ * Internal function to read an image in chunks, feeding each chunk to the
+ * crypto module as soon as it has landed in memory. Authentication then reuses
+ * the resulting digest instead of hashing the whole image again. Failing to
+ * hash the image is not an error, the digest is simply calculated later.
+ ******************************************************************************/
+static int read_image_chunks(uintptr_t image_handle, uintptr_t image_base,
+			     size_t image_size, size_t *bytes_read)
+{
+	size_t offset, chunk_size, chunk_read;
+	bool hashing;
+	int io_result;
+
+	hashing = (crypto_mod_hash_stream_start() == 0);
+	*bytes_read = 0U;
+
+	for (offset = 0U; offset < image_size; offset += chunk_size) {
+		chunk_size = MIN(image_size - offset,
+				 (size_t)PLAT_LOAD_IMAGE_CHUNK_SIZE);
+
+		io_result = io_read(image_handle, image_base + offset,
+				    chunk_size, &chunk_read);
+		*bytes_read += chunk_read;
+		if ((io_result != 0) || (chunk_read < chunk_size)) {
+			crypto_mod_hash_stream_discard();
+			return io_result;
+		}
+
+		if (hashing) {
+			hashing = (crypto_mod_hash_stream_update(
+					(void *)(image_base + offset),
+					(unsigned int)chunk_size) == 0);
+		}
+	}
+
+	if (hashing) {
+		(void)crypto_mod_hash_stream_finish();
+	}
+
+	return 0;
+}
+#endif /* LOAD_IMAGE_STREAM_HASH */
+
+/*******************************************************************************
+ * Internal function to load an image at a specific address given
+ * an image ID and extents of free memory.
+ *
+ * If the load is successful then the image information is updated.
+ *
+ * Returns 0 on success, a negative error code otherwise.
+ ******************************************************************************/
+static int load_image(unsigned int image_id, image_info_t *image_data)
+{
+	uintptr_t dev_handle;
+	uintptr_t image_handle;
+	uintptr_t image_base;
+	size_t image_size;
+	size_t bytes_read;
+	int io_result;
+
+	io_result = open_image(image_id, image_data, &dev_handle,
+			       &image_handle);
+	if (io_result != 0) {
+		return io_result;
+	}
+
+	image_base = image_data->image_base;
+	image_size = image_data->image_size;
+
 	/* We have enough space so load the image now */
 	/* TODO: Consider whether to try to recover/retry a partially successful read */
+	BOOT_TIMELINE_START(BOOT_TL_EV_IMAGE_LOAD, image_id);
+#if LOAD_IMAGE_STREAM_HASH
+	io_result = read_image_chunks(image_handle, image_base, image_size,
+				      &bytes_read);
+#else
 	io_result = io_read(image_handle, image_base, image_size, &bytes_read);
+#endif
+	BOOT_TIMELINE_END(BOOT_TL_EV_IMAGE_LOAD, image_id);
 	if ((io_result != 0) || (bytes_read < image_size)) {
 		WARN("Failed to load image id=%u (%i)\n", image_id, io_result);
-		goto exit;
+	} else {
+		BOOT_TIMELINE_MARK(BOOT_TL_EV_IMAGE_SIZE, (uint32_t)bytes_read);
+		INFO("Image id=%u loaded: 0x%lx - 0x%lx\n", image_id,
+		     image_base, (uintptr_t)(image_base + image_size));
 	}
 
-	INFO("Image id=%u loaded: 0x%lx - 0x%lx\n", image_id, image_base,
-	     (uintptr_t)(image_base + image_size));
+	close_image(dev_handle, image_handle);
 
-exit:
-	(void)io_close(image_handle);
-	/* Ignore improbable/unrecoverable error in 'close' */
+	return io_result;
+}
 
-	/* TODO: Consider maintaining open device connection from this bootloader stage */
-	(void)io_dev_close(dev_handle);
-	/* Ignore improbable/unrecoverable error in 'dev_close' */
+/*******************************************************************************
+ * Internal function to load an image, or to use it where it lies if it has the
+ * IMAGE_ATTRIB_IN_PLACE attribute and its storage is addressable memory, e.g.
+ * an XIP flash or a FIP preloaded in DRAM. In that case image_base is updated
+ * to its address, otherwise the attribute is cleared and the image is copied.
+ ******************************************************************************/
+static int load_or_map_image(unsigned int image_id, image_info_t *image_data)
+{
+	uintptr_t dev_handle;
+	uintptr_t image_handle;
+	uintptr_t image_base;
+	int io_result;
 
-	return io_result;
+	if ((image_data->h.attr & IMAGE_ATTRIB_IN_PLACE) == 0U) {
+		return load_image(image_id, image_data);
+	}
+
+	io_result = open_image(image_id, image_data, &dev_handle,
+			       &image_handle);
+	if (io_result != 0) {
+		return io_result;
+	}
+
+	io_result = io_map(image_handle, &image_base);
+	close_image(dev_handle, image_handle);
+
+	if (io_result != 0) {
+		VERBOSE("Image id=%u can't be used in place (%i)\n", image_id,
+			io_result);
+		image_data->h.attr &= ~IMAGE_ATTRIB_IN_PLACE;
+		return load_image(image_id, image_data);
+	}
+
+	image_data->image_base = image_base;
+	BOOT_TIMELINE_MARK(BOOT_TL_EV_IMAGE_SIZE, image_data->image_size);
+	INFO("Image id=%u used in place: 0x%lx - 0x%lx\n", image_id,
+	     image_base, (uintptr_t)(image_base + image_data->image_size));
+
+	return 0;
 }
 
 #if TRUSTED_BOARD_BOOT
+/*
+ * This function authenticates an image that has already been loaded. On
+ * failure, the image is wiped from memory.
+ */
+static int auth_image(unsigned int image_id, image_info_t *image_data)
+{
+	int rc;
+
+	BOOT_TIMELINE_START(BOOT_TL_EV_IMAGE_AUTH, image_id);
+	rc = auth_mod_verify_img(image_id,
+				 (void *)image_data->image_base,
+				 image_data->image_size);
+	BOOT_TIMELINE_END(BOOT_TL_EV_IMAGE_AUTH, image_id);
+	if (rc != 0) {
+		/*
+		 * Authentication error, zero memory and flush it right away,
+		 * unless the image is used in place in the storage.
+		 */
+		if ((image_data->h.attr & IMAGE_ATTRIB_IN_PLACE) == 0U) {
+			zero_normalmem((void *)image_data->image_base,
+				       image_data->image_size);
+			flush_dcache_range(image_data->image_base,
+					   image_data->image_size);
+		}
+		return -EAUTH;
+	}
+
+	return 0;
+}
+
 /*
  * This function uses recursion to authenticate the parent images up to the root
- * of trust.
+ * of trust. The parents are always loaded, in the memory of the image.
  */
 static int load_auth_image_recursive(unsigned int image_id,
-				    image_info_t *image_data)
+				    image_info_t *image_data, bool is_parent)
 {
 	int rc;
 	unsigned int parent_id;
@@ -158,32 +332,24 @@ static int load_auth_image_recursive(unsigned int image_id,
 	/* Use recursion to authenticate parent images */
 	rc = auth_mod_get_parent_id(image_id, &parent_id);
 	if (rc == 0) {
-		rc = load_auth_image_recursive(parent_id, image_data);
+		rc = load_auth_image_recursive(parent_id, image_data, true);
 		if (rc != 0) {
 			return rc;
 		}
 	}
 
 	/* Load the image */
-	rc = load_image(image_id, image_data);
+	if (is_parent) {
+		rc = load_image(image_id, image_data);
+	} else {
+		rc = load_or_map_image(image_id, image_data);
+	}
 	if (rc != 0) {
 		return rc;
 	}
 
 	/* Authenticate it */
-	rc = auth_mod_verify_img(image_id,
-				 (void *)image_data->image_base,
-				 image_data->image_size);
-	if (rc != 0) {
-		/* Authentication error, zero memory and flush it right away. */
-		zero_normalmem((void *)image_data->image_base,
-			       image_data->image_size);
-		flush_dcache_range(image_data->image_base,
-				   image_data->image_size);
-		return -EAUTH;
-	}
-
-	return 0;
+	return auth_image(image_id, image_data);
 }
 #endif /* TRUSTED_BOARD_BOOT */
 
@@ -192,11 +358,34 @@ static int load_auth_image_internal(unsigned int image_id,
 {
 #if TRUSTED_BOARD_BOOT
 	if (dyn_is_auth_disabled() == 0) {
-		return load_auth_image_recursive(image_id, image_data);
+		return load_auth_image_recursive(image_id, image_data, false);
 	}
 #endif
 
-	return load_image(image_id, image_data);
+	return load_or_map_image(image_id, image_data);
+}
+
+/*
+ * Measure an image that has been loaded and authenticated (if MEASURED_BOOT
+ * flag is enabled), then flush it to main memory so that it can be executed
+ * later by any CPU, regardless of cache and MMU state.
+ */
+static int measure_and_flush_image(unsigned int image_id,
+				   image_info_t *image_data)
+{
+	int err;
+
+	BOOT_TIMELINE_START(BOOT_TL_EV_IMAGE_MEASURE, image_id);
+	err = plat_mboot_measure_image(image_id, image_data);
+	BOOT_TIMELINE_END(BOOT_TL_EV_IMAGE_MEASURE, image_id);
+	if (err != 0) {
+		return err;
+	}
+
+	flush_dcache_range(image_data->image_base,
+			   image_data->image_size);
+
+	return 0;
 }
 
 /*******************************************************************************
@@ -210,6 +399,13 @@ int load_auth_image(unsigned int image_id, image_info_t *image_data)
 {
 	int err;
 
+#if FAST_REBOOT && IMAGE_BL2
+	/* An image kept by the previous boot only needs its hash checked */
+	if (fast_reboot_restore_image(image_id, image_data) == 0) {
+		return measure_and_flush_image(image_id, image_data);
+	}
+#endif
+
 	if ((plat_try_img_ops == NULL) || (plat_try_img_ops->next_instance == NULL)) {
 		err = load_auth_image_internal(image_id, image_data);
 	} else {
@@ -227,24 +423,147 @@ int load_auth_image(unsigned int image_id, image_info_t *image_data)
 		/*
 		 * If loading of the image gets passed (along with its
 		 * authentication in case of Trusted-Boot flow) then measure
-		 * it (if MEASURED_BOOT flag is enabled).
+		 * and flush it.
 		 */
-		err = plat_mboot_measure_image(image_id, image_data);
-		if (err != 0) {
-			return err;
-		}
+		err = measure_and_flush_image(image_id, image_data);
+	}
 
-		/*
-		 * Flush the image to main memory so that it can be executed
-		 * later by any CPU, regardless of cache and MMU state.
-		 */
-		flush_dcache_range(image_data->image_base,
-				   image_data->image_size);
+#if FAST_REBOOT && IMAGE_BL2
+	if (err == 0) {
+		fast_reboot_save_image(image_id, image_data);
 	}
+#endif
+
+#if LOAD_IMAGE_STREAM_HASH
+	/* The image may be modified from now on */
+	crypto_mod_hash_stream_discard();
+#endif
 
 	return err;
 }
 
+#if BL2_PIPELINED_LOAD
+/*******************************************************************************
+ * Split version of load_auth_image() used to overlap the read of an image with
+ * other work. This function authenticates the parent images of 'image_id' (if
+ * TBB is enabled), then starts reading the image itself and returns without
+ * waiting for the read to complete. The caller must not touch the image memory
+ * until load_auth_image_wait() has returned.
+ *
+ * Unlike load_auth_image(), no alternate image instances are tried on failure.
+ ******************************************************************************/
+int load_auth_image_start(unsigned int image_id, image_info_t *image_data,
+			  image_load_req_t *req)
+{
+	int rc;
+
+	assert(req != NULL);
+
+	req->image_id = image_id;
+	req->image_data = image_data;
+
+#if TRUSTED_BOARD_BOOT
+	if (dyn_is_auth_disabled() == 0) {
+		unsigned int parent_id;
+
+		if (auth_mod_get_parent_id(image_id, &parent_id) == 0) {
+			rc = load_auth_image_recursive(parent_id, image_data,
+						       true);
+			if (rc != 0) {
+				return rc;
+			}
+		}
+	}
+#endif
+
+	rc = open_image(image_id, image_data, &req->dev_handle,
+			&req->image_handle);
+	if (rc != 0) {
+		return rc;
+	}
+
+#if LOAD_IMAGE_STREAM_HASH
+	/* Asynchronous reads are not hashed on the fly */
+	crypto_mod_hash_stream_discard();
+#endif
+
+	BOOT_TIMELINE_START(BOOT_TL_EV_IMAGE_LOAD, image_id);
+	rc = io_read_async(req->image_handle, image_data->image_base,
+			   image_data->image_size);
+	if (rc != 0) {
+		WARN("Failed to load image id=%u (%i)\n", image_id, rc);
+		close_image(req->dev_handle, req->image_handle);
+	}
+
+	return rc;
+}
+
+/*******************************************************************************
+ * Wait for the read started by load_auth_image_start() to complete.
+ ******************************************************************************/
+int load_auth_image_wait(image_load_req_t *req)
+{
+	image_info_t *image_data;
+	size_t bytes_read = 0U;
+	int rc;
+
+	assert(req != NULL);
+
+	image_data = req->image_data;
+
+	rc = io_read_wait(req->image_handle, &bytes_read);
+	BOOT_TIMELINE_END(BOOT_TL_EV_IMAGE_LOAD, req->image_id);
+	if ((rc == 0) && (bytes_read < image_data->image_size)) {
+		rc = -EIO;
+	}
+
+	if (rc != 0) {
+		WARN("Failed to load image id=%u (%i)\n", req->image_id, rc);
+	} else {
+		BOOT_TIMELINE_MARK(BOOT_TL_EV_IMAGE_SIZE, (uint32_t)bytes_read);
+		INFO("Image id=%u loaded: 0x%lx - 0x%lx\n", req->image_id,
+		     image_data->image_base,
+		     (uintptr_t)(image_data->image_base +
+				 image_data->image_size));
+	}
+
+	close_image(req->dev_handle, req->image_handle);
+
+	return rc;
+}
+
+/*******************************************************************************
+ * Authenticate (if TBB is enabled), measure and flush an image whose read has
+ * completed through load_auth_image_wait().
+ ******************************************************************************/
+int load_auth_image_finish(image_load_req_t *req)
+{
+	int rc;
+
+	assert(req != NULL);
+
+#if TRUSTED_BOARD_BOOT
+	if (dyn_is_auth_disabled() == 0) {
+		rc = auth_image(req->image_id, req->image_data);
+
+		if (rc != 0) {
+			return rc;
+		}
+	}
+#endif
+
+	rc = measure_and_flush_image(req->image_id, req->image_data);
+
+#if FAST_REBOOT && IMAGE_BL2
+	if (rc == 0) {
+		fast_reboot_save_image(req->image_id, req->image_data);
+	}
+#endif
+
+	return rc;
+}
+#endif /* BL2_PIPELINED_LOAD */
+
 /*******************************************************************************
  * Print the content of an entry_point_info_t structure.
  ******************************************************************************/
@@ -5,15 +5,44 @@
  */
 
 #include <assert.h>
+#include <stdint.h>
 
 #include <arch_helpers.h>
 #include <common/bl_common.h>
 #include <common/desc_image_load.h>
 #include <common/tbbr/tbbr_img_def.h>
+#include <lib/utils.h>
 
 static bl_load_info_t bl_load_info;
 static bl_params_t next_bl_params;
 
+/*
+ * Position of the image descriptors by image id, plus one so that 0 means the
+ * image has no descriptor. It is built on first use, and again if the
+ * platform moves the descriptor array.
+ */
+static uint16_t bl_mem_params_pos[MAX_NUMBER_IDS];
+static const bl_mem_params_node_t *bl_mem_params_pos_desc;
+static unsigned int bl_mem_params_pos_num;
+
+static void build_bl_params_node_pos(void)
+{
+	unsigned int index, image_id;
+
+	zeromem(bl_mem_params_pos, sizeof(bl_mem_params_pos));
+
+	for (index = 0U; index < bl_mem_params_desc_num; index++) {
+		image_id = bl_mem_params_desc_ptr[index].image_id;
+		if ((image_id < MAX_NUMBER_IDS) &&
+		    (bl_mem_params_pos[image_id] == 0U)) {
+			bl_mem_params_pos[image_id] = (uint16_t)(index + 1U);
+		}
+	}
+
+	bl_mem_params_pos_desc = bl_mem_params_desc_ptr;
+	bl_mem_params_pos_num = bl_mem_params_desc_num;
+}
+
 
 /*******************************************************************************
  * This function flushes the data structures so that they are visible
@@ -55,12 +84,26 @@ int get_bl_params_node_index(unsigned int image_id)
 	unsigned int index;
 	assert(image_id != INVALID_IMAGE_ID);
 
+	if (image_id < MAX_NUMBER_IDS) {
+		if ((bl_mem_params_pos_desc != bl_mem_params_desc_ptr) ||
+		    (bl_mem_params_pos_num != bl_mem_params_desc_num)) {
+			build_bl_params_node_pos();
+		}
+
+		index = bl_mem_params_pos[image_id];
+		if (index == 0U)
+			return -1;
+
+		assert(bl_mem_params_desc_ptr[index - 1U].image_id == image_id);
+		return (int)(index - 1U);
+	}
+
+	/* Image ids beyond the TBBR ones are searched for */
 	for (index = 0U; index < bl_mem_params_desc_num; index++) {
 		if (bl_mem_params_desc_ptr[index].image_id == image_id)
 			return (int)index;
 	}
 
-	
 	return -1;
 }
 
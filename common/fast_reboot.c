@@ -0,0 +1,241 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <arch_helpers.h>
+#include <common/debug.h>
+#include <common/fast_reboot.h>
+#include <drivers/auth/crypto_mod.h>
+#include <lib/cassert.h>
+#include <lib/utils.h>
+#include <lib/utils_def.h>
+
+#include <platform_def.h>
+
+#define FR_RECORD	((struct fast_reboot_record *)PLAT_FAST_REBOOT_BASE)
+#define FR_STASH_BASE	(PLAT_FAST_REBOOT_BASE +			\
+			 round_up(sizeof(struct fast_reboot_record),	\
+				  CACHE_WRITEBACK_GRANULE))
+#define FR_STASH_SIZE	(PLAT_FAST_REBOOT_BASE + PLAT_FAST_REBOOT_SIZE -	\
+			 FR_STASH_BASE)
+
+CASSERT(PLAT_FAST_REBOOT_SIZE > round_up(sizeof(struct fast_reboot_record),
+					 CACHE_WRITEBACK_GRANULE),
+	assert_fast_reboot_region_holds_record);
+
+#if IMAGE_BL2
+/* Whether this boot reuses the images of the previous one, set on first use */
+static enum {
+	FR_UNKNOWN,
+	FR_FULL,
+	FR_FAST
+} fr_state;
+
+static int fr_calc_hash(const void *data, size_t len,
+			uint8_t hash[FAST_REBOOT_HASH_SIZE])
+{
+	unsigned char md[CRYPTO_MD_MAX_SIZE];
+	int rc;
+
+	rc = crypto_mod_calc_hash(CRYPTO_MD_SHA256, (void *)data,
+				  (unsigned int)len, md);
+	if (rc == 0) {
+		(void)memcpy(hash, md, FAST_REBOOT_HASH_SIZE);
+	}
+
+	return rc;
+}
+
+static bool fr_record_is_valid(void)
+{
+	const struct fast_reboot_record *rec = FR_RECORD;
+	uint8_t hash[FAST_REBOOT_HASH_SIZE];
+
+	if ((rec->body.magic != FAST_REBOOT_MAGIC) ||
+	    (rec->body.version != FAST_REBOOT_VERSION) ||
+	    (rec->body.num_images > PLAT_FAST_REBOOT_MAX_IMAGES) ||
+	    (rec->body.used > FR_STASH_SIZE)) {
+		return false;
+	}
+
+	if (fr_calc_hash(&rec->body, sizeof(rec->body), hash) != 0) {
+		return false;
+	}
+
+	return memcmp(hash, rec->hash, FAST_REBOOT_HASH_SIZE) == 0;
+}
+
+/* Update the hash of the record body and write the record back to memory */
+static void fr_record_seal(void)
+{
+	struct fast_reboot_record *rec = FR_RECORD;
+
+	if (fr_calc_hash(&rec->body, sizeof(rec->body), rec->hash) != 0) {
+		/* The next reset then simply does a full boot */
+		rec->body.magic = 0U;
+	}
+
+	flush_dcache_range((uintptr_t)rec, sizeof(*rec));
+}
+
+static struct fast_reboot_image *fr_find_image(unsigned int image_id)
+{
+	struct fast_reboot_record *rec = FR_RECORD;
+
+	for (unsigned int i = 0U; i < rec->body.num_images; i++) {
+		if (rec->body.images[i].image_id == image_id) {
+			return &rec->body.images[i];
+		}
+	}
+
+	return NULL;
+}
+
+/*
+ * Return whether this boot follows a fast reboot. The record is disarmed on
+ * the first call so that a failure of this boot leads to a full one. On a full
+ * boot, the record is emptied to collect the images loaded by this boot.
+ */
+bool fast_reboot_is_active(void)
+{
+	struct fast_reboot_record *rec = FR_RECORD;
+
+	if (fr_state != FR_UNKNOWN) {
+		return fr_state == FR_FAST;
+	}
+
+	if ((rec->armed == FAST_REBOOT_ARMED) && fr_record_is_valid()) {
+		INFO("Fast reboot: reusing %u image(s)\n",
+		     rec->body.num_images);
+		fr_state = FR_FAST;
+	} else {
+		fr_state = FR_FULL;
+		zeromem(&rec->body, sizeof(rec->body));
+		rec->body.magic = FAST_REBOOT_MAGIC;
+		rec->body.version = FAST_REBOOT_VERSION;
+	}
+
+	rec->armed = 0U;
+	fr_record_seal();
+
+	return fr_state == FR_FAST;
+}
+
+/*
+ * Copy an image kept by the previous boot to its load address, and check its
+ * hash there. Return 0 on success, else the image must be loaded from storage.
+ */
+int fast_reboot_restore_image(unsigned int image_id, image_info_t *image_data)
+{
+	const struct fast_reboot_image *img;
+	uint8_t hash[FAST_REBOOT_HASH_SIZE];
+
+	assert(image_data != NULL);
+
+	if (!fast_reboot_is_active()) {
+		return -ENOENT;
+	}
+
+	img = fr_find_image(image_id);
+	if (img == NULL) {
+		return -ENOENT;
+	}
+
+	if ((img->offset + img->size > FR_STASH_SIZE) ||
+	    (img->size > image_data->image_max_size)) {
+		return -ENOMEM;
+	}
+
+	(void)memcpy((void *)image_data->image_base,
+		     (const void *)(FR_STASH_BASE + img->offset), img->size);
+
+	if ((fr_calc_hash((const void *)image_data->image_base, img->size,
+			  hash) != 0) ||
+	    (memcmp(hash, img->hash, FAST_REBOOT_HASH_SIZE) != 0)) {
+		WARN("Fast reboot: image id=%u does not match its hash\n",
+		     image_id);
+		return -EAUTH;
+	}
+
+	image_data->image_size = img->size;
+
+	return 0;
+}
+
+/*
+ * Keep a copy of an image loaded and authenticated by this boot for the next
+ * fast reboot. Images that do not fit are simply loaded from storage again.
+ */
+void fast_reboot_save_image(unsigned int image_id,
+			    const image_info_t *image_data)
+{
+	struct fast_reboot_record *rec = FR_RECORD;
+	struct fast_reboot_image *img;
+	uintptr_t dst;
+
+	assert(image_data != NULL);
+
+	(void)fast_reboot_is_active();
+
+	if (((image_data->h.attr & IMAGE_ATTRIB_IN_PLACE) != 0U) ||
+	    (rec->body.magic != FAST_REBOOT_MAGIC) ||
+	    (fr_find_image(image_id) != NULL)) {
+		return;
+	}
+
+	if ((rec->body.num_images == PLAT_FAST_REBOOT_MAX_IMAGES) ||
+	    (image_data->image_size > (FR_STASH_SIZE - rec->body.used))) {
+		VERBOSE("Fast reboot: no room for image id=%u\n", image_id);
+		return;
+	}
+
+	img = &rec->body.images[rec->body.num_images];
+	if (fr_calc_hash((const void *)image_data->image_base,
+			 image_data->image_size, img->hash) != 0) {
+		return;
+	}
+
+	dst = FR_STASH_BASE + rec->body.used;
+	(void)memcpy((void *)dst, (const void *)image_data->image_base,
+		     image_data->image_size);
+	flush_dcache_range(dst, image_data->image_size);
+
+	img->image_id = image_id;
+	img->size = image_data->image_size;
+	img->offset = rec->body.used;
+	rec->body.used = MIN(FR_STASH_SIZE,
+			     round_up(rec->body.used + image_data->image_size,
+				      CACHE_WRITEBACK_GRANULE));
+	rec->body.num_images++;
+
+	fr_record_seal();
+}
+#endif /* IMAGE_BL2 */
+
+#if IMAGE_BL31
+/*
+ * Arm the record for the next reset. BL2 then reuses the images of the record
+ * if its hash still matches. Return -ENOENT if there is nothing to reuse.
+ */
+int fast_reboot_arm(void)
+{
+	struct fast_reboot_record *rec = FR_RECORD;
+
+	if ((rec->body.magic != FAST_REBOOT_MAGIC) ||
+	    (rec->body.num_images == 0U)) {
+		return -ENOENT;
+	}
+
+	rec->armed = FAST_REBOOT_ARMED;
+	flush_dcache_range((uintptr_t)&rec->armed, sizeof(rec->armed));
+
+	return 0;
+}
+#endif /* IMAGE_BL31 */
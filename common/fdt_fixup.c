@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2022, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2016-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -12,8 +12,11 @@
  * Also it supports to add reserved memory nodes to describe memory that
  * is used by the secure world, so that non-secure software avoids using
  * that.
+ * The fdt_fixup_*() variants stage their changes in a fixup session, which
+ * applies them to the blob in one pass when it is committed.
  */
 
+#include <assert.h>
 #include <errno.h>
 #include <stdio.h>
 #include <string.h>
@@ -93,6 +96,30 @@ int dt_add_psci_node(void *fdt)
 	return 0;
 }
 
+/*
+ * Tell whether a node has a "device_type" property with the value "cpu" and
+ * an enable-method which is not "psci" (yet).
+ */
+static bool dt_cpu_node_needs_psci(const void *fdt, int offs)
+{
+	const char *prop;
+	int len;
+
+	prop = fdt_getprop(fdt, offs, "device_type", &len);
+	if (prop == NULL)
+		return false;
+	if ((strcmp(prop, "cpu") != 0) || (len != 4))
+		return false;
+
+	/* Ignore any nodes which already use "psci". */
+	prop = fdt_getprop(fdt, offs, "enable-method", &len);
+	if ((prop != NULL) &&
+	    (strcmp(prop, "psci") == 0) && (len == 5))
+		return false;
+
+	return true;
+}
+
 /*
  * Find the first subnode that has a "device_type" property with the value
  * "cpu" and which's enable-method is not "psci" (yet).
@@ -112,20 +139,9 @@ static int dt_update_one_cpu_node(void *fdt, int offset)
 	/* Iterate over all subnodes to find those with device_type = "cpu". */
 	for (offs = fdt_first_subnode(fdt, offset); offs >= 0;
 	     offs = fdt_next_subnode(fdt, offs)) {
-		const char *prop;
-		int len;
 		int ret;
 
-		prop = fdt_getprop(fdt, offs, "device_type", &len);
-		if (prop == NULL)
-			continue;
-		if ((strcmp(prop, "cpu") != 0) || (len != 4))
-			continue;
-
-		/* Ignore any nodes which already use "psci". */
-		prop = fdt_getprop(fdt, offs, "enable-method", &len);
-		if ((prop != NULL) &&
-		    (strcmp(prop, "psci") == 0) && (len == 5))
+		if (!dt_cpu_node_needs_psci(fdt, offs))
 			continue;
 
 		ret = fdt_setprop_string(fdt, offs, "enable-method", "psci");
@@ -172,6 +188,61 @@ int dt_add_psci_cpu_enable_methods(void *fdt)
 
 #define HIGH_BITS(x) ((sizeof(x) > 4) ? ((x) >> 32) : (typeof(x))0)
 
+/*
+ * Tell whether a subnode of the /reserved-memory node at @offs already covers
+ * the whole of a region.
+ */
+static bool fdt_reserved_region_exists(const void *dtb, int offs,
+				       uintptr_t base, size_t size)
+{
+	int node;
+
+	fdt_for_each_subnode(node, dtb, offs) {
+		uintptr_t c_base;
+		size_t c_size;
+		int ret;
+
+		ret = fdt_get_reg_props_by_index(dtb, node, 0, &c_base, &c_size);
+		/* Ignore illegal subnodes */
+		if (ret != 0) {
+			continue;
+		}
+
+		/* existing region entirely contains the new region */
+		if (base >= c_base && (base + size) <= (c_base + c_size)) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+/*
+ * Fill in the "reg" cells of a reserved region, using @ac address cells and
+ * @sc size cells. Returns the number of cells written.
+ */
+static unsigned int fdt_encode_reserved_reg(uint32_t *addresses, int ac,
+					    int sc, uintptr_t base,
+					    size_t size)
+{
+	unsigned int idx = 0;
+
+	if (ac > 1) {
+		addresses[idx] = cpu_to_fdt32(HIGH_BITS(base));
+		idx++;
+	}
+	addresses[idx] = cpu_to_fdt32(base & 0xffffffff);
+	idx++;
+	if (sc > 1) {
+		addresses[idx] = cpu_to_fdt32(HIGH_BITS(size));
+		idx++;
+	}
+	addresses[idx] = cpu_to_fdt32(size & 0xffffffff);
+	idx++;
+
+	return idx;
+}
+
 /*******************************************************************************
  * fdt_add_reserved_memory() - reserve (secure) memory regions in DT
  * @dtb:	pointer to the device tree blob in memory
@@ -197,10 +268,9 @@ int fdt_add_reserved_memory(void *dtb, const char *node_name,
 			    uintptr_t base, size_t size)
 {
 	int offs = fdt_path_offset(dtb, "/reserved-memory");
-	int node;
 	uint32_t addresses[4];
 	int ac, sc;
-	unsigned int idx = 0;
+	unsigned int idx;
 
 	ac = fdt_address_cells(dtb, 0);
 	sc = fdt_size_cells(dtb, 0);
@@ -214,36 +284,11 @@ int fdt_add_reserved_memory(void *dtb, const char *node_name,
 		fdt_setprop(dtb, offs, "ranges", NULL, 0);
 	}
 
-	/* Check for existing regions */
-	fdt_for_each_subnode(node, dtb, offs) {
-		uintptr_t c_base;
-		size_t c_size;
-		int ret;
-
-		ret = fdt_get_reg_props_by_index(dtb, node, 0, &c_base, &c_size);
-		/* Ignore illegal subnodes */
-		if (ret != 0) {
-			continue;
-		}
-
-		/* existing region entirely contains the new region */
-		if (base >= c_base && (base + size) <= (c_base + c_size)) {
-			return 0;
-		}
+	if (fdt_reserved_region_exists(dtb, offs, base, size)) {
+		return 0;
 	}
 
-	if (ac > 1) {
-		addresses[idx] = cpu_to_fdt32(HIGH_BITS(base));
-		idx++;
-	}
-	addresses[idx] = cpu_to_fdt32(base & 0xffffffff);
-	idx++;
-	if (sc > 1) {
-		addresses[idx] = cpu_to_fdt32(HIGH_BITS(size));
-		idx++;
-	}
-	addresses[idx] = cpu_to_fdt32(size & 0xffffffff);
-	idx++;
+	idx = fdt_encode_reserved_reg(addresses, ac, sc, base, size);
 	offs = fdt_add_subnode(dtb, offs, node_name);
 	fdt_setprop(dtb, offs, "no-map", NULL, 0);
 	fdt_setprop(dtb, offs, "reg", addresses, idx * sizeof(uint32_t));
@@ -643,3 +688,863 @@ int fdt_set_mac_address(void *dtb, unsigned int ethernet_idx,
 
 	return fdt_setprop(dtb, node, "local-mac-address", mac_addr, 6);
 }
+
+/*
+ * A staged edit of the structure block. An edit either inserts @len staged
+ * bytes at @offset, or, if @data is FIXUP_EDIT_NOP, overwrites the @len bytes
+ * of a replaced property at @offset with FDT_NOP tags. Offsets are those of
+ * the original structure block. @node is the existing node whose property is
+ * set, or -1 for the insertion of a new subtree.
+ */
+struct fdt_fixup_edit {
+	uint32_t offset;
+	uint32_t len;
+	uint32_t data;
+	int32_t node;
+};
+
+#define FIXUP_EDIT_NOP		UINT32_MAX
+#define FIXUP_TAGALIGN(x)	(((x) + FDT_TAGSIZE - 1U) & ~(FDT_TAGSIZE - 1U))
+
+/* Edits are stored downwards from the end of the work area. */
+static struct fdt_fixup_edit *fixup_edit(struct fdt_fixup_session *s,
+					 unsigned int idx)
+{
+	return (struct fdt_fixup_edit *)(s->work + s->work_size) - 1 - idx;
+}
+
+/* Free space left in the blob once the staged edits are applied. */
+static size_t fixup_blob_free(const struct fdt_fixup_session *s)
+{
+	size_t used = fdt_off_dt_strings(s->dtb) + fdt_size_dt_strings(s->dtb) +
+		      s->growth;
+
+	return fdt_totalsize(s->dtb) - used;
+}
+
+static int fixup_add_edit(struct fdt_fixup_session *s, uint32_t offset,
+			  uint32_t len, uint32_t data, int node)
+{
+	struct fdt_fixup_edit *edit;
+
+	if ((s->data_size + ((s->nr_edits + 1U) * sizeof(*edit))) >
+	    s->work_size) {
+		return -FDT_ERR_NOSPACE;
+	}
+
+	edit = fixup_edit(s, s->nr_edits);
+	edit->offset = offset;
+	edit->len = len;
+	edit->data = data;
+	edit->node = node;
+	s->nr_edits++;
+
+	return 0;
+}
+
+/*
+ * Reserve @len bytes, padded to the tag size, at the end of the last edit.
+ * Returns a pointer to the zeroed bytes, or NULL if either the work area or
+ * the blob would overflow.
+ */
+static void *fixup_stage(struct fdt_fixup_session *s, size_t len)
+{
+	size_t alen = FIXUP_TAGALIGN(len);
+	uint8_t *p;
+
+	if ((s->data_size + alen + (s->nr_edits * sizeof(struct fdt_fixup_edit)))
+	    > s->work_size) {
+		return NULL;
+	}
+	if (fixup_blob_free(s) < alen) {
+		return NULL;
+	}
+
+	p = s->work + s->data_size;
+	(void)memset(p, 0, alen);
+	s->data_size += alen;
+	s->growth += alen;
+	fixup_edit(s, s->nr_edits - 1U)->len += alen;
+
+	return p;
+}
+
+/*
+ * Return the offset of @name in the strings block, appending it there if it
+ * is not found. The strings block is the last block of the blob, so appending
+ * to it does not move anything.
+ */
+static int fixup_string(struct fdt_fixup_session *s, const char *name)
+{
+	char *strtab = (char *)s->dtb + fdt_off_dt_strings(s->dtb);
+	size_t tabsize = fdt_size_dt_strings(s->dtb);
+	size_t len = strlen(name) + 1U;
+	unsigned int i;
+	int offset = -1;
+
+	for (i = 0U; i < FDT_FIXUP_STRING_CACHE; i++) {
+		if ((s->strings[i] >= 0) &&
+		    (strcmp(strtab + s->strings[i], name) == 0)) {
+			return s->strings[i];
+		}
+	}
+
+	for (i = 0U; (i + len) <= tabsize; i++) {
+		if (memcmp(strtab + i, name, len) == 0) {
+			offset = (int)i;
+			break;
+		}
+	}
+
+	if (offset < 0) {
+		if (fixup_blob_free(s) < len) {
+			return -FDT_ERR_NOSPACE;
+		}
+		(void)memcpy(strtab + tabsize, name, len);
+		fdt_set_size_dt_strings(s->dtb, tabsize + len);
+		offset = (int)tabsize;
+	}
+
+	s->strings[s->strings_next] = offset;
+	s->strings_next = (s->strings_next + 1U) % FDT_FIXUP_STRING_CACHE;
+
+	return offset;
+}
+
+static int fixup_stage_prop(struct fdt_fixup_session *s, int nameoff, int len,
+			    void **prop_data)
+{
+	struct fdt_property *prop;
+
+	prop = fixup_stage(s, sizeof(*prop) + (size_t)len);
+	if (prop == NULL) {
+		return -FDT_ERR_NOSPACE;
+	}
+
+	prop->tag = cpu_to_fdt32(FDT_PROP);
+	prop->len = cpu_to_fdt32(len);
+	prop->nameoff = cpu_to_fdt32(nameoff);
+	*prop_data = prop->data;
+
+	return 0;
+}
+
+/* Return the offset of the FDT_END_NODE tag closing the node at @node. */
+static int fixup_node_end(struct fdt_fixup_session *s, int node)
+{
+	unsigned int depth = 0U;
+	int offset = node;
+	int next;
+
+	if (node == s->last_parent) {
+		return s->last_parent_end;
+	}
+
+	do {
+		switch (fdt_next_tag(s->dtb, offset, &next)) {
+		case FDT_BEGIN_NODE:
+			depth++;
+			break;
+		case FDT_END_NODE:
+			depth--;
+			break;
+		case FDT_END:
+			return (next < 0) ? next : -FDT_ERR_TRUNCATED;
+		default:
+			break;
+		}
+
+		if (depth == 0U) {
+			break;
+		}
+		offset = next;
+	} while (true);
+
+	s->last_parent = node;
+	s->last_parent_end = offset;
+
+	return offset;
+}
+
+/* Return the offset following the last property of the node at @node. */
+static int fixup_props_end(const void *dtb, int node)
+{
+	uint32_t tag;
+	int offset, next;
+
+	if (fdt_next_tag(dtb, node, &offset) != FDT_BEGIN_NODE) {
+		return -FDT_ERR_BADOFFSET;
+	}
+
+	do {
+		tag = fdt_next_tag(dtb, offset, &next);
+		if (next < 0) {
+			return next;
+		}
+		if ((tag != FDT_PROP) && (tag != FDT_NOP)) {
+			return offset;
+		}
+		offset = next;
+	} while (true);
+}
+
+/*******************************************************************************
+ * fdt_fixup_session_init() - start a fixup session on a DTB
+ * @s:		session to initialise
+ * @dtb:	pointer to the device tree blob in memory
+ * @work:	work area holding the staged changes until the commit
+ * @work_size:	size of the work area
+ *
+ * The blob must have been opened with fdt_open_into(), and have room for the
+ * changes up to its total size. It must not be changed by other means than
+ * the session, except in place, until fdt_fixup_session_commit() is called.
+ *
+ * Return: 0 on success, a negative libfdt error value otherwise.
+ ******************************************************************************/
+int fdt_fixup_session_init(struct fdt_fixup_session *s, void *dtb,
+			   void *work, size_t work_size)
+{
+	uintptr_t start = ((uintptr_t)work + FDT_TAGSIZE - 1U) &
+			  ~(uintptr_t)(FDT_TAGSIZE - 1U);
+	int ret;
+
+	ret = fdt_check_header(dtb);
+	if (ret < 0) {
+		return ret;
+	}
+	if (fdt_version(dtb) < 17) {
+		return -FDT_ERR_BADVERSION;
+	}
+	if ((fdt_off_mem_rsvmap(dtb) > fdt_off_dt_struct(dtb)) ||
+	    (fdt_off_dt_strings(dtb) !=
+	     (fdt_off_dt_struct(dtb) + fdt_size_dt_struct(dtb)))) {
+		return -FDT_ERR_BADLAYOUT;
+	}
+
+	(void)memset(s, 0, sizeof(*s));
+	s->dtb = dtb;
+	s->work = (uint8_t *)start;
+	if (work_size > (start - (uintptr_t)work)) {
+		s->work_size = (work_size - (start - (uintptr_t)work)) &
+			       ~(size_t)(FDT_TAGSIZE - 1U);
+	}
+	s->last_parent = -1;
+	for (unsigned int i = 0U; i < FDT_FIXUP_STRING_CACHE; i++) {
+		s->strings[i] = -1;
+	}
+
+	return 0;
+}
+
+/*******************************************************************************
+ * fdt_fixup_session_commit() - apply the changes staged in a fixup session
+ * @s:		session to commit
+ *
+ * Overwrite the replaced properties with FDT_NOP tags, move the strings block
+ * to its final place, then build the new structure block from its end,
+ * moving each original byte once and copying the staged bytes in between.
+ * The session is left empty and can be used again.
+ *
+ * Return: 0 on success, a negative libfdt error value otherwise.
+ ******************************************************************************/
+int fdt_fixup_session_commit(struct fdt_fixup_session *s)
+{
+	uint8_t *base = (uint8_t *)s->dtb + fdt_off_dt_struct(s->dtb);
+	uint32_t src_end = fdt_size_dt_struct(s->dtb);
+	uint32_t dst_end = src_end + s->growth;
+	struct fdt_fixup_edit *edits;
+	unsigned int i, j;
+
+	if (s->depth != 0U) {
+		return -FDT_ERR_BADSTATE;
+	}
+	if (s->nr_edits == 0U) {
+		return 0;
+	}
+
+	for (i = 0U; i < s->nr_edits; i++) {
+		struct fdt_fixup_edit *edit = fixup_edit(s, i);
+
+		if (edit->data != FIXUP_EDIT_NOP) {
+			continue;
+		}
+		for (j = 0U; j < edit->len; j += FDT_TAGSIZE) {
+			*(fdt32_t *)(base + edit->offset + j) =
+				cpu_to_fdt32(FDT_NOP);
+		}
+		edit->len = 0U;
+	}
+
+	/*
+	 * The edits are stored last first. Sort them by decreasing offset,
+	 * keeping the later of two edits at the same offset first. The edits
+	 * usually come in increasing offsets, which this sort handles in one
+	 * pass.
+	 */
+	edits = fixup_edit(s, s->nr_edits - 1U);
+	for (i = 1U; i < s->nr_edits; i++) {
+		struct fdt_fixup_edit edit = edits[i];
+
+		for (j = i; (j > 0U) && (edits[j - 1U].offset < edit.offset);
+		     j--) {
+			edits[j] = edits[j - 1U];
+		}
+		edits[j] = edit;
+	}
+
+	(void)memmove(base + dst_end, base + src_end,
+		      fdt_size_dt_strings(s->dtb));
+	fdt_set_off_dt_strings(s->dtb, fdt_off_dt_strings(s->dtb) + s->growth);
+
+	for (i = 0U; i < s->nr_edits; i++) {
+		uint32_t seg = src_end - edits[i].offset;
+
+		if (edits[i].len == 0U) {
+			continue;
+		}
+
+		dst_end -= seg;
+		(void)memmove(base + dst_end, base + edits[i].offset, seg);
+		dst_end -= edits[i].len;
+		(void)memcpy(base + dst_end, s->work + edits[i].data,
+			     edits[i].len);
+		src_end = edits[i].offset;
+	}
+	assert(dst_end == src_end);
+
+	fdt_set_size_dt_struct(s->dtb, fdt_size_dt_struct(s->dtb) + s->growth);
+
+	s->data_size = 0U;
+	s->nr_edits = 0U;
+	s->growth = 0U;
+	s->last_parent = -1;
+
+	return 0;
+}
+
+/*******************************************************************************
+ * fdt_fixup_begin_node() - stage a new node
+ * @s:		fixup session
+ * @parent:	offset of the parent node in the blob, or FDT_FIXUP_OPEN_NODE
+ *		to nest the new node in the node being built
+ * @name:	name of the new node
+ *
+ * The new node is added as the last subnode of its parent. Until the matching
+ * fdt_fixup_end_node(), properties and subnodes are added to it by passing
+ * FDT_FIXUP_OPEN_NODE, and nodes of the blob cannot be changed.
+ *
+ * Return: 0 on success, a negative libfdt error value otherwise.
+ ******************************************************************************/
+int fdt_fixup_begin_node(struct fdt_fixup_session *s, int parent,
+			 const char *name)
+{
+	size_t len = strlen(name) + 1U;
+	fdt32_t *tag;
+	int ret;
+
+	if (s->depth == 0U) {
+		if (parent == FDT_FIXUP_OPEN_NODE) {
+			return -FDT_ERR_BADSTATE;
+		}
+
+		ret = fdt_subnode_offset(s->dtb, parent, name);
+		if (ret >= 0) {
+			return -FDT_ERR_EXISTS;
+		}
+		if (ret != -FDT_ERR_NOTFOUND) {
+			return ret;
+		}
+
+		ret = fixup_node_end(s, parent);
+		if (ret < 0) {
+			return ret;
+		}
+
+		ret = fixup_add_edit(s, (uint32_t)ret, 0U, s->data_size, -1);
+		if (ret < 0) {
+			return ret;
+		}
+	} else if (parent != FDT_FIXUP_OPEN_NODE) {
+		return -FDT_ERR_BADSTATE;
+	}
+
+	tag = fixup_stage(s, sizeof(*tag) + len);
+	if (tag == NULL) {
+		return -FDT_ERR_NOSPACE;
+	}
+	*tag = cpu_to_fdt32(FDT_BEGIN_NODE);
+	(void)memcpy(tag + 1, name, len);
+
+	s->depth++;
+	s->props_closed = false;
+
+	return 0;
+}
+
+/*******************************************************************************
+ * fdt_fixup_end_node() - close the node opened by fdt_fixup_begin_node()
+ * @s:		fixup session
+ *
+ * Return: 0 on success, a negative libfdt error value otherwise.
+ ******************************************************************************/
+int fdt_fixup_end_node(struct fdt_fixup_session *s)
+{
+	fdt32_t *tag;
+
+	if (s->depth == 0U) {
+		return -FDT_ERR_BADSTATE;
+	}
+
+	tag = fixup_stage(s, sizeof(*tag));
+	if (tag == NULL) {
+		return -FDT_ERR_NOSPACE;
+	}
+	*tag = cpu_to_fdt32(FDT_END_NODE);
+
+	s->depth--;
+	s->props_closed = true;
+
+	return 0;
+}
+
+/*******************************************************************************
+ * fdt_fixup_setprop_placeholder() - stage a property and return its value
+ * @s:		fixup session
+ * @node:	offset of a node of the blob, or FDT_FIXUP_OPEN_NODE
+ * @name:	name of the property
+ * @len:	length of the property value
+ * @prop_data:	returns a pointer to the staged value, to be filled in by the
+ *		caller
+ *
+ * A property of a node of the blob is replaced if it exists, and added after
+ * the last property of the node otherwise. It can be set once per session.
+ * The properties of a new node must be added before its subnodes.
+ *
+ * Return: 0 on success, a negative libfdt error value otherwise.
+ ******************************************************************************/
+int fdt_fixup_setprop_placeholder(struct fdt_fixup_session *s, int node,
+				  const char *name, int len, void **prop_data)
+{
+	const struct fdt_property *prop;
+	const uint8_t *base;
+	unsigned int i;
+	int nameoff, oldlen, offset, ret;
+
+	if (len < 0) {
+		return -FDT_ERR_BADVALUE;
+	}
+
+	if (node == FDT_FIXUP_OPEN_NODE) {
+		if ((s->depth == 0U) || s->props_closed) {
+			return -FDT_ERR_BADSTATE;
+		}
+
+		nameoff = fixup_string(s, name);
+		if (nameoff < 0) {
+			return nameoff;
+		}
+
+		return fixup_stage_prop(s, nameoff, len, prop_data);
+	}
+
+	if (s->depth != 0U) {
+		return -FDT_ERR_BADSTATE;
+	}
+
+	prop = fdt_get_property(s->dtb, node, name, &oldlen);
+	if ((prop == NULL) && (oldlen != -FDT_ERR_NOTFOUND)) {
+		return oldlen;
+	}
+
+	nameoff = fixup_string(s, name);
+	if (nameoff < 0) {
+		return nameoff;
+	}
+
+	for (i = 0U; i < s->nr_edits; i++) {
+		const struct fdt_fixup_edit *edit = fixup_edit(s, i);
+		const struct fdt_property *staged;
+
+		if ((edit->node != node) || (edit->data == FIXUP_EDIT_NOP)) {
+			continue;
+		}
+		staged = (const void *)(s->work + edit->data);
+		if (fdt32_to_cpu(staged->nameoff) == (uint32_t)nameoff) {
+			return -FDT_ERR_EXISTS;
+		}
+	}
+
+	if (prop != NULL) {
+		base = (const uint8_t *)s->dtb + fdt_off_dt_struct(s->dtb);
+		offset = (int)((const uint8_t *)prop - base);
+		ret = fixup_add_edit(s, (uint32_t)offset,
+				     sizeof(*prop) + FIXUP_TAGALIGN((uint32_t)oldlen),
+				     FIXUP_EDIT_NOP, -1);
+		if (ret < 0) {
+			return ret;
+		}
+	} else {
+		offset = fixup_props_end(s->dtb, node);
+		if (offset < 0) {
+			return offset;
+		}
+	}
+
+	ret = fixup_add_edit(s, (uint32_t)offset, 0U, s->data_size, node);
+	if (ret < 0) {
+		return ret;
+	}
+
+	return fixup_stage_prop(s, nameoff, len, prop_data);
+}
+
+int fdt_fixup_setprop(struct fdt_fixup_session *s, int node,
+		      const char *name, const void *val, int len)
+{
+	void *prop_data;
+	int ret;
+
+	ret = fdt_fixup_setprop_placeholder(s, node, name, len, &prop_data);
+	if ((ret == 0) && (len > 0)) {
+		(void)memcpy(prop_data, val, len);
+	}
+
+	return ret;
+}
+
+int fdt_fixup_setprop_u32(struct fdt_fixup_session *s, int node,
+			  const char *name, uint32_t val)
+{
+	fdt32_t tmp = cpu_to_fdt32(val);
+
+	return fdt_fixup_setprop(s, node, name, &tmp, sizeof(tmp));
+}
+
+int fdt_fixup_setprop_u64(struct fdt_fixup_session *s, int node,
+			  const char *name, uint64_t val)
+{
+	fdt64_t tmp = cpu_to_fdt64(val);
+
+	return fdt_fixup_setprop(s, node, name, &tmp, sizeof(tmp));
+}
+
+int fdt_fixup_setprop_string(struct fdt_fixup_session *s, int node,
+			     const char *name, const char *str)
+{
+	return fdt_fixup_setprop(s, node, name, str, strlen(str) + 1);
+}
+
+/*******************************************************************************
+ * fdt_fixup_psci_cpu_enable_methods() - switch CPU nodes to PSCI in a session
+ * @s:		fixup session
+ *
+ * Session variant of dt_add_psci_cpu_enable_methods(). As the blob does not
+ * change until the commit, the CPU nodes are all patched in a single walk.
+ *
+ * Return: 0 on success, or a negative error value otherwise.
+ ******************************************************************************/
+int fdt_fixup_psci_cpu_enable_methods(struct fdt_fixup_session *s)
+{
+	int cpus, offs, ret;
+
+	cpus = fdt_path_offset(s->dtb, "/cpus");
+	if (cpus < 0) {
+		return cpus;
+	}
+
+	fdt_for_each_subnode(offs, s->dtb, cpus) {
+		if (!dt_cpu_node_needs_psci(s->dtb, offs)) {
+			continue;
+		}
+
+		ret = fdt_fixup_setprop_string(s, offs, "enable-method", "psci");
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	if (offs != -FDT_ERR_NOTFOUND) {
+		return offs;
+	}
+
+	return 0;
+}
+
+/*******************************************************************************
+ * fdt_fixup_reserved_memory() - reserve a memory region in a session
+ * @s:		fixup session
+ * @node_name:	name of the subnode to be used
+ * @base:	physical base address of the reserved region
+ * @size:	size of the reserved region
+ *
+ * Session variant of fdt_add_reserved_memory(). Only the regions in the blob
+ * are checked for one containing the new region, not those staged in the
+ * session.
+ *
+ * Return: 0 on success, a negative error value otherwise.
+ ******************************************************************************/
+int fdt_fixup_reserved_memory(struct fdt_fixup_session *s,
+			      const char *node_name, uintptr_t base,
+			      size_t size)
+{
+	int offs = fdt_path_offset(s->dtb, "/reserved-memory");
+	uint32_t addresses[4];
+	int ac, sc, ret;
+	unsigned int idx;
+
+	ac = fdt_address_cells(s->dtb, 0);
+	sc = fdt_size_cells(s->dtb, 0);
+	if (offs < 0) {			/* create if not existing yet */
+		ret = fdt_fixup_begin_node(s, 0, "reserved-memory");
+		if (ret < 0) {
+			return ret;
+		}
+		offs = FDT_FIXUP_OPEN_NODE;
+		fdt_fixup_setprop_u32(s, offs, "#address-cells", ac);
+		fdt_fixup_setprop_u32(s, offs, "#size-cells", sc);
+		fdt_fixup_setprop(s, offs, "ranges", NULL, 0);
+	} else if (fdt_reserved_region_exists(s->dtb, offs, base, size)) {
+		return 0;
+	}
+
+	idx = fdt_encode_reserved_reg(addresses, ac, sc, base, size);
+	ret = fdt_fixup_begin_node(s, offs, node_name);
+	if (ret < 0) {
+		return ret;
+	}
+	fdt_fixup_setprop(s, FDT_FIXUP_OPEN_NODE, "no-map", NULL, 0);
+	ret = fdt_fixup_setprop(s, FDT_FIXUP_OPEN_NODE, "reg", addresses,
+				idx * sizeof(uint32_t));
+	if (ret < 0) {
+		return ret;
+	}
+	ret = fdt_fixup_end_node(s);
+
+	if ((ret == 0) && (offs == FDT_FIXUP_OPEN_NODE)) {
+		ret = fdt_fixup_end_node(s);
+	}
+
+	return ret;
+}
+
+static int fdt_fixup_cpu(struct fdt_fixup_session *s, u_register_t mpidr)
+{
+	char snode_name[15];
+	uint64_t reg_prop;
+	int err;
+
+	reg_prop = mpidr & MPID_MASK & ~MPIDR_MT_MASK;
+
+	snprintf(snode_name, sizeof(snode_name), "cpu@%x",
+					(unsigned int)reg_prop);
+
+	err = fdt_fixup_begin_node(s, FDT_FIXUP_OPEN_NODE, snode_name);
+	if (err < 0) {
+		return err;
+	}
+
+	err = fdt_fixup_setprop_string(s, FDT_FIXUP_OPEN_NODE, "compatible",
+				       "arm,armv8");
+	if (err < 0) {
+		return err;
+	}
+
+	err = fdt_fixup_setprop_u64(s, FDT_FIXUP_OPEN_NODE, "reg", reg_prop);
+	if (err < 0) {
+		return err;
+	}
+
+	err = fdt_fixup_setprop_string(s, FDT_FIXUP_OPEN_NODE, "device_type",
+				       "cpu");
+	if (err < 0) {
+		return err;
+	}
+
+	err = fdt_fixup_setprop_string(s, FDT_FIXUP_OPEN_NODE,
+				       "enable-method", "psci");
+	if (err < 0) {
+		return err;
+	}
+
+	return fdt_fixup_end_node(s);
+}
+
+/******************************************************************************
+ * fdt_fixup_cpus_node() - add the cpus node in a session
+ * @s:		fixup session
+ * @afflv0:	Maximum number of threads per core (affinity level 0).
+ * @afflv1:	Maximum number of CPUs per cluster (affinity level 1).
+ * @afflv2:	Maximum number of clusters (affinity level 2).
+ *
+ * Session variant of fdt_add_cpus_node(). The whole /cpus node is staged as
+ * a single insertion, whatever the number of CPUs.
+ *
+ * Return: 0 on success, -EEXIST if there is already a /cpus node, or another
+ * negative value on error.
+ ******************************************************************************/
+int fdt_fixup_cpus_node(struct fdt_fixup_session *s, unsigned int afflv0,
+			unsigned int afflv1, unsigned int afflv2)
+{
+	int err;
+	unsigned int i, j, k;
+	u_register_t mpidr;
+
+	if (fdt_path_offset(s->dtb, "/cpus") >= 0) {
+		return -EEXIST;
+	}
+
+	err = fdt_fixup_begin_node(s, 0, "cpus");
+	if (err < 0) {
+		ERROR("FDT: add subnode \"cpus\" node to parent node failed");
+		return err;
+	}
+
+	err = fdt_fixup_setprop_u32(s, FDT_FIXUP_OPEN_NODE,
+				    "#address-cells", 2);
+	if (err < 0) {
+		return err;
+	}
+
+	err = fdt_fixup_setprop_u32(s, FDT_FIXUP_OPEN_NODE, "#size-cells", 0);
+	if (err < 0) {
+		return err;
+	}
+
+	/* New subnodes are appended, so the CPUs are added in order. */
+	for (i = 0U; i < afflv2; i++) {
+		for (j = 0U; j < afflv1; j++) {
+			for (k = 0U; k < afflv0; k++) {
+				mpidr = (i << MPIDR_AFF2_SHIFT) |
+					(j << MPIDR_AFF1_SHIFT) |
+					(k << MPIDR_AFF0_SHIFT) |
+					(read_mpidr_el1() & MPIDR_MT_MASK);
+
+				if (plat_core_pos_by_mpidr(mpidr) < 0) {
+					continue;
+				}
+
+				/* Valid MPID found */
+				err = fdt_fixup_cpu(s, mpidr);
+				if (err < 0) {
+					ERROR("FDT: %s 0x%08x\n",
+					      "error adding CPU",
+					      (uint32_t)mpidr);
+					return err;
+				}
+			}
+		}
+	}
+
+	return fdt_fixup_end_node(s);
+}
+
+/*******************************************************************************
+ * fdt_fixup_cpu_idle_states() - add PSCI CPU idle states in a session
+ * @s:		fixup session
+ * @states:	array of idle state descriptions, ending with empty element
+ *
+ * Session variant of fdt_add_cpu_idle_states(). The /cpus node and the cpu
+ * nodes must be in the blob, not staged in the same session.
+ *
+ * Return: 0 on success, a negative error value otherwise.
+ ******************************************************************************/
+int fdt_fixup_cpu_idle_states(struct fdt_fixup_session *s,
+			      const struct psci_cpu_idle_state *state)
+{
+	int cpu_node, cpus_node, ret;
+	uint32_t count, phandle;
+
+	ret = fdt_find_max_phandle(s->dtb, &phandle);
+	phandle++;
+	if (ret < 0) {
+		return ret;
+	}
+
+	cpus_node = fdt_path_offset(s->dtb, "/cpus");
+	if (cpus_node < 0) {
+		return cpus_node;
+	}
+
+	/* Create the idle-states node and its child nodes. */
+	ret = fdt_fixup_begin_node(s, cpus_node, "idle-states");
+	if (ret < 0) {
+		return ret;
+	}
+
+	ret = fdt_fixup_setprop_string(s, FDT_FIXUP_OPEN_NODE, "entry-method",
+				       "psci");
+	if (ret < 0) {
+		return ret;
+	}
+
+	for (count = 0U; state->name != NULL; count++, phandle++, state++) {
+		ret = fdt_fixup_begin_node(s, FDT_FIXUP_OPEN_NODE, state->name);
+		if (ret < 0) {
+			return ret;
+		}
+
+		fdt_fixup_setprop_string(s, FDT_FIXUP_OPEN_NODE, "compatible",
+					 "arm,idle-state");
+		fdt_fixup_setprop_u32(s, FDT_FIXUP_OPEN_NODE,
+				      "arm,psci-suspend-param",
+				      state->power_state);
+		if (state->local_timer_stop) {
+			fdt_fixup_setprop(s, FDT_FIXUP_OPEN_NODE,
+					  "local-timer-stop", NULL, 0);
+		}
+		fdt_fixup_setprop_u32(s, FDT_FIXUP_OPEN_NODE,
+				      "entry-latency-us",
+				      state->entry_latency_us);
+		fdt_fixup_setprop_u32(s, FDT_FIXUP_OPEN_NODE,
+				      "exit-latency-us",
+				      state->exit_latency_us);
+		fdt_fixup_setprop_u32(s, FDT_FIXUP_OPEN_NODE,
+				      "min-residency-us",
+				      state->min_residency_us);
+		if (state->wakeup_latency_us) {
+			fdt_fixup_setprop_u32(s, FDT_FIXUP_OPEN_NODE,
+					      "wakeup-latency-us",
+					      state->wakeup_latency_us);
+		}
+		fdt_fixup_setprop_u32(s, FDT_FIXUP_OPEN_NODE, "phandle",
+				      phandle);
+
+		ret = fdt_fixup_end_node(s);
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	ret = fdt_fixup_end_node(s);
+	if ((ret < 0) || (count == 0U)) {
+		return ret;
+	}
+
+	/* Link each cpu node to the idle state nodes. */
+	fdt_for_each_subnode(cpu_node, s->dtb, cpus_node) {
+		const char *device_type;
+		fdt32_t *value;
+
+		/* Only process child nodes with device_type = "cpu". */
+		device_type = fdt_getprop(s->dtb, cpu_node, "device_type", NULL);
+		if (device_type == NULL || strcmp(device_type, "cpu") != 0) {
+			continue;
+		}
+
+		/* Allocate space for the list of phandles. */
+		ret = fdt_fixup_setprop_placeholder(s, cpu_node,
+						    "cpu-idle-states",
+						    count * sizeof(phandle),
+						    (void **)&value);
+		if (ret < 0) {
+			return ret;
+		}
+
+		/* Fill in the phandles of the idle state nodes. */
+		for (uint32_t i = 0U; i < count; ++i) {
+			value[i] = cpu_to_fdt32(phandle - count + i);
+		}
+	}
+
+	return 0;
+}
@@ -18,6 +18,134 @@
 #include <common/fdt_wrappers.h>
 #include <common/uuid.h>
 
+#if FDT_PROP_NAME_CACHE
+/* Number of property names whose offset in the strings block is kept */
+#define PROP_NAME_CACHE_SIZE	16U
+
+/* Longest property name kept in the cache, including its NUL terminator */
+#define PROP_NAME_MAX_LEN	32
+
+/* Offset of a name not in the strings block, or found there more than once */
+#define NAMEOFF_NONE		(-1)
+#define NAMEOFF_AMBIGUOUS	(-2)
+
+/*
+ * Offset of a property name in the strings block of a DTB. The entry is stale
+ * once the strings block has moved or changed size.
+ */
+static struct prop_name_entry {
+	const void *dtb;
+	uint32_t off_strings;
+	uint32_t size_strings;
+	int namelen;
+	int nameoff;
+	char name[PROP_NAME_MAX_LEN];
+} prop_name_cache[PROP_NAME_CACHE_SIZE];
+
+static unsigned int prop_name_next;
+
+/*
+ * Return the only offset of a property name in the strings block of the DTB,
+ * NAMEOFF_NONE if no property has this name, or NAMEOFF_AMBIGUOUS if the name
+ * cannot be told apart by its offset. The strings block is only searched the
+ * first time a name is looked up.
+ */
+static int fdtw_prop_nameoff(const void *dtb, const char *name, int namelen)
+{
+	const char *strings = (const char *)dtb + fdt_off_dt_strings(dtb);
+	uint32_t size = fdt_size_dt_strings(dtb);
+	struct prop_name_entry *entry;
+	int nameoff = NAMEOFF_NONE;
+
+	if (namelen >= PROP_NAME_MAX_LEN) {
+		return NAMEOFF_AMBIGUOUS;
+	}
+
+	for (unsigned int i = 0U; i < PROP_NAME_CACHE_SIZE; i++) {
+		entry = &prop_name_cache[i];
+		if ((entry->dtb == dtb) && (entry->namelen == namelen) &&
+		    (entry->off_strings == fdt_off_dt_strings(dtb)) &&
+		    (entry->size_strings == size) &&
+		    (memcmp(entry->name, name, (size_t)namelen) == 0)) {
+			return entry->nameoff;
+		}
+	}
+
+	/* Names may share the tail of a longer string, so try every offset */
+	for (uint32_t off = 0U; (off + (uint32_t)namelen) < size; off++) {
+		if ((strings[off + (uint32_t)namelen] == '\0') &&
+		    (memcmp(&strings[off], name, (size_t)namelen) == 0)) {
+			if (nameoff != NAMEOFF_NONE) {
+				nameoff = NAMEOFF_AMBIGUOUS;
+				break;
+			}
+			nameoff = (int)off;
+		}
+	}
+
+	entry = &prop_name_cache[prop_name_next];
+	prop_name_next = (prop_name_next + 1U) % PROP_NAME_CACHE_SIZE;
+
+	entry->dtb = dtb;
+	entry->off_strings = fdt_off_dt_strings(dtb);
+	entry->size_strings = size;
+	entry->namelen = namelen;
+	entry->nameoff = nameoff;
+	(void)memcpy(entry->name, name, (size_t)namelen);
+
+	return nameoff;
+}
+#endif /* FDT_PROP_NAME_CACHE */
+
+/*
+ * Equivalent of fdt_getprop_namelen(). With FDT_PROP_NAME_CACHE, the name is
+ * resolved to its offset in the strings block once, and the properties of the
+ * node are then matched on that offset instead of comparing their names.
+ */
+const void *fdtw_getprop_namelen(const void *dtb, int node, const char *name,
+				 int namelen, int *lenp)
+{
+#if FDT_PROP_NAME_CACHE
+	const struct fdt_property *prop;
+	int nameoff = NAMEOFF_AMBIGUOUS;
+	int offset;
+
+	/* Properties of older DTBs may need realignment, leave it to libfdt */
+	if (fdt_version(dtb) >= 0x10U) {
+		nameoff = fdtw_prop_nameoff(dtb, name, namelen);
+	}
+
+	if (nameoff != NAMEOFF_AMBIGUOUS) {
+		for (offset = fdt_first_property_offset(dtb, node);
+		     offset >= 0;
+		     offset = fdt_next_property_offset(dtb, offset)) {
+			prop = fdt_get_property_by_offset(dtb, offset, lenp);
+			if (prop == NULL) {
+				return NULL;
+			}
+
+			if ((int)fdt32_to_cpu(prop->nameoff) == nameoff) {
+				return prop->data;
+			}
+		}
+
+		if (lenp != NULL) {
+			*lenp = offset;
+		}
+
+		return NULL;
+	}
+#endif /* FDT_PROP_NAME_CACHE */
+
+	return fdt_getprop_namelen(dtb, node, name, namelen, lenp);
+}
+
+const void *fdtw_getprop(const void *dtb, int node, const char *name,
+			 int *lenp)
+{
+	return fdtw_getprop_namelen(dtb, node, name, (int)strlen(name), lenp);
+}
+
 /*
  * Read cells from a given property of the given node. Any number of 32-bit
  * cells of the property can be read. Returns 0 on success, or a negative
@@ -35,7 +163,7 @@ int fdt_read_uint32_array(const void *dtb, int node, const char *prop_name,
 	assert(node >= 0);
 
 	/* Access property and obtain its length (in bytes) */
-	prop = fdt_getprop(dtb, node, prop_name, &value_len);
+	prop = fdtw_getprop(dtb, node, prop_name, &value_len);
 	if (prop == NULL) {
 		VERBOSE("Couldn't find property %s in dtb\n", prop_name);
 		return -FDT_ERR_NOTFOUND;
@@ -118,8 +246,8 @@ int fdtw_read_bytes(const void *dtb, int node, const char *prop,
 	assert(node >= 0);
 
 	/* Access property and obtain its length (in bytes) */
-	ptr = fdt_getprop_namelen(dtb, node, prop, (int)strlen(prop),
-					&value_len);
+	ptr = fdtw_getprop_namelen(dtb, node, prop, (int)strlen(prop),
+				   &value_len);
 	if (ptr == NULL) {
 		WARN("Couldn't find property %s in dtb\n", prop);
 		return -1;
@@ -153,7 +281,7 @@ int fdtw_read_string(const void *dtb, int node, const char *prop,
 	assert(str != NULL);
 	assert(size > 0U);
 
-	ptr = fdt_getprop_namelen(dtb, node, prop, (int)strlen(prop), NULL);
+	ptr = fdtw_getprop_namelen(dtb, node, prop, (int)strlen(prop), NULL);
 	if (ptr == NULL) {
 		WARN("Couldn't find property %s in dtb\n", prop);
 		return -1;
@@ -254,7 +382,7 @@ int fdtw_write_inplace_bytes(void *dtb, int node, const char *prop,
 	namelen = (int)strlen(prop);
 
 	/* Access property and obtain its length in bytes */
-	ptr = fdt_getprop_namelen(dtb, node, prop, namelen, &value_len);
+	ptr = fdtw_getprop_namelen(dtb, node, prop, namelen, &value_len);
 	if (ptr == NULL) {
 		WARN("Couldn't find property %s in dtb\n", prop);
 		return -1;
@@ -306,7 +434,7 @@ int fdt_get_reg_props_by_index(const void *dtb, int node, int index,
 
 	cell = index * (ac + sc);
 
-	prop = fdt_getprop(dtb, node, "reg", &len);
+	prop = fdtw_getprop(dtb, node, "reg", &len);
 	if (prop == NULL) {
 		WARN("Couldn't find \"reg\" property in dtb\n");
 		return -FDT_ERR_NOTFOUND;
@@ -365,7 +493,7 @@ int fdt_get_stdout_node_offset(const void *dtb)
 		}
 	}
 
-	prop = fdt_getprop(dtb, node, "stdout-path", NULL);
+	prop = fdtw_getprop(dtb, node, "stdout-path", NULL);
 	if (prop == NULL) {
 		return -FDT_ERR_NOTFOUND;
 	}
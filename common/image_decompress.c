@@ -1,58 +1,141 @@
 /*
- * Copyright (c) 2018, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2018-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
 #include <assert.h>
+#include <errno.h>
 #include <stdint.h>
 
 #include <arch_helpers.h>
 #include <common/bl_common.h>
 #include <common/debug.h>
 #include <common/image_decompress.h>
+#include <lib/boot_timeline.h>
 
-static uintptr_t decompressor_buf_base;
-static uint32_t decompressor_buf_size;
+/*
+ * Number of temporary buffers, i.e. of compressed images that can be loaded
+ * before the previous one has been decompressed. More than one is needed when
+ * the read of an image overlaps with the decompression of the previous one.
+ */
+#ifndef IMAGE_DECOMPRESS_MAX_BUFS
+#define IMAGE_DECOMPRESS_MAX_BUFS	2U
+#endif
+
+typedef struct decompressor_buf {
+	uintptr_t base;
+	uint32_t size;
+	/* Image being loaded into the buffer, NULL if the buffer is free */
+	struct image_info *info;
+	/* Original image_info of that image */
+	struct image_info saved_info;
+} decompressor_buf_t;
+
+static decompressor_buf_t decompressor_bufs[IMAGE_DECOMPRESS_MAX_BUFS];
+static unsigned int decompressor_buf_count;
 static decompressor_t *decompressor;
-static struct image_info saved_image_info;
 
 void image_decompress_init(uintptr_t buf_base, uint32_t buf_size,
 			   decompressor_t *_decompressor)
 {
-	decompressor_buf_base = buf_base;
-	decompressor_buf_size = buf_size;
+	decompressor_bufs[0].base = buf_base;
+	decompressor_bufs[0].size = buf_size;
+	decompressor_bufs[0].info = NULL;
+	decompressor_buf_count = 1U;
 	decompressor = _decompressor;
 }
 
+int image_decompress_add_buffer(uintptr_t buf_base, uint32_t buf_size)
+{
+	decompressor_buf_t *buf;
+
+	assert(decompressor_buf_count != 0U);
+
+	if (decompressor_buf_count == IMAGE_DECOMPRESS_MAX_BUFS) {
+		return -ENOMEM;
+	}
+
+	buf = &decompressor_bufs[decompressor_buf_count];
+	buf->base = buf_base;
+	buf->size = buf_size;
+	buf->info = NULL;
+	decompressor_buf_count++;
+
+	return 0;
+}
+
+static decompressor_buf_t *find_decompressor_buf(const struct image_info *info)
+{
+	unsigned int i;
+
+	for (i = 0U; i < decompressor_buf_count; i++) {
+		if (decompressor_bufs[i].info == info) {
+			return &decompressor_bufs[i];
+		}
+	}
+
+	return NULL;
+}
+
 void image_decompress_prepare(struct image_info *info)
 {
+	decompressor_buf_t *buf;
+
+	assert(info != NULL);
+
+	/* Reuse the buffer if the image is prepared again, e.g. on a retry */
+	buf = find_decompressor_buf(info);
+	if (buf != NULL) {
+		*info = buf->saved_info;
+	} else {
+		buf = find_decompressor_buf(NULL);
+	}
+
+	if (buf == NULL) {
+		ERROR("No free buffer to load compressed image\n");
+		panic();
+	}
+
 	/*
 	 * If the image is compressed, it should be loaded into the temporary
 	 * buffer instead of its final destination.  We save image_info, then
 	 * override ->image_base and ->image_max_size so that load_image() will
 	 * transfer the compressed data to the temporary buffer.
 	 */
-	saved_image_info = *info;
-	info->image_base = decompressor_buf_base;
-	info->image_max_size = decompressor_buf_size;
+	buf->info = info;
+	buf->saved_info = *info;
+	info->image_base = buf->base;
+	info->image_max_size = buf->size;
 }
 
 int image_decompress(struct image_info *info)
 {
 	uintptr_t compressed_image_base, image_base, work_base;
 	uint32_t compressed_image_size, work_size;
+	decompressor_buf_t *buf;
 	int ret;
 
+	assert(info != NULL);
+
+	buf = find_decompressor_buf(info);
+	if (buf == NULL) {
+		ERROR("Image was not prepared for decompression\n");
+		return -EINVAL;
+	}
+
 	/*
 	 * The size of compressed data has been filled by load_image().
 	 * Read it out before restoring image_info.
 	 */
 	compressed_image_size = info->image_size;
 	compressed_image_base = info->image_base;
-	*info = saved_image_info;
+	*info = buf->saved_info;
+
+	/* The buffer is free again for the next compressed image */
+	buf->info = NULL;
 
-	assert(compressed_image_size <= decompressor_buf_size);
+	assert(compressed_image_size <= buf->size);
 
 	image_base = info->image_base;
 
@@ -61,11 +144,16 @@ int image_decompress(struct image_info *info)
 	 * decompressor since the decompressor may need additional memory.
 	 */
 	work_base = compressed_image_base + compressed_image_size;
-	work_size = decompressor_buf_size - compressed_image_size;
+	work_size = buf->size - compressed_image_size;
 
+	/* There is no image ID here, the images are told apart by address */
+	BOOT_TIMELINE_START(BOOT_TL_EV_IMAGE_DECOMPRESS,
+			    (uint32_t)info->image_base);
 	ret = decompressor(&compressed_image_base, compressed_image_size,
 			   &image_base, info->image_max_size,
 			   work_base, work_size);
+	BOOT_TIMELINE_END(BOOT_TL_EV_IMAGE_DECOMPRESS,
+			  (uint32_t)info->image_base);
 	if (ret) {
 		ERROR("Failed to decompress image (err=%d)\n", ret);
 		return ret;
@@ -73,6 +161,7 @@ int image_decompress(struct image_info *info)
 
 	/* image_base is updated to the final pos when decompressor() exits. */
 	info->image_size = image_base - info->image_base;
+	BOOT_TIMELINE_MARK(BOOT_TL_EV_IMAGE_SIZE, info->image_size);
 
 	flush_dcache_range(info->image_base, info->image_size);
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013-2019, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2013-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -8,8 +8,13 @@
 #include <errno.h>
 #include <string.h>
 
+#include <arch_helpers.h>
 #include <common/debug.h>
 #include <common/runtime_svc.h>
+#include <lib/boot_timeline.h>
+#include <plat/common/platform.h>
+
+#include <platform_def.h>
 
 /*******************************************************************************
  * The 'rt_svc_descs' array holds the runtime service descriptors exported by
@@ -25,6 +30,149 @@ uint8_t rt_svc_descs_indices[MAX_RT_SVCS];
 #define RT_SVC_DECS_NUM		((RT_SVC_DESCS_END - RT_SVC_DESCS_START)\
 					/ sizeof(rt_svc_desc_t))
 
+#if SMC_CALL_COUNTERS
+/*******************************************************************************
+ * Per cpu count of the SMCs dispatched, by function ID. Each cpu only ever
+ * updates its own table so no locking is needed. The function IDs are kept
+ * in a small open addressing table, calls that do not find room in it are
+ * only accounted in 'untracked'.
+ ******************************************************************************/
+#ifndef PLAT_SMC_CALL_COUNTERS
+#define PLAT_SMC_CALL_COUNTERS		U(32)
+#endif
+
+struct smc_call_counters {
+	uint32_t fid[PLAT_SMC_CALL_COUNTERS];
+	uint64_t count[PLAT_SMC_CALL_COUNTERS];
+	uint64_t untracked;
+};
+
+static struct smc_call_counters smc_call_counters[PLATFORM_CORE_COUNT];
+
+static unsigned int smc_call_slot(uint32_t smc_fid)
+{
+	/* Mix the owning entity into the function number */
+	return ((smc_fid & FUNCID_NUM_MASK) ^
+		(GET_SMC_OEN(smc_fid) * 7U) ^
+		(GET_SMC_CC(smc_fid) * 13U)) % PLAT_SMC_CALL_COUNTERS;
+}
+
+void smc_call_count_inc(uint32_t smc_fid)
+{
+	struct smc_call_counters *cnt = &smc_call_counters[plat_my_core_pos()];
+	unsigned int slot = smc_call_slot(smc_fid);
+	unsigned int i;
+
+	for (i = 0U; i < PLAT_SMC_CALL_COUNTERS; i++) {
+		if (cnt->count[slot] == 0U) {
+			cnt->fid[slot] = smc_fid;
+		}
+		if (cnt->fid[slot] == smc_fid) {
+			cnt->count[slot]++;
+			return;
+		}
+		slot = (slot + 1U) % PLAT_SMC_CALL_COUNTERS;
+	}
+
+	cnt->untracked++;
+}
+
+/* Sum of the calls to 'smc_fid' over all cpus */
+uint64_t smc_call_count_get(uint32_t smc_fid)
+{
+	uint64_t total = 0U;
+	unsigned int cpu, slot, i;
+
+	for (cpu = 0U; cpu < PLATFORM_CORE_COUNT; cpu++) {
+		slot = smc_call_slot(smc_fid);
+		for (i = 0U; i < PLAT_SMC_CALL_COUNTERS; i++) {
+			if (smc_call_counters[cpu].count[slot] == 0U) {
+				break;
+			}
+			if (smc_call_counters[cpu].fid[slot] == smc_fid) {
+				total += smc_call_counters[cpu].count[slot];
+				break;
+			}
+			slot = (slot + 1U) % PLAT_SMC_CALL_COUNTERS;
+		}
+	}
+
+	return total;
+}
+
+/* Sum of the calls over all cpus that could not be tracked by function ID */
+uint64_t smc_call_count_untracked(void)
+{
+	uint64_t total = 0U;
+	unsigned int cpu;
+
+	for (cpu = 0U; cpu < PLATFORM_CORE_COUNT; cpu++) {
+		total += smc_call_counters[cpu].untracked;
+	}
+
+	return total;
+}
+#endif /* SMC_CALL_COUNTERS */
+
+#if SMC_LATENCY_HIST
+/*******************************************************************************
+ * Per cpu histograms of the time spent in the SMC handlers, by runtime
+ * service descriptor. Latencies are measured in generic timer ticks and
+ * bucket 'n' counts the calls which took [2^n, 2^(n+1)) ticks, the last
+ * bucket also holding all the longer ones. Services with a descriptor index
+ * beyond PLAT_SMC_LATENCY_SVCS are not recorded.
+ ******************************************************************************/
+#ifndef PLAT_SMC_LATENCY_SVCS
+#define PLAT_SMC_LATENCY_SVCS		U(16)
+#endif
+
+static uint32_t smc_latency_hist[PLATFORM_CORE_COUNT][PLAT_SMC_LATENCY_SVCS]
+				[SMC_LATENCY_BUCKETS];
+
+void smc_latency_record(unsigned int svc_index, uint64_t start)
+{
+	uint64_t delta = read_cntpct_el0() - start;
+	unsigned int bucket = 0U;
+	uint32_t *count;
+
+	if (svc_index >= PLAT_SMC_LATENCY_SVCS) {
+		return;
+	}
+
+	if (delta != 0U) {
+		bucket = 63U - (unsigned int)__builtin_clzll(delta);
+		if (bucket >= SMC_LATENCY_BUCKETS) {
+			bucket = SMC_LATENCY_BUCKETS - 1U;
+		}
+	}
+
+	count = &smc_latency_hist[plat_my_core_pos()][svc_index][bucket];
+	if (*count != UINT32_MAX) {
+		(*count)++;
+	}
+}
+
+int smc_latency_hist_get(uint32_t smc_fid, unsigned int core_pos,
+			 unsigned int bucket, uint32_t *count)
+{
+	unsigned int index;
+
+	if ((core_pos >= PLATFORM_CORE_COUNT) ||
+	    (bucket >= SMC_LATENCY_BUCKETS)) {
+		return -EINVAL;
+	}
+
+	index = rt_svc_descs_indices[get_unique_oen_from_smc_fid(smc_fid)];
+	if ((index >= RT_SVC_DECS_NUM) || (index >= PLAT_SMC_LATENCY_SVCS)) {
+		return -ENOENT;
+	}
+
+	*count = smc_latency_hist[core_pos][index][bucket];
+
+	return 0;
+}
+#endif /* SMC_LATENCY_HIST */
+
 /*******************************************************************************
  * Function to invoke the registered `handle` corresponding to the smc_fid in
  * AArch32 mode.
@@ -40,6 +188,9 @@ uintptr_t handle_runtime_svc(uint32_t smc_fid,
 	const rt_svc_desc_t *rt_svc_descs;
 
 	assert(handle != NULL);
+#if SMC_CALL_COUNTERS
+	smc_call_count_inc(smc_fid);
+#endif
 	idx = get_unique_oen_from_smc_fid(smc_fid);
 	assert(idx < MAX_RT_SVCS);
 
@@ -51,8 +202,18 @@ uintptr_t handle_runtime_svc(uint32_t smc_fid,
 
 	get_smc_params_from_ctx(handle, x1, x2, x3, x4);
 
+#if SMC_LATENCY_HIST
+	uint64_t start = read_cntpct_el0();
+	uintptr_t ret = rt_svc_descs[index].handle(smc_fid, x1, x2, x3, x4,
+						   cookie, handle, flags);
+
+	smc_latency_record(index, start);
+
+	return ret;
+#else
 	return rt_svc_descs[index].handle(smc_fid, x1, x2, x3, x4, cookie,
 						handle, flags);
+#endif
 }
 
 /*******************************************************************************
@@ -128,7 +289,12 @@ void __init runtime_svc_init(void)
 		 * routine for this runtime service, if it is defined.
 		 */
 		if (service->init != NULL) {
+			uint32_t svc_id = ((uint32_t)service->call_type << 8) |
+					  service->start_oen;
+
+			BOOT_TIMELINE_START(BOOT_TL_EV_SVC_INIT, svc_id);
 			rc = service->init();
+			BOOT_TIMELINE_END(BOOT_TL_EV_SVC_INIT, svc_id);
 			if (rc != 0) {
 				ERROR("Error initializing runtime service %s\n",
 						service->name);
@@ -12,6 +12,10 @@
 #include <common/tf_crc32.h>
 
 /* compute CRC using Arm intrinsic function
+ *
+ * Once the buffer is 8-byte aligned, it is processed 8 bytes per
+ * instruction. The CRC32 instructions consume the bytes of a word in
+ * little-endian order, so the result is the same as byte by byte.
  *
  * This function is useful for the platforms with the CPU ARMv8.0
  * (with CRC instructions supported), and onwards.
@@ -33,13 +37,39 @@ uint32_t tf_crc32(uint32_t crc, const unsigned char *buf, size_t size)
 	size_t local_size = size;
 
 	/*
-	 * calculate CRC over byte data
+	 * calculate CRC over byte data until the buffer is 8-byte aligned
 	 */
-	while (local_size != 0UL) {
+	while ((local_size != 0UL) && (((uintptr_t)local_buf & 7UL) != 0UL)) {
 		calc_crc = __crc32b(calc_crc, *local_buf);
 		local_buf++;
 		local_size--;
 	}
 
+	/*
+	 * calculate CRC over 8-byte words
+	 */
+	while (local_size >= 8UL) {
+		calc_crc = __crc32d(calc_crc, *(const uint64_t *)local_buf);
+		local_buf += 8;
+		local_size -= 8UL;
+	}
+
+	/*
+	 * calculate CRC over the remaining 4, 2 and 1 bytes
+	 */
+	if ((local_size & 4UL) != 0UL) {
+		calc_crc = __crc32w(calc_crc, *(const uint32_t *)local_buf);
+		local_buf += 4;
+	}
+
+	if ((local_size & 2UL) != 0UL) {
+		calc_crc = __crc32h(calc_crc, *(const uint16_t *)local_buf);
+		local_buf += 2;
+	}
+
+	if ((local_size & 1UL) != 0UL) {
+		calc_crc = __crc32b(calc_crc, *local_buf);
+	}
+
 	return ~calc_crc;
 }
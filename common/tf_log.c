@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2019, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -7,13 +7,134 @@
 #include <stdarg.h>
 #include <assert.h>
 #include <stdio.h>
+#include <string.h>
 
 #include <common/debug.h>
 #include <plat/common/platform.h>
+#if LOG_BINARY
+#include <arch_helpers.h>
+#include <lib/cassert.h>
+#include <platform_def.h>
+#endif
 
 /* Set the default maximum log level to the `LOG_LEVEL` build flag */
 static unsigned int max_log_level = LOG_LEVEL;
 
+/*
+ * With LOG_BINARY, BL31 does not format the messages above LOG_LEVEL_ERROR but
+ * records them in a buffer of the CPU logging them, for
+ * tools/log_decode/tf_log_decode.py to format on the host from a dump of
+ * tf_log_bin_bufs and the ELF file of BL31.
+ */
+#if LOG_BINARY && defined(IMAGE_BL31)
+/*
+ * Size in bytes of the buffer of each CPU, to be passed to the decoder if it
+ * is changed
+ */
+#ifndef LOG_BINARY_BUF_SIZE
+#define LOG_BINARY_BUF_SIZE	U(4096)
+#endif
+
+/* Arguments recorded per message, the others are dropped */
+#define LOG_BINARY_MAX_ARGS	U(8)
+
+#define LOG_BIN_MAGIC		ULL(0x7f1b)
+#define LOG_BIN_WORDS		((LOG_BINARY_BUF_SIZE / sizeof(uint64_t)) - 1U)
+
+/*
+ * Each message is recorded as 64-bit words, wrapping around the buffer:
+ * - bits [63:48] LOG_BIN_MAGIC, [47:40] number of arguments, [31:0] head
+ * - address of the format string, log marker included
+ * - CNTPCT_EL0
+ * - one word per argument, sign-extended for %d and %i. The contents of %s
+ *   strings are not recorded, only their address.
+ */
+struct tf_log_bin_buf {
+	uint64_t head;		/* Words written so far */
+	uint64_t words[LOG_BIN_WORDS];
+} __aligned(CACHE_WRITEBACK_GRANULE);
+
+CASSERT(sizeof(struct tf_log_bin_buf) == LOG_BINARY_BUF_SIZE,
+	assert_log_binary_buf_size);
+
+struct tf_log_bin_buf tf_log_bin_bufs[PLATFORM_CORE_COUNT];
+
+/*
+ * Read the arguments of a message as vprintf() would, without formatting
+ * them. Return the number of arguments read.
+ */
+static unsigned int tf_log_bin_args(const char *fmt, va_list args,
+				    uint64_t *words)
+{
+	unsigned int n = 0U;
+	unsigned int l_count;
+
+	for (; *fmt != '\0'; fmt++) {
+		if (*fmt != '%')
+			continue;
+
+		l_count = 0U;
+		for (fmt++; ; fmt++) {
+			if (*fmt == 'l') {
+				l_count++;
+			} else if (*fmt == 'z') {
+				l_count = 2U;
+			} else if ((*fmt < '0') || (*fmt > '9')) {
+				break;
+			}
+		}
+
+		if ((*fmt == '%') || (n == LOG_BINARY_MAX_ARGS))
+			continue;
+
+		switch (*fmt) {
+		case 'd':
+		case 'i':
+			words[n++] = (uint64_t)((l_count > 1U) ?
+				va_arg(args, long long) : (l_count == 1U) ?
+				va_arg(args, long) : va_arg(args, int));
+			break;
+		case 'u':
+		case 'x':
+		case 'X':
+			words[n++] = (l_count > 1U) ?
+				va_arg(args, unsigned long long) : (l_count == 1U) ?
+				va_arg(args, unsigned long) : va_arg(args, unsigned int);
+			break;
+		case 'c':
+			words[n++] = (uint64_t)va_arg(args, int);
+			break;
+		case 's':
+		case 'p':
+			words[n++] = (uintptr_t)va_arg(args, void *);
+			break;
+		default:
+			/* vprintf() stops at unsupported specifiers too */
+			return n;
+		}
+	}
+
+	return n;
+}
+
+static void tf_log_bin_record(const char *fmt, va_list args)
+{
+	struct tf_log_bin_buf *buf = &tf_log_bin_bufs[plat_my_core_pos()];
+	uint64_t words[3U + LOG_BINARY_MAX_ARGS];
+	unsigned int i, nargs;
+
+	nargs = tf_log_bin_args(fmt + 1, args, &words[3]);
+	words[0] = (LOG_BIN_MAGIC << 48) | ((uint64_t)nargs << 40) |
+		   (buf->head & 0xffffffffU);
+	words[1] = (uintptr_t)fmt;
+	words[2] = read_cntpct_el0();
+
+	for (i = 0U; i < (3U + nargs); i++)
+		buf->words[(buf->head + i) % LOG_BIN_WORDS] = words[i];
+	buf->head += 3U + nargs;
+}
+#endif /* LOG_BINARY && IMAGE_BL31 */
+
 /*
  * The common log function which is invoked by TF-A code.
  * This function should not be directly invoked and is meant to be
@@ -37,12 +158,18 @@ void tf_log(const char *fmt, ...)
 	if (log_level > max_log_level)
 		return;
 
-	prefix_str = plat_log_get_prefix(log_level);
-
-	while (*prefix_str != '\0') {
-		(void)putchar(*prefix_str);
-		prefix_str++;
+#if LOG_BINARY && defined(IMAGE_BL31)
+	/* Errors are still output at once */
+	if (log_level > LOG_LEVEL_ERROR) {
+		va_start(args, fmt);
+		tf_log_bin_record(fmt, args);
+		va_end(args);
+		return;
 	}
+#endif
+
+	prefix_str = plat_log_get_prefix(log_level);
+	(void)putchars(prefix_str, strlen(prefix_str));
 
 	va_start(args, fmt);
 	(void)vprintf(fmt + 1, args);
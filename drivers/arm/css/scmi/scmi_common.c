@@ -25,22 +25,29 @@
 
 
 /*
- * Private helper function to get exclusive access to SCMI channel.
+ * Helper function to wait for the SCP to give the channel back to the AP.
  */
-void scmi_get_channel(scmi_channel_t *ch)
+static void scmi_wait_channel_free(scmi_channel_t *ch)
 {
-	assert(ch->lock);
-	scmi_lock_get(ch->lock);
+	mailbox_mem_t *mbx_mem = (mailbox_mem_t *)(ch->info->scmi_mbx_mem);
 
-	/* Make sure any previous command has finished */
-	assert(SCMI_IS_CHANNEL_FREE(
-			((mailbox_mem_t *)(ch->info->scmi_mbx_mem))->status));
+	while (!SCMI_IS_CHANNEL_FREE(mbx_mem->status)) {
+		if (ch->info->delay != 0)
+			udelay(ch->info->delay);
+	}
+
+	/*
+	 * Ensure that any access to the SCMI payload area is done after reading
+	 * mailbox status. If these were reordered then the CPU would read
+	 * invalid payload data or overwrite a message the SCP is still reading
+	 */
+	dmbld();
 }
 
 /*
- * Private helper function to transfer ownership of channel from AP to SCP.
+ * Helper function to hand the channel over to the SCP and ring its doorbell.
  */
-void scmi_send_sync_command(scmi_channel_t *ch)
+static void scmi_ring_doorbell(scmi_channel_t *ch)
 {
 	mailbox_mem_t *mbx_mem = (mailbox_mem_t *)(ch->info->scmi_mbx_mem);
 
@@ -54,24 +61,51 @@ void scmi_send_sync_command(scmi_channel_t *ch)
 	dmbst();
 
 	ch->info->ring_doorbell(ch->info);
+}
+
+/*
+ * Private helper function to get exclusive access to SCMI channel.
+ */
+void scmi_get_channel(scmi_channel_t *ch)
+{
+	assert(ch->lock);
+	scmi_lock_get(ch->lock);
+
+	/*
+	 * Make sure any previous command has finished. A command sent with
+	 * scmi_send_async_command() may still be in the hands of the SCP.
+	 */
+	scmi_wait_channel_free(ch);
+}
+
+/*
+ * Private helper function to transfer ownership of channel from AP to SCP.
+ */
+void scmi_send_sync_command(scmi_channel_t *ch)
+{
+	scmi_ring_doorbell(ch);
+
 	/*
 	 * Ensure that the write to the doorbell register is ordered prior to
 	 * checking whether the channel is free.
 	 */
 	dmbsy();
 
-	/* Wait for channel to be free */
-	while (!SCMI_IS_CHANNEL_FREE(mbx_mem->status)) {
-		if (ch->info->delay != 0)
-			udelay(ch->info->delay);
-	}
+	scmi_wait_channel_free(ch);
+}
 
-	/*
-	 * Ensure that any read to the SCMI payload area is done after reading
-	 * mailbox status. If these 2 reads were reordered then the CPU would
-	 * read invalid payload data
-	 */
-	dmbld();
+/*
+ * Private helper function to transfer ownership of channel from AP to SCP
+ * and release exclusive access to it without waiting for the response. The
+ * response is lost: the next scmi_get_channel() on the channel waits for the
+ * SCP to be done with the command before reusing the mailbox.
+ */
+void scmi_send_async_command(scmi_channel_t *ch)
+{
+	scmi_ring_doorbell(ch);
+
+	assert(ch->lock);
+	scmi_lock_release(ch->lock);
 }
 
 /*
@@ -53,6 +53,33 @@ int scmi_pwr_state_set(void *p, uint32_t domain_id,
 	return ret;
 }
 
+/*
+ * API to request a SCMI power domain power state without waiting for the SCP
+ * to respond. It is meant for a CPU that goes to WFI right after, the response
+ * is not available to the caller.
+ */
+void scmi_pwr_state_set_async(void *p, uint32_t domain_id,
+					uint32_t scmi_pwr_state)
+{
+	mailbox_mem_t *mbx_mem;
+	unsigned int token = 0;
+	scmi_channel_t *ch = (scmi_channel_t *)p;
+
+	validate_scmi_channel(ch);
+
+	scmi_get_channel(ch);
+
+	mbx_mem = (mailbox_mem_t *)(ch->info->scmi_mbx_mem);
+	mbx_mem->msg_header = SCMI_MSG_CREATE(SCMI_PWR_DMN_PROTO_ID,
+			SCMI_PWR_STATE_SET_MSG, token);
+	mbx_mem->len = SCMI_PWR_STATE_SET_MSG_LEN;
+	mbx_mem->flags = SCMI_FLAG_RESP_POLL;
+	SCMI_PAYLOAD_ARG3(mbx_mem->payload, SCMI_PWR_STATE_SET_FLAG_ASYNC,
+						domain_id, scmi_pwr_state);
+
+	scmi_send_async_command(ch);
+}
+
 /*
  * API to get the SCMI power domain power state.
  */
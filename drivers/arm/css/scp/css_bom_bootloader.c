@@ -5,6 +5,7 @@
  */
 
 #include <assert.h>
+#include <stdbool.h>
 #include <stdint.h>
 
 #include <arch_helpers.h>
@@ -101,6 +102,27 @@ static void scp_boot_message_end(void)
 	mhu_secure_message_end(BOM_MHU_SLOT_ID);
 }
 
+#if CSS_SCP_BOOT_ASYNC
+/* Whether the response to BOOT_CMD_DATA is still to be received */
+static bool scp_boot_data_pending;
+#endif
+
+/* Receive the response of SCP once it has copied and checked the image */
+static int scp_boot_data_wait(void)
+{
+	uint32_t response;
+
+	response = scp_boot_message_wait(sizeof(response));
+	scp_boot_message_end();
+
+	if (response != 0) {
+		ERROR("SCP BOOT_CMD_DATA returned error %u\n", response);
+		return -1;
+	}
+
+	return 0;
+}
+
 int css_scp_boot_image_xfer(void *image, unsigned int image_size)
 {
 	uint32_t response;
@@ -175,19 +197,31 @@ int css_scp_boot_image_xfer(void *image, unsigned int image_size)
 	cmd_data_payload->block_size = image_size;
 
 	scp_boot_message_send(sizeof(*cmd_data_payload));
-	response = scp_boot_message_wait(sizeof(response));
-	scp_boot_message_end();
 
-	if (response != 0) {
-		ERROR("SCP BOOT_CMD_DATA returned error %u\n", response);
-		return -1;
-	}
+#if CSS_SCP_BOOT_ASYNC
+	/*
+	 * SCP reads the image from Trusted RAM on its own, its response is
+	 * collected by css_scp_boot_ready() so that BL2 can go on meanwhile.
+	 */
+	scp_boot_data_pending = true;
 
 	return 0;
+#else
+	return scp_boot_data_wait();
+#endif
 }
 
 int css_scp_boot_ready(void)
 {
+#if CSS_SCP_BOOT_ASYNC
+	if (scp_boot_data_pending) {
+		scp_boot_data_pending = false;
+		if (scp_boot_data_wait() != 0) {
+			return -1;
+		}
+	}
+#endif
+
 	VERBOSE("Waiting for SCP to signal it is ready to go on\n");
 
 	/* Wait for SCP to signal it's ready */
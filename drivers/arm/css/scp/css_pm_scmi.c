@@ -9,6 +9,7 @@
 
 #include <arch_helpers.h>
 #include <common/debug.h>
+#include <common/fast_reboot.h>
 #include <drivers/arm/css/css_scp.h>
 #include <drivers/arm/css/scmi.h>
 #include <lib/mmio.h>
@@ -80,8 +81,9 @@ static scmi_channel_t scmi_channels[PLAT_ARM_SCMI_CHANNEL_COUNT];
 static uint32_t default_scmi_channel_id;
 
 /*
- * TODO: Allow use of channel specific lock instead of using a single lock for
- * all the channels.
+ * Each channel has its own lock. A platform that gives every core its own
+ * channel in plat_css_core_pos_to_scmi_dmn_id_map[] lets the cores request
+ * power state changes in parallel.
  */
 ARM_SCMI_INSTANTIATE_LOCK;
 
@@ -158,6 +160,10 @@ void css_scp_suspend(const struct psci_power_state *target_state)
 
 	css_scp_core_pos_to_scmi_channel(plat_my_core_pos(),
 			&domain_id, &channel_id);
+#if CSS_SCMI_ASYNC_PWR_STATE_SET
+	scmi_pwr_state_set_async(scmi_handles[channel_id],
+		domain_id, scmi_pwr_state);
+#else
 	ret = scmi_pwr_state_set(scmi_handles[channel_id],
 		domain_id, scmi_pwr_state);
 
@@ -167,6 +173,7 @@ void css_scp_suspend(const struct psci_power_state *target_state)
 		panic();
 	}
 #endif
+#endif
 }
 
 /*
@@ -176,7 +183,6 @@ void css_scp_suspend(const struct psci_power_state *target_state)
 void css_scp_off(const struct psci_power_state *target_state)
 {
 	unsigned int lvl = 0, channel_id, domain_id;
-	int ret;
 	uint32_t scmi_pwr_state = 0;
 
 	/* At-least the CPU level should be specified to be OFF */
@@ -200,13 +206,18 @@ void css_scp_off(const struct psci_power_state *target_state)
 
 	css_scp_core_pos_to_scmi_channel(plat_my_core_pos(),
 			&domain_id, &channel_id);
-	ret = scmi_pwr_state_set(scmi_handles[channel_id],
+#if CSS_SCMI_ASYNC_PWR_STATE_SET
+	scmi_pwr_state_set_async(scmi_handles[channel_id],
+		domain_id, scmi_pwr_state);
+#else
+	int ret = scmi_pwr_state_set(scmi_handles[channel_id],
 		domain_id, scmi_pwr_state);
 	if (ret != SCMI_E_QUEUED && ret != SCMI_E_SUCCESS) {
 		ERROR("SCMI set power state command return 0x%x unexpected\n",
 				ret);
 		panic();
 	}
+#endif
 }
 
 /*
@@ -298,6 +309,14 @@ static void css_raise_pwr_down_interrupt(u_register_t mpidr)
 #endif
 }
 
+/* Same as above, raising the SGI on all the other cores at once */
+static void css_raise_pwr_down_interrupt_others(void)
+{
+#if CSS_SYSTEM_GRACEFUL_RESET
+	plat_ic_raise_el3_sgi_others(CSS_CPU_PWR_DOWN_REQ_INTR);
+#endif
+}
+
 void __dead2 css_scp_system_off(int state)
 {
 	int ret;
@@ -312,7 +331,8 @@ void __dead2 css_scp_system_off(int state)
 	/*
 	 * Send powerdown request to online secondary core(s)
 	 */
-	ret = psci_stop_other_cores(0, css_raise_pwr_down_interrupt);
+	ret = psci_stop_other_cores_bcast(0, css_raise_pwr_down_interrupt_others,
+					  css_raise_pwr_down_interrupt);
 	if (ret != PSCI_E_SUCCESS) {
 		ERROR("Failed to powerdown secondary core(s)\n");
 	}
@@ -391,7 +411,7 @@ void __init plat_arm_pwrc_setup(void)
 		INFO("Initializing SCMI driver on channel %d\n", idx);
 
 		scmi_channels[idx].info = plat_css_get_scmi_info(idx);
-		scmi_channels[idx].lock = ARM_SCMI_LOCK_GET_INSTANCE;
+		scmi_channels[idx].lock = ARM_SCMI_LOCK_GET_INSTANCE(idx);
 		scmi_handles[idx] = scmi_init(&scmi_channels[idx]);
 
 		if (scmi_handles[idx] == NULL) {
@@ -468,8 +488,19 @@ const plat_psci_ops_t *css_scmi_override_pm_ops(plat_psci_ops_t *ops)
 
 int css_system_reset2(int is_vendor, int reset_type, u_register_t cookie)
 {
-	if (is_vendor || (reset_type != PSCI_RESET2_SYSTEM_WARM_RESET))
+	if (is_vendor) {
+#if FAST_REBOOT
+		/* Keep the verified images for BL2 across the warm reset */
+		if ((unsigned int)reset_type != CSS_RESET2_FAST_REBOOT)
+			return PSCI_E_INVALID_PARAMS;
+		if (fast_reboot_arm() != 0)
+			return PSCI_E_NOT_SUPPORTED;
+#else
 		return PSCI_E_INVALID_PARAMS;
+#endif
+	} else if (reset_type != PSCI_RESET2_SYSTEM_WARM_RESET) {
+		return PSCI_E_INVALID_PARAMS;
+	}
 
 	css_scp_system_off(SCMI_SYS_PWR_WARM_RESET);
 	/*
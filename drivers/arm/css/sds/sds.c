@@ -21,6 +21,9 @@ static sds_region_desc_t *sds_regions;
 /* Total count of SDS memory regions */
 static unsigned int sds_region_cnt;
 
+/* Structure offsets of the SDS memory regions, to avoid scanning them */
+static sds_index_t sds_index[SDS_INDEX_MAX_REGIONS];
+
 /*
  * Perform some non-exhaustive tests to determine whether any of the fields
  * within a Structure Header contain obviously invalid data.
@@ -80,6 +83,34 @@ static int validate_sds_struct_headers(unsigned int region_id)
 	return SDS_OK;
 }
 
+/*
+ * Record the offsets of the first SDS_INDEX_MAX_STRUCTS structures of a
+ * region. The table is rebuilt whenever the structure count of the region
+ * changes.
+ */
+static void build_sds_index(unsigned int region_id)
+{
+	unsigned int i, structure_count;
+	uintptr_t current_header;
+	uintptr_t sds_mem_base = sds_regions[region_id].base;
+	sds_index_t *index = &sds_index[region_id];
+
+	structure_count = GET_SDS_REGION_STRUCTURE_COUNT(sds_mem_base);
+	current_header = sds_mem_base + SDS_REGION_DESC_SIZE;
+
+	for (i = 0; (i < structure_count) && (i < SDS_INDEX_MAX_STRUCTS); i++) {
+		index->entry[i].structure_id =
+				(uint16_t)GET_SDS_HEADER_ID(current_header);
+		index->entry[i].offset =
+				(uint32_t)(current_header - sds_mem_base);
+		current_header += GET_SDS_HEADER_STRUCT_SIZE(current_header) +
+						SDS_HEADER_SIZE;
+	}
+
+	index->entry_count = i;
+	index->structure_count = structure_count;
+}
+
 /*
  * Get the structure header pointer corresponding to the structure ID.
  * Returns SDS_OK on success, SDS_ERR_STRUCT_NOT_FOUND on error.
@@ -97,6 +128,35 @@ static int get_struct_header(unsigned int region_id, uint32_t structure_id,
 	if (structure_count == 0)
 		return SDS_ERR_STRUCT_NOT_FOUND;
 
+	if (region_id < SDS_INDEX_MAX_REGIONS) {
+		sds_index_t *index = &sds_index[region_id];
+
+		if (index->structure_count != structure_count)
+			build_sds_index(region_id);
+
+		for (i = 0; i < index->entry_count; i++) {
+			if (index->entry[i].structure_id != structure_id)
+				continue;
+
+			current_header = sds_mem_base + index->entry[i].offset;
+			/* The region was rewritten, rebuild on next lookup */
+			if (GET_SDS_HEADER_ID(current_header) != structure_id) {
+				index->structure_count = 0U;
+				break;
+			}
+
+			*header = (struct_header_t *)current_header;
+			return SDS_OK;
+		}
+
+		/* The table holds every structure of the region */
+		if ((i == index->entry_count) &&
+		    (index->entry_count == structure_count)) {
+			*header = NULL;
+			return SDS_ERR_STRUCT_NOT_FOUND;
+		}
+	}
+
 	current_header = ((uintptr_t)sds_mem_base) + SDS_REGION_DESC_SIZE;
 
 	/* Iterate over structure headers to find one with a matching ID */
@@ -272,5 +332,8 @@ int sds_init(unsigned int region_id)
 	if (validate_sds_struct_headers(region_id) != SDS_OK)
 		return SDS_ERR_FAIL;
 
+	if (region_id < SDS_INDEX_MAX_REGIONS)
+		build_sds_index(region_id);
+
 	return SDS_OK;
 }
@@ -58,6 +58,13 @@
 #define SDS_REGION_REGIONSIZE_OFFSET		0x4
 #define SDS_REGION_DESC_SIZE			0x8
 
+/*
+ * Size of the table of structure offsets built at sds_init(). Structures and
+ * regions beyond these limits are looked up by scanning the region.
+ */
+#define SDS_INDEX_MAX_REGIONS			4
+#define SDS_INDEX_MAX_STRUCTS			16
+
 #ifndef __ASSEMBLER__
 #include <stddef.h>
 #include <stdint.h>
@@ -80,6 +87,21 @@ typedef struct structure_header {
 #define GET_SDS_STRUCT_FIELD(_header, _field_offset)	\
 	((((uint8_t *)(_header)) + sizeof(struct_header_t)) + (_field_offset))
 
+/* Offset of a structure header from the base of its SDS region */
+typedef struct sds_index_entry {
+	uint16_t structure_id;
+	uint32_t offset;
+} sds_index_entry_t;
+
+/* Table of the structures of a SDS region, indexed by structure ID */
+typedef struct sds_index {
+	/* Structure count of the region when the table was built, 0 if none */
+	unsigned int structure_count;
+	/* Number of valid entries, at most SDS_INDEX_MAX_STRUCTS */
+	unsigned int entry_count;
+	sds_index_entry_t entry[SDS_INDEX_MAX_STRUCTS];
+} sds_index_t;
+
 /* Region Descriptor describing the SDS Memory Region */
 typedef struct region_descriptor {
 	uint32_t reg[2];
@@ -448,6 +448,64 @@ void gicv2_raise_sgi(int sgi_num, bool ns, int proc_num)
 	gicd_write_sgir(driver_data->gicd_base, sgir_val);
 }
 
+/*******************************************************************************
+ * This function raises the specified SGI on all the PEs but the current one,
+ * with a single write.
+ ******************************************************************************/
+void gicv2_raise_sgi_others(int sgi_num, bool ns)
+{
+	unsigned int sgir_val;
+
+	assert(driver_data != NULL);
+	assert(driver_data->gicd_base != 0U);
+
+	sgir_val = GICV2_SGIR_VALUE(SGIR_TGT_OTHERS, 0U, ns, sgi_num);
+
+	/*
+	 * Ensure that any shared variable updates depending on out of band
+	 * interrupt trigger are observed before raising SGI.
+	 */
+	dsbishst();
+	gicd_write_sgir(driver_data->gicd_base, sgir_val);
+}
+
+/*******************************************************************************
+ * This function raises the specified SGI on the 'count' PEs whose linear
+ * indices are in 'proc_nums', with a single write of their CPU target list.
+ ******************************************************************************/
+void gicv2_raise_sgi_targets(int sgi_num, bool ns, const int *proc_nums,
+			     unsigned int count)
+{
+	unsigned int sgir_val, target = 0U;
+
+	assert(driver_data != NULL);
+	assert(driver_data->gicd_base != 0U);
+	assert(driver_data->target_masks != NULL);
+	assert((proc_nums != NULL) || (count == 0U));
+
+	for (unsigned int i = 0U; i < count; i++) {
+		assert(proc_nums[i] >= 0);
+		assert(proc_nums[i] < (int)driver_data->target_masks_num);
+
+		/* The mask must have been populated */
+		assert(driver_data->target_masks[proc_nums[i]] != 0U);
+		target |= driver_data->target_masks[proc_nums[i]];
+	}
+
+	if (target == 0U) {
+		return;
+	}
+
+	sgir_val = GICV2_SGIR_VALUE(SGIR_TGT_SPECIFIC, target, ns, sgi_num);
+
+	/*
+	 * Ensure that any shared variable updates depending on out of band
+	 * interrupt trigger are observed before raising SGI.
+	 */
+	dsbishst();
+	gicd_write_sgir(driver_data->gicd_base, sgir_val);
+}
+
 /*******************************************************************************
  * This function sets the interrupt routing for the given SPI interrupt id.
  * The interrupt routing is specified in routing mode. The proc_num parameter is
@@ -1,11 +1,12 @@
 /*
- * Copyright (c) 2015-2023, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  * Copyright (c) 2023, NVIDIA Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
 #include <assert.h>
+#include <string.h>
 
 #include <arch.h>
 #include <arch_helpers.h>
@@ -202,6 +203,50 @@ void gicv3_spis_config_defaults(uintptr_t gicd_base)
 #endif
 }
 
+/*
+ * Updates of the secure (E)SPIs of a block of 32 interrupt IDs, accumulated so
+ * that GICD_IGROUPR, GICD_IGRPMODR, GICD_ICFGR and GICD_ISENABLER are accessed
+ * once per block instead of once per interrupt. The blocks never span two
+ * chips of a multichip GIC, whose SPI ranges are made of blocks of 32.
+ */
+typedef struct spi_block {
+	uintptr_t gicd_base;
+	unsigned int id;		/* First interrupt ID of the block */
+	unsigned int secure;		/* Secure interrupts of the block */
+	unsigned int g1s;		/* Secure interrupts that are G1S */
+	unsigned int cfg_mask[2];	/* GICD_ICFGR fields to update */
+	unsigned int cfg_val[2];
+} spi_block_t;
+
+static void gicv3_spi_block_flush(const spi_block_t *blk)
+{
+	unsigned int i, id;
+
+	if (blk->secure == 0U) {
+		return;
+	}
+
+	gicd_write_igroupr(blk->gicd_base, blk->id,
+		gicd_read_igroupr(blk->gicd_base, blk->id) & ~blk->secure);
+	gicd_write_igrpmodr(blk->gicd_base, blk->id,
+		(gicd_read_igrpmodr(blk->gicd_base, blk->id) & ~blk->secure) |
+		blk->g1s);
+
+	for (i = 0U; i < 2U; i++) {
+		if (blk->cfg_mask[i] == 0U) {
+			continue;
+		}
+
+		id = blk->id + (i << ICFGR_SHIFT);
+		gicd_write_icfgr(blk->gicd_base, id,
+			(gicd_read_icfgr(blk->gicd_base, id) & ~blk->cfg_mask[i]) |
+			blk->cfg_val[i]);
+	}
+
+	/* Enable the interrupts once they are configured */
+	gicd_write_isenabler(blk->gicd_base, blk->id, blk->secure);
+}
+
 /*******************************************************************************
  * Helper function to configure properties of secure (E)SPIs
  ******************************************************************************/
@@ -213,59 +258,77 @@ unsigned int gicv3_secure_spis_config_props(uintptr_t gicd_base,
 	const interrupt_prop_t *current_prop;
 	unsigned long long gic_affinity_val;
 	unsigned int ctlr_enable = 0U;
+	spi_block_t blk;
 
 	/* Make sure there's a valid property array */
 	if (interrupt_props_num > 0U) {
 		assert(interrupt_props != NULL);
 	}
 
+	/* Target (E)SPIs to the primary CPU */
+	gic_affinity_val = gicd_irouter_val_from_mpidr(read_mpidr(), 0U);
+
+	(void)memset(&blk, 0, sizeof(blk));
+
 	for (i = 0U; i < interrupt_props_num; i++) {
 		current_prop = &interrupt_props[i];
 
 		unsigned int intr_num = current_prop->intr_num;
-		uintptr_t multichip_gicd_base;
+		unsigned int bit = intr_num & ((1U << IGROUPR_SHIFT) - 1U);
+		unsigned int reg = bit >> ICFGR_SHIFT;
+		unsigned int cfg_shift =
+			(bit & ((1U << ICFGR_SHIFT) - 1U)) << 1U;
 
 		/* Skip SGI, (E)PPI and LPI interrupts */
 		if (!IS_SPI(intr_num)) {
 			continue;
 		}
 
-		multichip_gicd_base =
-			gicv3_get_multichip_base(intr_num, gicd_base);
+		/*
+		 * The platforms list their interrupts in increasing order, so
+		 * the interrupts of a block usually follow each other.
+		 */
+		if ((blk.secure != 0U) && ((intr_num - bit) != blk.id)) {
+			gicv3_spi_block_flush(&blk);
+			(void)memset(&blk, 0, sizeof(blk));
+		}
+
+		if (blk.secure == 0U) {
+			blk.gicd_base = gicv3_get_multichip_base(intr_num,
+								 gicd_base);
+			blk.id = intr_num - bit;
+		}
 
 		/* Configure this interrupt as a secure interrupt */
-		gicd_clr_igroupr(multichip_gicd_base, intr_num);
+		blk.secure |= 1U << bit;
 
 		/* Configure this interrupt as G0 or a G1S interrupt */
 		assert((current_prop->intr_grp == INTR_GROUP0) ||
 				(current_prop->intr_grp == INTR_GROUP1S));
 
 		if (current_prop->intr_grp == INTR_GROUP1S) {
-			gicd_set_igrpmodr(multichip_gicd_base, intr_num);
+			blk.g1s |= 1U << bit;
 			ctlr_enable |= CTLR_ENABLE_G1S_BIT;
 		} else {
-			gicd_clr_igrpmodr(multichip_gicd_base, intr_num);
+			blk.g1s &= ~(1U << bit);
 			ctlr_enable |= CTLR_ENABLE_G0_BIT;
 		}
 
 		/* Set interrupt configuration */
-		gicd_set_icfgr(multichip_gicd_base, intr_num,
-				current_prop->intr_cfg);
+		blk.cfg_mask[reg] |= GIC_CFG_MASK << cfg_shift;
+		blk.cfg_val[reg] = (blk.cfg_val[reg] &
+				    ~(GIC_CFG_MASK << cfg_shift)) |
+			((current_prop->intr_cfg & GIC_CFG_MASK) << cfg_shift);
 
 		/* Set the priority of this interrupt */
-		gicd_set_ipriorityr(multichip_gicd_base, intr_num,
+		gicd_set_ipriorityr(blk.gicd_base, intr_num,
 				current_prop->intr_pri);
 
-		/* Target (E)SPIs to the primary CPU */
-		gic_affinity_val =
-			gicd_irouter_val_from_mpidr(read_mpidr(), 0U);
-		gicd_write_irouter(multichip_gicd_base, intr_num,
-			gic_affinity_val);
-
-		/* Enable this interrupt */
-		gicd_set_isenabler(multichip_gicd_base, intr_num);
+		gicd_write_irouter(blk.gicd_base, intr_num, gic_affinity_val);
 	}
 
+	gicv3_spi_block_flush(&blk);
+
 	return ctlr_enable;
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  * Copyright (c) 2023, NVIDIA Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
@@ -58,12 +58,20 @@ static bool is_valid_interrupt(unsigned int id);
 		}							\
 	} while (false)
 
-#define SAVE_GICD_REGS(base, ctx, intr_num, reg, REG)			\
+/*
+ * Restore registers whose bits are only set by writing 1, such as
+ * GICD_ISENABLER. Writing 0 to them has no effect, so the words with no bit
+ * set are skipped.
+ */
+#define RESTORE_GICD_SET_REGS(base, ctx, intr_num, reg, REG)		\
 	do {								\
 		for (unsigned int int_id = MIN_SPI_ID; int_id < (intr_num);\
 				int_id += (1U << REG##R_SHIFT)) {	\
-			(ctx)->gicd_##reg[(int_id - MIN_SPI_ID) >>	\
-			REG##R_SHIFT] = gicd_read_##reg((base), int_id); \
+			unsigned int val = (ctx)->gicd_##reg[		\
+				(int_id - MIN_SPI_ID) >> REG##R_SHIFT];	\
+			if (val != 0U) {				\
+				gicd_write_##reg((base), int_id, val);	\
+			}						\
 		}							\
 	} while (false)
 
@@ -79,18 +87,21 @@ static bool is_valid_interrupt(unsigned int id);
 		}							\
 	} while (false)
 
-#define SAVE_GICD_EREGS(base, ctx, intr_num, reg, REG)			\
+#define RESTORE_GICD_SET_EREGS(base, ctx, intr_num, reg, REG)		\
 	do {								\
 		for (unsigned int int_id = MIN_ESPI_ID; int_id < (intr_num);\
 				int_id += (1U << REG##R_SHIFT)) {	\
-			(ctx)->gicd_##reg[(int_id - (MIN_ESPI_ID -	\
-			round_up(TOTAL_SPI_INTR_NUM, 1U << REG##R_SHIFT)))\
-			>> REG##R_SHIFT] = gicd_read_##reg((base), int_id);\
+			unsigned int val = (ctx)->gicd_##reg[(int_id -	\
+			(MIN_ESPI_ID - round_up(TOTAL_SPI_INTR_NUM,	\
+			1U << REG##R_SHIFT))) >> REG##R_SHIFT];		\
+			if (val != 0U) {				\
+				gicd_write_##reg((base), int_id, val);	\
+			}						\
 		}							\
 	} while (false)
 #else
-#define SAVE_GICD_EREGS(base, ctx, intr_num, reg, REG)
 #define RESTORE_GICD_EREGS(base, ctx, intr_num, reg, REG)
+#define RESTORE_GICD_SET_EREGS(base, ctx, intr_num, reg, REG)
 #endif /* GIC_EXT_INTID */
 
 /*******************************************************************************
@@ -747,6 +758,56 @@ void gicv3_rdistif_init_restore(unsigned int proc_num,
 	gicr_wait_for_pending_write(gicr_base);
 }
 
+/* Index in the Distributor context of the register of interrupt 'id' */
+#define SAVE_CTX_IDX(id, REG)						\
+	(((id) - first_id + round_up(ctx_first, 1U << REG##R_SHIFT)) >>	\
+	 REG##R_SHIFT)
+
+/*
+ * Save the Distributor registers of the shared interrupts from 'first_id' to
+ * 'limit', which are stored in the context from the interrupt 'ctx_first'
+ * onwards (the ESPIs follow the SPIs). The registers are read 32 interrupts at
+ * a time, so that the walk is done once rather than once per register.
+ */
+static void gicv3_distif_save_range(uintptr_t gicd_base,
+				    gicv3_dist_ctx_t * const dist_ctx,
+				    unsigned int first_id, unsigned int limit,
+				    unsigned int ctx_first)
+{
+	for (unsigned int int_id = first_id; int_id < limit; int_id += 32U) {
+		unsigned int end = MIN(int_id + 32U, limit);
+		unsigned int id;
+
+		dist_ctx->gicd_igroupr[SAVE_CTX_IDX(int_id, IGROUP)] =
+			gicd_read_igroupr(gicd_base, int_id);
+		dist_ctx->gicd_isenabler[SAVE_CTX_IDX(int_id, ISENABLE)] =
+			gicd_read_isenabler(gicd_base, int_id);
+		dist_ctx->gicd_ispendr[SAVE_CTX_IDX(int_id, ISPEND)] =
+			gicd_read_ispendr(gicd_base, int_id);
+		dist_ctx->gicd_isactiver[SAVE_CTX_IDX(int_id, ISACTIVE)] =
+			gicd_read_isactiver(gicd_base, int_id);
+		dist_ctx->gicd_igrpmodr[SAVE_CTX_IDX(int_id, IGRPMOD)] =
+			gicd_read_igrpmodr(gicd_base, int_id);
+
+		for (id = int_id; id < end; id += (1U << ICFGR_SHIFT)) {
+			dist_ctx->gicd_icfgr[SAVE_CTX_IDX(id, ICFG)] =
+				gicd_read_icfgr(gicd_base, id);
+			dist_ctx->gicd_nsacr[SAVE_CTX_IDX(id, NSAC)] =
+				gicd_read_nsacr(gicd_base, id);
+		}
+
+		for (id = int_id; id < end; id += (1U << IPRIORITYR_SHIFT)) {
+			dist_ctx->gicd_ipriorityr[SAVE_CTX_IDX(id, IPRIORITY)] =
+				gicd_read_ipriorityr(gicd_base, id);
+		}
+
+		for (id = int_id; id < end; id++) {
+			dist_ctx->gicd_irouter[SAVE_CTX_IDX(id, IROUTE)] =
+				gicd_read_irouter(gicd_base, id);
+		}
+	}
+}
+
 /*****************************************************************************
  * Function to save the GIC Distributor register context. This function
  * must be invoked after CPU interface disable and Redistributor save.
@@ -770,59 +831,14 @@ void gicv3_distif_save(gicv3_dist_ctx_t * const dist_ctx)
 	/* Save the GICD_CTLR */
 	dist_ctx->gicd_ctlr = gicd_read_ctlr(gicd_base);
 
-	/* Save GICD_IGROUPR for INTIDs 32 - 1019 */
-	SAVE_GICD_REGS(gicd_base, dist_ctx, num_ints, igroupr, IGROUP);
-
-	/* Save GICD_IGROUPRE for INTIDs 4096 - 5119 */
-	SAVE_GICD_EREGS(gicd_base, dist_ctx, num_eints, igroupr, IGROUP);
-
-	/* Save GICD_ISENABLER for INT_IDs 32 - 1019 */
-	SAVE_GICD_REGS(gicd_base, dist_ctx, num_ints, isenabler, ISENABLE);
-
-	/* Save GICD_ISENABLERE for INT_IDs 4096 - 5119 */
-	SAVE_GICD_EREGS(gicd_base, dist_ctx, num_eints, isenabler, ISENABLE);
-
-	/* Save GICD_ISPENDR for INTIDs 32 - 1019 */
-	SAVE_GICD_REGS(gicd_base, dist_ctx, num_ints, ispendr, ISPEND);
-
-	/* Save GICD_ISPENDRE for INTIDs 4096 - 5119 */
-	SAVE_GICD_EREGS(gicd_base, dist_ctx, num_eints,	ispendr, ISPEND);
-
-	/* Save GICD_ISACTIVER for INTIDs 32 - 1019 */
-	SAVE_GICD_REGS(gicd_base, dist_ctx, num_ints, isactiver, ISACTIVE);
-
-	/* Save GICD_ISACTIVERE for INTIDs 4096 - 5119 */
-	SAVE_GICD_EREGS(gicd_base, dist_ctx, num_eints, isactiver, ISACTIVE);
-
-	/* Save GICD_IPRIORITYR for INTIDs 32 - 1019 */
-	SAVE_GICD_REGS(gicd_base, dist_ctx, num_ints, ipriorityr, IPRIORITY);
-
-	/* Save GICD_IPRIORITYRE for INTIDs 4096 - 5119 */
-	SAVE_GICD_EREGS(gicd_base, dist_ctx, num_eints, ipriorityr, IPRIORITY);
-
-	/* Save GICD_ICFGR for INTIDs 32 - 1019 */
-	SAVE_GICD_REGS(gicd_base, dist_ctx, num_ints, icfgr, ICFG);
-
-	/* Save GICD_ICFGRE for INTIDs 4096 - 5119 */
-	SAVE_GICD_EREGS(gicd_base, dist_ctx, num_eints, icfgr, ICFG);
+	/* Save the registers of INTIDs 32 - 1019 */
+	gicv3_distif_save_range(gicd_base, dist_ctx, MIN_SPI_ID, num_ints, 0U);
 
-	/* Save GICD_IGRPMODR for INTIDs 32 - 1019 */
-	SAVE_GICD_REGS(gicd_base, dist_ctx, num_ints, igrpmodr, IGRPMOD);
-
-	/* Save GICD_IGRPMODRE for INTIDs 4096 - 5119 */
-	SAVE_GICD_EREGS(gicd_base, dist_ctx, num_eints, igrpmodr, IGRPMOD);
-
-	/* Save GICD_NSACR for INTIDs 32 - 1019 */
-	SAVE_GICD_REGS(gicd_base, dist_ctx, num_ints, nsacr, NSAC);
-
-	/* Save GICD_NSACRE for INTIDs 4096 - 5119 */
-	SAVE_GICD_EREGS(gicd_base, dist_ctx, num_eints, nsacr, NSAC);
-
-	/* Save GICD_IROUTER for INTIDs 32 - 1019 */
-	SAVE_GICD_REGS(gicd_base, dist_ctx, num_ints, irouter, IROUTE);
-
-	/* Save GICD_IROUTERE for INTIDs 4096 - 5119 */
-	SAVE_GICD_EREGS(gicd_base, dist_ctx, num_eints, irouter, IROUTE);
+#if GIC_EXT_INTID
+	/* Save the registers of INTIDs 4096 - 5119 */
+	gicv3_distif_save_range(gicd_base, dist_ctx, MIN_ESPI_ID, num_eints,
+				TOTAL_SPI_INTR_NUM);
+#endif
 
 	/*
 	 * GICD_ITARGETSR<n> and GICD_SPENDSGIR<n> are RAZ/WI when
@@ -907,22 +923,25 @@ void gicv3_distif_init_restore(const gicv3_dist_ctx_t * const dist_ctx)
 	 */
 
 	/* Restore GICD_ISENABLER for INT_IDs 32 - 1019 */
-	RESTORE_GICD_REGS(gicd_base, dist_ctx, num_ints, isenabler, ISENABLE);
+	RESTORE_GICD_SET_REGS(gicd_base, dist_ctx, num_ints, isenabler, ISENABLE);
 
 	/* Restore GICD_ISENABLERE for INT_IDs 4096 - 5119 */
-	RESTORE_GICD_EREGS(gicd_base, dist_ctx, num_eints, isenabler, ISENABLE);
+	RESTORE_GICD_SET_EREGS(gicd_base, dist_ctx, num_eints,
+			       isenabler, ISENABLE);
 
 	/* Restore GICD_ISPENDR for INTIDs 32 - 1019 */
-	RESTORE_GICD_REGS(gicd_base, dist_ctx, num_ints, ispendr, ISPEND);
+	RESTORE_GICD_SET_REGS(gicd_base, dist_ctx, num_ints, ispendr, ISPEND);
 
 	/* Restore GICD_ISPENDRE for INTIDs 4096 - 5119 */
-	RESTORE_GICD_EREGS(gicd_base, dist_ctx, num_eints, ispendr, ISPEND);
+	RESTORE_GICD_SET_EREGS(gicd_base, dist_ctx, num_eints,
+			       ispendr, ISPEND);
 
 	/* Restore GICD_ISACTIVER for INTIDs 32 - 1019 */
-	RESTORE_GICD_REGS(gicd_base, dist_ctx, num_ints, isactiver, ISACTIVE);
+	RESTORE_GICD_SET_REGS(gicd_base, dist_ctx, num_ints, isactiver, ISACTIVE);
 
 	/* Restore GICD_ISACTIVERE for INTIDs 4096 - 5119 */
-	RESTORE_GICD_EREGS(gicd_base, dist_ctx, num_eints, isactiver, ISACTIVE);
+	RESTORE_GICD_SET_EREGS(gicd_base, dist_ctx, num_eints,
+			       isactiver, ISACTIVE);
 
 	/* Restore the GICD_CTLR */
 	gicd_write_ctlr(gicd_base, dist_ctx->gicd_ctlr);
@@ -1138,6 +1157,33 @@ void gicv3_set_interrupt_group(unsigned int id, unsigned int proc_num,
 	}
 }
 
+/* Write the SGI register of the group, once the memory updates are visible */
+static void gicv3_write_sgir(gicv3_irq_group_t group, uint64_t sgi_val)
+{
+	/*
+	 * Ensure that any shared variable updates depending on out of band
+	 * interrupt trigger are observed before raising SGI.
+	 */
+	dsbishst();
+
+	switch (group) {
+	case GICV3_G0:
+		write_icc_sgi0r_el1(sgi_val);
+		break;
+	case GICV3_G1NS:
+		write_icc_asgi1r(sgi_val);
+		break;
+	case GICV3_G1S:
+		write_icc_sgi1r(sgi_val);
+		break;
+	default:
+		assert(false);
+		break;
+	}
+
+	isb();
+}
+
 /*******************************************************************************
  * This function raises the specified SGI of the specified group.
  *
@@ -1169,28 +1215,78 @@ void gicv3_raise_sgi(unsigned int sgi_num, gicv3_irq_group_t group,
 	sgi_val = GICV3_SGIR_VALUE(aff3, aff2, aff1, sgi_num, SGIR_IRM_TO_AFF,
 			tgt);
 
-	/*
-	 * Ensure that any shared variable updates depending on out of band
-	 * interrupt trigger are observed before raising SGI.
-	 */
-	dsbishst();
+	gicv3_write_sgir(group, sgi_val);
+}
 
-	switch (group) {
-	case GICV3_G0:
-		write_icc_sgi0r_el1(sgi_val);
-		break;
-	case GICV3_G1NS:
-		write_icc_asgi1r(sgi_val);
-		break;
-	case GICV3_G1S:
-		write_icc_sgi1r(sgi_val);
-		break;
-	default:
-		assert(false);
-		break;
-	}
+/*******************************************************************************
+ * This function raises the specified SGI of the specified group on all the PEs
+ * but the current one, with a single write.
+ ******************************************************************************/
+void gicv3_raise_sgi_others(unsigned int sgi_num, gicv3_irq_group_t group)
+{
+	/* Verify interrupt number is in the SGI range */
+	assert((sgi_num >= MIN_SGI_ID) && (sgi_num < MIN_PPI_ID));
 
-	isb();
+	gicv3_write_sgir(group, GICV3_SGIR_VALUE(0U, 0U, 0U, sgi_num,
+						 SGIR_IRM_TO_OTHERS, 0U));
+}
+
+/* Affinity path of a PE above level 0, shared by the PEs of a target list */
+static unsigned int gicv3_sgi_aff_path(u_register_t mpidr)
+{
+	return (MPIDR_AFFLVL3_VAL(mpidr) << 16) |
+	       (MPIDR_AFFLVL2_VAL(mpidr) << 8) | MPIDR_AFFLVL1_VAL(mpidr);
+}
+
+/*******************************************************************************
+ * This function raises the specified SGI of the specified group on the 'count'
+ * PEs whose MPIDRs are in 'targets'. The PEs sharing Aff3.Aff2.Aff1 are packed
+ * into the target list of a single write, so a cluster of up to 16 PEs costs
+ * one write rather than one per PE. To target all the other PEs, use
+ * gicv3_raise_sgi_others() instead.
+ ******************************************************************************/
+void gicv3_raise_sgi_targets(unsigned int sgi_num, gicv3_irq_group_t group,
+			     const u_register_t *targets, unsigned int count)
+{
+	unsigned int i, j, path;
+	uint64_t sgi_val;
+	uint16_t tgt;
+
+	/* Verify interrupt number is in the SGI range */
+	assert((sgi_num >= MIN_SGI_ID) && (sgi_num < MIN_PPI_ID));
+	assert((targets != NULL) || (count == 0U));
+
+	for (i = 0U; i < count; i++) {
+		path = gicv3_sgi_aff_path(targets[i]);
+
+		/* Skip the PEs already signalled along with an earlier one */
+		for (j = 0U; j < i; j++) {
+			if (gicv3_sgi_aff_path(targets[j]) == path) {
+				break;
+			}
+		}
+		if (j < i) {
+			continue;
+		}
+
+		tgt = 0U;
+		for (j = i; j < count; j++) {
+			if (gicv3_sgi_aff_path(targets[j]) == path) {
+				/* Aff0 must fit in the target list */
+				assert(MPIDR_AFFLVL0_VAL(targets[j]) <
+				       GICV3_MAX_SGI_TARGETS);
+				tgt |= (uint16_t)BIT_32(
+					MPIDR_AFFLVL0_VAL(targets[j]));
+			}
+		}
+
+		sgi_val = GICV3_SGIR_VALUE(MPIDR_AFFLVL3_VAL(targets[i]),
+					   MPIDR_AFFLVL2_VAL(targets[i]),
+					   MPIDR_AFFLVL1_VAL(targets[i]),
+					   sgi_num, SGIR_IRM_TO_AFF, tgt);
+
+		gicv3_write_sgir(group, sgi_val);
+	}
 }
 
 /*******************************************************************************
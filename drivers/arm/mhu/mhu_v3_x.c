@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2024-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -152,8 +152,11 @@ enum mhu_v3_x_error_t mhu_v3_x_doorbell_clear(const struct mhu_v3_x_dev_t *dev,
 	mdbcw_reg = (struct _mhu_v3_x_mdbcw_reg_t *)
 		&(p_mhu->mbx_frame.mdbcw_page);
 
-	/* Clear the bits in the doorbell channel */
-	mdbcw_reg[channel].mdbcw_clr |= flags;
+	/*
+	 * Clear the bits in the doorbell channel. The register only clears the
+	 * bits written as 1, so there is no need to read it first.
+	 */
+	mdbcw_reg[channel].mdbcw_clr = flags;
 
 	return MHU_V_3_X_ERR_NONE;
 }
@@ -181,8 +184,11 @@ enum mhu_v3_x_error_t mhu_v3_x_doorbell_write(const struct mhu_v3_x_dev_t *dev,
 	pdbcw_reg = (struct _mhu_v3_x_pdbcw_reg_t *)
 		&(p_mhu->pbx_frame.pdbcw_page);
 
-	/* Write the value to the doorbell channel */
-	pdbcw_reg[channel].pdbcw_set |= flags;
+	/*
+	 * Write the value to the doorbell channel. The register only sets the
+	 * bits written as 1, so there is no need to read it first.
+	 */
+	pdbcw_reg[channel].pdbcw_set = flags;
 
 	return MHU_V_3_X_ERR_NONE;
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2024-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -32,6 +32,13 @@
 struct mhu_v3_x_dev_t mhu_hse_dev = {0, MHU_V3_X_PBX_FRAME};
 struct mhu_v3_x_dev_t mhu_seh_dev = {0, MHU_V3_X_MBX_FRAME};
 
+/*
+ * Number of doorbell channels of each device, read once at initialisation
+ * rather than from the MHU configuration register for every transfer.
+ */
+static uint8_t mhu_hse_num_ch;
+static uint8_t mhu_seh_num_ch;
+
 /* MHUv3 driver error to MHUv3 wrapper error mapping */
 static enum mhu_error_t error_mapping_to_mhu_error_t(enum mhu_v3_x_error_t err)
 {
@@ -57,11 +64,10 @@ static enum mhu_error_t error_mapping_to_mhu_error_t(enum mhu_v3_x_error_t err)
 }
 
 static enum mhu_error_t signal_and_wait_for_clear(
-	void *mhu_sender_dev, uint32_t value)
+	void *mhu_sender_dev, uint8_t num_channels, uint32_t value)
 {
 	enum mhu_v3_x_error_t err;
 	struct mhu_v3_x_dev_t *dev;
-	uint8_t num_channels;
 	uint32_t read_val;
 
 	dev = (struct mhu_v3_x_dev_t *)mhu_sender_dev;
@@ -70,12 +76,6 @@ static enum mhu_error_t signal_and_wait_for_clear(
 		return MHU_ERR_INVALID_ARG;
 	}
 
-	err = mhu_v3_x_get_num_channel_implemented(dev,
-			MHU_V3_X_CHANNEL_TYPE_DBCH, &num_channels);
-	if (err != MHU_V_3_X_ERR_NONE) {
-		return error_mapping_to_mhu_error_t(err);
-	}
-
 	/* Wait for any pending acknowledgment from transmitter side */
 	do {
 		err = mhu_v3_x_doorbell_read(dev, num_channels - 1, &read_val);
@@ -102,12 +102,11 @@ static enum mhu_error_t signal_and_wait_for_clear(
 }
 
 static enum mhu_error_t wait_for_signal(
-	void *mhu_receiver_dev, uint32_t value)
+	void *mhu_receiver_dev, uint8_t num_channels, uint32_t value)
 {
 	enum mhu_v3_x_error_t err;
 	struct mhu_v3_x_dev_t *dev;
 	uint32_t read_val;
-	uint8_t num_channels;
 
 	dev = (struct mhu_v3_x_dev_t *)mhu_receiver_dev;
 
@@ -115,12 +114,6 @@ static enum mhu_error_t wait_for_signal(
 		return MHU_ERR_INVALID_ARG;
 	}
 
-	err = mhu_v3_x_get_num_channel_implemented(dev,
-			MHU_V3_X_CHANNEL_TYPE_DBCH, &num_channels);
-	if (err != MHU_V_3_X_ERR_NONE) {
-		return error_mapping_to_mhu_error_t(err);
-	}
-
 	do {
 		err = mhu_v3_x_doorbell_read(dev, num_channels - 1, &read_val);
 		if (err != MHU_V_3_X_ERR_NONE) {
@@ -132,11 +125,10 @@ static enum mhu_error_t wait_for_signal(
 }
 
 static enum mhu_error_t clear_and_wait_for_signal(
-	void *mhu_receiver_dev, uint32_t value)
+	void *mhu_receiver_dev, uint8_t num_channels, uint32_t value)
 {
 	enum mhu_v3_x_error_t err;
 	struct mhu_v3_x_dev_t *dev;
-	uint8_t num_channels;
 
 	dev = (struct mhu_v3_x_dev_t *)mhu_receiver_dev;
 
@@ -144,12 +136,6 @@ static enum mhu_error_t clear_and_wait_for_signal(
 		return MHU_ERR_INVALID_ARG;
 	}
 
-	err = mhu_v3_x_get_num_channel_implemented(dev,
-			MHU_V3_X_CHANNEL_TYPE_DBCH, &num_channels);
-	if (err != MHU_V_3_X_ERR_NONE) {
-		return error_mapping_to_mhu_error_t(err);
-	}
-
 	/* Clear all channels */
 	for (int i = 0; i < num_channels; i++) {
 		err = mhu_v3_x_doorbell_clear(dev, i, UINT32_MAX);
@@ -158,7 +144,7 @@ static enum mhu_error_t clear_and_wait_for_signal(
 		}
 	}
 
-	return wait_for_signal(mhu_receiver_dev, value);
+	return wait_for_signal(mhu_receiver_dev, num_channels, value);
 }
 
 static enum mhu_error_t validate_buffer_params(uintptr_t buf_addr)
@@ -198,6 +184,8 @@ enum mhu_error_t mhu_init_sender(uintptr_t mhu_sender_base)
 		return MHU_ERR_UNSUPPORTED;
 	}
 
+	mhu_hse_num_ch = num_ch;
+
 	/*
 	 * The sender polls the postbox doorbell channel window status register
 	 * to get notified about successful transfer. So, disable the doorbell
@@ -245,6 +233,8 @@ enum mhu_error_t mhu_init_receiver(uintptr_t mhu_receiver_base)
 		return MHU_ERR_UNSUPPORTED;
 	}
 
+	mhu_seh_num_ch = num_ch;
+
 	/* Mask all channels except the notifying channel */
 	for (ch = 0; ch < (num_ch - 1); ch++) {
 		/* Mask interrupts on channels used for data */
@@ -311,10 +301,9 @@ enum mhu_error_t mhu_send_data(const uint8_t *send_buffer, size_t size)
 		return mhu_err;
 	}
 
-	mhu_v3_err = mhu_v3_x_get_num_channel_implemented(dev,
-			MHU_V3_X_CHANNEL_TYPE_DBCH, &num_channels);
-	if (mhu_v3_err != MHU_V_3_X_ERR_NONE) {
-		return error_mapping_to_mhu_error_t(mhu_v3_err);
+	num_channels = mhu_hse_num_ch;
+	if (num_channels == 0U) {
+		return MHU_ERR_NOT_INIT;
 	}
 
 	/* First send the size of the actual message. */
@@ -334,7 +323,7 @@ enum mhu_error_t mhu_send_data(const uint8_t *send_buffer, size_t size)
 		if (++chan == (num_channels - 1)) {
 			/* Use the last channel to notify transfer complete */
 			mhu_err = signal_and_wait_for_clear(
-				dev, MHU_NOTIFY_VALUE);
+				dev, num_channels, MHU_NOTIFY_VALUE);
 			if (mhu_err != MHU_ERR_NONE) {
 				return mhu_err;
 			}
@@ -344,7 +333,8 @@ enum mhu_error_t mhu_send_data(const uint8_t *send_buffer, size_t size)
 
 	if (chan != 0) {
 		/* Use the last channel to notify transfer complete */
-		mhu_err = signal_and_wait_for_clear(dev, MHU_NOTIFY_VALUE);
+		mhu_err = signal_and_wait_for_clear(dev, num_channels,
+						    MHU_NOTIFY_VALUE);
 		if (mhu_err != MHU_ERR_NONE) {
 			return mhu_err;
 		}
@@ -386,14 +376,13 @@ enum mhu_error_t mhu_receive_data(uint8_t *receive_buffer, size_t *size)
 		return mhu_err;
 	}
 
-	mhu_v3_err = mhu_v3_x_get_num_channel_implemented(dev,
-			MHU_V3_X_CHANNEL_TYPE_DBCH, &num_channels);
-	if (mhu_v3_err != MHU_V_3_X_ERR_NONE) {
-		return error_mapping_to_mhu_error_t(mhu_v3_err);
+	num_channels = mhu_seh_num_ch;
+	if (num_channels == 0U) {
+		return MHU_ERR_NOT_INIT;
 	}
 
 	/* Busy wait for incoming reply */
-	mhu_err = wait_for_signal(dev, MHU_NOTIFY_VALUE);
+	mhu_err = wait_for_signal(dev, num_channels, MHU_NOTIFY_VALUE);
 	if (mhu_err != MHU_ERR_NONE) {
 		return mhu_err;
 	}
@@ -422,7 +411,7 @@ enum mhu_error_t mhu_receive_data(uint8_t *receive_buffer, size_t *size)
 		if (++chan == (num_channels - 1) && (msg_len - i) > 4) {
 			/* Busy wait for next transfer */
 			mhu_err = clear_and_wait_for_signal(
-				dev, MHU_NOTIFY_VALUE);
+				dev, num_channels, MHU_NOTIFY_VALUE);
 			if (mhu_err != MHU_ERR_NONE) {
 				return mhu_err;
 			}
@@ -445,13 +434,8 @@ enum mhu_error_t mhu_receive_data(uint8_t *receive_buffer, size_t *size)
 
 size_t mhu_get_max_message_size(void)
 {
-	enum mhu_v3_x_error_t err __maybe_unused;
-	uint8_t num_channels;
-
-	err = mhu_v3_x_get_num_channel_implemented(&mhu_seh_dev,
-			MHU_V3_X_CHANNEL_TYPE_DBCH, &num_channels);
+	uint8_t num_channels = mhu_seh_num_ch;
 
-	assert(err == MHU_V_3_X_ERR_NONE);
 	assert(num_channels != U(0));
 	/*
 	 * Returns only usable size of memory. As one channel is specifically
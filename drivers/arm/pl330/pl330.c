@@ -0,0 +1,223 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <stdint.h>
+
+#include <arch_helpers.h>
+#include <common/debug.h>
+#include <drivers/arm/pl330.h>
+#include <drivers/dma.h>
+#include <lib/mmio.h>
+#include <lib/utils_def.h>
+
+#include <platform_def.h>
+
+/* Instruction encodings */
+#define DMAEND			U(0x00)
+#define DMAKILL			U(0x01)
+#define DMALD			U(0x04)
+#define DMAST			U(0x08)
+#define DMAWMB			U(0x13)
+#define DMALP(_lc)		(U(0x20) | ((_lc) << 1))
+#define DMALPEND(_lc)		(U(0x38) | ((_lc) << 2))
+#define DMAGO			U(0xa0)
+#define DMAMOV			U(0xbc)
+
+#define DMAMOV_SAR		U(0)
+#define DMAMOV_CCR		U(1)
+#define DMAMOV_DAR		U(2)
+
+/* Channel control register fields */
+#define CCR_SRC_INC		BIT_32(0)
+#define CCR_SRC_BURST_SIZE_SHIFT	U(1)
+#define CCR_SRC_BURST_LEN_SHIFT	U(4)
+#define CCR_SRC_PROT_SHIFT	U(8)
+#define CCR_DST_INC		BIT_32(14)
+#define CCR_DST_BURST_SIZE_SHIFT	U(15)
+#define CCR_DST_BURST_LEN_SHIFT	U(18)
+#define CCR_DST_PROT_SHIFT	U(22)
+/* Secure privileged accesses */
+#define CCR_PROT		U(0x1)
+
+#define MAX_BURST_LEN		U(16)
+#define MAX_BURST_SIZE		U(4)
+#define MAX_LOOP_COUNT		U(256)
+
+/* Large enough for the program built by pl330_start() */
+#define PROG_SIZE		U(64)
+
+static uintptr_t pl330_base;
+static unsigned int pl330_channel;
+static uint32_t pl330_ccr;
+
+static uint8_t pl330_prog[PROG_SIZE] __aligned(CACHE_WRITEBACK_GRANULE);
+
+static struct dma_ops pl330_ops;
+
+static unsigned int emit_u32(uint8_t *p, uint32_t val)
+{
+	p[0] = (uint8_t)val;
+	p[1] = (uint8_t)(val >> 8);
+	p[2] = (uint8_t)(val >> 16);
+	p[3] = (uint8_t)(val >> 24);
+
+	return 4U;
+}
+
+static unsigned int emit_mov(uint8_t *p, unsigned int reg, uint32_t val)
+{
+	p[0] = DMAMOV;
+	p[1] = (uint8_t)reg;
+
+	return 2U + emit_u32(&p[2], val);
+}
+
+/* Emit a loop of 'count' bursts, nested in an outer loop if 'outer' != 0 */
+static unsigned int emit_bursts(uint8_t *p, unsigned int count,
+				unsigned int outer)
+{
+	unsigned int n = 0U;
+
+	if (outer != 0U) {
+		p[n++] = DMALP(1U);
+		p[n++] = (uint8_t)(outer - 1U);
+	}
+
+	p[n++] = DMALP(0U);
+	p[n++] = (uint8_t)(count - 1U);
+	p[n++] = DMALD;
+	p[n++] = DMAST;
+	p[n++] = DMALPEND(0U);
+	p[n++] = 2U;
+
+	if (outer != 0U) {
+		p[n++] = DMALPEND(1U);
+		p[n++] = 6U;
+	}
+
+	return n;
+}
+
+/* Execute an instruction through the debug interface */
+static void pl330_exec(uint32_t inst0, uint32_t inst1)
+{
+	while ((mmio_read_32(pl330_base + PL330_DBGSTATUS) &
+		PL330_DBGSTATUS_BUSY) != 0U) {
+	}
+
+	mmio_write_32(pl330_base + PL330_DBGINST0, inst0);
+	mmio_write_32(pl330_base + PL330_DBGINST1, inst1);
+	mmio_write_32(pl330_base + PL330_DBGCMD, 0U);
+}
+
+static uint32_t pl330_channel_status(void)
+{
+	return mmio_read_32(pl330_base + PL330_CSR(pl330_channel)) &
+	       PL330_CSR_STATUS_MASK;
+}
+
+static int pl330_start(uintptr_t dst, uintptr_t src, size_t len)
+{
+	unsigned int bursts = (unsigned int)(len / pl330_ops.align);
+	unsigned int n = 0U;
+
+	assert((bursts != 0U) && (bursts <= (MAX_LOOP_COUNT * MAX_LOOP_COUNT)));
+	assert(((src | dst) >> 32) == 0U);
+
+	if (pl330_channel_status() != PL330_CSR_STOPPED) {
+		return -EBUSY;
+	}
+
+	n += emit_mov(&pl330_prog[n], DMAMOV_SAR, (uint32_t)src);
+	n += emit_mov(&pl330_prog[n], DMAMOV_DAR, (uint32_t)dst);
+	n += emit_mov(&pl330_prog[n], DMAMOV_CCR, pl330_ccr);
+
+	if (bursts >= MAX_LOOP_COUNT) {
+		n += emit_bursts(&pl330_prog[n], MAX_LOOP_COUNT,
+				 bursts / MAX_LOOP_COUNT);
+	}
+	if ((bursts % MAX_LOOP_COUNT) != 0U) {
+		n += emit_bursts(&pl330_prog[n], bursts % MAX_LOOP_COUNT, 0U);
+	}
+
+	pl330_prog[n++] = DMAWMB;
+	pl330_prog[n++] = DMAEND;
+	assert(n <= PROG_SIZE);
+
+	/* The channel fetches the program from memory */
+	flush_dcache_range((uintptr_t)pl330_prog, n);
+
+	assert(((uintptr_t)pl330_prog >> 32) == 0U);
+	pl330_exec(((uint32_t)DMAGO << PL330_DBGINST0_INSTR0_SHIFT) |
+		   (pl330_channel << PL330_DBGINST0_INSTR1_SHIFT),
+		   (uint32_t)(uintptr_t)pl330_prog);
+
+	return 0;
+}
+
+static int pl330_wait(void)
+{
+	uint32_t status;
+
+	do {
+		status = pl330_channel_status();
+	} while ((status != PL330_CSR_STOPPED) &&
+		 (status != PL330_CSR_FAULTING));
+
+	if (status == PL330_CSR_FAULTING) {
+		WARN("PL330: channel %u fault 0x%x\n", pl330_channel,
+		     mmio_read_32(pl330_base + PL330_FTR(pl330_channel)));
+		pl330_exec(((uint32_t)DMAKILL << PL330_DBGINST0_INSTR0_SHIFT) |
+			   (pl330_channel << PL330_DBGINST0_CHANNEL_SHIFT) |
+			   PL330_DBGINST0_THREAD_CHANNEL, 0U);
+		while (pl330_channel_status() != PL330_CSR_STOPPED) {
+		}
+		return -EIO;
+	}
+
+	return 0;
+}
+
+void pl330_init(uintptr_t base, unsigned int channel, size_t min_len)
+{
+	uint32_t crd, size, burst_len;
+
+	assert(base != 0U);
+	assert(channel <= ((mmio_read_32(base + PL330_CR0) >>
+			    PL330_CR0_NUM_CHNLS_SHIFT) &
+			   PL330_CR0_NUM_CHNLS_MASK));
+
+	pl330_base = base;
+	pl330_channel = channel;
+
+	/*
+	 * Use beats of the width of the AXI data bus, and bursts as long as
+	 * the MFIFO allows, so that each DMALD/DMAST pair moves one burst.
+	 */
+	crd = mmio_read_32(base + PL330_CRD);
+	size = MIN(crd & PL330_CRD_DATA_WIDTH_MASK, MAX_BURST_SIZE);
+	burst_len = MIN(((crd >> PL330_CRD_DATA_BUF_DEP_SHIFT) &
+			 PL330_CRD_DATA_BUF_DEP_MASK) + 1U, MAX_BURST_LEN);
+	/* The DMA framework needs a power of two alignment */
+	burst_len = U(1) << (31U - (unsigned int)__builtin_clz(burst_len));
+
+	pl330_ccr = CCR_SRC_INC | CCR_DST_INC |
+		    (size << CCR_SRC_BURST_SIZE_SHIFT) |
+		    (size << CCR_DST_BURST_SIZE_SHIFT) |
+		    ((burst_len - 1U) << CCR_SRC_BURST_LEN_SHIFT) |
+		    ((burst_len - 1U) << CCR_DST_BURST_LEN_SHIFT) |
+		    (CCR_PROT << CCR_SRC_PROT_SHIFT) |
+		    (CCR_PROT << CCR_DST_PROT_SHIFT);
+
+	pl330_ops.start = pl330_start;
+	pl330_ops.wait = pl330_wait;
+	pl330_ops.align = ((size_t)burst_len) << size;
+	pl330_ops.max_len = pl330_ops.align * MAX_LOOP_COUNT * MAX_LOOP_COUNT;
+
+	dma_register(&pl330_ops, min_len);
+}
@@ -1,9 +1,10 @@
 /*
- * Copyright (c) 2022-2024, Arm Limited. All rights reserved.
+ * Copyright (c) 2022-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
 
@@ -69,19 +70,25 @@ static uint8_t select_protocol_version(const psa_invec *in_vec, size_t in_len,
 	}
 }
 
-psa_status_t psa_call(psa_handle_t handle, int32_t type, const psa_invec *in_vec, size_t in_len,
-		      psa_outvec *out_vec, size_t out_len)
+/* Declared statically to avoid using huge amounts of stack space. Maybe revisit if
+ * functions not being reentrant becomes a problem.
+ */
+static union rse_comms_io_buffer_t io_buf;
+static uint8_t seq_num = 1U;
+
+#if RSE_MBOOT_ASYNC_EXTEND
+/* A message has been sent and its reply has not been received yet */
+static bool reply_pending;
+#endif
+
+static psa_status_t rse_comms_send(psa_handle_t handle, int32_t type,
+				   const psa_invec *in_vec, size_t in_len,
+				   const psa_outvec *out_vec, size_t out_len,
+				   uint8_t protocol_ver)
 {
-	/* Declared statically to avoid using huge amounts of stack space. Maybe revisit if
-	 * functions not being reentrant becomes a problem.
-	 */
-	static union rse_comms_io_buffer_t io_buf;
 	enum mhu_error_t err;
 	psa_status_t status;
-	static uint8_t seq_num = 1U;
 	size_t msg_size;
-	size_t reply_size = sizeof(io_buf.reply);
-	psa_status_t return_val;
 	size_t idx;
 
 	if (type > PSA_CALL_TYPE_MAX || type < PSA_CALL_TYPE_MIN ||
@@ -92,7 +99,7 @@ psa_status_t psa_call(psa_handle_t handle, int32_t type, const psa_invec *in_vec
 	io_buf.msg.header.seq_num = seq_num,
 	/* No need to distinguish callers (currently concurrent calls are not supported). */
 	io_buf.msg.header.client_id = 1U,
-	io_buf.msg.header.protocol_ver = select_protocol_version(in_vec, in_len, out_vec, out_len);
+	io_buf.msg.header.protocol_ver = protocol_ver;
 
 	status = rse_protocol_serialize_msg(handle, type, in_vec, in_len, out_vec,
 					    out_len, &io_buf.msg, &msg_size);
@@ -122,6 +129,17 @@ psa_status_t psa_call(psa_handle_t handle, int32_t type, const psa_invec *in_vec
 	memset(&io_buf.msg, 0xA5, msg_size);
 #endif
 
+	return PSA_SUCCESS;
+}
+
+static psa_status_t rse_comms_receive(psa_outvec *out_vec, size_t out_len)
+{
+	enum mhu_error_t err;
+	psa_status_t status;
+	size_t reply_size = sizeof(io_buf.reply);
+	psa_status_t return_val;
+	size_t idx;
+
 	err = mhu_receive_data((uint8_t *)&io_buf.reply, &reply_size);
 	if (err != MHU_ERR_NONE) {
 		return PSA_ERROR_COMMUNICATION_FAILURE;
@@ -152,6 +170,79 @@ psa_status_t psa_call(psa_handle_t handle, int32_t type, const psa_invec *in_vec
 	return return_val;
 }
 
+psa_status_t psa_call(psa_handle_t handle, int32_t type, const psa_invec *in_vec, size_t in_len,
+		      psa_outvec *out_vec, size_t out_len)
+{
+	psa_status_t status;
+
+#if RSE_MBOOT_ASYNC_EXTEND
+	/* The reply to the previous message must be received first */
+	status = rse_comms_wait();
+	if (status != PSA_SUCCESS) {
+		return status;
+	}
+#endif
+
+	status = rse_comms_send(handle, type, in_vec, in_len, out_vec, out_len,
+				select_protocol_version(in_vec, in_len,
+							out_vec, out_len));
+	if (status != PSA_SUCCESS) {
+		return status;
+	}
+
+	return rse_comms_receive(out_vec, out_len);
+}
+
+#if RSE_MBOOT_ASYNC_EXTEND
+/*
+ * Send a message without output vectors and return without waiting for its
+ * reply, which is received by the next call to rse_comms_wait() or psa_call().
+ * The AP can then carry on, e.g. load the next image, while RSE handles the
+ * message. Only messages whose input is copied into the MHU message, i.e. sent
+ * with the embed protocol, can be sent this way: the caller's buffers don't
+ * need to remain valid once this returns. Other messages are sent
+ * synchronously.
+ */
+psa_status_t rse_comms_call_async(psa_handle_t handle, int32_t type,
+				  const psa_invec *in_vec, size_t in_len)
+{
+	psa_status_t status;
+
+	if (select_protocol_version(in_vec, in_len, NULL, 0U) !=
+	    RSE_COMMS_PROTOCOL_EMBED) {
+		return psa_call(handle, type, in_vec, in_len, NULL, 0U);
+	}
+
+	status = rse_comms_wait();
+	if (status != PSA_SUCCESS) {
+		return status;
+	}
+
+	status = rse_comms_send(handle, type, in_vec, in_len, NULL, 0U,
+				RSE_COMMS_PROTOCOL_EMBED);
+	if (status == PSA_SUCCESS) {
+		reply_pending = true;
+	}
+
+	return status;
+}
+
+/*
+ * Receive the reply to the message sent by rse_comms_call_async(), if any, and
+ * return its status.
+ */
+psa_status_t rse_comms_wait(void)
+{
+	if (!reply_pending) {
+		return PSA_SUCCESS;
+	}
+
+	reply_pending = false;
+
+	return rse_comms_receive(NULL, 0U);
+}
+#endif /* RSE_MBOOT_ASYNC_EXTEND */
+
 int rse_comms_init(uintptr_t mhu_sender_base, uintptr_t mhu_receiver_base)
 {
 	enum mhu_error_t err;
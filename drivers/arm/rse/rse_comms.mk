@@ -1,11 +1,18 @@
 #
-# Copyright (c) 2022-2024, Arm Limited. All rights reserved.
+# Copyright (c) 2022-2026, Arm Limited. All rights reserved.
 #
 # SPDX-License-Identifier: BSD-3-Clause
 #
 
 $(warning "RSE driver is an experimental feature")
 
+# Return from measured boot extends as soon as they are sent to RSE, and only
+# wait for their reply when the next message is sent or at the end of the
+# boot stage.
+RSE_MBOOT_ASYNC_EXTEND	?= 0
+$(eval $(call assert_boolean,RSE_MBOOT_ASYNC_EXTEND))
+$(eval $(call add_define,RSE_MBOOT_ASYNC_EXTEND))
+
 RSE_COMMS_SOURCES	:=	$(addprefix drivers/arm/rse/,			\
 					rse_comms.c				\
 					rse_comms_protocol.c			\
@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <stdbool.h>
+
 #include <common/debug.h>
 #include <cdefs.h>
 #include <drivers/arm/smmu_v3.h>
@@ -34,44 +36,101 @@ static int smmuv3_poll(uintptr_t smmu_reg, uint32_t mask,
 	return -1;
 }
 
+/*
+ * The operations on several SMMUs are done in steps: each step is started on
+ * all of them, then waited for on all of them. The SMMUs thus carry out their
+ * updates and invalidations in parallel rather than one after another.
+ */
+static int smmuv3_poll_all(const uintptr_t *smmu_bases, unsigned int count,
+			   uintptr_t offset, uint32_t mask, uint32_t value)
+{
+	for (unsigned int i = 0U; i < count; i++) {
+		if (smmuv3_poll(smmu_bases[i] + offset, mask, value) != 0) {
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+static void smmuv3_setbits_all(const uintptr_t *smmu_bases, unsigned int count,
+			       uintptr_t offset, uint32_t set)
+{
+	for (unsigned int i = 0U; i < count; i++) {
+		mmio_setbits_32(smmu_bases[i] + offset, set);
+	}
+}
+
 /*
  * Abort all incoming transactions in order to implement a default
  * deny policy on reset.
  */
-int __init smmuv3_security_init(uintptr_t smmu_base)
+int __init smmuv3_security_init_all(const uintptr_t *smmu_bases,
+				    unsigned int count)
 {
+	unsigned int i;
+
 	/* Attribute update has completed when SMMU_(S)_GBPA.Update bit is 0 */
-	if (smmuv3_poll(smmu_base + SMMU_GBPA, SMMU_GBPA_UPDATE, 0U) != 0U)
+	if (smmuv3_poll_all(smmu_bases, count, SMMU_GBPA,
+			    SMMU_GBPA_UPDATE, 0U) != 0)
 		return -1;
 
 	/*
 	 * SMMU_(S)_CR0 resets to zero with all streams bypassing the SMMU,
 	 * so just abort all incoming transactions.
 	 */
-	mmio_setbits_32(smmu_base + SMMU_GBPA,
-			SMMU_GBPA_UPDATE | SMMU_GBPA_ABORT);
+	smmuv3_setbits_all(smmu_bases, count, SMMU_GBPA,
+			   SMMU_GBPA_UPDATE | SMMU_GBPA_ABORT);
 
-	if (smmuv3_poll(smmu_base + SMMU_GBPA, SMMU_GBPA_UPDATE, 0U) != 0U)
+	if (smmuv3_poll_all(smmu_bases, count, SMMU_GBPA,
+			    SMMU_GBPA_UPDATE, 0U) != 0)
 		return -1;
 
-	/* Check if the SMMU supports secure state */
-	if ((mmio_read_32(smmu_base + SMMU_S_IDR1) &
-				SMMU_S_IDR1_SECURE_IMPL) == 0U)
-		return 0;
+	/* Abort all incoming secure transactions, if secure state is supported */
+	for (i = 0U; i < count; i++) {
+		if ((mmio_read_32(smmu_bases[i] + SMMU_S_IDR1) &
+					SMMU_S_IDR1_SECURE_IMPL) == 0U)
+			continue;
 
-	/* Abort all incoming secure transactions */
-	if (smmuv3_poll(smmu_base + SMMU_S_GBPA, SMMU_S_GBPA_UPDATE, 0U) != 0U)
-		return -1;
+		if (smmuv3_poll(smmu_bases[i] + SMMU_S_GBPA,
+				SMMU_S_GBPA_UPDATE, 0U) != 0)
+			return -1;
+
+		mmio_setbits_32(smmu_bases[i] + SMMU_S_GBPA,
+				SMMU_S_GBPA_UPDATE | SMMU_S_GBPA_ABORT);
+	}
 
-	mmio_setbits_32(smmu_base + SMMU_S_GBPA,
-			SMMU_S_GBPA_UPDATE | SMMU_S_GBPA_ABORT);
+	for (i = 0U; i < count; i++) {
+		if ((mmio_read_32(smmu_bases[i] + SMMU_S_IDR1) &
+					SMMU_S_IDR1_SECURE_IMPL) == 0U)
+			continue;
 
-	return smmuv3_poll(smmu_base + SMMU_S_GBPA, SMMU_S_GBPA_UPDATE, 0U);
+		if (smmuv3_poll(smmu_bases[i] + SMMU_S_GBPA,
+				SMMU_S_GBPA_UPDATE, 0U) != 0)
+			return -1;
+	}
+
+	return 0;
 }
 
-/* Initialize the SMMU by invalidating all secure caches and TLBs. */
-int __init smmuv3_init(uintptr_t smmu_base)
+int __init smmuv3_security_init(uintptr_t smmu_base)
 {
+	return smmuv3_security_init_all(&smmu_base, 1U);
+}
+
+#if ENABLE_RME
+static bool smmuv3_root_impl(uintptr_t smmu_base)
+{
+	return (mmio_read_32(smmu_base + SMMU_ROOT_IDR0) &
+		SMMU_ROOT_IDR0_ROOT_IMPL) != 0U;
+}
+#endif /* ENABLE_RME */
+
+/* Initialize the SMMUs by invalidating all secure caches and TLBs. */
+int __init smmuv3_init_all(const uintptr_t *smmu_bases, unsigned int count)
+{
+	unsigned int i;
+
 	/*
 	 * Initiate invalidation of secure caches and TLBs if the SMMU
 	 * supports secure state. If not, it's implementation defined
@@ -87,32 +146,36 @@ int __init smmuv3_init(uintptr_t smmu_base)
 	 * Additionally, it is Root firmware’s responsibility to write to
 	 * INV_ALL before enabling SMMU_ROOT_CR0.{ACCESSEN,GPCEN}.
 	 */
-	mmio_write_32(smmu_base + SMMU_S_INIT, SMMU_S_INIT_INV_ALL);
+	for (i = 0U; i < count; i++) {
+		mmio_write_32(smmu_bases[i] + SMMU_S_INIT, SMMU_S_INIT_INV_ALL);
+	}
 
-	/* Wait for global invalidation operation to finish */
-	if (smmuv3_poll(smmu_base + SMMU_S_INIT,
-			SMMU_S_INIT_INV_ALL, 0U) != 0) {
+	/* Wait for global invalidation operations to finish */
+	if (smmuv3_poll_all(smmu_bases, count, SMMU_S_INIT,
+			    SMMU_S_INIT_INV_ALL, 0U) != 0) {
 		return -1;
 	}
 
 #if ENABLE_RME
 
 	if (is_feat_rme_present()) {
-		if ((mmio_read_32(smmu_base + SMMU_ROOT_IDR0) &
-				  SMMU_ROOT_IDR0_ROOT_IMPL) == 0U) {
-			WARN("Skip SMMU GPC configuration.\n");
-		} else {
-			uint64_t gpccr_el3 = read_gpccr_el3();
-			uint64_t gptbr_el3 = read_gptbr_el3();
+		uint64_t gpccr_el3 = read_gpccr_el3();
+		uint64_t gptbr_el3 = read_gptbr_el3();
 
-			/* SMMU_ROOT_GPT_BASE_CFG[16] is RES0. */
-			gpccr_el3 &= ~(1UL << 16);
+		/* SMMU_ROOT_GPT_BASE_CFG[16] is RES0. */
+		gpccr_el3 &= ~(1UL << 16);
+
+		for (i = 0U; i < count; i++) {
+			if (!smmuv3_root_impl(smmu_bases[i])) {
+				WARN("Skip SMMU GPC configuration.\n");
+				continue;
+			}
 
 			/*
 			 * TODO: SMMU_ROOT_GPT_BASE_CFG is 64b in the spec,
 			 * but SMMU model only accepts 32b access.
 			 */
-			mmio_write_32(smmu_base + SMMU_ROOT_GPT_BASE_CFG,
+			mmio_write_32(smmu_bases[i] + SMMU_ROOT_GPT_BASE_CFG,
 				      gpccr_el3);
 
 			/*
@@ -120,7 +183,7 @@ int __init smmuv3_init(uintptr_t smmu_base)
 			 * whereas it maps to SMMU_ROOT_GPT_BASE[51:12]
 			 * hence needs a 12 bit left shit.
 			 */
-			mmio_write_64(smmu_base + SMMU_ROOT_GPT_BASE,
+			mmio_write_64(smmu_bases[i] + SMMU_ROOT_GPT_BASE,
 				      gptbr_el3 << 12);
 
 			/*
@@ -129,12 +192,18 @@ int __init smmuv3_init(uintptr_t smmu_base)
 			 * GPCEN=1: All clients and SMMU-originated accesses,
 			 *          except GPT-walks, are subject to GPC.
 			 */
-			mmio_setbits_32(smmu_base + SMMU_ROOT_CR0,
+			mmio_setbits_32(smmu_bases[i] + SMMU_ROOT_CR0,
 					SMMU_ROOT_CR0_GPCEN |
 					SMMU_ROOT_CR0_ACCESSEN);
+		}
+
+		for (i = 0U; i < count; i++) {
+			if (!smmuv3_root_impl(smmu_bases[i])) {
+				continue;
+			}
 
 			/* Poll for ACCESSEN and GPCEN ack bits. */
-			if (smmuv3_poll(smmu_base + SMMU_ROOT_CR0ACK,
+			if (smmuv3_poll(smmu_bases[i] + SMMU_ROOT_CR0ACK,
 					SMMU_ROOT_CR0_GPCEN |
 					SMMU_ROOT_CR0_ACCESSEN,
 					SMMU_ROOT_CR0_GPCEN |
@@ -155,10 +224,17 @@ int __init smmuv3_init(uintptr_t smmu_base)
 	return 0;
 }
 
-int smmuv3_ns_set_abort_all(uintptr_t smmu_base)
+int __init smmuv3_init(uintptr_t smmu_base)
+{
+	return smmuv3_init_all(&smmu_base, 1U);
+}
+
+int smmuv3_ns_set_abort_all_smmus(const uintptr_t *smmu_bases,
+				  unsigned int count)
 {
 	/* Attribute update has completed when SMMU_GBPA.Update bit is 0 */
-	if (smmuv3_poll(smmu_base + SMMU_GBPA, SMMU_GBPA_UPDATE, 0U) != 0U) {
+	if (smmuv3_poll_all(smmu_bases, count, SMMU_GBPA,
+			    SMMU_GBPA_UPDATE, 0U) != 0) {
 		return -1;
 	}
 
@@ -166,16 +242,26 @@ int smmuv3_ns_set_abort_all(uintptr_t smmu_base)
 	 * Set GBPA's ABORT bit. Other GBPA fields are presumably ignored then,
 	 * so simply preserve their value.
 	 */
-	mmio_setbits_32(smmu_base + SMMU_GBPA, SMMU_GBPA_UPDATE | SMMU_GBPA_ABORT);
-	if (smmuv3_poll(smmu_base + SMMU_GBPA, SMMU_GBPA_UPDATE, 0U) != 0U) {
+	smmuv3_setbits_all(smmu_bases, count, SMMU_GBPA,
+			   SMMU_GBPA_UPDATE | SMMU_GBPA_ABORT);
+	if (smmuv3_poll_all(smmu_bases, count, SMMU_GBPA,
+			    SMMU_GBPA_UPDATE, 0U) != 0) {
 		return -1;
 	}
 
-	/* Disable the SMMU to engage the GBPA fields previously configured. */
-	mmio_clrbits_32(smmu_base + SMMU_CR0, SMMU_CR0_SMMUEN);
-	if (smmuv3_poll(smmu_base + SMMU_CR0ACK, SMMU_CR0_SMMUEN, 0U) != 0U) {
+	/* Disable the SMMUs to engage the GBPA fields previously configured. */
+	for (unsigned int i = 0U; i < count; i++) {
+		mmio_clrbits_32(smmu_bases[i] + SMMU_CR0, SMMU_CR0_SMMUEN);
+	}
+	if (smmuv3_poll_all(smmu_bases, count, SMMU_CR0ACK,
+			    SMMU_CR0_SMMUEN, 0U) != 0) {
 		return -1;
 	}
 
 	return 0;
 }
+
+int smmuv3_ns_set_abort_all(uintptr_t smmu_base)
+{
+	return smmuv3_ns_set_abort_all_smmus(&smmu_base, 1U);
+}
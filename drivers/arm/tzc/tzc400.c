@@ -10,6 +10,7 @@
 #include <common/debug.h>
 #include <drivers/arm/tzc400.h>
 #include <lib/mmio.h>
+#include <lib/spinlock.h>
 #include <lib/utils_def.h>
 
 #include "tzc_common_private.h"
@@ -39,6 +40,26 @@ typedef struct tzc400_instance {
 
 static tzc400_instance_t tzc400;
 
+/* Region registers, as programmed in the TZC or staged for the next commit */
+struct tzc400_region_regs {
+	unsigned long long base;
+	unsigned long long top;
+	unsigned int attr;
+	unsigned int id_access;
+};
+
+/*
+ * Shadow of the region registers. 'hw' tracks what was programmed in the TZC,
+ * so that a commit only writes the registers that differ from 'staged'.
+ */
+static struct {
+	struct tzc400_region_regs hw[TZC_400_REGION_MAX];
+	struct tzc400_region_regs staged[TZC_400_REGION_MAX];
+	unsigned int dirty;
+} tzc400_shadow;
+
+static spinlock_t tzc400_lock;
+
 static inline unsigned int _tzc400_read_build_config(uintptr_t base)
 {
 	return mmio_read_32(base + BUILD_CONFIG_OFF);
@@ -72,6 +93,22 @@ DEFINE_TZC_COMMON_UPDATE_FILTERS(400, 400)
 DEFINE_TZC_COMMON_CONFIGURE_REGION0(400)
 DEFINE_TZC_COMMON_CONFIGURE_REGION(400)
 
+static void _tzc400_read_region(uintptr_t base, unsigned int region,
+				struct tzc400_region_regs *regs)
+{
+	uintptr_t reg = base + TZC_REGION_OFFSET(TZC_400_REGION_SIZE,
+						 (u_register_t)region);
+
+	regs->base = mmio_read_32(reg + TZC_400_REGION_BASE_LOW_0_OFFSET) |
+		((unsigned long long)mmio_read_32(reg +
+			TZC_400_REGION_BASE_HIGH_0_OFFSET) << 32);
+	regs->top = mmio_read_32(reg + TZC_400_REGION_TOP_LOW_0_OFFSET) |
+		((unsigned long long)mmio_read_32(reg +
+			TZC_400_REGION_TOP_HIGH_0_OFFSET) << 32);
+	regs->attr = mmio_read_32(reg + TZC_400_REGION_ATTR_0_OFFSET);
+	regs->id_access = mmio_read_32(reg + TZC_400_REGION_ID_ACCESS_0_OFFSET);
+}
+
 static void _tzc400_clear_it(uintptr_t base, uint32_t filter)
 {
 	mmio_write_32(base + INT_CLEAR, BIT_32(filter));
@@ -176,6 +213,20 @@ static void _tzc400_set_gate_keeper(uintptr_t base,
 		;
 }
 
+/*
+ * Request the open status of all the filters at once, so that they only wait
+ * for each other's outstanding transactions once. This function is not MP
+ * safe.
+ */
+static void _tzc400_set_gate_keepers(uintptr_t base, unsigned int open_status)
+{
+	_tzc400_write_gate_keeper(base, (open_status & GATE_KEEPER_OR_MASK) <<
+			      GATE_KEEPER_OR_SHIFT);
+
+	while ((get_gate_keeper_os(base)) != open_status)
+		;
+}
+
 void tzc400_set_action(unsigned int action)
 {
 	assert(tzc400.base != 0U);
@@ -210,6 +261,14 @@ void tzc400_init(uintptr_t base)
 					BUILD_CONFIG_AW_MASK) + 1U;
 	tzc400.num_regions = (uint8_t)((tzc400_build >> BUILD_CONFIG_NR_SHIFT) &
 					BUILD_CONFIG_NR_MASK) + 1U;
+	assert(tzc400.num_regions <= TZC_400_REGION_MAX);
+
+	/* Start the shadow from what earlier boot stages programmed */
+	for (unsigned int region = 0U; region < tzc400.num_regions; region++) {
+		_tzc400_read_region(tzc400.base, region,
+				    &tzc400_shadow.hw[region]);
+	}
+	tzc400_shadow.dirty = 0U;
 }
 
 /*
@@ -225,24 +284,20 @@ void tzc400_configure_region0(unsigned int sec_attr,
 	assert(sec_attr <= TZC_REGION_S_RDWR);
 
 	_tzc400_configure_region0(tzc400.base, sec_attr, ns_device_access);
+
+	tzc400_shadow.hw[0].attr = sec_attr << TZC_REGION_ATTR_SEC_SHIFT;
+	tzc400_shadow.hw[0].id_access = ns_device_access;
 }
 
 /*
- * `tzc400_configure_region` is used to program regions into the TrustZone
- * controller. A region can be associated with more than one filter. The
- * associated filters are passed in as a bitmap (bit0 = filter0), except that
- * the value TZC_400_REGION_ATTR_FILTER_BIT_ALL selects all filters, based on
- * the value of tzc400.num_filters.
- * NOTE:
- * Region 0 is special; it is preferable to use tzc400_configure_region0
- * for this region (see comment for that function).
+ * Check the parameters of a region and return its filters, with
+ * TZC_400_REGION_ATTR_FILTER_BIT_ALL adjusted to the number of filters.
  */
-void tzc400_configure_region(unsigned int filters,
-			  unsigned int region,
-			  unsigned long long region_base,
-			  unsigned long long region_top,
-			  unsigned int sec_attr,
-			  unsigned int nsaid_permissions)
+static unsigned int tzc400_check_region(unsigned int filters,
+					unsigned int region,
+					unsigned long long region_base,
+					unsigned long long region_top,
+					unsigned int sec_attr)
 {
 	assert(tzc400.base != 0U);
 
@@ -267,18 +322,184 @@ void tzc400_configure_region(unsigned int filters,
 
 	assert(sec_attr <= TZC_REGION_S_RDWR);
 
+	return filters;
+}
+
+/*
+ * `tzc400_configure_region` is used to program regions into the TrustZone
+ * controller. A region can be associated with more than one filter. The
+ * associated filters are passed in as a bitmap (bit0 = filter0), except that
+ * the value TZC_400_REGION_ATTR_FILTER_BIT_ALL selects all filters, based on
+ * the value of tzc400.num_filters.
+ * NOTE:
+ * Region 0 is special; it is preferable to use tzc400_configure_region0
+ * for this region (see comment for that function).
+ */
+void tzc400_configure_region(unsigned int filters,
+			  unsigned int region,
+			  unsigned long long region_base,
+			  unsigned long long region_top,
+			  unsigned int sec_attr,
+			  unsigned int nsaid_permissions)
+{
+	filters = tzc400_check_region(filters, region, region_base, region_top,
+				      sec_attr);
+
 	_tzc400_configure_region(tzc400.base, filters, region, region_base,
 						region_top,
 						sec_attr, nsaid_permissions);
+
+	tzc400_shadow.hw[region] = (struct tzc400_region_regs){
+		.base = region_base,
+		.top = region_top,
+		.attr = (sec_attr << TZC_REGION_ATTR_SEC_SHIFT) |
+			(filters << TZC_REGION_ATTR_F_EN_SHIFT),
+		.id_access = nsaid_permissions,
+	};
 }
 
 void tzc400_update_filters(unsigned int region, unsigned int filters)
 {
+	unsigned int filters_mask = GENMASK(tzc400.num_filters - 1U, 0);
+
 	/* Do range checks on filters and regions. */
 	assert(((filters >> tzc400.num_filters) == 0U) &&
 	       (region < tzc400.num_regions));
 
 	_tzc400_update_filters(tzc400.base, region, tzc400.num_filters, filters);
+
+	tzc400_shadow.hw[region].attr &= ~(filters_mask <<
+					   TZC_REGION_ATTR_F_EN_SHIFT);
+	tzc400_shadow.hw[region].attr |= filters << TZC_REGION_ATTR_F_EN_SHIFT;
+}
+
+/*
+ * `tzc400_stage_region` records the new configuration of a region, to be
+ * programmed by the next `tzc400_commit_regions`. It takes the same parameters
+ * as `tzc400_configure_region`, except that region 0 can't be staged.
+ */
+void tzc400_stage_region(unsigned int filters,
+			 unsigned int region,
+			 unsigned long long region_base,
+			 unsigned long long region_top,
+			 unsigned int sec_attr,
+			 unsigned int nsaid_permissions)
+{
+	assert(region != 0U);
+
+	filters = tzc400_check_region(filters, region, region_base, region_top,
+				      sec_attr);
+
+	spin_lock(&tzc400_lock);
+
+	tzc400_shadow.staged[region] = (struct tzc400_region_regs){
+		.base = region_base,
+		.top = region_top,
+		.attr = (sec_attr << TZC_REGION_ATTR_SEC_SHIFT) |
+			(filters << TZC_REGION_ATTR_F_EN_SHIFT),
+		.id_access = nsaid_permissions,
+	};
+	tzc400_shadow.dirty |= BIT_32(region);
+
+	spin_unlock(&tzc400_lock);
+}
+
+/* Stage a region with no filter enabled and no access, so unused. */
+void tzc400_stage_region_disable(unsigned int region)
+{
+	assert((tzc400.base != 0U) && (region != 0U) &&
+	       (region < tzc400.num_regions));
+
+	spin_lock(&tzc400_lock);
+
+	tzc400_shadow.staged[region] = tzc400_shadow.hw[region];
+	tzc400_shadow.staged[region].attr = 0U;
+	tzc400_shadow.staged[region].id_access = 0U;
+	tzc400_shadow.dirty |= BIT_32(region);
+
+	spin_unlock(&tzc400_lock);
+}
+
+/*
+ * `tzc400_commit_regions` programs the staged regions that differ from the
+ * TZC, and only their registers that differ. The filters of these regions
+ * are closed for the time of the update, except filter 0 if it is open as it
+ * can't be closed (see `tzc400_disable_filters`). Returns the number of
+ * regions reprogrammed.
+ */
+unsigned int tzc400_commit_regions(void)
+{
+	struct tzc400_region_regs *hw, *staged;
+	unsigned int changed = 0U, gated = 0U, count = 0U;
+	unsigned int open_status, region;
+
+	assert(tzc400.base != 0U);
+
+	spin_lock(&tzc400_lock);
+
+	for (region = 1U; region < tzc400.num_regions; region++) {
+		hw = &tzc400_shadow.hw[region];
+		staged = &tzc400_shadow.staged[region];
+
+		if (((tzc400_shadow.dirty & BIT_32(region)) == 0U) ||
+		    ((hw->base == staged->base) && (hw->top == staged->top) &&
+		     (hw->attr == staged->attr) &&
+		     (hw->id_access == staged->id_access))) {
+			continue;
+		}
+
+		changed |= BIT_32(region);
+		gated |= (hw->attr | staged->attr) >> TZC_REGION_ATTR_F_EN_SHIFT;
+	}
+	tzc400_shadow.dirty = 0U;
+
+	if (changed == 0U) {
+		spin_unlock(&tzc400_lock);
+		return 0U;
+	}
+
+	open_status = get_gate_keeper_os(tzc400.base);
+	gated &= open_status & TZC_400_REGION_ATTR_F_EN_MASK & ~BIT_32(0);
+	if (gated != 0U) {
+		_tzc400_set_gate_keepers(tzc400.base, open_status & ~gated);
+	}
+
+	for (region = 1U; region < tzc400.num_regions; region++) {
+		if ((changed & BIT_32(region)) == 0U) {
+			continue;
+		}
+
+		hw = &tzc400_shadow.hw[region];
+		staged = &tzc400_shadow.staged[region];
+
+		if (hw->base != staged->base) {
+			_tzc400_write_region_base(tzc400.base, region,
+						  staged->base);
+		}
+		if (hw->top != staged->top) {
+			_tzc400_write_region_top(tzc400.base, region,
+						 staged->top);
+		}
+		if (hw->attr != staged->attr) {
+			_tzc400_write_region_attributes(tzc400.base, region,
+							staged->attr);
+		}
+		if (hw->id_access != staged->id_access) {
+			_tzc400_write_region_id_access(tzc400.base, region,
+						       staged->id_access);
+		}
+
+		*hw = *staged;
+		count++;
+	}
+
+	if (gated != 0U) {
+		_tzc400_set_gate_keepers(tzc400.base, open_status);
+	}
+
+	spin_unlock(&tzc400_lock);
+
+	return count;
 }
 
 void tzc400_enable_filters(void)
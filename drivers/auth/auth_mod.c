@@ -1,10 +1,12 @@
 /*
- * Copyright (c) 2015-2023, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
 #include <assert.h>
+#include <errno.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
 
@@ -27,6 +29,174 @@
 
 #pragma weak plat_set_nv_ctr2
 
+#if AUTH_IMG_CACHE
+#pragma weak plat_get_auth_img_cache
+
+#define AUTH_IMG_CACHE_MAGIC		U(0x43494d41)	/* "AMIC" */
+#define AUTH_IMG_CACHE_DIGEST_SIZE	32U
+
+/*
+ * A certificate which passed all its authentication methods. The entry is
+ * only valid for the exact same certificate content, signed by the exact
+ * same key (the parent's authenticated key or key hash, or the ROTPK), and
+ * as long as the platform NV counter has not moved since.
+ */
+typedef struct auth_img_cache_entry {
+	unsigned int img_id;
+	unsigned int nv_ctr;
+	unsigned char img_digest[AUTH_IMG_CACHE_DIGEST_SIZE];
+	unsigned char key_digest[AUTH_IMG_CACHE_DIGEST_SIZE];
+} auth_img_cache_entry_t;
+
+typedef struct auth_img_cache {
+	uint32_t magic;
+	uint32_t num_entries;
+	uint32_t next_entry;
+	uint32_t reserved;
+	auth_img_cache_entry_t entries[];
+} auth_img_cache_t;
+#endif /* AUTH_IMG_CACHE */
+
+#if MBOOT_REUSE_AUTH_DIGEST
+/*
+ * Digest calculated when the last image was authenticated by hash. It is
+ * only valid once the whole image passed authentication, and it is handed
+ * out at most once, to the measured boot backend measuring that image.
+ */
+static struct {
+	bool valid;
+	unsigned int img_id;
+	uintptr_t data_base;
+	size_t data_size;
+	enum crypto_md_algo alg;
+	unsigned char digest[CRYPTO_MD_MAX_SIZE];
+} auth_digest;
+#endif /* MBOOT_REUSE_AUTH_DIGEST */
+
+#if AUTH_PK_CACHE
+#ifdef PK_DER_LEN
+#define ROTPK_CACHE_PK_MAX	PK_DER_LEN
+#else
+#define ROTPK_CACHE_PK_MAX	550U
+#endif
+/* Room for the DigestInfo encoding of the largest supported hash */
+#define ROTPK_CACHE_HASH_MAX	(CRYPTO_MD_MAX_SIZE + 32U)
+
+/*
+ * Certificate public key last found to match the ROTPK hash returned by the
+ * platform. Root certificates carrying the same key, checked against the same
+ * hash, skip converting and hashing it again.
+ */
+static struct {
+	unsigned int pk_len;
+	unsigned int hash_len;
+	unsigned char pk[ROTPK_CACHE_PK_MAX];
+	unsigned char hash[ROTPK_CACHE_HASH_MAX];
+} rotpk_cache;
+
+static bool rotpk_cache_match(const void *pk_ptr, unsigned int pk_len,
+			      const void *hash_ptr, unsigned int hash_len)
+{
+	return (rotpk_cache.pk_len != 0U) && (rotpk_cache.pk_len == pk_len) &&
+	       (rotpk_cache.hash_len == hash_len) &&
+	       (memcmp(rotpk_cache.pk, pk_ptr, pk_len) == 0) &&
+	       (memcmp(rotpk_cache.hash, hash_ptr, hash_len) == 0);
+}
+
+static void rotpk_cache_store(const void *pk_ptr, unsigned int pk_len,
+			      const void *hash_ptr, unsigned int hash_len)
+{
+	if ((pk_len > sizeof(rotpk_cache.pk)) ||
+	    (hash_len > sizeof(rotpk_cache.hash))) {
+		return;
+	}
+
+	(void)memcpy(rotpk_cache.pk, pk_ptr, pk_len);
+	(void)memcpy(rotpk_cache.hash, hash_ptr, hash_len);
+	rotpk_cache.pk_len = pk_len;
+	rotpk_cache.hash_len = hash_len;
+}
+#endif /* AUTH_PK_CACHE */
+
+#if AUTH_NV_CTR_CACHE
+#ifndef AUTH_NV_CTR_CACHE_ENTRIES
+#define AUTH_NV_CTR_CACHE_ENTRIES	4U
+#endif
+
+/*
+ * Platform NV counters read during this boot stage. A counter raised by an
+ * authenticated certificate is only kept here, marked dirty, until
+ * auth_mod_flush_nv_ctrs() writes it back at the end of the stage.
+ */
+static struct {
+	void *cookie;
+	const auth_img_desc_t *img_desc;
+	unsigned int nv_ctr;
+	bool dirty;
+} nv_ctr_cache[AUTH_NV_CTR_CACHE_ENTRIES];
+static unsigned int nv_ctr_cache_num;
+
+static unsigned int nv_ctr_cache_find(const void *cookie)
+{
+	unsigned int i;
+
+	for (i = 0U; i < nv_ctr_cache_num; i++) {
+		if (nv_ctr_cache[i].cookie == cookie) {
+			break;
+		}
+	}
+
+	return i;
+}
+#endif /* AUTH_NV_CTR_CACHE */
+
+/* Read a platform NV counter, or its value cached during this stage */
+static int auth_get_plat_nv_ctr(void *cookie, unsigned int *nv_ctr)
+{
+#if AUTH_NV_CTR_CACHE
+	unsigned int i = nv_ctr_cache_find(cookie);
+	int rc;
+
+	if (i < nv_ctr_cache_num) {
+		*nv_ctr = nv_ctr_cache[i].nv_ctr;
+		return 0;
+	}
+
+	rc = plat_get_nv_ctr(cookie, nv_ctr);
+	if ((rc == 0) && (i < AUTH_NV_CTR_CACHE_ENTRIES)) {
+		nv_ctr_cache[i].cookie = cookie;
+		nv_ctr_cache[i].img_desc = NULL;
+		nv_ctr_cache[i].nv_ctr = *nv_ctr;
+		nv_ctr_cache[i].dirty = false;
+		nv_ctr_cache_num++;
+	}
+
+	return rc;
+#else
+	return plat_get_nv_ctr(cookie, nv_ctr);
+#endif
+}
+
+/*
+ * Upgrade a platform NV counter. With AUTH_NV_CTR_CACHE, the new value is only
+ * recorded, and later certificates of this stage are checked against it.
+ */
+static int auth_set_plat_nv_ctr(void *cookie, const auth_img_desc_t *img_desc,
+				unsigned int nv_ctr)
+{
+#if AUTH_NV_CTR_CACHE
+	unsigned int i = nv_ctr_cache_find(cookie);
+
+	if (i < nv_ctr_cache_num) {
+		nv_ctr_cache[i].img_desc = img_desc;
+		nv_ctr_cache[i].nv_ctr = nv_ctr;
+		nv_ctr_cache[i].dirty = true;
+		return 0;
+	}
+#endif
+	return plat_set_nv_ctr2(cookie, img_desc, nv_ctr);
+}
+
 static int cmp_auth_param_type_desc(const auth_param_type_desc_t *a,
 		const auth_param_type_desc_t *b)
 {
@@ -114,14 +284,73 @@ static int auth_hash(const auth_method_param_hash_t *param,
 	}
 
 	/* Ask the crypto module to verify this hash */
+#if MBOOT_REUSE_AUTH_DIGEST
+	rc = crypto_mod_verify_hash_digest(data_ptr, data_len,
+					   hash_der_ptr, hash_der_len,
+					   &auth_digest.alg,
+					   auth_digest.digest);
+#else
 	rc = crypto_mod_verify_hash(data_ptr, data_len,
 				    hash_der_ptr, hash_der_len);
+#endif
 	if (rc != 0) {
 		VERBOSE("[TBB] %s():%d failed with error code %d.\n",
 			__func__, __LINE__, rc);
 		return rc;
 	}
 
+#if MBOOT_REUSE_AUTH_DIGEST
+	auth_digest.img_id = img_desc->img_id;
+	auth_digest.data_base = (uintptr_t)data_ptr;
+	auth_digest.data_size = data_len;
+#endif
+
+	return 0;
+}
+
+/*
+ * Check that the hash of a certificate's public key matches the ROTPK hash
+ * provided by the platform.
+ */
+static int verify_rotpk_hash(void *pk_ptr, unsigned int pk_len,
+			     void *hash_ptr, unsigned int hash_len)
+{
+	void *cnv_pk_ptr;
+	unsigned int cnv_pk_len;
+	int rc;
+
+#if AUTH_PK_CACHE
+	if (rotpk_cache_match(pk_ptr, pk_len, hash_ptr, hash_len)) {
+		return 0;
+	}
+#endif
+
+	/*
+	 * platform may store the hash of a prefixed,
+	 * suffixed or modified pk
+	 */
+	rc = crypto_mod_convert_pk(pk_ptr, pk_len, &cnv_pk_ptr, &cnv_pk_len);
+	if (rc != 0) {
+		VERBOSE("[TBB] %s():%d failed with error code %d.\n",
+			__func__, __LINE__, rc);
+		return rc;
+	}
+
+	/*
+	 * The hash of the certificate's public key must match
+	 * the hash of the ROTPK.
+	 */
+	rc = crypto_mod_verify_hash(cnv_pk_ptr, cnv_pk_len, hash_ptr, hash_len);
+	if (rc != 0) {
+		VERBOSE("[TBB] %s():%d failed with error code %d.\n",
+			__func__, __LINE__, rc);
+		return rc;
+	}
+
+#if AUTH_PK_CACHE
+	rotpk_cache_store(pk_ptr, pk_len, hash_ptr, hash_len);
+#endif
+
 	return 0;
 }
 
@@ -156,8 +385,8 @@ static int auth_signature(const auth_method_param_sig_t *param,
 			  const auth_img_desc_t *img_desc,
 			  void *img, unsigned int img_len)
 {
-	void *data_ptr, *pk_ptr, *cnv_pk_ptr, *pk_plat_ptr, *sig_ptr, *sig_alg_ptr, *pk_oid;
-	unsigned int data_len, pk_len, cnv_pk_len, pk_plat_len, sig_len, sig_alg_len;
+	void *data_ptr, *pk_ptr, *pk_plat_ptr, *sig_ptr, *sig_alg_ptr, *pk_oid;
+	unsigned int data_len, pk_len, pk_plat_len, sig_len, sig_alg_len;
 	unsigned int flags = 0;
 	int rc;
 
@@ -236,26 +465,9 @@ static int auth_signature(const auth_method_param_sig_t *param,
 			NOTICE("ROTPK is not deployed on platform. "
 				"Skipping ROTPK verification.\n");
 		} else if ((flags & ROTPK_IS_HASH) != 0U) {
-			/*
-			 * platform may store the hash of a prefixed,
-			 * suffixed or modified pk
-			 */
-			rc = crypto_mod_convert_pk(pk_ptr, pk_len, &cnv_pk_ptr, &cnv_pk_len);
-			if (rc != 0) {
-				VERBOSE("[TBB] %s():%d failed with error code %d.\n",
-					__func__, __LINE__, rc);
-				return rc;
-			}
-
-			/*
-			 * The hash of the certificate's public key must match
-			 * the hash of the ROTPK.
-			 */
-			rc = crypto_mod_verify_hash(cnv_pk_ptr, cnv_pk_len,
-						    pk_plat_ptr, pk_plat_len);
+			rc = verify_rotpk_hash(pk_ptr, pk_len, pk_plat_ptr,
+					       pk_plat_len);
 			if (rc != 0) {
-				VERBOSE("[TBB] %s():%d failed with error code %d.\n",
-					__func__, __LINE__, rc);
 				return rc;
 			}
 		} else {
@@ -375,7 +587,7 @@ static int auth_nvctr(const auth_method_param_nv_ctr_t *param,
 	}
 
 	/* Get the counter from the platform */
-	rc = plat_get_nv_ctr(param->plat_nv_ctr->cookie, &plat_nv_ctr);
+	rc = auth_get_plat_nv_ctr(param->plat_nv_ctr->cookie, &plat_nv_ctr);
 	if (rc != 0) {
 		VERBOSE("[TBB] %s():%d failed with error code %d.\n",
 			__func__, __LINE__, rc);
@@ -406,6 +618,199 @@ int plat_set_nv_ctr2(void *cookie, const auth_img_desc_t *img_desc __unused,
 	return plat_set_nv_ctr(cookie, nv_ctr);
 }
 
+#if AUTH_IMG_CACHE
+int plat_get_auth_img_cache(uintptr_t *cache_base __unused,
+			    size_t *cache_size __unused)
+{
+	return -1;
+}
+
+/*
+ * Return the verified image cache provided by the platform, resetting it
+ * if it does not hold a valid cache yet.
+ */
+static auth_img_cache_t *auth_img_cache_get(unsigned int *max_entries)
+{
+	auth_img_cache_t *cache;
+	uintptr_t cache_base;
+	size_t cache_size;
+
+	if (plat_get_auth_img_cache(&cache_base, &cache_size) != 0) {
+		return NULL;
+	}
+
+	if ((cache_size < (sizeof(auth_img_cache_t) +
+			   sizeof(auth_img_cache_entry_t))) ||
+	    ((cache_base % sizeof(uint32_t)) != 0U)) {
+		return NULL;
+	}
+
+	cache = (auth_img_cache_t *)cache_base;
+	*max_entries = (cache_size - sizeof(auth_img_cache_t)) /
+		       sizeof(auth_img_cache_entry_t);
+
+	if ((cache->magic != AUTH_IMG_CACHE_MAGIC) ||
+	    (cache->num_entries > *max_entries) ||
+	    (cache->next_entry >= *max_entries)) {
+		(void)memset(cache, 0, sizeof(auth_img_cache_t));
+		cache->magic = AUTH_IMG_CACHE_MAGIC;
+	}
+
+	return cache;
+}
+
+static const auth_method_desc_t *auth_img_get_method(
+				const auth_img_desc_t *img_desc,
+				auth_method_type_t type)
+{
+	int i;
+
+	for (i = 0 ; i < AUTH_METHOD_NUM ; i++) {
+		if (img_desc->img_auth_methods[i].type == type) {
+			return &img_desc->img_auth_methods[i];
+		}
+	}
+
+	return NULL;
+}
+
+/*
+ * Build the cache entry describing a certificate and the key it has to be
+ * signed with. Only images authenticated by signature are worth caching.
+ *
+ * Return: 0 = the image can be cached, Otherwise = it cannot
+ */
+static int auth_img_cache_prepare(const auth_img_desc_t *img_desc,
+				  void *img_ptr, unsigned int img_len,
+				  auth_img_cache_entry_t *entry)
+{
+	unsigned char digest[CRYPTO_MD_MAX_SIZE];
+	const auth_method_desc_t *sig_method;
+	void *key_ptr;
+	unsigned int key_len, flags;
+	int rc;
+
+	sig_method = auth_img_get_method(img_desc, AUTH_METHOD_SIG);
+	if (sig_method == NULL) {
+		return 1;
+	}
+
+	if (img_desc->parent != NULL) {
+		rc = auth_get_param(sig_method->param.sig.pk, img_desc->parent,
+				    &key_ptr, &key_len);
+	} else {
+		rc = plat_get_rotpk_info(sig_method->param.sig.pk->cookie,
+					 &key_ptr, &key_len, &flags);
+		if ((rc == 0) && ((flags & ROTPK_NOT_DEPLOYED) != 0U)) {
+			rc = 1;
+		}
+	}
+	if (rc != 0) {
+		return rc;
+	}
+
+	rc = crypto_mod_calc_hash(CRYPTO_MD_SHA256, key_ptr, key_len, digest);
+	if (rc != 0) {
+		return rc;
+	}
+	(void)memcpy(entry->key_digest, digest, AUTH_IMG_CACHE_DIGEST_SIZE);
+
+	rc = crypto_mod_calc_hash(CRYPTO_MD_SHA256, img_ptr, img_len, digest);
+	if (rc != 0) {
+		return rc;
+	}
+	(void)memcpy(entry->img_digest, digest, AUTH_IMG_CACHE_DIGEST_SIZE);
+
+	entry->img_id = img_desc->img_id;
+	entry->nv_ctr = 0U;
+
+	return 0;
+}
+
+/*
+ * Look for a previously verified copy of a certificate.
+ *
+ * Return: true = the certificate is known to pass authentication
+ */
+static bool auth_img_cache_lookup(const auth_img_desc_t *img_desc,
+				  const auth_img_cache_entry_t *entry)
+{
+	const auth_method_desc_t *nv_method;
+	auth_img_cache_t *cache;
+	unsigned int max_entries, plat_nv_ctr, i;
+
+	cache = auth_img_cache_get(&max_entries);
+	if (cache == NULL) {
+		return false;
+	}
+
+	for (i = 0U; i < cache->num_entries; i++) {
+		const auth_img_cache_entry_t *e = &cache->entries[i];
+
+		if ((e->img_id == entry->img_id) &&
+		    (memcmp(e->img_digest, entry->img_digest,
+			    AUTH_IMG_CACHE_DIGEST_SIZE) == 0) &&
+		    (memcmp(e->key_digest, entry->key_digest,
+			    AUTH_IMG_CACHE_DIGEST_SIZE) == 0)) {
+			break;
+		}
+	}
+	if (i == cache->num_entries) {
+		return false;
+	}
+
+	/*
+	 * A certificate whose counter no longer matches the platform counter
+	 * goes through the full verification again, which either rejects it
+	 * or upgrades the platform counter.
+	 */
+	nv_method = auth_img_get_method(img_desc, AUTH_METHOD_NV_CTR);
+	if (nv_method != NULL) {
+		if (auth_get_plat_nv_ctr(
+			nv_method->param.nv_ctr.plat_nv_ctr->cookie,
+			&plat_nv_ctr) != 0) {
+			return false;
+		}
+		if (plat_nv_ctr != cache->entries[i].nv_ctr) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+static void auth_img_cache_insert(const auth_img_cache_entry_t *entry,
+				  unsigned int nv_ctr)
+{
+	auth_img_cache_t *cache;
+	unsigned int max_entries, i;
+
+	cache = auth_img_cache_get(&max_entries);
+	if (cache == NULL) {
+		return;
+	}
+
+	/* Replace any stale entry for the same image */
+	for (i = 0U; i < cache->num_entries; i++) {
+		if (cache->entries[i].img_id == entry->img_id) {
+			break;
+		}
+	}
+
+	if (i == cache->num_entries) {
+		if (cache->num_entries < max_entries) {
+			cache->num_entries++;
+		} else {
+			i = cache->next_entry;
+			cache->next_entry = (i + 1U) % max_entries;
+		}
+	}
+
+	cache->entries[i] = *entry;
+	cache->entries[i].nv_ctr = nv_ctr;
+}
+#endif /* AUTH_IMG_CACHE */
+
 /*
  * Return the parent id in the output parameter '*parent_id'
  *
@@ -449,40 +854,22 @@ void auth_mod_init(void)
 }
 
 /*
- * Authenticate a certificate/image
+ * Authenticate a certificate/image using the methods indicated in its image
+ * descriptor and upgrade the platform NV counter if needed. The certificate
+ * NV counter is returned in '*cert_nv_ctr'.
  *
  * Return: 0 = success, Otherwise = error
  */
-int auth_mod_verify_img(unsigned int img_id,
-			void *img_ptr,
-			unsigned int img_len)
+static int auth_img_run_methods(const auth_img_desc_t *img_desc,
+				void *img_ptr, unsigned int img_len,
+				unsigned int *cert_nv_ctr)
 {
-	const auth_img_desc_t *img_desc = NULL;
-	const auth_param_type_desc_t *type_desc = NULL;
 	const auth_method_desc_t *auth_method = NULL;
-	void *param_ptr;
-	unsigned int param_len;
 	int rc, i;
-	unsigned int cert_nv_ctr = 0;
 	bool need_nv_ctr_upgrade = false;
 	bool sig_auth_done = false;
 	const auth_method_param_nv_ctr_t *nv_ctr_param = NULL;
 
-	/* Get the image descriptor from the chain of trust */
-	img_desc = FCONF_GET_PROPERTY(tbbr, cot, img_id);
-
-	/* Ask the parser to check the image integrity */
-	rc = img_parser_check_integrity(img_desc->img_type, img_ptr, img_len);
-	if (rc != 0) {
-		VERBOSE("[TBB] %s():%d failed with error code %d.\n",
-			__func__, __LINE__, rc);
-		return rc;
-	}
-
-	/* Authenticate the image using the methods indicated in the image
-	 * descriptor. */
-	if (img_desc->img_auth_methods == NULL)
-		return 1;
 	for (i = 0 ; i < AUTH_METHOD_NUM ; i++) {
 		auth_method = &img_desc->img_auth_methods[i];
 		switch (auth_method->type) {
@@ -502,7 +889,7 @@ int auth_mod_verify_img(unsigned int img_id,
 			nv_ctr_param = &auth_method->param.nv_ctr;
 			rc = auth_nvctr(nv_ctr_param,
 					img_desc, img_ptr, img_len,
-					&cert_nv_ctr, &need_nv_ctr_upgrade);
+					cert_nv_ctr, &need_nv_ctr_upgrade);
 			break;
 		default:
 			/* Unknown authentication method */
@@ -521,8 +908,8 @@ int auth_mod_verify_img(unsigned int img_id,
 	 * authenticated, and platform NV-counter upgrade is needed.
 	 */
 	if (need_nv_ctr_upgrade && sig_auth_done) {
-		rc = plat_set_nv_ctr2(nv_ctr_param->plat_nv_ctr->cookie,
-				      img_desc, cert_nv_ctr);
+		rc = auth_set_plat_nv_ctr(nv_ctr_param->plat_nv_ctr->cookie,
+					  img_desc, *cert_nv_ctr);
 		if (rc != 0) {
 			VERBOSE("[TBB] %s():%d failed with error code %d.\n",
 				__func__, __LINE__, rc);
@@ -530,6 +917,80 @@ int auth_mod_verify_img(unsigned int img_id,
 		}
 	}
 
+	return 0;
+}
+
+/*
+ * Authenticate a certificate/image
+ *
+ * Return: 0 = success, Otherwise = error
+ */
+int auth_mod_verify_img(unsigned int img_id,
+			void *img_ptr,
+			unsigned int img_len)
+{
+	const auth_img_desc_t *img_desc = NULL;
+	const auth_param_type_desc_t *type_desc = NULL;
+	void *param_ptr;
+	unsigned int param_len;
+	int rc, i;
+	unsigned int cert_nv_ctr = 0;
+	bool verified = false;
+#if AUTH_IMG_CACHE
+	auth_img_cache_entry_t cache_entry;
+	bool cacheable;
+#endif
+
+#if MBOOT_REUSE_AUTH_DIGEST
+	auth_digest.valid = false;
+	auth_digest.img_id = INVALID_IMAGE_ID;
+#endif
+
+	/* Get the image descriptor from the chain of trust */
+	img_desc = FCONF_GET_PROPERTY(tbbr, cot, img_id);
+
+	/* Ask the parser to check the image integrity */
+	rc = img_parser_check_integrity(img_desc->img_type, img_ptr, img_len);
+	if (rc != 0) {
+		VERBOSE("[TBB] %s():%d failed with error code %d.\n",
+			__func__, __LINE__, rc);
+		return rc;
+	}
+
+	/* Authenticate the image using the methods indicated in the image
+	 * descriptor. */
+	if (img_desc->img_auth_methods == NULL)
+		return 1;
+
+#if AUTH_IMG_CACHE
+	/*
+	 * A certificate already verified against the same key, e.g. before a
+	 * warm reset or a firmware update retry, does not need its signature
+	 * checked again.
+	 */
+	cacheable = (auth_img_cache_prepare(img_desc, img_ptr, img_len,
+					    &cache_entry) == 0);
+	if (cacheable && auth_img_cache_lookup(img_desc, &cache_entry)) {
+		VERBOSE("[TBB] Image %u found in verified image cache\n",
+			img_id);
+		verified = true;
+	}
+#endif /* AUTH_IMG_CACHE */
+
+	if (!verified) {
+		rc = auth_img_run_methods(img_desc, img_ptr, img_len,
+					  &cert_nv_ctr);
+		if (rc != 0) {
+			return rc;
+		}
+
+#if AUTH_IMG_CACHE
+		if (cacheable) {
+			auth_img_cache_insert(&cache_entry, cert_nv_ctr);
+		}
+#endif /* AUTH_IMG_CACHE */
+	}
+
 	/* Extract the parameters indicated in the image descriptor to
 	 * authenticate the children images. */
 	if (img_desc->authenticated_data != NULL) {
@@ -577,5 +1038,67 @@ int auth_mod_verify_img(unsigned int img_id,
 	/* Mark image as authenticated */
 	auth_img_flags[img_desc->img_id] |= IMG_FLAG_AUTHENTICATED;
 
+#if MBOOT_REUSE_AUTH_DIGEST
+	auth_digest.valid = (auth_digest.img_id == img_id);
+#endif
+
+	return 0;
+}
+
+#if MBOOT_REUSE_AUTH_DIGEST
+/*
+ * Return the digest calculated when authenticating image 'img_id', provided
+ * it covers exactly the 'data_size' bytes at 'data_base' with algorithm 'alg'.
+ * The digest can only be retrieved once.
+ *
+ * Return: 0 = success, -ENOENT = the data has to be hashed again
+ */
+int auth_mod_get_img_digest(unsigned int img_id, uintptr_t data_base,
+			    size_t data_size, enum crypto_md_algo alg,
+			    unsigned char digest[CRYPTO_MD_MAX_SIZE])
+{
+	if (!auth_digest.valid || (auth_digest.img_id != img_id) ||
+	    (auth_digest.data_base != data_base) ||
+	    (auth_digest.data_size != data_size) ||
+	    (auth_digest.alg != alg)) {
+		return -ENOENT;
+	}
+
+	(void)memcpy(digest, auth_digest.digest, CRYPTO_MD_MAX_SIZE);
+	auth_digest.valid = false;
+
+	return 0;
+}
+#endif /* MBOOT_REUSE_AUTH_DIGEST */
+
+#if AUTH_NV_CTR_CACHE
+/*
+ * Write the NV counters raised during this stage back to the platform, once
+ * each. The cache is then emptied so that later reads return the value the
+ * platform actually stored.
+ *
+ * Return: 0 = success, Otherwise = error
+ */
+int auth_mod_flush_nv_ctrs(void)
+{
+	int rc;
+
+	for (unsigned int i = 0U; i < nv_ctr_cache_num; i++) {
+		if (!nv_ctr_cache[i].dirty) {
+			continue;
+		}
+
+		rc = plat_set_nv_ctr2(nv_ctr_cache[i].cookie,
+				      nv_ctr_cache[i].img_desc,
+				      nv_ctr_cache[i].nv_ctr);
+		if (rc != 0) {
+			return rc;
+		}
+		nv_ctr_cache[i].dirty = false;
+	}
+
+	nv_ctr_cache_num = 0U;
+
 	return 0;
 }
+#endif /* AUTH_NV_CTR_CACHE */
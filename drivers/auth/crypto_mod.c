@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015-2023, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -187,3 +187,163 @@ int crypto_mod_auth_decrypt(enum crypto_dec_algo dec_algo, void *data_ptr,
 					    key_len, key_flags, iv, iv_len, tag,
 					    tag_len);
 }
+
+#if LOAD_IMAGE_STREAM_HASH
+/*
+ * Start hashing an image as it is loaded
+ */
+int crypto_mod_hash_stream_start(void)
+{
+	return crypto_hash_stream_desc.start();
+}
+
+/*
+ * Hash the next chunk of the image being loaded
+ *
+ * Parameters:
+ *
+ *   data_ptr, data_len: chunk following the previous one in memory
+ */
+int crypto_mod_hash_stream_update(void *data_ptr, unsigned int data_len)
+{
+	assert(data_ptr != NULL);
+	assert(data_len != 0U);
+
+	return crypto_hash_stream_desc.update(data_ptr, data_len);
+}
+
+/*
+ * Finalise the digest of the image that has been loaded
+ */
+int crypto_mod_hash_stream_finish(void)
+{
+	return crypto_hash_stream_desc.finish();
+}
+
+/*
+ * Discard the digest of the last loaded image
+ */
+void crypto_mod_hash_stream_discard(void)
+{
+	crypto_hash_stream_desc.discard();
+}
+#endif /* LOAD_IMAGE_STREAM_HASH */
+
+#if MBOOT_REUSE_AUTH_DIGEST
+/*
+ * Verify a hash and return the digest calculated to do so
+ *
+ * Parameters:
+ *
+ *   data_ptr, data_len: signed data
+ *   digest_info_ptr, digest_info_len: hash to be compared
+ *   alg, digest: algorithm and digest of the data, only valid on success
+ */
+int crypto_mod_verify_hash_digest(void *data_ptr, unsigned int data_len,
+				  void *digest_info_ptr,
+				  unsigned int digest_info_len,
+				  enum crypto_md_algo *alg,
+				  unsigned char digest[CRYPTO_MD_MAX_SIZE])
+{
+	assert(data_ptr != NULL);
+	assert(data_len != 0);
+	assert(digest_info_ptr != NULL);
+	assert(digest_info_len != 0);
+	assert(alg != NULL);
+	assert(digest != NULL);
+
+	return crypto_auth_digest_desc.verify_hash(data_ptr, data_len,
+						   digest_info_ptr,
+						   digest_info_len, alg,
+						   digest);
+}
+#endif /* MBOOT_REUSE_AUTH_DIGEST */
+
+#ifdef CRYPTO_MULTI_HASH
+/*
+ * Calculate the hashes of the same data with several algorithms
+ *
+ * Parameters:
+ *
+ *   algs, num: message digest algorithms, at most CRYPTO_MULTI_HASH_MAX
+ *   data_ptr, data_len: data to be hashed
+ *   outputs: resulting hashes, in the order of 'algs'
+ */
+int crypto_mod_calc_hashes(const enum crypto_md_algo *algs, unsigned int num,
+			   void *data_ptr, unsigned int data_len,
+			   unsigned char (*outputs)[CRYPTO_MD_MAX_SIZE])
+{
+	assert(algs != NULL);
+	assert((num != 0U) && (num <= CRYPTO_MULTI_HASH_MAX));
+	assert(data_ptr != NULL);
+	assert(data_len != 0U);
+	assert(outputs != NULL);
+
+	return crypto_multi_hash_desc.calc_hashes(algs, num, data_ptr,
+						  data_len, outputs);
+}
+#endif /* CRYPTO_MULTI_HASH */
+
+#if DECRYPTION_STREAM
+/*
+ * Start the authenticated decryption of an image read in chunks
+ *
+ * Parameters:
+ *
+ *   dec_algo: authenticated decryption algorithm
+ *   key, key_len, key_flags: symmetric decryption key, it can be wiped as
+ *                            soon as this function returns
+ *   iv, iv_len: initialization vector
+ */
+int crypto_mod_dec_stream_start(enum crypto_dec_algo dec_algo,
+				const void *key, unsigned int key_len,
+				unsigned int key_flags, const void *iv,
+				unsigned int iv_len)
+{
+	assert(key != NULL);
+	assert(key_len != 0U);
+	assert(iv != NULL);
+	assert((iv_len != 0U) && (iv_len <= CRYPTO_MAX_IV_SIZE));
+
+	return crypto_dec_stream_desc.start(dec_algo, key, key_len, key_flags,
+					    iv, iv_len);
+}
+
+/*
+ * Decrypt the next chunk of the image in place
+ *
+ * Parameters:
+ *
+ *   data_ptr, len: chunk following the previous one in the image
+ */
+int crypto_mod_dec_stream_update(void *data_ptr, size_t len)
+{
+	assert(data_ptr != NULL);
+	assert(len != 0U);
+
+	return crypto_dec_stream_desc.update(data_ptr, len);
+}
+
+/*
+ * Check the authentication tag of the decrypted image
+ *
+ * Parameters:
+ *
+ *   tag, tag_len: authentication tag
+ */
+int crypto_mod_dec_stream_finish(const void *tag, unsigned int tag_len)
+{
+	assert(tag != NULL);
+	assert((tag_len != 0U) && (tag_len <= CRYPTO_MAX_TAG_SIZE));
+
+	return crypto_dec_stream_desc.finish(tag, tag_len);
+}
+
+/*
+ * Abandon the decryption in progress
+ */
+void crypto_mod_dec_stream_discard(void)
+{
+	crypto_dec_stream_desc.discard();
+}
+#endif /* DECRYPTION_STREAM */
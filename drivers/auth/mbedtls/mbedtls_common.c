@@ -1,11 +1,13 @@
 /*
- * Copyright (c) 2015-2023, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
 #include <assert.h>
 #include <stddef.h>
+#include <stdint.h>
+#include <string.h>
 
 /* mbed TLS headers */
 #include <mbedtls/memory_buffer_alloc.h>
@@ -14,9 +16,110 @@
 
 #include <common/debug.h>
 #include <drivers/auth/mbedtls/mbedtls_common.h>
+#include <lib/utils_def.h>
 
 #include <plat/common/platform.h>
 
+#if TF_MBEDTLS_HEAP_ARENA
+/*
+ * Bump pointer allocator for the Mbed TLS heap. Everything allocated for a
+ * verification is freed by the time the crypto library returns, so instead of
+ * keeping free lists the whole arena is reset as soon as no allocation is live
+ * any more. Freeing the most recent allocation gives its space back straight
+ * away, which covers the grow and release pattern of the bignum code.
+ */
+#define ARENA_ALIGN		U(16)
+
+/* Header in front of each allocation */
+struct arena_block {
+	size_t size;
+} __aligned(ARENA_ALIGN);
+
+static struct {
+	uintptr_t base;
+	size_t size;
+	size_t used;
+	size_t peak;
+	size_t reported_peak;
+	unsigned int live;
+} arena;
+
+static void *arena_calloc(size_t n, size_t size)
+{
+	struct arena_block *block;
+	size_t total;
+
+	if ((size != 0U) && (n > (SIZE_MAX / size))) {
+		return NULL;
+	}
+
+	size *= n;
+	if (size > (arena.size - arena.used)) {
+		return NULL;
+	}
+
+	total = sizeof(*block) + round_up(size, ARENA_ALIGN);
+	if (total > (arena.size - arena.used)) {
+		return NULL;
+	}
+
+	block = (struct arena_block *)(arena.base + arena.used);
+	block->size = size;
+	arena.used += total;
+	arena.live++;
+
+	if (arena.used > arena.peak) {
+		arena.peak = arena.used;
+	}
+
+	(void)memset(block + 1, 0, size);
+
+	return block + 1;
+}
+
+static void arena_free(void *ptr)
+{
+	struct arena_block *block;
+
+	if (ptr == NULL) {
+		return;
+	}
+
+	block = (struct arena_block *)ptr - 1;
+	assert(arena.live != 0U);
+	arena.live--;
+
+	if (arena.live == 0U) {
+		arena.used = 0U;
+
+		/* Report each new high-water mark to help sizing the heap */
+		if (arena.peak > arena.reported_peak) {
+			INFO("Mbed TLS heap peak use: %zu of %zu bytes\n",
+			     arena.peak, arena.size);
+			arena.reported_peak = arena.peak;
+		}
+	} else if (((uintptr_t)ptr + round_up(block->size, ARENA_ALIGN)) ==
+		   (arena.base + arena.used)) {
+		arena.used = (uintptr_t)block - arena.base;
+	}
+}
+
+static void arena_init(void *heap_addr, size_t heap_size)
+{
+	uintptr_t base = round_up((uintptr_t)heap_addr, ARENA_ALIGN);
+
+	assert(heap_size > (base - (uintptr_t)heap_addr));
+
+	arena.base = base;
+	arena.size = round_down(heap_size - (base - (uintptr_t)heap_addr),
+				ARENA_ALIGN);
+
+	if (mbedtls_platform_set_calloc_free(arena_calloc, arena_free) != 0) {
+		panic();
+	}
+}
+#endif /* TF_MBEDTLS_HEAP_ARENA */
+
 static void cleanup(void)
 {
 	ERROR("EXIT from BL2\n");
@@ -47,7 +150,11 @@ void mbedtls_init(void)
 		assert(heap_size >= TF_MBEDTLS_HEAP_SIZE);
 
 		/* Initialize the mbed TLS heap */
+#if TF_MBEDTLS_HEAP_ARENA
+		arena_init(heap_addr, heap_size);
+#else
 		mbedtls_memory_buffer_alloc_init(heap_addr, heap_size);
+#endif
 
 #ifdef MBEDTLS_PLATFORM_SNPRINTF_ALT
 		mbedtls_platform_set_snprintf(snprintf);
@@ -1,5 +1,5 @@
 #
-# Copyright (c) 2015-2024, Arm Limited. All rights reserved.
+# Copyright (c) 2015-2026, Arm Limited. All rights reserved.
 #
 # SPDX-License-Identifier: BSD-3-Clause
 #
@@ -127,6 +127,14 @@ else ifeq (${MBOOT_EL_HASH_ALG}, sha512)
     $(eval $(call add_define,TF_MBEDTLS_MBOOT_USE_SHA512))
 endif
 
+ifeq (${MBOOT_EL_HASH_ALG_EXTRA}, sha256)
+    $(eval $(call add_define,TF_MBEDTLS_MBOOT_USE_SHA256))
+else ifeq (${MBOOT_EL_HASH_ALG_EXTRA}, sha384)
+    $(eval $(call add_define,TF_MBEDTLS_MBOOT_USE_SHA384))
+else ifeq (${MBOOT_EL_HASH_ALG_EXTRA}, sha512)
+    $(eval $(call add_define,TF_MBEDTLS_MBOOT_USE_SHA512))
+endif
+
 ifeq (${TF_MBEDTLS_KEY_ALG},ecdsa)
     TF_MBEDTLS_KEY_ALG_ID	:=	TF_MBEDTLS_ECDSA
 else ifeq (${TF_MBEDTLS_KEY_ALG},rsa)
@@ -137,6 +145,24 @@ else
     $(error "TF_MBEDTLS_KEY_ALG=${TF_MBEDTLS_KEY_ALG} not supported on mbed TLS")
 endif
 
+# Replace the Mbed TLS buffer allocator with a bump pointer arena which is
+# reset whenever no allocation is live
+TF_MBEDTLS_HEAP_ARENA	?=	0
+$(eval $(call assert_boolean,TF_MBEDTLS_HEAP_ARENA))
+
+# The PSA key store and the parsed key cache keep allocations live for the
+# whole boot
+ifeq (${TF_MBEDTLS_HEAP_ARENA}-${PSA_CRYPTO},1-1)
+    $(error "TF_MBEDTLS_HEAP_ARENA is not supported with PSA_CRYPTO")
+endif
+ifeq (${TF_MBEDTLS_HEAP_ARENA}-${AUTH_PK_CACHE},1-1)
+    $(error "TF_MBEDTLS_HEAP_ARENA is not supported with AUTH_PK_CACHE")
+endif
+
+# Use the NIST curve specific modular reduction of Mbed TLS for ECDSA
+TF_MBEDTLS_ECP_NIST_OPTIM	?=	0
+$(eval $(call assert_boolean,TF_MBEDTLS_ECP_NIST_OPTIM))
+
 ifeq (${DECRYPTION_SUPPORT}, aes_gcm)
     TF_MBEDTLS_USE_AES_GCM	:=	1
 else
@@ -146,9 +172,11 @@ endif
 # Needs to be set to drive mbed TLS configuration correctly
 $(eval $(call add_defines,\
     $(sort \
+        TF_MBEDTLS_ECP_NIST_OPTIM \
         TF_MBEDTLS_KEY_ALG_ID \
         TF_MBEDTLS_KEY_SIZE \
         TF_MBEDTLS_HASH_ALG_ID \
+        TF_MBEDTLS_HEAP_ARENA \
         TF_MBEDTLS_USE_AES_GCM \
 )))
 
@@ -1,10 +1,11 @@
 /*
- * Copyright (c) 2015-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
 #include <assert.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <string.h>
 
@@ -18,8 +19,14 @@
 #include <mbedtls/x509.h>
 
 #include <common/debug.h>
+#if AUTH_PK_CACHE
+#include <common/tbbr/cot_def.h>
+#endif
 #include <drivers/auth/crypto_mod.h>
 #include <drivers/auth/mbedtls/mbedtls_common.h>
+#if ENABLE_FEAT_SHA256
+#include <drivers/auth/sha256_ce.h>
+#endif
 
 #include <plat/common/platform.h>
 
@@ -37,6 +44,136 @@ CASSERT(CRYPTO_MD_MAX_SIZE >= MBEDTLS_MD_MAX_SIZE,
 #endif /* CRYPTO_SUPPORT == CRYPTO_HASH_CALC_ONLY || \
 	  CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_AND_HASH_CALC */
 
+#if LOAD_IMAGE_STREAM_HASH
+#if TF_MBEDTLS_HASH_ALG_ID == TF_MBEDTLS_SHA256
+#define HASH_STREAM_MD_TYPE	MBEDTLS_MD_SHA256
+#elif TF_MBEDTLS_HASH_ALG_ID == TF_MBEDTLS_SHA384
+#define HASH_STREAM_MD_TYPE	MBEDTLS_MD_SHA384
+#elif TF_MBEDTLS_HASH_ALG_ID == TF_MBEDTLS_SHA512
+#define HASH_STREAM_MD_TYPE	MBEDTLS_MD_SHA512
+#endif
+
+/* Digest of the last image hashed while it was loaded */
+static struct {
+	mbedtls_md_context_t ctx;
+	bool in_progress;
+	bool valid;
+	const unsigned char *base;
+	size_t len;
+	unsigned char digest[MBEDTLS_MD_MAX_SIZE];
+} hash_stream;
+
+static void hash_stream_discard(void)
+{
+	if (hash_stream.in_progress) {
+		mbedtls_md_free(&hash_stream.ctx);
+	}
+
+	hash_stream.in_progress = false;
+	hash_stream.valid = false;
+}
+
+static int hash_stream_start(void)
+{
+	const mbedtls_md_info_t *md_info;
+
+	hash_stream_discard();
+
+	md_info = mbedtls_md_info_from_type(HASH_STREAM_MD_TYPE);
+	if (md_info == NULL) {
+		return CRYPTO_ERR_HASH;
+	}
+
+	mbedtls_md_init(&hash_stream.ctx);
+	hash_stream.in_progress = true;
+
+	if ((mbedtls_md_setup(&hash_stream.ctx, md_info, 0) != 0) ||
+	    (mbedtls_md_starts(&hash_stream.ctx) != 0)) {
+		hash_stream_discard();
+		return CRYPTO_ERR_HASH;
+	}
+
+	hash_stream.base = NULL;
+	hash_stream.len = 0U;
+
+	return CRYPTO_SUCCESS;
+}
+
+static int hash_stream_update(void *data_ptr, unsigned int data_len)
+{
+	const unsigned char *data = data_ptr;
+
+	if (!hash_stream.in_progress) {
+		return CRYPTO_ERR_HASH;
+	}
+
+	/* The digest only describes a single contiguous buffer */
+	if (hash_stream.base == NULL) {
+		hash_stream.base = data;
+	} else if (data != (hash_stream.base + hash_stream.len)) {
+		hash_stream_discard();
+		return CRYPTO_ERR_HASH;
+	}
+
+	if (mbedtls_md_update(&hash_stream.ctx, data, data_len) != 0) {
+		hash_stream_discard();
+		return CRYPTO_ERR_HASH;
+	}
+	hash_stream.len += data_len;
+
+	return CRYPTO_SUCCESS;
+}
+
+static int hash_stream_finish(void)
+{
+	int rc;
+
+	if (!hash_stream.in_progress || (hash_stream.len == 0U)) {
+		hash_stream_discard();
+		return CRYPTO_ERR_HASH;
+	}
+
+	rc = mbedtls_md_finish(&hash_stream.ctx, hash_stream.digest);
+	mbedtls_md_free(&hash_stream.ctx);
+	hash_stream.in_progress = false;
+	hash_stream.valid = (rc == 0);
+
+	return hash_stream.valid ? CRYPTO_SUCCESS : CRYPTO_ERR_HASH;
+}
+
+REGISTER_CRYPTO_HASH_STREAM(hash_stream_start, hash_stream_update,
+			    hash_stream_finish, hash_stream_discard);
+#endif /* LOAD_IMAGE_STREAM_HASH */
+
+/*
+ * Calculate the message digest of a buffer. A digest computed while the
+ * buffer was loaded is reused, SHA-256 uses the FEAT_SHA256 instructions when
+ * they are available, everything else goes through the Mbed TLS
+ * implementation.
+ */
+static int md_calc(const mbedtls_md_info_t *md_info, const unsigned char *data,
+		   size_t len, unsigned char *output)
+{
+#if LOAD_IMAGE_STREAM_HASH
+	if (hash_stream.valid && (data == hash_stream.base) &&
+	    (len == hash_stream.len) &&
+	    (mbedtls_md_get_type(md_info) == HASH_STREAM_MD_TYPE)) {
+		(void)memcpy(output, hash_stream.digest,
+			     mbedtls_md_get_size(md_info));
+		return 0;
+	}
+#endif
+
+#if ENABLE_FEAT_SHA256
+	if ((mbedtls_md_get_type(md_info) == MBEDTLS_MD_SHA256) &&
+	    (sha256_ce_calc_hash(data, len, output) == 0)) {
+		return 0;
+	}
+#endif
+
+	return mbedtls_md(md_info, data, len, output);
+}
+
 /*
  * AlgorithmIdentifier  ::=  SEQUENCE  {
  *     algorithm               OBJECT IDENTIFIER,
@@ -77,6 +214,74 @@ int mbedtls_x509_get_sig_alg(const mbedtls_x509_buf *sig_oid,
 			     mbedtls_md_type_t *md_alg,
 			     mbedtls_pk_type_t *pk_alg,
 			     void **sig_opts);
+
+#if AUTH_PK_CACHE
+#ifndef TF_MBEDTLS_PK_CACHE_ENTRIES
+#define TF_MBEDTLS_PK_CACHE_ENTRIES	2U
+#endif
+
+/*
+ * Public keys already parsed for a signature verification. Each of the
+ * trusted and non-trusted world keys signs several content certificates, so
+ * keeping them parsed saves decoding, and for ECDSA validating, the same key
+ * again. The entries stay allocated from the Mbed TLS heap for the rest of
+ * the boot stage.
+ */
+static struct pk_cache_entry {
+	bool valid;
+	unsigned int len;
+	unsigned char der[PK_DER_LEN];
+	mbedtls_pk_context pk;
+} pk_cache[TF_MBEDTLS_PK_CACHE_ENTRIES];
+
+static unsigned int pk_cache_next;
+
+/*
+ * Return the parsed context of a DER public key, parsing it into the least
+ * recently filled entry if it is not cached yet. Keys larger than PK_DER_LEN
+ * can not be held by the chain of trust and are rejected.
+ */
+static mbedtls_pk_context *pk_cache_get(void *pk_ptr, unsigned int pk_len)
+{
+	struct pk_cache_entry *entry;
+	unsigned char *p, *end;
+	unsigned int i;
+
+	for (i = 0U; i < TF_MBEDTLS_PK_CACHE_ENTRIES; i++) {
+		entry = &pk_cache[i];
+		if (entry->valid && (entry->len == pk_len) &&
+		    (memcmp(entry->der, pk_ptr, pk_len) == 0)) {
+			return &entry->pk;
+		}
+	}
+
+	if (pk_len > sizeof(entry->der)) {
+		return NULL;
+	}
+
+	entry = &pk_cache[pk_cache_next];
+	if (entry->valid) {
+		mbedtls_pk_free(&entry->pk);
+		entry->valid = false;
+	}
+
+	mbedtls_pk_init(&entry->pk);
+	p = (unsigned char *)pk_ptr;
+	end = p + pk_len;
+	if (mbedtls_pk_parse_subpubkey(&p, end, &entry->pk) != 0) {
+		mbedtls_pk_free(&entry->pk);
+		return NULL;
+	}
+
+	(void)memcpy(entry->der, pk_ptr, pk_len);
+	entry->len = pk_len;
+	entry->valid = true;
+	pk_cache_next = (pk_cache_next + 1U) % TF_MBEDTLS_PK_CACHE_ENTRIES;
+
+	return &entry->pk;
+}
+#endif /* AUTH_PK_CACHE */
+
 /*
  * Verify a signature.
  *
@@ -92,7 +297,10 @@ static int verify_signature(void *data_ptr, unsigned int data_len,
 	mbedtls_asn1_buf signature;
 	mbedtls_md_type_t md_alg;
 	mbedtls_pk_type_t pk_alg;
+	mbedtls_pk_context *pk_ctx;
+#if !AUTH_PK_CACHE
 	mbedtls_pk_context pk = {0};
+#endif
 	int rc;
 	void *sig_opts = NULL;
 	const mbedtls_md_info_t *md_info;
@@ -114,6 +322,13 @@ static int verify_signature(void *data_ptr, unsigned int data_len,
 	}
 
 	/* Parse the public key */
+#if AUTH_PK_CACHE
+	pk_ctx = pk_cache_get(pk_ptr, pk_len);
+	if (pk_ctx == NULL) {
+		rc = CRYPTO_ERR_SIGNATURE;
+		goto end2;
+	}
+#else
 	mbedtls_pk_init(&pk);
 	p = (unsigned char *)pk_ptr;
 	end = (unsigned char *)(p + pk_len);
@@ -122,6 +337,8 @@ static int verify_signature(void *data_ptr, unsigned int data_len,
 		rc = CRYPTO_ERR_SIGNATURE;
 		goto end2;
 	}
+	pk_ctx = &pk;
+#endif
 
 	/* Get the signature (bitstring) */
 	p = (unsigned char *)sig_ptr;
@@ -141,14 +358,14 @@ static int verify_signature(void *data_ptr, unsigned int data_len,
 		goto end1;
 	}
 	p = (unsigned char *)data_ptr;
-	rc = mbedtls_md(md_info, p, data_len, hash);
+	rc = md_calc(md_info, p, data_len, hash);
 	if (rc != 0) {
 		rc = CRYPTO_ERR_SIGNATURE;
 		goto end1;
 	}
 
 	/* Verify the signature */
-	rc = mbedtls_pk_verify_ext(pk_alg, sig_opts, &pk, md_alg, hash,
+	rc = mbedtls_pk_verify_ext(pk_alg, sig_opts, pk_ctx, md_alg, hash,
 			mbedtls_md_get_size(md_info),
 			signature.p, signature.len);
 	if (rc != 0) {
@@ -160,26 +377,28 @@ static int verify_signature(void *data_ptr, unsigned int data_len,
 	rc = CRYPTO_SUCCESS;
 
 end1:
+#if !AUTH_PK_CACHE
 	mbedtls_pk_free(&pk);
+#endif
 end2:
 	mbedtls_free(sig_opts);
 	return rc;
 }
 
 /*
- * Match a hash
+ * Match a hash, returning the algorithm and the digest of the data
  *
  * Digest info is passed in DER format following the ASN.1 structure detailed
  * above.
  */
-static int verify_hash(void *data_ptr, unsigned int data_len,
-		       void *digest_info_ptr, unsigned int digest_info_len)
+static int match_hash(void *data_ptr, unsigned int data_len,
+		      void *digest_info_ptr, unsigned int digest_info_len,
+		      mbedtls_md_type_t *md_type_out, unsigned char *data_hash)
 {
 	mbedtls_asn1_buf hash_oid, params;
 	mbedtls_md_type_t md_alg;
 	const mbedtls_md_info_t *md_info;
 	unsigned char *p, *end, *hash;
-	unsigned char data_hash[MBEDTLS_MD_MAX_SIZE];
 	size_t len;
 	int rc;
 
@@ -228,7 +447,7 @@ static int verify_hash(void *data_ptr, unsigned int data_len,
 
 	/* Calculate the hash of the data */
 	p = (unsigned char *)data_ptr;
-	rc = mbedtls_md(md_info, p, data_len, data_hash);
+	rc = md_calc(md_info, p, data_len, data_hash);
 	if (rc != 0) {
 		return CRYPTO_ERR_HASH;
 	}
@@ -239,8 +458,62 @@ static int verify_hash(void *data_ptr, unsigned int data_len,
 		return CRYPTO_ERR_HASH;
 	}
 
+	*md_type_out = md_alg;
+
 	return CRYPTO_SUCCESS;
 }
+
+/*
+ * Match a hash
+ */
+static int verify_hash(void *data_ptr, unsigned int data_len,
+		       void *digest_info_ptr, unsigned int digest_info_len)
+{
+	unsigned char data_hash[MBEDTLS_MD_MAX_SIZE];
+	mbedtls_md_type_t md_alg;
+
+	return match_hash(data_ptr, data_len, digest_info_ptr,
+			  digest_info_len, &md_alg, data_hash);
+}
+
+#if MBOOT_REUSE_AUTH_DIGEST
+/*
+ * Match a hash and return the digest of the data, as calc_hash would have
+ * calculated it
+ */
+static int verify_hash_digest(void *data_ptr, unsigned int data_len,
+			      void *digest_info_ptr,
+			      unsigned int digest_info_len,
+			      enum crypto_md_algo *alg,
+			      unsigned char digest[CRYPTO_MD_MAX_SIZE])
+{
+	mbedtls_md_type_t md_alg;
+	int rc;
+
+	rc = match_hash(data_ptr, data_len, digest_info_ptr, digest_info_len,
+			&md_alg, digest);
+	if (rc != CRYPTO_SUCCESS) {
+		return rc;
+	}
+
+	switch (md_alg) {
+	case MBEDTLS_MD_SHA512:
+		*alg = CRYPTO_MD_SHA512;
+		break;
+	case MBEDTLS_MD_SHA384:
+		*alg = CRYPTO_MD_SHA384;
+		break;
+	case MBEDTLS_MD_SHA256:
+		*alg = CRYPTO_MD_SHA256;
+		break;
+	default:
+		/* Not an algorithm measured boot can record */
+		return CRYPTO_ERR_HASH;
+	}
+
+	return CRYPTO_SUCCESS;
+}
+#endif /* MBOOT_REUSE_AUTH_DIGEST */
 #endif /* CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_ONLY || \
 	  CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_AND_HASH_CALC */
 
@@ -287,13 +560,72 @@ static int calc_hash(enum crypto_md_algo md_algo, void *data_ptr,
 	 * 'output' hash buffer pointer considering its size is always
 	 * bigger than or equal to MBEDTLS_MD_MAX_SIZE.
 	 */
-	rc = mbedtls_md(md_info, data_ptr, data_len, output);
+	rc = md_calc(md_info, data_ptr, data_len, output);
 	if (rc != 0) {
 		return CRYPTO_ERR_HASH;
 	}
 
 	return CRYPTO_SUCCESS;
 }
+
+#ifdef CRYPTO_MULTI_HASH
+/* Bytes fed to each algorithm in turn, small enough to stay in the D-cache */
+#define MULTI_HASH_CHUNK_SIZE	U(0x1000)
+
+/*
+ * Calculate the hashes of a buffer with several algorithms, reading it once
+ *
+ * outputs[i] points to the hash computed with md_algos[i]
+ */
+static int calc_hashes(const enum crypto_md_algo *md_algos, unsigned int num,
+		       void *data_ptr, unsigned int data_len,
+		       unsigned char (*outputs)[CRYPTO_MD_MAX_SIZE])
+{
+	mbedtls_md_context_t ctx[CRYPTO_MULTI_HASH_MAX];
+	const mbedtls_md_info_t *md_info;
+	const unsigned char *data = data_ptr;
+	unsigned int done, len, i;
+	int rc = 0;
+
+	if (num > CRYPTO_MULTI_HASH_MAX) {
+		return CRYPTO_ERR_HASH;
+	}
+
+	for (i = 0U; i < num; i++) {
+		mbedtls_md_init(&ctx[i]);
+	}
+
+	for (i = 0U; (rc == 0) && (i < num); i++) {
+		md_info = mbedtls_md_info_from_type(md_type(md_algos[i]));
+		if (md_info == NULL) {
+			rc = -1;
+			break;
+		}
+
+		rc = mbedtls_md_setup(&ctx[i], md_info, 0);
+		if (rc == 0) {
+			rc = mbedtls_md_starts(&ctx[i]);
+		}
+	}
+
+	for (done = 0U; (rc == 0) && (done < data_len); done += len) {
+		len = MIN(data_len - done, MULTI_HASH_CHUNK_SIZE);
+		for (i = 0U; (rc == 0) && (i < num); i++) {
+			rc = mbedtls_md_update(&ctx[i], data + done, len);
+		}
+	}
+
+	for (i = 0U; (rc == 0) && (i < num); i++) {
+		rc = mbedtls_md_finish(&ctx[i], outputs[i]);
+	}
+
+	for (i = 0U; i < num; i++) {
+		mbedtls_md_free(&ctx[i]);
+	}
+
+	return (rc == 0) ? CRYPTO_SUCCESS : CRYPTO_ERR_HASH;
+}
+#endif /* CRYPTO_MULTI_HASH */
 #endif /* CRYPTO_SUPPORT == CRYPTO_HASH_CALC_ONLY || \
 	  CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_AND_HASH_CALC */
 
@@ -304,50 +636,51 @@ static int calc_hash(enum crypto_md_algo md_algo, void *data_ptr,
  */
 #define DEC_OP_BUF_SIZE		128
 
-static int aes_gcm_decrypt(void *data_ptr, size_t len, const void *key,
-			   unsigned int key_len, const void *iv,
-			   unsigned int iv_len, const void *tag,
-			   unsigned int tag_len)
+/* Set the key and the IV of a new decryption */
+static int aes_gcm_start(mbedtls_gcm_context *ctx, const void *key,
+			 unsigned int key_len, const void *iv,
+			 unsigned int iv_len)
 {
-	mbedtls_gcm_context ctx;
 	mbedtls_cipher_id_t cipher = MBEDTLS_CIPHER_ID_AES;
-	unsigned char buf[DEC_OP_BUF_SIZE];
-	unsigned char tag_buf[CRYPTO_MAX_TAG_SIZE];
-	unsigned char *pt = data_ptr;
-	size_t dec_len;
-	int diff, i, rc;
-	size_t output_length __unused;
-
-	mbedtls_gcm_init(&ctx);
+	int rc;
 
-	rc = mbedtls_gcm_setkey(&ctx, cipher, key, key_len * 8);
+	rc = mbedtls_gcm_setkey(ctx, cipher, key, key_len * 8);
 	if (rc != 0) {
-		rc = CRYPTO_ERR_DECRYPTION;
-		goto exit_gcm;
+		return CRYPTO_ERR_DECRYPTION;
 	}
 
 #if (MBEDTLS_VERSION_MAJOR < 3)
-	rc = mbedtls_gcm_starts(&ctx, MBEDTLS_GCM_DECRYPT, iv, iv_len, NULL, 0);
+	rc = mbedtls_gcm_starts(ctx, MBEDTLS_GCM_DECRYPT, iv, iv_len, NULL, 0);
 #else
-	rc = mbedtls_gcm_starts(&ctx, MBEDTLS_GCM_DECRYPT, iv, iv_len);
+	rc = mbedtls_gcm_starts(ctx, MBEDTLS_GCM_DECRYPT, iv, iv_len);
 #endif
 	if (rc != 0) {
-		rc = CRYPTO_ERR_DECRYPTION;
-		goto exit_gcm;
+		return CRYPTO_ERR_DECRYPTION;
 	}
 
+	return CRYPTO_SUCCESS;
+}
+
+/* Decrypt 'len' bytes in place, through a stack buffer */
+static int aes_gcm_update(mbedtls_gcm_context *ctx, unsigned char *pt,
+			  size_t len)
+{
+	unsigned char buf[DEC_OP_BUF_SIZE];
+	size_t dec_len;
+	size_t output_length __unused;
+	int rc;
+
 	while (len > 0) {
 		dec_len = MIN(sizeof(buf), len);
 
 #if (MBEDTLS_VERSION_MAJOR < 3)
-		rc = mbedtls_gcm_update(&ctx, dec_len, pt, buf);
+		rc = mbedtls_gcm_update(ctx, dec_len, pt, buf);
 #else
-		rc = mbedtls_gcm_update(&ctx, pt, dec_len, buf, sizeof(buf), &output_length);
+		rc = mbedtls_gcm_update(ctx, pt, dec_len, buf, sizeof(buf), &output_length);
 #endif
 
 		if (rc != 0) {
-			rc = CRYPTO_ERR_DECRYPTION;
-			goto exit_gcm;
+			return CRYPTO_ERR_DECRYPTION;
 		}
 
 		memcpy(pt, buf, dec_len);
@@ -355,15 +688,25 @@ static int aes_gcm_decrypt(void *data_ptr, size_t len, const void *key,
 		len -= dec_len;
 	}
 
+	return CRYPTO_SUCCESS;
+}
+
+/* Compute the tag of the decrypted data and compare it with 'tag' */
+static int aes_gcm_finish(mbedtls_gcm_context *ctx, const void *tag,
+			  unsigned int tag_len)
+{
+	unsigned char tag_buf[CRYPTO_MAX_TAG_SIZE];
+	size_t output_length __unused;
+	int diff, i, rc;
+
 #if (MBEDTLS_VERSION_MAJOR < 3)
-	rc = mbedtls_gcm_finish(&ctx, tag_buf, sizeof(tag_buf));
+	rc = mbedtls_gcm_finish(ctx, tag_buf, sizeof(tag_buf));
 #else
-	rc = mbedtls_gcm_finish(&ctx, NULL, 0, &output_length, tag_buf, sizeof(tag_buf));
+	rc = mbedtls_gcm_finish(ctx, NULL, 0, &output_length, tag_buf, sizeof(tag_buf));
 #endif
 
 	if (rc != 0) {
-		rc = CRYPTO_ERR_DECRYPTION;
-		goto exit_gcm;
+		return CRYPTO_ERR_DECRYPTION;
 	}
 
 	/* Check tag in "constant-time" */
@@ -371,14 +714,30 @@ static int aes_gcm_decrypt(void *data_ptr, size_t len, const void *key,
 		diff |= ((const unsigned char *)tag)[i] ^ tag_buf[i];
 
 	if (diff != 0) {
-		rc = CRYPTO_ERR_DECRYPTION;
-		goto exit_gcm;
+		return CRYPTO_ERR_DECRYPTION;
 	}
 
-	/* GCM decryption success */
-	rc = CRYPTO_SUCCESS;
+	return CRYPTO_SUCCESS;
+}
+
+static int aes_gcm_decrypt(void *data_ptr, size_t len, const void *key,
+			   unsigned int key_len, const void *iv,
+			   unsigned int iv_len, const void *tag,
+			   unsigned int tag_len)
+{
+	mbedtls_gcm_context ctx;
+	int rc;
+
+	mbedtls_gcm_init(&ctx);
+
+	rc = aes_gcm_start(&ctx, key, key_len, iv, iv_len);
+	if (rc == CRYPTO_SUCCESS) {
+		rc = aes_gcm_update(&ctx, data_ptr, len);
+	}
+	if (rc == CRYPTO_SUCCESS) {
+		rc = aes_gcm_finish(&ctx, tag, tag_len);
+	}
 
-exit_gcm:
 	mbedtls_gcm_free(&ctx);
 	return rc;
 }
@@ -409,6 +768,81 @@ static int auth_decrypt(enum crypto_dec_algo dec_algo, void *data_ptr,
 
 	return CRYPTO_SUCCESS;
 }
+
+#if DECRYPTION_STREAM
+/* State of the image being decrypted by the dec_stream functions */
+static struct {
+	bool in_progress;
+	mbedtls_gcm_context ctx;
+} dec_stream;
+
+static void dec_stream_discard(void)
+{
+	if (dec_stream.in_progress) {
+		mbedtls_gcm_free(&dec_stream.ctx);
+		dec_stream.in_progress = false;
+	}
+}
+
+static int dec_stream_start(enum crypto_dec_algo dec_algo, const void *key,
+			    unsigned int key_len, unsigned int key_flags,
+			    const void *iv, unsigned int iv_len)
+{
+	int rc;
+
+	assert((key_flags & ENC_KEY_IS_IDENTIFIER) == 0);
+
+	dec_stream_discard();
+
+	if (dec_algo != CRYPTO_GCM_DECRYPT) {
+		return CRYPTO_ERR_DECRYPTION;
+	}
+
+	mbedtls_gcm_init(&dec_stream.ctx);
+	dec_stream.in_progress = true;
+
+	/* The context keeps its own copy of the key schedule */
+	rc = aes_gcm_start(&dec_stream.ctx, key, key_len, iv, iv_len);
+	if (rc != CRYPTO_SUCCESS) {
+		dec_stream_discard();
+	}
+
+	return rc;
+}
+
+static int dec_stream_update(void *data_ptr, size_t len)
+{
+	int rc;
+
+	if (!dec_stream.in_progress) {
+		return CRYPTO_ERR_DECRYPTION;
+	}
+
+	rc = aes_gcm_update(&dec_stream.ctx, data_ptr, len);
+	if (rc != CRYPTO_SUCCESS) {
+		dec_stream_discard();
+	}
+
+	return rc;
+}
+
+static int dec_stream_finish(const void *tag, unsigned int tag_len)
+{
+	int rc;
+
+	if (!dec_stream.in_progress) {
+		return CRYPTO_ERR_DECRYPTION;
+	}
+
+	rc = aes_gcm_finish(&dec_stream.ctx, tag, tag_len);
+	dec_stream_discard();
+
+	return rc;
+}
+
+REGISTER_CRYPTO_DEC_STREAM(dec_stream_start, dec_stream_update,
+			   dec_stream_finish, dec_stream_discard);
+#endif /* DECRYPTION_STREAM */
 #endif /* TF_MBEDTLS_USE_AES_GCM */
 
 /*
@@ -433,3 +867,11 @@ REGISTER_CRYPTO_LIB(LIB_NAME, init, verify_signature, verify_hash, NULL,
 #elif CRYPTO_SUPPORT == CRYPTO_HASH_CALC_ONLY
 REGISTER_CRYPTO_LIB(LIB_NAME, init, NULL, NULL, calc_hash, NULL, NULL);
 #endif /* CRYPTO_SUPPORT == CRYPTO_AUTH_VERIFY_AND_HASH_CALC */
+
+#if MBOOT_REUSE_AUTH_DIGEST
+REGISTER_CRYPTO_AUTH_DIGEST(verify_hash_digest);
+#endif /* MBOOT_REUSE_AUTH_DIGEST */
+
+#ifdef CRYPTO_MULTI_HASH
+REGISTER_CRYPTO_MULTI_HASH(calc_hashes);
+#endif /* CRYPTO_MULTI_HASH */
@@ -1,5 +1,5 @@
 #
-# Copyright (c) 2015-2023, Arm Limited and Contributors. All rights reserved.
+# Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
 #
 # SPDX-License-Identifier: BSD-3-Clause
 #
@@ -13,4 +13,9 @@ ifeq (${PSA_CRYPTO},1)
 	MBEDTLS_SOURCES +=	drivers/auth/mbedtls/mbedtls_psa_crypto.c
 else
 	MBEDTLS_SOURCES +=	drivers/auth/mbedtls/mbedtls_crypto.c
+
+	ifneq (${ENABLE_FEAT_SHA256},0)
+		MBEDTLS_SOURCES +=	drivers/auth/sha256_ce/sha256_ce.c	\
+					drivers/auth/sha256_ce/aarch64/sha256_ce_core.S
+	endif
 endif
@@ -13,6 +13,7 @@
  */
 
 #include <assert.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <string.h>
@@ -30,6 +31,9 @@
 /* Maximum OID string length ("a.b.c.d.e.f ...") */
 #define MAX_OID_STR_LEN			64
 
+/* Maximum number of extensions indexed by the integrity check */
+#define MAX_INDEXED_EXTS		16U
+
 #define LIB_NAME	"mbed TLS X509v3"
 
 /* Temporary variables to speed up the authentication parameters search. These
@@ -42,6 +46,23 @@ static mbedtls_asn1_buf pk;
 static mbedtls_asn1_buf sig_alg;
 static mbedtls_asn1_buf signature;
 
+/*
+ * Index of the extensions of the last certificate, filled by the integrity
+ * check so that each authentication parameter is found without parsing the
+ * extensions again. 'oid_hash' is the hash of the numeric OID string, and
+ * 'value' the extension's OCTET STRING content. A certificate with more
+ * extensions than the index holds is searched sequentially instead.
+ */
+static struct {
+	unsigned char *oid;
+	unsigned char *value;
+	uint32_t oid_len;
+	uint32_t value_len;
+	uint32_t oid_hash;
+} ext_index[MAX_INDEXED_EXTS];
+static unsigned int ext_index_num;
+static bool ext_index_valid;
+
 /*
  * Clear all static temporary variables.
  */
@@ -58,16 +79,114 @@ static void clear_temp_vars(void)
 	ZERO_AND_CLEAN(pk);
 	ZERO_AND_CLEAN(sig_alg);
 	ZERO_AND_CLEAN(signature);
+	ZERO_AND_CLEAN(ext_index);
+	ZERO_AND_CLEAN(ext_index_num);
+	ZERO_AND_CLEAN(ext_index_valid);
 
 #undef ZERO_AND_CLEAN
 }
 
+/*
+ * FNV-1a hash of a numeric OID string, to compare it against the index
+ * without converting every indexed OID back to a string.
+ */
+static uint32_t oid_str_hash(const char *str, size_t len)
+{
+	uint32_t hash = 0x811c9dc5U;
+
+	for (size_t i = 0U; i < len; i++) {
+		hash = (hash ^ (uint8_t)str[i]) * 0x01000193U;
+	}
+
+	return hash;
+}
+
+/*
+ * Check that the value of a requested extension is a single ASN.1 DER object
+ * and return it.
+ */
+static int get_ext_value(unsigned char *p, size_t len, void **ext,
+			 unsigned int *ext_len)
+{
+	const unsigned char *end_ext_data = p + len;
+
+	/* Extension must be ASN.1 DER */
+	if (len < 2) {
+		/* too short */
+		return IMG_PARSER_ERR_FORMAT;
+	}
+
+	if ((p[0] & 0x1F) == 0x1F) {
+		/* multi-byte ASN.1 DER tag, not allowed */
+		return IMG_PARSER_ERR_FORMAT;
+	}
+
+	if ((p[0] & 0xDF) == 0) {
+		/* UNIVERSAL 0 tag, not allowed */
+		return IMG_PARSER_ERR_FORMAT;
+	}
+
+	*ext = (void *)p;
+	*ext_len = (unsigned int)len;
+
+	/* Advance past the tag byte */
+	p++;
+
+	if (mbedtls_asn1_get_len(&p, end_ext_data, &len)) {
+		/* not valid DER */
+		return IMG_PARSER_ERR_FORMAT;
+	}
+
+	if (p + len != end_ext_data) {
+		/* junk after ASN.1 object */
+		return IMG_PARSER_ERR_FORMAT;
+	}
+
+	return IMG_PARSER_OK;
+}
+
+/*
+ * Get an X509v3 extension from the index built by the integrity check. An
+ * entry whose OID hash matches is confirmed by comparing the OID strings.
+ */
+static int get_indexed_ext(const char *oid, void **ext, unsigned int *ext_len)
+{
+	char oid_str[MAX_OID_STR_LEN];
+	mbedtls_asn1_buf extn_oid;
+	size_t len = strlen(oid);
+	uint32_t hash = oid_str_hash(oid, len);
+	int oid_len;
+
+	for (unsigned int i = 0U; i < ext_index_num; i++) {
+		if (ext_index[i].oid_hash != hash) {
+			continue;
+		}
+
+		extn_oid.tag = MBEDTLS_ASN1_OID;
+		extn_oid.len = ext_index[i].oid_len;
+		extn_oid.p = ext_index[i].oid;
+		oid_len = mbedtls_oid_get_numeric_string(oid_str,
+							 MAX_OID_STR_LEN,
+							 &extn_oid);
+		if ((oid_len < 0) || ((size_t)oid_len != len) ||
+		    (strcmp(oid, oid_str) != 0)) {
+			continue;
+		}
+
+		return get_ext_value(ext_index[i].value,
+				     ext_index[i].value_len, ext, ext_len);
+	}
+
+	return IMG_PARSER_ERR_NOT_FOUND;
+}
+
 /*
  * Get X509v3 extension
  *
  * Global variable 'v3_ext' must point to the extensions region
  * in the certificate.  OID may be NULL to request that get_ext()
- * is only being called for integrity checking.
+ * is only being called for integrity checking, which also builds
+ * the index of the extensions used by later calls.
  */
 static int get_ext(const char *oid, void **ext, unsigned int *ext_len)
 {
@@ -78,6 +197,15 @@ static int get_ext(const char *oid, void **ext, unsigned int *ext_len)
 	char oid_str[MAX_OID_STR_LEN];
 	mbedtls_asn1_buf extn_oid;
 
+	if ((oid != NULL) && ext_index_valid) {
+		return get_indexed_ext(oid, ext, ext_len);
+	}
+
+	if (oid == NULL) {
+		ext_index_num = 0U;
+		ext_index_valid = false;
+	}
+
 	p = v3_ext.p;
 	end = v3_ext.p + v3_ext.len;
 
@@ -132,51 +260,39 @@ static int get_ext(const char *oid, void **ext, unsigned int *ext_len)
 			return IMG_PARSER_ERR;
 		}
 
-		if ((oid != NULL) &&
-		    ((size_t)oid_len == strlen(oid_str)) &&
-		    (strcmp(oid, oid_str) == 0)) {
-			/* Extension must be ASN.1 DER */
-			if (len < 2) {
-				/* too short */
-				return IMG_PARSER_ERR_FORMAT;
+		if (oid == NULL) {
+			/* Index the extension, if there is room left */
+			if (ext_index_num < MAX_INDEXED_EXTS) {
+				ext_index[ext_index_num].oid = extn_oid.p;
+				ext_index[ext_index_num].oid_len =
+					(uint32_t)extn_oid.len;
+				ext_index[ext_index_num].value = p;
+				ext_index[ext_index_num].value_len =
+					(uint32_t)len;
+				ext_index[ext_index_num].oid_hash =
+					oid_str_hash(oid_str, (size_t)oid_len);
 			}
-
-			if ((p[0] & 0x1F) == 0x1F) {
-				/* multi-byte ASN.1 DER tag, not allowed */
-				return IMG_PARSER_ERR_FORMAT;
-			}
-
-			if ((p[0] & 0xDF) == 0) {
-				/* UNIVERSAL 0 tag, not allowed */
-				return IMG_PARSER_ERR_FORMAT;
-			}
-
-			*ext = (void *)p;
-			*ext_len = (unsigned int)len;
-
-			/* Advance past the tag byte */
-			p++;
-
-			if (mbedtls_asn1_get_len(&p, end_ext_data, &len)) {
-				/* not valid DER */
-				return IMG_PARSER_ERR_FORMAT;
-			}
-
-			if (p + len != end_ext_data) {
-				/* junk after ASN.1 object */
-				return IMG_PARSER_ERR_FORMAT;
-			}
-
-			return IMG_PARSER_OK;
+			ext_index_num++;
+		} else if (((size_t)oid_len == strlen(oid_str)) &&
+			   (strcmp(oid, oid_str) == 0)) {
+			return get_ext_value(p, len, ext, ext_len);
 		}
 
 		/* Next */
 		p = end_ext_data;
 	} while (p < end);
 
-	return (oid == NULL) ? IMG_PARSER_OK : IMG_PARSER_ERR_NOT_FOUND;
-}
+	if (oid == NULL) {
+		/* Too many extensions: later calls search sequentially */
+		ext_index_valid = (ext_index_num <= MAX_INDEXED_EXTS);
+		if (!ext_index_valid) {
+			ext_index_num = 0U;
+		}
+		return IMG_PARSER_OK;
+	}
 
+	return IMG_PARSER_ERR_NOT_FOUND;
+}
 
 /*
  * Check the integrity of the certificate ASN.1 structure.
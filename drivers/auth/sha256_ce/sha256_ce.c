@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <arch.h>
+#include <arch_features.h>
+#include <arch_helpers.h>
+#include <drivers/auth/sha256_ce.h>
+
+#define SHA256_BLOCK_SIZE	64U
+
+void sha256_ce_transform(uint32_t state[8], const uint8_t *data,
+			 size_t blocks);
+
+static const uint32_t sha256_iv[8] = {
+	0x6a09e667U, 0xbb67ae85U, 0x3c6ef372U, 0xa54ff53aU,
+	0x510e527fU, 0x9b05688cU, 0x1f83d9abU, 0x5be0cd19U,
+};
+
+static bool sha256_ce_usable(void)
+{
+#ifdef IMAGE_BL31
+	/*
+	 * BL31 does not save the FP/SIMD registers of the lower ELs around
+	 * every call into the crypto library, so leave them untouched.
+	 */
+	return false;
+#else
+	return is_feat_sha256_supported();
+#endif
+}
+
+int sha256_ce_calc_hash(const void *data, size_t len,
+			uint8_t hash[SHA256_CE_DIGEST_SIZE])
+{
+	uint8_t tail[2U * SHA256_BLOCK_SIZE];
+	const uint8_t *p = data;
+	size_t blocks = len / SHA256_BLOCK_SIZE;
+	size_t rem = len % SHA256_BLOCK_SIZE;
+	size_t tail_len;
+	uint64_t bit_len = (uint64_t)len * 8U;
+	uint32_t state[8];
+#ifdef IMAGE_AT_EL3
+	u_register_t cptr_el3;
+#endif
+	unsigned int i;
+
+	if (!sha256_ce_usable()) {
+		return -ENOTSUP;
+	}
+
+	/*
+	 * Build the final one or two blocks: the trailing message bytes, the
+	 * 0x80 terminator, zero padding and the big-endian message length.
+	 */
+	tail_len = (rem < (SHA256_BLOCK_SIZE - 8U)) ? SHA256_BLOCK_SIZE :
+						      2U * SHA256_BLOCK_SIZE;
+	(void)memset(tail, 0, tail_len);
+	(void)memcpy(tail, p + (blocks * SHA256_BLOCK_SIZE), rem);
+	tail[rem] = 0x80U;
+	for (i = 0U; i < 8U; i++) {
+		tail[tail_len - 1U - i] = (uint8_t)(bit_len >> (8U * i));
+	}
+
+	(void)memcpy(state, sha256_iv, sizeof(state));
+
+#ifdef IMAGE_AT_EL3
+	/* FP/SIMD accesses are trapped at EL3 outside of this function */
+	cptr_el3 = read_cptr_el3();
+	write_cptr_el3(cptr_el3 & ~TFP_BIT);
+	isb();
+#endif
+
+	if (blocks != 0U) {
+		sha256_ce_transform(state, p, blocks);
+	}
+	sha256_ce_transform(state, tail, tail_len / SHA256_BLOCK_SIZE);
+
+#ifdef IMAGE_AT_EL3
+	write_cptr_el3(cptr_el3);
+	isb();
+#endif
+
+	for (i = 0U; i < 8U; i++) {
+		hash[(4U * i)] = (uint8_t)(state[i] >> 24);
+		hash[(4U * i) + 1U] = (uint8_t)(state[i] >> 16);
+		hash[(4U * i) + 2U] = (uint8_t)(state[i] >> 8);
+		hash[(4U * i) + 3U] = (uint8_t)state[i];
+	}
+
+	return 0;
+}
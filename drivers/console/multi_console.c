@@ -1,18 +1,75 @@
 /*
- * Copyright (c) 2018-2023, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2018-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
 #include <assert.h>
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdlib.h>
 
 #include <drivers/console.h>
+#include <lib/cassert.h>
+#include <lib/spinlock.h>
 
 console_t *console_list;
 static uint8_t console_state = CONSOLE_FLAG_BOOT;
 
+#if CONSOLE_BUFFERED
+/*
+ * Size in bytes of the ring console_putc() writes into. It must be a power of
+ * two. When the ring is full, console_putc() drains it to make room.
+ */
+#ifndef CONSOLE_BUFFER_SIZE
+#define CONSOLE_BUFFER_SIZE		U(4096)
+#endif
+
+CASSERT(IS_POWER_OF_TWO(CONSOLE_BUFFER_SIZE), assert_console_buffer_size);
+
+/* Number of characters taken out of the ring at a time while draining */
+#define CONSOLE_DRAIN_CHUNK		U(64)
+
+/*
+ * The indexes run freely and are masked on access. Characters are stored as
+ * passed to console_putc(), the CR/LF translation is done when draining.
+ */
+static struct {
+	char buf[CONSOLE_BUFFER_SIZE];
+	unsigned int head;
+	unsigned int tail;
+	bool draining;
+} console_ring;
+
+/*
+ * Only the images with a runtime have more than one CPU logging, once the
+ * console has switched out of the boot state and the MMU is on.
+ */
+#if defined(IMAGE_BL31) || defined(IMAGE_BL32)
+static spinlock_t console_ring_lock;
+
+static void console_ring_lock_acquire(void)
+{
+	if (console_state == CONSOLE_FLAG_RUNTIME)
+		spin_lock(&console_ring_lock);
+}
+
+static void console_ring_lock_release(void)
+{
+	if (console_state == CONSOLE_FLAG_RUNTIME)
+		spin_unlock(&console_ring_lock);
+}
+#else
+static void console_ring_lock_acquire(void)
+{
+}
+
+static void console_ring_lock_release(void)
+{
+}
+#endif
+#endif /* CONSOLE_BUFFERED */
+
 IMPORT_SYM(console_t *, __STACKS_START__, stacks_start)
 IMPORT_SYM(console_t *, __STACKS_END__, stacks_end)
 
@@ -62,6 +119,8 @@ int console_is_registered(console_t *to_find)
 
 void console_switch_state(unsigned int new_state)
 {
+	/* Output what was logged under the previous state to its consoles */
+	console_drain();
 	console_state = new_state;
 }
 
@@ -86,7 +145,47 @@ static int do_putc(int c, console_t *console)
 	return console->putc(c, console);
 }
 
-int console_putc(int c)
+static int do_write(const char *buf, size_t len, console_t *console)
+{
+	size_t i, start = 0U;
+	int ret;
+
+	if (console->write == NULL) {
+		for (i = 0U; i < len; i++) {
+			ret = do_putc(buf[i], console);
+			if (ret < 0)
+				return ret;
+		}
+		return (int)len;
+	}
+
+	if ((console->flags & CONSOLE_FLAG_TRANSLATE_CRLF) != 0) {
+		for (i = 0U; i < len; i++) {
+			if (buf[i] != '\n')
+				continue;
+
+			/* The '\n' starts the next burst, after the '\r' */
+			if (i > start) {
+				ret = console->write(&buf[start], i - start,
+						     console);
+				if (ret < 0)
+					return ret;
+			}
+			ret = console->write("\r", 1U, console);
+			if (ret < 0)
+				return ret;
+			start = i;
+		}
+	}
+
+	ret = console->write(&buf[start], len - start, console);
+	if (ret < 0)
+		return ret;
+
+	return (int)len;
+}
+
+static int console_putc_all(int c)
 {
 	int err = ERROR_NO_VALID_CONSOLE;
 	console_t *console;
@@ -100,6 +199,118 @@ int console_putc(int c)
 	return err;
 }
 
+static int console_write_all(const char *buf, size_t len)
+{
+	int err = ERROR_NO_VALID_CONSOLE;
+	console_t *console;
+
+	for (console = console_list; console != NULL; console = console->next)
+		if ((console->flags & console_state) &&
+		    ((console->putc != NULL) || (console->write != NULL))) {
+			int ret = do_write(buf, len, console);
+			if ((err == ERROR_NO_VALID_CONSOLE) || (ret < err))
+				err = ret;
+		}
+	return err;
+}
+
+#if CONSOLE_BUFFERED
+void console_drain(void)
+{
+	char chunk[CONSOLE_DRAIN_CHUNK];
+	unsigned int i, n;
+
+	console_ring_lock_acquire();
+
+	/* Another CPU is already draining, in order */
+	if (console_ring.draining) {
+		console_ring_lock_release();
+		return;
+	}
+	console_ring.draining = true;
+
+	/*
+	 * Output a chunk at a time with the lock released, so that the other
+	 * CPUs only wait on the slow consoles when the ring is full.
+	 */
+	while (console_ring.tail != console_ring.head) {
+		n = console_ring.head - console_ring.tail;
+		if (n > CONSOLE_DRAIN_CHUNK)
+			n = CONSOLE_DRAIN_CHUNK;
+
+		for (i = 0U; i < n; i++)
+			chunk[i] = console_ring.buf[(console_ring.tail + i) &
+						    (CONSOLE_BUFFER_SIZE - 1U)];
+		console_ring.tail += n;
+
+		console_ring_lock_release();
+		(void)console_write_all(chunk, n);
+		console_ring_lock_acquire();
+	}
+
+	console_ring.draining = false;
+	console_ring_lock_release();
+}
+
+/* Store characters in the ring, draining it whenever it is full */
+static void console_ring_put(const char *buf, size_t len)
+{
+	size_t i;
+
+	console_ring_lock_acquire();
+	for (i = 0U; i < len; i++) {
+		while ((console_ring.head - console_ring.tail) ==
+		       CONSOLE_BUFFER_SIZE) {
+			console_ring_lock_release();
+			console_drain();
+			console_ring_lock_acquire();
+		}
+
+		console_ring.buf[console_ring.head &
+				 (CONSOLE_BUFFER_SIZE - 1U)] = buf[i];
+		console_ring.head++;
+	}
+	console_ring_lock_release();
+}
+
+int console_putc(int c)
+{
+	char ch = (char)c;
+
+	/* The crash consoles are written to directly, after what is pending */
+	if (console_state == CONSOLE_FLAG_CRASH) {
+		console_drain();
+		return console_putc_all(c);
+	}
+
+	console_ring_put(&ch, 1U);
+
+	return 0;
+}
+
+int console_write(const char *buf, size_t len)
+{
+	if (console_state == CONSOLE_FLAG_CRASH) {
+		console_drain();
+		return console_write_all(buf, len);
+	}
+
+	console_ring_put(buf, len);
+
+	return (int)len;
+}
+#else
+int console_putc(int c)
+{
+	return console_putc_all(c);
+}
+
+int console_write(const char *buf, size_t len)
+{
+	return console_write_all(buf, len);
+}
+#endif /* CONSOLE_BUFFERED */
+
 int putchar(int c)
 {
 	if (console_putc(c) == 0)
@@ -108,6 +319,14 @@ int putchar(int c)
 		return EOF;
 }
 
+int putchars(const char *s, size_t len)
+{
+	if (console_write(s, len) < 0)
+		return EOF;
+
+	return (int)len;
+}
+
 #if ENABLE_CONSOLE_GETC
 int console_getc(void)
 {
@@ -134,6 +353,8 @@ void console_flush(void)
 {
 	console_t *console;
 
+	console_drain();
+
 	for (console = console_list; console != NULL; console = console->next)
 		if ((console->flags & console_state) && (console->flush != NULL)) {
 			console->flush(console);
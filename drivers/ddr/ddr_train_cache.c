@@ -0,0 +1,261 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <common/debug.h>
+#include <drivers/ddr/ddr_train_cache.h>
+#include <lib/utils_def.h>
+
+#define DDR_TRAIN_CACHE_MAGIC		U(0x54524444)	/* "DDRT" */
+#define DDR_TRAIN_CACHE_VERSION		U(1)
+
+/*
+ * Header of a record in the storage, followed by the data of the backend. The
+ * header carries the tag of the data and is itself authenticated by the last
+ * tag, so that the results can't be replayed for another key.
+ */
+struct ddr_train_cache_hdr {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t data_size;
+	/* Incremented on each write, to replace the oldest record first */
+	uint32_t seq;
+	struct ddr_train_cache_key key;
+	uint8_t data_tag[DDR_TRAIN_CACHE_TAG_SIZE];
+	uint8_t hdr_tag[DDR_TRAIN_CACHE_TAG_SIZE];
+};
+
+static const struct ddr_train_cache_storage *cache_storage;
+
+/*******************************************************************************
+ * Register the storage of the training results. Without one, the DDR is
+ * trained on every boot.
+ ******************************************************************************/
+void ddr_train_cache_init(const struct ddr_train_cache_storage *storage)
+{
+	assert((storage == NULL) || ((storage->read != NULL) &&
+				     (storage->write != NULL) &&
+				     (storage->tag != NULL)));
+
+	cache_storage = storage;
+}
+
+/*******************************************************************************
+ * Hash the bytes identifying the DRAM devices, such as their SPD or serial
+ * numbers, into the 'dram_id' of a key (FNV-1a).
+ ******************************************************************************/
+uint32_t ddr_train_cache_dram_id(const void *id, size_t len)
+{
+	const uint8_t *p = id;
+	uint32_t hash = U(0x811c9dc5);
+
+	for (size_t i = 0U; i < len; i++) {
+		hash = (hash ^ p[i]) * U(0x01000193);
+	}
+
+	return hash;
+}
+
+static size_t record_size(const struct ddr_train_cache_backend *backend)
+{
+	return round_up(sizeof(struct ddr_train_cache_hdr) +
+			backend->data_size, 8U);
+}
+
+static unsigned int nr_slots(const struct ddr_train_cache_backend *backend)
+{
+	return (unsigned int)(cache_storage->size / record_size(backend));
+}
+
+static int read_hdr(const struct ddr_train_cache_backend *backend,
+		    unsigned int slot, struct ddr_train_cache_hdr *hdr)
+{
+	uint8_t tag[DDR_TRAIN_CACHE_TAG_SIZE];
+	int ret;
+
+	ret = cache_storage->read(slot * record_size(backend), hdr,
+				  sizeof(*hdr));
+	if (ret != 0) {
+		return ret;
+	}
+
+	if ((hdr->magic != DDR_TRAIN_CACHE_MAGIC) ||
+	    (hdr->version != DDR_TRAIN_CACHE_VERSION) ||
+	    (hdr->data_size != backend->data_size)) {
+		return -ENOENT;
+	}
+
+	ret = cache_storage->tag(hdr, offsetof(struct ddr_train_cache_hdr,
+					       hdr_tag), tag);
+	if ((ret != 0) || (memcmp(tag, hdr->hdr_tag, sizeof(tag)) != 0)) {
+		return -EAUTH;
+	}
+
+	return 0;
+}
+
+static bool key_match(const struct ddr_train_cache_key *a,
+		      const struct ddr_train_cache_key *b)
+{
+	return (a->dram_id == b->dram_id) && (a->temp_band == b->temp_band) &&
+	       (a->config == b->config);
+}
+
+/*******************************************************************************
+ * Look for the results of a key and read them into the data of the backend.
+ * Returns the slot, or a negative value if there is no valid record.
+ ******************************************************************************/
+static int cache_load(const struct ddr_train_cache_backend *backend,
+		      const struct ddr_train_cache_key *key)
+{
+	struct ddr_train_cache_hdr hdr;
+	uint8_t tag[DDR_TRAIN_CACHE_TAG_SIZE];
+	unsigned int slot;
+	int ret;
+
+	for (slot = 0U; slot < nr_slots(backend); slot++) {
+		if ((read_hdr(backend, slot, &hdr) == 0) &&
+		    key_match(&hdr.key, key)) {
+			break;
+		}
+	}
+
+	if (slot == nr_slots(backend)) {
+		return -ENOENT;
+	}
+
+	ret = cache_storage->read((slot * record_size(backend)) + sizeof(hdr),
+				  backend->data, backend->data_size);
+	if (ret != 0) {
+		return ret;
+	}
+
+	ret = cache_storage->tag(backend->data, backend->data_size, tag);
+	if ((ret != 0) || (memcmp(tag, hdr.data_tag, sizeof(tag)) != 0)) {
+		WARN("DDR: %s training data failed authentication\n",
+		     backend->name);
+		return -EAUTH;
+	}
+
+	return (int)slot;
+}
+
+/*******************************************************************************
+ * Write the results of a key from the data of the backend, over the record of
+ * the same key, or else an invalid or the oldest one.
+ ******************************************************************************/
+static int cache_store(const struct ddr_train_cache_backend *backend,
+		       const struct ddr_train_cache_key *key)
+{
+	struct ddr_train_cache_hdr hdr;
+	unsigned int slot, victim = 0U;
+	uint32_t seq = 0U, oldest = UINT32_MAX;
+	bool found = false;
+	size_t size = record_size(backend);
+	int ret;
+
+	for (slot = 0U; slot < nr_slots(backend); slot++) {
+		if (read_hdr(backend, slot, &hdr) != 0) {
+			if (!found && (oldest != 0U)) {
+				victim = slot;
+				oldest = 0U;
+			}
+			continue;
+		}
+
+		seq = MAX(seq, hdr.seq);
+		if (key_match(&hdr.key, key)) {
+			victim = slot;
+			found = true;
+		} else if (!found && (hdr.seq < oldest)) {
+			victim = slot;
+			oldest = hdr.seq;
+		}
+	}
+
+	(void)memset(&hdr, 0, sizeof(hdr));
+	hdr.magic = DDR_TRAIN_CACHE_MAGIC;
+	hdr.version = DDR_TRAIN_CACHE_VERSION;
+	hdr.data_size = (uint32_t)backend->data_size;
+	hdr.seq = seq + 1U;
+	hdr.key = *key;
+
+	ret = cache_storage->tag(backend->data, backend->data_size,
+				 hdr.data_tag);
+	if (ret == 0) {
+		ret = cache_storage->tag(&hdr,
+			offsetof(struct ddr_train_cache_hdr, hdr_tag),
+			hdr.hdr_tag);
+	}
+	if (ret != 0) {
+		return ret;
+	}
+
+	/* The data goes first, so a torn write leaves no valid header */
+	ret = cache_storage->write((victim * size) + sizeof(hdr),
+				   backend->data, backend->data_size);
+	if (ret == 0) {
+		ret = cache_storage->write(victim * size, &hdr, sizeof(hdr));
+	}
+
+	return ret;
+}
+
+/*******************************************************************************
+ * Bring up the DDR behind a backend. The results of a previous training for
+ * the same key are restored and verified if there are any, otherwise, or if
+ * that fails, the DDR is trained and the results stored for the next boot.
+ ******************************************************************************/
+int ddr_train_cache_run(const struct ddr_train_cache_backend *backend,
+			const struct ddr_train_cache_key *key)
+{
+	int ret;
+
+	assert((backend != NULL) && (key != NULL));
+	assert((backend->train != NULL) && (backend->restore != NULL) &&
+	       (backend->save != NULL));
+
+	if ((cache_storage != NULL) && (nr_slots(backend) != 0U) &&
+	    (cache_load(backend, key) >= 0)) {
+		ret = backend->restore(backend->cookie, backend->data);
+		if ((ret == 0) && (backend->verify != NULL)) {
+			ret = backend->verify(backend->cookie);
+		}
+		if (ret == 0) {
+			VERBOSE("DDR: %s training restored\n", backend->name);
+			return 0;
+		}
+
+		WARN("DDR: %s restored training failed (%d), retraining\n",
+		     backend->name, ret);
+	}
+
+	ret = backend->train(backend->cookie);
+	if (ret != 0) {
+		ERROR("DDR: %s training failed (%d)\n", backend->name, ret);
+		return ret;
+	}
+
+	if ((cache_storage == NULL) || (nr_slots(backend) == 0U)) {
+		return 0;
+	}
+
+	/* A failure to store only costs the training again on next boot */
+	ret = backend->save(backend->cookie, backend->data);
+	if (ret == 0) {
+		ret = cache_store(backend, key);
+	}
+	if (ret != 0) {
+		WARN("DDR: %s training data not stored (%d)\n",
+		     backend->name, ret);
+	}
+
+	return 0;
+}
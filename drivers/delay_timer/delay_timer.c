@@ -11,6 +11,14 @@
 #include <drivers/delay_timer.h>
 #include <lib/utils_def.h>
 
+/*
+ * Shortest delay for which udelay() waits for events rather than spinning on
+ * the timer, when the timer provides a wait_event operation.
+ */
+#ifndef UDELAY_WAIT_EVENT_MIN_US
+#define UDELAY_WAIT_EVENT_MIN_US	20U
+#endif
+
 /***********************************************************
  * The delay timer implementation
  ***********************************************************/
@@ -32,6 +40,19 @@ void udelay(uint32_t usec)
 
 	assert(usec < (UINT64_MAX / timer_ops->clk_div));
 
+	if ((usec >= UDELAY_WAIT_EVENT_MIN_US) &&
+	    (timer_ops->wait_event != NULL) &&
+	    (timer_ops->timeout_init_us != NULL) &&
+	    (timer_ops->timeout_elapsed != NULL)) {
+		uint64_t timeout = timer_ops->timeout_init_us(usec);
+
+		while (!timer_ops->timeout_elapsed(timeout)) {
+			timer_ops->wait_event(timeout);
+		}
+
+		return;
+	}
+
 	start = timer_ops->get_timer_value();
 
 	/* Add an extra tick to avoid delaying less than requested. */
@@ -102,3 +123,19 @@ bool timeout_elapsed(uint64_t cnt)
 
 	return timer_ops->timeout_elapsed(cnt);
 }
+
+/***********************************************************
+ * Wait in a low-power state until an event, the given
+ * timeout or a short periodic wake-up. Return at once if the
+ * timer cannot wait for events. Meant for the body of the
+ * polling loops of timeout_elapsed(), which must check their
+ * condition again on return.
+ ***********************************************************/
+void timeout_wait_event(uint64_t cnt)
+{
+	assert(timer_ops != NULL);
+
+	if (timer_ops->wait_event != NULL) {
+		timer_ops->wait_event(cnt);
+	}
+}
@@ -16,6 +16,11 @@
 #include <lib/utils_def.h>
 #include <plat/common/platform.h>
 
+/* Longest time the PE stays in WFE before checking the timer again */
+#ifndef GENERIC_DELAY_WAIT_EVENT_US
+#define GENERIC_DELAY_WAIT_EVENT_US	10U
+#endif
+
 static timer_ops_t ops;
 
 static uint64_t timeout_cnt_us2cnt(uint32_t us)
@@ -37,6 +42,57 @@ static bool generic_delay_timeout_elapsed(uint64_t expire_cnt)
 	return read_cntpct_el0() > expire_cnt;
 }
 
+#ifdef __aarch64__
+/*
+ * Wait for an event until expire_cnt has elapsed, or for at most
+ * GENERIC_DELAY_WAIT_EVENT_US so that callers polling a device get to check
+ * it regularly. With FEAT_WFxT the wake-up time is programmed directly with
+ * WFET. Otherwise the CNTKCTL_EL1 event stream is enabled around the WFE to
+ * bound the wait; the setting of the lower EL is restored afterwards.
+ */
+static void generic_delay_wait_event(uint64_t expire_cnt)
+{
+	uint64_t now = read_cntpct_el0();
+	uint64_t period = timeout_cnt_us2cnt(GENERIC_DELAY_WAIT_EVENT_US);
+	u_register_t cntkctl;
+	unsigned int evnti;
+
+	if (now > expire_cnt) {
+		return;
+	}
+
+	if (is_feat_wfxt_present()) {
+		/* WFET compares with the virtual count */
+		wfet(MIN(now + period, expire_cnt + 1U) - now +
+		     read_cntvct_el0());
+		return;
+	}
+
+	/*
+	 * The event stream fires when bit EVNTI of the counter goes from 0 to
+	 * 1, that is every 2^(EVNTI + 1) ticks. Pick the largest period not
+	 * longer than GENERIC_DELAY_WAIT_EVENT_US.
+	 */
+	if (period < 4U) {
+		evnti = 0U;
+	} else {
+		evnti = MIN(62U - (unsigned int)__builtin_clzll(period),
+			    EVNTI_MASK);
+	}
+
+	cntkctl = read_cntkctl_el1();
+	write_cntkctl_el1((cntkctl & ~((EVNTI_MASK << EVNTI_SHIFT) |
+				       EVNTDIR_BIT)) |
+			  ((u_register_t)evnti << EVNTI_SHIFT) | EVNTEN_BIT);
+	isb();
+
+	wfe();
+
+	write_cntkctl_el1(cntkctl);
+	isb();
+}
+#endif /* __aarch64__ */
+
 static uint32_t generic_delay_get_timer_value(void)
 {
 	/*
@@ -55,6 +111,9 @@ void generic_delay_timer_init_args(uint32_t mult, uint32_t div)
 	ops.clk_div		= div;
 	ops.timeout_init_us	= generic_delay_timeout_init_us;
 	ops.timeout_elapsed	= generic_delay_timeout_elapsed;
+#ifdef __aarch64__
+	ops.wait_event		= generic_delay_wait_event;
+#endif
 
 	timer_init(&ops);
 
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <string.h>
+
+#include <arch_helpers.h>
+#include <drivers/dma.h>
+#include <lib/utils_def.h>
+
+#include <platform_def.h>
+
+static const struct dma_ops *ops;
+static size_t dma_min_len;
+
+/* Destination of the copy in progress, invalidated once it completes */
+static uintptr_t dma_dst;
+static size_t dma_len;
+
+int dma_copy_start(uintptr_t dst, uintptr_t src, size_t len)
+{
+	if (ops == NULL) {
+		return -ENODEV;
+	}
+
+	assert(len <= ops->max_len);
+	assert(((dst | src | len) %
+		MAX(ops->align, (size_t)CACHE_WRITEBACK_GRANULE)) == 0U);
+	assert(((dst + len) <= src) || ((src + len) <= dst));
+
+	/*
+	 * Write the source back for the controller to read it, and the
+	 * destination so that no dirty line is evicted over the copy.
+	 */
+	flush_dcache_range(src, len);
+	flush_dcache_range(dst, len);
+
+	dma_dst = dst;
+	dma_len = len;
+
+	return ops->start(dst, src, len);
+}
+
+int dma_copy_wait(void)
+{
+	int rc;
+
+	assert(ops != NULL);
+
+	rc = ops->wait();
+
+	/* Drop the lines speculatively fetched during the copy */
+	inv_dcache_range(dma_dst, dma_len);
+
+	return rc;
+}
+
+void *dma_memcpy(void *dst, const void *src, size_t len)
+{
+	uintptr_t d = (uintptr_t)dst;
+	uintptr_t s = (uintptr_t)src;
+	size_t align, head, chunk;
+
+	if ((ops == NULL) || (len < dma_min_len) ||
+	    ((d < (s + len)) && (s < (d + len)))) {
+		return memcpy(dst, src, len);
+	}
+
+	/* Only buffers with the same offset in a granule can be offloaded */
+	align = MAX(ops->align, (size_t)CACHE_WRITEBACK_GRANULE);
+	if (((d - s) % align) != 0U) {
+		return memcpy(dst, src, len);
+	}
+
+	head = MIN(round_up(d, align) - d, len);
+	(void)memcpy((void *)d, (const void *)s, head);
+	d += head;
+	s += head;
+	len -= head;
+
+	while (len >= align) {
+		chunk = MIN(round_down(len, align), ops->max_len);
+
+		if ((dma_copy_start(d, s, chunk) != 0) ||
+		    (dma_copy_wait() != 0)) {
+			break;
+		}
+
+		d += chunk;
+		s += chunk;
+		len -= chunk;
+	}
+
+	(void)memcpy((void *)d, (const void *)s, len);
+
+	return dst;
+}
+
+/*
+ * Register the DMA controller. The fields of the provided ops must be valid,
+ * the alignment a power of two and the maximum length of a copy a multiple of
+ * both the alignment and CACHE_WRITEBACK_GRANULE.
+ */
+void dma_register(const struct dma_ops *ops_ptr, size_t min_len)
+{
+	assert((ops_ptr != NULL) &&
+	       (ops_ptr->start != NULL) &&
+	       (ops_ptr->wait != NULL) &&
+	       IS_POWER_OF_TWO(ops_ptr->align) &&
+	       (ops_ptr->max_len != 0U) &&
+	       ((ops_ptr->max_len %
+		 MAX(ops_ptr->align, (size_t)CACHE_WRITEBACK_GRANULE)) == 0U));
+
+	ops = ops_ptr;
+	dma_min_len = min_len;
+}
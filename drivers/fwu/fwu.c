@@ -5,6 +5,8 @@
  */
 
 #include <assert.h>
+#include <errno.h>
+#include <string.h>
 
 #include <common/debug.h>
 #include <common/tf_crc32.h>
@@ -12,6 +14,9 @@
 #include <drivers/fwu/fwu.h>
 #include <drivers/fwu/fwu_metadata.h>
 #include <drivers/io/io_storage.h>
+#if TRANSFER_LIST
+#include <lib/transfer_list.h>
+#endif
 
 #include <plat/common/platform.h>
 
@@ -265,6 +270,36 @@ const struct fwu_metadata *fwu_get_metadata(void)
 	return &metadata;
 }
 
+#if TRANSFER_LIST
+/*******************************************************************************
+ * Record the validated FWU metadata and the bank the images are loaded from in
+ * a TL_TAG_FWU_METADATA entry of a transfer list, for the later stages.
+ *
+ * return -ENOMEM if the transfer list is full, otherwise 0
+ ******************************************************************************/
+int fwu_transfer_list_add(struct transfer_list_header *tl, uint32_t boot_index)
+{
+	struct transfer_list_entry *te;
+	struct fwu_tl_metadata *data;
+
+	assert(is_metadata_initialized);
+	assert(boot_index < NR_OF_FW_BANKS);
+
+	te = transfer_list_add(tl, TL_TAG_FWU_METADATA, sizeof(*data), NULL);
+	if (te == NULL) {
+		WARN("No room for the FWU metadata in the transfer list\n");
+		return -ENOMEM;
+	}
+
+	data = transfer_list_entry_data(te);
+	data->boot_index = boot_index;
+	(void)memcpy(&data->metadata, &metadata, sizeof(metadata));
+	transfer_list_update_entry_checksum(tl, te, 0U);
+
+	return 0;
+}
+#endif /* TRANSFER_LIST */
+
 /*******************************************************************************
  * Load verified copy of FWU metadata image kept in the platform NV storage
  * into local FWU metadata structure.
@@ -1,11 +1,12 @@
 /*
- * Copyright (c) 2016-2023, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2016-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
 #include <assert.h>
 #include <errno.h>
+#include <stdbool.h>
 #include <string.h>
 
 #include <platform_def.h>
@@ -16,11 +17,33 @@
 #include <drivers/io/io_storage.h>
 #include <lib/utils.h>
 
+/*
+ * Number of cache lines tracked per block device. Zero compiles the block
+ * cache out.
+ */
+#ifndef IO_BLOCK_CACHE_LINES
+#define IO_BLOCK_CACHE_LINES	U(0)
+#endif
+
+#if IO_BLOCK_CACHE_LINES
+typedef struct {
+	int			lba;	/* first block held by the line */
+	size_t			blocks;	/* zero if the line is unused */
+	unsigned int		stamp;	/* last use, for LRU replacement */
+} block_cache_line_t;
+#endif
+
 typedef struct {
 	io_block_dev_spec_t	*dev_spec;
 	uintptr_t		base;
 	unsigned long long	file_pos;
 	unsigned long long	size;
+#if IO_BLOCK_CACHE_LINES
+	block_cache_line_t	lines[IO_BLOCK_CACHE_LINES];
+	unsigned int		stamp;
+	unsigned int		hits;
+	unsigned int		misses;
+#endif
 } block_dev_state_t;
 
 #define is_power_of_2(x)	(((x) != 0U) && (((x) & ((x) - 1U)) == 0U))
@@ -104,6 +127,164 @@ static int allocate_dev_info(io_dev_info_t **dev_info)
 }
 
 
+#if IO_BLOCK_CACHE_LINES
+/* Size in bytes of one cache line, or zero if the cache is unused */
+static size_t block_cache_line_size(const io_block_dev_spec_t *dev_spec)
+{
+	size_t line_size = dev_spec->block_size *
+			   (1U + dev_spec->cache_read_ahead);
+
+	if (dev_spec->cache.length < line_size) {
+		return 0U;
+	}
+
+	return line_size;
+}
+
+static unsigned int block_cache_num_lines(const io_block_dev_spec_t *dev_spec)
+{
+	size_t line_size = block_cache_line_size(dev_spec);
+
+	if (line_size == 0U) {
+		return 0U;
+	}
+
+	return (unsigned int)MIN(dev_spec->cache.length / line_size,
+				 (size_t)IO_BLOCK_CACHE_LINES);
+}
+
+/* Return the index of the line holding block lba, or -1 */
+static int block_cache_lookup(const block_dev_state_t *cur, int lba)
+{
+	unsigned int num_lines = block_cache_num_lines(cur->dev_spec);
+	unsigned int i;
+
+	for (i = 0U; i < num_lines; i++) {
+		const block_cache_line_t *line = &cur->lines[i];
+
+		if ((line->blocks != 0U) && (lba >= line->lba) &&
+		    ((size_t)(lba - line->lba) < line->blocks)) {
+			return (int)i;
+		}
+	}
+
+	return -1;
+}
+
+/*
+ * Fill the least recently used line with block lba and the blocks that
+ * follow it. Return the index of the line, or -1 on a device error.
+ */
+static int block_cache_fill(block_dev_state_t *cur, int lba)
+{
+	const io_block_dev_spec_t *dev_spec = cur->dev_spec;
+	size_t block_size = dev_spec->block_size;
+	size_t line_size = block_cache_line_size(dev_spec);
+	unsigned int num_lines = block_cache_num_lines(dev_spec);
+	unsigned int i, victim = 0U;
+	uintptr_t data;
+	size_t size;
+
+	for (i = 0U; i < num_lines; i++) {
+		if (cur->lines[i].blocks == 0U) {
+			victim = i;
+			break;
+		}
+		if (cur->lines[i].stamp < cur->lines[victim].stamp) {
+			victim = i;
+		}
+	}
+
+	data = dev_spec->cache.offset + (victim * line_size);
+	size = dev_spec->ops.read(lba, data, line_size);
+	if ((size < block_size) && (line_size > block_size)) {
+		/* The read-ahead may run past the end of the device */
+		size = dev_spec->ops.read(lba, data, block_size);
+	}
+
+	if (size < block_size) {
+		cur->lines[victim].blocks = 0U;
+		return -1;
+	}
+
+	cur->lines[victim].lba = lba;
+	cur->lines[victim].blocks = MIN(size, line_size) / block_size;
+
+	return (int)victim;
+}
+
+/* Drop the lines overlapping the blocks [lba, lba + blocks) */
+static void block_cache_invalidate(block_dev_state_t *cur, int lba,
+				   size_t blocks)
+{
+	unsigned int num_lines = block_cache_num_lines(cur->dev_spec);
+	unsigned int i;
+
+	for (i = 0U; i < num_lines; i++) {
+		block_cache_line_t *line = &cur->lines[i];
+		unsigned long long start = (unsigned long long)line->lba;
+		unsigned long long end = start + line->blocks;
+
+		if ((line->blocks != 0U) &&
+		    (start < ((unsigned long long)lba + blocks)) &&
+		    ((unsigned long long)lba < end)) {
+			line->blocks = 0U;
+		}
+	}
+}
+#endif /* IO_BLOCK_CACHE_LINES */
+
+/*
+ * Read size bytes from block lba into buf, going through the block cache
+ * when one is configured. Return the number of bytes read.
+ */
+static size_t block_dev_read(block_dev_state_t *cur, int lba, uintptr_t buf,
+			     size_t size)
+{
+#if IO_BLOCK_CACHE_LINES
+	const io_block_dev_spec_t *dev_spec = cur->dev_spec;
+	size_t block_size = dev_spec->block_size;
+	size_t line_size = block_cache_line_size(dev_spec);
+	size_t done = 0U;
+
+	if (line_size == 0U) {
+		return dev_spec->ops.read(lba, buf, size);
+	}
+
+	while (done < size) {
+		size_t offset, nbytes;
+		int idx = block_cache_lookup(cur, lba);
+
+		if (idx < 0) {
+			cur->misses++;
+			idx = block_cache_fill(cur, lba);
+			if (idx < 0) {
+				break;
+			}
+		} else {
+			cur->hits++;
+		}
+
+		offset = (size_t)(lba - cur->lines[idx].lba) * block_size;
+		nbytes = MIN((cur->lines[idx].blocks * block_size) - offset,
+			     size - done);
+
+		(void)memcpy((void *)(buf + done),
+			     (void *)(dev_spec->cache.offset +
+				      ((size_t)idx * line_size) + offset),
+			     nbytes);
+		cur->lines[idx].stamp = ++cur->stamp;
+
+		done += nbytes;
+		lba += (int)(nbytes / block_size);
+	}
+
+	return done;
+#else
+	return cur->dev_spec->ops.read(lba, buf, size);
+#endif
+}
+
 /* Release a device info to the pool */
 static int free_dev_info(io_dev_info_t *dev_info)
 {
@@ -171,6 +352,29 @@ static int block_seek(io_entity_t *entity, int mode, signed long long offset)
 	return 0;
 }
 
+/*
+ * Check whether the next read can bypass the bounce buffer. This needs the
+ * file position and the destination to be block aligned and at least one
+ * whole block left to read. On success, the size of the direct request is
+ * returned in *request.
+ */
+static bool block_direct_read_size(const block_dev_state_t *cur,
+				   uintptr_t dest, size_t skip, size_t left,
+				   size_t *request)
+{
+	size_t block_size = cur->dev_spec->block_size;
+	size_t max = cur->dev_spec->max_direct_read & ~(block_size - 1U);
+
+	if ((max == 0U) || (skip != 0U) || (left < block_size) ||
+	    ((dest & (block_size - 1U)) != 0U)) {
+		return false;
+	}
+
+	*request = MIN(left & ~(block_size - 1U), max);
+
+	return true;
+}
+
 /*
  * This function allows the caller to read any number of bytes
  * from any position. It hides from the caller that the low level
@@ -296,6 +500,22 @@ static int block_read(io_entity_t *entity, uintptr_t buffer, size_t length,
 		 */
 		lba = (cur->file_pos + cur->base) / block_size;
 
+		if (block_direct_read_size(cur, buffer + count, skip, left,
+					   &request)) {
+			/*
+			 * Read whole blocks straight into the user buffer,
+			 * there is nothing to skip or trim.
+			 */
+			nbytes = ops->read(lba, buffer + count, request);
+			if ((nbytes == 0U) || (nbytes > request)) {
+				return -EIO;
+			}
+
+			cur->file_pos += nbytes;
+			count += nbytes;
+			continue;
+		}
+
 		if ((skip + left) > buf->length) {
 			/*
 			 * The underlying read buffer is too small to
@@ -314,7 +534,7 @@ static int block_read(io_entity_t *entity, uintptr_t buffer, size_t length,
 			request = (request + (block_size - 1U)) &
 				~(block_size - 1U);
 		}
-		request = ops->read(lba, buf->offset, request);
+		request = block_dev_read(cur, lba, buf->offset, request);
 
 		if (request <= skip) {
 			/*
@@ -469,6 +689,9 @@ static int block_write(io_entity_t *entity, const uintptr_t buffer,
 		       nbytes);
 
 		request = ops->write(lba, buf->offset, request);
+#if IO_BLOCK_CACHE_LINES
+		block_cache_invalidate(cur, lba, request / block_size);
+#endif
 		if (request <= skip)
 			return -EIO;
 
@@ -519,6 +742,9 @@ static int block_dev_open(const uintptr_t dev_spec, io_dev_info_t **dev_info)
 	       (is_power_of_2(block_size) != 0U) &&
 	       ((buffer->offset % block_size) == 0U) &&
 	       ((buffer->length % block_size) == 0U));
+#if IO_BLOCK_CACHE_LINES
+	assert((cur->dev_spec->cache.offset % block_size) == 0U);
+#endif
 
 	*dev_info = info;	/* cast away const */
 	(void)block_size;
@@ -528,6 +754,12 @@ static int block_dev_open(const uintptr_t dev_spec, io_dev_info_t **dev_info)
 
 static int block_dev_close(io_dev_info_t *dev_info)
 {
+#if IO_BLOCK_CACHE_LINES
+	block_dev_state_t *cur = (block_dev_state_t *)dev_info->info;
+
+	VERBOSE("io_block: cache hits %u, misses %u\n", cur->hits,
+		cur->misses);
+#endif
 	return free_dev_info(dev_info);
 }
 
@@ -1,5 +1,6 @@
 /*
  * Copyright (c) 2020, Linaro Limited. All rights reserved.
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
  * Author: Sumit Garg <sumit.garg@linaro.org>
  *
  * SPDX-License-Identifier: BSD-3-Clause
@@ -30,6 +31,16 @@ static uintptr_t backend_image_spec;
 
 static io_dev_info_t enc_dev_info;
 
+#if DECRYPTION_STREAM
+/*
+ * Size of the chunks in which the payload is read, so that each chunk is
+ * decrypted while it is still in the data cache.
+ */
+#ifndef PLAT_ENC_READ_CHUNK_SIZE
+#define PLAT_ENC_READ_CHUNK_SIZE	U(0x4000)
+#endif
+#endif /* DECRYPTION_STREAM */
+
 /* Encrypted firmware driver functions */
 static int enc_dev_open(const uintptr_t dev_spec, io_dev_info_t **dev_info);
 static int enc_file_open(io_dev_info_t *dev_info, const uintptr_t spec,
@@ -150,6 +161,62 @@ static int enc_file_len(io_entity_t *entity, size_t *length)
 	return result;
 }
 
+#if DECRYPTION_STREAM
+/*
+ * Read the payload in chunks and decrypt each chunk in place as soon as it has
+ * been read, instead of reading the whole payload before decrypting it. The
+ * plaintext is wiped unless the tag of the whole payload matches.
+ */
+static int enc_read_decrypt(const struct fw_enc_hdr *header, uintptr_t buffer,
+			    size_t length, size_t *length_read)
+{
+	size_t offset, chunk_size, chunk_read;
+	int result;
+
+	*length_read = 0U;
+
+	for (offset = 0U; offset < length; offset += chunk_size) {
+		chunk_size = MIN(length - offset,
+				 (size_t)PLAT_ENC_READ_CHUNK_SIZE);
+
+		result = io_read(backend_handle, buffer + offset, chunk_size,
+				 &chunk_read);
+		if (result != 0) {
+			WARN("Failed to read encrypted payload (%i)\n", result);
+			goto fail;
+		}
+
+		if (chunk_read != 0U) {
+			result = crypto_mod_dec_stream_update(
+					(void *)(buffer + offset), chunk_read);
+			if (result != 0) {
+				ERROR("File decryption failed (%i)\n", result);
+				goto fail;
+			}
+		}
+
+		*length_read += chunk_read;
+		if (chunk_read < chunk_size) {
+			break;
+		}
+	}
+
+	result = crypto_mod_dec_stream_finish(header->tag, header->tag_len);
+	if (result != 0) {
+		ERROR("File decryption failed (%i)\n", result);
+		goto fail;
+	}
+
+	return 0;
+
+fail:
+	crypto_mod_dec_stream_discard();
+	zeromem((void *)buffer, *length_read);
+	*length_read = 0U;
+	return -ENOENT;
+}
+#endif /* DECRYPTION_STREAM */
+
 static int enc_file_read(io_entity_t *entity, uintptr_t buffer, size_t length,
 			 size_t *length_read)
 {
@@ -186,6 +253,28 @@ static int enc_file_read(io_entity_t *entity, uintptr_t buffer, size_t length,
 		return -ENOENT;
 	}
 
+#if DECRYPTION_STREAM
+	result = plat_get_enc_key_info(fw_enc_status, key, &key_len, &key_flags,
+				       (uint8_t *)&uuid_spec->uuid,
+				       sizeof(uuid_t));
+	if (result != 0) {
+		WARN("Failed to obtain encryption key (%i)\n", result);
+		return -ENOENT;
+	}
+
+	/* The key is no longer needed once the decryption has started */
+	result = crypto_mod_dec_stream_start(header.dec_algo, key, key_len,
+					     key_flags, header.iv,
+					     header.iv_len);
+	memset(key, 0, key_len);
+
+	if (result != 0) {
+		ERROR("File decryption failed (%i)\n", result);
+		return -ENOENT;
+	}
+
+	return enc_read_decrypt(&header, buffer, length, length_read);
+#else
 	result = io_read(backend_handle, buffer, length, &bytes_read);
 	if (result != 0) {
 		WARN("Failed to read encrypted payload (%i)\n", result);
@@ -215,6 +304,7 @@ static int enc_file_read(io_entity_t *entity, uintptr_t buffer, size_t length,
 	}
 
 	return result;
+#endif /* DECRYPTION_STREAM */
 }
 
 static int enc_file_close(io_entity_t *entity)
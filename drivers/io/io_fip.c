@@ -1,11 +1,12 @@
 /*
- * Copyright (c) 2014-2020, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2014-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
 #include <assert.h>
 #include <errno.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
 
@@ -25,6 +26,24 @@
 #define MAX_FIP_DEVICES		1
 #endif
 
+/*
+ * Number of ToC entries cached per FIP device by fip_dev_init(). Setting this
+ * to 0 disables the cache and every open rescans the ToC through the backend.
+ * A FIP with more entries than this still works, using the rescan path.
+ */
+#ifndef MAX_FIP_TOC_ENTRIES
+#define MAX_FIP_TOC_ENTRIES	32
+#endif
+
+/*
+ * Number of files that can be open at the same time across all FIP devices.
+ * Each open file also holds an entity from the io_storage pool, so
+ * MAX_IO_HANDLES must account for them.
+ */
+#ifndef MAX_FIP_FILES
+#define MAX_FIP_FILES		1
+#endif
+
 /* Useful for printing UUIDs when debugging.*/
 #define PRINT_UUID2(x)								\
 	"%08x-%04hx-%04hx-%02hhx%02hhx-%02hhx%02hhx%02hhx%02hhx%02hhx%02hhx",	\
@@ -36,6 +55,10 @@
 typedef struct {
 	unsigned int file_pos;
 	fip_toc_entry_t entry;
+	/* Backend handle kept open while an asynchronous read is in flight */
+	uintptr_t async_backend_handle;
+	/* The asynchronous read was served from the prefetch window */
+	bool async_prefetched;
 } fip_file_state_t;
 
 /*
@@ -47,16 +70,26 @@ typedef struct {
 typedef struct {
 	uintptr_t dev_spec;
 	uint16_t plat_toc_flag;
+#if MAX_FIP_TOC_ENTRIES > 0
+	/*
+	 * In-memory copy of the ToC, indexed by UUID in fip_file_open(). It is
+	 * only valid for the backend and header it was read from.
+	 */
+	bool toc_valid;
+	unsigned int toc_entry_count;
+	uintptr_t toc_backend_dev;
+	uintptr_t toc_backend_spec;
+	fip_toc_header_t toc_header;
+	fip_toc_entry_t toc[MAX_FIP_TOC_ENTRIES];
+#endif
 } fip_dev_state_t;
 
 /*
- * Only one file can be open across all FIP device
- * as backends like io_memmap don't support
- * multiple open files. The file state and
- * backend handle should be maintained per FIP device
- * if the same support is available in the backend
+ * Pool of file states shared by all FIP devices. The backend is reopened for
+ * every read, so several FIP files can be open at the same time. A file state
+ * is free when its offset is zero, as the ToC header lives at offset zero.
  */
-static fip_file_state_t current_fip_file = {0};
+static fip_file_state_t file_state_pool[MAX_FIP_FILES];
 static uintptr_t backend_dev_handle;
 static uintptr_t backend_image_spec;
 
@@ -66,6 +99,22 @@ static io_dev_info_t dev_info_pool[MAX_FIP_DEVICES];
 /* Track number of allocated fip devices */
 static unsigned int fip_dev_count;
 
+#if MAX_FIP_TOC_ENTRIES > 0
+/*
+ * Part of a FIP read ahead by fip_dev_prefetch(). The reads of files falling
+ * entirely within it are served from memory, as long as the ToC it was
+ * resolved from is still cached.
+ */
+static struct {
+	const fip_dev_state_t *state;
+	uintptr_t backend_dev;
+	uintptr_t backend_spec;
+	size_t offset;
+	size_t length;
+	uintptr_t buffer;
+} fip_prefetch;
+#endif
+
 /* Firmware Image Package driver functions */
 static int fip_dev_open(const uintptr_t dev_spec, io_dev_info_t **dev_info);
 static int fip_file_open(io_dev_info_t *dev_info, const uintptr_t spec,
@@ -73,6 +122,10 @@ static int fip_file_open(io_dev_info_t *dev_info, const uintptr_t spec,
 static int fip_file_len(io_entity_t *entity, size_t *length);
 static int fip_file_read(io_entity_t *entity, uintptr_t buffer, size_t length,
 			  size_t *length_read);
+static int fip_file_read_async(io_entity_t *entity, uintptr_t buffer,
+			       size_t length);
+static int fip_file_read_wait(io_entity_t *entity, size_t *length_read);
+static int fip_file_map(io_entity_t *entity, uintptr_t *addr);
 static int fip_file_close(io_entity_t *entity);
 static int fip_dev_init(io_dev_info_t *dev_info, const uintptr_t init_params);
 static int fip_dev_close(io_dev_info_t *dev_info);
@@ -117,6 +170,9 @@ static const io_dev_funcs_t fip_dev_funcs = {
 	.close = fip_file_close,
 	.dev_init = fip_dev_init,
 	.dev_close = fip_dev_close,
+	.read_async = fip_file_read_async,
+	.read_wait = fip_file_read_wait,
+	.map = fip_file_map,
 };
 
 /* Locate a file state in the pool, specified by address */
@@ -181,10 +237,24 @@ static int free_dev_info(io_dev_info_t *dev_info)
 	return result;
 }
 
+/* Allocate a file state from the pool and return a pointer to it */
+static fip_file_state_t *allocate_file_state(void)
+{
+	unsigned int index;
+
+	for (index = 0U; index < (unsigned int)MAX_FIP_FILES; ++index) {
+		if (file_state_pool[index].entry.offset_address == 0U) {
+			return &file_state_pool[index];
+		}
+	}
+
+	return NULL;
+}
+
 /*
  * Multiple FIP devices can be opened depending on the value of
- * MAX_FIP_DEVICES. Given that there is only one backend, only a
- * single file can be open at a time by any FIP device.
+ * MAX_FIP_DEVICES. They share a single backend, and up to MAX_FIP_FILES
+ * files can be open at a time across all of them.
  */
 static int fip_dev_open(const uintptr_t dev_spec,
 			 io_dev_info_t **dev_info)
@@ -212,6 +282,138 @@ static int fip_dev_open(const uintptr_t dev_spec,
 }
 
 
+#if MAX_FIP_TOC_ENTRIES > 0
+/*
+ * Read the whole ToC of the FIP into the device state. The backend handle must
+ * be positioned just after the ToC header. Failing to cache the ToC is not
+ * fatal since fip_file_open() can still scan the ToC through the backend.
+ */
+static void fip_toc_cache_fill(fip_dev_state_t *state, uintptr_t backend_handle,
+			       const fip_toc_header_t *header)
+{
+	static const uuid_t uuid_null = { {0} }; /* Double braces for clang */
+	size_t fip_size;
+	size_t bytes_read;
+	size_t toc_size;
+	unsigned int nr_entries;
+	unsigned int i;
+	int result;
+
+	/* Nothing to do if the same package has already been cached */
+	if (state->toc_valid &&
+	    (state->toc_backend_dev == backend_dev_handle) &&
+	    (state->toc_backend_spec == backend_image_spec) &&
+	    (memcmp(&state->toc_header, header, sizeof(*header)) == 0)) {
+		return;
+	}
+
+	state->toc_valid = false;
+	state->toc_entry_count = 0U;
+	nr_entries = 0U;
+
+	if ((io_size(backend_handle, &fip_size) == 0) &&
+	    (fip_size > sizeof(*header))) {
+		/* Backend size is known, read the ToC with a single call */
+		toc_size = fip_size - sizeof(*header);
+		if (toc_size > sizeof(state->toc)) {
+			toc_size = sizeof(state->toc);
+		}
+		toc_size -= toc_size % sizeof(fip_toc_entry_t);
+
+		if (toc_size == 0U) {
+			return;
+		}
+
+		result = io_read(backend_handle, (uintptr_t)state->toc,
+				 toc_size, &bytes_read);
+		if (result != 0) {
+			return;
+		}
+		nr_entries = (unsigned int)(bytes_read /
+					    sizeof(fip_toc_entry_t));
+	} else {
+		/* Otherwise read one entry at a time up to the terminator */
+		while (nr_entries < (unsigned int)MAX_FIP_TOC_ENTRIES) {
+			result = io_read(backend_handle,
+					 (uintptr_t)&state->toc[nr_entries],
+					 sizeof(fip_toc_entry_t), &bytes_read);
+			if ((result != 0) ||
+			    (bytes_read != sizeof(fip_toc_entry_t))) {
+				return;
+			}
+			if (compare_uuids(&state->toc[nr_entries].uuid,
+					  &uuid_null) == 0) {
+				break;
+			}
+			nr_entries++;
+		}
+		if (nr_entries < (unsigned int)MAX_FIP_TOC_ENTRIES) {
+			nr_entries++;
+		}
+	}
+
+	/* The cache is only usable if it holds the ToC end marker */
+	for (i = 0U; i < nr_entries; i++) {
+		if (compare_uuids(&state->toc[i].uuid, &uuid_null) == 0) {
+			state->toc_entry_count = i;
+			state->toc_backend_dev = backend_dev_handle;
+			state->toc_backend_spec = backend_image_spec;
+			state->toc_header = *header;
+			state->toc_valid = true;
+			VERBOSE("FIP ToC cached (%u entries).\n", i);
+			return;
+		}
+	}
+
+	VERBOSE("FIP ToC exceeds %u cached entries.\n",
+		(unsigned int)MAX_FIP_TOC_ENTRIES);
+}
+
+/* Look up a file in the cached ToC, specified by UUID */
+static int fip_toc_cache_find(const fip_dev_state_t *state,
+			      const uuid_t *uuid, fip_toc_entry_t *entry)
+{
+	unsigned int i;
+
+	for (i = 0U; i < state->toc_entry_count; i++) {
+		if (compare_uuids(&state->toc[i].uuid, uuid) == 0) {
+			*entry = state->toc[i];
+			return 0;
+		}
+	}
+
+	return -ENOENT;
+}
+
+/*
+ * Copy a read of a file from the prefetch window, if it falls entirely within
+ * it. Returns true if the read was served.
+ */
+static bool fip_prefetch_copy(const io_entity_t *entity, uintptr_t buffer,
+			      size_t length)
+{
+	const fip_dev_state_t *state =
+		(const fip_dev_state_t *)entity->dev_handle->info;
+	const fip_file_state_t *fp = (const fip_file_state_t *)entity->info;
+	size_t file_offset = fp->entry.offset_address + fp->file_pos;
+
+	if ((fip_prefetch.state != state) || !state->toc_valid ||
+	    (state->toc_backend_dev != fip_prefetch.backend_dev) ||
+	    (state->toc_backend_spec != fip_prefetch.backend_spec) ||
+	    (file_offset < fip_prefetch.offset) ||
+	    (length > fip_prefetch.length) ||
+	    ((file_offset - fip_prefetch.offset) >
+	     (fip_prefetch.length - length))) {
+		return false;
+	}
+
+	(void)memcpy((void *)buffer, (const void *)(fip_prefetch.buffer +
+		     (file_offset - fip_prefetch.offset)), length);
+
+	return true;
+}
+#endif /* MAX_FIP_TOC_ENTRIES > 0 */
+
 /* Do some basic package checks. */
 static int fip_dev_init(io_dev_info_t *dev_info, const uintptr_t init_params)
 {
@@ -258,6 +460,9 @@ static int fip_dev_init(io_dev_info_t *dev_info, const uintptr_t init_params)
 			 * bits [32-47] in fip header.
 			 */
 			state->plat_toc_flag = (header.flags >> 32) & 0xffff;
+#if MAX_FIP_TOC_ENTRIES > 0
+			fip_toc_cache_fill(state, backend_handle, &header);
+#endif
 		}
 	}
 
@@ -272,6 +477,12 @@ static int fip_dev_close(io_dev_info_t *dev_info)
 {
 	/* TODO: Consider tracking open files and cleaning them up here */
 
+#if MAX_FIP_TOC_ENTRIES > 0
+	if (fip_prefetch.state == (const fip_dev_state_t *)dev_info->info) {
+		fip_prefetch.state = NULL;
+	}
+#endif
+
 	/* Clear the backend. */
 	backend_dev_handle = (uintptr_t)NULL;
 	backend_image_spec = (uintptr_t)NULL;
@@ -290,21 +501,44 @@ static int fip_file_open(io_dev_info_t *dev_info, const uintptr_t spec,
 	static const uuid_t uuid_null = { {0} }; /* Double braces for clang */
 	size_t bytes_read;
 	int found_file = 0;
+	fip_file_state_t *fp;
+#if MAX_FIP_TOC_ENTRIES > 0
+	const fip_dev_state_t *state;
+#endif
 
+	assert(dev_info != NULL);
 	assert(uuid_spec != NULL);
 	assert(entity != NULL);
 
-	/* Can only have one file open at a time for the moment. We need to
-	 * track state like file cursor position. We know the header lives at
-	 * offset zero, so this entry should never be zero for an active file.
-	 * When the system supports dynamic memory allocation we can allow more
-	 * than one open file at a time if needed.
+	/*
+	 * Every open file needs its own state to track the cursor position.
+	 * We know the header lives at offset zero, so the entry offset should
+	 * never be zero for an active file.
 	 */
-	if (current_fip_file.entry.offset_address != 0U) {
-		WARN("fip_file_open : Only one open file at a time.\n");
+	fp = allocate_file_state();
+	if (fp == NULL) {
+		WARN("fip_file_open: too many open files (max %u).\n",
+		     (unsigned int)MAX_FIP_FILES);
 		return -ENFILE;
 	}
 
+#if MAX_FIP_TOC_ENTRIES > 0
+	/* Resolve the file from the cached ToC without any backend access */
+	state = (const fip_dev_state_t *)dev_info->info;
+	if (state->toc_valid) {
+		result = fip_toc_cache_find(state, &uuid_spec->uuid,
+					    &fp->entry);
+		if (result == 0) {
+			fp->file_pos = 0;
+			entity->info = (uintptr_t)fp;
+		} else {
+			fp->entry.offset_address = 0;
+		}
+
+		return result;
+	}
+#endif
+
 	/* Attempt to access the FIP image */
 	result = io_open(backend_dev_handle, backend_image_spec,
 			 &backend_handle);
@@ -326,32 +560,33 @@ static int fip_file_open(io_dev_info_t *dev_info, const uintptr_t spec,
 	found_file = 0;
 	do {
 		result = io_read(backend_handle,
-				 (uintptr_t)&current_fip_file.entry,
-				 sizeof(current_fip_file.entry),
+				 (uintptr_t)&fp->entry,
+				 sizeof(fp->entry),
 				 &bytes_read);
 		if (result == 0) {
-			if (compare_uuids(&current_fip_file.entry.uuid,
+			if (compare_uuids(&fp->entry.uuid,
 					  &uuid_spec->uuid) == 0) {
 				found_file = 1;
 			}
 		} else {
 			WARN("Failed to read FIP (%i)\n", result);
+			fp->entry.offset_address = 0;
 			goto fip_file_open_close;
 		}
 	} while ((found_file == 0) &&
-			(compare_uuids(&current_fip_file.entry.uuid,
+			(compare_uuids(&fp->entry.uuid,
 				&uuid_null) != 0));
 
 	if (found_file == 1) {
 		/* All fine. Update entity info with file state and return. Set
-		 * the file position to 0. The 'current_fip_file.entry' holds
-		 * the base and size of the file.
+		 * the file position to 0. The 'fp->entry' holds the base and
+		 * size of the file.
 		 */
-		current_fip_file.file_pos = 0;
-		entity->info = (uintptr_t)&current_fip_file;
+		fp->file_pos = 0;
+		entity->info = (uintptr_t)fp;
 	} else {
 		/* Did not find the file in the FIP. */
-		current_fip_file.entry.offset_address = 0;
+		fp->entry.offset_address = 0;
 		result = -ENOENT;
 	}
 
@@ -389,6 +624,15 @@ static int fip_file_read(io_entity_t *entity, uintptr_t buffer, size_t length,
 	assert(length_read != NULL);
 	assert(entity->info != (uintptr_t)NULL);
 
+#if MAX_FIP_TOC_ENTRIES > 0
+	if (fip_prefetch_copy(entity, buffer, length)) {
+		fp = (fip_file_state_t *)entity->info;
+		*length_read = length;
+		fp->file_pos += length;
+		return 0;
+	}
+#endif
+
 	/* Open the backend, attempt to access the blob image */
 	result = io_open(backend_dev_handle, backend_image_spec,
 			 &backend_handle);
@@ -431,14 +675,145 @@ static int fip_file_read(io_entity_t *entity, uintptr_t buffer, size_t length,
 }
 
 
+/*
+ * Start reading data from a file in package. The backend stays open until
+ * fip_file_read_wait() so that it can complete the transfer on its own.
+ */
+static int fip_file_read_async(io_entity_t *entity, uintptr_t buffer,
+			       size_t length)
+{
+	int result;
+	fip_file_state_t *fp;
+	size_t file_offset;
+	uintptr_t backend_handle;
+
+	assert(entity != NULL);
+	assert(entity->info != (uintptr_t)NULL);
+
+	fp = (fip_file_state_t *)entity->info;
+	assert(fp->async_backend_handle == (uintptr_t)NULL);
+
+#if MAX_FIP_TOC_ENTRIES > 0
+	if (fip_prefetch_copy(entity, buffer, length)) {
+		fp->async_prefetched = true;
+		entity->async_length = length;
+		return 0;
+	}
+#endif
+
+	result = io_open(backend_dev_handle, backend_image_spec,
+			 &backend_handle);
+	if (result != 0) {
+		WARN("Failed to open FIP (%i)\n", result);
+		return -ENOENT;
+	}
+
+	file_offset = fp->entry.offset_address + fp->file_pos;
+	result = io_seek(backend_handle, IO_SEEK_SET,
+			 (signed long long)file_offset);
+	if (result == 0) {
+		result = io_read_async(backend_handle, buffer, length);
+	}
+
+	if (result != 0) {
+		WARN("Failed to start reading payload (%i)\n", result);
+		io_close(backend_handle);
+		return -ENOENT;
+	}
+
+	fp->async_backend_handle = backend_handle;
+
+	return 0;
+}
+
+
+/* Wait for a read started by fip_file_read_async() and close the backend */
+static int fip_file_read_wait(io_entity_t *entity, size_t *length_read)
+{
+	int result;
+	fip_file_state_t *fp;
+	size_t bytes_read = 0U;
+
+	assert(entity != NULL);
+	assert(length_read != NULL);
+	assert(entity->info != (uintptr_t)NULL);
+
+	fp = (fip_file_state_t *)entity->info;
+	if (fp->async_prefetched) {
+		fp->async_prefetched = false;
+		*length_read = entity->async_length;
+		fp->file_pos += entity->async_length;
+		return 0;
+	}
+
+	if (fp->async_backend_handle == (uintptr_t)NULL) {
+		return -EINVAL;
+	}
+
+	result = io_read_wait(fp->async_backend_handle, &bytes_read);
+	io_close(fp->async_backend_handle);
+	fp->async_backend_handle = (uintptr_t)NULL;
+
+	if (result != 0) {
+		WARN("Failed to read payload (%i)\n", result);
+		return -ENOENT;
+	}
+
+	*length_read = bytes_read;
+	fp->file_pos += bytes_read;
+
+	return 0;
+}
+
+
+/*
+ * Return the address of the file position in package, if the backend is
+ * backed by memory.
+ */
+static int fip_file_map(io_entity_t *entity, uintptr_t *addr)
+{
+	int result;
+	fip_file_state_t *fp;
+	uintptr_t backend_handle;
+
+	assert(entity != NULL);
+	assert(entity->info != (uintptr_t)NULL);
+
+	fp = (fip_file_state_t *)entity->info;
+
+	result = io_open(backend_dev_handle, backend_image_spec,
+			 &backend_handle);
+	if (result != 0) {
+		return result;
+	}
+
+	result = io_seek(backend_handle, IO_SEEK_SET,
+			 (signed long long)(fp->entry.offset_address +
+					    fp->file_pos));
+	if (result == 0) {
+		result = io_map(backend_handle, addr);
+	}
+
+	io_close(backend_handle);
+
+	return result;
+}
+
+
 /* Close a file in package */
 static int fip_file_close(io_entity_t *entity)
 {
-	/* Clear our current file pointer.
-	 * If we had malloc() we would free() here.
-	 */
-	if (current_fip_file.entry.offset_address != 0U) {
-		zeromem(&current_fip_file, sizeof(current_fip_file));
+	fip_file_state_t *fp;
+
+	assert(entity != NULL);
+
+	/* Return the file state to the pool */
+	fp = (fip_file_state_t *)entity->info;
+	if (fp != NULL) {
+		if (fp->async_backend_handle != (uintptr_t)NULL) {
+			io_close(fp->async_backend_handle);
+		}
+		zeromem(fp, sizeof(*fp));
 	}
 
 	/* Clear the Entity info. */
@@ -479,3 +854,96 @@ int fip_dev_get_plat_toc_flag(io_dev_info_t *dev_info, uint16_t *plat_toc_flag)
 
 	return 0;
 }
+
+/*
+ * Read the part of the FIP spanning the files of 'uuids' with a single backend
+ * read into 'buffer', so that the reads of these files are then served from
+ * memory. The files are located through the cached ToC, those missing from the
+ * FIP are ignored. Returns -ENOMEM if the span does not fit in 'size' bytes,
+ * in which case the files are read from the backend as usual. A new prefetch
+ * replaces the previous one. The buffer must stay untouched as long as the
+ * files may be read, or until fip_dev_prefetch_drop() is called.
+ */
+int fip_dev_prefetch(io_dev_info_t *dev_info, const uuid_t *uuids,
+		     unsigned int count, uintptr_t buffer, size_t size)
+{
+#if MAX_FIP_TOC_ENTRIES > 0
+	const fip_dev_state_t *state;
+	fip_toc_entry_t entry;
+	uintptr_t backend_handle;
+	size_t start = SIZE_MAX, end = 0U;
+	size_t bytes_read;
+	unsigned int i;
+	int result;
+
+	assert((dev_info != NULL) && (uuids != NULL));
+
+	if (dev_info->funcs != &fip_dev_funcs) {
+		return -ENODEV;
+	}
+
+	fip_prefetch.state = NULL;
+
+	state = (const fip_dev_state_t *)dev_info->info;
+	if (!state->toc_valid) {
+		return -ENOENT;
+	}
+
+	for (i = 0U; i < count; i++) {
+		if (fip_toc_cache_find(state, &uuids[i], &entry) != 0) {
+			continue;
+		}
+		start = MIN(start, (size_t)entry.offset_address);
+		end = MAX(end, (size_t)(entry.offset_address + entry.size));
+	}
+
+	if (start >= end) {
+		return -ENOENT;
+	}
+
+	if ((end - start) > size) {
+		VERBOSE("FIP prefetch of 0x%zx bytes exceeds the buffer\n",
+			end - start);
+		return -ENOMEM;
+	}
+
+	result = io_open(state->toc_backend_dev, state->toc_backend_spec,
+			 &backend_handle);
+	if (result != 0) {
+		return result;
+	}
+
+	result = io_seek(backend_handle, IO_SEEK_SET, (signed long long)start);
+	if (result == 0) {
+		result = io_read(backend_handle, buffer, end - start,
+				 &bytes_read);
+	}
+	io_close(backend_handle);
+
+	if ((result != 0) || (bytes_read != (end - start))) {
+		return -EIO;
+	}
+
+	fip_prefetch.backend_dev = state->toc_backend_dev;
+	fip_prefetch.backend_spec = state->toc_backend_spec;
+	fip_prefetch.offset = start;
+	fip_prefetch.length = end - start;
+	fip_prefetch.buffer = buffer;
+	fip_prefetch.state = state;
+
+	VERBOSE("FIP prefetched 0x%zx bytes at offset 0x%zx\n",
+		fip_prefetch.length, fip_prefetch.offset);
+
+	return 0;
+#else
+	return -ENOTSUP;
+#endif
+}
+
+/* Stop serving reads from the prefetch buffer, which may then be reused */
+void fip_dev_prefetch_drop(void)
+{
+#if MAX_FIP_TOC_ENTRIES > 0
+	fip_prefetch.state = NULL;
+#endif
+}
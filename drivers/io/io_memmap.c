@@ -10,6 +10,7 @@
 #include <platform_def.h>
 
 #include <common/debug.h>
+#include <drivers/dma.h>
 #include <drivers/io/io_driver.h>
 #include <drivers/io/io_memmap.h>
 #include <drivers/io/io_storage.h>
@@ -49,6 +50,7 @@ static int memmap_block_read(io_entity_t *entity, uintptr_t buffer,
 static int memmap_block_write(io_entity_t *entity, const uintptr_t buffer,
 			      size_t length, size_t *length_written);
 static int memmap_block_close(io_entity_t *entity);
+static int memmap_block_map(io_entity_t *entity, uintptr_t *addr);
 static int memmap_dev_close(io_dev_info_t *dev_info);
 
 
@@ -67,6 +69,7 @@ static const io_dev_funcs_t memmap_dev_funcs = {
 	.close = memmap_block_close,
 	.dev_init = NULL,
 	.dev_close = memmap_dev_close,
+	.map = memmap_block_map,
 };
 
 
@@ -181,8 +184,13 @@ static int memmap_block_read(io_entity_t *entity, uintptr_t buffer,
 	pos_after = fp->file_pos + length;
 	assert((pos_after >= fp->file_pos) && (pos_after <= fp->size));
 
+#if USE_DMA_COPY
+	(void)dma_memcpy((void *)buffer,
+			 (void *)((uintptr_t)(fp->base + fp->file_pos)), length);
+#else
 	memcpy((void *)buffer,
 	       (void *)((uintptr_t)(fp->base + fp->file_pos)), length);
+#endif
 
 	*length_read = length;
 
@@ -221,6 +229,22 @@ static int memmap_block_write(io_entity_t *entity, const uintptr_t buffer,
 }
 
 
+/* Return the address of the file position on the memmap device */
+static int memmap_block_map(io_entity_t *entity, uintptr_t *addr)
+{
+	memmap_file_state_t *fp;
+
+	assert(entity != NULL);
+	assert(addr != NULL);
+
+	fp = (memmap_file_state_t *) entity->info;
+
+	*addr = (uintptr_t)(fp->base + fp->file_pos);
+
+	return 0;
+}
+
+
 /* Close a file on the memmap device */
 static int memmap_block_close(io_entity_t *entity)
 {
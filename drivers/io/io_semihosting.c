@@ -1,10 +1,11 @@
 /*
- * Copyright (c) 2014-2020, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2014-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
 #include <assert.h>
+#include <string.h>
 
 #include <platform_def.h>
 
@@ -12,6 +13,121 @@
 #include <drivers/io/io_semihosting.h>
 #include <drivers/io/io_storage.h>
 #include <lib/semihosting.h>
+#include <lib/utils_def.h>
+
+/*
+ * Size of the read-ahead buffer. Reads smaller than this are served from the
+ * buffer, refilled with a single trap to the host, so that the many small
+ * reads of e.g. the FIP table of contents do not each cost a trap. Larger
+ * reads, such as whole images, go straight to the caller's buffer. A platform
+ * may set it to 0 in platform_def.h to save the memory.
+ */
+#ifndef SH_READ_AHEAD_SIZE
+#define SH_READ_AHEAD_SIZE	U(2048)
+#endif
+
+#if SH_READ_AHEAD_SIZE != 0
+/*
+ * The buffer belongs to the file last opened or seeked. The host position of
+ * that file is always start + len, while its logical position is pos. The host
+ * position of the other files is their logical position.
+ */
+static struct {
+	long handle;		/* File owning the buffer, 0 if none */
+	size_t pos;		/* Logical position of the file */
+	size_t start;		/* File offset of data[0] */
+	size_t len;		/* Number of valid bytes in data */
+	uint8_t data[SH_READ_AHEAD_SIZE];
+} sh_cache;
+
+/* Give the buffer up, moving the host position of its file back to pos */
+static int sh_cache_release(void)
+{
+	long handle = sh_cache.handle;
+
+	sh_cache.handle = 0;
+
+	if ((handle == 0) || ((sh_cache.start + sh_cache.len) == sh_cache.pos)) {
+		return 0;
+	}
+
+	return (semihosting_file_seek(handle, (ssize_t)sh_cache.pos) == 0) ?
+		0 : -ENOENT;
+}
+
+/* Assign the empty buffer to a file whose host position is pos */
+static void sh_cache_acquire(long handle, size_t pos)
+{
+	(void)sh_cache_release();
+
+	sh_cache.handle = handle;
+	sh_cache.pos = pos;
+	sh_cache.start = pos;
+	sh_cache.len = 0U;
+}
+
+/* Read into buffer from the logical position of the buffer's file */
+static int sh_cache_read(uintptr_t buffer, size_t length, size_t *length_read)
+{
+	size_t copied = 0U;
+	size_t bytes, n;
+	long sh_result;
+
+	if ((sh_cache.pos >= sh_cache.start) &&
+	    (sh_cache.pos < (sh_cache.start + sh_cache.len))) {
+		n = MIN(length, sh_cache.start + sh_cache.len - sh_cache.pos);
+		(void)memcpy((void *)buffer,
+			     &sh_cache.data[sh_cache.pos - sh_cache.start], n);
+		sh_cache.pos += n;
+		copied = n;
+	}
+
+	if (copied < length) {
+		if ((sh_cache.start + sh_cache.len) != sh_cache.pos) {
+			if (semihosting_file_seek(sh_cache.handle,
+					(ssize_t)sh_cache.pos) != 0) {
+				sh_cache.handle = 0;
+				return -ENOENT;
+			}
+		}
+
+		sh_cache.start = sh_cache.pos;
+		sh_cache.len = 0U;
+
+		if ((length - copied) >= SH_READ_AHEAD_SIZE) {
+			bytes = length - copied;
+			sh_result = semihosting_file_read(sh_cache.handle,
+					&bytes, buffer + copied);
+		} else {
+			bytes = SH_READ_AHEAD_SIZE;
+			sh_result = semihosting_file_read(sh_cache.handle,
+					&bytes, (uintptr_t)sh_cache.data);
+		}
+
+		if (sh_result < 0) {
+			/* Nothing left to read */
+			if (copied == 0U) {
+				return -ENOENT;
+			}
+		} else if ((length - copied) >= SH_READ_AHEAD_SIZE) {
+			sh_cache.pos += bytes;
+			sh_cache.start = sh_cache.pos;
+			copied += bytes;
+		} else {
+			sh_cache.len = bytes;
+			n = MIN(length - copied, bytes);
+			(void)memcpy((void *)(buffer + copied), sh_cache.data,
+				     n);
+			sh_cache.pos += n;
+			copied += n;
+		}
+	}
+
+	*length_read = copied;
+
+	return 0;
+}
+#endif /* SH_READ_AHEAD_SIZE != 0 */
 
 /* Identify the device type as semihosting */
 static io_type_t device_type_sh(void)
@@ -82,6 +198,9 @@ static int sh_file_open(io_dev_info_t *dev_info __unused,
 
 	if (sh_result > 0) {
 		entity->info = (uintptr_t)sh_result;
+#if SH_READ_AHEAD_SIZE != 0
+		sh_cache_acquire(sh_result, 0U);
+#endif
 		result = 0;
 	}
 	return result;
@@ -97,8 +216,22 @@ static int sh_file_seek(io_entity_t *entity, int mode, signed long long offset)
 
 	file_handle = (long)entity->info;
 
+#if SH_READ_AHEAD_SIZE != 0
+	/* The host is seeked when the buffer has to be refilled */
+	if (file_handle == sh_cache.handle) {
+		sh_cache.pos = (size_t)offset;
+		return 0;
+	}
+#endif
+
 	sh_result = semihosting_file_seek(file_handle, (ssize_t)offset);
 
+#if SH_READ_AHEAD_SIZE != 0
+	if (sh_result == 0) {
+		sh_cache_acquire(file_handle, (size_t)offset);
+	}
+#endif
+
 	return (sh_result == 0) ? 0 : -ENOENT;
 }
 
@@ -137,6 +270,12 @@ static int sh_file_read(io_entity_t *entity, uintptr_t buffer, size_t length,
 
 	file_handle = (long)entity->info;
 
+#if SH_READ_AHEAD_SIZE != 0
+	if (file_handle == sh_cache.handle) {
+		return sh_cache_read(buffer, length, length_read);
+	}
+#endif
+
 	sh_result = semihosting_file_read(file_handle, &bytes, buffer);
 
 	if (sh_result >= 0) {
@@ -161,6 +300,12 @@ static int sh_file_write(io_entity_t *entity, const uintptr_t buffer,
 
 	file_handle = (long)entity->info;
 
+#if SH_READ_AHEAD_SIZE != 0
+	if ((file_handle == sh_cache.handle) && (sh_cache_release() != 0)) {
+		return -ENOENT;
+	}
+#endif
+
 	sh_result = semihosting_file_write(file_handle, &bytes, buffer);
 
 	*length_written = length - bytes;
@@ -179,6 +324,12 @@ static int sh_file_close(io_entity_t *entity)
 
 	file_handle = (long)entity->info;
 
+#if SH_READ_AHEAD_SIZE != 0
+	if (file_handle == sh_cache.handle) {
+		sh_cache.handle = 0;
+	}
+#endif
+
 	sh_result = semihosting_file_close(file_handle);
 
 	return (sh_result >= 0) ? 0 : -ENOENT;
@@ -1,16 +1,20 @@
 /*
- * Copyright (c) 2014-2020, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2014-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
 #include <assert.h>
+#include <stdbool.h>
 #include <stddef.h>
 
 #include <platform_def.h>
 
+#include <arch_helpers.h>
+#include <common/debug.h>
 #include <drivers/io/io_driver.h>
 #include <drivers/io/io_storage.h>
+#include <lib/pmf/pmf.h>
 
 /* Storage for a fixed maximum number of IO entities, definable by platform */
 static io_entity_t entity_pool[MAX_IO_HANDLES];
@@ -28,6 +32,214 @@ static const io_dev_info_t *devices[MAX_IO_DEVICES];
 /* Number of currently registered devices */
 static unsigned int dev_count;
 
+#if IO_STATS
+/*
+ * The operations are accounted per device type, and per image for those made
+ * after io_stats_set_image(). Devices such as FIP call the device holding
+ * their data: the time of the outer operation includes that of the inner ones,
+ * and only the outer ones are accounted to the image, with the count of the
+ * inner reads. The IO layer is only used by one cpu at a time during the boot,
+ * so the statistics need no lock.
+ */
+#ifndef IO_STATS_MAX_IMAGES
+#define IO_STATS_MAX_IMAGES	U(16)
+#endif
+
+struct io_op_stats {
+	uint32_t count[IO_STATS_NR_OPS];
+	uint64_t ticks[IO_STATS_NR_OPS];
+	uint64_t bytes;
+};
+
+struct io_image_stats {
+	unsigned int image_id;
+	uint32_t inner_reads;
+	struct io_op_stats ops;
+};
+
+static struct io_op_stats dev_stats[IO_TYPE_MAX];
+static struct io_image_stats image_stats[IO_STATS_MAX_IMAGES];
+static unsigned int nr_image_stats;
+static bool image_stats_full;
+static struct io_image_stats *cur_image_stats;
+
+/* Number of operations in progress, more than one while a device calls another */
+static unsigned int io_depth;
+
+#if ENABLE_PMF
+PMF_REGISTER_SERVICE(io_svc, PMF_IO_STATS_SVC_ID, IO_STATS_PMF_TOTAL_IDS,
+	PMF_DUMP_ENABLE)
+#endif
+
+static const char *const io_type_names[IO_TYPE_MAX] = {
+	[IO_TYPE_INVALID] = "invalid",
+	[IO_TYPE_SEMIHOSTING] = "semihosting",
+	[IO_TYPE_MEMMAP] = "memmap",
+	[IO_TYPE_FIRMWARE_IMAGE_PACKAGE] = "fip",
+	[IO_TYPE_BLOCK] = "block",
+	[IO_TYPE_MTD] = "mtd",
+	[IO_TYPE_MMC] = "mmc",
+	[IO_TYPE_ENCRYPTED] = "encrypted",
+};
+
+static uint64_t io_stats_start(void)
+{
+	io_depth++;
+
+	return read_cntpct_el0();
+}
+
+static void io_op_stats_add(struct io_op_stats *stats, unsigned int op,
+		uint64_t ticks, uint32_t count, size_t bytes)
+{
+	stats->count[op] += count;
+	stats->ticks[op] += ticks;
+	stats->bytes += bytes;
+}
+
+/* Account 'count' operations of type 'op' on 'dev', started at 'start' */
+static void io_stats_end(const io_dev_info_t *dev, unsigned int op,
+		uint64_t start, uint32_t count, size_t bytes)
+{
+	uint64_t ticks = read_cntpct_el0() - start;
+
+	assert(io_depth != 0U);
+	io_depth--;
+
+	io_op_stats_add(&dev_stats[dev->funcs->type()], op, ticks, count,
+			bytes);
+
+	if (cur_image_stats == NULL) {
+		return;
+	}
+
+	if (io_depth == 0U) {
+		io_op_stats_add(&cur_image_stats->ops, op, ticks, count, bytes);
+	} else if (op == IO_STATS_READ) {
+		cur_image_stats->inner_reads += count;
+	}
+}
+
+/* Account the following operations to 'image_id' */
+void io_stats_set_image(unsigned int image_id)
+{
+	unsigned int i;
+
+	for (i = 0U; i < nr_image_stats; i++) {
+		if (image_stats[i].image_id == image_id) {
+			cur_image_stats = &image_stats[i];
+			return;
+		}
+	}
+
+	if (nr_image_stats == IO_STATS_MAX_IMAGES) {
+		image_stats_full = true;
+		cur_image_stats = NULL;
+		return;
+	}
+
+	cur_image_stats = &image_stats[nr_image_stats++];
+	cur_image_stats->image_id = image_id;
+}
+
+static unsigned long long ticks_to_us(uint64_t ticks, uint64_t freq)
+{
+	return (unsigned long long)((ticks * 1000000ULL) / freq);
+}
+
+static void io_op_stats_print(const char *name, unsigned int id,
+		const struct io_op_stats *stats, uint64_t freq)
+{
+	NOTICE("  %-11s %3u %6u %8llu %6u %8llu %6u %8llu %10llu\n",
+	       name, id,
+	       stats->count[IO_STATS_OPEN],
+	       ticks_to_us(stats->ticks[IO_STATS_OPEN], freq),
+	       stats->count[IO_STATS_SEEK],
+	       ticks_to_us(stats->ticks[IO_STATS_SEEK], freq),
+	       stats->count[IO_STATS_READ],
+	       ticks_to_us(stats->ticks[IO_STATS_READ], freq),
+	       (unsigned long long)stats->bytes);
+}
+
+#if ENABLE_PMF
+static void io_stats_write_pmf(unsigned int type,
+		const struct io_op_stats *stats)
+{
+	unsigned long long val;
+	unsigned int op;
+
+	for (op = 0U; op < IO_STATS_NR_OPS; op++) {
+		val = stats->count[op];
+		PMF_WRITE_TIMESTAMP(io_svc,
+			IO_STATS_PMF_ID(type, IO_STATS_PMF_COUNT(op)),
+			PMF_CACHE_MAINT, val);
+		val = stats->ticks[op];
+		PMF_WRITE_TIMESTAMP(io_svc,
+			IO_STATS_PMF_ID(type, IO_STATS_PMF_TICKS(op)),
+			PMF_CACHE_MAINT, val);
+	}
+
+	val = stats->bytes;
+	PMF_WRITE_TIMESTAMP(io_svc, IO_STATS_PMF_ID(type, IO_STATS_PMF_BYTES),
+		PMF_CACHE_MAINT, val);
+}
+#endif
+
+/*
+ * Print the operations made so far in this stage per device type, then per
+ * image, and write those per device type to PMF.
+ */
+void io_stats_report(void)
+{
+	uint64_t freq = read_cntfrq_el0();
+	const struct io_image_stats *img;
+	unsigned int type, i;
+
+	if (freq == 0U) {
+		return;
+	}
+
+	NOTICE("IO stats: operations of the stage (count, us, bytes)\n");
+	NOTICE("  device       id  opens       us  seeks       us  reads       us      bytes\n");
+
+	for (type = 0U; type < (unsigned int)IO_TYPE_MAX; type++) {
+		const struct io_op_stats *stats = &dev_stats[type];
+
+		if ((stats->count[IO_STATS_OPEN] | stats->count[IO_STATS_SEEK] |
+		     stats->count[IO_STATS_READ]) == 0U) {
+			continue;
+		}
+
+		io_op_stats_print(io_type_names[type], type, stats, freq);
+#if ENABLE_PMF
+		io_stats_write_pmf(type, stats);
+#endif
+	}
+
+	for (i = 0U; i < nr_image_stats; i++) {
+		img = &image_stats[i];
+		io_op_stats_print("image", img->image_id, &img->ops, freq);
+		NOTICE("  %-11s %3u %6u inner reads\n", "", img->image_id,
+		       img->inner_reads);
+	}
+
+	if (image_stats_full) {
+		NOTICE("  images past the first %u not accounted for\n",
+		       IO_STATS_MAX_IMAGES);
+	}
+}
+#else
+static inline uint64_t io_stats_start(void)
+{
+	return 0U;
+}
+
+static inline void io_stats_end(const io_dev_info_t *dev, unsigned int op,
+		uint64_t start, uint32_t count, size_t bytes)
+{
+}
+#endif /* IO_STATS */
+
 /* Extra validation functions only used when asserts are enabled */
 #if ENABLE_ASSERTIONS
 
@@ -218,8 +430,11 @@ int io_open(uintptr_t dev_handle, const uintptr_t spec, uintptr_t *handle)
 	result = allocate_entity(&entity);
 
 	if (result == 0) {
+		uint64_t start = io_stats_start();
+
 		assert(dev->funcs->open != NULL);
 		result = dev->funcs->open(dev, spec, entity);
+		io_stats_end(dev, IO_STATS_OPEN, start, 1U, 0U);
 
 		if (result == 0) {
 			entity->dev_handle = dev;
@@ -241,8 +456,12 @@ int io_seek(uintptr_t handle, io_seek_mode_t mode, signed long long offset)
 
 	io_dev_info_t *dev = entity->dev_handle;
 
-	if (dev->funcs->seek != NULL)
+	if (dev->funcs->seek != NULL) {
+		uint64_t start = io_stats_start();
+
 		result = dev->funcs->seek(entity, mode, offset);
+		io_stats_end(dev, IO_STATS_SEEK, start, 1U, 0U);
+	}
 
 	return result;
 }
@@ -278,13 +497,100 @@ int io_read(uintptr_t handle,
 
 	io_dev_info_t *dev = entity->dev_handle;
 
-	if (dev->funcs->read != NULL)
+	if (dev->funcs->read != NULL) {
+		uint64_t start = io_stats_start();
+
 		result = dev->funcs->read(entity, buffer, length, length_read);
+		io_stats_end(dev, IO_STATS_READ, start, 1U,
+			     (result == 0) ? *length_read : 0U);
+	}
 
 	return result;
 }
 
 
+/*
+ * Start reading data from an IO entity. The buffer must not be accessed until
+ * io_read_wait() has returned. Devices without asynchronous support perform
+ * the read here and io_read_wait() only returns its outcome.
+ */
+int io_read_async(uintptr_t handle, uintptr_t buffer, size_t length)
+{
+	int result = -ENODEV;
+	assert(is_valid_entity(handle));
+
+	io_entity_t *entity = (io_entity_t *)handle;
+
+	io_dev_info_t *dev = entity->dev_handle;
+
+	uint64_t start = io_stats_start();
+
+	if ((dev->funcs->read_async != NULL) &&
+	    (dev->funcs->read_wait != NULL)) {
+		result = dev->funcs->read_async(entity, buffer, length);
+		io_stats_end(dev, IO_STATS_READ, start, 1U,
+			     (result == 0) ? length : 0U);
+		return result;
+	}
+
+	entity->async_length = 0U;
+	if (dev->funcs->read != NULL) {
+		result = dev->funcs->read(entity, buffer, length,
+				&entity->async_length);
+	}
+	entity->async_result = result;
+	io_stats_end(dev, IO_STATS_READ, start, 1U, entity->async_length);
+
+	return 0;
+}
+
+
+/* Wait for a read started by io_read_async() to complete */
+int io_read_wait(uintptr_t handle, size_t *length_read)
+{
+	assert(is_valid_entity(handle) && (length_read != NULL));
+
+	io_entity_t *entity = (io_entity_t *)handle;
+
+	io_dev_info_t *dev = entity->dev_handle;
+
+	if ((dev->funcs->read_async != NULL) &&
+	    (dev->funcs->read_wait != NULL)) {
+		/* The read is already counted, only add the time waited */
+		uint64_t start = io_stats_start();
+		int result = dev->funcs->read_wait(entity, length_read);
+
+		io_stats_end(dev, IO_STATS_READ, start, 0U, 0U);
+		return result;
+	}
+
+	*length_read = entity->async_length;
+
+	return entity->async_result;
+}
+
+
+/*
+ * Get the address at which the data from the current position of an IO entity
+ * can be accessed without reading it, if the device is backed by addressable
+ * memory. Returns -ENOTSUP otherwise.
+ */
+int io_map(uintptr_t handle, uintptr_t *addr)
+{
+	assert(is_valid_entity(handle) && (addr != NULL));
+
+	io_entity_t *entity = (io_entity_t *)handle;
+
+	io_dev_info_t *dev = entity->dev_handle;
+
+	if (dev->funcs->map == NULL) {
+		return -ENOTSUP;
+	}
+
+	return dev->funcs->map(entity, addr);
+}
+
+
 /* Write data to an IO entity */
 int io_write(uintptr_t handle,
 		const uintptr_t buffer,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2022, Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -11,6 +11,7 @@
 
 #include <common/bl_common.h>
 #include <common/debug.h>
+#include <drivers/auth/auth_mod.h>
 #include <drivers/auth/crypto_mod.h>
 #include <drivers/measured_boot/event_log/event_log.h>
 
@@ -24,6 +25,29 @@
 #  error Invalid TPM algorithm.
 #endif /* TPM_ALG_ID */
 
+#ifdef TPM_ALG_ID_EXTRA
+#if TPM_ALG_ID_EXTRA == TPM_ALG_SHA512
+#define	CRYPTO_MD_ID_EXTRA	CRYPTO_MD_SHA512
+#elif TPM_ALG_ID_EXTRA == TPM_ALG_SHA384
+#define	CRYPTO_MD_ID_EXTRA	CRYPTO_MD_SHA384
+#elif TPM_ALG_ID_EXTRA == TPM_ALG_SHA256
+#define	CRYPTO_MD_ID_EXTRA	CRYPTO_MD_SHA256
+#else
+#  error Invalid extra TPM algorithm.
+#endif /* TPM_ALG_ID_EXTRA */
+#endif /* TPM_ALG_ID_EXTRA */
+
+/*
+ * Images authenticated by hash are measured with the digest calculated to
+ * authenticate them, when it is available for the only bank of the log.
+ */
+#if MBOOT_REUSE_AUTH_DIGEST && !defined(TPM_ALG_ID_EXTRA) && \
+	(defined(IMAGE_BL1) || defined(IMAGE_BL2))
+#define	REUSE_AUTH_DIGEST	1
+#else
+#define	REUSE_AUTH_DIGEST	0
+#endif
+
 /* Running Event Log Pointer */
 static uint8_t *log_ptr;
 
@@ -78,7 +102,8 @@ static const event2_header_t locality_event_header = {
 /*
  * Record a measurement as a TCG_PCR_EVENT2 event
  *
- * @param[in] hash		Pointer to hash data of TCG_DIGEST_SIZE bytes
+ * @param[in] hash		Pointer to hash data of EVENT_LOG_DIGESTS_SIZE
+ *				bytes, the digest of each bank in turn
  * @param[in] event_type	Type of Event, Various Event Types are
  * 				mentioned in tcg.h header
  * @param[in] metadata_ptr	Pointer to event_log_metadata_t structure
@@ -131,9 +156,18 @@ void event_log_record(const uint8_t *hash, uint32_t event_type,
 
 	/* Copy digest */
 	(void)memcpy(ptr, (const void *)hash, TCG_DIGEST_SIZE);
+	ptr = (uint8_t *)((uintptr_t)ptr + TCG_DIGEST_SIZE);
+
+#ifdef TPM_ALG_ID_EXTRA
+	/* Same for the second bank, its digest follows the first one */
+	((tpmt_ha *)ptr)->algorithm_id = TPM_ALG_ID_EXTRA;
+	ptr = (uint8_t *)((uintptr_t)ptr + offsetof(tpmt_ha, digest));
+	(void)memcpy(ptr, (const void *)(hash + TCG_DIGEST_SIZE),
+		     TCG_DIGEST_SIZE_EXTRA);
+	ptr = (uint8_t *)((uintptr_t)ptr + TCG_DIGEST_SIZE_EXTRA);
+#endif
 
 	/* TCG_PCR_EVENT2.EventSize */
-	ptr = (uint8_t *)((uintptr_t)ptr + TCG_DIGEST_SIZE);
 	((event2_data_t *)ptr)->event_size = name_len;
 
 	/* Copy event data to TCG_PCR_EVENT2.Event */
@@ -192,6 +226,12 @@ void event_log_write_specid_event(void)
 	((id_event_algorithm_size_t *)ptr)->digest_size = TCG_DIGEST_SIZE;
 	ptr = (uint8_t *)((uintptr_t)ptr + sizeof(id_event_algorithm_size_t));
 
+#ifdef TPM_ALG_ID_EXTRA
+	((id_event_algorithm_size_t *)ptr)->algorithm_id = TPM_ALG_ID_EXTRA;
+	((id_event_algorithm_size_t *)ptr)->digest_size = TCG_DIGEST_SIZE_EXTRA;
+	ptr = (uint8_t *)((uintptr_t)ptr + sizeof(id_event_algorithm_size_t));
+#endif
+
 	/*
 	 * TCG_EfiSpecIDEventStruct.vendorInfoSize
 	 * No vendor data
@@ -235,6 +275,13 @@ void event_log_write_header(void)
 	ptr = (uint8_t *)((uintptr_t)ptr +
 			offsetof(tpmt_ha, digest) + TCG_DIGEST_SIZE);
 
+#ifdef TPM_ALG_ID_EXTRA
+	((tpmt_ha *)ptr)->algorithm_id = TPM_ALG_ID_EXTRA;
+	(void)memset(&((tpmt_ha *)ptr)->digest, 0, TCG_DIGEST_SIZE_EXTRA);
+	ptr = (uint8_t *)((uintptr_t)ptr +
+			offsetof(tpmt_ha, digest) + TCG_DIGEST_SIZE_EXTRA);
+#endif
+
 	/* TCG_PCR_EVENT2.EventSize */
 	((event2_data_t *)ptr)->event_size =
 		(uint32_t)sizeof(startup_locality_event_t);
@@ -252,12 +299,37 @@ void event_log_write_header(void)
 	log_ptr = (uint8_t *)((uintptr_t)ptr + sizeof(startup_locality_event_t));
 }
 
+/*
+ * Calculate the digests of the data for every bank of the Event Log, in the
+ * layout expected by event_log_record()
+ */
 int event_log_measure(uintptr_t data_base, uint32_t data_size,
-		      unsigned char hash_data[CRYPTO_MD_MAX_SIZE])
+		      unsigned char hash_data[EVENT_LOG_HASH_SIZE])
 {
+#ifdef TPM_ALG_ID_EXTRA
+	static const enum crypto_md_algo algs[HASH_ALG_COUNT] = {
+		CRYPTO_MD_ID, CRYPTO_MD_ID_EXTRA
+	};
+	unsigned char digests[HASH_ALG_COUNT][CRYPTO_MD_MAX_SIZE];
+	int rc;
+
+	/* Read the data once for both banks */
+	rc = crypto_mod_calc_hashes(algs, HASH_ALG_COUNT, (void *)data_base,
+				    data_size, digests);
+	if (rc != 0) {
+		return rc;
+	}
+
+	(void)memcpy(hash_data, digests[0], TCG_DIGEST_SIZE);
+	(void)memcpy(hash_data + TCG_DIGEST_SIZE, digests[1],
+		     TCG_DIGEST_SIZE_EXTRA);
+
+	return 0;
+#else
 	/* Calculate hash */
 	return crypto_mod_calc_hash(CRYPTO_MD_ID,
 				    (void *)data_base, data_size, hash_data);
+#endif
 }
 
 /*
@@ -276,7 +348,7 @@ int event_log_measure_and_record(uintptr_t data_base, uint32_t data_size,
 				 uint32_t data_id,
 				 const event_log_metadata_t *metadata_ptr)
 {
-	unsigned char hash_data[CRYPTO_MD_MAX_SIZE];
+	unsigned char hash_data[EVENT_LOG_HASH_SIZE];
 	int rc;
 
 	assert(metadata_ptr != NULL);
@@ -288,6 +360,16 @@ int event_log_measure_and_record(uintptr_t data_base, uint32_t data_size,
 	}
 	assert(metadata_ptr->id != EVLOG_INVALID_ID);
 
+#if REUSE_AUTH_DIGEST
+	/* Reuse the digest calculated to authenticate the payload, if any */
+	rc = auth_mod_get_img_digest(data_id, data_base, data_size,
+				     CRYPTO_MD_ID, hash_data);
+	if (rc == 0) {
+		event_log_record(hash_data, EV_POST_CODE, metadata_ptr);
+		return 0;
+	}
+#endif
+
 	/* Measure the payload with algorithm selected by EventLog driver */
 	rc = event_log_measure(data_base, data_size, hash_data);
 	if (rc != 0) {
@@ -1,5 +1,5 @@
 #
-# Copyright (c) 2020-2022, Arm Limited. All rights reserved.
+# Copyright (c) 2020-2026, Arm Limited. All rights reserved.
 #
 # SPDX-License-Identifier: BSD-3-Clause
 #
@@ -27,6 +27,37 @@ else
     TCG_DIGEST_SIZE		:=	32U
 endif #MBOOT_EL_HASH_ALG
 
+# Optional second Measured Boot hash algorithm. Every event then carries a
+# digest for both banks, calculated in a single pass over the measured data.
+ifdef MBOOT_EL_HASH_ALG_EXTRA
+    ifeq (${MBOOT_EL_HASH_ALG_EXTRA}, ${MBOOT_EL_HASH_ALG})
+        $(error "MBOOT_EL_HASH_ALG_EXTRA must differ from MBOOT_EL_HASH_ALG")
+    endif
+    ifeq (${PSA_CRYPTO},1)
+        $(error "MBOOT_EL_HASH_ALG_EXTRA is not supported with PSA_CRYPTO")
+    endif
+
+    ifeq (${MBOOT_EL_HASH_ALG_EXTRA}, sha512)
+        TPM_ALG_ID_EXTRA		:=	TPM_ALG_SHA512
+        TCG_DIGEST_SIZE_EXTRA	:=	64U
+    else ifeq (${MBOOT_EL_HASH_ALG_EXTRA}, sha384)
+        TPM_ALG_ID_EXTRA		:=	TPM_ALG_SHA384
+        TCG_DIGEST_SIZE_EXTRA	:=	48U
+    else ifeq (${MBOOT_EL_HASH_ALG_EXTRA}, sha256)
+        TPM_ALG_ID_EXTRA		:=	TPM_ALG_SHA256
+        TCG_DIGEST_SIZE_EXTRA	:=	32U
+    else
+        $(error "Invalid MBOOT_EL_HASH_ALG_EXTRA: ${MBOOT_EL_HASH_ALG_EXTRA}")
+    endif #MBOOT_EL_HASH_ALG_EXTRA
+
+    $(eval $(call add_defines,\
+        $(sort \
+            TPM_ALG_ID_EXTRA \
+            TCG_DIGEST_SIZE_EXTRA \
+    )))
+    $(eval $(call add_define,CRYPTO_MULTI_HASH))
+endif
+
 # Set definitions for Measured Boot driver.
 $(eval $(call add_defines,\
     $(sort \
@@ -1,13 +1,16 @@
 /*
- * Copyright (c) 2022-2023, Arm Limited. All rights reserved.
+ * Copyright (c) 2022-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 #include <assert.h>
+#include <errno.h>
 #include <stdint.h>
 #include <string.h>
 
 #include <common/debug.h>
+#include <drivers/arm/rse_comms.h>
+#include <drivers/auth/auth_mod.h>
 #include <drivers/auth/crypto_mod.h>
 #include <drivers/measured_boot/rse/rse_measured_boot.h>
 #include <lib/psa/measured_boot.h>
@@ -32,6 +35,16 @@
 #  error Invalid Measured Boot algorithm.
 #endif /* MBOOT_ALG_ID */
 
+/*
+ * Images authenticated by hash are measured with the digest calculated to
+ * authenticate them, when it was calculated with CRYPTO_MD_ID.
+ */
+#if MBOOT_REUSE_AUTH_DIGEST && (defined(IMAGE_BL1) || defined(IMAGE_BL2))
+#define	REUSE_AUTH_DIGEST	1
+#else
+#define	REUSE_AUTH_DIGEST	0
+#endif
+
 #if ENABLE_ASSERTIONS
 static bool null_arr(const uint8_t *signer_id, size_t signer_id_size)
 {
@@ -80,11 +93,19 @@ int rse_mboot_measure_and_record(struct rse_mboot_metadata *metadata_ptr,
 		return 0;
 	}
 
-	/* Calculate hash */
-	rc = crypto_mod_calc_hash(CRYPTO_MD_ID,
-				  (void *)data_base, data_size, hash_data);
+	/* Calculate hash, unless it was already when authenticating the image */
+	rc = -ENOENT;
+#if REUSE_AUTH_DIGEST
+	rc = auth_mod_get_img_digest(data_id, data_base, data_size,
+				     CRYPTO_MD_ID, hash_data);
+#endif
 	if (rc != 0) {
-		return rc;
+		rc = crypto_mod_calc_hash(CRYPTO_MD_ID,
+					  (void *)data_base, data_size,
+					  hash_data);
+		if (rc != 0) {
+			return rc;
+		}
 	}
 
 	ret = rse_measured_boot_extend_measurement(
@@ -157,3 +178,21 @@ int rse_mboot_set_signer_id(struct rse_mboot_metadata *metadata_ptr,
 
 	return 0;
 }
+
+/*
+ * Wait for RSE to handle the last measurement extended. Must be called before
+ * the next boot stage takes over the communication channel with RSE.
+ */
+int rse_mboot_finish(void)
+{
+#if RSE_MBOOT_ASYNC_EXTEND
+	psa_status_t ret;
+
+	ret = rse_comms_wait();
+	if (ret != PSA_SUCCESS) {
+		return ret;
+	}
+#endif
+
+	return 0;
+}
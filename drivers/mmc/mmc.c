@@ -32,6 +32,12 @@ static unsigned int mmc_flags;
 static struct mmc_device_info *mmc_dev_info;
 static unsigned int rca;
 static unsigned int scr[2]__aligned(16) = { 0 };
+static unsigned int mmc_clk;
+static unsigned int mmc_bus_width;
+/* Enumeration state between mmc_init_start() and mmc_init_wait() */
+static bool mmc_op_cond_pending;
+static bool mmc_enum_pending;
+static int mmc_enum_status;
 
 static const unsigned char tran_speed_base[16] = {
 	0, 10, 12, 13, 15, 20, 26, 30, 35, 40, 45, 52, 55, 60, 70, 80
@@ -390,14 +396,19 @@ static int sd_switch(unsigned int mode, unsigned char group,
 			 sizeof(sd_switch_func_status));
 }
 
-static int sd_send_op_cond(void)
+/* Returns -EAGAIN if the card is still powering up after 'retries' tries */
+static int sd_send_op_cond(int retries)
 {
 	int n;
 	unsigned int resp_data[4];
 
-	for (n = 0; n < SEND_OP_COND_MAX_RETRIES; n++) {
+	for (n = 0; n < retries; n++) {
 		int ret;
 
+		if (n != 0) {
+			mdelay(10);
+		}
+
 		/* CMD55: Application Specific Command */
 		ret = mmc_send_cmd(MMC_CMD(55), 0, MMC_RESPONSE_R1, NULL);
 		if (ret != 0) {
@@ -423,13 +434,9 @@ static int sd_send_op_cond(void)
 
 			return 0;
 		}
-
-		mdelay(10);
 	}
 
-	ERROR("ACMD41 failed after %d retries\n", SEND_OP_COND_MAX_RETRIES);
-
-	return -EIO;
+	return -EAGAIN;
 }
 
 static int mmc_reset_to_idle(void)
@@ -447,12 +454,17 @@ static int mmc_reset_to_idle(void)
 	return 0;
 }
 
-static int mmc_send_op_cond(void)
+/* Returns -EAGAIN if the device is still powering up after 'retries' tries */
+static int mmc_send_op_cond(int retries)
 {
 	int ret, n;
 	unsigned int resp_data[4];
 
-	for (n = 0; n < SEND_OP_COND_MAX_RETRIES; n++) {
+	for (n = 0; n < retries; n++) {
+		if (n != 0) {
+			mdelay(10);
+		}
+
 		ret = mmc_send_cmd(MMC_CMD(1), OCR_SECTOR_MODE |
 				   OCR_VDD_MIN_2V7 | OCR_VDD_MIN_1V7,
 				   MMC_RESPONSE_R3, &resp_data[0]);
@@ -464,16 +476,17 @@ static int mmc_send_op_cond(void)
 			mmc_ocr_value = resp_data[0];
 			return 0;
 		}
-
-		mdelay(10);
 	}
 
-	ERROR("CMD1 failed after %d retries\n", SEND_OP_COND_MAX_RETRIES);
-
-	return -EIO;
+	return -EAGAIN;
 }
 
-static int mmc_enumerate(unsigned int clk, unsigned int bus_width)
+/*
+ * Reset the device and send it the first CMD1 or ACMD41, which starts its
+ * power-up sequence. The power-up takes up to a second that the caller may
+ * spend on other work before completing the enumeration.
+ */
+static int mmc_enumerate_start(void)
 {
 	int ret;
 	unsigned int resp_data[4];
@@ -486,18 +499,49 @@ static int mmc_enumerate(unsigned int clk, unsigned int bus_width)
 	}
 
 	if (mmc_dev_info->mmc_dev_type == MMC_IS_EMMC) {
-		ret = mmc_send_op_cond();
+		ret = mmc_send_op_cond(1);
 	} else {
 		/* CMD8: Send Interface Condition Command */
 		ret = mmc_send_cmd(MMC_CMD(8), VHS_2_7_3_6_V | CMD8_CHECK_PATTERN,
 				   MMC_RESPONSE_R5, &resp_data[0]);
 
 		if ((ret == 0) && ((resp_data[0] & 0xffU) == CMD8_CHECK_PATTERN)) {
-			ret = sd_send_op_cond();
+			ret = sd_send_op_cond(1);
 		}
 	}
-	if (ret != 0) {
-		return ret;
+
+	mmc_op_cond_pending = (ret == -EAGAIN);
+	if (mmc_op_cond_pending) {
+		return 0;
+	}
+
+	return ret;
+}
+
+static int mmc_enumerate(unsigned int clk, unsigned int bus_width)
+{
+	int ret;
+	unsigned int resp_data[4];
+
+	if (mmc_op_cond_pending) {
+		mmc_op_cond_pending = false;
+
+		if (mmc_dev_info->mmc_dev_type == MMC_IS_EMMC) {
+			ret = mmc_send_op_cond(SEND_OP_COND_MAX_RETRIES);
+		} else {
+			ret = sd_send_op_cond(SEND_OP_COND_MAX_RETRIES);
+		}
+
+		if (ret == -EAGAIN) {
+			ERROR("%s failed after %d retries\n",
+			      (mmc_dev_info->mmc_dev_type == MMC_IS_EMMC) ?
+			      "CMD1" : "ACMD41", SEND_OP_COND_MAX_RETRIES);
+			return -EIO;
+		}
+
+		if (ret != 0) {
+			return ret;
+		}
 	}
 
 	/* CMD2: Card Identification */
@@ -597,6 +641,10 @@ size_t mmc_read_blocks(int lba, uintptr_t buf, size_t size)
 	       (size != 0U) &&
 	       ((size & MMC_BLOCK_MASK) == 0U));
 
+	if (mmc_init_wait() != 0) {
+		return 0;
+	}
+
 	ret = ops->prepare(lba, buf, size);
 	if (ret != 0) {
 		return 0;
@@ -665,6 +713,10 @@ size_t mmc_write_blocks(int lba, const uintptr_t buf, size_t size)
 	       ((buf & MMC_BLOCK_MASK) == 0U) &&
 	       ((size & MMC_BLOCK_MASK) == 0U));
 
+	if (mmc_init_wait() != 0) {
+		return 0;
+	}
+
 	ret = ops->prepare(lba, buf, size);
 	if (ret != 0) {
 		return 0;
@@ -728,6 +780,10 @@ size_t mmc_erase_blocks(int lba, size_t size)
 	assert(ops != NULL);
 	assert((size != 0U) && ((size & MMC_BLOCK_MASK) == 0U));
 
+	if (mmc_init_wait() != 0) {
+		return 0;
+	}
+
 	ret = mmc_send_cmd(MMC_CMD(35), lba, MMC_RESPONSE_R1, NULL);
 	if (ret != 0) {
 		return 0;
@@ -771,9 +827,15 @@ static unsigned char mmc_current_boot_part(void)
 
 int mmc_part_switch_current_boot(void)
 {
-	unsigned char current_boot_part = mmc_current_boot_part();
+	unsigned char current_boot_part;
 	int ret;
 
+	ret = mmc_init_wait();
+	if (ret != 0) {
+		return ret;
+	}
+
+	current_boot_part = mmc_current_boot_part();
 	if ((current_boot_part != 1U) && (current_boot_part != 2U)) {
 		ERROR("Got unexpected value for active boot partition, %u\n", current_boot_part);
 		return -EIO;
@@ -791,6 +853,11 @@ int mmc_part_switch_user(void)
 {
 	int ret;
 
+	ret = mmc_init_wait();
+	if (ret != 0) {
+		return ret;
+	}
+
 	ret = mmc_part_switch(PART_CFG_BOOT_PARTITION_NO_ACCESS);
 	if (ret < 0) {
 		ERROR("Failed to switch to user partition, %d\n", ret);
@@ -801,6 +868,10 @@ int mmc_part_switch_user(void)
 
 size_t mmc_boot_part_size(void)
 {
+	if (mmc_init_wait() != 0) {
+		return 0;
+	}
+
 	return mmc_ext_csd[CMD_EXTCSD_BOOT_SIZE_MULT] * SZ_128K;
 }
 
@@ -824,9 +895,9 @@ size_t mmc_boot_part_read_blocks(int lba, uintptr_t buf, size_t size)
 	return size_read;
 }
 
-int mmc_init(const struct mmc_ops *ops_ptr, unsigned int clk,
-	     unsigned int width, unsigned int flags,
-	     struct mmc_device_info *device_info)
+int mmc_init_start(const struct mmc_ops *ops_ptr, unsigned int clk,
+		   unsigned int width, unsigned int flags,
+		   struct mmc_device_info *device_info)
 {
 	assert((ops_ptr != NULL) &&
 	       (ops_ptr->init != NULL) &&
@@ -846,6 +917,35 @@ int mmc_init(const struct mmc_ops *ops_ptr, unsigned int clk,
 	ops = ops_ptr;
 	mmc_flags = flags;
 	mmc_dev_info = device_info;
+	mmc_clk = clk;
+	mmc_bus_width = width;
+
+	mmc_enum_status = mmc_enumerate_start();
+	mmc_enum_pending = (mmc_enum_status == 0);
+
+	return mmc_enum_status;
+}
+
+int mmc_init_wait(void)
+{
+	if (mmc_enum_pending) {
+		mmc_enum_pending = false;
+		mmc_enum_status = mmc_enumerate(mmc_clk, mmc_bus_width);
+	}
+
+	return mmc_enum_status;
+}
+
+int mmc_init(const struct mmc_ops *ops_ptr, unsigned int clk,
+	     unsigned int width, unsigned int flags,
+	     struct mmc_device_info *device_info)
+{
+	int ret;
+
+	ret = mmc_init_start(ops_ptr, clk, width, flags, device_info);
+	if (ret != 0) {
+		return ret;
+	}
 
-	return mmc_enumerate(clk, width);
+	return mmc_init_wait();
 }
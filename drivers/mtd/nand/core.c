@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2022, STMicroelectronics - All Rights Reserved
+ * Copyright (c) 2019-2026, STMicroelectronics - All Rights Reserved
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -20,6 +20,73 @@
  */
 static struct nand_device nand_dev;
 
+/*
+ * Number of blocks whose bad block status is kept in RAM once probed, so that
+ * the markers are read only once per boot. Zero disables the table.
+ */
+#ifndef PLATFORM_MTD_BBT_MAX_BLOCKS
+#define PLATFORM_MTD_BBT_MAX_BLOCKS	U(0)
+#endif
+
+#if PLATFORM_MTD_BBT_MAX_BLOCKS
+#define NAND_BBT_UNKNOWN	U(0)
+#define NAND_BBT_GOOD		U(1)
+#define NAND_BBT_BAD		U(2)
+#define NAND_BBT_MASK		U(3)
+#define NAND_BBT_BLOCKS_PER_BYTE	U(4)
+
+static uint8_t nand_bbt[(PLATFORM_MTD_BBT_MAX_BLOCKS +
+			 NAND_BBT_BLOCKS_PER_BYTE - 1U) /
+			NAND_BBT_BLOCKS_PER_BYTE];
+
+static unsigned int nand_bbt_get(unsigned int block)
+{
+	unsigned int shift = (block % NAND_BBT_BLOCKS_PER_BYTE) * 2U;
+
+	return (nand_bbt[block / NAND_BBT_BLOCKS_PER_BYTE] >> shift) &
+	       NAND_BBT_MASK;
+}
+
+static void nand_bbt_set(unsigned int block, unsigned int state)
+{
+	unsigned int shift = (block % NAND_BBT_BLOCKS_PER_BYTE) * 2U;
+	uint8_t *entry = &nand_bbt[block / NAND_BBT_BLOCKS_PER_BYTE];
+
+	*entry = (uint8_t)((*entry & ~(NAND_BBT_MASK << shift)) |
+			   (state << shift));
+}
+#endif
+
+/*
+ * Return 1 if the block is bad, 0 if it is good, or a negative errno. The
+ * device is only asked once per block when the bad block table is enabled.
+ */
+static int nand_block_is_bad(unsigned int block)
+{
+	int is_bad;
+
+#if PLATFORM_MTD_BBT_MAX_BLOCKS
+	if (block < PLATFORM_MTD_BBT_MAX_BLOCKS) {
+		unsigned int state = nand_bbt_get(block);
+
+		if (state != NAND_BBT_UNKNOWN) {
+			return (state == NAND_BBT_BAD) ? 1 : 0;
+		}
+	}
+#endif
+
+	is_bad = nand_dev.mtd_block_is_bad(block);
+
+#if PLATFORM_MTD_BBT_MAX_BLOCKS
+	if ((is_bad >= 0) && (block < PLATFORM_MTD_BBT_MAX_BLOCKS)) {
+		nand_bbt_set(block, (is_bad == 1) ? NAND_BBT_BAD :
+						    NAND_BBT_GOOD);
+	}
+#endif
+
+	return is_bad;
+}
+
 #pragma weak plat_get_scratch_buffer
 void plat_get_scratch_buffer(void **buffer_addr, size_t *buf_size)
 {
@@ -63,7 +130,7 @@ int nand_read(unsigned int offset, uintptr_t buffer, size_t length,
 	}
 
 	while (block <= end_block) {
-		is_bad = nand_dev.mtd_block_is_bad(block);
+		is_bad = nand_block_is_bad(block);
 		if (is_bad < 0) {
 			return is_bad;
 		}
@@ -152,7 +219,7 @@ int nand_seek_bb(uintptr_t base, unsigned int offset, size_t *extra_offset)
 			return -EIO;
 		}
 
-		is_bad = nand_dev.mtd_block_is_bad(block);
+		is_bad = nand_block_is_bad(block);
 		if (is_bad < 0) {
 			return is_bad;
 		}
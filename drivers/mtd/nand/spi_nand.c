@@ -118,6 +118,8 @@ static int spi_nand_wait_ready(uint8_t *status)
 		if ((*status & SPI_NAND_STATUS_BUSY) == 0U) {
 			return 0;
 		}
+
+		timeout_wait_event(timeout);
 	}
 
 	return -ETIMEDOUT;
@@ -1,11 +1,12 @@
 /*
- * Copyright (c) 2019-2022, STMicroelectronics - All Rights Reserved
+ * Copyright (c) 2019-2026, STMicroelectronics - All Rights Reserved
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
 #include <assert.h>
 #include <errno.h>
+#include <stdbool.h>
 #include <stddef.h>
 
 #include <common/debug.h>
@@ -27,6 +28,69 @@
 
 #define SPI_READY_TIMEOUT_US	40000U
 
+/* SFDP (JESD216) definitions */
+#define SFDP_SIGNATURE		0x50444653U	/* "SFDP" */
+#define SFDP_BFPT_ID		0xFF00U		/* Basic Flash Parameter Table */
+#define SFDP_4BAIT_ID		0xFF84U		/* 4-byte Address Instruction */
+#define SFDP_MAX_PARAM_HEADERS	8U
+#define SFDP_BFPT_MIN_DWORDS	9U
+#define SFDP_BFPT_DWORDS	4U		/* Only the first ones are used */
+
+#define BFPT_DWORD1_FAST_READ_1_1_2	BIT(16)
+#define BFPT_DWORD1_ADDR_BYTES_SHIFT	17
+#define BFPT_DWORD1_ADDR_BYTES_MASK	GENMASK(18, 17)
+#define BFPT_DWORD1_ADDR_3_ONLY		0U
+#define BFPT_DWORD1_ADDR_3_OR_4		1U
+#define BFPT_DWORD1_ADDR_4_ONLY		2U
+#define BFPT_DWORD1_FAST_READ_1_2_2	BIT(20)
+#define BFPT_DWORD1_FAST_READ_1_4_4	BIT(21)
+#define BFPT_DWORD1_FAST_READ_1_1_4	BIT(22)
+#define BFPT_DWORD2_DENSITY_EXP		BIT(31)
+
+struct sfdp_header {
+	uint32_t signature;
+	uint8_t minor;
+	uint8_t major;
+	uint8_t nph;		/* Number of parameter headers, minus one */
+	uint8_t unused;
+};
+
+struct sfdp_param_header {
+	uint8_t id_lsb;
+	uint8_t minor;
+	uint8_t major;
+	uint8_t length;		/* In DWORDs */
+	uint8_t ptp[3];		/* Parameter table pointer */
+	uint8_t id_msb;
+};
+
+/*
+ * Fast read modes described by the BFPT, from the fastest to the slowest.
+ * The wait states, mode clocks and opcode of a mode are stored as a 16-bit
+ * field of a BFPT DWORD.
+ */
+struct sfdp_read_mode {
+	uint32_t support;	/* BFPT DWORD1 bit, 0 if always supported */
+	uint8_t dword;		/* BFPT DWORD holding the settings (1-based) */
+	uint8_t shift;		/* Bit offset of the settings in that DWORD */
+	uint8_t addr_buswidth;
+	uint8_t data_buswidth;
+	uint8_t opcode_4b;	/* Opcode of the 4-byte address variant */
+	uint8_t bait_bit;	/* Bit of the 4-byte variant in 4BAIT DWORD1 */
+};
+
+static const struct sfdp_read_mode sfdp_read_modes[] = {
+	{ BFPT_DWORD1_FAST_READ_1_4_4, 3U, 0U, 4U, 4U,
+	  SPI_NOR_OP_READ_1_4_4_4B, 5U },
+	{ BFPT_DWORD1_FAST_READ_1_1_4, 3U, 16U, 1U, 4U,
+	  SPI_NOR_OP_READ_1_1_4_4B, 4U },
+	{ BFPT_DWORD1_FAST_READ_1_2_2, 4U, 16U, 2U, 2U,
+	  SPI_NOR_OP_READ_1_2_2_4B, 3U },
+	{ BFPT_DWORD1_FAST_READ_1_1_2, 4U, 0U, 1U, 2U,
+	  SPI_NOR_OP_READ_1_1_2_4B, 2U },
+	{ 0U, 0U, 0U, 1U, 1U, SPI_NOR_OP_READ_FAST_4B, 1U },
+};
+
 static struct nor_device nor_dev;
 
 #pragma weak plat_get_nor_data
@@ -116,6 +180,8 @@ static int spi_nor_wait_ready(void)
 		if (ret <= 0) {
 			return ret;
 		}
+
+		timeout_wait_event(timeout);
 	}
 
 	return -ETIMEDOUT;
@@ -274,6 +340,219 @@ static int spi_nor_read_bar(void)
 	return 0;
 }
 
+static int spi_nor_read_sfdp(uint32_t addr, void *buf, size_t len)
+{
+	struct spi_mem_op op;
+
+	zeromem(&op, sizeof(struct spi_mem_op));
+	op.cmd.opcode = SPI_NOR_OP_READ_SFDP;
+	op.cmd.buswidth = SPI_MEM_BUSWIDTH_1_LINE;
+	op.addr.nbytes = 3U;
+	op.addr.buswidth = SPI_MEM_BUSWIDTH_1_LINE;
+	op.addr.val = addr;
+	op.dummy.nbytes = 1U;
+	op.dummy.buswidth = SPI_MEM_BUSWIDTH_1_LINE;
+	op.data.buswidth = SPI_MEM_BUSWIDTH_1_LINE;
+	op.data.dir = SPI_MEM_DATA_IN;
+	op.data.nbytes = len;
+	op.data.buf = buf;
+
+	return spi_mem_exec_op(&op);
+}
+
+static uint32_t sfdp_get_u32(const uint8_t *p)
+{
+	return (uint32_t)p[0] | ((uint32_t)p[1] << 8) |
+	       ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint32_t sfdp_param_id(const struct sfdp_param_header *ph)
+{
+	return ((uint32_t)ph->id_msb << 8) | ph->id_lsb;
+}
+
+static uint32_t sfdp_param_addr(const struct sfdp_param_header *ph)
+{
+	return (uint32_t)ph->ptp[0] | ((uint32_t)ph->ptp[1] << 8) |
+	       ((uint32_t)ph->ptp[2] << 16);
+}
+
+/*
+ * Build the read operation for one BFPT fast read mode. Return false if the
+ * mode is not usable with this device or bus.
+ */
+static bool spi_nor_sfdp_read_op(const struct sfdp_read_mode *mode,
+				 const uint32_t *bfpt, struct spi_mem_op *op)
+{
+	unsigned int cycles;
+	uint32_t settings;
+
+	if ((mode->support != 0U) && ((bfpt[0] & mode->support) == 0U)) {
+		return false;
+	}
+
+	zeromem(op, sizeof(struct spi_mem_op));
+
+	if (mode->dword == 0U) {
+		/* 1-1-1 fast read, always 8 dummy clocks */
+		op->cmd.opcode = SPI_NOR_OP_READ_FAST;
+		cycles = 8U;
+	} else {
+		settings = bfpt[mode->dword - 1U] >> mode->shift;
+		/* Wait states plus mode clocks */
+		cycles = (settings & 0x1FU) + ((settings >> 5) & 0x7U);
+		op->cmd.opcode = (settings >> 8) & 0xFFU;
+	}
+
+	/* Dummy cycles are expressed as whole bytes on the address lines */
+	if (((cycles * mode->addr_buswidth) % 8U) != 0U) {
+		return false;
+	}
+
+	op->cmd.buswidth = SPI_MEM_BUSWIDTH_1_LINE;
+	op->addr.nbytes = 3U;
+	op->addr.buswidth = mode->addr_buswidth;
+	op->dummy.nbytes = (cycles * mode->addr_buswidth) / 8U;
+	op->dummy.buswidth = mode->addr_buswidth;
+	op->data.buswidth = mode->data_buswidth;
+	op->data.dir = SPI_MEM_DATA_IN;
+
+	/* The data phase is only checked if it has a length */
+	op->data.nbytes = 1U;
+	if (!spi_mem_supports_op(op)) {
+		return false;
+	}
+	op->data.nbytes = 0U;
+
+	return true;
+}
+
+/*
+ * Parse the SFDP tables of the device to select the fastest read operation
+ * supported by both the device and the bus. Devices larger than 16MB use
+ * 4-byte addresses when possible, so that no bank register has to be
+ * switched while reading.
+ */
+static int spi_nor_sfdp_setup(void)
+{
+	struct sfdp_header header;
+	struct sfdp_param_header ph, bfpt_ph, bait_ph;
+	uint8_t buf[SFDP_BFPT_DWORDS * sizeof(uint32_t)];
+	uint32_t bfpt[SFDP_BFPT_DWORDS];
+	uint32_t bait = 0U;
+	struct spi_mem_op op;
+	unsigned long long density;
+	unsigned int addr_mode;
+	unsigned int i, nph, exp;
+	bool found_bfpt = false;
+	bool found_bait = false;
+	int ret;
+
+	ret = spi_nor_read_sfdp(0U, &header, sizeof(header));
+	if (ret != 0) {
+		return ret;
+	}
+
+	if (sfdp_get_u32((uint8_t *)&header.signature) != SFDP_SIGNATURE) {
+		return -ENOTSUP;
+	}
+
+	nph = MIN((unsigned int)header.nph + 1U, SFDP_MAX_PARAM_HEADERS);
+	for (i = 0U; i < nph; i++) {
+		ret = spi_nor_read_sfdp(sizeof(header) + (i * sizeof(ph)),
+					&ph, sizeof(ph));
+		if (ret != 0) {
+			return ret;
+		}
+
+		/* Prefer the latest revision of each table */
+		if ((sfdp_param_id(&ph) == SFDP_BFPT_ID) &&
+		    (ph.length >= SFDP_BFPT_MIN_DWORDS) &&
+		    (!found_bfpt || (ph.major > bfpt_ph.major) ||
+		     ((ph.major == bfpt_ph.major) &&
+		      (ph.minor > bfpt_ph.minor)))) {
+			bfpt_ph = ph;
+			found_bfpt = true;
+		} else if ((sfdp_param_id(&ph) == SFDP_4BAIT_ID) &&
+			   (ph.length >= 1U)) {
+			bait_ph = ph;
+			found_bait = true;
+		} else {
+			/* Other tables are not used */
+		}
+	}
+
+	if (!found_bfpt) {
+		return -ENOTSUP;
+	}
+
+	ret = spi_nor_read_sfdp(sfdp_param_addr(&bfpt_ph), buf, sizeof(buf));
+	if (ret != 0) {
+		return ret;
+	}
+
+	for (i = 0U; i < SFDP_BFPT_DWORDS; i++) {
+		bfpt[i] = sfdp_get_u32(&buf[i * sizeof(uint32_t)]);
+	}
+
+	if (found_bait) {
+		ret = spi_nor_read_sfdp(sfdp_param_addr(&bait_ph), buf,
+					sizeof(uint32_t));
+		if (ret != 0) {
+			return ret;
+		}
+
+		bait = sfdp_get_u32(buf);
+	}
+
+	if (nor_dev.size == 0U) {
+		if ((bfpt[1] & BFPT_DWORD2_DENSITY_EXP) != 0U) {
+			exp = bfpt[1] & ~BFPT_DWORD2_DENSITY_EXP;
+			density = (exp < 64U) ? (1ULL << exp) : 0ULL;
+		} else {
+			density = (unsigned long long)bfpt[1] + 1ULL;
+		}
+
+		density /= 8U;
+		if ((density == 0U) || (density > UINT32_MAX)) {
+			return -ENOTSUP;
+		}
+
+		nor_dev.size = (uint32_t)density;
+	}
+
+	for (i = 0U; i < ARRAY_SIZE(sfdp_read_modes); i++) {
+		if (spi_nor_sfdp_read_op(&sfdp_read_modes[i], bfpt, &op)) {
+			break;
+		}
+	}
+
+	if (i == ARRAY_SIZE(sfdp_read_modes)) {
+		return -ENOTSUP;
+	}
+
+	addr_mode = (bfpt[0] & BFPT_DWORD1_ADDR_BYTES_MASK) >>
+		    BFPT_DWORD1_ADDR_BYTES_SHIFT;
+	if (addr_mode == BFPT_DWORD1_ADDR_4_ONLY) {
+		op.addr.nbytes = 4U;
+	} else if ((addr_mode == BFPT_DWORD1_ADDR_3_OR_4) &&
+		   (nor_dev.size > BANK_SIZE) &&
+		   ((bait & BIT(sfdp_read_modes[i].bait_bit)) != 0U)) {
+		op.cmd.opcode = sfdp_read_modes[i].opcode_4b;
+		op.addr.nbytes = 4U;
+	} else {
+		/* Keep 3-byte addresses, with a bank register if needed */
+	}
+
+	nor_dev.read_op = op;
+
+	INFO("SFDP: read op 0x%x (1-%u-%u), %u address bytes\n",
+	     op.cmd.opcode, op.addr.buswidth, op.data.buswidth,
+	     op.addr.nbytes);
+
+	return 0;
+}
+
 int spi_nor_read(unsigned int offset, uintptr_t buffer, size_t length,
 		 size_t *length_read)
 {
@@ -339,9 +618,17 @@ int spi_nor_init(unsigned long long *size, unsigned int *erase_size)
 		return -EINVAL;
 	}
 
+	if ((nor_dev.flags & SPI_NOR_USE_SFDP) != 0U) {
+		ret = spi_nor_sfdp_setup();
+		if (ret != 0) {
+			WARN("SFDP not usable (%d), keep default read op\n",
+			     ret);
+		}
+	}
+
 	assert(nor_dev.size != 0U);
 
-	if (nor_dev.size > BANK_SIZE) {
+	if ((nor_dev.size > BANK_SIZE) && (nor_dev.read_op.addr.nbytes < 4U)) {
 		nor_dev.flags |= SPI_NOR_USE_BANK;
 	}
 
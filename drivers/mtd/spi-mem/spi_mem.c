@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2022, STMicroelectronics - All Rights Reserved
+ * Copyright (c) 2019-2026, STMicroelectronics - All Rights Reserved
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -60,7 +60,14 @@ static bool spi_mem_check_buswidth_req(uint8_t buswidth, bool tx)
 	return false;
 }
 
-static bool spi_mem_supports_op(const struct spi_mem_op *op)
+/*
+ * spi_mem_supports_op() - Check if a memory operation is supported.
+ * @op: The memory operation to check.
+ *
+ * Return: true if the bus width of every phase of @op is allowed by the SPI
+ * mode of the slave, false otherwise.
+ */
+bool spi_mem_supports_op(const struct spi_mem_op *op)
 {
 	if (!spi_mem_check_buswidth_req(op->cmd.buswidth, true)) {
 		return false;
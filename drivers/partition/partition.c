@@ -1,11 +1,12 @@
 /*
- * Copyright (c) 2016-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2016-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
 #include <assert.h>
 #include <inttypes.h>
+#include <stdbool.h>
 #include <stdio.h>
 #include <string.h>
 
@@ -16,11 +17,77 @@
 #include <drivers/partition/partition.h>
 #include <drivers/partition/gpt.h>
 #include <drivers/partition/mbr.h>
+#include <lib/utils_def.h>
 #include <plat/common/platform.h>
 
 static uint8_t mbr_sector[PLAT_PARTITION_BLOCK_SIZE];
 static partition_entry_list_t list;
 
+/*
+ * Open addressing hash indexes of the loaded entries, by name and by unique
+ * partition GUID. Each slot holds an index into list.list[] plus one, 0 for
+ * an empty slot. They are only used once a table has been fully loaded.
+ */
+#define PARTITION_INDEX_SIZE	(2U * PLAT_PARTITION_MAX_ENTRIES)
+
+static uint16_t name_index[PARTITION_INDEX_SIZE];
+static uint16_t guid_index[PARTITION_INDEX_SIZE];
+static bool index_valid;
+
+/* FNV-1a hash */
+static uint32_t partition_hash(const uint8_t *data, size_t len)
+{
+	uint32_t hash = 2166136261U;
+	size_t i;
+
+	for (i = 0U; (i < len) && (data[i] != 0U); i++) {
+		hash = (hash ^ data[i]) * 16777619U;
+	}
+
+	return hash;
+}
+
+static uint32_t guid_hash(const struct efi_guid *guid)
+{
+	const uint8_t *data = (const uint8_t *)guid;
+	uint32_t hash = 2166136261U;
+	size_t i;
+
+	for (i = 0U; i < sizeof(struct efi_guid); i++) {
+		hash = (hash ^ data[i]) * 16777619U;
+	}
+
+	return hash;
+}
+
+static void index_insert(uint16_t *index, uint32_t hash, unsigned int entry)
+{
+	unsigned int slot = hash % PARTITION_INDEX_SIZE;
+
+	while (index[slot] != 0U) {
+		slot = (slot + 1U) % PARTITION_INDEX_SIZE;
+	}
+
+	index[slot] = (uint16_t)(entry + 1U);
+}
+
+static void build_index(void)
+{
+	unsigned int i;
+
+	(void)memset(name_index, 0, sizeof(name_index));
+	(void)memset(guid_index, 0, sizeof(guid_index));
+
+	for (i = 0U; i < list.entry_count; i++) {
+		index_insert(name_index,
+			     partition_hash((uint8_t *)list.list[i].name,
+					    EFI_NAMELEN), i);
+		index_insert(guid_index, guid_hash(&list.list[i].part_guid), i);
+	}
+
+	index_valid = true;
+}
+
 #if LOG_LEVEL >= LOG_LEVEL_VERBOSE
 static void dump_entries(int num)
 {
@@ -204,38 +271,23 @@ static int load_mbr_entries(uintptr_t image_handle)
 	return 0;
 }
 
-/*
- * Try to read and load a single GPT entry.
- */
-static int load_gpt_entry(uintptr_t image_handle, gpt_entry_t *entry)
-{
-	size_t bytes_read = 0U;
-	int result;
-
-	assert(entry != NULL);
-	result = io_read(image_handle, (uintptr_t)entry, sizeof(gpt_entry_t),
-			&bytes_read);
-	if ((result != 0) || (sizeof(gpt_entry_t) != bytes_read)) {
-		VERBOSE("GPT Entry read error(%i) or read mismatch occurred,"
-			"expected(%zu) and actual(%zu)\n", result,
-			sizeof(gpt_entry_t), bytes_read);
-		return -EINVAL;
-	}
-
-	return result;
-}
-
 /*
  * Retrieve each entry in the partition table, parse the data from each
- * entry and store them in the list of partition table entries.
+ * entry and store them in the list of partition table entries. Entries are
+ * read one block at a time and the CRC of the entry array is accumulated
+ * as they come in.
  */
 static int load_partition_gpt(uintptr_t image_handle, gpt_header_t header)
 {
 	const signed long long gpt_entry_offset = LBA(header.part_lba);
+	const unsigned int entries_per_block =
+		PLAT_PARTITION_BLOCK_SIZE / sizeof(gpt_entry_t);
 	gpt_entry_t entry;
-	int result;
-	unsigned int i;
+	size_t bytes_read, size;
+	unsigned int i, nb_valid = 0U;
+	bool parsing = true;
 	uint32_t calc_crc = 0U;
+	int result;
 
 	result = io_seek(image_handle, IO_SEEK_SET, gpt_entry_offset);
 	if (result != 0) {
@@ -244,23 +296,37 @@ static int load_partition_gpt(uintptr_t image_handle, gpt_header_t header)
 		return result;
 	}
 
-	for (i = 0U; i < list.entry_count; i++) {
-		result = load_gpt_entry(image_handle, &entry);
-		if (result != 0) {
-			VERBOSE("Failed to load gpt entry data(%u) error is (%i)\n",
-				i, result);
-			return result;
+	/* The MBR sector buffer is free once the headers have been read */
+	for (i = 0U; i < header.list_num; i++) {
+		if ((i % entries_per_block) == 0U) {
+			size = MIN(header.list_num - i, entries_per_block) *
+			       sizeof(gpt_entry_t);
+			bytes_read = 0U;
+			result = io_read(image_handle, (uintptr_t)mbr_sector,
+					 size, &bytes_read);
+			if ((result != 0) || (bytes_read != size)) {
+				VERBOSE("GPT Entry read error(%i) or read "
+					"mismatch occurred, expected(%zu) and "
+					"actual(%zu)\n", result, size,
+					bytes_read);
+				return -EINVAL;
+			}
 		}
 
-		result = parse_gpt_entry(&entry, &list.list[i]);
-		if (result != 0) {
-			result = io_seek(image_handle, IO_SEEK_SET,
-					(gpt_entry_offset + (i * sizeof(gpt_entry_t))));
-			if (result != 0) {
-				VERBOSE("Failed to seek (%i)\n", result);
-				return result;
+		(void)memcpy(&entry, &mbr_sector[(i % entries_per_block) *
+						 sizeof(gpt_entry_t)],
+			     sizeof(gpt_entry_t));
+
+		/*
+		 * Entries are used up to the first one that does not parse,
+		 * the others are only needed for the CRC.
+		 */
+		if (parsing && (i < list.entry_count)) {
+			if (parse_gpt_entry(&entry, &list.list[i]) == 0) {
+				nb_valid++;
+			} else {
+				parsing = false;
 			}
-			break;
 		}
 
 		/*
@@ -269,7 +335,8 @@ static int load_partition_gpt(uintptr_t image_handle, gpt_header_t header)
 		 */
 		calc_crc = tf_crc32(calc_crc, (uint8_t *)&entry, sizeof(gpt_entry_t));
 	}
-	if (i == 0) {
+
+	if (nb_valid == 0U) {
 		VERBOSE("No Valid GPT Entries found\n");
 		return -EINVAL;
 	}
@@ -278,26 +345,9 @@ static int load_partition_gpt(uintptr_t image_handle, gpt_header_t header)
 	 * Only records the valid partition number that is loaded from
 	 * partition table.
 	 */
-	list.entry_count = i;
+	list.entry_count = nb_valid;
 	dump_entries(list.entry_count);
 
-	/*
-	 * If there are less valid entries than the possible number of entries
-	 * from the header, continue to load the partition entry table to
-	 * calculate the full CRC in order to check against the partition CRC
-	 * from the header for validation.
-	 */
-	for (; i < header.list_num; i++) {
-		result = load_gpt_entry(image_handle, &entry);
-		if (result != 0) {
-			VERBOSE("Failed to load gpt entry data(%u) error is (%i)\n",
-				i, result);
-			return result;
-		}
-
-		calc_crc = tf_crc32(calc_crc, (uint8_t *)&entry, sizeof(gpt_entry_t));
-	}
-
 	if (header.part_crc != calc_crc) {
 		ERROR("Invalid GPT Partition Array Entry CRC: Expected 0x%x"
 				" but got 0x%x.\n", header.part_crc, calc_crc);
@@ -415,24 +465,33 @@ int load_partition_table(unsigned int image_id)
 		return result;
 	}
 
+	index_valid = false;
+
 	result = load_mbr_header(image_handle, &mbr_entry);
 	if (result != 0) {
 		VERBOSE("Failed to access image id=%u (%i)\n", image_id, result);
-		goto out;
+		io_close(image_handle);
+		return result;
 	}
+
 	if (mbr_entry.type == PARTITION_TYPE_GPT) {
 		result = load_primary_gpt(image_handle, mbr_entry.first_lba);
-		if (result != 0) {
-			io_close(image_handle);
-			return load_backup_gpt(BKUP_GPT_IMAGE_ID,
-					       mbr_entry.sector_nums);
-		}
 	} else {
 		result = load_mbr_entries(image_handle);
 	}
 
-out:
 	io_close(image_handle);
+
+	/* The backup GPT is only looked at if the primary one is unusable */
+	if ((result != 0) && (mbr_entry.type == PARTITION_TYPE_GPT)) {
+		result = load_backup_gpt(BKUP_GPT_IMAGE_ID,
+					 mbr_entry.sector_nums);
+	}
+
+	if (result == 0) {
+		build_index();
+	}
+
 	return result;
 }
 
@@ -441,7 +500,21 @@ out:
  */
 const partition_entry_t *get_partition_entry(const char *name)
 {
-	unsigned int i;
+	unsigned int i, slot;
+
+	if (index_valid) {
+		slot = partition_hash((const uint8_t *)name, EFI_NAMELEN) %
+		       PARTITION_INDEX_SIZE;
+		while (name_index[slot] != 0U) {
+			i = name_index[slot] - 1U;
+			if (strcmp(name, list.list[i].name) == 0) {
+				return &list.list[i];
+			}
+			slot = (slot + 1U) % PARTITION_INDEX_SIZE;
+		}
+
+		return NULL;
+	}
 
 	for (i = 0U; i < list.entry_count; i++) {
 		if (strcmp(name, list.list[i].name) == 0) {
@@ -474,7 +547,20 @@ const partition_entry_t *get_partition_entry_by_type(
 const partition_entry_t *get_partition_entry_by_guid(
 	const struct efi_guid *part_guid)
 {
-	unsigned int i;
+	unsigned int i, slot;
+
+	if (index_valid) {
+		slot = guid_hash(part_guid) % PARTITION_INDEX_SIZE;
+		while (guid_index[slot] != 0U) {
+			i = guid_index[slot] - 1U;
+			if (guidcmp(part_guid, &list.list[i].part_guid) == 0) {
+				return &list.list[i];
+			}
+			slot = (slot + 1U) % PARTITION_INDEX_SIZE;
+		}
+
+		return NULL;
+	}
 
 	for (i = 0U; i < list.entry_count; i++) {
 		if (guidcmp(part_guid, &list.list[i].part_guid) == 0) {
@@ -478,11 +478,13 @@ static int rpi3_sdhost_read(int lba, uintptr_t buf, size_t size)
 	uint32_t *buf1 = ((uint32_t *) buf);
 	uintptr_t reg_base = rpi3_sdhost_params.reg_base;
 	int timeout = 100000;
-	int remaining_words = 0;
+	size_t words = size / 4;
+	size_t i = 0;
 
-	for (int i = 0; i < size / 4; i++) {
+	while (i < words) {
 		volatile int t = timeout;
 		uint32_t hsts_err;
+		size_t level;
 
 		while ((mmio_read_32(reg_base + HC_HOSTSTATUS)
 			& HC_HSTST_HAVEDATA) == 0) {
@@ -498,12 +500,25 @@ static int rpi3_sdhost_read(int lba, uintptr_t buf, size_t size)
 		if (t == 0)
 			break;
 
-		uint32_t data = mmio_read_32(reg_base + HC_DATAPORT);
+		/*
+		 * Read all the words the FIFO holds in one go, rather than
+		 * waiting between words for it to fill up.
+		 */
+		level = (mmio_read_32(reg_base + HC_DEBUG) >>
+			 HC_DBG_FIFO_LEVEL_SHIFT) & HC_DBG_FIFO_THRESH_MASK;
+		level = MIN(MAX(level, (size_t)1U), words - i);
+
+		for (; level > 0U; level--, i++) {
+			uint32_t data = mmio_read_32(reg_base + HC_DATAPORT);
+
+			if (buf1)
+				buf1[i] = data;
+		}
 
 		hsts_err = mmio_read_32(reg_base + HC_HOSTSTATUS)
 			& HC_HSTST_MASK_ERROR_ALL;
 		if (hsts_err) {
-			ERROR("rpi3_sdhost: transfer FIFO word %d: 0x%x\n",
+			ERROR("rpi3_sdhost: transfer FIFO word %zu: 0x%x\n",
 			      i,
 			      mmio_read_32(reg_base + HC_HOSTSTATUS));
 			rpi3_sdhost_print_regs();
@@ -513,18 +528,6 @@ static int rpi3_sdhost_read(int lba, uintptr_t buf, size_t size)
 			/* clean the error status */
 			mmio_write_32(reg_base + HC_HOSTSTATUS, hsts_err);
 		}
-
-		if (buf1)
-			buf1[i] = data;
-
-		/* speeding up if the remaining words are still a lot */
-		remaining_words = (mmio_read_32(reg_base + HC_DEBUG) >> 4)
-			& HC_DBG_FIFO_THRESH_MASK;
-		if (remaining_words >= 7)
-			continue;
-
-		/* delay. slowing down the read process */
-		udelay(100);
 	}
 
 	/* We decide to stop by ourselves.
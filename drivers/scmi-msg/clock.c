@@ -221,6 +221,18 @@ static void scmi_clock_rate_set(struct scmi_msg *msg)
 	scmi_status_response(msg, status);
 }
 
+int32_t scmi_clock_fastcall_rate_set(unsigned int agent_id,
+				     unsigned int scmi_id, unsigned long rate)
+{
+	scmi_id = SPECULATION_SAFE_VALUE(scmi_id);
+
+	if (scmi_id >= plat_scmi_clock_count(agent_id)) {
+		return SCMI_INVALID_PARAMETERS;
+	}
+
+	return plat_scmi_clock_set_rate(agent_id, scmi_id, rate);
+}
+
 static void scmi_clock_config_set(struct scmi_msg *msg)
 {
 	const struct scmi_clock_config_set_a2p *in_args = (void *)msg->in;
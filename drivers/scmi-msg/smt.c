@@ -12,6 +12,8 @@
 #include <drivers/scmi.h>
 #include <lib/cassert.h>
 #include <lib/mmio.h>
+#include <lib/pmf/pmf.h>
+#include <lib/runtime_instr.h>
 #include <lib/spinlock.h>
 #include <lib/utils.h>
 #include <plat/common/platform.h>
@@ -122,6 +124,12 @@ static void scmi_proccess_smt(unsigned int agent_id, uint32_t *payload_buf)
 	smt_hdr = channel_to_smt_hdr(chan);
 	assert(smt_hdr);
 
+#if ENABLE_RUNTIME_INSTRUMENTATION
+	PMF_CAPTURE_TIMESTAMP(rt_instr_svc,
+	    RT_INSTR_ENTER_SCMI_MSG,
+	    PMF_NO_CACHE_MAINT);
+#endif
+
 	smt_status = __atomic_load_n(&smt_hdr->status, __ATOMIC_RELAXED);
 
 	if (!channel_set_busy(chan)) {
@@ -174,6 +182,28 @@ out:
 	} else {
 		smt_hdr->status |= SMT_STATUS_FREE;
 	}
+
+#if ENABLE_RUNTIME_INSTRUMENTATION
+	PMF_CAPTURE_TIMESTAMP(rt_instr_svc,
+	    RT_INSTR_EXIT_SCMI_MSG,
+	    PMF_NO_CACHE_MAINT);
+#endif
+}
+
+/* Return true if the agent has posted a message in its channel */
+static bool channel_has_message(unsigned int agent_id)
+{
+	struct scmi_msg_channel *chan = plat_scmi_get_channel(agent_id);
+	uint32_t smt_status;
+
+	if ((chan == NULL) || (channel_to_smt_hdr(chan) == NULL)) {
+		return false;
+	}
+
+	smt_status = __atomic_load_n(&channel_to_smt_hdr(chan)->status,
+				     __ATOMIC_RELAXED);
+
+	return (smt_status & SMT_STATUS_FREE) == 0U;
 }
 
 void scmi_smt_fastcall_smc_entry(unsigned int agent_id)
@@ -182,6 +212,22 @@ void scmi_smt_fastcall_smc_entry(unsigned int agent_id)
 			  fast_smc_payload[plat_my_core_pos()]);
 }
 
+unsigned int scmi_smt_fastcall_smc_entry_all(unsigned int agent_count)
+{
+	uint32_t *payload_buf = fast_smc_payload[plat_my_core_pos()];
+	unsigned int agent_id;
+	unsigned int count = 0U;
+
+	for (agent_id = 0U; agent_id < agent_count; agent_id++) {
+		if (channel_has_message(agent_id)) {
+			scmi_proccess_smt(agent_id, payload_buf);
+			count++;
+		}
+	}
+
+	return count;
+}
+
 void scmi_smt_interrupt_entry(unsigned int agent_id)
 {
 	scmi_proccess_smt(agent_id,
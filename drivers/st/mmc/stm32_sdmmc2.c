@@ -162,10 +162,28 @@ static struct stm32_sdmmc2_params sdmmc2_params;
 
 static bool next_cmd_is_acmd;
 
+/*
+ * The IDMA reaches both SYSRAM and DDR, platforms with an instance or a
+ * memory it cannot access override this function.
+ */
 #pragma weak plat_sdmmc2_use_dma
 bool plat_sdmmc2_use_dma(unsigned int instance, unsigned int memory)
 {
-	return false;
+	return true;
+}
+
+/*
+ * The buffer is invalidated around the transfer, so it must not share a cache
+ * line with other data. Smaller or unaligned reads, such as the registers read
+ * during the card identification, drain the FIFO instead.
+ */
+static bool stm32_sdmmc2_can_use_dma(uintptr_t buf, size_t size)
+{
+	if (((buf | size) & (CACHE_WRITEBACK_GRANULE - 1U)) != 0U) {
+		return false;
+	}
+
+	return plat_sdmmc2_use_dma(sdmmc2_params.reg_base, buf);
 }
 
 static void stm32_sdmmc2_init(void)
@@ -546,11 +564,7 @@ static int stm32_sdmmc2_prepare(int lba, uintptr_t buf, size_t size)
 		arg_size = (uint32_t)size;
 	}
 
-	sdmmc2_params.use_dma = plat_sdmmc2_use_dma(base, buf);
-
-	if (sdmmc2_params.use_dma) {
-		inv_dcache_range(buf, size);
-	}
+	sdmmc2_params.use_dma = stm32_sdmmc2_can_use_dma(buf, size);
 
 	/* Prepare CMD 16*/
 	mmio_write_32(base + SDMMC_DTIMER, 0);
@@ -581,7 +595,10 @@ static int stm32_sdmmc2_prepare(int lba, uintptr_t buf, size_t size)
 			      SDMMC_IDMACTRLR_IDMAEN);
 		mmio_write_32(base + SDMMC_IDMABASE0R, buf);
 
+		/* No dirty line may be evicted over the incoming data */
 		flush_dcache_range(buf, size);
+	} else {
+		mmio_write_32(base + SDMMC_IDMACTRLR, 0U);
 	}
 
 	data_ctrl |= __builtin_ctz(arg_size) << SDMMC_DCTRLR_DBLOCKSIZE_SHIFT;
@@ -611,6 +628,7 @@ static int stm32_sdmmc2_read(int lba, uintptr_t buf, size_t size)
 	buffer = (uint32_t *)buf;
 
 	if (sdmmc2_params.use_dma) {
+		/* Drop the lines speculatively fetched during the transfer */
 		inv_dcache_range(buf, size);
 
 		return 0;
@@ -762,9 +780,17 @@ static int stm32_sdmmc2_dt_get_config(void)
 
 unsigned long long stm32_sdmmc2_mmc_get_device_size(void)
 {
+	if (mmc_init_wait() != 0) {
+		return 0ULL;
+	}
+
 	return sdmmc2_params.device_info->device_size;
 }
 
+/*
+ * Only start the enumeration of the device, the first access to it through
+ * the MMC framework waits for its completion.
+ */
 int stm32_sdmmc2_mmc_init(struct stm32_sdmmc2_params *params)
 {
 	assert((params != NULL) &&
@@ -802,7 +828,7 @@ int stm32_sdmmc2_mmc_init(struct stm32_sdmmc2_params *params)
 	sdmmc2_params.clk_rate = clk_get_rate(sdmmc2_params.clock_id);
 	sdmmc2_params.device_info->ocr_voltage = OCR_3_2_3_3 | OCR_3_3_3_4;
 
-	return mmc_init(&stm32_sdmmc2_ops, sdmmc2_params.clk_rate,
-			sdmmc2_params.bus_width, sdmmc2_params.flags,
-			sdmmc2_params.device_info);
+	return mmc_init_start(&stm32_sdmmc2_ops, sdmmc2_params.clk_rate,
+			      sdmmc2_params.bus_width, sdmmc2_params.flags,
+			      sdmmc2_params.device_info);
 }
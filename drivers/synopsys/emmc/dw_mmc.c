@@ -6,6 +6,7 @@
 
 #include <assert.h>
 #include <errno.h>
+#include <stdbool.h>
 #include <string.h>
 
 #include <arch.h>
@@ -88,6 +89,7 @@
 #define BMOD_FB				(1 << 1)
 #define BMOD_SWRESET			(1 << 0)
 
+#define DWMMC_PLDMND			(0x84)
 #define DWMMC_DBADDR			(0x88)
 #define DWMMC_IDSTS			(0x8c)
 #define DWMMC_IDINTEN			(0x90)
@@ -138,6 +140,18 @@ static const struct mmc_ops dw_mmc_ops = {
 
 static dw_mmc_params_t dw_params;
 
+/*
+ * Transfer in progress. The descriptor area is used as a ring of two halves,
+ * so that one half can be refilled with the rest of a transfer larger than
+ * the area while the IDMAC goes through the other.
+ */
+static struct {
+	uintptr_t	buf;
+	size_t		size;
+	size_t		queued;		/* Bytes described so far */
+	unsigned int	half;		/* Next half to refill */
+} dw_xfer;
+
 static void dw_update_clk(void)
 {
 	unsigned int data;
@@ -339,10 +353,81 @@ static int dw_set_ios(unsigned int clk, unsigned int width)
 	return 0;
 }
 
-static int dw_prepare(int lba, uintptr_t buf, size_t size)
+static unsigned int dw_half_desc_cnt(void)
+{
+	return dw_params.desc_size / 2U / sizeof(struct dw_idmac_desc);
+}
+
+/*
+ * Describe the next part of the transfer in one half of the descriptor area.
+ * The last descriptor of a half points to the other half, where the IDMAC
+ * suspends until it is refilled if it has not been yet.
+ */
+static void dw_fill_half(unsigned int half)
 {
+	unsigned int cnt = dw_half_desc_cnt();
 	struct dw_idmac_desc *desc;
-	int desc_cnt, i, last;
+	uintptr_t other;
+	size_t len;
+	unsigned int i;
+
+	desc = (struct dw_idmac_desc *)dw_params.desc_base + (half * cnt);
+	other = dw_params.desc_base +
+		((half ^ 1U) * cnt * sizeof(struct dw_idmac_desc));
+
+	for (i = 0U; (i < cnt) && (dw_xfer.queued < dw_xfer.size); i++) {
+		len = MIN(dw_xfer.size - dw_xfer.queued,
+			  (size_t)DWMMC_DMA_MAX_BUFFER_SIZE);
+
+		desc[i].des0 = IDMAC_DES0_OWN | IDMAC_DES0_CH | IDMAC_DES0_DIC;
+		desc[i].des1 = IDMAC_DES1_BS1(len);
+		desc[i].des2 = dw_xfer.buf + dw_xfer.queued;
+		desc[i].des3 = (i == (cnt - 1U)) ? other :
+			       (uintptr_t)&desc[i + 1U];
+
+		if (dw_xfer.queued == 0U) {
+			desc[i].des0 |= IDMAC_DES0_FS;
+		}
+
+		dw_xfer.queued += len;
+		if (dw_xfer.queued == dw_xfer.size) {
+			desc[i].des0 |= IDMAC_DES0_LD;
+			desc[i].des0 &= ~(IDMAC_DES0_DIC | IDMAC_DES0_CH);
+			desc[i].des3 = 0;
+		}
+	}
+
+	flush_dcache_range((uintptr_t)desc, i * sizeof(struct dw_idmac_desc));
+}
+
+/*
+ * Refill the half of the descriptor area the IDMAC is done with, if it is.
+ * The halves are a multiple of half a block, so cache maintenance on one never
+ * touches the descriptors of the other.
+ */
+static bool dw_refill(void)
+{
+	unsigned int cnt = dw_half_desc_cnt();
+	struct dw_idmac_desc *last;
+
+	last = (struct dw_idmac_desc *)dw_params.desc_base +
+	       (dw_xfer.half * cnt) + (cnt - 1U);
+	inv_dcache_range((uintptr_t)last, sizeof(struct dw_idmac_desc));
+	if ((last->des0 & IDMAC_DES0_OWN) != 0U) {
+		return false;
+	}
+
+	dw_fill_half(dw_xfer.half);
+	dw_xfer.half ^= 1U;
+
+	/* Resume the IDMAC if it has suspended on the refilled half */
+	mmio_write_32(dw_params.reg_base + DWMMC_PLDMND, 1U);
+
+	return true;
+}
+
+static int dw_prepare(int lba, uintptr_t buf, size_t size)
+{
 	uintptr_t base;
 
 	assert(((buf & DWMMC_ADDRESS_MASK) == 0) &&
@@ -353,12 +438,7 @@ static int dw_prepare(int lba, uintptr_t buf, size_t size)
 
 	flush_dcache_range(buf, size);
 
-	desc_cnt = (size + DWMMC_DMA_MAX_BUFFER_SIZE - 1) /
-		   DWMMC_DMA_MAX_BUFFER_SIZE;
-	assert(desc_cnt * sizeof(struct dw_idmac_desc) < dw_params.desc_size);
-
 	base = dw_params.reg_base;
-	desc = (struct dw_idmac_desc *)dw_params.desc_base;
 	mmio_write_32(base + DWMMC_BYTCNT, size);
 
 	if (size < MMC_BLOCK_SIZE)
@@ -367,28 +447,21 @@ static int dw_prepare(int lba, uintptr_t buf, size_t size)
 		mmio_write_32(base + DWMMC_BLKSIZ, MMC_BLOCK_SIZE);
 
 	mmio_write_32(base + DWMMC_RINTSTS, ~0);
-	for (i = 0; i < desc_cnt; i++) {
-		desc[i].des0 = IDMAC_DES0_OWN | IDMAC_DES0_CH | IDMAC_DES0_DIC;
-		desc[i].des1 = IDMAC_DES1_BS1(DWMMC_DMA_MAX_BUFFER_SIZE);
-		desc[i].des2 = buf + DWMMC_DMA_MAX_BUFFER_SIZE * i;
-		desc[i].des3 = dw_params.desc_base +
-			       (sizeof(struct dw_idmac_desc)) * (i + 1);
+
+	/*
+	 * Describe as much of the transfer as the descriptor area holds, the
+	 * rest is described by dw_read() as the IDMAC releases descriptors.
+	 */
+	dw_xfer.buf = buf;
+	dw_xfer.size = size;
+	dw_xfer.queued = 0U;
+	dw_fill_half(0U);
+	if (dw_xfer.queued < size) {
+		dw_fill_half(1U);
 	}
-	/* first descriptor */
-	desc->des0 |= IDMAC_DES0_FS;
-	/* last descriptor */
-	last = desc_cnt - 1;
-	(desc + last)->des0 |= IDMAC_DES0_LD;
-	(desc + last)->des0 &= ~(IDMAC_DES0_DIC | IDMAC_DES0_CH);
-	(desc + last)->des1 = IDMAC_DES1_BS1(size - (last *
-				  DWMMC_DMA_MAX_BUFFER_SIZE));
-	/* set next descriptor address as 0 */
-	(desc + last)->des3 = 0;
+	dw_xfer.half = 0U;
 
 	mmio_write_32(base + DWMMC_DBADDR, dw_params.desc_base);
-	flush_dcache_range(dw_params.desc_base,
-			   desc_cnt * DWMMC_DMA_MAX_BUFFER_SIZE);
-
 
 	return 0;
 }
@@ -399,6 +472,10 @@ static int dw_read(int lba, uintptr_t buf, size_t size)
 	int timeout = TIMEOUT;
 
 	do {
+		if ((dw_xfer.queued < dw_xfer.size) && dw_refill()) {
+			timeout = TIMEOUT;
+			continue;
+		}
 		data = mmio_read_32(dw_params.reg_base + DWMMC_RINTSTS);
 		udelay(50);
 	} while (!(data & INT_DTO) && timeout-- > 0);
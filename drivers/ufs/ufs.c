@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -29,6 +29,8 @@
 
 static ufs_params_t ufs_params;
 static int nutrs;	/* Number of UTP Transfer Request Slots */
+static uintptr_t ucd_base;	/* UTP Command Descriptor of slot zero */
+static size_t ucd_size;		/* Size of the UCD of each slot */
 
 /*
  * ufs_uic_error_handler - UIC error interrupts handler
@@ -373,39 +375,59 @@ static int ufshc_link_startup(uintptr_t base)
 	return -EIO;
 }
 
-/* Read Door Bell register to check if slot zero is available */
-static int is_slot_available(void)
+/* Read Door Bell register to check if a slot is available */
+static int is_slot_available(int slot)
 {
-	if (mmio_read_32(ufs_params.reg_base + UTRLDBR) & 0x1) {
+	if (mmio_read_32(ufs_params.reg_base + UTRLDBR) & (1U << slot)) {
 		return -EBUSY;
 	}
 	return 0;
 }
 
-static void get_utrd(utp_utrd_t *utrd)
+/*
+ * The UTP Transfer Request List holds the UTRD headers of all slots at the
+ * start of the descriptor region. It is followed by one UTP Command
+ * Descriptor per slot, each of them ucd_size bytes long.
+ */
+static void ufs_utrd_layout(utp_utrd_t *utrd, int slot)
+{
+	utrd->header = ufs_params.desc_base + (slot * sizeof(utrd_header_t));
+	utrd->task_tag = slot + 1;
+	/* CDB address should be aligned with 128 bytes */
+	utrd->upiu = ucd_base + (slot * ucd_size);
+	utrd->resp_upiu = ALIGN_8(utrd->upiu + sizeof(cmd_upiu_t));
+	utrd->size_upiu = utrd->resp_upiu - utrd->upiu;
+	utrd->size_resp_upiu = ALIGN_8(sizeof(resp_upiu_t));
+	utrd->prdt = utrd->resp_upiu + utrd->size_resp_upiu;
+}
+
+static void ufs_flush_utrd(const utp_utrd_t *utrd, size_t ucd_len)
+{
+	flush_dcache_range(utrd->header, sizeof(utrd_header_t));
+	flush_dcache_range(utrd->upiu, ucd_len);
+}
+
+static void ufs_inv_utrd(const utp_utrd_t *utrd)
+{
+	inv_dcache_range(utrd->header, sizeof(utrd_header_t));
+	inv_dcache_range(utrd->upiu, MIN(ucd_size, (size_t)UFS_DESC_SIZE));
+}
+
+static void get_utrd_slot(utp_utrd_t *utrd, int slot)
 {
-	uintptr_t base;
 	int result;
 	utrd_header_t *hd;
 
-	assert(utrd != NULL);
-	result = is_slot_available();
+	assert((utrd != NULL) && (slot < nutrs));
+	result = is_slot_available(slot);
 	assert(result == 0);
 
 	/* clear utrd */
 	memset((void *)utrd, 0, sizeof(utp_utrd_t));
-	base = ufs_params.desc_base;
+	ufs_utrd_layout(utrd, slot);
 	/* clear the descriptor */
-	memset((void *)base, 0, UFS_DESC_SIZE);
-
-	utrd->header = base;
-	utrd->task_tag = 1; /* We always use the first slot */
-	/* CDB address should be aligned with 128 bytes */
-	utrd->upiu = ALIGN_CDB(utrd->header + sizeof(utrd_header_t));
-	utrd->resp_upiu = ALIGN_8(utrd->upiu + sizeof(cmd_upiu_t));
-	utrd->size_upiu = utrd->resp_upiu - utrd->upiu;
-	utrd->size_resp_upiu = ALIGN_8(sizeof(resp_upiu_t));
-	utrd->prdt = utrd->resp_upiu + utrd->size_resp_upiu;
+	memset((void *)utrd->header, 0, sizeof(utrd_header_t));
+	memset((void *)utrd->upiu, 0, MIN(ucd_size, (size_t)UFS_DESC_SIZE));
 
 	hd = (utrd_header_t *)utrd->header;
 	hd->ucdba = utrd->upiu & UINT32_MAX;
@@ -416,6 +438,23 @@ static void get_utrd(utp_utrd_t *utrd)
 	(void)result;
 }
 
+static void get_utrd(utp_utrd_t *utrd)
+{
+	get_utrd_slot(utrd, 0);
+}
+
+/* Largest data transfer a single slot can describe with its PRDT */
+static size_t ufs_slot_max_transfer(void)
+{
+	size_t prdt_offset = ALIGN_8(sizeof(cmd_upiu_t)) +
+			     ALIGN_8(sizeof(resp_upiu_t));
+	size_t size;
+
+	size = ((ucd_size - prdt_offset) / sizeof(prdt_t)) * MAX_PRDT_SIZE;
+
+	return MIN(size, (size_t)UINT16_MAX << UFS_BLOCK_SHIFT);
+}
+
 /*
  * Prepare UTRD, Command UPIU, Response UPIU.
  */
@@ -494,7 +533,7 @@ static int ufs_prepare_cmd(utp_utrd_t *utrd, uint8_t op, uint8_t lun,
 		assert(lba_cnt <= UINT16_MAX);
 		prdt = (prdt_t *)utrd->prdt;
 
-		desc_limit = ufs_params.desc_base + ufs_params.desc_size;
+		desc_limit = utrd->upiu + ucd_size;
 		while (length > 0) {
 			if ((uintptr_t)prdt + sizeof(prdt_t) > desc_limit) {
 				ERROR("UFS: Exceeded descriptor limit. Image is too large\n");
@@ -519,7 +558,7 @@ static int ufs_prepare_cmd(utp_utrd_t *utrd, uint8_t op, uint8_t lun,
 	}
 
 	prdt_end = utrd->prdt + utrd->prdt_length * sizeof(prdt_t);
-	flush_dcache_range(utrd->header, prdt_end - utrd->header);
+	ufs_flush_utrd(utrd, prdt_end - utrd->upiu);
 	return 0;
 }
 
@@ -572,7 +611,7 @@ static int ufs_prepare_query(utp_utrd_t *utrd, uint8_t op, uint8_t idn,
 		assert(0);
 		break;
 	}
-	flush_dcache_range((uintptr_t)utrd->header, UFS_DESC_SIZE);
+	ufs_flush_utrd(utrd, MIN(ucd_size, (size_t)UFS_DESC_SIZE));
 	return 0;
 }
 
@@ -590,15 +629,13 @@ static void ufs_prepare_nop_out(utp_utrd_t *utrd)
 
 	nop_out->trans_type = 0;
 	nop_out->task_tag = utrd->task_tag;
-	flush_dcache_range((uintptr_t)utrd->header, UFS_DESC_SIZE);
+	ufs_flush_utrd(utrd, MIN(ucd_size, (size_t)UFS_DESC_SIZE));
 }
 
-static void ufs_send_request(int task_tag)
+static void ufs_start_request_list(void)
 {
 	unsigned int data;
-	int slot;
 
-	slot = task_tag - 1;
 	/* clear all interrupts */
 	mmio_write_32(ufs_params.reg_base + IS, ~0);
 
@@ -608,6 +645,14 @@ static void ufs_send_request(int task_tag)
 	data = UTRIACR_IAEN | UTRIACR_CTR | UTRIACR_IACTH(0x1F) |
 	       UTRIACR_IATOVAL(0xFF);
 	mmio_write_32(ufs_params.reg_base + UTRIACR, data);
+}
+
+static void ufs_send_request(int task_tag)
+{
+	int slot;
+
+	slot = task_tag - 1;
+	ufs_start_request_list();
 	/* send request */
 	mmio_setbits_32(ufs_params.reg_base + UTRLDBR, 1U << slot);
 }
@@ -637,7 +682,7 @@ static int ufs_check_resp(utp_utrd_t *utrd, int trans_type, unsigned int timeout
 	 * completed to avoid cpu referring to the prefetched
 	 * data brought in before DMA completion.
 	 */
-	inv_dcache_range((uintptr_t)hd, UFS_DESC_SIZE);
+	ufs_inv_utrd(utrd);
 	assert(hd->ocs == OCS_SUCCESS);
 	assert((resp->trans_type & TRANS_TYPE_CODE_MASK) == trans_type);
 
@@ -865,6 +910,115 @@ static int ufs_read_capacity(int lun, unsigned int *num, unsigned int *size)
 	return -ETIMEDOUT;
 }
 
+/* Check the response of a completed READ(10) sent through a queue slot */
+static int ufs_check_queued_resp(int slot)
+{
+	utp_utrd_t utrd;
+	utrd_header_t *hd;
+	resp_upiu_t *resp;
+
+	ufs_utrd_layout(&utrd, slot);
+	ufs_inv_utrd(&utrd);
+	hd = (utrd_header_t *)utrd.header;
+	resp = (resp_upiu_t *)utrd.resp_upiu;
+
+	if ((hd->ocs != OCS_SUCCESS) ||
+	    ((resp->trans_type & TRANS_TYPE_CODE_MASK) != RESPONSE_UPIU) ||
+	    (resp->sd.sense.resp_code == SENSE_DATA_VALID) ||
+	    (resp->res_trans_cnt != 0U)) {
+		return -EIO;
+	}
+
+	return 0;
+}
+
+/*
+ * Split a large read into several READ(10) commands and keep up to nutrs of
+ * them in flight. Completion is detected from the doorbell register. Returns
+ * the number of bytes read, or 0 if any of the commands failed.
+ */
+static size_t ufs_read_blocks_queued(int lun, int lba, uintptr_t buf,
+				     size_t size)
+{
+	uintptr_t base = ufs_params.reg_base;
+	utp_utrd_t utrd;
+	uint32_t pending = 0U, done;
+	size_t chunk, len, issued = 0U;
+	uint64_t timeout;
+	int slot, result = 0;
+
+	/* Spread the range over all slots, but keep commands reasonably big */
+	chunk = (size + ((size_t)nutrs * UFS_BLOCK_SIZE) - 1U) /
+		((size_t)nutrs * UFS_BLOCK_SIZE);
+	chunk = MAX((size_t)MAX_PRDT_SIZE, chunk << UFS_BLOCK_SHIFT);
+	chunk = MIN(chunk, ufs_slot_max_transfer());
+
+	ufs_start_request_list();
+	timeout = timeout_init_us(CMD_TIMEOUT_MS * 1000U);
+
+	while ((issued < size) || (pending != 0U)) {
+		for (slot = 0; (slot < nutrs) && (issued < size); slot++) {
+			if ((pending & (1U << slot)) != 0U) {
+				continue;
+			}
+
+			len = MIN(chunk, size - issued);
+			get_utrd_slot(&utrd, slot);
+			(void)ufs_prepare_cmd(&utrd, CDBCMD_READ_10, lun,
+					      lba + (int)(issued >> UFS_BLOCK_SHIFT),
+					      buf + issued, len);
+			pending |= 1U << slot;
+			issued += len;
+			mmio_write_32(base + UTRLDBR, 1U << slot);
+		}
+
+		if ((mmio_read_32(base + IS) & UFS_INT_ERR) != 0U) {
+			result = -EIO;
+			break;
+		}
+
+		done = pending & ~mmio_read_32(base + UTRLDBR);
+		for (slot = 0; (done != 0U) && (slot < nutrs); slot++) {
+			if ((done & (1U << slot)) == 0U) {
+				continue;
+			}
+
+			done &= ~(1U << slot);
+			pending &= ~(1U << slot);
+			result = ufs_check_queued_resp(slot);
+			if (result != 0) {
+				break;
+			}
+			timeout = timeout_init_us(CMD_TIMEOUT_MS * 1000U);
+		}
+
+		if (result != 0) {
+			break;
+		}
+
+		if (timeout_elapsed(timeout)) {
+			result = -ETIMEDOUT;
+			break;
+		}
+	}
+
+	mmio_write_32(base + IS, ~0);
+
+	if (result != 0) {
+		/* Abort whatever is still in flight */
+		mmio_write_32(base + UTRLCLR, ~pending);
+		WARN("UFS: queued read failed (%d)\n", result);
+		return 0U;
+	}
+
+	/*
+	 * Invalidate prefetched cache contents before cpu
+	 * accesses the buf.
+	 */
+	inv_dcache_range(buf, size);
+	return size;
+}
+
 size_t ufs_read_blocks(int lun, int lba, uintptr_t buf, size_t size)
 {
 	utp_utrd_t utrd;
@@ -874,6 +1028,11 @@ size_t ufs_read_blocks(int lun, int lba, uintptr_t buf, size_t size)
 	       (ufs_params.desc_base != 0) &&
 	       (ufs_params.desc_size >= UFS_DESC_SIZE));
 
+	if ((nutrs > 1) && (size > MAX_PRDT_SIZE) &&
+	    (ufs_read_blocks_queued(lun, lba, buf, size) == size)) {
+		return size;
+	}
+
 	ufs_send_cmd(&utrd, CDBCMD_READ_10, lun, lba, buf, size);
 #ifdef UFS_RESP_DEBUG
 	dump_upiu(&utrd);
@@ -995,6 +1154,14 @@ int ufs_init(const ufs_ops_t *ops, ufs_params_t *params)
 	if (nutrs > (ufs_params.desc_size / UFS_DESC_SIZE)) {
 		nutrs = ufs_params.desc_size / UFS_DESC_SIZE;
 	}
+	if ((ufs_params.flags & UFS_FLAGS_QUEUE_READS) == 0U) {
+		nutrs = 1;
+	}
+
+	ucd_base = ufs_params.desc_base +
+		   ALIGN_CDB(nutrs * sizeof(utrd_header_t));
+	ucd_size = ((ufs_params.desc_base + ufs_params.desc_size - ucd_base) /
+		    nutrs) & ~CDB_ADDR_MASK;
 
 
 	if (ufs_params.flags & UFS_FLAGS_SKIPINIT) {
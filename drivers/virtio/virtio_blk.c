@@ -0,0 +1,355 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include <arch_helpers.h>
+#include <common/debug.h>
+#include <drivers/virtio/virtio_blk.h>
+#include <lib/mmio.h>
+#include <lib/utils.h>
+#include <lib/utils_def.h>
+
+/* virtio-mmio registers, the legacy ones are only used by version 1 */
+#define VIRTIO_MMIO_MAGIC		0x000U
+#define VIRTIO_MMIO_VERSION		0x004U
+#define VIRTIO_MMIO_DEVICE_ID		0x008U
+#define VIRTIO_MMIO_DEVICE_FEATURES	0x010U
+#define VIRTIO_MMIO_DEVICE_FEATURES_SEL	0x014U
+#define VIRTIO_MMIO_DRIVER_FEATURES	0x020U
+#define VIRTIO_MMIO_DRIVER_FEATURES_SEL	0x024U
+#define VIRTIO_MMIO_GUEST_PAGE_SIZE	0x028U	/* Legacy */
+#define VIRTIO_MMIO_QUEUE_SEL		0x030U
+#define VIRTIO_MMIO_QUEUE_NUM_MAX	0x034U
+#define VIRTIO_MMIO_QUEUE_NUM		0x038U
+#define VIRTIO_MMIO_QUEUE_ALIGN		0x03cU	/* Legacy */
+#define VIRTIO_MMIO_QUEUE_PFN		0x040U	/* Legacy */
+#define VIRTIO_MMIO_QUEUE_READY		0x044U
+#define VIRTIO_MMIO_QUEUE_NOTIFY	0x050U
+#define VIRTIO_MMIO_INTERRUPT_STATUS	0x060U
+#define VIRTIO_MMIO_INTERRUPT_ACK	0x064U
+#define VIRTIO_MMIO_STATUS		0x070U
+#define VIRTIO_MMIO_QUEUE_DESC_LOW	0x080U
+#define VIRTIO_MMIO_QUEUE_DESC_HIGH	0x084U
+#define VIRTIO_MMIO_QUEUE_AVAIL_LOW	0x090U
+#define VIRTIO_MMIO_QUEUE_AVAIL_HIGH	0x094U
+#define VIRTIO_MMIO_QUEUE_USED_LOW	0x0a0U
+#define VIRTIO_MMIO_QUEUE_USED_HIGH	0x0a4U
+#define VIRTIO_MMIO_CONFIG		0x100U
+
+#define VIRTIO_MMIO_MAGIC_VALUE		0x74726976U	/* "virt" */
+#define VIRTIO_ID_BLOCK			2U
+
+#define VIRTIO_STATUS_ACKNOWLEDGE	BIT_32(0)
+#define VIRTIO_STATUS_DRIVER		BIT_32(1)
+#define VIRTIO_STATUS_DRIVER_OK		BIT_32(2)
+#define VIRTIO_STATUS_FEATURES_OK	BIT_32(3)
+#define VIRTIO_STATUS_NEEDS_RESET	BIT_32(6)
+#define VIRTIO_STATUS_FAILED		BIT_32(7)
+
+/* VIRTIO_F_VERSION_1 is feature bit 32, bit 0 of the second feature word */
+#define VIRTIO_F_VERSION_1		BIT_32(0)
+
+#define VIRTQ_DESC_F_NEXT		1U
+#define VIRTQ_DESC_F_WRITE		2U
+
+#define VIRTIO_BLK_T_IN			0U
+#define VIRTIO_BLK_S_OK			0U
+
+/* A read is a chain of three descriptors: header, data and status */
+#define VIRTQ_SIZE			4U
+#define VIRTQ_ALIGN			4096U
+
+/* Largest request, so that the length fits a descriptor */
+#define VIRTIO_BLK_MAX_REQ		(4U * 1024U * 1024U)
+
+struct virtq_desc {
+	uint64_t addr;
+	uint32_t len;
+	uint16_t flags;
+	uint16_t next;
+};
+
+struct virtq_avail {
+	uint16_t flags;
+	uint16_t idx;
+	uint16_t ring[VIRTQ_SIZE];
+	uint16_t used_event;
+};
+
+struct virtq_used_elem {
+	uint32_t id;
+	uint32_t len;
+};
+
+struct virtq_used {
+	uint16_t flags;
+	uint16_t idx;
+	struct virtq_used_elem ring[VIRTQ_SIZE];
+	uint16_t avail_event;
+};
+
+struct virtio_blk_req {
+	uint32_t type;
+	uint32_t reserved;
+	uint64_t sector;
+};
+
+/*
+ * The virtqueue in the legacy layout, which a modern device accepts as well:
+ * the used ring starts on the next VIRTQ_ALIGN boundary after the available
+ * ring.
+ */
+struct virtio_blk_queue {
+	struct virtq_desc desc[VIRTQ_SIZE];
+	struct virtq_avail avail;
+	struct virtq_used used __aligned(VIRTQ_ALIGN);
+	struct virtio_blk_req req;
+	uint8_t status;
+};
+
+static struct {
+	uintptr_t base;
+	struct virtio_blk_queue *queue;
+	uintptr_t bounce;
+	size_t bounce_size;
+	uintptr_t dma_base;
+	size_t dma_size;
+	uint16_t last_used;
+} virtio_blk;
+
+static int virtio_blk_setup_queue(uintptr_t base, unsigned int version,
+				  struct virtio_blk_queue *queue)
+{
+	uintptr_t desc = (uintptr_t)queue->desc;
+	uintptr_t avail = (uintptr_t)&queue->avail;
+	uintptr_t used = (uintptr_t)&queue->used;
+
+	mmio_write_32(base + VIRTIO_MMIO_QUEUE_SEL, 0U);
+	if (mmio_read_32(base + VIRTIO_MMIO_QUEUE_NUM_MAX) < VIRTQ_SIZE) {
+		return -ENODEV;
+	}
+	mmio_write_32(base + VIRTIO_MMIO_QUEUE_NUM, VIRTQ_SIZE);
+
+	if (version == 1U) {
+		mmio_write_32(base + VIRTIO_MMIO_GUEST_PAGE_SIZE, VIRTQ_ALIGN);
+		mmio_write_32(base + VIRTIO_MMIO_QUEUE_ALIGN, VIRTQ_ALIGN);
+		mmio_write_32(base + VIRTIO_MMIO_QUEUE_PFN,
+			      (uint32_t)(desc / VIRTQ_ALIGN));
+		return 0;
+	}
+
+	mmio_write_32(base + VIRTIO_MMIO_QUEUE_DESC_LOW, (uint32_t)desc);
+	mmio_write_32(base + VIRTIO_MMIO_QUEUE_DESC_HIGH,
+		      (uint32_t)((uint64_t)desc >> 32));
+	mmio_write_32(base + VIRTIO_MMIO_QUEUE_AVAIL_LOW, (uint32_t)avail);
+	mmio_write_32(base + VIRTIO_MMIO_QUEUE_AVAIL_HIGH,
+		      (uint32_t)((uint64_t)avail >> 32));
+	mmio_write_32(base + VIRTIO_MMIO_QUEUE_USED_LOW, (uint32_t)used);
+	mmio_write_32(base + VIRTIO_MMIO_QUEUE_USED_HIGH,
+		      (uint32_t)((uint64_t)used >> 32));
+	mmio_write_32(base + VIRTIO_MMIO_QUEUE_READY, 1U);
+
+	return 0;
+}
+
+static int virtio_blk_setup(uintptr_t base, struct virtio_blk_queue *queue)
+{
+	unsigned int version = mmio_read_32(base + VIRTIO_MMIO_VERSION);
+	uint32_t status;
+
+	if ((version != 1U) && (version != 2U)) {
+		return -ENODEV;
+	}
+
+	/* Reset the device, then negotiate no feature but VERSION_1 */
+	mmio_write_32(base + VIRTIO_MMIO_STATUS, 0U);
+	status = VIRTIO_STATUS_ACKNOWLEDGE | VIRTIO_STATUS_DRIVER;
+	mmio_write_32(base + VIRTIO_MMIO_STATUS, status);
+
+	mmio_write_32(base + VIRTIO_MMIO_DRIVER_FEATURES_SEL, 0U);
+	mmio_write_32(base + VIRTIO_MMIO_DRIVER_FEATURES, 0U);
+
+	if (version == 2U) {
+		mmio_write_32(base + VIRTIO_MMIO_DEVICE_FEATURES_SEL, 1U);
+		if ((mmio_read_32(base + VIRTIO_MMIO_DEVICE_FEATURES) &
+		     VIRTIO_F_VERSION_1) == 0U) {
+			return -ENODEV;
+		}
+		mmio_write_32(base + VIRTIO_MMIO_DRIVER_FEATURES_SEL, 1U);
+		mmio_write_32(base + VIRTIO_MMIO_DRIVER_FEATURES,
+			      VIRTIO_F_VERSION_1);
+
+		status |= VIRTIO_STATUS_FEATURES_OK;
+		mmio_write_32(base + VIRTIO_MMIO_STATUS, status);
+		if ((mmio_read_32(base + VIRTIO_MMIO_STATUS) &
+		     VIRTIO_STATUS_FEATURES_OK) == 0U) {
+			return -ENODEV;
+		}
+	}
+
+	zeromem(queue, sizeof(*queue));
+	if (virtio_blk_setup_queue(base, version, queue) != 0) {
+		return -ENODEV;
+	}
+
+	status |= VIRTIO_STATUS_DRIVER_OK;
+	mmio_write_32(base + VIRTIO_MMIO_STATUS, status);
+
+	return 0;
+}
+
+int virtio_blk_init(const struct virtio_blk_params *params, size_t *size)
+{
+	size_t queue_size = round_up(sizeof(struct virtio_blk_queue),
+				     VIRTQ_ALIGN);
+	struct virtio_blk_queue *queue;
+	uintptr_t base;
+	uint64_t sectors;
+	unsigned int i;
+
+	assert((params->work_base % VIRTQ_ALIGN) == 0U);
+	assert(params->work_size > queue_size);
+
+	queue = (struct virtio_blk_queue *)params->work_base;
+
+	for (i = 0U; i < params->nr_slots; i++) {
+		base = params->reg_base + (i * VIRTIO_MMIO_SLOT_SIZE);
+
+		if ((mmio_read_32(base + VIRTIO_MMIO_MAGIC) ==
+		     VIRTIO_MMIO_MAGIC_VALUE) &&
+		    (mmio_read_32(base + VIRTIO_MMIO_DEVICE_ID) ==
+		     VIRTIO_ID_BLOCK) &&
+		    (virtio_blk_setup(base, queue) == 0)) {
+			break;
+		}
+	}
+
+	if (i == params->nr_slots) {
+		return -ENODEV;
+	}
+
+	/* The capacity, in 512 byte sectors, is the first configuration field */
+	sectors = mmio_read_32(base + VIRTIO_MMIO_CONFIG) |
+		  ((uint64_t)mmio_read_32(base + VIRTIO_MMIO_CONFIG + 4U) << 32);
+
+	virtio_blk.base = base;
+	virtio_blk.queue = queue;
+	virtio_blk.bounce = params->work_base + queue_size;
+	virtio_blk.bounce_size = round_down(params->work_size - queue_size,
+					    VIRTIO_BLK_SECTOR_SIZE);
+	virtio_blk.dma_base = params->dma_base;
+	virtio_blk.dma_size = params->dma_size;
+	virtio_blk.last_used = 0U;
+
+	*size = (size_t)(sectors * VIRTIO_BLK_SECTOR_SIZE);
+
+	VERBOSE("virtio-blk: transport %u, %llu sectors\n", i,
+		(unsigned long long)sectors);
+
+	return 0;
+}
+
+static int virtio_blk_request(uint64_t sector, uintptr_t buf, size_t len)
+{
+	struct virtio_blk_queue *queue = virtio_blk.queue;
+	uint16_t idx = queue->avail.idx;
+
+	queue->req.type = VIRTIO_BLK_T_IN;
+	queue->req.reserved = 0U;
+	queue->req.sector = sector;
+	queue->status = 0xffU;
+
+	queue->desc[0].addr = (uintptr_t)&queue->req;
+	queue->desc[0].len = sizeof(queue->req);
+	queue->desc[0].flags = VIRTQ_DESC_F_NEXT;
+	queue->desc[0].next = 1U;
+
+	queue->desc[1].addr = buf;
+	queue->desc[1].len = (uint32_t)len;
+	queue->desc[1].flags = VIRTQ_DESC_F_WRITE | VIRTQ_DESC_F_NEXT;
+	queue->desc[1].next = 2U;
+
+	queue->desc[2].addr = (uintptr_t)&queue->status;
+	queue->desc[2].len = sizeof(queue->status);
+	queue->desc[2].flags = VIRTQ_DESC_F_WRITE;
+	queue->desc[2].next = 0U;
+
+	queue->avail.ring[idx % VIRTQ_SIZE] = 0U;
+
+	/* The chain must be visible before the index exposing it */
+	dmbst();
+	queue->avail.idx = idx + 1U;
+
+	/* And the index before the notification */
+	dsbsy();
+	mmio_write_32(virtio_blk.base + VIRTIO_MMIO_QUEUE_NOTIFY, 0U);
+
+	while (*(volatile uint16_t *)&queue->used.idx == virtio_blk.last_used) {
+		if ((mmio_read_32(virtio_blk.base + VIRTIO_MMIO_STATUS) &
+		     (VIRTIO_STATUS_NEEDS_RESET | VIRTIO_STATUS_FAILED)) != 0U) {
+			ERROR("virtio-blk: device failed\n");
+			return -EIO;
+		}
+	}
+
+	/* Read the status and data after the used index */
+	dmbld();
+	virtio_blk.last_used++;
+
+	mmio_write_32(virtio_blk.base + VIRTIO_MMIO_INTERRUPT_ACK,
+		      mmio_read_32(virtio_blk.base +
+				   VIRTIO_MMIO_INTERRUPT_STATUS));
+
+	if (*(volatile uint8_t *)&queue->status != VIRTIO_BLK_S_OK) {
+		ERROR("virtio-blk: read of sector %llu failed\n",
+		      (unsigned long long)sector);
+		return -EIO;
+	}
+
+	return 0;
+}
+
+/*
+ * Reads to memory the device can access are done straight into the caller
+ * buffer, the others through the bounce buffer.
+ */
+size_t virtio_blk_read(int lba, uintptr_t buf, size_t size)
+{
+	uint64_t sector = (uint64_t)lba;
+	size_t done = 0U;
+	size_t len;
+	bool direct;
+
+	assert(virtio_blk.queue != NULL);
+	assert((size % VIRTIO_BLK_SECTOR_SIZE) == 0U);
+
+	direct = (buf >= virtio_blk.dma_base) &&
+		 ((buf + size) <= (virtio_blk.dma_base + virtio_blk.dma_size));
+
+	while (done < size) {
+		len = MIN(size - done, direct ? (size_t)VIRTIO_BLK_MAX_REQ :
+						virtio_blk.bounce_size);
+
+		if (virtio_blk_request(sector, direct ? (buf + done) :
+					virtio_blk.bounce, len) != 0) {
+			break;
+		}
+
+		if (!direct) {
+			(void)memcpy((void *)(buf + done),
+				     (void *)virtio_blk.bounce, len);
+		}
+
+		done += len;
+		sector += len / VIRTIO_BLK_SECTOR_SIZE;
+	}
+
+	return done;
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2013-2026, Arm Limited and Contributors. All rights reserved.
  * Copyright (c) 2020-2022, NVIDIA Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
@@ -290,6 +290,14 @@
 #define ID_AA64ISAR0_RNDR_SHIFT	U(60)
 #define ID_AA64ISAR0_RNDR_MASK	ULL(0xf)
 
+#define ID_AA64ISAR0_TLB_SHIFT	U(56)
+#define ID_AA64ISAR0_TLB_MASK	ULL(0xf)
+#define TLB_RANGE_IMPLEMENTED	ULL(0x2)
+
+#define ID_AA64ISAR0_SHA2_SHIFT	U(12)
+#define ID_AA64ISAR0_SHA2_MASK	ULL(0xf)
+#define SHA2_SHA256_IMPLEMENTED	ULL(0x1)
+
 /* ID_AA64ISAR1_EL1 definitions */
 #define ID_AA64ISAR1_EL1		S3_0_C0_C6_1
 
@@ -318,6 +326,10 @@
 /* ID_AA64ISAR2_EL1 definitions */
 #define ID_AA64ISAR2_EL1		S3_0_C0_C6_2
 
+#define ID_AA64ISAR2_WFXT_SHIFT		U(0)
+#define ID_AA64ISAR2_WFXT_MASK		ULL(0xf)
+#define WFXT_IMPLEMENTED		ULL(0x2)
+
 /* ID_AA64PFR2_EL1 definitions */
 #define ID_AA64PFR2_EL1			S3_0_C0_C4_2
 
@@ -327,6 +339,9 @@
 #define ID_AA64ISAR2_APA3_SHIFT		U(12)
 #define ID_AA64ISAR2_APA3_MASK		ULL(0xf)
 
+#define ID_AA64ISAR2_MOPS_SHIFT		U(16)
+#define ID_AA64ISAR2_MOPS_MASK		ULL(0xf)
+
 /* ID_AA64MMFR0_EL1 definitions */
 #define ID_AA64MMFR0_EL1_PARANGE_SHIFT	U(0)
 #define ID_AA64MMFR0_EL1_PARANGE_MASK	ULL(0xf)
@@ -1065,6 +1080,23 @@
 #define TLBI_ADDR_MASK		ULL(0x00000FFFFFFFFFFF)
 #define TLBI_ADDR(x)		(((x) >> TLBI_ADDR_SHIFT) & TLBI_ADDR_MASK)
 
+/*
+ * Operand of the FEAT_TLBIRANGE instructions. They invalidate
+ * (NUM + 1) << (5 * SCALE + 1) 4KB pages from BaseADDR.
+ */
+#define TLBI_RANGE_BADDR_MASK	ULL(0x1FFFFFFFFF)
+#define TLBI_RANGE_NUM_SHIFT	U(39)
+#define TLBI_RANGE_NUM_MASK	U(0x1f)
+#define TLBI_RANGE_SCALE_SHIFT	U(44)
+#define TLBI_RANGE_SCALE_MAX	U(3)
+#define TLBI_RANGE_TG_SHIFT	U(46)
+#define TLBI_RANGE_TG_4K	ULL(1)
+#define TLBI_RANGE(x, num, scale)					\
+	((TLBI_RANGE_TG_4K << TLBI_RANGE_TG_SHIFT) |			\
+	 ((uint64_t)(scale) << TLBI_RANGE_SCALE_SHIFT) |		\
+	 ((uint64_t)(num) << TLBI_RANGE_NUM_SHIFT) |		\
+	 (((x) >> TLBI_ADDR_SHIFT) & TLBI_RANGE_BADDR_MASK))
+
 /*******************************************************************************
  * Definitions of register offsets and fields in the CNTCTLBase Frame of the
  * system level implementation of the Generic Timer.
@@ -1108,6 +1140,9 @@
 #define PMCR_EL0_P_BIT		(U(1) << 1)
 #define PMCR_EL0_E_BIT		(U(1) << 0)
 
+/* PMCNTENSET_EL0 and PMCNTENCLR_EL0 definitions */
+#define PMCNTEN_EL0_C_BIT	(U(1) << 31)
+
 /*******************************************************************************
  * Definitions for system register interface to SVE
  ******************************************************************************/
@@ -1306,6 +1341,12 @@
 #define MPAM3_EL3_TRAPLOWER_BIT		(ULL(1) << 62)
 #define MPAMHCR_EL2_TRAP_MPAMIDR_EL1	(ULL(1) << 31)
 #define MPAM3_EL3_RESET_VAL		MPAM3_EL3_TRAPLOWER_BIT
+#define MPAM3_EL3_PARTID_I_SHIFT	U(0)
+#define MPAM3_EL3_PARTID_D_SHIFT	U(16)
+#define MPAM3_EL3_PARTID_MASK		ULL(0xffff)
+#define MPAM3_EL3_PMG_I_SHIFT		U(32)
+#define MPAM3_EL3_PMG_D_SHIFT		U(40)
+#define MPAM3_EL3_PMG_MASK		ULL(0xff)
 
 #define MPAM2_EL2_TRAPMPAM0EL1		(ULL(1) << 49)
 #define MPAM2_EL2_TRAPMPAM1EL1		(ULL(1) << 48)
@@ -1539,6 +1580,8 @@
 #define CPUMPMMCR_EL3			S3_6_C15_C2_1
 #define CPUMPMMCR_EL3_MPMM_EN_SHIFT	UINT64_C(0)
 #define CPUMPMMCR_EL3_MPMM_EN_MASK	UINT64_C(0x1)
+#define CPUMPMMCR_EL3_MPMM_GEAR_SHIFT	UINT64_C(1)
+#define CPUMPMMCR_EL3_MPMM_GEAR_MASK	UINT64_C(0x3)
 
 /* alternative system register encoding for the "sb" speculation barrier */
 #define SYSREG_SB			S0_3_C3_C0_7
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2024, Arm Limited. All rights reserved.
+ * Copyright (c) 2019-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -84,6 +84,12 @@ CREATE_FEATURE_SUPPORTED(name, is_ ## name ## _present, guard)
  * +----------------------------+
  * |	FEAT_RNG		|
  * +----------------------------+
+ * |	FEAT_SHA256		|
+ * +----------------------------+
+ * |	FEAT_TLBIRANGE		|
+ * +----------------------------+
+ * |	FEAT_WFxT		|
+ * +----------------------------+
  * |	FEAT_TCR2		|
  * +----------------------------+
  * |	FEAT_S2POE		|
@@ -244,6 +250,19 @@ CREATE_FEATURE_FUNCS(feat_ecv_v2, id_aa64mmfr0_el1, ID_AA64MMFR0_EL1_ECV_SHIFT,
 CREATE_FEATURE_FUNCS(feat_rng, id_aa64isar0_el1, ID_AA64ISAR0_RNDR_SHIFT,
 		     ID_AA64ISAR0_RNDR_MASK, 1U, ENABLE_FEAT_RNG)
 
+/* FEAT_SHA256: SHA-256 instructions */
+CREATE_FEATURE_FUNCS(feat_sha256, id_aa64isar0_el1, ID_AA64ISAR0_SHA2_SHIFT,
+		     ID_AA64ISAR0_SHA2_MASK, SHA2_SHA256_IMPLEMENTED,
+		     ENABLE_FEAT_SHA256)
+
+/* FEAT_TLBIRANGE: TLB range maintenance instructions */
+CREATE_FEATURE_PRESENT(feat_tlbirange, id_aa64isar0_el1, ID_AA64ISAR0_TLB_SHIFT,
+		       ID_AA64ISAR0_TLB_MASK, TLB_RANGE_IMPLEMENTED)
+
+/* FEAT_WFxT: WFE and WFI instructions with timeout */
+CREATE_FEATURE_PRESENT(feat_wfxt, id_aa64isar2_el1, ID_AA64ISAR2_WFXT_SHIFT,
+		       ID_AA64ISAR2_WFXT_MASK, WFXT_IMPLEMENTED)
+
 /* FEAT_TCR2: Support TCR2_ELx regs */
 CREATE_FEATURE_FUNCS(feat_tcr2, id_aa64mmfr3_el1, ID_AA64MMFR3_EL1_TCRX_SHIFT,
 		     ID_AA64MMFR3_EL1_TCRX_MASK, 1U, ENABLE_FEAT_TCR2)
@@ -344,6 +363,10 @@ CREATE_FEATURE_FUNCS(feat_debugv8p9, id_aa64dfr0_el1, ID_AA64DFR0_DEBUGVER_SHIFT
 CREATE_FEATURE_FUNCS(feat_hcx, id_aa64mmfr1_el1, ID_AA64MMFR1_EL1_HCX_SHIFT,
 		     ID_AA64MMFR1_EL1_HCX_MASK, 1U, ENABLE_FEAT_HCX)
 
+/* FEAT_MOPS: Memory Copy and Memory Set instructions */
+CREATE_FEATURE_FUNCS(feat_mops, id_aa64isar2_el1, ID_AA64ISAR2_MOPS_SHIFT,
+		     ID_AA64ISAR2_MOPS_MASK, 1U, ENABLE_FEAT_MOPS)
+
 /* FEAT_RNG_TRAP: Trapping support */
 CREATE_FEATURE_PRESENT(feat_rng_trap, id_aa64pfr1_el1, ID_AA64PFR1_EL1_RNDR_TRAP_SHIFT,
 		      ID_AA64PFR1_EL1_RNDR_TRAP_MASK, RNG_TRAP_IMPLEMENTED)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2013-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -159,6 +159,7 @@ DEFINE_SYSOP_TYPE_FUNC(tlbi, alle2is)
 DEFINE_TLBIOP_ERRATA_TYPE_FUNC(alle3)
 DEFINE_TLBIOP_ERRATA_TYPE_FUNC(alle3is)
 DEFINE_SYSOP_TYPE_FUNC(tlbi, vmalle1)
+DEFINE_SYSOP_TYPE_FUNC(tlbi, vmalle1is)
 #elif ERRATA_A76_1286807
 DEFINE_TLBIOP_ERRATA_TYPE_FUNC(alle1)
 DEFINE_TLBIOP_ERRATA_TYPE_FUNC(alle1is)
@@ -167,6 +168,7 @@ DEFINE_TLBIOP_ERRATA_TYPE_FUNC(alle2is)
 DEFINE_TLBIOP_ERRATA_TYPE_FUNC(alle3)
 DEFINE_TLBIOP_ERRATA_TYPE_FUNC(alle3is)
 DEFINE_TLBIOP_ERRATA_TYPE_FUNC(vmalle1)
+DEFINE_TLBIOP_ERRATA_TYPE_FUNC(vmalle1is)
 #else
 DEFINE_SYSOP_TYPE_FUNC(tlbi, alle1)
 DEFINE_SYSOP_TYPE_FUNC(tlbi, alle1is)
@@ -175,6 +177,7 @@ DEFINE_SYSOP_TYPE_FUNC(tlbi, alle2is)
 DEFINE_SYSOP_TYPE_FUNC(tlbi, alle3)
 DEFINE_SYSOP_TYPE_FUNC(tlbi, alle3is)
 DEFINE_SYSOP_TYPE_FUNC(tlbi, vmalle1)
+DEFINE_SYSOP_TYPE_FUNC(tlbi, vmalle1is)
 #endif
 
 #if ERRATA_A57_813419
@@ -200,6 +203,21 @@ DEFINE_SYSOP_TYPE_PARAM_FUNC(tlbi, vae3is)
 DEFINE_SYSOP_TYPE_PARAM_FUNC(tlbi, vale3is)
 #endif
 
+/*
+ * FEAT_TLBIRANGE instructions. They are encoded with SYS so that assemblers
+ * that don't know about Armv8.4 can still build them. None of the cores
+ * affected by the TLBI errata above implement FEAT_TLBIRANGE.
+ */
+#define DEFINE_TLBIRANGE_PARAM_FUNC(_type, _op1, _op2)		\
+static inline void tlbi ## _type(uint64_t v)			\
+{								\
+	__asm__("sys #" #_op1 ", c8, c2, #" #_op2 ", %0" : : "r" (v));	\
+}
+
+DEFINE_TLBIRANGE_PARAM_FUNC(rvaae1is, 0, 3)
+DEFINE_TLBIRANGE_PARAM_FUNC(rvae2is, 4, 1)
+DEFINE_TLBIRANGE_PARAM_FUNC(rvae3is, 6, 1)
+
 /*******************************************************************************
  * Cache maintenance accessor prototypes
  ******************************************************************************/
@@ -299,6 +317,18 @@ DEFINE_SYSREG_RW_FUNCS(sp_el2)
 DEFINE_SYSOP_FUNC(wfi)
 DEFINE_SYSOP_FUNC(wfe)
 DEFINE_SYSOP_FUNC(sev)
+
+/*
+ * WFET: wait for an event, or until CNTVCT_EL0 reaches the given value. Only
+ * valid if FEAT_WFxT is implemented. Encoded by hand so that toolchains not
+ * targeting Armv8.7 can assemble it; the deadline must be held in x0.
+ */
+static inline void wfet(uint64_t deadline)
+{
+	register uint64_t x0 __asm__("x0") = deadline;
+
+	__asm__ volatile (".inst 0xd5031000" : : "r" (x0) : "memory");
+}
 DEFINE_SYSOP_TYPE_FUNC(dsb, sy)
 DEFINE_SYSOP_TYPE_FUNC(dmb, sy)
 DEFINE_SYSOP_TYPE_FUNC(dmb, st)
@@ -480,6 +510,7 @@ DEFINE_SYSREG_RW_FUNCS(cntp_ctl_el0)
 DEFINE_SYSREG_RW_FUNCS(cntp_tval_el0)
 DEFINE_SYSREG_RW_FUNCS(cntp_cval_el0)
 DEFINE_SYSREG_READ_FUNC(cntpct_el0)
+DEFINE_SYSREG_READ_FUNC(cntvct_el0)
 DEFINE_SYSREG_RW_FUNCS(cnthctl_el2)
 DEFINE_SYSREG_RW_FUNCS(cntv_ctl_el0)
 DEFINE_SYSREG_RW_FUNCS(cntv_cval_el0)
@@ -524,6 +555,10 @@ DEFINE_SYSREG_RW_FUNCS(mdcr_el2)
 DEFINE_SYSREG_RW_FUNCS(mdcr_el3)
 DEFINE_SYSREG_RW_FUNCS(hstr_el2)
 DEFINE_SYSREG_RW_FUNCS(pmcr_el0)
+DEFINE_SYSREG_RW_FUNCS(pmccntr_el0)
+DEFINE_SYSREG_RW_FUNCS(pmccfiltr_el0)
+DEFINE_SYSREG_RW_FUNCS(pmcntenset_el0)
+DEFINE_SYSREG_RW_FUNCS(pmcntenclr_el0)
 
 DEFINE_SYSREG_RW_FUNCS(csselr_el1)
 DEFINE_SYSREG_RW_FUNCS(tpidrro_el0)
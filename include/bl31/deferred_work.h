@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef DEFERRED_WORK_H
+#define DEFERRED_WORK_H
+
+#include <errno.h>
+
+/* Work run on the CPU that queued it, once it reaches a safe point */
+typedef void (*deferred_work_fn_t)(void *arg);
+
+#if DEFERRED_WORK
+int deferred_work_queue(deferred_work_fn_t fn, void *arg);
+void deferred_work_run(void);
+#else
+static inline int deferred_work_queue(deferred_work_fn_t fn, void *arg)
+{
+	(void)fn;
+	(void)arg;
+
+	return -ENOTSUP;
+}
+
+static inline void deferred_work_run(void)
+{
+}
+#endif /* DEFERRED_WORK */
+
+#endif /* DEFERRED_WORK_H */
@@ -0,0 +1,23 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef EL3_PROF_H
+#define EL3_PROF_H
+
+#include <stdint.h>
+
+#if EL3_PROFILING
+void el3_prof_init(void);
+void el3_prof_resume(void);
+void el3_prof_pause(void);
+int el3_prof_sample(uintptr_t pc);
+#else
+static inline void el3_prof_init(void)
+{
+}
+#endif
+
+#endif /* EL3_PROF_H */
@@ -139,6 +139,15 @@ typedef uint64_t (*interrupt_type_handler_t)(uint32_t id,
 					     void *handle,
 					     void *cookie);
 
+/*******************************************************************************
+ * Prototype for defining a fast handler for an EL3 interrupt. It is called
+ * with the raw value of the acknowledged interrupt, on the EL3 runtime stack
+ * and without the context of the interrupted world saved, so it must service
+ * the interrupt entirely at EL3 and must not switch worlds or access the cpu
+ * context. The interrupt is ended after the handler returns.
+ ******************************************************************************/
+typedef void (*el3_fast_intr_handler_t)(uint32_t intr_raw);
+
 /*******************************************************************************
  * Function & variable prototypes
  ******************************************************************************/
@@ -150,6 +159,11 @@ int32_t register_interrupt_type_handler(uint32_t type,
 interrupt_type_handler_t get_interrupt_type_handler(uint32_t type);
 int disable_intr_rm_local(uint32_t type, uint32_t security_state);
 int enable_intr_rm_local(uint32_t type, uint32_t security_state);
+#if EL3_FAST_INTR
+int32_t register_el3_fast_intr_handler(uint32_t id,
+				       el3_fast_intr_handler_t handler);
+int el3_fast_intr_dispatch(void);
+#endif
 
 #endif /*__ASSEMBLER__*/
 #endif /* INTERRUPT_MGMT_H */
@@ -55,6 +55,21 @@ static inline bool is_sysreg_iss_write(uint64_t esr)
  */
 int handle_sysreg_trap(uint64_t esr_el3, cpu_context_t *ctx);
 
+/**
+ * handle_sysreg_trap_fast() - Emulate a system register trap on the fast path
+ * @esr_el3: The content of ESR_EL3, containing the trap syndrome information
+ * @ctx: Pointer to the lower EL context, where only the general purpose
+ *	 registers are saved
+ *
+ * Called with EL3_FAST_SYSREG_TRAP before the context of the lower EL is
+ * saved, for the registers with a fast handler. The handler reads or writes
+ * the value of the transfer register and may update the live SPSR_EL3.
+ *
+ * Return: as handle_sysreg_trap(), except that TRAP_RET_UNHANDLED(-1) takes
+ * the full path through handle_sysreg_trap().
+ */
+int handle_sysreg_trap_fast(uint64_t esr_el3, cpu_context_t *ctx);
+
 /* Handler for injecting UNDEF exception to lower EL */
 void inject_undef64(cpu_context_t *ctx);
 
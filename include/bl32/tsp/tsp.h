@@ -43,6 +43,11 @@
 #define TSP_HANDLE_SEL1_INTR_AND_RETURN	0x2004
 #define TSP_CHECK_DIT			0x2005
 #define TSP_MODIFY_EL1_CTX		0x2006
+/*
+ * Returns the physical counter value read on entry into the TSP in x1 and does
+ * nothing else, for the normal world to time the world switch.
+ */
+#define TSP_NOP				0x2007
 
 /*
  * Identify a TSP service from function ID filtering the last 16 bits from the
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2013-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -172,6 +172,24 @@ typedef struct meminfo {
  ******************************************************************************/
 int load_auth_image(unsigned int image_id, image_info_t *image_data);
 
+#if BL2_PIPELINED_LOAD
+/*
+ * State of an image load started by load_auth_image_start(). The read of the
+ * image may still be in flight until load_auth_image_wait() returns.
+ */
+typedef struct image_load_req {
+	unsigned int image_id;
+	image_info_t *image_data;
+	uintptr_t dev_handle;
+	uintptr_t image_handle;
+} image_load_req_t;
+
+int load_auth_image_start(unsigned int image_id, image_info_t *image_data,
+			  image_load_req_t *req);
+int load_auth_image_wait(image_load_req_t *req);
+int load_auth_image_finish(image_load_req_t *req);
+#endif /* BL2_PIPELINED_LOAD */
+
 #if TRUSTED_BOARD_BOOT && defined(DYN_DISABLE_AUTH)
 /*
  * API to dynamically disable authentication. Only meant for development
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef FAST_REBOOT_H
+#define FAST_REBOOT_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <common/bl_common.h>
+
+#include <platform_def.h>
+
+#define FAST_REBOOT_MAGIC		U(0x52425246)	/* "FRBR" */
+#define FAST_REBOOT_VERSION		U(1)
+#define FAST_REBOOT_ARMED		U(0x44454d52)	/* "RMED" */
+
+/* The images are checked with SHA-256 */
+#define FAST_REBOOT_HASH_SIZE		32U
+
+/* Number of images the record can hold */
+#ifndef PLAT_FAST_REBOOT_MAX_IMAGES
+#define PLAT_FAST_REBOOT_MAX_IMAGES	8U
+#endif
+
+/* An image kept for the next fast reboot, at 'offset' in the stash */
+struct fast_reboot_image {
+	uint32_t image_id;
+	uint32_t size;
+	uint64_t offset;
+	uint8_t hash[FAST_REBOOT_HASH_SIZE];
+};
+
+/*
+ * Record at PLAT_FAST_REBOOT_BASE, followed by the stash of the images. 'hash'
+ * covers 'body' so that a torn update is detected. 'armed' is outside of it,
+ * as BL31 sets it without crypto support.
+ */
+struct fast_reboot_record {
+	uint32_t armed;
+	uint32_t reserved;
+	struct {
+		uint32_t magic;
+		uint32_t version;
+		uint32_t num_images;
+		uint32_t reserved;
+		uint64_t used;
+		struct fast_reboot_image images[PLAT_FAST_REBOOT_MAX_IMAGES];
+	} body;
+	uint8_t hash[FAST_REBOOT_HASH_SIZE];
+};
+
+#if FAST_REBOOT && IMAGE_BL2
+bool fast_reboot_is_active(void);
+int fast_reboot_restore_image(unsigned int image_id, image_info_t *image_data);
+void fast_reboot_save_image(unsigned int image_id,
+			    const image_info_t *image_data);
+#else
+static inline bool fast_reboot_is_active(void)
+{
+	return false;
+}
+#endif
+
+#if FAST_REBOOT
+int fast_reboot_arm(void);
+#endif
+
+#endif /* FAST_REBOOT_H */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2019-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -7,12 +7,18 @@
 #ifndef FDT_FIXUP_H
 #define FDT_FIXUP_H
 
+#include <limits.h>
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
 #define INVALID_BASE_ADDR	((uintptr_t)~0UL)
 
+/* Node argument of the fixup session calls naming the node being built. */
+#define FDT_FIXUP_OPEN_NODE	INT_MIN
+
+#define FDT_FIXUP_STRING_CACHE	8U
+
 struct psci_cpu_idle_state {
 	const char *name;
 	uint32_t power_state;
@@ -23,6 +29,54 @@ struct psci_cpu_idle_state {
 	uint32_t wakeup_latency_us;
 };
 
+/*
+ * A fixup session stages node and property additions to a DTB and applies
+ * them all at once in fdt_fixup_session_commit(), moving each byte of the
+ * structure block at most once. The staged data lives in a work area given
+ * by the caller. Until the commit, the DTB is left untouched and lookups only
+ * see the original nodes and properties.
+ */
+struct fdt_fixup_session {
+	void *dtb;
+	uint8_t *work;
+	size_t work_size;
+	size_t data_size;
+	unsigned int nr_edits;
+	uint32_t growth;
+	unsigned int depth;
+	bool props_closed;
+	int last_parent;
+	int last_parent_end;
+	int strings[FDT_FIXUP_STRING_CACHE];
+	unsigned int strings_next;
+};
+
+int fdt_fixup_session_init(struct fdt_fixup_session *s, void *dtb,
+			   void *work, size_t work_size);
+int fdt_fixup_session_commit(struct fdt_fixup_session *s);
+int fdt_fixup_begin_node(struct fdt_fixup_session *s, int parent,
+			 const char *name);
+int fdt_fixup_end_node(struct fdt_fixup_session *s);
+int fdt_fixup_setprop_placeholder(struct fdt_fixup_session *s, int node,
+				  const char *name, int len, void **prop_data);
+int fdt_fixup_setprop(struct fdt_fixup_session *s, int node,
+		      const char *name, const void *val, int len);
+int fdt_fixup_setprop_u32(struct fdt_fixup_session *s, int node,
+			  const char *name, uint32_t val);
+int fdt_fixup_setprop_u64(struct fdt_fixup_session *s, int node,
+			  const char *name, uint64_t val);
+int fdt_fixup_setprop_string(struct fdt_fixup_session *s, int node,
+			     const char *name, const char *str);
+
+int fdt_fixup_psci_cpu_enable_methods(struct fdt_fixup_session *s);
+int fdt_fixup_reserved_memory(struct fdt_fixup_session *s,
+			      const char *node_name, uintptr_t base,
+			      size_t size);
+int fdt_fixup_cpus_node(struct fdt_fixup_session *s, unsigned int afflv0,
+			unsigned int afflv1, unsigned int afflv2);
+int fdt_fixup_cpu_idle_states(struct fdt_fixup_session *s,
+			      const struct psci_cpu_idle_state *state);
+
 int dt_add_psci_node(void *fdt);
 int dt_add_psci_cpu_enable_methods(void *fdt);
 int fdt_add_reserved_memory(void *dtb, const char *node_name,
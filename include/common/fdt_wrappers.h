@@ -15,6 +15,10 @@
 /* Number of cells, given total length in bytes. Each cell is 4 bytes long */
 #define NCELLS(len) ((len) / 4U)
 
+const void *fdtw_getprop_namelen(const void *dtb, int node, const char *name,
+				 int namelen, int *lenp);
+const void *fdtw_getprop(const void *dtb, int node, const char *name,
+			 int *lenp);
 int fdt_read_uint32(const void *dtb, int node, const char *prop_name,
 		    uint32_t *value);
 uint32_t fdt_read_uint32_default(const void *dtb, int node,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2018-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -18,6 +18,7 @@ typedef int (decompressor_t)(uintptr_t *in_buf, size_t in_len,
 
 void image_decompress_init(uintptr_t buf_base, uint32_t buf_size,
 			   decompressor_t *decompressor);
+int image_decompress_add_buffer(uintptr_t buf_base, uint32_t buf_size);
 void image_decompress_prepare(struct image_info *info);
 int image_decompress(struct image_info *info);
 
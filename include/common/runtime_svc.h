@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013-2019, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2013-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -39,6 +39,9 @@
  */
 #define MAX_RT_SVCS		U(128)
 
+/* Number of log2 latency buckets recorded per service with SMC_LATENCY_HIST */
+#define SMC_LATENCY_BUCKETS	U(32)
+
 #ifndef __ASSEMBLER__
 
 /* Prototype for runtime service initializing function */
@@ -134,5 +137,17 @@ void init_crash_reporting(void);
 
 extern uint8_t rt_svc_descs_indices[MAX_RT_SVCS];
 
+#if SMC_CALL_COUNTERS
+void smc_call_count_inc(uint32_t smc_fid);
+uint64_t smc_call_count_get(uint32_t smc_fid);
+uint64_t smc_call_count_untracked(void);
+#endif
+
+#if SMC_LATENCY_HIST
+void smc_latency_record(unsigned int svc_index, uint64_t start);
+int smc_latency_hist_get(uint32_t smc_fid, unsigned int core_pos,
+			 unsigned int bucket, uint32_t *count);
+#endif
+
 #endif /*__ASSEMBLER__*/
 #endif /* RUNTIME_SVC_H */
@@ -16,6 +16,12 @@
 /* Forward declarations */
 struct psci_power_state;
 
+/*
+ * Vendor SYSTEM_RESET2 type for a warm reset that reuses the images verified
+ * by the previous boot, see FAST_REBOOT
+ */
+#define CSS_RESET2_FAST_REBOOT		U(0x80000000)
+
 /* API for power management by SCP */
 int css_system_reset2(int is_vendor, int reset_type, u_register_t cookie);
 void css_scp_suspend(const struct psci_power_state *target_state);
@@ -31,7 +37,7 @@ int css_scp_boot_image_xfer(void *image, unsigned int image_size);
 
 /*
  * API to wait for SCP to signal till it's ready after booting the transferred
- * image.
+ * image. With CSS_SCP_BOOT_ASYNC, the image must be kept in memory until then.
  */
 int css_scp_boot_ready(void);
 
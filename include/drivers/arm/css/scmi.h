@@ -156,6 +156,8 @@ int scmi_proto_version(void *p, uint32_t proto_id, uint32_t *version);
  * details on these commands.
  */
 int scmi_pwr_state_set(void *p, uint32_t domain_id, uint32_t scmi_pwr_state);
+void scmi_pwr_state_set_async(void *p, uint32_t domain_id,
+			      uint32_t scmi_pwr_state);
 int scmi_pwr_state_get(void *p, uint32_t domain_id, uint32_t *scmi_pwr_state);
 
 /*
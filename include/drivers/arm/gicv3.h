@@ -319,6 +319,7 @@
 #define SGIR_AFF_MASK			ULL(0xff)
 
 #define SGIR_IRM_TO_AFF			U(0)
+#define SGIR_IRM_TO_OTHERS		U(1)
 
 #define GICV3_SGIR_VALUE(_aff3, _aff2, _aff1, _intid, _irm, _tgt)	\
 	((((uint64_t) (_aff3) & SGIR_AFF_MASK) << SGIR_AFF3_SHIFT) |	\
@@ -584,6 +585,9 @@ void gicv3_set_interrupt_group(unsigned int id, unsigned int proc_num,
 		unsigned int group);
 void gicv3_raise_sgi(unsigned int sgi_num, gicv3_irq_group_t group,
 					 u_register_t target);
+void gicv3_raise_sgi_others(unsigned int sgi_num, gicv3_irq_group_t group);
+void gicv3_raise_sgi_targets(unsigned int sgi_num, gicv3_irq_group_t group,
+			     const u_register_t *targets, unsigned int count);
 void gicv3_set_spi_routing(unsigned int id, unsigned int irm,
 		u_register_t mpidr);
 void gicv3_set_interrupt_pending(unsigned int id, unsigned int proc_num);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013-2018, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2013-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -47,10 +47,14 @@
 #define PL011_UARTFR_DSR          (1 << 1)	/* Data set ready */
 #define PL011_UARTFR_CTS          (1 << 0)	/* Clear to send */
 
+#define PL011_UARTFR_TXFE_BIT	7	/* Transmit FIFO empty bit in UARTFR register */
 #define PL011_UARTFR_TXFF_BIT	5	/* Transmit FIFO full bit in UARTFR register */
 #define PL011_UARTFR_RXFE_BIT	4	/* Receive FIFO empty bit in UARTFR register */
 #define PL011_UARTFR_BUSY_BIT	3	/* UART busy bit in UARTFR register */
 
+/* Smallest transmit FIFO depth of the PL011 revisions, in characters */
+#define PL011_TX_FIFO_DEPTH	16
+
 /* Control reg bits */
 #if !PL011_GENERIC_UART
 #define PL011_UARTCR_CTSEN        (1 << 15)	/* CTS hardware flow control enable */
@@ -74,6 +78,7 @@
 #define PL011_UARTLCR_H_WLEN_6    (1 << 5)
 #define PL011_UARTLCR_H_WLEN_5    (0 << 5)
 #define PL011_UARTLCR_H_FEN       (1 << 4)	/* FIFOs Enable */
+#define PL011_UARTLCR_H_FEN_BIT   4
 #define PL011_UARTLCR_H_STP2      (1 << 3)	/* Two stop bits select */
 #define PL011_UARTLCR_H_EPS       (1 << 2)	/* Even parity select */
 #define PL011_UARTLCR_H_PEN       (1 << 1)	/* Parity Enable */
@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef PL330_H
+#define PL330_H
+
+#include <lib/utils_def.h>
+
+/* PL330 register offsets */
+#define PL330_DSR			U(0x000)
+#define PL330_FSRC			U(0x034)
+#define PL330_FTR(_ch)			(U(0x040) + ((_ch) * U(4)))
+#define PL330_CSR(_ch)			(U(0x100) + ((_ch) * U(8)))
+#define PL330_DBGSTATUS			U(0xd00)
+#define PL330_DBGCMD			U(0xd04)
+#define PL330_DBGINST0			U(0xd08)
+#define PL330_DBGINST1			U(0xd0c)
+#define PL330_CR0			U(0xe00)
+#define PL330_CRD			U(0xe14)
+
+/* Register field definitions */
+#define PL330_CSR_STATUS_MASK		U(0xf)
+#define PL330_CSR_STOPPED		U(0x0)
+#define PL330_CSR_FAULTING_COMPLETING	U(0xe)
+#define PL330_CSR_FAULTING		U(0xf)
+
+#define PL330_DBGSTATUS_BUSY		BIT_32(0)
+
+#define PL330_DBGINST0_CHANNEL_SHIFT	U(8)
+#define PL330_DBGINST0_THREAD_CHANNEL	BIT_32(0)
+#define PL330_DBGINST0_INSTR0_SHIFT	U(16)
+#define PL330_DBGINST0_INSTR1_SHIFT	U(24)
+
+#define PL330_CR0_NUM_CHNLS_SHIFT	U(4)
+#define PL330_CR0_NUM_CHNLS_MASK	U(0x7)
+
+#define PL330_CRD_DATA_WIDTH_MASK	U(0x7)
+#define PL330_CRD_DATA_BUF_DEP_SHIFT	U(20)
+#define PL330_CRD_DATA_BUF_DEP_MASK	U(0x3ff)
+
+#ifndef __ASSEMBLER__
+
+#include <stdint.h>
+
+/*
+ * Register the DMA channel 'channel' of the PL330 at 'base' with the DMA
+ * framework, for copies of 'min_len' bytes or more. The manager thread and
+ * the channel must be secure, as set by the boot_manager_ns and boot_irq_ns
+ * tie-offs of the controller.
+ */
+void pl330_init(uintptr_t base, unsigned int channel, size_t min_len);
+
+#endif /* __ASSEMBLER__ */
+
+#endif /* PL330_H */
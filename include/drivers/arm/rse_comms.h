@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022, Arm Limited. All rights reserved.
+ * Copyright (c) 2022-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -10,6 +10,14 @@
 
 #include <stdint.h>
 
+#include <psa/client.h>
+
 int rse_comms_init(uintptr_t mhu_sender_base, uintptr_t mhu_receiver_base);
 
+#if RSE_MBOOT_ASYNC_EXTEND
+psa_status_t rse_comms_call_async(psa_handle_t handle, int32_t type,
+				  const psa_invec *in_vec, size_t in_len);
+psa_status_t rse_comms_wait(void);
+#endif
+
 #endif /* RSE_COMMS_H */
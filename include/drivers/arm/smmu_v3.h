@@ -66,6 +66,12 @@
 int smmuv3_init(uintptr_t smmu_base);
 int smmuv3_security_init(uintptr_t smmu_base);
 
+/* Same as above, on several SMMUs at once */
+int smmuv3_init_all(const uintptr_t *smmu_bases, unsigned int count);
+int smmuv3_security_init_all(const uintptr_t *smmu_bases, unsigned int count);
+
 int smmuv3_ns_set_abort_all(uintptr_t smmu_base);
+int smmuv3_ns_set_abort_all_smmus(const uintptr_t *smmu_bases,
+				  unsigned int count);
 
 #endif /* SMMU_V3_H */
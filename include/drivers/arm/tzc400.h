@@ -88,6 +88,7 @@
  * depicts size of block of registers for programming each region.
  */
 #define TZC_400_REGION_SIZE			U(0x20)
+#define TZC_400_REGION_MAX			U(9)
 #define TZC_400_ACTION_OFF			U(0x4)
 
 #define FILTER_OFFSET				U(0x10)
@@ -110,6 +111,14 @@ void tzc400_configure_region(unsigned int filters,
 			  unsigned int sec_attr,
 			  unsigned int nsaid_permissions);
 void tzc400_update_filters(unsigned int region, unsigned int filters);
+void tzc400_stage_region(unsigned int filters,
+			 unsigned int region,
+			 unsigned long long region_base,
+			 unsigned long long region_top,
+			 unsigned int sec_attr,
+			 unsigned int nsaid_permissions);
+void tzc400_stage_region_disable(unsigned int region);
+unsigned int tzc400_commit_regions(void);
 void tzc400_set_action(unsigned int action);
 void tzc400_enable_filters(void);
 void tzc400_disable_filters(void);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015-2023, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -9,6 +9,7 @@
 
 #include <common/tbbr/tbbr_img_def.h>
 #include <drivers/auth/auth_common.h>
+#include <drivers/auth/crypto_mod.h>
 #include <drivers/auth/img_parser_mod.h>
 
 #include <lib/utils_def.h>
@@ -54,6 +55,19 @@ int auth_mod_get_parent_id(unsigned int img_id, unsigned int *parent_id);
 int auth_mod_verify_img(unsigned int img_id,
 			void *img_ptr,
 			unsigned int img_len);
+#if MBOOT_REUSE_AUTH_DIGEST
+int auth_mod_get_img_digest(unsigned int img_id, uintptr_t data_base,
+			    size_t data_size, enum crypto_md_algo alg,
+			    unsigned char digest[CRYPTO_MD_MAX_SIZE]);
+#endif
+#if AUTH_NV_CTR_CACHE
+int auth_mod_flush_nv_ctrs(void);
+#else
+static inline int auth_mod_flush_nv_ctrs(void)
+{
+	return 0;
+}
+#endif
 
 /* Macro to register a CoT defined as an array of auth_img_desc_t pointers */
 #define REGISTER_COT(_cot) \
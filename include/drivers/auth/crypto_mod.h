@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015-2023, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -133,4 +133,140 @@ int crypto_mod_convert_pk(void *full_pk_ptr, unsigned int full_pk_len,
 
 extern const crypto_lib_desc_t crypto_lib_desc;
 
+#if LOAD_IMAGE_STREAM_HASH
+/*
+ * Incremental hash of an image while it is being loaded. The crypto library
+ * hashes the image with the algorithm used for image hashes in the chain of
+ * trust and uses the resulting digest when the same buffer is later hashed
+ * in full by verify_hash or calc_hash.
+ */
+typedef struct crypto_hash_stream_desc_s {
+	/* Start hashing a new image. Discards any previous digest */
+	int (*start)(void);
+
+	/* Hash the next contiguous chunk of the image */
+	int (*update)(void *data_ptr, unsigned int data_len);
+
+	/* Finalise the digest of the image */
+	int (*finish)(void);
+
+	/* Forget the digest, e.g. once the image may have been modified */
+	void (*discard)(void);
+} crypto_hash_stream_desc_t;
+
+int crypto_mod_hash_stream_start(void);
+int crypto_mod_hash_stream_update(void *data_ptr, unsigned int data_len);
+int crypto_mod_hash_stream_finish(void);
+void crypto_mod_hash_stream_discard(void);
+
+/* Macro to register the incremental hash functions of a crypto library */
+#define REGISTER_CRYPTO_HASH_STREAM(_start, _update, _finish, _discard) \
+	const crypto_hash_stream_desc_t crypto_hash_stream_desc = { \
+		.start = _start, \
+		.update = _update, \
+		.finish = _finish, \
+		.discard = _discard \
+	}
+
+extern const crypto_hash_stream_desc_t crypto_hash_stream_desc;
+#endif /* LOAD_IMAGE_STREAM_HASH */
+
+#if MBOOT_REUSE_AUTH_DIGEST
+/*
+ * Hash verification which also returns the digest it calculated, so that a
+ * measured boot backend can record an authenticated image without hashing it
+ * a second time.
+ */
+typedef struct crypto_auth_digest_desc_s {
+	int (*verify_hash)(void *data_ptr, unsigned int data_len,
+			   void *digest_info_ptr, unsigned int digest_info_len,
+			   enum crypto_md_algo *alg,
+			   unsigned char digest[CRYPTO_MD_MAX_SIZE]);
+} crypto_auth_digest_desc_t;
+
+int crypto_mod_verify_hash_digest(void *data_ptr, unsigned int data_len,
+				  void *digest_info_ptr,
+				  unsigned int digest_info_len,
+				  enum crypto_md_algo *alg,
+				  unsigned char digest[CRYPTO_MD_MAX_SIZE]);
+
+/* Macro to register the digest returning hash verification of a library */
+#define REGISTER_CRYPTO_AUTH_DIGEST(_verify_hash) \
+	const crypto_auth_digest_desc_t crypto_auth_digest_desc = { \
+		.verify_hash = _verify_hash \
+	}
+
+extern const crypto_auth_digest_desc_t crypto_auth_digest_desc;
+#endif /* MBOOT_REUSE_AUTH_DIGEST */
+
+#ifdef CRYPTO_MULTI_HASH
+/* Maximum number of algorithms calc_hashes can be asked for at once */
+#define CRYPTO_MULTI_HASH_MAX	2U
+
+/*
+ * Hash of the same data with several algorithms. The crypto library reads the
+ * data once and feeds each chunk to every algorithm while it is still in the
+ * data cache, instead of reading it again for each of them.
+ */
+typedef struct crypto_multi_hash_desc_s {
+	int (*calc_hashes)(const enum crypto_md_algo *algs, unsigned int num,
+			   void *data_ptr, unsigned int data_len,
+			   unsigned char (*outputs)[CRYPTO_MD_MAX_SIZE]);
+} crypto_multi_hash_desc_t;
+
+int crypto_mod_calc_hashes(const enum crypto_md_algo *algs, unsigned int num,
+			   void *data_ptr, unsigned int data_len,
+			   unsigned char (*outputs)[CRYPTO_MD_MAX_SIZE]);
+
+/* Macro to register the multiple hash function of a crypto library */
+#define REGISTER_CRYPTO_MULTI_HASH(_calc_hashes) \
+	const crypto_multi_hash_desc_t crypto_multi_hash_desc = { \
+		.calc_hashes = _calc_hashes \
+	}
+
+extern const crypto_multi_hash_desc_t crypto_multi_hash_desc;
+#endif /* CRYPTO_MULTI_HASH */
+
+#if DECRYPTION_STREAM
+/*
+ * Authenticated decryption of an image in chunks, as they are read from the
+ * storage. The chunks are decrypted in place and the caller must not use the
+ * plaintext until finish has checked the tag.
+ */
+typedef struct crypto_dec_stream_desc_s {
+	/* Start decrypting a new image. Discards any previous decryption */
+	int (*start)(enum crypto_dec_algo dec_algo, const void *key,
+		     unsigned int key_len, unsigned int key_flags,
+		     const void *iv, unsigned int iv_len);
+
+	/* Decrypt the next chunk of the image in place */
+	int (*update)(void *data_ptr, size_t len);
+
+	/* Check the tag of the whole image */
+	int (*finish)(const void *tag, unsigned int tag_len);
+
+	/* Abandon the decryption, e.g. on a read error */
+	void (*discard)(void);
+} crypto_dec_stream_desc_t;
+
+int crypto_mod_dec_stream_start(enum crypto_dec_algo dec_algo,
+				const void *key, unsigned int key_len,
+				unsigned int key_flags, const void *iv,
+				unsigned int iv_len);
+int crypto_mod_dec_stream_update(void *data_ptr, size_t len);
+int crypto_mod_dec_stream_finish(const void *tag, unsigned int tag_len);
+void crypto_mod_dec_stream_discard(void);
+
+/* Macro to register the streaming decryption functions of a crypto library */
+#define REGISTER_CRYPTO_DEC_STREAM(_start, _update, _finish, _discard) \
+	const crypto_dec_stream_desc_t crypto_dec_stream_desc = { \
+		.start = _start, \
+		.update = _update, \
+		.finish = _finish, \
+		.discard = _discard \
+	}
+
+extern const crypto_dec_stream_desc_t crypto_dec_stream_desc;
+#endif /* DECRYPTION_STREAM */
+
 #endif /* CRYPTO_MOD_H */
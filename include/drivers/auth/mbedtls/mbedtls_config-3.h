@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2024, Arm Limited. All rights reserved.
+ * Copyright (c) 2023-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -67,6 +67,13 @@
 #else
 #define MBEDTLS_ECP_DP_SECP256R1_ENABLED
 #endif
+#if TF_MBEDTLS_ECP_NIST_OPTIM
+/*
+ * Fast reduction modulo the NIST primes, which speeds up every point
+ * operation of the verification at the cost of some code size
+ */
+#define MBEDTLS_ECP_NIST_OPTIM
+#endif
 #endif
 #if TF_MBEDTLS_USE_RSA
 #define MBEDTLS_RSA_C
@@ -0,0 +1,24 @@
+/*
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef SHA256_CE_H
+#define SHA256_CE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define SHA256_CE_DIGEST_SIZE	32U
+
+/*
+ * Calculate the SHA-256 digest of 'len' bytes at 'data' using the
+ * FEAT_SHA256 instructions. Returns 0 on success or -ENOTSUP when the
+ * instructions cannot be used, in which case the caller must fall back
+ * to a software implementation.
+ */
+int sha256_ce_calc_hash(const void *data, size_t len,
+			uint8_t hash[SHA256_CE_DIGEST_SIZE]);
+
+#endif /* SHA256_CE_H */
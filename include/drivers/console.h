@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013-2023, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2013-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -15,12 +15,14 @@
 #if ENABLE_CONSOLE_GETC
 #define CONSOLE_T_GETC			(U(3) * REGSZ)
 #define CONSOLE_T_FLUSH			(U(4) * REGSZ)
-#define CONSOLE_T_BASE			(U(5) * REGSZ)
-#define CONSOLE_T_DRVDATA		(U(6) * REGSZ)
+#define CONSOLE_T_WRITE			(U(5) * REGSZ)
+#define CONSOLE_T_BASE			(U(6) * REGSZ)
+#define CONSOLE_T_DRVDATA		(U(7) * REGSZ)
 #else
 #define CONSOLE_T_FLUSH			(U(3) * REGSZ)
-#define CONSOLE_T_BASE			(U(4) * REGSZ)
-#define CONSOLE_T_DRVDATA		(U(5) * REGSZ)
+#define CONSOLE_T_WRITE			(U(4) * REGSZ)
+#define CONSOLE_T_BASE			(U(5) * REGSZ)
+#define CONSOLE_T_DRVDATA		(U(6) * REGSZ)
 #endif
 
 #define CONSOLE_FLAG_BOOT		(U(1) << 0)
@@ -38,6 +40,7 @@
 
 #ifndef __ASSEMBLER__
 
+#include <stddef.h>
 #include <stdint.h>
 
 typedef struct console {
@@ -52,6 +55,11 @@ typedef struct console {
 	int (*const getc)(struct console *console);
 #endif
 	void (*const flush)(struct console *console);
+	/*
+	 * Optional, outputs len characters at once and returns len or a
+	 * negative error. Unlike putc, it is not expected to translate '\n'.
+	 */
+	int (*const write)(const char *buf, size_t len, struct console *console);
 	uintptr_t base;
 	/* Additional private driver data may follow here. */
 } console_t;
@@ -81,13 +89,36 @@ void console_set_scope(console_t *console, unsigned int scope);
 
 /* Switch to a new global console state (CONSOLE_FLAG_BOOT/RUNTIME/CRASH). */
 void console_switch_state(unsigned int new_state);
-/* Output a character on all consoles registered for the current state. */
+/*
+ * Output a character on all consoles registered for the current state. With
+ * CONSOLE_BUFFERED, the character is only stored in memory until the consoles
+ * are drained.
+ */
 int console_putc(int c);
+/*
+ * Output len characters on all consoles registered for the current state, in
+ * bursts on the consoles implementing write, or store them like
+ * console_putc(). Return len or a negative error.
+ */
+int console_write(const char *buf, size_t len);
+#if CONSOLE_BUFFERED
+/*
+ * Output the characters stored by console_putc() and console_write() on the
+ * consoles. It is called
+ * on console_flush(), on state switches and on CPU idle entry, and may also be
+ * called by the platform, e.g. from a CPU dedicated to it.
+ */
+void console_drain(void);
+#else
+static inline void console_drain(void)
+{
+}
+#endif
 #if ENABLE_CONSOLE_GETC
 /* Read a character (blocking) from any console registered for current state. */
 int console_getc(void);
 #endif
-/* Flush all consoles registered for the current state. */
+/* Drain and flush all consoles registered for the current state. */
 void console_flush(void);
 
 #endif /* __ASSEMBLER__ */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -25,6 +25,8 @@ CASSERT(CONSOLE_T_GETC == __builtin_offsetof(console_t, getc),
 #endif
 CASSERT(CONSOLE_T_FLUSH == __builtin_offsetof(console_t, flush),
 	assert_console_t_flush_offset_mismatch);
+CASSERT(CONSOLE_T_WRITE == __builtin_offsetof(console_t, write),
+	assert_console_t_write_offset_mismatch);
 CASSERT(CONSOLE_T_DRVDATA == sizeof(console_t),
 	assert_console_t_drvdata_offset_mismatch);
 
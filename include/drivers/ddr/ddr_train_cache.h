@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef DDR_TRAIN_CACHE_H
+#define DDR_TRAIN_CACHE_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define DDR_TRAIN_CACHE_TAG_SIZE	32U
+
+/* Width of the temperature bands, in degrees Celsius */
+#ifndef DDR_TRAIN_CACHE_TEMP_BAND
+#define DDR_TRAIN_CACHE_TEMP_BAND	20
+#endif
+
+/* Temperature band of a temperature in degrees Celsius */
+#define DDR_TRAIN_CACHE_TEMP_TO_BAND(_celsius)				\
+	((int32_t)(((_celsius) >= 0) ?					\
+		   ((_celsius) / DDR_TRAIN_CACHE_TEMP_BAND) :		\
+		   ((((_celsius) + 1) / DDR_TRAIN_CACHE_TEMP_BAND) - 1)))
+
+/*
+ * What the training results are valid for. They are only reused for the same
+ * DRAM devices, identified by the hash of their SPD or serial numbers, in the
+ * same temperature band and the same configuration of the controller.
+ */
+struct ddr_train_cache_key {
+	uint32_t dram_id;
+	int32_t temp_band;
+	uint32_t config;
+	uint32_t reserved;
+};
+
+/*
+ * Storage of the training results, provided by the platform. Its area is
+ * split into slots of the size of a record, read and written whole.
+ */
+struct ddr_train_cache_storage {
+	size_t size;
+	int (*read)(size_t offset, void *buf, size_t len);
+	/* Erase the area of the slot as needed and write the record */
+	int (*write)(size_t offset, const void *buf, size_t len);
+	/*
+	 * Compute the tag authenticating a record, ideally a MAC keyed by a
+	 * device unique secret. A plain digest or CRC only detects corruption.
+	 */
+	int (*tag)(const void *buf, size_t len,
+		   uint8_t tag[DDR_TRAIN_CACHE_TAG_SIZE]);
+};
+
+/*
+ * Training of a DDR controller and PHY, provided by their driver. The results
+ * are copied to and from 'data', 'data_size' bytes of scratch memory.
+ */
+struct ddr_train_cache_backend {
+	const char *name;
+	void *data;
+	size_t data_size;
+	void *cookie;
+	/* Run the full training */
+	int (*train)(void *cookie);
+	/* Read the trained values back into 'data' */
+	int (*save)(void *cookie, void *data);
+	/* Program the values from 'data' instead of training */
+	int (*restore)(void *cookie, const void *data);
+	/* Check the memory works with the restored values, optional */
+	int (*verify)(void *cookie);
+};
+
+void ddr_train_cache_init(const struct ddr_train_cache_storage *storage);
+uint32_t ddr_train_cache_dram_id(const void *id, size_t len);
+int ddr_train_cache_run(const struct ddr_train_cache_backend *backend,
+			const struct ddr_train_cache_key *key);
+
+#endif /* DDR_TRAIN_CACHE_H */
@@ -19,6 +19,10 @@
  * function pointer to return the timer value and a clock
  * multiplier/divider. The ratio of the multiplier and the divider is
  * the clock period in microseconds.
+ *
+ * wait_event is optional. It puts the PE in a low-power state until
+ * an event, the given timeout count or the next periodic wake-up,
+ * whichever comes first, so that long waits do not spin on the timer.
  ********************************************************************/
 
 typedef struct timer_ops {
@@ -27,10 +31,12 @@ typedef struct timer_ops {
 	uint32_t clk_div;
 	uint64_t (*timeout_init_us)(uint32_t usec);
 	bool (*timeout_elapsed)(uint64_t cnt);
+	void (*wait_event)(uint64_t cnt);
 } timer_ops_t;
 
 uint64_t timeout_init_us(uint32_t usec);
 bool timeout_elapsed(uint64_t cnt);
+void timeout_wait_event(uint64_t cnt);
 void mdelay(uint32_t msec);
 void udelay(uint32_t usec);
 void timer_init(const timer_ops_t *ops_ptr);
@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef DMA_H
+#define DMA_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*
+ * Operations of a DMA controller copying memory to memory. Addresses are
+ * physical, which the flat mappings of TF-A make equal to virtual addresses.
+ * The DMA framework takes care of the cache maintenance.
+ */
+struct dma_ops {
+	/* Start copying 'len' bytes, a multiple of 'align', from 'src' */
+	int (*start)(uintptr_t dst, uintptr_t src, size_t len);
+	/* Wait for the copy to complete, returns 0 or a negative errno */
+	int (*wait)(void);
+	/* Alignment of the addresses and lengths of the copies */
+	size_t align;
+	/* Largest copy 'start' accepts */
+	size_t max_len;
+};
+
+/*
+ * Start copying 'len' bytes from 'src' to 'dst'. The buffers must not
+ * overlap and must be aligned on CACHE_WRITEBACK_GRANULE and the alignment of
+ * the controller. Returns -ENODEV if no controller is registered.
+ */
+int dma_copy_start(uintptr_t dst, uintptr_t src, size_t len);
+
+/* Wait for the copy started by dma_copy_start() to complete */
+int dma_copy_wait(void);
+
+/*
+ * memcpy() offloading to the DMA controller the copies of at least
+ * 'min_len' bytes given at registration. The unaligned head and tail of the
+ * buffers, and any copy the controller fails, are done by the CPU.
+ */
+void *dma_memcpy(void *dst, const void *src, size_t len);
+
+/* Register the DMA controller, used for copies of 'min_len' bytes or more */
+void dma_register(const struct dma_ops *ops, size_t min_len);
+
+#endif /* DMA_H */
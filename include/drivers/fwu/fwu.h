@@ -8,6 +8,9 @@
 #define FWU_H
 
 #include <stdbool.h>
+#include <stdint.h>
+
+#include <drivers/fwu/fwu_metadata.h>
 
 #define FWU_BANK_STATE_ACCEPTED		0xFCU
 #define FWU_BANK_STATE_VALID		0xFEU
@@ -20,4 +23,21 @@ uint32_t fwu_get_active_bank_state(void);
 uint32_t fwu_get_alternate_boot_bank(void);
 const struct fwu_metadata *fwu_get_metadata(void);
 
+/*
+ * Data of a TL_TAG_FWU_METADATA transfer list entry, through which the later
+ * stages reuse the metadata BL2 has validated instead of reading it again.
+ */
+struct fwu_tl_metadata {
+	/* Bank the images of the current boot are loaded from */
+	uint32_t boot_index;
+	uint32_t reserved;
+	struct fwu_metadata metadata;
+} __packed;
+
+#if TRANSFER_LIST
+struct transfer_list_header;
+int fwu_transfer_list_add(struct transfer_list_header *tl,
+			  uint32_t boot_index);
+#endif
+
 #endif /* FWU_H */
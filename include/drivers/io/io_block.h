@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2016-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -19,6 +19,22 @@ typedef struct io_block_dev_spec {
 	io_block_spec_t	buffer;
 	io_block_ops_t	ops;
 	size_t		block_size;
+	/*
+	 * Largest request (in bytes) read straight into the caller's buffer
+	 * instead of going through the bounce buffer above. This is only done
+	 * for block-aligned file positions and destinations, so the device
+	 * driver must be able to transfer to any such address. Zero disables
+	 * direct reads.
+	 */
+	size_t		max_direct_read;
+	/*
+	 * Optional LRU block cache, used when the platform defines
+	 * IO_BLOCK_CACHE_LINES. Each cache line holds 1 + cache_read_ahead
+	 * consecutive blocks. The cache uses as many lines as fit in this
+	 * region, up to IO_BLOCK_CACHE_LINES.
+	 */
+	io_block_spec_t	cache;
+	unsigned int	cache_read_ahead;
 } io_block_dev_spec_t;
 
 struct io_dev_connector;
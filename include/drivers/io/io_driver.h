@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2014-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -16,6 +16,12 @@
 typedef struct io_entity {
 	struct io_dev_info *dev_handle;
 	uintptr_t info;
+	/*
+	 * Outcome of an io_read_async() request that the driver completed
+	 * synchronously, returned by the matching io_read_wait().
+	 */
+	int async_result;
+	size_t async_length;
 } io_entity_t;
 
 
@@ -48,6 +54,18 @@ typedef struct io_dev_funcs {
 	int (*close)(io_entity_t *entity);
 	int (*dev_init)(io_dev_info_t *dev_info, const uintptr_t init_params);
 	int (*dev_close)(io_dev_info_t *dev_info);
+	/*
+	 * Optional asynchronous read. read_async starts the transfer and
+	 * returns, read_wait blocks until it has completed. Drivers without
+	 * them are driven through the synchronous read function.
+	 */
+	int (*read_async)(io_entity_t *entity, uintptr_t buffer, size_t length);
+	int (*read_wait)(io_entity_t *entity, size_t *length_read);
+	/*
+	 * Optional. Return the address at which the data from the current
+	 * position can be accessed directly, for devices backed by memory.
+	 */
+	int (*map)(io_entity_t *entity, uintptr_t *addr);
 } io_dev_funcs_t;
 
 
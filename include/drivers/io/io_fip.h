@@ -7,9 +7,17 @@
 #ifndef IO_FIP_H
 #define IO_FIP_H
 
+#include <stddef.h>
+#include <stdint.h>
+
+#include <tools_share/uuid.h>
+
 struct io_dev_connector;
 
 int register_io_dev_fip(const struct io_dev_connector **dev_con);
 int fip_dev_get_plat_toc_flag(io_dev_info_t *dev_info, uint16_t *plat_toc_flag);
+int fip_dev_prefetch(io_dev_info_t *dev_info, const uuid_t *uuids,
+		     unsigned int count, uintptr_t buffer, size_t size);
+void fip_dev_prefetch_drop(void);
 
 #endif /* IO_FIP_H */
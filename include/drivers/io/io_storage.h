@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014-2022, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2014-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -99,4 +99,47 @@ int io_write(uintptr_t handle, const uintptr_t buffer, size_t length,
 int io_close(uintptr_t handle);
 
 
+/* Asynchronous operations */
+int io_read_async(uintptr_t handle, uintptr_t buffer, size_t length);
+
+int io_read_wait(uintptr_t handle, size_t *length_read);
+
+
+/* Direct access to the data of devices backed by memory */
+int io_map(uintptr_t handle, uintptr_t *addr);
+
+
+/*
+ * Statistics of the operations, per device type and per image. They are also
+ * written to the PMF io_svc service, as IO_STATS_PMF_ID(type, field).
+ */
+#define IO_STATS_OPEN		0U
+#define IO_STATS_SEEK		1U
+#define IO_STATS_READ		2U
+#define IO_STATS_NR_OPS		3U
+
+/* Fields: operation counts, their time in counter ticks, then bytes read */
+#define IO_STATS_PMF_COUNT(op)	(op)
+#define IO_STATS_PMF_TICKS(op)	(IO_STATS_NR_OPS + (op))
+#define IO_STATS_PMF_BYTES	(2U * IO_STATS_NR_OPS)
+#define IO_STATS_PMF_FIELDS	8U
+#define IO_STATS_PMF_ID(type, field)	\
+	(((unsigned int)(type) * IO_STATS_PMF_FIELDS) + (field))
+#define IO_STATS_PMF_TOTAL_IDS	((unsigned int)IO_TYPE_MAX * IO_STATS_PMF_FIELDS)
+
+#if IO_STATS
+void io_stats_set_image(unsigned int image_id);
+void io_stats_report(void);
+#else
+static inline void io_stats_set_image(unsigned int image_id)
+{
+	(void)image_id;
+}
+
+static inline void io_stats_report(void)
+{
+}
+#endif /* IO_STATS */
+
+
 #endif /* IO_STORAGE_H */
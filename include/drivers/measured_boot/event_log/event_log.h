@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2024, Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -37,7 +37,20 @@
 #endif
 
 /* Number of hashing algorithms supported */
+#ifdef TPM_ALG_ID_EXTRA
+#define HASH_ALG_COUNT		2U
+#else
 #define HASH_ALG_COUNT		1U
+#define TCG_DIGEST_SIZE_EXTRA	0U
+#endif
+
+/*
+ * Size of the digests of an event, one per bank laid out back to back with the
+ * TPM_ALG_ID bank first. Never smaller than what crypto_mod_calc_hash writes.
+ */
+#define EVENT_LOG_DIGESTS_SIZE	(TCG_DIGEST_SIZE + TCG_DIGEST_SIZE_EXTRA)
+#define EVENT_LOG_HASH_SIZE	((EVENT_LOG_DIGESTS_SIZE > CRYPTO_MD_MAX_SIZE) ? \
+				 EVENT_LOG_DIGESTS_SIZE : CRYPTO_MD_MAX_SIZE)
 
 #define EVLOG_INVALID_ID	UINT32_MAX
 
@@ -54,14 +67,16 @@ typedef struct {
 			sizeof(id_event_struct_data_t))
 
 #define	LOC_EVENT_SIZE	(sizeof(event2_header_t) + \
-			sizeof(tpmt_ha) + TCG_DIGEST_SIZE + \
+			(sizeof(tpmt_ha) * HASH_ALG_COUNT) + \
+			EVENT_LOG_DIGESTS_SIZE + \
 			sizeof(event2_data_t) + \
 			sizeof(startup_locality_event_t))
 
 #define	LOG_MIN_SIZE	(ID_EVENT_SIZE + LOC_EVENT_SIZE)
 
 #define EVENT2_HDR_SIZE	(sizeof(event2_header_t) + \
-			sizeof(tpmt_ha) + TCG_DIGEST_SIZE + \
+			(sizeof(tpmt_ha) * HASH_ALG_COUNT) + \
+			EVENT_LOG_DIGESTS_SIZE + \
 			sizeof(event2_data_t))
 
 /* Functions' declarations */
@@ -71,7 +86,7 @@ void event_log_write_specid_event(void);
 void event_log_write_header(void);
 void dump_event_log(uint8_t *log_addr, size_t log_size);
 int event_log_measure(uintptr_t data_base, uint32_t data_size,
-		      unsigned char hash_data[CRYPTO_MD_MAX_SIZE]);
+		      unsigned char hash_data[EVENT_LOG_HASH_SIZE]);
 void event_log_record(const uint8_t *hash, uint32_t event_type,
 		      const event_log_metadata_t *metadata_ptr);
 int event_log_measure_and_record(uintptr_t data_base, uint32_t data_size,
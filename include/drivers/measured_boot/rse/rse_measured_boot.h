@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, Arm Limited. All rights reserved.
+ * Copyright (c) 2022-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -36,5 +36,6 @@ int rse_mboot_measure_and_record(struct rse_mboot_metadata *metadata_ptr,
 int rse_mboot_set_signer_id(struct rse_mboot_metadata *metadata_ptr,
 			    const void *pk_oid, const void *pk_ptr,
 			    size_t pk_len);
+int rse_mboot_finish(void);
 
 #endif /* RSE_MEASURED_BOOT_H */
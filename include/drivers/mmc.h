@@ -269,4 +269,15 @@ int mmc_init(const struct mmc_ops *ops_ptr, unsigned int clk,
 	     unsigned int width, unsigned int flags,
 	     struct mmc_device_info *device_info);
 
+/*
+ * mmc_init() in two steps: mmc_init_start() resets the device and starts its
+ * power-up, mmc_init_wait() completes the enumeration. The other mmc_*()
+ * functions call mmc_init_wait() themselves, so a platform can start the
+ * enumeration early and let the first access to the device wait for it.
+ */
+int mmc_init_start(const struct mmc_ops *ops_ptr, unsigned int clk,
+		   unsigned int width, unsigned int flags,
+		   struct mmc_device_info *device_info);
+int mmc_init_wait(void);
+
 #endif /* MMC_H */
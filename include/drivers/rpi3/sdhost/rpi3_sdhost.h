@@ -97,6 +97,7 @@ void rpi3_sdhost_stop(void);
 #define HC_DBG_FIFO_THRESH_WRITE_SHIFT	9
 #define HC_DBG_FIFO_THRESH_READ_SHIFT	14
 #define HC_DBG_FIFO_THRESH_MASK		0x001f
+#define HC_DBG_FIFO_LEVEL_SHIFT		4
 #define HC_DBG_FSM_MASK			0xf
 #define HC_DBG_FSM_IDENTMODE		0x0
 #define HC_DBG_FSM_DATAMODE		0x1
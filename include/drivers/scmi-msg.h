@@ -49,6 +49,30 @@ void scmi_smt_init_agent_channel(struct scmi_msg_channel *chan);
  */
 void scmi_smt_fastcall_smc_entry(unsigned int agent_id);
 
+/*
+ * Process the SMT formatted messages pending in the channels of agents 0 to
+ * @agent_count - 1 in a single fastcall SMC execution context. Called by
+ * platform on SMC entry, so that agents posting messages at the same time
+ * share one SMC. Channels holding no message are left untouched.
+ *
+ * @agent_count: Number of SCMI agents to look at
+ * Return the number of messages processed
+ */
+unsigned int scmi_smt_fastcall_smc_entry_all(unsigned int agent_count);
+
+/*
+ * Set a clock rate from SMC arguments, without going through the shared
+ * memory of the agent. Called by platform on SMC entry to give agents a fast
+ * path for the frequent rate changes of DVFS.
+ *
+ * @agent_id: SCMI agent ID
+ * @scmi_id: SCMI clock ID
+ * @rate: Target clock frequency in Hertz
+ * Return a compliant SCMI error code
+ */
+int32_t scmi_clock_fastcall_rate_set(unsigned int agent_id,
+				     unsigned int scmi_id, unsigned long rate);
+
 /*
  * Process SMT formatted message in a secure interrupt execution context.
  * Called by platform interrupt handler. When returning, output message is
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, STMicroelectronics - All Rights Reserved
+ * Copyright (c) 2019-2026, STMicroelectronics - All Rights Reserved
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -123,6 +123,7 @@ struct spi_bus_ops {
 	int (*exec_op)(const struct spi_mem_op *op);
 };
 
+bool spi_mem_supports_op(const struct spi_mem_op *op);
 int spi_mem_exec_op(const struct spi_mem_op *op);
 int spi_mem_init_slave(void *fdt, int bus_node,
 		       const struct spi_bus_ops *ops);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, STMicroelectronics - All Rights Reserved
+ * Copyright (c) 2019-2026, STMicroelectronics - All Rights Reserved
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -18,6 +18,7 @@
 #define SPI_NOR_OP_READ_FSR	0x70U	/* Read flag status register */
 #define SPINOR_OP_RDEAR		0xC8U	/* Read Extended Address Register */
 #define SPINOR_OP_WREAR		0xC5U	/* Write Extended Address Register */
+#define SPI_NOR_OP_READ_SFDP	0x5AU	/* Read SFDP parameters */
 
 /* Used for Spansion flashes only. */
 #define SPINOR_OP_BRWR		0x17U	/* Bank register write */
@@ -30,9 +31,21 @@
 #define SPI_NOR_OP_READ_1_1_4	0x6BU	/* Read data bytes (Quad Output SPI) */
 #define SPI_NOR_OP_READ_1_4_4	0xEBU	/* Read data bytes (Quad I/O SPI) */
 
+/* 4-byte address variants of the read opcodes */
+#define SPI_NOR_OP_READ_FAST_4B		0x0CU
+#define SPI_NOR_OP_READ_1_1_2_4B	0x3CU
+#define SPI_NOR_OP_READ_1_2_2_4B	0xBCU
+#define SPI_NOR_OP_READ_1_1_4_4B	0x6CU
+#define SPI_NOR_OP_READ_1_4_4_4B	0xECU
+
 /* Flags for NOR specific configuration */
 #define SPI_NOR_USE_FSR		BIT(0)
 #define SPI_NOR_USE_BANK	BIT(1)
+/*
+ * Select the read operation (and the size if left to 0) from the SFDP
+ * tables of the device, keeping the platform settings if there are none.
+ */
+#define SPI_NOR_USE_SFDP	BIT(2)
 
 struct nor_device {
 	struct spi_mem_op read_op;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015-2018, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -30,6 +30,12 @@
 #define UARTVNDR		0x2c
 #define UARTASR			0x3c
 
+/* Interrupt Identification Register bits */
+#define UARTIIR_FIFOEN		(3 << 6)	/* FIFOs enabled */
+
+/* Smallest transmit FIFO depth of the 16550 variants, in characters */
+#define UART_16550_TX_FIFO_DEPTH	16
+
 /* FIFO Control Register bits */
 #define UARTFCR_FIFOMD_16450	(0 << 6)
 #define UARTFCR_FIFOMD_16550	(1 << 6)
@@ -64,6 +70,7 @@
 #define UARTLSR_RXFIFOERR	(1 << 7)	/* Rx Fifo Error */
 #define UARTLSR_TEMT		(1 << 6)	/* Tx Shift Register Empty */
 #define UARTLSR_THRE		(1 << 5)	/* Tx Holding Register Empty */
+#define UARTLSR_THRE_BIT	5
 #define UARTLSR_BRK		(1 << 4)	/* Break Condition Detected */
 #define UARTLSR_FERR		(1 << 3)	/* Framing Error */
 #define UARTLSR_PERR		(1 << 3)	/* Parity Error */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -308,6 +308,7 @@ struct ufs_dev_desc {
 /* UFS Driver Flags */
 #define UFS_FLAGS_SKIPINIT		(1 << 0)
 #define UFS_FLAGS_VENDOR_SKHYNIX	(U(1) << 2)
+#define UFS_FLAGS_QUEUE_READS		(U(1) << 3)
 
 typedef struct sense_data {
 	uint8_t		resp_code : 7;
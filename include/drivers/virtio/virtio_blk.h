@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef VIRTIO_BLK_H
+#define VIRTIO_BLK_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define VIRTIO_BLK_SECTOR_SIZE		512U
+
+/* Space of each virtio-mmio transport in the register window */
+#define VIRTIO_MMIO_SLOT_SIZE		0x200U
+
+struct virtio_blk_params {
+	/* First of 'nr_slots' consecutive virtio-mmio transports */
+	uintptr_t reg_base;
+	unsigned int nr_slots;
+	/*
+	 * Page aligned memory the device can access, holding the virtqueue,
+	 * the request header and a bounce buffer for the reads to memory
+	 * outside of [dma_base, dma_base + dma_size).
+	 */
+	uintptr_t work_base;
+	size_t work_size;
+	uintptr_t dma_base;
+	size_t dma_size;
+};
+
+/*
+ * Look for a virtio-blk device in the transports and set it up. The device
+ * must be cache coherent, as it is on QEMU. Returns 0 and the size of the
+ * disk in bytes, or -ENODEV if there is no device.
+ */
+int virtio_blk_init(const struct virtio_blk_params *params, size_t *size);
+
+/* Read 'size' bytes from sector 'lba', for io_block */
+size_t virtio_blk_read(int lba, uintptr_t buf, size_t size);
+
+#endif /* VIRTIO_BLK_H */
@@ -25,6 +25,11 @@
 
 #define IMAGE_ATTRIB_SKIP_LOADING	U(0x02)
 #define IMAGE_ATTRIB_PLAT_SETUP		U(0x04)
+/*
+ * Use the image where it lies on a storage backed by memory, rather than
+ * copying it to image_base. Cleared by the loader if it has to copy it.
+ */
+#define IMAGE_ATTRIB_IN_PLACE		U(0x08)
 
 #define INVALID_IMAGE_ID		U(0xFFFFFFFF)
 
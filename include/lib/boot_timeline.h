@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef BOOT_TIMELINE_H
+#define BOOT_TIMELINE_H
+
+#include <lib/utils_def.h>
+
+/*
+ * The boot timeline is a list of timestamped records of the boot stages, the
+ * loading of each image and the initialisation of the runtime services. Each
+ * stage keeps its own records until it hands over to the next one, which
+ * receives the records of all the previous stages in a transfer list entry.
+ * BL31 passes the complete timeline to the Normal world in its transfer list.
+ */
+#define BOOT_TIMELINE_VERSION		U(1)
+
+/* Records kept by a stage until its hand-off */
+#ifndef BOOT_TIMELINE_MAX_RECORDS
+#define BOOT_TIMELINE_MAX_RECORDS	U(128)
+#endif
+
+/* Images accounted for in the report of a stage */
+#ifndef BOOT_TIMELINE_REPORT_IMAGES
+#define BOOT_TIMELINE_REPORT_IMAGES	U(24)
+#endif
+
+/* Stages, as found in the 'stage' field of the records */
+#define BOOT_TL_STAGE_BL1		U(1)
+#define BOOT_TL_STAGE_BL2		U(2)
+#define BOOT_TL_STAGE_BL31		U(3)
+
+/* Events and the meaning of their argument */
+#define BOOT_TL_EV_ENTRY		U(0)	/* Entry of the stage */
+#define BOOT_TL_EV_HANDOFF		U(1)	/* Hand-off to the next stage */
+#define BOOT_TL_EV_IMAGE_LOAD		U(2)	/* Image ID */
+#define BOOT_TL_EV_IMAGE_AUTH		U(3)	/* Image ID */
+#define BOOT_TL_EV_IMAGE_DECOMPRESS	U(4)	/* Load address, bits [31:0] */
+#define BOOT_TL_EV_IMAGE_MEASURE	U(5)	/* Image ID */
+#define BOOT_TL_EV_PLAT_SETUP		U(6)	/* None */
+#define BOOT_TL_EV_SVC_INIT		U(7)	/* Call type << 8 | start OEN */
+#define BOOT_TL_EV_BL32_INIT		U(8)	/* None */
+#define BOOT_TL_EV_RMM_INIT		U(9)	/* None */
+#define BOOT_TL_EV_IMAGE_SIZE		U(10)	/* Size in bytes */
+
+/* Flags of the records, an event with neither flag is instantaneous */
+#define BOOT_TL_FLAG_START		BIT_32(0)
+#define BOOT_TL_FLAG_END		BIT_32(1)
+
+#ifndef __ASSEMBLER__
+
+#include <stdint.h>
+
+/* Data of the TL_TAG_BOOT_TIMELINE transfer list entry */
+struct boot_timeline_hdr {
+	uint32_t version;
+	uint32_t count;		/* Records following the header */
+	uint32_t dropped;	/* Records lost as a stage ran out of room */
+	uint32_t reserved;
+	uint64_t counter_freq;	/* Frequency of the timestamps in Hz */
+};
+
+struct boot_timeline_record {
+	uint64_t timestamp;	/* Physical count of the system counter */
+	uint16_t event;
+	uint8_t stage;
+	uint8_t flags;
+	uint32_t arg;
+};
+
+#if BOOT_TIMELINE && (defined(IMAGE_BL1) || defined(IMAGE_BL2) || \
+		      defined(IMAGE_BL31))
+
+struct transfer_list_header;
+
+void boot_timeline_record(unsigned int event, unsigned int flags,
+			  uint32_t arg);
+int boot_timeline_handoff(struct transfer_list_header *dst,
+			  struct transfer_list_header *src);
+
+#else
+
+static inline void boot_timeline_record(unsigned int event,
+					unsigned int flags, uint32_t arg)
+{
+}
+
+#endif /* BOOT_TIMELINE */
+
+#if BOOT_TIMELINE_REPORT && (defined(IMAGE_BL1) || defined(IMAGE_BL2) || \
+			     defined(IMAGE_BL31))
+void boot_timeline_report(void);
+#else
+static inline void boot_timeline_report(void)
+{
+}
+#endif /* BOOT_TIMELINE_REPORT */
+
+#define BOOT_TIMELINE_MARK(_event, _arg)				\
+	boot_timeline_record((_event), 0U, (_arg))
+#define BOOT_TIMELINE_START(_event, _arg)				\
+	boot_timeline_record((_event), BOOT_TL_FLAG_START, (_arg))
+#define BOOT_TIMELINE_END(_event, _arg)					\
+	boot_timeline_record((_event), BOOT_TL_FLAG_END, (_arg))
+
+#endif /* __ASSEMBLER__ */
+
+#endif /* BOOT_TIMELINE_H */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2023-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -13,7 +13,12 @@
 #define BL2_EXIT	U(3)
 #define BL31_ENTRY	U(4)
 #define BL31_EXIT	U(5)
-#define BL_TOTAL_IDS	U(6)
+/* Only captured by BL2 when BL2_PIPELINED_LOAD=1 */
+#define BL2_IMAGE_READ_START	U(6)
+#define BL2_IMAGE_READ_END	U(7)
+#define BL2_IMAGE_AUTH_START	U(8)
+#define BL2_IMAGE_AUTH_END	U(9)
+#define BL_TOTAL_IDS	U(10)
 
 #ifdef __ASSEMBLER__
 PMF_DECLARE_CAPTURE_TIMESTAMP(bl_svc)
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef PARALLEL_CACHE_MAINT_H
+#define PARALLEL_CACHE_MAINT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <arch_helpers.h>
+
+/* A cache maintenance by address routine, such as flush_dcache_range() */
+typedef void (*cache_maint_op_t)(uintptr_t addr, size_t size);
+
+#if PARALLEL_CACHE_MAINT && defined(IMAGE_BL31)
+void parallel_cache_maint_init(void);
+void parallel_cache_maint(cache_maint_op_t op, uintptr_t addr, size_t size);
+#else
+static inline void parallel_cache_maint(cache_maint_op_t op, uintptr_t addr,
+					size_t size)
+{
+	op(addr, size);
+}
+#endif /* PARALLEL_CACHE_MAINT && defined(IMAGE_BL31) */
+
+static inline void parallel_flush_dcache_range(uintptr_t addr, size_t size)
+{
+	parallel_cache_maint(flush_dcache_range, addr, size);
+}
+
+static inline void parallel_clean_dcache_range(uintptr_t addr, size_t size)
+{
+	parallel_cache_maint(clean_dcache_range, addr, size);
+}
+
+#endif /* PARALLEL_CACHE_MAINT_H */
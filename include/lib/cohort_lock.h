@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef COHORT_LOCK_H
+#define COHORT_LOCK_H
+
+#include <cdefs.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <lib/spinlock.h>
+
+#include <platform_def.h>
+
+#if COHORT_LOCKS
+
+/*
+ * Number of nodes, typically chips, the cpus are split into. The cpus are
+ * assigned to the nodes in equal blocks of consecutive linear indices.
+ */
+#ifndef PLAT_COHORT_LOCK_NODES
+#define PLAT_COHORT_LOCK_NODES		1U
+#endif
+
+/*
+ * Number of times in a row the global lock may be handed over within a node
+ * while cpus of other nodes may be waiting for it.
+ */
+#ifndef PLAT_COHORT_LOCK_BATCH
+#define PLAT_COHORT_LOCK_BATCH		8U
+#endif
+
+/*
+ * Per node part of a cohort lock. 'global_held' and 'batch' are only accessed
+ * with 'local' held. Each node is in its own cache line so that the cpus of a
+ * node only contend on lines local to it.
+ */
+struct cohort_lock_node {
+	ticketlock_t local;
+	bool global_held;
+	uint32_t batch;
+} __aligned(CACHE_WRITEBACK_GRANULE);
+
+/*
+ * Hierarchical lock for memory shared by the cpus of several nodes. A cpu
+ * takes the lock of its node, then the global lock unless the previous owner
+ * from the same node has handed it over. The global lock thus crosses the
+ * link between nodes at most once per batch of owners. AArch64 only.
+ */
+typedef struct cohort_lock {
+	ticketlock_t global __aligned(CACHE_WRITEBACK_GRANULE);
+	struct cohort_lock_node node[PLAT_COHORT_LOCK_NODES];
+} cohort_lock_t;
+
+void cohort_lock(cohort_lock_t *lock);
+void cohort_unlock(cohort_lock_t *lock);
+
+#else /* !COHORT_LOCKS */
+
+/* Without COHORT_LOCKS, a cohort lock is a plain spinlock */
+typedef spinlock_t cohort_lock_t;
+
+static inline void cohort_lock(cohort_lock_t *lock)
+{
+	spin_lock(lock);
+}
+
+static inline void cohort_unlock(cohort_lock_t *lock)
+{
+	spin_unlock(lock);
+}
+
+#endif /* COHORT_LOCKS */
+#endif /* COHORT_LOCK_H */
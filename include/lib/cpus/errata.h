@@ -30,6 +30,15 @@
 #define ERRATA_APPLIES		1
 #define ERRATA_MISSING		2
 
+/*
+ * Word recording the reset errata of a core with ERRATA_RESET_CACHE. Bit n is
+ * set when entry n of the errata list applies. The revision is kept in the
+ * same word so that any copy of it read by a core is self-consistent.
+ */
+#define ERRATA_CACHE_MAX	55
+#define ERRATA_CACHE_VALID_BIT	55
+#define ERRATA_CACHE_REV_SHIFT	56
+
 #ifndef __ASSEMBLER__
 #include <lib/cassert.h>
 
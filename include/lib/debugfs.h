@@ -59,7 +59,7 @@ void debugfs_init(void);
 int debugfs_smc_setup(void);
 
 /* Debugfs version returned through SMC interface */
-#define DEBUGFS_VERSION		(0x000000001U)
+#define DEBUGFS_VERSION		(0x000000002U)
 
 /* Function ID for accessing the debugfs interface from
  * Vendor-Specific EL3 Range.
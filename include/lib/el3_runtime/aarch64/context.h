@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2013-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -82,11 +82,20 @@
  * KFH mode : Used as counter value
  */
 #define CTX_NESTED_EA_FLAG	U(0x48)
+/*
+ * CTX_SIMD_CPTR_TRAP holds the CPTR_EL3 trap bits added on exit to the world,
+ * used by SIMD_LAZY_SWITCH while the FP/SIMD registers hold another world's
+ * state.
+ */
 #if FFH_SUPPORT
  #define CTX_SAVED_ESR_EL3	U(0x50)
  #define CTX_SAVED_SPSR_EL3	U(0x58)
  #define CTX_SAVED_GPREG_LR	U(0x60)
+ #define CTX_SIMD_CPTR_TRAP	U(0x68)
  #define CTX_EL3STATE_END	U(0x70) /* Align to the next 16 byte boundary */
+#elif SIMD_LAZY_SWITCH
+ #define CTX_SIMD_CPTR_TRAP	U(0x50)
+ #define CTX_EL3STATE_END	U(0x60) /* Align to the next 16 byte boundary */
 #else
  #define CTX_EL3STATE_END	U(0x50) /* Align to the next 16 byte boundary */
 #endif /* FFH_SUPPORT */
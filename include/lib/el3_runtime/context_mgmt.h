@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2013-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -9,6 +9,7 @@
 
 #include <assert.h>
 #include <context.h>
+#include <stdbool.h>
 #include <stdint.h>
 
 #include <arch.h>
@@ -50,6 +51,7 @@ void cm_handle_asymmetric_features(void);
 #if (CTX_INCLUDE_EL2_REGS && IMAGE_BL31)
 void cm_el2_sysregs_context_save(uint32_t security_state);
 void cm_el2_sysregs_context_restore(uint32_t security_state);
+void cm_el2_sysregs_set_syndrome_scratch(uint32_t security_state, bool scratch);
 #else
 void cm_el1_sysregs_context_save(uint32_t security_state);
 void cm_el1_sysregs_context_restore(uint32_t security_state);
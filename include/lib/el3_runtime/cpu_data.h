@@ -33,12 +33,20 @@
 /* 8-bytes aligned offset of apiakey[2], size 16 bytes */
 #define	CPU_DATA_APIAKEY_OFFSET		(0x8 + PSCI_CPU_DATA_SIZE_ALIGNED \
 					     + CPU_DATA_CPU_OPS_PTR)
-#define CPU_DATA_CRASH_BUF_OFFSET	(0x10 + CPU_DATA_APIAKEY_OFFSET)
+#define CPU_DATA_PAUTH_END		(0x10 + CPU_DATA_APIAKEY_OFFSET)
 #else /* ENABLE_PAUTH */
-#define CPU_DATA_CRASH_BUF_OFFSET	(0x8 + PSCI_CPU_DATA_SIZE_ALIGNED \
+#define CPU_DATA_PAUTH_END		(0x8 + PSCI_CPU_DATA_SIZE_ALIGNED \
 					     + CPU_DATA_CPU_OPS_PTR)
 #endif /* ENABLE_PAUTH */
 
+#if PAUTH_LAZY_RESTORE
+/* Offset of pauth_live_ctx, size 8 bytes */
+#define CPU_DATA_PAUTH_LIVE_CTX_OFFSET	CPU_DATA_PAUTH_END
+#define CPU_DATA_CRASH_BUF_OFFSET	(0x8 + CPU_DATA_PAUTH_LIVE_CTX_OFFSET)
+#else /* PAUTH_LAZY_RESTORE */
+#define CPU_DATA_CRASH_BUF_OFFSET	CPU_DATA_PAUTH_END
+#endif /* PAUTH_LAZY_RESTORE */
+
 /* need enough space in crash buffer to save 8 registers */
 #define CPU_DATA_CRASH_BUF_SIZE		64
 
@@ -136,6 +144,10 @@ typedef struct cpu_data {
 #if ENABLE_PAUTH
 	uint64_t apiakey[2];
 #endif
+#if PAUTH_LAZY_RESTORE
+	/* Context whose PAuth keys are in the registers, NULL if unknown */
+	void *pauth_live_ctx;
+#endif
 #if CRASH_REPORTING
 	u_register_t crash_buf[CPU_DATA_CRASH_BUF_SIZE >> 3];
 #endif
@@ -163,6 +175,12 @@ CASSERT(CPU_DATA_APIAKEY_OFFSET == __builtin_offsetof
 	assert_cpu_data_pauth_stack_offset_mismatch);
 #endif
 
+#if PAUTH_LAZY_RESTORE
+CASSERT(CPU_DATA_PAUTH_LIVE_CTX_OFFSET == __builtin_offsetof
+	(cpu_data_t, pauth_live_ctx),
+	assert_cpu_data_pauth_live_ctx_offset_mismatch);
+#endif
+
 #if CRASH_REPORTING
 /* verify assembler offsets match data structures */
 CASSERT(CPU_DATA_CRASH_BUF_OFFSET == __builtin_offsetof
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2024-2026, Arm Limited and Contributors. All rights reserved.
  * Copyright (c) 2022, Google LLC. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
@@ -15,54 +15,73 @@
 
 #if CTX_INCLUDE_FPREGS || CTX_INCLUDE_SVE_REGS
 #if CTX_INCLUDE_SVE_REGS
-#define SIMD_VECTOR_LEN_BYTES	(SVE_VECTOR_LEN / 8) /* Length of vector in bytes */
+/* Length of vector in bytes, of the Normal world and of the Secure world */
+#define SIMD_VECTOR_LEN_BYTES		(SVE_VECTOR_LEN / 8)
+#define SIMD_SWD_VECTOR_LEN_BYTES	(SVE_VECTOR_LEN_FOR_SWD / 8)
 #elif CTX_INCLUDE_FPREGS
-#define SIMD_VECTOR_LEN_BYTES	U(16) /* 128 bits fixed vector length for FPU */
+#define SIMD_VECTOR_LEN_BYTES		U(16) /* 128 bits fixed vector length for FPU */
+#define SIMD_SWD_VECTOR_LEN_BYTES	U(16)
 #endif /* CTX_INCLUDE_SVE_REGS */
 
-#define CTX_SIMD_VECTORS	U(0)
-/* there are 32 vector registers, each of size SIMD_VECTOR_LEN_BYTES */
-#define CTX_SIMD_FPSR		(CTX_SIMD_VECTORS + (32 * SIMD_VECTOR_LEN_BYTES))
-#define CTX_SIMD_FPCR		(CTX_SIMD_FPSR + 8)
+/*
+ * The registers of fixed size come first, so that their offsets are the same
+ * whatever the vector length of the world.
+ */
+#define CTX_SIMD_FPSR		U(0)
+#define CTX_SIMD_FPCR		U(8)
 
 #if CTX_INCLUDE_FPREGS && CTX_INCLUDE_AARCH32_REGS
-#define CTX_SIMD_FPEXC32	(CTX_SIMD_FPCR + 8)
-#define CTX_SIMD_PREDICATES	(CTX_SIMD_FPEXC32 + 16)
+#define CTX_SIMD_FPEXC32	U(16)
+#define CTX_SIMD_HINT		U(24)
 #else
-#define CTX_SIMD_PREDICATES      (CTX_SIMD_FPCR + 8)
+#define CTX_SIMD_HINT		U(16)
 #endif /* CTX_INCLUDE_FPREGS && CTX_INCLUDE_AARCH32_REGS */
 
+#if CTX_INCLUDE_SVE_REGS || (CTX_INCLUDE_FPREGS && CTX_INCLUDE_AARCH32_REGS)
+#define CTX_SIMD_VECTORS	U(32)
+#else
+#define CTX_SIMD_VECTORS	U(16)
+#endif
+
 /*
- * Each predicate register is 1/8th the size of a vector register and there are 16
- * predicate registers
+ * The 32 vector registers are followed, with SVE, by the 16 predicate
+ * registers and FFR, each 1/8th the size of a vector register. The assembly
+ * code addresses them relative to the vector length.
  */
-#define CTX_SIMD_FFR		(CTX_SIMD_PREDICATES + (16 * (SIMD_VECTOR_LEN_BYTES / 8)))
+#if CTX_INCLUDE_SVE_REGS
+#define SIMD_REGS_SIZE(vl_bytes)					\
+	round_up(CTX_SIMD_VECTORS + (32U * (vl_bytes)) + (17U * ((vl_bytes) / 8U)), 16U)
+#else
+#define SIMD_REGS_SIZE(vl_bytes)					\
+	(CTX_SIMD_VECTORS + (32U * (vl_bytes)))
+#endif
 
 #ifndef __ASSEMBLER__
 
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <lib/cassert.h>
+#include <lib/utils_def.h>
 
 /*
+ * Header of the SIMD context of a world, followed by its vector registers.
  * Please don't change order of fields in this struct as that may violate
  * alignment requirements and affect how assembly code accesses members of this
  * struct.
  */
 typedef struct {
-	uint8_t vectors[32][SIMD_VECTOR_LEN_BYTES];
 	uint8_t fpsr[8];
 	uint8_t fpcr[8];
 #if CTX_INCLUDE_FPREGS && CTX_INCLUDE_AARCH32_REGS
-	/* 16 bytes to align to next 16 byte boundary when CTX_INCLUDE_SVE_REGS is 0 */
-	uint8_t fpexc32_el2[16];
+	uint8_t fpexc32_el2[8];
 #endif
 #if CTX_INCLUDE_SVE_REGS
-	/* FFR and each of predicates is one-eigth of the SVE vector length */
-	uint8_t predicates[16][SIMD_VECTOR_LEN_BYTES / 8];
-	uint8_t ffr[SIMD_VECTOR_LEN_BYTES / 8];
 	/* SMCCCv1.3 FID[16] hint bit state recorded on EL3 entry */
 	bool hint;
 #endif /* CTX_INCLUDE_SVE_REGS */
+	/* Sized by SIMD_REGS_SIZE() for the vector length of the world */
+	uint8_t vectors[] __aligned(16);
 } __aligned(16) simd_regs_t;
 
 CASSERT(CTX_SIMD_VECTORS == __builtin_offsetof(simd_regs_t, vectors),
@@ -80,15 +99,18 @@ CASSERT(CTX_SIMD_FPEXC32 == __builtin_offsetof(simd_regs_t, fpexc32_el2),
 #endif
 
 #if CTX_INCLUDE_SVE_REGS
-CASSERT(CTX_SIMD_PREDICATES == __builtin_offsetof(simd_regs_t, predicates),
-		assert_predicates_mismatch);
-
-CASSERT(CTX_SIMD_FFR == __builtin_offsetof(simd_regs_t, ffr),
-		assert_ffr_mismatch);
+CASSERT(CTX_SIMD_HINT == __builtin_offsetof(simd_regs_t, hint),
+		assert_hint_mismatch);
 #endif
 
 void simd_ctx_save(uint32_t security_state, bool hint_sve);
 void simd_ctx_restore(uint32_t security_state);
+size_t simd_ctx_size(uint32_t security_state);
+#if SIMD_LAZY_SWITCH
+struct cpu_context;
+void simd_ctx_lazy_trap(struct cpu_context *ctx);
+void simd_ctx_lazy_flush(void);
+#endif
 
 #endif /* __ASSEMBLER__ */
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2023, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -8,6 +8,7 @@
 #define AMU_H
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
 
 #include <context.h>
@@ -45,7 +46,39 @@ static inline void amu_enable(bool el2_unused)
 #endif /*__aarch64__ */
 #endif /* ENABLE_FEAT_AMU */
 
+/*
+ * Layout of the per-cpu entries of the Normal world buffer AMU_SNAPSHOT
+ * publishes the counters into, one entry per core position. 'seq' is odd while
+ * BL31 updates an entry: a reader retries until it reads the same even value
+ * before and after copying the other fields. 'timestamp' is the CNTPCT_EL0
+ * value when the counters were read.
+ */
+#define AMU_SNAPSHOT_MAX_COUNTERS	U(16)
+#define AMU_SNAPSHOT_CPU_OFF		U(1)	/* Counters stopped, cpu down */
+
+struct amu_snapshot {
+	uint64_t seq;
+	uint64_t timestamp;
+	uint32_t flags;
+	uint16_t group0_num;
+	uint16_t group1_num;
+	uint64_t reserved[5];
+	uint64_t group0[AMU_SNAPSHOT_MAX_COUNTERS];
+	uint64_t group1[AMU_SNAPSHOT_MAX_COUNTERS];
+};
+
+#if AMU_SNAPSHOT
+int amu_snapshot_set_buffer(uint64_t base_pa, size_t size);
+int amu_snapshot_update(uint64_t arch_cnts[4]);
+#endif /* AMU_SNAPSHOT */
+
 #if ENABLE_AMU_AUXILIARY_COUNTERS
+/*
+ * Read the auxiliary counter 'idx' of the calling core, or 0 if the core does
+ * not implement it.
+ */
+uint64_t amu_aux_cnt_read(unsigned int idx);
+
 /*
  * AMU data for a single core.
  */
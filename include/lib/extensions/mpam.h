@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2023, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2018-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -8,9 +8,42 @@
 #define MPAM_H
 
 #include <stdbool.h>
+#include <stdint.h>
 
 #include <context.h>
 
+#if ENABLE_MPAM_PARTITIONING
+/*
+ * Limits of a partition in one PARTID space of an MSC. 'base' is the address
+ * of the MSC register frame of that space, mapped by the platform. A 'cpbm'
+ * or 'mbw_max' of zero leaves that control as it is.
+ */
+struct mpam_msc_partition {
+	uintptr_t base;
+	uint16_t partid;
+	uint64_t cpbm;		/* Cache portions 0 to 63 the partition can use */
+	uint16_t mbw_max;	/* Maximum bandwidth, as a fraction of 65536 */
+	bool mbw_hardlim;	/* Do not exceed mbw_max even when idle */
+};
+
+struct mpam_partition_config {
+	/* Labels of the EL3 accesses made on behalf of the Non-secure world */
+	uint16_t el3_partid;
+	uint8_t el3_pmg;
+
+	const struct mpam_msc_partition *msc_parts;
+	unsigned int msc_parts_count;
+};
+
+/*
+ * Return the MPAM partitions of the platform, or NULL to leave the MSCs and
+ * the EL3 labels at their reset values.
+ */
+const struct mpam_partition_config *plat_mpam_partition_config(void);
+
+void mpam_partition_init(void);
+#endif /* ENABLE_MPAM_PARTITIONING */
+
 #if ENABLE_FEAT_MPAM
 void mpam_enable_per_world(per_world_context_t *per_world_ctx);
 void mpam_init_el2_unused(void);
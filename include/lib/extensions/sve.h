@@ -12,13 +12,15 @@
 #if (ENABLE_SME_FOR_NS || ENABLE_SVE_FOR_NS)
 
 void sve_init_el2_unused(void);
-void sve_enable_per_world(per_world_context_t *per_world_ctx);
+void sve_enable_per_world(per_world_context_t *per_world_ctx,
+			  unsigned int vector_len);
 void sve_disable_per_world(per_world_context_t *per_world_ctx);
 #else
 static inline void sve_init_el2_unused(void)
 {
 }
-static inline void sve_enable_per_world(per_world_context_t *per_world_ctx)
+static inline void sve_enable_per_world(per_world_context_t *per_world_ctx,
+					unsigned int vector_len)
 {
 }
 static inline void sve_disable_per_world(per_world_context_t *per_world_ctx)
@@ -27,8 +29,9 @@ static inline void sve_disable_per_world(per_world_context_t *per_world_ctx)
 #endif /* ( ENABLE_SME_FOR_NS | ENABLE_SVE_FOR_NS ) */
 
 #if CTX_INCLUDE_SVE_REGS
-void sve_context_save(simd_regs_t *regs);
-void sve_context_restore(simd_regs_t *regs);
+/* 'zcr_len' is the ZCR_EL3.LEN of the vector length of the world */
+void sve_context_save(simd_regs_t *regs, u_register_t zcr_len);
+void sve_context_restore(simd_regs_t *regs, u_register_t zcr_len);
 #endif
 
 #endif /* SVE_H */
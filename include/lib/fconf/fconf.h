@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2022, Arm Limited. All rights reserved.
+ * Copyright (c) 2019-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -7,6 +7,7 @@
 #ifndef FCONF_H
 #define FCONF_H
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -27,6 +28,66 @@
 		.populate = (callback)						\
 	};
 
+/*
+ * Same as FCONF_REGISTER_POPULATOR(), but with FCONF_LAZY_POPULATE=1 the
+ * callback is only called the first time the properties are read, through
+ * getters which start with FCONF_LAZY(name), instead of by fconf_populate().
+ * The header of the getters must use FCONF_DECLARE_LAZY_POPULATOR(name).
+ *
+ * The DTB must stay mapped and unchanged until the properties have been read,
+ * or until the platform calls fconf_populate_pending().
+ */
+#if FCONF_LAZY_POPULATE
+#define FCONF_REGISTER_LAZY_POPULATOR(config, name, callback)		\
+	struct fconf_lazy_state name##__lazy;					\
+	__attribute__((used, section(".fconf_populator")))			\
+	static const struct fconf_populator (name##__populator) = {		\
+		.config_type = (#config),					\
+		.info = (#name),						\
+		.populate = (callback),						\
+		.lazy = &name##__lazy						\
+	};
+
+#define FCONF_LAZY(name)	fconf_populate_lazy(&name##__lazy)
+#else
+#define FCONF_REGISTER_LAZY_POPULATOR(config, name, callback)		\
+	FCONF_REGISTER_POPULATOR(config, name, callback)
+
+#define FCONF_LAZY(name)	((void)0)
+#endif /* FCONF_LAZY_POPULATE */
+
+/*
+ * Same as FCONF_REGISTER_POPULATOR(), but with FCONF_STATIC_CONFIG=1
+ * fconf_populate() first calls static_callback, which fills the properties
+ * from const tables generated from the DTBs at build time. callback is only
+ * called if a DTB is given, to override them.
+ */
+#if FCONF_STATIC_CONFIG
+#define FCONF_REGISTER_STATIC_POPULATOR(config, name, callback, static_callback) \
+	__attribute__((used, section(".fconf_populator")))			\
+	static const struct fconf_populator (name##__populator) = {		\
+		.config_type = (#config),					\
+		.info = (#name),						\
+		.populate = (callback),						\
+		.populate_static = (static_callback)				\
+	};
+#else
+#define FCONF_REGISTER_STATIC_POPULATOR(config, name, callback, static_callback) \
+	FCONF_REGISTER_POPULATOR(config, name, callback)
+#endif /* FCONF_STATIC_CONFIG */
+
+#define FCONF_DECLARE_LAZY_POPULATOR(name)				\
+	extern struct fconf_lazy_state name##__lazy
+
+struct fconf_populator;
+
+/* DTB a lazy populator is called with on first use */
+struct fconf_lazy_state {
+	const struct fconf_populator *populator;
+	uintptr_t config;	/* 0 until fconf_populate() ran */
+	bool done;
+};
+
 /*
  * Populator callback
  *
@@ -42,6 +103,14 @@ struct fconf_populator {
 	 * Return 0 on success, err_code < 0 otherwise.
 	 */
 	int (*populate)(uintptr_t config);
+
+	/* Callback filling the properties from the build-time tables, if any.
+	 * Return 0 on success, err_code < 0 if the tables lack the properties.
+	 */
+	int (*populate_static)(void);
+
+	/* State of a lazy populator, NULL if it is called by fconf_populate */
+	struct fconf_lazy_state *lazy;
 };
 
 /* This function supports to load tb_fw_config and fw_config dtb */
@@ -51,11 +120,51 @@ int fconf_load_config(unsigned int image_id);
  *
  * This function takes a configuration dtb and calls all the registered
  * populator callback with it.
+ * With FCONF_STATIC_CONFIG=1, the dtb is optional: if config is 0 or does not
+ * point to a valid dtb, only the static populator callbacks are called.
  *
  *  Panic on error.
  */
 void fconf_populate(const char *config_type, uintptr_t config);
 
+#if FCONF_LAZY_POPULATE
+/*
+ * Call the lazy populator if fconf_populate() has recorded its DTB and it has
+ * not been called yet. Panic on error.
+ */
+void fconf_populate_lazy(struct fconf_lazy_state *lazy);
+
+/*
+ * Call all the lazy populators which have not been called yet, before their
+ * DTB is unmapped or overwritten.
+ */
+void fconf_populate_pending(void);
+#else
+static inline void fconf_populate_pending(void)
+{
+}
+#endif /* FCONF_LAZY_POPULATE */
+
+/*
+ * Lookups of the populators. While fconf_populate() runs, they use an index
+ * of the nodes of its DTB built when it starts, instead of walking the DTB
+ * from the root for each lookup. They are the same as their libfdt
+ * counterparts otherwise.
+ */
+#if FCONF_NODE_INDEX
+int fconf_node_offset_by_compatible(const void *dtb, int startoffset,
+				    const char *compatible);
+int fconf_node_offset_by_phandle(const void *dtb, uint32_t phandle);
+int fconf_path_offset(const void *dtb, const char *path);
+#else
+#define fconf_node_offset_by_compatible(dtb, startoffset, compatible)	\
+	fdt_node_offset_by_compatible((dtb), (startoffset), (compatible))
+#define fconf_node_offset_by_phandle(dtb, phandle)			\
+	fdt_node_offset_by_phandle((dtb), (phandle))
+#define fconf_path_offset(dtb, path)					\
+	fdt_path_offset((dtb), (path))
+#endif /* FCONF_NODE_INDEX */
+
 /* FCONF specific getter */
 #define fconf__dtb_getter(prop)	fconf_dtb_info.prop
 
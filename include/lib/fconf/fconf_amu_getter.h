@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, Arm Limited. All rights reserved.
+ * Copyright (c) 2021-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -8,8 +8,9 @@
 #define FCONF_AMU_GETTER_H
 
 #include <lib/extensions/amu.h>
+#include <lib/fconf/fconf.h>
 
-#define amu__config_getter(id)	fconf_amu_config.id
+#define amu__config_getter(id)	(FCONF_LAZY(amu), fconf_amu_config.id)
 
 struct fconf_amu_config {
 	const struct amu_topology *topology;
@@ -17,4 +18,6 @@ struct fconf_amu_config {
 
 extern struct fconf_amu_config fconf_amu_config;
 
+FCONF_DECLARE_LAZY_POPULATOR(amu);
+
 #endif /* FCONF_AMU_GETTER_H */
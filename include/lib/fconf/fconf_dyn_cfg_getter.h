@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023, Arm Limited. All rights reserved.
+ * Copyright (c) 2019-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -26,11 +26,18 @@ struct dyn_cfg_dtb_info_t {
 	uintptr_t secondary_config_addr;
 };
 
+#if FCONF_STATIC_CONFIG
+/* dtb-registry of FW_CONFIG, generated at build time by cot-dt2c */
+extern const bool fconf_static_dtb_registry_present;
+extern const struct dyn_cfg_dtb_info_t fconf_static_dtb_registry[];
+extern const unsigned int fconf_static_dtb_registry_count;
+#endif
+
 unsigned int dyn_cfg_dtb_info_get_index(unsigned int config_id);
 struct dyn_cfg_dtb_info_t *dyn_cfg_dtb_info_getter(unsigned int config_id);
 int fconf_populate_dtb_registry(uintptr_t config);
 
-/* Set config information in global DTB array */
+/* Set config information in global DTB array, replacing that of the same id */
 void set_config_info(uintptr_t config_addr, uintptr_t secondary_config_addr,
 		     uint32_t config_max_size,
 		     unsigned int config_id);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, Arm Limited. All rights reserved.
+ * Copyright (c) 2021-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -7,9 +7,10 @@
 #ifndef FCONF_MPMM_GETTER_H
 #define FCONF_MPMM_GETTER_H
 
+#include <lib/fconf/fconf.h>
 #include <lib/mpmm/mpmm.h>
 
-#define mpmm__config_getter(id)	fconf_mpmm_config.id
+#define mpmm__config_getter(id)	(FCONF_LAZY(mpmm), fconf_mpmm_config.id)
 
 struct fconf_mpmm_config {
 	const struct mpmm_topology *topology;
@@ -17,4 +18,6 @@ struct fconf_mpmm_config {
 
 extern struct fconf_mpmm_config fconf_mpmm_config;
 
+FCONF_DECLARE_LAZY_POPULATOR(mpmm);
+
 #endif /* FCONF_MPMM_GETTER_H */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, Arm Limited. All rights reserved.
+ * Copyright (c) 2019-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -27,6 +27,12 @@ struct tbbr_dyn_config_t {
 
 extern struct tbbr_dyn_config_t tbbr_dyn_config;
 
+#if FCONF_STATIC_CONFIG
+/* "arm,tb_fw" node of TB_FW_CONFIG, generated at build time by cot-dt2c */
+extern const bool fconf_static_tbbr_dyn_config_present;
+extern const struct tbbr_dyn_config_t fconf_static_tbbr_dyn_config;
+#endif
+
 int fconf_populate_tbbr_dyn_config(uintptr_t config);
 
 #endif /* FCONF_TBBR_GETTER_H */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022, Arm Limited. All rights reserved.
+ * Copyright (c) 2022-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -42,6 +42,12 @@ typedef struct pas_region {
 
 #define GPT_NSE_SHIFT                   U(62)
 
+/* Contiguous block sizes the shatter and fuse statistics are kept for */
+#define GPT_BLOCK_2MB			U(0)
+#define GPT_BLOCK_32MB			U(1)
+#define GPT_BLOCK_512MB			U(2)
+#define GPT_BLOCK_LEVELS		U(3)
+
 /* PAS attribute GPI definitions. */
 #define GPT_PAS_ATTR_GPI_SHIFT		U(0)
 #define GPT_PAS_ATTR_GPI_MASK		U(0xF)
@@ -263,7 +269,8 @@ void gpt_disable(void);
  * transition request occurs it is routed to this function where the request is
  * validated then fulfilled if possible.
  *
- * TODO: implement support for transitioning multiple granules at once.
+ * Ranges of granules are transitioned by gpt_delegate_pas_range() and
+ * gpt_undelegate_pas_range() below.
  *
  * Parameters
  *   base: Base address of the region to transition, must be aligned to granule
@@ -277,4 +284,53 @@ void gpt_disable(void);
 int gpt_delegate_pas(uint64_t base, size_t size, unsigned int src_sec_state);
 int gpt_undelegate_pas(uint64_t base, size_t size, unsigned int src_sec_state);
 
+/*
+ * Same as above for a range of granules. The range is transitioned by chunks
+ * with a single cache flush and TLB invalidation per chunk, up to the first
+ * granule that is not in the expected state.
+ *
+ * Parameters
+ *   base: Base address of the region to transition, must be aligned to granule
+ *         size.
+ *   size: Size of region to transition, must be aligned to granule size.
+ *   src_sec_state: Security state of the originating SMC invoking the API.
+ *   transitioned: Number of bytes from base that have been transitioned, also
+ *                 set on failure.
+ *
+ * Return
+ *    Negative Linux error code in the event of a failure, 0 for success.
+ */
+int gpt_delegate_pas_range(uint64_t base, size_t size,
+			   unsigned int src_sec_state, size_t *transitioned);
+int gpt_undelegate_pas_range(uint64_t base, size_t size,
+			     unsigned int src_sec_state, size_t *transitioned);
+
+/*
+ * Public API to fuse the 2MB blocks whose fusing was deferred from the granule
+ * transition service with RME_GPT_DEFER_FUSE. At most 'max' blocks are
+ * handled, all of them if 'max' is 0.
+ *
+ * Return
+ *    Number of 2MB blocks still waiting to be fused.
+ */
+unsigned int gpt_fuse_deferred(unsigned int max);
+
+/*
+ * Public API to get the number of shatter and fuse operations done on
+ * contiguous blocks of the 'level' size, one of GPT_BLOCK_*.
+ *
+ * Return
+ *    Negative Linux error code in the event of a failure, 0 for success.
+ */
+int gpt_get_fuse_stats(unsigned int level, uint64_t *shatter, uint64_t *fuse);
+
+#if RME_GPT_LAZY_L1
+/*
+ * Public API to get the size in bytes of the L1 tables in use and of the
+ * memory left for the L1 tables allocated on the first transition of a
+ * granule in an L0 region.
+ */
+void gpt_get_l1_usage(size_t *used, size_t *left);
+#endif
+
 #endif /* GPT_RME_H */
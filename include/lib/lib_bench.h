@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef LIB_BENCH_H
+#define LIB_BENCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* Largest size the string and zlib functions are measured with */
+#ifndef LIB_BENCH_MAX_SIZE
+#define LIB_BENCH_MAX_SIZE		(16U * 1024U)
+#endif
+
+/* Room for the misaligned copies of a buffer of LIB_BENCH_MAX_SIZE bytes */
+#define LIB_BENCH_SLACK			64U
+
+/* Workspace of inflate(), its state and a 32KB window, and of the encoder */
+#define LIB_BENCH_WORK_SIZE		(48U * 1024U)
+
+/* Size of the buffer lib_bench_run() needs */
+#define LIB_BENCH_BUF_SIZE						\
+	((3U * (LIB_BENCH_MAX_SIZE + LIB_BENCH_SLACK)) +		\
+	 (LIB_BENCH_MAX_SIZE / 8U) + LIB_BENCH_WORK_SIZE)
+
+/*
+ * Counter the functions are timed with. start() is called before the first
+ * measurement and may fail if the counter cannot be used, stop() after the
+ * last one. 'unit' names what read() counts, e.g. "cycles".
+ */
+typedef struct lib_bench_counter {
+	const char *unit;
+	int (*start)(void);
+	uint64_t (*read)(void);
+	void (*stop)(void);
+} lib_bench_counter_t;
+
+/*
+ * Time memcpy(), memmove(), memset(), memcmp(), strcmp() and strlen() over a
+ * range of sizes and alignments, fdt_path_offset() and fdt_getprop() on a
+ * small device tree, and the zlib crc32() and inflate through gunzip(), then
+ * print the cost per byte or per call. 'buf' must be at least
+ * LIB_BENCH_BUF_SIZE bytes.
+ */
+int lib_bench_run(const lib_bench_counter_t *counter, void *buf, size_t size);
+
+/* Cycle counter of the PMU, or the system counter when there is no PMU */
+extern lib_bench_counter_t lib_bench_el3_counter;
+
+#endif /* LIB_BENCH_H */
@@ -25,6 +25,15 @@
 #else
 #define __init
 #endif
+#if BL31_HOT_TEXT
+/*
+ * Functions of the SMC and idle paths, grouped after the exception vectors by
+ * bl31.ld.S. Each function still gets its own section.
+ */
+#define __hot_runtime	__section(".text.hot." __FILE__ "." __XSTRING(__LINE__))
+#else
+#define __hot_runtime
+#endif
 
 #define __printflike(fmtarg, firstvararg) \
 		__attribute__((__format__ (__printf__, fmtarg, firstvararg)))
@@ -4,7 +4,7 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 /*
- * Portions copyright (c) 2018-2019, Arm Limited and Contributors.
+ * Portions copyright (c) 2018-2026, Arm Limited and Contributors.
  * All rights reserved.
  */
 
@@ -26,6 +26,8 @@ int vsnprintf(char *s, size_t n, const char *fmt, va_list args);
 #endif
 
 int putchar(int c);
+/* Not standard: outputs len characters at once, by default with putchar() */
+int putchars(const char *s, size_t len);
 int puts(const char *s);
 
 #endif /* STDIO_H */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, Arm Limited. All rights reserved.
+ * Copyright (c) 2021-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -8,6 +8,7 @@
 #define MPMM_H
 
 #include <stdbool.h>
+#include <stdint.h>
 
 #include <platform_def.h>
 
@@ -46,6 +47,31 @@ struct mpmm_topology {
 	struct mpmm_core cores[PLATFORM_CORE_COUNT]; /* Per-core data */
 };
 
+#if MPMM_GEAR_CONTROL
+/* Number of MPMM gears */
+#define MPMM_GEARS		U(3)
+
+/*
+ * Index of the auxiliary AMU counter of the cycles spent in gear 0, the other
+ * gears following it.
+ */
+#ifndef PLAT_MPMM_GEAR_AMU_IDX
+#define PLAT_MPMM_GEAR_AMU_IDX	U(0)
+#endif
+
+/*
+ * Return the MPMM gear of the current core and the number of cycles it spent
+ * in each gear, or a negative error code if the core does not support MPMM.
+ */
+int mpmm_gear_get(unsigned int *gear, uint64_t residency[MPMM_GEARS]);
+
+/*
+ * Select the MPMM gear of the current core. The gear is kept across power
+ * downs of the core.
+ */
+int mpmm_gear_set(unsigned int gear);
+#endif /* MPMM_GEAR_CONTROL */
+
 #if !ENABLE_MPMM_FCONF
 /*
  * Retrieve the platform's MPMM topology. A `NULL` return value is treated as a
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2020, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2018-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -7,6 +7,7 @@
 #ifndef OBJECT_POOL_H
 #define OBJECT_POOL_H
 
+#include <assert.h>
 #include <stdlib.h>
 
 #include <common/debug.h>
@@ -76,4 +77,105 @@ static inline void *pool_alloc(struct object_pool *pool)
 	return pool_alloc_n(pool, 1U);
 }
 
+/*
+ * Pool of statically allocated objects which can be freed.
+ *
+ * Unlike struct object_pool, objects are allocated and released one at a
+ * time, and running out of objects is reported to the caller instead of
+ * panicking. All objects have the same size so there is no fragmentation:
+ * released objects are kept in a free list and handed out again first, the
+ * back store is only consumed further once that list is empty. Both
+ * operations are O(1) and the pool does not need any initialisation.
+ *
+ * Released objects hold the free list link, so the object size must be at
+ * least a pointer and the back store suitably aligned for one. The pool is
+ * not thread safe, callers serialise accesses with their own lock.
+ */
+struct object_slab {
+	/* Size of 1 object in the slab in byte unit. */
+	const size_t obj_size;
+
+	/* Number of objects in the slab. */
+	const size_t capacity;
+
+	/* Objects back store. */
+	void *const objects;
+
+	/* Objects of the back store which have never been handed out. */
+	size_t untouched;
+
+	/* List of released objects. */
+	void *free_list;
+
+	/* How many objects are currently allocated. */
+	size_t in_use;
+
+	/* Highest number of objects allocated at the same time. */
+	size_t high_water;
+};
+
+/* Create a static slab of objects. */
+#define OBJECT_SLAB(_slab_name, _obj_backstore, _obj_size, _obj_count)	\
+	struct object_slab _slab_name = {				\
+		.objects = (_obj_backstore),				\
+		.obj_size = (_obj_size),				\
+		.capacity = (_obj_count),				\
+		.untouched = 0U,					\
+		.free_list = NULL,					\
+		.in_use = 0U,						\
+		.high_water = 0U,					\
+	}
+
+/* Create a static slab of objects out of an array of pre-allocated objects. */
+#define OBJECT_SLAB_ARRAY(_slab_name, _obj_array)			\
+	OBJECT_SLAB(_slab_name, (_obj_array),				\
+		    sizeof((_obj_array)[0]), ARRAY_SIZE(_obj_array))
+
+/*
+ * Allocate 1 object from a slab.
+ * Return the address of the object, or NULL if all objects are in use.
+ */
+static inline void *slab_alloc(struct object_slab *slab)
+{
+	void *obj;
+
+	assert(slab->obj_size >= sizeof(void *));
+
+	if (slab->free_list != NULL) {
+		obj = slab->free_list;
+		slab->free_list = *(void **)obj;
+	} else if (slab->untouched < slab->capacity) {
+		obj = (char *)(slab->objects) +
+		      (slab->obj_size * slab->untouched);
+		slab->untouched++;
+	} else {
+		return NULL;
+	}
+
+	slab->in_use++;
+	if (slab->in_use > slab->high_water) {
+		slab->high_water = slab->in_use;
+	}
+
+	return obj;
+}
+
+/*
+ * Release an object previously returned by slab_alloc() on the same slab.
+ */
+static inline void slab_free(struct object_slab *slab, void *obj)
+{
+	assert(obj != NULL);
+	assert(((char *)obj >= (char *)(slab->objects)) &&
+	       ((char *)obj < ((char *)(slab->objects) +
+			       (slab->obj_size * slab->untouched))));
+	assert(((size_t)((char *)obj - (char *)(slab->objects)) %
+		slab->obj_size) == 0U);
+	assert(slab->in_use > 0U);
+
+	*(void **)obj = slab->free_list;
+	slab->free_list = obj;
+	slab->in_use--;
+}
+
 #endif /* OBJECT_POOL_H */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2016-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -57,6 +57,14 @@
 #define PMF_SMC_GET_VERSION_32		U(0x87000021)
 #define PMF_SMC_GET_VERSION_64		U(0xC7000021)
 
+#define PMF_SMC_GET_LATENCY_HIST_32	U(0x87000022)
+#define PMF_SMC_GET_LATENCY_HIST_64	U(0xC7000022)
+
+#define PMF_SMC_TRACE_SET_BUF_32	U(0x87000023)
+#define PMF_SMC_TRACE_SET_BUF_64	U(0xC7000023)
+#define PMF_SMC_TRACE_DRAIN_32		U(0x87000024)
+#define PMF_SMC_TRACE_DRAIN_64		U(0xC7000024)
+
 #define PMF_SMC_VERSION			U(0x00000001)
 
 /*
@@ -70,6 +78,7 @@
 /* Following are the supported PMF service IDs */
 #define PMF_PSCI_STAT_SVC_ID	0
 #define PMF_RT_INSTR_SVC_ID	1
+#define PMF_IO_STATS_SVC_ID	2
 
 /*******************************************************************************
  * Function & variable prototypes
@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef PMF_TRACE_H
+#define PMF_TRACE_H
+
+#include <stdint.h>
+
+#include <lib/utils_def.h>
+
+/*
+ * Events recorded in the PMF trace rings. The meaning of the two arguments
+ * depends on the event.
+ */
+#define PMF_TRACE_WORLD_SWITCH	U(1)	/* SMC FID, security state entered */
+#define PMF_TRACE_EHF_INTR	U(2)	/* Raw interrupt ID, priority */
+#define PMF_TRACE_PSCI_CPU_ON	U(3)	/* Target mpidr, 0 */
+#define PMF_TRACE_PSCI_CPU_OFF	U(4)	/* End power level, 0 */
+#define PMF_TRACE_PSCI_SUSPEND	U(5)	/* End power level, power down */
+#define PMF_TRACE_PSCI_WARMBOOT	U(6)	/* 0, 0 */
+#define PMF_TRACE_FFA_CALL	U(7)	/* SMC FID, caller is secure */
+
+/* Size of the Normal world buffer the rings are drained into */
+#define PMF_TRACE_BUF_SIZE	U(0x1000)
+
+#ifndef __ASSEMBLER__
+
+#include <arch_helpers.h>
+
+/* Layout of a record both in the rings and in the drain buffer */
+struct pmf_trace_record {
+	uint64_t timestamp;
+	uint32_t event;
+	uint32_t reserved;
+	uint64_t arg0;
+	uint64_t arg1;
+};
+
+#if PMF_TRACE
+void pmf_trace_event(uint32_t event, u_register_t arg0, u_register_t arg1);
+int pmf_trace_set_buffer(unsigned long long base_pa);
+int pmf_trace_drain(unsigned int core_pos, unsigned int *count,
+		    uint64_t *lost);
+
+#define PMF_TRACE_EVENT(_event, _arg0, _arg1)				\
+	pmf_trace_event((_event), (u_register_t)(_arg0),		\
+			(u_register_t)(_arg1))
+#else
+#define PMF_TRACE_EVENT(_event, _arg0, _arg1)
+#endif /* PMF_TRACE */
+
+#endif /* __ASSEMBLER__ */
+
+#endif /* PMF_TRACE_H */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, Arm Limited. All rights reserved.
+ * Copyright (c) 2022-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -41,6 +41,10 @@
  *	- Request to lock, when slot is already locked.
  * PSA_ERROR_NOT_PERMITTED:
  *	- When the requested slot is not accessible to the caller.
+ *
+ * With RSE_MBOOT_ASYNC_EXTEND, the call returns as soon as the request is
+ * sent to RSE. The status of the extend is then returned by the next call
+ * to RSE, or by rse_comms_wait().
  */
 
 /* Not a standard PSA API, just an extension therefore use the 'rse_' prefix
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013-2019, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2013-2026, Arm Limited and Contributors. All rights reserved.
  * Copyright (c) 2023, NVIDIA Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
@@ -27,6 +27,9 @@
 #define PSCI_NUM_NON_CPU_PWR_DOMAINS	(PSCI_NUM_PWR_DOMAINS - \
 					 PLATFORM_CORE_COUNT)
 
+/* Largest number of cpus powered on by one psci_cpu_on_batch() call */
+#define PSCI_CPU_ON_BATCH_MAX	U(64)
+
 /* This is the power level corresponding to a CPU */
 #define PSCI_CPU_PWR_LVL	U(0)
 
@@ -182,6 +185,7 @@
 
 #ifndef __ASSEMBLER__
 
+#include <stddef.h>
 #include <stdint.h>
 
 /* Function to help build the psci capabilities bitfield */
@@ -310,6 +314,27 @@ typedef struct psci_cpu_data {
 	plat_local_state_t local_state;
 } psci_cpu_data_t;
 
+#if ENABLE_PSCI_STAT
+/*******************************************************************************
+ * Layout of the table written by psci_stat_get_all(). The header is followed
+ * by 'states' entries for each cpu, by core position, then by 'states' entries
+ * for each non cpu power domain, by power domain node index. Within a domain,
+ * entries are indexed like the stats themselves, by the platform
+ * 'get_pwr_lvl_state_idx' hook or else retention first and power down second.
+ ******************************************************************************/
+typedef struct psci_stat_table_hdr {
+	uint32_t cpu_count;
+	uint32_t non_cpu_count;
+	uint32_t states;
+	uint32_t reserved;
+} psci_stat_table_hdr_t;
+
+typedef struct psci_stat_table_entry {
+	uint64_t residency;
+	uint64_t count;
+} psci_stat_table_entry_t;
+#endif /* ENABLE_PSCI_STAT */
+
 /*******************************************************************************
  * Structure populated by platform specific code to export routines which
  * perform common low level power management functions
@@ -317,6 +342,10 @@ typedef struct psci_cpu_data {
 typedef struct plat_psci_ops {
 	void (*cpu_standby)(plat_local_state_t cpu_state);
 	int (*pwr_domain_on)(u_register_t mpidr);
+#if PSCI_CPU_ON_BATCH
+	void (*pwr_domain_on_batch)(const u_register_t *mpidr,
+				    unsigned int count, int *rc);
+#endif
 	void (*pwr_domain_off)(const psci_power_state_t *target_state);
 	int (*pwr_domain_off_early)(const psci_power_state_t *target_state);
 #if PSCI_OS_INIT_MODE
@@ -340,6 +369,10 @@ typedef struct plat_psci_ops {
 	int (*validate_ns_entrypoint)(uintptr_t ns_entrypoint);
 	void (*get_sys_suspend_power_state)(
 				    psci_power_state_t *req_state);
+#if PSCI_IDLE_PREDICT
+	u_register_t (*get_target_residency)(unsigned int pwrlvl,
+				    plat_local_state_t pwr_domain_state);
+#endif
 	int (*get_pwr_lvl_state_idx)(plat_local_state_t pwr_domain_state,
 				    int pwrlvl);
 	int (*translate_power_state_by_mpidr)(u_register_t mpidr,
@@ -360,6 +393,11 @@ unsigned int psci_version(void);
 int psci_cpu_on(u_register_t target_cpu,
 		uintptr_t entrypoint,
 		u_register_t context_id);
+#if PSCI_CPU_ON_BATCH
+int psci_cpu_on_batch(u_register_t aff_base, u_register_t aff0_mask,
+		      uintptr_t entrypoint, u_register_t context_id,
+		      u_register_t *started);
+#endif
 int psci_cpu_suspend(unsigned int power_state,
 		     uintptr_t entrypoint,
 		     u_register_t context_id);
@@ -378,6 +416,13 @@ int psci_set_suspend_mode(unsigned int mode);
 #endif
 void __dead2 psci_power_down_wfi(void);
 void psci_arch_setup(void);
+#if ENABLE_PSCI_STAT
+int psci_stat_get_all(void *buf, size_t size, size_t *written);
+#endif
+#if PSCI_IDLE_PREDICT
+int psci_idle_predict_stats(u_register_t target_cpu, u_register_t *hits,
+			    u_register_t *misses, u_register_t *demotions);
+#endif
 
 #endif /*__ASSEMBLER__*/
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2023, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -87,10 +87,17 @@ int psci_setup(const psci_lib_args_t *lib_args);
 int psci_secondaries_brought_up(void);
 void psci_warmboot_entrypoint(void);
 void psci_register_spd_pm_hook(const spd_pm_ops_t *pm);
+void psci_register_boot_work(const u_register_t *mpidr_list,
+			     unsigned int nr_mpidrs,
+			     void (*work)(void));
 void psci_prepare_next_non_secure_ctx(
 			  entry_point_info_t *next_image_info);
 int psci_stop_other_cores(unsigned int wait_ms,
 			  void (*stop_func)(u_register_t mpidr));
+int psci_stop_other_cores_bcast(unsigned int wait_ms,
+				void (*bcast_func)(void),
+				void (*stop_func)(u_register_t mpidr));
+unsigned int psci_for_each_other_on_cpu(void (*func)(u_register_t mpidr));
 bool psci_is_last_on_cpu_safe(void);
 bool psci_are_all_cpus_on_safe(void);
 void psci_pwrdown_cpu(unsigned int power_level);
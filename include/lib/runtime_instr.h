@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2018, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2016-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -15,7 +15,19 @@
 #define RT_INSTR_EXIT_HW_LOW_PWR	U(3)
 #define RT_INSTR_ENTER_CFLUSH		U(4)
 #define RT_INSTR_EXIT_CFLUSH		U(5)
-#define RT_INSTR_TOTAL_IDS		U(6)
+#define RT_INSTR_ENTER_WORLD_SWITCH	U(6)
+#define RT_INSTR_EXIT_WORLD_SWITCH	U(7)
+#define RT_INSTR_ENTER_SDEI_DISPATCH	U(8)
+#define RT_INSTR_EXIT_SDEI_DISPATCH	U(9)
+#define RT_INSTR_ENTER_DRTM_LAUNCH	U(10)
+#define RT_INSTR_DRTM_DMA_PROT		U(11)
+#define RT_INSTR_DRTM_MEASURE		U(12)
+#define RT_INSTR_EXIT_DRTM_LAUNCH	U(13)
+#define RT_INSTR_ENTER_SCMI_MSG		U(14)
+#define RT_INSTR_EXIT_SCMI_MSG		U(15)
+#define RT_INSTR_ENTER_MM_COMMUNICATE	U(16)
+#define RT_INSTR_EXIT_MM_COMMUNICATE	U(17)
+#define RT_INSTR_TOTAL_IDS		U(18)
 
 #ifndef __ASSEMBLER__
 PMF_DECLARE_CAPTURE_TIMESTAMP(rt_instr_svc)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2013-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -19,12 +19,38 @@ typedef struct bitlock {
 	volatile uint8_t lock;
 } bitlock_t;
 
+/*
+ * Fair lock handing the lock over in the order it was requested. Bits [31:16]
+ * hold the next ticket and bits [15:0] the ticket being served. Only for
+ * memory that is coherent between all the users of the lock.
+ */
+typedef struct ticketlock {
+	volatile uint32_t lock;
+} ticketlock_t;
+
+/*
+ * Writer-preferring reader-writer lock. Bit 31 is set while a writer holds
+ * the lock, bit 30 while a writer waits for the readers to leave, which keeps
+ * new readers out, and bits [29:0] count the readers. AArch64 only.
+ */
+typedef struct rwlock {
+	volatile uint32_t lock;
+} rwlock_t;
+
 void spin_lock(spinlock_t *lock);
 void spin_unlock(spinlock_t *lock);
 
 void bit_lock(bitlock_t *lock, uint8_t mask);
 void bit_unlock(bitlock_t *lock, uint8_t mask);
 
+void ticket_lock(ticketlock_t *lock);
+void ticket_unlock(ticketlock_t *lock);
+
+void read_lock(rwlock_t *lock);
+void read_unlock(rwlock_t *lock);
+void write_lock(rwlock_t *lock);
+void write_unlock(rwlock_t *lock);
+
 #else
 
 /* Spin lock definitions for use in assembly */
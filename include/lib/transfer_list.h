@@ -1,5 +1,6 @@
 /*
  * Copyright (c) 2023-2024, Linaro Limited and Contributors. All rights reserved.
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -56,13 +57,22 @@ enum transfer_list_tag_id {
 	TL_TAG_HOB_BLOCK = 2,
 	TL_TAG_HOB_LIST = 3,
 	TL_TAG_ACPI_TABLE_AGGREGATE = 4,
+	TL_TAG_TPM_EVLOG = 5,
 	TL_TAG_OPTEE_PAGABLE_PART = 0x100,
 	TL_TAG_DT_SPMC_MANIFEST = 0x101,
 	TL_TAG_EXEC_EP_INFO64 = 0x102,
 	TL_TAG_TB_FW_CONFIG = 0x103,
 	TL_TAG_SRAM_LAYOUT64 = 0x104,
+	/* Not allocated by the Firmware Handoff specification yet */
+	TL_TAG_BOOT_TIMELINE = 0xfff000,
+	TL_TAG_DATA_REF = 0xfff001,
+	TL_TAG_FWU_METADATA = 0xfff002,
 };
 
+/* The data referenced by a TL_TAG_DATA_REF entry is in Non-secure memory */
+#define TL_REF_ATTR_NS		BIT(0)
+#define TL_REF_ATTR_MASK	TL_REF_ATTR_NS
+
 enum transfer_list_ops {
 	TL_OPS_NON, /* invalid for any operation */
 	TL_OPS_ALL, /* valid for all operations */
@@ -109,6 +119,20 @@ struct __attribute__((packed)) transfer_list_entry {
 
 CASSERT(sizeof(struct transfer_list_entry) == U(0x8), assert_transfer_list_entry_size);
 
+/*
+ * Data of a TL_TAG_DATA_REF entry, standing for an entry with tag @tag_id
+ * whose data is left where it is in memory rather than copied into the list.
+ * The referenced data is not moved when the list is relocated.
+ */
+struct transfer_list_data_ref {
+	uint64_t addr;
+	uint64_t size;
+	uint32_t tag_id;
+	uint32_t attr; /* TL_REF_ATTR_* */
+};
+
+CASSERT(sizeof(struct transfer_list_data_ref) == U(0x18), assert_transfer_list_data_ref_size);
+
 void transfer_list_dump(struct transfer_list_header *tl);
 entry_point_info_t *
 transfer_list_set_handoff_args(struct transfer_list_header *tl,
@@ -122,6 +146,9 @@ enum transfer_list_ops
 transfer_list_check_header(const struct transfer_list_header *tl);
 
 void transfer_list_update_checksum(struct transfer_list_header *tl);
+void transfer_list_update_entry_checksum(struct transfer_list_header *tl,
+					 struct transfer_list_entry *entry,
+					 uint8_t old_data_sum);
 bool transfer_list_verify_checksum(const struct transfer_list_header *tl);
 
 bool transfer_list_set_data_size(struct transfer_list_header *tl,
@@ -142,6 +169,14 @@ transfer_list_add_with_align(struct transfer_list_header *tl, uint32_t tag_id,
 			     uint32_t data_size, const void *data,
 			     uint8_t alignment);
 
+struct transfer_list_entry *
+transfer_list_add_ref(struct transfer_list_header *tl, uint32_t tag_id,
+		      uintptr_t addr, size_t size, uint32_t attr);
+
+const struct transfer_list_data_ref *
+transfer_list_entry_ref(const struct transfer_list_header *tl,
+			struct transfer_list_entry *entry);
+
 struct transfer_list_entry *
 transfer_list_next(struct transfer_list_header *tl,
 		   struct transfer_list_entry *last);
@@ -149,5 +184,9 @@ transfer_list_next(struct transfer_list_header *tl,
 struct transfer_list_entry *transfer_list_find(struct transfer_list_header *tl,
 					       uint32_t tag_id);
 
+void *transfer_list_find_data(struct transfer_list_header *tl, uint32_t tag_id,
+			      size_t *size,
+			      const struct transfer_list_data_ref **ref);
+
 #endif /*__ASSEMBLER__*/
 #endif /*__TRANSFER_LIST_H*/
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -43,6 +43,8 @@
 #define PAGE_DESC		U(0x3) /* Table level 3 */
 
 #define DESC_MASK		U(0x3)
+/* Descriptors with this bit clear are invalid, whatever their other bits */
+#define DESC_VALID		U(0x1)
 
 #define FIRST_LEVEL_DESC_N	ONE_GB_SHIFT
 #define SECOND_LEVEL_DESC_N	TWO_MB_SHIFT
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -337,6 +337,24 @@ int mmap_remove_dynamic_region_ctx(xlat_ctx_t *ctx,
 				uintptr_t base_va,
 				size_t size);
 
+/*
+ * Open and close a batch of dynamic region additions and removals. Between the
+ * two calls the functions above update the translation tables as usual, but
+ * the barriers and TLB invalidations they need are only issued once, when the
+ * batch is committed. The whole translation regime is invalidated then if any
+ * region was removed.
+ *
+ * The regions removed in a batch must not be accessed before it is committed.
+ * Batches cannot be nested, and the caller must serialise them with any other
+ * change to the context as for the individual functions. Adding a region
+ * after removing one in the same batch costs an extra invalidation, so
+ * removals are best grouped after additions.
+ */
+void mmap_dynamic_batch_begin(void);
+void mmap_dynamic_batch_begin_ctx(xlat_ctx_t *ctx);
+void mmap_dynamic_batch_commit(void);
+void mmap_dynamic_batch_commit_ctx(xlat_ctx_t *ctx);
+
 #endif /* PLAT_XLAT_TABLES_DYNAMIC */
 
 /*
@@ -412,5 +430,21 @@ int xlat_get_mem_attributes_ctx(const xlat_ctx_t *ctx, uintptr_t base_va,
 				uint32_t *attr);
 int xlat_get_mem_attributes(uintptr_t base_va, uint32_t *attr);
 
+/*
+ * Query the occupancy of the pool of translation tables of a context, e.g. to
+ * size MAX_XLAT_TABLES from measurements.
+ *
+ * ctx
+ *   Translation context to work on.
+ * used
+ *   Output parameter where to store the number of tables currently in use.
+ * max_used
+ *   Output parameter where to store the highest number of tables that have
+ *   been in use at the same time.
+ */
+void xlat_get_tables_usage_ctx(const xlat_ctx_t *ctx, unsigned int *used,
+			       unsigned int *max_used);
+void xlat_get_tables_usage(unsigned int *used, unsigned int *max_used);
+
 #endif /*__ASSEMBLER__*/
 #endif /* XLAT_TABLES_V2_H */
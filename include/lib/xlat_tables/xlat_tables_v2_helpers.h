@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2020, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -82,7 +82,16 @@ struct xlat_ctx {
 	int *tables_mapped_regions;
 #endif /* PLAT_XLAT_TABLES_DYNAMIC */
 
+	/*
+	 * Number of tables used so far. With dynamic regions, tables that are
+	 * released are kept in a list starting at 'free_table' (-1 if empty) to
+	 * be reused first, so this is also the highest number of tables that
+	 * have been in use at the same time.
+	 */
 	int next_table;
+#if PLAT_XLAT_TABLES_DYNAMIC
+	int free_table;
+#endif /* PLAT_XLAT_TABLES_DYNAMIC */
 
 	/*
 	 * Base translation table. It doesn't need to have the same amount of
@@ -105,6 +114,15 @@ struct xlat_ctx {
 	/* Set to true when the translation tables are initialized. */
 	bool initialized;
 
+#if PLAT_XLAT_TABLES_DYNAMIC
+	/*
+	 * Set while a batch of dynamic region changes is open, and when a
+	 * region removed in that batch still needs its TLB entries invalidated.
+	 */
+	bool batch;
+	bool batch_tlbi_pending;
+#endif /* PLAT_XLAT_TABLES_DYNAMIC */
+
 	/*
 	 * Translation regime managed by this xlat_ctx_t. It should be one of
 	 * the EL*_REGIME defines.
@@ -117,7 +135,8 @@ struct xlat_ctx {
 	static int _ctx_name##_mapped_regions[_xlat_tables_count];
 
 #define XLAT_REGISTER_DYNMAP_STRUCT(_ctx_name)				\
-	.tables_mapped_regions = _ctx_name##_mapped_regions,
+	.tables_mapped_regions = _ctx_name##_mapped_regions,		\
+	.free_table = -1,
 #else
 #define XLAT_ALLOC_DYNMAP_STRUCT(_ctx_name, _xlat_tables_count)		\
 	/* do nothing */
@@ -225,6 +225,9 @@
 		<< ARM_DRTM_REGION_SIZE_TYPE_4K_PAGE_NUM_SHIFT));	\
 	} while (false)
 
+/* Record the calling PE as the boot PE, must be called on the boot PE */
+void drtm_record_boot_pe(void);
+
 /* Initialization routine for the DRTM service */
 int drtm_setup(void);
 
@@ -21,6 +21,7 @@
 #define FFA_ERROR_INTERRUPTED		-5
 #define FFA_ERROR_DENIED		-6
 #define FFA_ERROR_RETRY			-7
+#define FFA_ERROR_NO_DATA		-8
 
 /* The macros below are used to identify FFA calls from the SMC function ID */
 #define FFA_FNUM_MIN_VALUE	U(0x60)
@@ -383,4 +384,48 @@ struct ffa_partition_info_v1_1 {
 	uint32_t uuid[4];
 };
 
+/* FF-A feature IDs of the interrupts used by notifications. */
+#define FFA_FEATURE_NPI				U(0x1)
+#define FFA_FEATURE_SRI				U(0x2)
+
+/* FFA_NOTIFICATION_BIND and FFA_NOTIFICATION_SET flags. */
+#define FFA_NOTIFICATION_FLAG_PER_VCPU		U(1 << 0)
+#define FFA_NOTIFICATION_FLAG_DELAY_SRI		U(1 << 1)
+#define FFA_NOTIFICATION_SET_VCPU_SHIFT		U(16)
+#define FFA_NOTIFICATION_SET_FLAGS_MASK		U(0xFFFF0003)
+
+/* FFA_NOTIFICATION_GET flags, selecting the bitmaps to retrieve. */
+#define FFA_NOTIFICATION_GET_FLAG_SP		U(1 << 0)
+#define FFA_NOTIFICATION_GET_FLAG_VM		U(1 << 1)
+#define FFA_NOTIFICATION_GET_FLAG_SPM		U(1 << 2)
+#define FFA_NOTIFICATION_GET_FLAG_HYP		U(1 << 3)
+#define FFA_NOTIFICATION_GET_VCPU_SHIFT		U(16)
+
+/*
+ * FFA_NOTIFICATION_INFO_GET response: flags in w2, followed by lists of an
+ * endpoint ID and up to three of its vCPU IDs packed in the next registers.
+ */
+#define FFA_NOTIFICATION_INFO_GET_MORE_PENDING	U(1 << 0)
+#define FFA_NOTIFICATION_INFO_GET_LISTS_SHIFT	U(7)
+#define FFA_NOTIFICATION_INFO_GET_LIST_SHIFT(l)	(U(12) + (U(2) * (l)))
+#define FFA_NOTIFICATION_INFO_GET_MAX_LISTS	U(10)
+#define FFA_NOTIFICATION_INFO_GET_MAX_VCPUS	U(3)
+
+/* Framework notifications, set by the SPMC or the Hypervisor. */
+#define FFA_FRAMEWORK_NOTIF_RX_BUFFER_FULL	U(1 << 0)
+
+/* FFA_MSG_SEND2 flags. */
+#define FFA_MSG_SEND2_FLAG_DELAY_SRI		U(1 << 1)
+
+/* Header of an indirect message in the RX/TX buffers as per FF-A v1.1. */
+struct ffa_partition_msg_hdr {
+	uint32_t flags;
+	uint32_t reserved;
+	/* Offset of the payload from the start of the header. */
+	uint32_t offset;
+	/* Sender ID in bits [31:16] and receiver ID in bits [15:0]. */
+	uint32_t sender_receiver;
+	uint32_t size;
+};
+
 #endif /* FFA_SVC_H */
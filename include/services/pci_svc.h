@@ -7,6 +7,8 @@
 #ifndef PCI_SVC_H
 #define PCI_SVC_H
 
+#include <stddef.h>
+
 #include <lib/utils_def.h>
 
 /* SMCCC PCI platform functions */
@@ -46,6 +48,23 @@ uint32_t pci_read_config(uint32_t addr, uint32_t off, uint32_t sz, uint32_t *val
 uint32_t pci_write_config(uint32_t addr, uint32_t off, uint32_t sz, uint32_t val);
 uint32_t pci_get_bus_for_seg(uint32_t seg, uint32_t *bus_range, uint32_t *nseg);
 
+/*
+ * One configuration space access of a VEN_EL3_PCI_BATCH call, in the layout
+ * the Normal world writes into the shared buffer.
+ */
+struct pci_batch_op {
+	uint32_t addr;		/* Segment, bus, device and function */
+	uint16_t off;		/* Offset in the configuration space */
+	uint8_t size;		/* SMC_PCI_SZ_* */
+	uint8_t write;		/* 1 for a write, 0 for a read */
+	uint32_t val;		/* Value to write, or value read */
+};
+
+#define PCI_BATCH_OP_READ		U(0)
+#define PCI_BATCH_OP_WRITE		U(1)
+
+int pci_config_batch(struct pci_batch_op *ops, size_t count, size_t *done);
+
 /* Return codes for Arm PCI Config Space Access Firmware SMC calls */
 #define SMC_PCI_CALL_SUCCESS	       U(0)
 #define SMC_PCI_CALL_NOT_SUPPORTED	-1
@@ -14,7 +14,7 @@
 #include <lib/cassert.h>
 
 #define RMMD_MANIFEST_VERSION_MAJOR		U(0)
-#define RMMD_MANIFEST_VERSION_MINOR		U(3)
+#define RMMD_MANIFEST_VERSION_MINOR		U(4)
 
 #define RMM_CONSOLE_MAX_NAME_LEN		U(8)
 
@@ -98,10 +98,10 @@ CASSERT(offsetof(struct console_list, consoles) == 8UL,
 CASSERT(offsetof(struct console_list, checksum) == 16UL,
 			rmm_manifest_console_list_checksum);
 
-/* Boot manifest core structure as per v0.3 */
+/* Boot manifest core structure as per v0.4 */
 struct rmm_manifest {
 	uint32_t version;			/* Manifest version */
-	uint32_t padding;			/* RES0 */
+	uint32_t num_pages;			/* Pages of the manifest (v0.4) */
 	uintptr_t plat_data;			/* Manifest platform data */
 	struct ns_dram_info plat_dram;		/* Platform NS DRAM data (v0.2) */
 	struct console_list plat_console;	/* Platform console list (v0.3) */
@@ -109,6 +109,8 @@ struct rmm_manifest {
 
 CASSERT(offsetof(struct rmm_manifest, version) == 0UL,
 			rmm_manifest_version_unaligned);
+CASSERT(offsetof(struct rmm_manifest, num_pages) == 4UL,
+			rmm_manifest_num_pages_unaligned);
 CASSERT(offsetof(struct rmm_manifest, plat_data) == 8UL,
 			rmm_manifest_plat_data_unaligned);
 CASSERT(offsetof(struct rmm_manifest, plat_dram) == 16UL,
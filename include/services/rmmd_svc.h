@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2021-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -135,6 +135,18 @@
 /* Bit 0 of FEAT_REG_0 */
 /* 1 - the feature is present in EL3 , 0 - the feature is absent */
 #define RMM_EL3_FEAT_REG_0_EL3_TOKEN_SIGN_MASK		U(0x1)
+/* Bit 1 of FEAT_REG_0, starting RMM-EL3 interface version 0.5 */
+/* 1 - the GTSI range commands are present in EL3, 0 - they are absent */
+#define RMM_EL3_FEAT_REG_0_GTSI_RANGE_MASK		U(0x2)
+/* Bit 2 of FEAT_REG_0, starting RMM-EL3 interface version 0.5 */
+/* 1 - the GTSI fuse and statistics commands are present in EL3 */
+#define RMM_EL3_FEAT_REG_0_GTSI_FUSE_MASK		U(0x4)
+/* Bit 3 of FEAT_REG_0, starting RMM-EL3 interface version 0.5 */
+/* 1 - the GTSI scrub and delegate command is present in EL3 */
+#define RMM_EL3_FEAT_REG_0_GTSI_SCRUB_MASK		U(0x8)
+/* Bit 4 of FEAT_REG_0, starting RMM-EL3 interface version 0.5 */
+/* 1 - the EL2 scratch registers command is present in EL3 */
+#define RMM_EL3_FEAT_REG_0_EL2_SCRATCH_MASK		U(0x10)
 
 /*
  * Function codes to support attestation where EL3 is used to sign
@@ -161,6 +173,94 @@
 #define RMM_EL3_TOKEN_SIGN_PULL_RESP_OP         U(2)
 #define RMM_EL3_TOKEN_SIGN_GET_RAK_PUB_OP       U(3)
 
+/*
+ * Delegate or undelegate a range of granules at once. The arguments to these
+ * SMCs are:
+ *    arg0 - Function ID.
+ *    arg1 - PA of the start of the range, aligned to the granule size.
+ *    arg2 - Size of the range in bytes, aligned to the granule size.
+ * The return arguments are:
+ *    ret0 - Status / error.
+ *    ret1 - Number of bytes from arg1 that have been transitioned, also on
+ *           failure.
+ *
+ * Starting RMM-EL3 interface version 0.5.
+ */
+					/* 0x1B6 - 0x1B7 */
+#define RMM_GTSI_DELEGATE_RANGE		SMC64_RMMD_EL3_FID(U(6))
+#define RMM_GTSI_UNDELEGATE_RANGE	SMC64_RMMD_EL3_FID(U(7))
+
+/*
+ * Fuse the GPT contiguous blocks whose fusing EL3 has deferred out of the
+ * granule transitions, meant to be called by the RMM when it is idle. The
+ * arguments to this SMC are:
+ *    arg0 - Function ID.
+ *    arg1 - Maximum number of 2MB blocks to handle, 0 for all of them.
+ * The return arguments are:
+ *    ret0 - Status / error.
+ *    ret1 - Number of 2MB blocks still waiting to be fused.
+ *
+ * Starting RMM-EL3 interface version 0.5.
+ */
+					/* 0x1B8 */
+#define RMM_GTSI_FUSE			SMC64_RMMD_EL3_FID(U(8))
+
+/*
+ * Retrieve the number of shatter and fuse operations done by EL3 on the GPT
+ * contiguous blocks of a given size. The arguments to this SMC are:
+ *    arg0 - Function ID.
+ *    arg1 - Block size, one of RMM_GTSI_BLOCK_*.
+ * The return arguments are:
+ *    ret0 - Status / error.
+ *    ret1 - Number of blocks shattered.
+ *    ret2 - Number of blocks fused.
+ *
+ * Starting RMM-EL3 interface version 0.5.
+ */
+					/* 0x1B9 */
+#define RMM_GTSI_STATS			SMC64_RMMD_EL3_FID(U(9))
+
+/* Block sizes for RMM_GTSI_STATS */
+#define RMM_GTSI_BLOCK_2MB		U(0)
+#define RMM_GTSI_BLOCK_32MB		U(1)
+#define RMM_GTSI_BLOCK_512MB		U(2)
+
+/*
+ * Delegate a granule and have EL3 zero it once it belongs to the Realm PAS, so
+ * that the RMM does not need to scrub it itself. The arguments to this SMC
+ * are:
+ *    arg0 - Function ID.
+ *    arg1 - PA of the start of the granule to be delegated.
+ * The return arguments are:
+ *    ret0 - Status / error.
+ *
+ * Starting RMM-EL3 interface version 0.5.
+ */
+					/* 0x1BA */
+#define RMM_GTSI_SCRUB_DELEGATE		SMC64_RMMD_EL3_FID(U(10))
+
+/*
+ * Declare groups of EL2 registers the RMM does not need EL3 to preserve across
+ * the Realm world exits, so that they are left out of the world switch. The
+ * arguments to this SMC are:
+ *    arg0 - Function ID.
+ *    arg1 - Mask of RMM_EL2_SCRATCH_* groups. A group not in the mask is
+ *           preserved again.
+ * The return arguments are:
+ *    ret0 - Status / error.
+ *
+ * Starting RMM-EL3 interface version 0.5.
+ */
+					/* 0x1BB */
+#define RMM_EL2_SCRATCH_REGS		SMC64_RMMD_EL3_FID(U(11))
+
+/*
+ * AFSR0_EL2, AFSR1_EL2, ELR_EL2, ESR_EL2, FAR_EL2, HPFAR_EL2 and SPSR_EL2,
+ * which the RMM writes or reads back before it relies on their value.
+ */
+#define RMM_EL2_SCRATCH_SYNDROME	U(0x1)
+#define RMM_EL2_SCRATCH_MASK		RMM_EL2_SCRATCH_SYNDROME
+
 /* ECC Curve types for attest key generation */
 #define ATTEST_KEY_CURVE_ECC_SECP384R1		U(0)
 
@@ -188,7 +288,7 @@
  * Increase this when a bug is fixed, or a feature is added without
  * breaking compatibility.
  */
-#define RMM_EL3_IFC_VERSION_MINOR	(U(4))
+#define RMM_EL3_IFC_VERSION_MINOR	(U(5))
 
 #define RMM_EL3_INTERFACE_VERSION				\
 	(((RMM_EL3_IFC_VERSION_MAJOR << 16) & 0x7FFFF) |	\
@@ -114,7 +114,7 @@ typedef struct sdei_ev_map {
 	unsigned int intr;	/* Physical interrupt number for a bound map */
 	unsigned int map_flags;	/* Mapping flags, see SDEI_MAPF_* */
 	int reg_count;		/* Registration count */
-	spinlock_t lock;	/* Per-event lock */
+	rwlock_t lock;		/* Per-event lock */
 } sdei_ev_map_t;
 
 typedef struct sdei_mapping {
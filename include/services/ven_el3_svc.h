@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024, Arm Limited. All rights reserved.
+ * Copyright (c) 2024-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -28,5 +28,52 @@
 
 /* PMF_SMC_GET_TIMESTAMP_32	0x87000020U */
 /* PMF_SMC_GET_TIMESTAMP_64	0xC7000020U */
+/* PMF_SMC_GET_LATENCY_HIST_32	0x87000022U */
+/* PMF_SMC_GET_LATENCY_HIST_64	0xC7000022U */
+/* PMF_SMC_TRACE_SET_BUF_32	0x87000023U */
+/* PMF_SMC_TRACE_SET_BUF_64	0xC7000023U */
+/* PMF_SMC_TRACE_DRAIN_32	0x87000024U */
+/* PMF_SMC_TRACE_DRAIN_64	0xC7000024U */
+
+/* Copy the PSCI stats of all power domains into a Normal world buffer */
+#define VEN_EL3_PSCI_STAT_GET_ALL_32	0x87000030
+#define VEN_EL3_PSCI_STAT_GET_ALL_64	0xC7000030
+
+/* Largest buffer accepted by VEN_EL3_PSCI_STAT_GET_ALL */
+#define VEN_EL3_PSCI_STAT_BUF_MAX	(64U * 1024U)
+
+/* Power on several cpus sharing their Aff1 and above affinity levels */
+#define VEN_EL3_PSCI_CPU_ON_BATCH_64	0xC7000031
+
+/* Idle prediction hit, miss and demotion counters of a cpu */
+#define VEN_EL3_PSCI_IDLE_PREDICT_32	0x87000032
+#define VEN_EL3_PSCI_IDLE_PREDICT_64	0xC7000032
+
+/* Time the libc, libfdt and zlib functions in a Normal world buffer */
+#define VEN_EL3_LIB_BENCH_32		0x87000033
+#define VEN_EL3_LIB_BENCH_64		0xC7000033
+
+/* Register the Normal world buffer the AMU counters of all cores go into */
+#define VEN_EL3_AMU_SNAPSHOT_SET_BUF_32	0x87000034
+#define VEN_EL3_AMU_SNAPSHOT_SET_BUF_64	0xC7000034
+
+/* Publish the AMU counters of the calling core and return the architected ones */
+#define VEN_EL3_AMU_SNAPSHOT_UPDATE_32	0x87000035
+#define VEN_EL3_AMU_SNAPSHOT_UPDATE_64	0xC7000035
+
+/* MPMM gear and gear residency of the calling cpu */
+#define VEN_EL3_MPMM_GEAR_GET_32	0x87000036
+#define VEN_EL3_MPMM_GEAR_GET_64	0xC7000036
+
+/* Select the MPMM gear of the calling cpu */
+#define VEN_EL3_MPMM_GEAR_SET_32	0x87000037
+#define VEN_EL3_MPMM_GEAR_SET_64	0xC7000037
+
+/* Perform the PCI configuration accesses listed in a Normal world buffer */
+#define VEN_EL3_PCI_BATCH_32		0x87000038
+#define VEN_EL3_PCI_BATCH_64		0xC7000038
+
+/* Largest buffer accepted by VEN_EL3_PCI_BATCH */
+#define VEN_EL3_PCI_BATCH_BUF_MAX	(64U * 1024U)
 
 #endif /* VEN_EL3_SVC_H */
@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <arch_helpers.h>
+#include <common/debug.h>
+#include <lib/boot_timeline.h>
+#include <lib/transfer_list.h>
+
+#if defined(IMAGE_BL1)
+#define BOOT_TL_STAGE	BOOT_TL_STAGE_BL1
+#elif defined(IMAGE_BL2)
+#define BOOT_TL_STAGE	BOOT_TL_STAGE_BL2
+#else
+#define BOOT_TL_STAGE	BOOT_TL_STAGE_BL31
+#endif
+
+/* Records of this stage, until they are appended to the transfer list */
+static struct boot_timeline_record records[BOOT_TIMELINE_MAX_RECORDS];
+static unsigned int nr_records;
+static unsigned int nr_dropped;
+
+#if BOOT_TIMELINE_REPORT
+/* Steps of an image, in the order of the columns of the report */
+#define PHASE_LOAD		0U
+#define PHASE_AUTH		1U
+#define PHASE_DECOMPRESS	2U
+#define PHASE_MEASURE		3U
+#define NR_PHASES		4U
+
+struct image_stats {
+	uint32_t image_id;
+	uint32_t bytes[NR_PHASES];
+	uint64_t start[NR_PHASES];
+	uint64_t ticks[NR_PHASES];
+};
+
+/*
+ * The steps of each image are accumulated as they are recorded, so that the
+ * report is not limited to the records still held by the stage.
+ */
+static struct image_stats image_stats[BOOT_TIMELINE_REPORT_IMAGES];
+static unsigned int nr_image_stats;
+static bool image_stats_full;
+
+/* Image and step of the last load or decompression, for its size record */
+static struct image_stats *last_stats;
+static unsigned int last_phase;
+
+static struct image_stats *get_image_stats(uint32_t image_id)
+{
+	unsigned int i;
+
+	for (i = 0U; i < nr_image_stats; i++) {
+		if (image_stats[i].image_id == image_id) {
+			return &image_stats[i];
+		}
+	}
+
+	if (nr_image_stats == BOOT_TIMELINE_REPORT_IMAGES) {
+		image_stats_full = true;
+		return NULL;
+	}
+
+	image_stats[nr_image_stats].image_id = image_id;
+
+	return &image_stats[nr_image_stats++];
+}
+
+static void account_image_event(unsigned int event, unsigned int flags,
+				uint32_t arg, uint64_t now)
+{
+	struct image_stats *stats;
+	unsigned int phase;
+
+	switch (event) {
+	case BOOT_TL_EV_IMAGE_LOAD:
+		phase = PHASE_LOAD;
+		break;
+	case BOOT_TL_EV_IMAGE_AUTH:
+		phase = PHASE_AUTH;
+		break;
+	case BOOT_TL_EV_IMAGE_DECOMPRESS:
+		phase = PHASE_DECOMPRESS;
+		break;
+	case BOOT_TL_EV_IMAGE_MEASURE:
+		phase = PHASE_MEASURE;
+		break;
+	case BOOT_TL_EV_IMAGE_SIZE:
+		if (last_stats != NULL) {
+			last_stats->bytes[last_phase] += arg;
+		}
+		return;
+	default:
+		return;
+	}
+
+	/*
+	 * Decompression is told apart by address rather than image ID, and
+	 * happens in the post load hook of the image last read.
+	 */
+	if (phase == PHASE_DECOMPRESS) {
+		stats = ((last_stats != NULL) && (last_phase == PHASE_LOAD)) ?
+			last_stats : NULL;
+	} else {
+		stats = get_image_stats(arg);
+	}
+
+	if (stats == NULL) {
+		return;
+	}
+
+	if ((flags & BOOT_TL_FLAG_START) != 0U) {
+		stats->start[phase] = now;
+	} else if ((flags & BOOT_TL_FLAG_END) != 0U) {
+		stats->ticks[phase] += now - stats->start[phase];
+		if ((phase == PHASE_LOAD) || (phase == PHASE_DECOMPRESS)) {
+			last_stats = stats;
+			last_phase = phase;
+		}
+	}
+}
+
+static unsigned long long ticks_to_us(uint64_t ticks, uint64_t freq)
+{
+	return (unsigned long long)((ticks * 1000000ULL) / freq);
+}
+
+/*
+ * Print the time spent reading, authenticating, decompressing and measuring
+ * each image so far in this stage, with the bytes read and decompressed.
+ */
+void boot_timeline_report(void)
+{
+	uint64_t freq = read_cntfrq_el0();
+	const struct image_stats *stats;
+	unsigned int i;
+
+	if (freq == 0U) {
+		return;
+	}
+
+	NOTICE("Boot timeline: images of the stage (bytes, us)\n");
+	NOTICE("  image   read bytes    read    auth decomp bytes  decomp measure\n");
+
+	for (i = 0U; i < nr_image_stats; i++) {
+		stats = &image_stats[i];
+		NOTICE("  %5u %12u %7llu %7llu %12u %7llu %7llu\n",
+		       stats->image_id, stats->bytes[PHASE_LOAD],
+		       ticks_to_us(stats->ticks[PHASE_LOAD], freq),
+		       ticks_to_us(stats->ticks[PHASE_AUTH], freq),
+		       stats->bytes[PHASE_DECOMPRESS],
+		       ticks_to_us(stats->ticks[PHASE_DECOMPRESS], freq),
+		       ticks_to_us(stats->ticks[PHASE_MEASURE], freq));
+	}
+
+	if (image_stats_full) {
+		NOTICE("  images past the first %u not accounted for\n",
+		       BOOT_TIMELINE_REPORT_IMAGES);
+	}
+}
+#endif /* BOOT_TIMELINE_REPORT */
+
+/*
+ * Only called by the primary cpu during the cold boot, before the hand-off,
+ * so the records need no lock.
+ */
+void boot_timeline_record(unsigned int event, unsigned int flags,
+			  uint32_t arg)
+{
+	struct boot_timeline_record *rec;
+	uint64_t now = read_cntpct_el0();
+
+#if BOOT_TIMELINE_REPORT
+	account_image_event(event, flags, arg, now);
+#endif
+
+	if (nr_records == BOOT_TIMELINE_MAX_RECORDS) {
+		nr_dropped++;
+		return;
+	}
+
+	rec = &records[nr_records++];
+	rec->timestamp = now;
+	rec->event = (uint16_t)event;
+	rec->stage = BOOT_TL_STAGE;
+	rec->flags = (uint8_t)flags;
+	rec->arg = arg;
+}
+
+/*
+ * Record the hand-off and write the timeline of the previous stages found in
+ * 'src', followed by the records of this stage, in 'dst'. 'src' may be NULL
+ * when there is no previous stage, or 'dst' itself. The entry is added again
+ * at the end of 'dst' rather than resized, as resizing would move the entries
+ * after it, whose data may already be in use.
+ */
+int boot_timeline_handoff(struct transfer_list_header *dst,
+			  struct transfer_list_header *src)
+{
+	struct transfer_list_entry *old_te = NULL, *te;
+	struct boot_timeline_hdr *old_hdr = NULL, *hdr;
+	uint32_t old_count = 0U;
+	size_t size;
+
+	BOOT_TIMELINE_MARK(BOOT_TL_EV_HANDOFF, 0U);
+
+	if (src != NULL) {
+		old_te = transfer_list_find(src, TL_TAG_BOOT_TIMELINE);
+	}
+	if (old_te != NULL) {
+		old_hdr = transfer_list_entry_data(old_te);
+		if ((old_te->data_size < sizeof(*old_hdr)) ||
+		    (old_hdr->version != BOOT_TIMELINE_VERSION) ||
+		    (old_hdr->count > ((old_te->data_size - sizeof(*old_hdr)) /
+				       sizeof(records[0])))) {
+			WARN("Boot timeline of the previous stages ignored\n");
+			old_hdr = NULL;
+		} else {
+			old_count = old_hdr->count;
+		}
+	}
+
+	size = sizeof(*hdr) + ((old_count + nr_records) * sizeof(records[0]));
+	te = transfer_list_add(dst, TL_TAG_BOOT_TIMELINE, (uint32_t)size, NULL);
+	if (te == NULL) {
+		WARN("No room for the boot timeline in the transfer list\n");
+		return -ENOMEM;
+	}
+
+	hdr = transfer_list_entry_data(te);
+	hdr->version = BOOT_TIMELINE_VERSION;
+	hdr->count = old_count + nr_records;
+	hdr->dropped = nr_dropped;
+	hdr->reserved = 0U;
+	hdr->counter_freq = read_cntfrq_el0();
+
+	if (old_hdr != NULL) {
+		(void)memcpy(hdr + 1, old_hdr + 1,
+			     old_count * sizeof(records[0]));
+		hdr->dropped += old_hdr->dropped;
+	}
+	(void)memcpy((struct boot_timeline_record *)(hdr + 1) + old_count,
+		     records, nr_records * sizeof(records[0]));
+
+	if ((old_te != NULL) && (src == dst)) {
+		(void)transfer_list_rem(dst, old_te);
+	}
+
+	transfer_list_update_entry_checksum(dst, te, 0U);
+
+	nr_records = 0U;
+	nr_dropped = 0U;
+
+	return 0;
+}
@@ -0,0 +1,15 @@
+#
+# Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+
+ifeq (${BOOT_TIMELINE},1)
+
+BOOT_TIMELINE_SOURCES	:=	lib/boot_timeline/boot_timeline.c
+
+BL1_SOURCES		+=	$(BOOT_TIMELINE_SOURCES)
+BL2_SOURCES		+=	$(BOOT_TIMELINE_SOURCES)
+BL31_SOURCES		+=	$(BOOT_TIMELINE_SOURCES)
+
+endif	# BOOT_TIMELINE
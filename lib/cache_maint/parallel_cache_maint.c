@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <arch_helpers.h>
+#include <bl31/ehf.h>
+#include <common/debug.h>
+#include <lib/cache_maint/parallel_cache_maint.h>
+#include <lib/cassert.h>
+#include <lib/psci/psci_lib.h>
+#include <lib/spinlock.h>
+#include <lib/utils_def.h>
+#include <plat/common/platform.h>
+
+#include <platform_def.h>
+
+#if !EL3_EXCEPTION_HANDLING
+#error "PARALLEL_CACHE_MAINT requires EL3_EXCEPTION_HANDLING"
+#endif
+
+#if !defined(PLAT_PARALLEL_CACHE_MAINT_SGI) || \
+	!defined(PLAT_PARALLEL_CACHE_MAINT_PRI)
+#error "PARALLEL_CACHE_MAINT requires the platform to define the SGI to use"
+#endif
+
+/* Size of the pieces of a range that the cpus claim in turn */
+#ifndef PLAT_PARALLEL_CACHE_MAINT_CHUNK
+#define PLAT_PARALLEL_CACHE_MAINT_CHUNK	(U(2) << 20)
+#endif
+
+/* Ranges smaller than this are not worth interrupting the other cpus for */
+#ifndef PLAT_PARALLEL_CACHE_MAINT_MIN
+#define PLAT_PARALLEL_CACHE_MAINT_MIN	(U(16) << 20)
+#endif
+
+CASSERT(PLAT_PARALLEL_CACHE_MAINT_CHUNK != 0U,
+	assert_parallel_cache_maint_chunk_not_zero);
+
+/*
+ * The request in progress. The cpus claim its chunks in turn with
+ * pcm_req_lock held, so a cpu answering an SGI late finds either no chunk
+ * left or the chunks of the next request, never stale ones. 'remaining' is the
+ * number of bytes whose maintenance has not completed yet.
+ */
+static struct {
+	cache_maint_op_t op;
+	uintptr_t next;
+	uintptr_t end;
+	size_t remaining;
+} pcm_req;
+
+static spinlock_t pcm_req_lock;
+
+/* Serialises the requests */
+static spinlock_t pcm_lock;
+
+/* Claim the next chunk of the request in progress, if there is one left */
+static bool pcm_claim_chunk(cache_maint_op_t *op, uintptr_t *addr,
+			    size_t *size)
+{
+	bool claimed = false;
+
+	spin_lock(&pcm_req_lock);
+
+	if (pcm_req.next < pcm_req.end) {
+		*op = pcm_req.op;
+		*addr = pcm_req.next;
+		*size = MIN(pcm_req.end - pcm_req.next,
+			    (size_t)PLAT_PARALLEL_CACHE_MAINT_CHUNK);
+		pcm_req.next += *size;
+		claimed = true;
+	}
+
+	spin_unlock(&pcm_req_lock);
+
+	return claimed;
+}
+
+static void pcm_do_chunks(void)
+{
+	cache_maint_op_t op;
+	uintptr_t addr;
+	size_t size;
+
+	while (pcm_claim_chunk(&op, &addr, &size)) {
+		/* The maintenance routines complete with a DSB */
+		op(addr, size);
+
+		spin_lock(&pcm_req_lock);
+		pcm_req.remaining -= size;
+		spin_unlock(&pcm_req_lock);
+	}
+}
+
+static bool pcm_req_done(void)
+{
+	bool done;
+
+	spin_lock(&pcm_req_lock);
+	done = (pcm_req.remaining == 0U);
+	spin_unlock(&pcm_req_lock);
+
+	return done;
+}
+
+/* The MPIDRs of the other cpus that are ON, collected with pcm_lock held */
+static u_register_t pcm_targets[PLATFORM_CORE_COUNT];
+static unsigned int pcm_targets_count;
+
+static void pcm_add_target(u_register_t mpidr)
+{
+	assert(pcm_targets_count < PLATFORM_CORE_COUNT);
+	pcm_targets[pcm_targets_count++] = mpidr;
+}
+
+static int pcm_sgi_handler(uint32_t intr_raw, uint32_t flags, void *handle,
+			   void *cookie)
+{
+	/* Deactivate the SGI first so that the next request can be signalled */
+	plat_ic_end_of_interrupt(intr_raw);
+
+	pcm_do_chunks();
+
+	return 0;
+}
+
+/*
+ * Perform the maintenance 'op' on the range 'addr' to 'addr' + 'size' with the
+ * help of the other cpus that are ON. They are interrupted with an SGI and
+ * claim chunks of the range alongside the calling cpu, which does whatever is
+ * left if they can not take the SGI in time, e.g. because they are running in
+ * EL3 or in the Secure world. This returns once the maintenance of the whole
+ * range has completed.
+ */
+void parallel_cache_maint(cache_maint_op_t op, uintptr_t addr, size_t size)
+{
+	assert(op != NULL);
+	assert(!check_uptr_overflow(addr, size));
+
+	if (size < PLAT_PARALLEL_CACHE_MAINT_MIN) {
+		op(addr, size);
+		return;
+	}
+
+	spin_lock(&pcm_lock);
+
+	spin_lock(&pcm_req_lock);
+	pcm_req.op = op;
+	pcm_req.next = addr;
+	pcm_req.end = addr + size;
+	pcm_req.remaining = size;
+	spin_unlock(&pcm_req_lock);
+
+	/* Signal the cpus of each cluster with a single write */
+	pcm_targets_count = 0U;
+	(void)psci_for_each_other_on_cpu(pcm_add_target);
+	plat_ic_raise_el3_sgi_targets(PLAT_PARALLEL_CACHE_MAINT_SGI,
+				      pcm_targets, pcm_targets_count);
+
+	pcm_do_chunks();
+
+	/* Wait for the chunks claimed by the other cpus */
+	while (!pcm_req_done()) {
+		;
+	}
+
+	spin_unlock(&pcm_lock);
+}
+
+void __init parallel_cache_maint_init(void)
+{
+	ehf_register_priority_handler(PLAT_PARALLEL_CACHE_MAINT_PRI,
+				      pcm_sgi_handler);
+}
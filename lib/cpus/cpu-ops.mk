@@ -33,6 +33,10 @@ CPU_FLAG_LIST += DYNAMIC_WORKAROUND_CVE_2018_3639
 WORKAROUND_CVE_2022_23960		?=1
 CPU_FLAG_LIST += WORKAROUND_CVE_2022_23960
 
+# Remember in BL31 which reset errata apply to each core, so that warm boots
+# only call the workarounds that are needed.
+CPU_FLAG_LIST += ERRATA_RESET_CACHE
+
 # Flags to indicate internal or external Last level cache
 # By default internal
 CPU_FLAG_LIST += NEOVERSE_Nx_EXTERNAL_LLC
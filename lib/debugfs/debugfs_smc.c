@@ -27,10 +27,21 @@
 #define STAT		8
 #define INIT		10
 #define VERSION		11
+#define INIT_BULK	12
+#define READ_BULK	13
 
 /* This is the virtual address to which we map the NS shared buffer */
 #define DEBUGFS_SHARED_BUF_VIRT		((void *)0x81000000U)
 
+/*
+ * This is the virtual address to which we map the optional NS bulk buffer,
+ * and the largest size the caller can register for it.
+ */
+#ifndef DEBUGFS_BULK_BUF_MAX_SIZE
+#define DEBUGFS_BULK_BUF_MAX_SIZE	U(0x400000)
+#endif
+#define DEBUGFS_BULK_BUF_VIRT		((void *)0x81400000U)
+
 static union debugfs_parms {
 	struct {
 		char fname[MAX_PATH_LEN];
@@ -59,6 +70,73 @@ static spinlock_t debugfs_access_lock;
 
 static bool debugfs_initialized;
 
+/* Size of the registered bulk buffer, zero if none */
+static size_t debugfs_bulk_size;
+
+/*******************************************************************************
+ * Map the NS buffer at physical address pa as the bulk buffer, in place of any
+ * previously registered one.
+ ******************************************************************************/
+static int debugfs_bulk_init(u_register_t pa, u_register_t size)
+{
+	int ret;
+
+	if ((size == 0U) || (size > DEBUGFS_BULK_BUF_MAX_SIZE) ||
+	    ((size & (PAGE_SIZE_4KB - 1U)) != 0U) ||
+	    ((pa & (PAGE_SIZE_4KB - 1U)) != 0U)) {
+		return -1;
+	}
+
+	if (debugfs_bulk_size != 0U) {
+		ret = mmap_remove_dynamic_region(
+			(uintptr_t)DEBUGFS_BULK_BUF_VIRT, debugfs_bulk_size);
+		if (ret != 0) {
+			return ret;
+		}
+		debugfs_bulk_size = 0U;
+	}
+
+	/* TODO: check PA validity e.g. whether it is an NS region. */
+	ret = mmap_add_dynamic_region(pa, (uintptr_t)DEBUGFS_BULK_BUF_VIRT,
+				      size, MT_MEMORY | MT_RW | MT_NS);
+	if (ret == 0) {
+		debugfs_bulk_size = size;
+	}
+
+	return ret;
+}
+
+/*******************************************************************************
+ * Read up to len bytes from fd into the bulk buffer, from offset onwards.
+ * Return the number of bytes read, which is less than len only at the end of
+ * the file, or -1 if nothing could be read.
+ ******************************************************************************/
+static int debugfs_bulk_read(int fd, u_register_t offset, u_register_t len)
+{
+	char *buf = (char *)DEBUGFS_BULK_BUF_VIRT + offset;
+	size_t done = 0U;
+	int ret = 0;
+
+	if ((offset > debugfs_bulk_size) ||
+	    (len > (debugfs_bulk_size - offset))) {
+		return -1;
+	}
+
+	while (done < len) {
+		ret = read(fd, buf + done, (int)(len - done));
+		if (ret <= 0) {
+			break;
+		}
+		done += (size_t)ret;
+	}
+
+	if ((done == 0U) && (ret < 0)) {
+		return -1;
+	}
+
+	return (int)done;
+}
+
 uintptr_t debugfs_smc_handler(unsigned int smc_fid,
 			      u_register_t cmd,
 			      u_register_t arg2,
@@ -114,6 +192,14 @@ uintptr_t debugfs_smc_handler(unsigned int smc_fid,
 		}
 		break;
 
+	case INIT_BULK:
+		ret = debugfs_bulk_init(arg2, arg3);
+		if (ret == 0) {
+			smc_ret = SMC_OK;
+			smc_resp = 0;
+		}
+		break;
+
 	case VERSION:
 		smc_ret = SMC_OK;
 		smc_resp = DEBUGFS_VERSION;
@@ -153,6 +239,14 @@ uintptr_t debugfs_smc_handler(unsigned int smc_fid,
 		}
 		break;
 
+	case READ_BULK:
+		ret = debugfs_bulk_read(arg2, arg3, arg4);
+		if (ret >= 0) {
+			smc_ret = SMC_OK;
+			smc_resp = ret;
+		}
+		break;
+
 	case SEEK:
 		ret = seek(arg2, arg3, arg4);
 		if (ret == 0) {
@@ -203,6 +297,7 @@ uintptr_t debugfs_smc_handler(unsigned int smc_fid,
 int debugfs_smc_setup(void)
 {
 	debugfs_initialized = false;
+	debugfs_bulk_size = 0U;
 	debugfs_access_lock.lock = 0;
 
 	return 0;
@@ -10,6 +10,7 @@
 #include <context.h>
 #include <lib/el3_runtime/context_mgmt.h>
 #include <lib/el3_runtime/cpu_data.h>
+#include <lib/el3_runtime/simd_ctx.h>
 
 /********************************************************************************
  * Function that returns the corresponding string constant for a security state
@@ -177,6 +178,18 @@ static size_t report_allocated_memory(unsigned int security_state_idx)
 
 	printf("Per-world context: %luB\n\n", per_world_ctx_size);
 
+#if CTX_INCLUDE_FPREGS || CTX_INCLUDE_SVE_REGS
+	/* The SIMD context of the world, for all the cores */
+	if ((security_state_idx == SECURE) ||
+	    (security_state_idx == NON_SECURE)) {
+		size_t simd_size = simd_ctx_size(security_state_idx);
+
+		total += simd_size;
+
+		printf("SIMD context: %luB\n\n", simd_size);
+	}
+#endif /* CTX_INCLUDE_FPREGS || CTX_INCLUDE_SVE_REGS */
+
 	printf("TOTAL: %luB\n", total);
 
 	return total;
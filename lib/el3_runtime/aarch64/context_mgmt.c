@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2013-2026, Arm Limited and Contributors. All rights reserved.
  * Copyright (c) 2022, NVIDIA Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
@@ -14,6 +14,7 @@
 #include <arch.h>
 #include <arch_helpers.h>
 #include <arch_features.h>
+#include <bl31/deferred_work.h>
 #include <bl31/interrupt_mgmt.h>
 #include <common/bl_common.h>
 #include <common/debug.h>
@@ -53,6 +54,74 @@ static void manage_extensions_nonsecure(cpu_context_t *ctx);
 static void manage_extensions_secure(cpu_context_t *ctx);
 static void manage_extensions_secure_per_world(void);
 
+#if IMAGE_BL31
+/*
+ * Optional features whose registers are switched by the EL1 and EL2 context
+ * save and restore, with the build option enabling each. When a feature is
+ * detected at runtime (FEAT_STATE_CHECK), its presence is read from the ID
+ * registers once in cm_init() rather than on every world switch, and each
+ * check becomes a test of a bit of ctx_feats. Features enabled or disabled at
+ * build time still resolve at compile time, and those that may differ between
+ * cores (FEAT_STATE_CHECK_ASYMMETRIC) are still read on the current core.
+ */
+#define CTX_FEATURES(X)							\
+	X(feat_amu, ENABLE_FEAT_AMU)					\
+	X(feat_csv2_2, ENABLE_FEAT_CSV2_2)				\
+	X(feat_ecv_v2, ENABLE_FEAT_ECV)					\
+	X(feat_fgt, ENABLE_FEAT_FGT)					\
+	X(feat_fgt2, ENABLE_FEAT_FGT2)					\
+	X(feat_gcs, ENABLE_FEAT_GCS)					\
+	X(feat_hcx, ENABLE_FEAT_HCX)					\
+	X(feat_ls64_accdata, ENABLE_FEAT_LS64_ACCDATA)			\
+	X(feat_mpam, ENABLE_FEAT_MPAM)					\
+	X(feat_mte2, ENABLE_FEAT_MTE2)					\
+	X(feat_nv2, CTX_INCLUDE_NEVE_REGS)				\
+	X(feat_ras, ENABLE_FEAT_RAS)					\
+	X(feat_s1pie, ENABLE_FEAT_S1PIE)				\
+	X(feat_s1poe, ENABLE_FEAT_S1POE)				\
+	X(feat_s2pie, ENABLE_FEAT_S2PIE)				\
+	X(feat_s2poe, ENABLE_FEAT_S2POE)				\
+	X(feat_sctlr2, ENABLE_FEAT_SCTLR2)				\
+	X(feat_tcr2, ENABLE_FEAT_TCR2)					\
+	X(feat_the, ENABLE_FEAT_THE)					\
+	X(feat_trf, ENABLE_TRF_FOR_NS)					\
+	X(feat_vhe, ENABLE_FEAT_VHE)
+
+#define CTX_FEAT_INDEX(name, guard)	CTX_FEAT_IDX_ ## name,
+#define CTX_FEAT_GUARD(name, guard)	CTX_FEAT_GUARD_ ## name = (guard),
+#define CTX_FEAT_DETECT(name, guard)					\
+	if (is_ ## name ## _supported()) {				\
+		ctx_feats |= U(1) << CTX_FEAT_IDX_ ## name;		\
+	}
+
+enum {
+	CTX_FEATURES(CTX_FEAT_INDEX)
+	CTX_FEAT_COUNT
+};
+
+enum {
+	CTX_FEATURES(CTX_FEAT_GUARD)
+};
+
+CASSERT(CTX_FEAT_COUNT <= 32, assert_ctx_features_fit_in_mask);
+
+static uint32_t ctx_feats;
+
+#define CTX_FEAT_SUPPORTED(name)					\
+	((CTX_FEAT_GUARD_ ## name == FEAT_STATE_DISABLED) ? false :	\
+	 (CTX_FEAT_GUARD_ ## name == FEAT_STATE_ALWAYS) ? true :	\
+	 (CTX_FEAT_GUARD_ ## name == FEAT_STATE_CHECK_ASYMMETRIC) ?	\
+		is_ ## name ## _supported() :				\
+	 ((ctx_feats & (U(1) << CTX_FEAT_IDX_ ## name)) != 0U))
+#else
+#define CTX_FEAT_SUPPORTED(name)	is_ ## name ## _supported()
+#endif /* IMAGE_BL31 */
+
+#define CTX_FEAT_SXPIE_SUPPORTED()					\
+	(CTX_FEAT_SUPPORTED(feat_s1pie) || CTX_FEAT_SUPPORTED(feat_s2pie))
+#define CTX_FEAT_SXPOE_SUPPORTED()					\
+	(CTX_FEAT_SUPPORTED(feat_s1poe) || CTX_FEAT_SUPPORTED(feat_s2poe))
+
 #if ((IMAGE_BL1) || (IMAGE_BL31 && (!CTX_INCLUDE_EL2_REGS)))
 static void setup_el1_context(cpu_context_t *ctx, const struct entry_point_info *ep)
 {
@@ -352,9 +421,24 @@ static void setup_context_common(cpu_context_t *ctx, const entry_point_info_t *e
 
 	state = get_el3state_ctx(ctx);
 
+#if SIMD_LAZY_SWITCH
+	/*
+	 * Zeroing the context drops the FP/SIMD trap of the world, so write the
+	 * live registers back before it can access them directly.
+	 */
+	if (ctx == cm_get_context(GET_SECURITY_STATE(ep->h.attr))) {
+		simd_ctx_lazy_flush();
+	}
+#endif
+
 	/* Clear any residual register values from the context */
 	zeromem(ctx, sizeof(*ctx));
 
+#if PAUTH_LAZY_RESTORE && IMAGE_BL31
+	/* The saved PAuth keys no longer match the registers */
+	set_cpu_data(pauth_live_ctx, NULL);
+#endif
+
 	/*
 	 * The lower-EL context is zeroed so that no stale values leak to a world.
 	 * It is assumed that an all-zero lower-EL context is good enough for it
@@ -589,9 +673,16 @@ static void setup_context_common(cpu_context_t *ctx, const entry_point_info_t *e
 void __init cm_init(void)
 {
 	/*
-	 * The context management library has only global data to initialize, but
-	 * that will be done when the BSS is zeroed out.
+	 * The context management library has only global data to initialize,
+	 * most of which is done when the BSS is zeroed out. Cores are assumed
+	 * to implement the same features, apart from the ones checked as
+	 * asymmetric, so the primary records the features that the context
+	 * save and restore check.
 	 */
+#if IMAGE_BL31
+	ctx_feats = 0U;
+	CTX_FEATURES(CTX_FEAT_DETECT)
+#endif /* IMAGE_BL31 */
 }
 
 /*******************************************************************************
@@ -700,7 +791,8 @@ void manage_extensions_nonsecure_per_world(void)
 	}
 
 	if (is_feat_sve_supported()) {
-		sve_enable_per_world(&per_world_context[CPU_CONTEXT_NS]);
+		sve_enable_per_world(&per_world_context[CPU_CONTEXT_NS],
+				     SVE_VECTOR_LEN);
 	}
 
 	if (is_feat_amu_supported()) {
@@ -749,7 +841,8 @@ static void manage_extensions_secure_per_world(void)
 		 * Enable SVE and FPU in secure context, SPM must ensure
 		 * that the SVE and FPU register contexts are properly managed.
 		 */
-			sve_enable_per_world(&per_world_context[CPU_CONTEXT_SECURE]);
+			sve_enable_per_world(&per_world_context[CPU_CONTEXT_SECURE],
+					     SVE_VECTOR_LEN_FOR_SWD);
 		} else {
 		/*
 		 * Disable SVE and FPU in secure context so non-secure world
@@ -1062,7 +1155,7 @@ static void init_nonsecure_el2_unused(cpu_context_t *ctx)
  * EL2 then EL2 is disabled by configuring all necessary EL2 registers.
  * For all entries, the EL1 registers are initialized from the cpu_context
  ******************************************************************************/
-void cm_prepare_el3_exit(uint32_t security_state)
+void __hot_runtime cm_prepare_el3_exit(uint32_t security_state)
 {
 	u_register_t sctlr_el2, scr_el3;
 	cpu_context_t *ctx = cm_get_context(security_state);
@@ -1079,10 +1172,17 @@ void cm_prepare_el3_exit(uint32_t security_state)
 
 			/*
 			 * If context is not being used for EL2, initialize
-			 * HCRX_EL2 with its init value here.
+			 * HCRX_EL2 with its init value here, letting EL1 and
+			 * EL0 use the FEAT_MOPS instructions.
 			 */
 			if (is_feat_hcx_supported()) {
-				write_hcrx_el2(HCRX_EL2_INIT_VAL);
+				u_register_t hcrx_el2 = HCRX_EL2_INIT_VAL;
+
+				if (is_feat_mops_supported()) {
+					hcrx_el2 |= HCRX_EL2_MSCEn_BIT;
+				}
+
+				write_hcrx_el2(hcrx_el2);
 			}
 
 			/*
@@ -1139,7 +1239,7 @@ void cm_prepare_el3_exit(uint32_t security_state)
 static void el2_sysregs_context_save_fgt(el2_sysregs_t *ctx)
 {
 	write_el2_ctx_fgt(ctx, hdfgrtr_el2, read_hdfgrtr_el2());
-	if (is_feat_amu_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_amu)) {
 		write_el2_ctx_fgt(ctx, hafgrtr_el2, read_hafgrtr_el2());
 	}
 	write_el2_ctx_fgt(ctx, hdfgwtr_el2, read_hdfgwtr_el2());
@@ -1151,7 +1251,7 @@ static void el2_sysregs_context_save_fgt(el2_sysregs_t *ctx)
 static void el2_sysregs_context_restore_fgt(el2_sysregs_t *ctx)
 {
 	write_hdfgrtr_el2(read_el2_ctx_fgt(ctx, hdfgrtr_el2));
-	if (is_feat_amu_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_amu)) {
 		write_hafgrtr_el2(read_el2_ctx_fgt(ctx, hafgrtr_el2));
 	}
 	write_hdfgwtr_el2(read_el2_ctx_fgt(ctx, hdfgwtr_el2));
@@ -1315,17 +1415,22 @@ static void el2_sysregs_context_restore_gic(el2_sysregs_t *ctx)
 	write_ich_vmcr_el2(read_el2_ctx_common(ctx, ich_vmcr_el2));
 }
 
+/*
+ * Worlds whose software does not rely on the EL2 exception syndrome registers
+ * being preserved while other worlds run, see
+ * cm_el2_sysregs_set_syndrome_scratch().
+ */
+static bool el2_syndrome_scratch[CPU_DATA_CONTEXT_NUM];
+
 /* -----------------------------------------------------
  * The following registers are not added:
  * AMEVCNTVOFF0<n>_EL2
  * AMEVCNTVOFF1<n>_EL2
  * -----------------------------------------------------
  */
-static void el2_sysregs_context_save_common(el2_sysregs_t *ctx)
+static void el2_sysregs_context_save_common(el2_sysregs_t *ctx, bool syndrome)
 {
 	write_el2_ctx_common(ctx, actlr_el2, read_actlr_el2());
-	write_el2_ctx_common(ctx, afsr0_el2, read_afsr0_el2());
-	write_el2_ctx_common(ctx, afsr1_el2, read_afsr1_el2());
 	write_el2_ctx_common(ctx, amair_el2, read_amair_el2());
 	write_el2_ctx_common(ctx, cnthctl_el2, read_cnthctl_el2());
 	write_el2_ctx_common(ctx, cntvoff_el2, read_cntvoff_el2());
@@ -1333,17 +1438,12 @@ static void el2_sysregs_context_save_common(el2_sysregs_t *ctx)
 	if (CTX_INCLUDE_AARCH32_REGS) {
 		write_el2_ctx_common(ctx, dbgvcr32_el2, read_dbgvcr32_el2());
 	}
-	write_el2_ctx_common(ctx, elr_el2, read_elr_el2());
-	write_el2_ctx_common(ctx, esr_el2, read_esr_el2());
-	write_el2_ctx_common(ctx, far_el2, read_far_el2());
 	write_el2_ctx_common(ctx, hacr_el2, read_hacr_el2());
 	write_el2_ctx_common(ctx, hcr_el2, read_hcr_el2());
-	write_el2_ctx_common(ctx, hpfar_el2, read_hpfar_el2());
 	write_el2_ctx_common(ctx, hstr_el2, read_hstr_el2());
 	write_el2_ctx_common(ctx, mair_el2, read_mair_el2());
 	write_el2_ctx_common(ctx, mdcr_el2, read_mdcr_el2());
 	write_el2_ctx_common(ctx, sctlr_el2, read_sctlr_el2());
-	write_el2_ctx_common(ctx, spsr_el2, read_spsr_el2());
 	write_el2_ctx_common(ctx, sp_el2, read_sp_el2());
 	write_el2_ctx_common(ctx, tcr_el2, read_tcr_el2());
 	write_el2_ctx_common(ctx, tpidr_el2, read_tpidr_el2());
@@ -1354,13 +1454,22 @@ static void el2_sysregs_context_save_common(el2_sysregs_t *ctx)
 
 	write_el2_ctx_sysreg128(ctx, ttbr0_el2, read_ttbr0_el2());
 	write_el2_ctx_sysreg128(ctx, vttbr_el2, read_vttbr_el2());
+
+	if (syndrome) {
+		write_el2_ctx_common(ctx, afsr0_el2, read_afsr0_el2());
+		write_el2_ctx_common(ctx, afsr1_el2, read_afsr1_el2());
+		write_el2_ctx_common(ctx, elr_el2, read_elr_el2());
+		write_el2_ctx_common(ctx, esr_el2, read_esr_el2());
+		write_el2_ctx_common(ctx, far_el2, read_far_el2());
+		write_el2_ctx_common(ctx, hpfar_el2, read_hpfar_el2());
+		write_el2_ctx_common(ctx, spsr_el2, read_spsr_el2());
+	}
 }
 
-static void el2_sysregs_context_restore_common(el2_sysregs_t *ctx)
+static void el2_sysregs_context_restore_common(el2_sysregs_t *ctx,
+					       bool syndrome)
 {
 	write_actlr_el2(read_el2_ctx_common(ctx, actlr_el2));
-	write_afsr0_el2(read_el2_ctx_common(ctx, afsr0_el2));
-	write_afsr1_el2(read_el2_ctx_common(ctx, afsr1_el2));
 	write_amair_el2(read_el2_ctx_common(ctx, amair_el2));
 	write_cnthctl_el2(read_el2_ctx_common(ctx, cnthctl_el2));
 	write_cntvoff_el2(read_el2_ctx_common(ctx, cntvoff_el2));
@@ -1368,17 +1477,12 @@ static void el2_sysregs_context_restore_common(el2_sysregs_t *ctx)
 	if (CTX_INCLUDE_AARCH32_REGS) {
 		write_dbgvcr32_el2(read_el2_ctx_common(ctx, dbgvcr32_el2));
 	}
-	write_elr_el2(read_el2_ctx_common(ctx, elr_el2));
-	write_esr_el2(read_el2_ctx_common(ctx, esr_el2));
-	write_far_el2(read_el2_ctx_common(ctx, far_el2));
 	write_hacr_el2(read_el2_ctx_common(ctx, hacr_el2));
 	write_hcr_el2(read_el2_ctx_common(ctx, hcr_el2));
-	write_hpfar_el2(read_el2_ctx_common(ctx, hpfar_el2));
 	write_hstr_el2(read_el2_ctx_common(ctx, hstr_el2));
 	write_mair_el2(read_el2_ctx_common(ctx, mair_el2));
 	write_mdcr_el2(read_el2_ctx_common(ctx, mdcr_el2));
 	write_sctlr_el2(read_el2_ctx_common(ctx, sctlr_el2));
-	write_spsr_el2(read_el2_ctx_common(ctx, spsr_el2));
 	write_sp_el2(read_el2_ctx_common(ctx, sp_el2));
 	write_tcr_el2(read_el2_ctx_common(ctx, tcr_el2));
 	write_tpidr_el2(read_el2_ctx_common(ctx, tpidr_el2));
@@ -1388,95 +1492,132 @@ static void el2_sysregs_context_restore_common(el2_sysregs_t *ctx)
 	write_vpidr_el2(read_el2_ctx_common(ctx, vpidr_el2));
 	write_vtcr_el2(read_el2_ctx_common(ctx, vtcr_el2));
 	write_vttbr_el2(read_el2_ctx_common(ctx, vttbr_el2));
+
+	if (syndrome) {
+		write_afsr0_el2(read_el2_ctx_common(ctx, afsr0_el2));
+		write_afsr1_el2(read_el2_ctx_common(ctx, afsr1_el2));
+		write_elr_el2(read_el2_ctx_common(ctx, elr_el2));
+		write_esr_el2(read_el2_ctx_common(ctx, esr_el2));
+		write_far_el2(read_el2_ctx_common(ctx, far_el2));
+		write_hpfar_el2(read_el2_ctx_common(ctx, hpfar_el2));
+		write_spsr_el2(read_el2_ctx_common(ctx, spsr_el2));
+	}
+}
+
+/*******************************************************************************
+ * Record whether AFSR0/1_EL2, ELR_EL2, ESR_EL2, FAR_EL2, HPFAR_EL2 and SPSR_EL2
+ * are scratch registers for the software running at EL2 in 'security_state',
+ * that is it does not rely on them keeping their values while other worlds
+ * run. When 'scratch' is true these registers are
+ * neither saved nor restored for that world, and it sees whatever values they
+ * were left with. The registers of the other worlds are always switched, so
+ * this never exposes the values of that world to them.
+ ******************************************************************************/
+void cm_el2_sysregs_set_syndrome_scratch(uint32_t security_state, bool scratch)
+{
+	assert(sec_state_is_valid(security_state));
+
+	el2_syndrome_scratch[get_cpu_context_index(security_state)] = scratch;
 }
 
 /*******************************************************************************
  * Save EL2 sysreg context
+ *
+ * A world is always entered through cm_el2_sysregs_context_restore(), so the
+ * registers it cannot write still hold the values of its context when it is
+ * left. The groups whose EL2 accesses are trapped to EL3 for that world, by
+ * SCR_EL3 or MPAM3_EL3, are therefore not read back.
  ******************************************************************************/
 void cm_el2_sysregs_context_save(uint32_t security_state)
 {
 	cpu_context_t *ctx;
 	el2_sysregs_t *el2_sysregs_ctx;
+	u_register_t scr_el3;
+	bool mpam_trapped;
 
 	ctx = cm_get_context(security_state);
 	assert(ctx != NULL);
 
 	el2_sysregs_ctx = get_el2_sysregs_ctx(ctx);
+	scr_el3 = read_ctx_reg(get_el3state_ctx(ctx), CTX_SCR_EL3);
+	mpam_trapped = (per_world_context[get_cpu_context_index(security_state)]
+			.ctx_mpam3_el3 & MPAM3_EL3_TRAPLOWER_BIT) != 0U;
 
-	el2_sysregs_context_save_common(el2_sysregs_ctx);
+	el2_sysregs_context_save_common(el2_sysregs_ctx,
+		!el2_syndrome_scratch[get_cpu_context_index(security_state)]);
 	el2_sysregs_context_save_gic(el2_sysregs_ctx);
 
-	if (is_feat_mte2_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_mte2)) {
 		write_el2_ctx_mte2(el2_sysregs_ctx, tfsr_el2, read_tfsr_el2());
 	}
 
-	if (is_feat_mpam_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_mpam) && !mpam_trapped) {
 		el2_sysregs_context_save_mpam(el2_sysregs_ctx);
 	}
 
-	if (is_feat_fgt_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_fgt) && ((scr_el3 & SCR_FGTEN_BIT) != 0U)) {
 		el2_sysregs_context_save_fgt(el2_sysregs_ctx);
 	}
 
-	if (is_feat_fgt2_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_fgt2) && ((scr_el3 & SCR_FGTEN2_BIT) != 0U)) {
 		el2_sysregs_context_save_fgt2(el2_sysregs_ctx);
 	}
 
-	if (is_feat_ecv_v2_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_ecv_v2) && ((scr_el3 & SCR_ECVEN_BIT) != 0U)) {
 		write_el2_ctx_ecv(el2_sysregs_ctx, cntpoff_el2, read_cntpoff_el2());
 	}
 
-	if (is_feat_vhe_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_vhe)) {
 		write_el2_ctx_vhe(el2_sysregs_ctx, contextidr_el2,
 					read_contextidr_el2());
 		write_el2_ctx_vhe_sysreg128(el2_sysregs_ctx, ttbr1_el2, read_ttbr1_el2());
 	}
 
-	if (is_feat_ras_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_ras)) {
 		write_el2_ctx_ras(el2_sysregs_ctx, vdisr_el2, read_vdisr_el2());
 		write_el2_ctx_ras(el2_sysregs_ctx, vsesr_el2, read_vsesr_el2());
 	}
 
-	if (is_feat_nv2_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_nv2)) {
 		write_el2_ctx_neve(el2_sysregs_ctx, vncr_el2, read_vncr_el2());
 	}
 
-	if (is_feat_trf_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_trf)) {
 		write_el2_ctx_trf(el2_sysregs_ctx, trfcr_el2, read_trfcr_el2());
 	}
 
-	if (is_feat_csv2_2_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_csv2_2) && ((scr_el3 & SCR_EnSCXT_BIT) != 0U)) {
 		write_el2_ctx_csv2_2(el2_sysregs_ctx, scxtnum_el2,
 					read_scxtnum_el2());
 	}
 
-	if (is_feat_hcx_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_hcx) && ((scr_el3 & SCR_HXEn_BIT) != 0U)) {
 		write_el2_ctx_hcx(el2_sysregs_ctx, hcrx_el2, read_hcrx_el2());
 	}
 
-	if (is_feat_tcr2_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_tcr2) && ((scr_el3 & SCR_TCR2EN_BIT) != 0U)) {
 		write_el2_ctx_tcr2(el2_sysregs_ctx, tcr2_el2, read_tcr2_el2());
 	}
 
-	if (is_feat_sxpie_supported()) {
+	if (CTX_FEAT_SXPIE_SUPPORTED()) {
 		write_el2_ctx_sxpie(el2_sysregs_ctx, pire0_el2, read_pire0_el2());
 		write_el2_ctx_sxpie(el2_sysregs_ctx, pir_el2, read_pir_el2());
 	}
 
-	if (is_feat_sxpoe_supported()) {
+	if (CTX_FEAT_SXPOE_SUPPORTED()) {
 		write_el2_ctx_sxpoe(el2_sysregs_ctx, por_el2, read_por_el2());
 	}
 
-	if (is_feat_s2pie_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_s2pie)) {
 		write_el2_ctx_s2pie(el2_sysregs_ctx, s2pir_el2, read_s2pir_el2());
 	}
 
-	if (is_feat_gcs_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_gcs) && ((scr_el3 & SCR_GCSEn_BIT) != 0U)) {
 		write_el2_ctx_gcs(el2_sysregs_ctx, gcscr_el2, read_gcscr_el2());
 		write_el2_ctx_gcs(el2_sysregs_ctx, gcspr_el2, read_gcspr_el2());
 	}
 
-	if (is_feat_sctlr2_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_sctlr2) && ((scr_el3 & SCR_SCTLR2En_BIT) != 0U)) {
 		write_el2_ctx_sctlr2(el2_sysregs_ctx, sctlr2_el2, read_sctlr2_el2());
 	}
 }
@@ -1494,80 +1635,81 @@ void cm_el2_sysregs_context_restore(uint32_t security_state)
 
 	el2_sysregs_ctx = get_el2_sysregs_ctx(ctx);
 
-	el2_sysregs_context_restore_common(el2_sysregs_ctx);
+	el2_sysregs_context_restore_common(el2_sysregs_ctx,
+		!el2_syndrome_scratch[get_cpu_context_index(security_state)]);
 	el2_sysregs_context_restore_gic(el2_sysregs_ctx);
 
-	if (is_feat_mte2_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_mte2)) {
 		write_tfsr_el2(read_el2_ctx_mte2(el2_sysregs_ctx, tfsr_el2));
 	}
 
-	if (is_feat_mpam_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_mpam)) {
 		el2_sysregs_context_restore_mpam(el2_sysregs_ctx);
 	}
 
-	if (is_feat_fgt_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_fgt)) {
 		el2_sysregs_context_restore_fgt(el2_sysregs_ctx);
 	}
 
-	if (is_feat_fgt2_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_fgt2)) {
 		el2_sysregs_context_restore_fgt2(el2_sysregs_ctx);
 	}
 
-	if (is_feat_ecv_v2_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_ecv_v2)) {
 		write_cntpoff_el2(read_el2_ctx_ecv(el2_sysregs_ctx, cntpoff_el2));
 	}
 
-	if (is_feat_vhe_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_vhe)) {
 		write_contextidr_el2(read_el2_ctx_vhe(el2_sysregs_ctx,
 					contextidr_el2));
 		write_ttbr1_el2(read_el2_ctx_vhe(el2_sysregs_ctx, ttbr1_el2));
 	}
 
-	if (is_feat_ras_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_ras)) {
 		write_vdisr_el2(read_el2_ctx_ras(el2_sysregs_ctx, vdisr_el2));
 		write_vsesr_el2(read_el2_ctx_ras(el2_sysregs_ctx, vsesr_el2));
 	}
 
-	if (is_feat_nv2_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_nv2)) {
 		write_vncr_el2(read_el2_ctx_neve(el2_sysregs_ctx, vncr_el2));
 	}
 
-	if (is_feat_trf_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_trf)) {
 		write_trfcr_el2(read_el2_ctx_trf(el2_sysregs_ctx, trfcr_el2));
 	}
 
-	if (is_feat_csv2_2_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_csv2_2)) {
 		write_scxtnum_el2(read_el2_ctx_csv2_2(el2_sysregs_ctx,
 					scxtnum_el2));
 	}
 
-	if (is_feat_hcx_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_hcx)) {
 		write_hcrx_el2(read_el2_ctx_hcx(el2_sysregs_ctx, hcrx_el2));
 	}
 
-	if (is_feat_tcr2_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_tcr2)) {
 		write_tcr2_el2(read_el2_ctx_tcr2(el2_sysregs_ctx, tcr2_el2));
 	}
 
-	if (is_feat_sxpie_supported()) {
+	if (CTX_FEAT_SXPIE_SUPPORTED()) {
 		write_pire0_el2(read_el2_ctx_sxpie(el2_sysregs_ctx, pire0_el2));
 		write_pir_el2(read_el2_ctx_sxpie(el2_sysregs_ctx, pir_el2));
 	}
 
-	if (is_feat_sxpoe_supported()) {
+	if (CTX_FEAT_SXPOE_SUPPORTED()) {
 		write_por_el2(read_el2_ctx_sxpoe(el2_sysregs_ctx, por_el2));
 	}
 
-	if (is_feat_s2pie_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_s2pie)) {
 		write_s2pir_el2(read_el2_ctx_s2pie(el2_sysregs_ctx, s2pir_el2));
 	}
 
-	if (is_feat_gcs_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_gcs)) {
 		write_gcscr_el2(read_el2_ctx_gcs(el2_sysregs_ctx, gcscr_el2));
 		write_gcspr_el2(read_el2_ctx_gcs(el2_sysregs_ctx, gcspr_el2));
 	}
 
-	if (is_feat_sctlr2_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_sctlr2)) {
 		write_sctlr2_el2(read_el2_ctx_sctlr2(el2_sysregs_ctx, sctlr2_el2));
 	}
 }
@@ -1630,6 +1772,9 @@ void cm_handle_asymmetric_features(void)
 void cm_prepare_el3_exit_ns(void)
 {
 #if IMAGE_BL31
+	/* Run the work deferred by the SMC handlers before leaving EL3 */
+	deferred_work_run();
+
 	/*
 	 * Check and handle Architecture feature asymmetry among cores.
 	 *
@@ -1715,60 +1860,60 @@ static void el1_sysregs_context_save(el1_sysregs_t *ctx)
 		write_el1_ctx_arch_timer(ctx, cntkctl_el1, read_cntkctl_el1());
 	}
 
-	if (is_feat_mte2_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_mte2)) {
 		write_el1_ctx_mte2(ctx, tfsre0_el1, read_tfsre0_el1());
 		write_el1_ctx_mte2(ctx, tfsr_el1, read_tfsr_el1());
 		write_el1_ctx_mte2(ctx, rgsr_el1, read_rgsr_el1());
 		write_el1_ctx_mte2(ctx, gcr_el1, read_gcr_el1());
 	}
 
-	if (is_feat_ras_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_ras)) {
 		write_el1_ctx_ras(ctx, disr_el1, read_disr_el1());
 	}
 
-	if (is_feat_s1pie_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_s1pie)) {
 		write_el1_ctx_s1pie(ctx, pire0_el1, read_pire0_el1());
 		write_el1_ctx_s1pie(ctx, pir_el1, read_pir_el1());
 	}
 
-	if (is_feat_s1poe_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_s1poe)) {
 		write_el1_ctx_s1poe(ctx, por_el1, read_por_el1());
 	}
 
-	if (is_feat_s2poe_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_s2poe)) {
 		write_el1_ctx_s2poe(ctx, s2por_el1, read_s2por_el1());
 	}
 
-	if (is_feat_tcr2_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_tcr2)) {
 		write_el1_ctx_tcr2(ctx, tcr2_el1, read_tcr2_el1());
 	}
 
-	if (is_feat_trf_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_trf)) {
 		write_el1_ctx_trf(ctx, trfcr_el1, read_trfcr_el1());
 	}
 
-	if (is_feat_csv2_2_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_csv2_2)) {
 		write_el1_ctx_csv2_2(ctx, scxtnum_el0, read_scxtnum_el0());
 		write_el1_ctx_csv2_2(ctx, scxtnum_el1, read_scxtnum_el1());
 	}
 
-	if (is_feat_gcs_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_gcs)) {
 		write_el1_ctx_gcs(ctx, gcscr_el1, read_gcscr_el1());
 		write_el1_ctx_gcs(ctx, gcscre0_el1, read_gcscre0_el1());
 		write_el1_ctx_gcs(ctx, gcspr_el1, read_gcspr_el1());
 		write_el1_ctx_gcs(ctx, gcspr_el0, read_gcspr_el0());
 	}
 
-	if (is_feat_the_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_the)) {
 		write_el1_ctx_the(ctx, rcwmask_el1, read_rcwmask_el1());
 		write_el1_ctx_the(ctx, rcwsmask_el1, read_rcwsmask_el1());
 	}
 
-	if (is_feat_sctlr2_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_sctlr2)) {
 		write_el1_ctx_sctlr2(ctx, sctlr2_el1, read_sctlr2_el1());
 	}
 
-	if (is_feat_ls64_accdata_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_ls64_accdata)) {
 		write_el1_ctx_ls64(ctx, accdata_el1, read_accdata_el1());
 	}
 }
@@ -1823,60 +1968,60 @@ static void el1_sysregs_context_restore(el1_sysregs_t *ctx)
 		write_cntkctl_el1(read_el1_ctx_arch_timer(ctx, cntkctl_el1));
 	}
 
-	if (is_feat_mte2_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_mte2)) {
 		write_tfsre0_el1(read_el1_ctx_mte2(ctx, tfsre0_el1));
 		write_tfsr_el1(read_el1_ctx_mte2(ctx, tfsr_el1));
 		write_rgsr_el1(read_el1_ctx_mte2(ctx, rgsr_el1));
 		write_gcr_el1(read_el1_ctx_mte2(ctx, gcr_el1));
 	}
 
-	if (is_feat_ras_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_ras)) {
 		write_disr_el1(read_el1_ctx_ras(ctx, disr_el1));
 	}
 
-	if (is_feat_s1pie_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_s1pie)) {
 		write_pire0_el1(read_el1_ctx_s1pie(ctx, pire0_el1));
 		write_pir_el1(read_el1_ctx_s1pie(ctx, pir_el1));
 	}
 
-	if (is_feat_s1poe_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_s1poe)) {
 		write_por_el1(read_el1_ctx_s1poe(ctx, por_el1));
 	}
 
-	if (is_feat_s2poe_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_s2poe)) {
 		write_s2por_el1(read_el1_ctx_s2poe(ctx, s2por_el1));
 	}
 
-	if (is_feat_tcr2_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_tcr2)) {
 		write_tcr2_el1(read_el1_ctx_tcr2(ctx, tcr2_el1));
 	}
 
-	if (is_feat_trf_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_trf)) {
 		write_trfcr_el1(read_el1_ctx_trf(ctx, trfcr_el1));
 	}
 
-	if (is_feat_csv2_2_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_csv2_2)) {
 		write_scxtnum_el0(read_el1_ctx_csv2_2(ctx, scxtnum_el0));
 		write_scxtnum_el1(read_el1_ctx_csv2_2(ctx, scxtnum_el1));
 	}
 
-	if (is_feat_gcs_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_gcs)) {
 		write_gcscr_el1(read_el1_ctx_gcs(ctx, gcscr_el1));
 		write_gcscre0_el1(read_el1_ctx_gcs(ctx, gcscre0_el1));
 		write_gcspr_el1(read_el1_ctx_gcs(ctx, gcspr_el1));
 		write_gcspr_el0(read_el1_ctx_gcs(ctx, gcspr_el0));
 	}
 
-	if (is_feat_the_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_the)) {
 		write_rcwmask_el1(read_el1_ctx_the(ctx, rcwmask_el1));
 		write_rcwsmask_el1(read_el1_ctx_the(ctx, rcwsmask_el1));
 	}
 
-	if (is_feat_sctlr2_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_sctlr2)) {
 		write_sctlr2_el1(read_el1_ctx_sctlr2(ctx, sctlr2_el1));
 	}
 
-	if (is_feat_ls64_accdata_supported()) {
+	if (CTX_FEAT_SUPPORTED(feat_ls64_accdata)) {
 		write_accdata_el1(read_el1_ctx_ls64(ctx, accdata_el1));
 	}
 }
@@ -1885,7 +2030,7 @@ static void el1_sysregs_context_restore(el1_sysregs_t *ctx)
  * The next couple of functions are used by runtime services to save and restore
  * EL1 context on the 'cpu_context' structure for the specified security state.
  ******************************************************************************/
-void cm_el1_sysregs_context_save(uint32_t security_state)
+void __hot_runtime cm_el1_sysregs_context_save(uint32_t security_state)
 {
 	cpu_context_t *ctx;
 
@@ -1902,7 +2047,7 @@ void cm_el1_sysregs_context_save(uint32_t security_state)
 #endif
 }
 
-void cm_el1_sysregs_context_restore(uint32_t security_state)
+void __hot_runtime cm_el1_sysregs_context_restore(uint32_t security_state)
 {
 	cpu_context_t *ctx;
 
@@ -2012,7 +2157,7 @@ u_register_t cm_get_scr_el3(uint32_t security_state)
  * return. This initializes the SP_EL3 to a pointer to a 'cpu_context' set for
  * the required security state
  ******************************************************************************/
-void cm_set_next_eret_context(uint32_t security_state)
+void __hot_runtime cm_set_next_eret_context(uint32_t security_state)
 {
 	cpu_context_t *ctx;
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2024-2026, Arm Limited and Contributors. All rights reserved.
  * Copyright (c) 2022, Google LLC. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
@@ -7,6 +7,7 @@
 
 #include <stdint.h>
 
+#include <arch.h>
 #include <common/debug.h>
 #include <lib/el3_runtime/aarch64/context.h>
 #include <lib/el3_runtime/context_mgmt.h>
@@ -17,27 +18,49 @@
 
 #if CTX_INCLUDE_FPREGS || CTX_INCLUDE_SVE_REGS
 
-/* SIMD context managed for Secure and Normal Worlds. */
-#define SIMD_CTXT_COUNT	2
-
 #if SEPARATE_SIMD_SECTION
-__section(".simd_context")
+#define SIMD_CONTEXT_SECTION	".simd_context"
 #else
-__section(".bss.simd_context")
+#define SIMD_CONTEXT_SECTION	".bss.simd_context"
 #endif
-static simd_regs_t simd_context[SIMD_CTXT_COUNT][PLATFORM_CORE_COUNT];
 
-void simd_ctx_save(uint32_t security_state, bool hint_sve)
+/*
+ * SIMD context managed for Secure and Normal Worlds. Each is sized for the
+ * vector length of its world, which with SVE can differ by a lot.
+ */
+__section(SIMD_CONTEXT_SECTION)
+static uint8_t simd_context_secure[PLATFORM_CORE_COUNT]
+	[SIMD_REGS_SIZE(SIMD_SWD_VECTOR_LEN_BYTES)] __aligned(16);
+
+__section(SIMD_CONTEXT_SECTION)
+static uint8_t simd_context_ns[PLATFORM_CORE_COUNT]
+	[SIMD_REGS_SIZE(SIMD_VECTOR_LEN_BYTES)] __aligned(16);
+
+static simd_regs_t *simd_regs(uint32_t security_state, unsigned int core)
 {
-	simd_regs_t *regs;
+	if (security_state == SECURE) {
+		return (simd_regs_t *)simd_context_secure[core];
+	}
 
-	if (security_state != NON_SECURE && security_state != SECURE) {
-		ERROR("Unsupported security state specified for SIMD context: %u\n",
-		      security_state);
-		panic();
+	return (simd_regs_t *)simd_context_ns[core];
+}
+
+#if CTX_INCLUDE_SVE_REGS
+/* ZCR_EL3.LEN of the vector length the context of a world is sized for */
+static u_register_t simd_zcr_len(uint32_t security_state)
+{
+	if (security_state == SECURE) {
+		return (SVE_VECTOR_LEN_FOR_SWD >> 7) - 1U;
 	}
 
-	regs = &simd_context[security_state][plat_my_core_pos()];
+	return (SVE_VECTOR_LEN >> 7) - 1U;
+}
+#endif
+
+static void simd_regs_save(uint32_t security_state, unsigned int core,
+			   bool hint_sve)
+{
+	simd_regs_t *regs = simd_regs(security_state, core);
 
 #if CTX_INCLUDE_SVE_REGS
 	regs->hint = hint_sve;
@@ -49,33 +72,167 @@ void simd_ctx_save(uint32_t security_state, bool hint_sve)
 		 */
 		fpregs_context_save(regs);
 	} else {
-		sve_context_save(regs);
+		sve_context_save(regs, simd_zcr_len(security_state));
 	}
 #elif CTX_INCLUDE_FPREGS
 	fpregs_context_save(regs);
 #endif
 }
 
-void simd_ctx_restore(uint32_t security_state)
+static void simd_regs_restore(uint32_t security_state, unsigned int core)
 {
-	simd_regs_t *regs;
+	simd_regs_t *regs = simd_regs(security_state, core);
 
+#if CTX_INCLUDE_SVE_REGS
+	if (regs->hint) {
+		fpregs_context_restore(regs);
+	} else {
+		sve_context_restore(regs, simd_zcr_len(security_state));
+	}
+#elif CTX_INCLUDE_FPREGS
+	fpregs_context_restore(regs);
+#endif
+}
+
+static void simd_check_security_state(uint32_t security_state)
+{
 	if (security_state != NON_SECURE && security_state != SECURE) {
 		ERROR("Unsupported security state specified for SIMD context: %u\n",
 		      security_state);
 		panic();
 	}
+}
+
+#if SIMD_LAZY_SWITCH
+/*
+ * With SIMD_LAZY_SWITCH the registers are only switched when a world actually
+ * uses them. simd_owner[] records, per cpu, the security state plus one whose
+ * values are live in the registers, 0 until it is known. Every other world is
+ * run with FP/SIMD trapped to EL3, see simd_ctx_lazy_trap().
+ */
+static uint32_t simd_owner[PLATFORM_CORE_COUNT];
+
+static void simd_lazy_set_trap(uint32_t security_state, u_register_t trap)
+{
+	cpu_context_t *ctx = cm_get_context(security_state);
+
+	if (ctx != NULL) {
+		write_ctx_reg(get_el3state_ctx(ctx), CTX_SIMD_CPTR_TRAP, trap);
+	}
+}
+
+static void simd_lazy_set_owner(unsigned int core, uint32_t security_state)
+{
+	simd_owner[core] = security_state + 1U;
+	simd_lazy_set_trap(SECURE, (security_state == SECURE) ? 0U : TFP_BIT);
+	simd_lazy_set_trap(NON_SECURE,
+			   (security_state == NON_SECURE) ? 0U : TFP_BIT);
+}
+
+/*
+ * Called on an FP/SIMD trap from a lower EL: save the registers of their
+ * current owner and load the ones of the trapping world.
+ */
+void simd_ctx_lazy_trap(cpu_context_t *ctx)
+{
+	unsigned int core = plat_my_core_pos();
+	uint32_t security_state = NON_SECURE;
+	uint32_t owner = simd_owner[core];
+
+	if ((read_ctx_reg(get_el3state_ctx(ctx), CTX_SCR_EL3) &
+	     SCR_NS_BIT) == 0U) {
+		security_state = SECURE;
+	}
+
+	if ((owner != 0U) && (owner != (security_state + 1U))) {
+#if CTX_INCLUDE_SVE_REGS
+		simd_regs_save(owner - 1U, core,
+			       simd_regs(owner - 1U, core)->hint);
+#else
+		simd_regs_save(owner - 1U, core, false);
+#endif
+		simd_regs_restore(security_state, core);
+	}
 
-	regs = &simd_context[security_state][plat_my_core_pos()];
+	simd_lazy_set_owner(core, security_state);
+}
 
+/*
+ * Write the live registers back to their owner context before they are lost,
+ * e.g. when the cpu is powered down. Nothing is trapped afterwards until the
+ * next world switch.
+ */
+void simd_ctx_lazy_flush(void)
+{
+	unsigned int core = plat_my_core_pos();
+	uint32_t owner = simd_owner[core];
+
+	if (owner != 0U) {
 #if CTX_INCLUDE_SVE_REGS
-	if (regs->hint) {
-		fpregs_context_restore(regs);
-	} else {
-		sve_context_restore(regs);
+		simd_regs_save(owner - 1U, core,
+			       simd_regs(owner - 1U, core)->hint);
+#else
+		simd_regs_save(owner - 1U, core, false);
+#endif
+	}
+
+	simd_owner[core] = 0U;
+	simd_lazy_set_trap(SECURE, 0U);
+	simd_lazy_set_trap(NON_SECURE, 0U);
+}
+#endif /* SIMD_LAZY_SWITCH */
+
+void simd_ctx_save(uint32_t security_state, bool hint_sve)
+{
+	unsigned int core = plat_my_core_pos();
+
+	simd_check_security_state(security_state);
+
+#if SIMD_LAZY_SWITCH
+	/*
+	 * The registers hold the state of the world being left unless another
+	 * world has the ownership. Only record how to save them for when some
+	 * other world uses them.
+	 */
+	if (simd_owner[core] == 0U) {
+		simd_lazy_set_owner(core, security_state);
+	}
+#if CTX_INCLUDE_SVE_REGS
+	if (simd_owner[core] == (security_state + 1U)) {
+		simd_regs(security_state, core)->hint = hint_sve;
 	}
-#elif CTX_INCLUDE_FPREGS
-	fpregs_context_restore(regs);
 #endif
+#else
+	simd_regs_save(security_state, core, hint_sve);
+#endif /* SIMD_LAZY_SWITCH */
+}
+
+void simd_ctx_restore(uint32_t security_state)
+{
+	unsigned int core = plat_my_core_pos();
+
+	simd_check_security_state(security_state);
+
+#if SIMD_LAZY_SWITCH
+	/*
+	 * The registers are loaded when the world first uses them. Without an
+	 * owner yet, fall back to loading them now.
+	 */
+	if (simd_owner[core] != 0U) {
+		return;
+	}
+
+	simd_lazy_set_owner(core, security_state);
+#endif /* SIMD_LAZY_SWITCH */
+	simd_regs_restore(security_state, core);
+}
+
+size_t simd_ctx_size(uint32_t security_state)
+{
+	if (security_state == SECURE) {
+		return sizeof(simd_context_secure);
+	}
+
+	return sizeof(simd_context_ns);
 }
 #endif /* CTX_INCLUDE_FPREGS || CTX_INCLUDE_SVE_REGS */
@@ -1,11 +1,12 @@
 /*
- * Copyright (c) 2017-2023, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
 #include <assert.h>
 #include <cdefs.h>
+#include <errno.h>
 #include <inttypes.h>
 #include <stdbool.h>
 #include <stdint.h>
@@ -17,6 +18,10 @@
 #include <common/debug.h>
 #include <lib/el3_runtime/pubsub_events.h>
 #include <lib/extensions/amu.h>
+#include <lib/spinlock.h>
+#include <lib/utils.h>
+#include <lib/utils_def.h>
+#include <lib/xlat_tables/xlat_tables_v2.h>
 
 #include <plat/common/platform.h>
 
@@ -29,6 +34,10 @@
 #	include <lib/mpmm/mpmm.h>
 #endif
 
+#if AMU_SNAPSHOT && !PLAT_XLAT_TABLES_DYNAMIC
+#error "AMU_SNAPSHOT requires PLAT_XLAT_TABLES_DYNAMIC to map the snapshot buffer"
+#endif
+
 struct amu_ctx {
 	uint64_t group0_cnts[AMU_GROUP0_MAX_COUNTERS];
 #if ENABLE_AMU_AUXILIARY_COUNTERS
@@ -365,6 +374,16 @@ static uint64_t amu_group1_cnt_read(unsigned int idx)
 	return amu_group1_cnt_read_internal(idx);
 }
 
+uint64_t amu_aux_cnt_read(unsigned int idx)
+{
+	if (!is_feat_amu_supported() || !amu_group1_supported() ||
+	    (idx >= read_amcgcr_el0_cg1nc())) {
+		return 0U;
+	}
+
+	return amu_group1_cnt_read(idx);
+}
+
 /* Write the group 1 counter identified by the given `idx` with `val` */
 static void amu_group1_cnt_write(unsigned int idx, uint64_t val)
 {
@@ -408,6 +427,142 @@ static void amu_group1_voffset_write(unsigned int idx, uint64_t val)
 }
 #endif
 
+#if AMU_SNAPSHOT
+CASSERT(AMU_GROUP0_MAX_COUNTERS <= AMU_SNAPSHOT_MAX_COUNTERS,
+	assert_amu_snapshot_group0_too_small);
+CASSERT(AMU_GROUP1_MAX_COUNTERS <= AMU_SNAPSHOT_MAX_COUNTERS,
+	assert_amu_snapshot_group1_too_small);
+CASSERT((sizeof(struct amu_snapshot) % CACHE_WRITEBACK_GRANULE) == 0U,
+	assert_amu_snapshot_not_cache_line_sized);
+
+#define AMU_SNAPSHOT_BUF_SIZE	(PLATFORM_CORE_COUNT * \
+				 sizeof(struct amu_snapshot))
+
+/* Serialises the buffer setup */
+static spinlock_t amu_snapshot_lock;
+
+/* Where the Normal world buffer is mapped, 0 until it is set */
+static uintptr_t amu_snapshot_va;
+
+/*
+ * Sequence counter of each entry, kept here so that the Normal world can not
+ * make BL31 publish an entry as complete while it is being written.
+ */
+static uint64_t amu_snapshot_seq[PLATFORM_CORE_COUNT];
+
+/*
+ * Map the Normal world buffer the counters of each core are published into.
+ * It can only be set once. Returns -ENOMEM if the buffer can not hold an entry
+ * for every core.
+ */
+int amu_snapshot_set_buffer(uint64_t base_pa, size_t size)
+{
+	uintptr_t base_va;
+	int rc = -EPERM;
+
+	if ((base_pa & PAGE_SIZE_MASK) != 0U) {
+		return -EINVAL;
+	}
+
+	if (size < AMU_SNAPSHOT_BUF_SIZE) {
+		return -ENOMEM;
+	}
+
+	spin_lock(&amu_snapshot_lock);
+
+	if (amu_snapshot_va == 0U) {
+		rc = mmap_add_dynamic_region_alloc_va(base_pa, &base_va,
+				round_up(AMU_SNAPSHOT_BUF_SIZE, PAGE_SIZE),
+				MT_MEMORY | MT_RW | MT_NS | MT_EXECUTE_NEVER);
+		if (rc == 0) {
+			zeromem((void *)base_va, AMU_SNAPSHOT_BUF_SIZE);
+			dmbishst();
+			amu_snapshot_va = base_va;
+		}
+	}
+
+	spin_unlock(&amu_snapshot_lock);
+
+	return rc;
+}
+
+/*
+ * Publish the counters of the calling core. The entry is bracketed by its
+ * sequence counter being odd so that a reader never mixes two snapshots.
+ */
+static void amu_snapshot_publish(uint32_t flags,
+				 const uint64_t *group0, uint64_t group0_num,
+				 const uint64_t *group1, uint64_t group1_num)
+{
+	unsigned int core_pos = plat_my_core_pos();
+	struct amu_snapshot *snap;
+	uint64_t i;
+
+	if (amu_snapshot_va == 0U) {
+		return;
+	}
+
+	snap = &((struct amu_snapshot *)amu_snapshot_va)[core_pos];
+
+	snap->seq = ++amu_snapshot_seq[core_pos];
+	dmbishst();
+
+	snap->timestamp = read_cntpct_el0();
+	snap->flags = flags;
+	snap->group0_num = (uint16_t)group0_num;
+	snap->group1_num = (uint16_t)group1_num;
+	for (i = 0U; i < group0_num; i++) {
+		snap->group0[i] = group0[i];
+	}
+	for (i = 0U; i < group1_num; i++) {
+		snap->group1[i] = group1[i];
+	}
+
+	dmbishst();
+	snap->seq = ++amu_snapshot_seq[core_pos];
+}
+
+/*
+ * Read the counters of the calling core, publish them if a buffer is set and
+ * return the four architected counters in 'arch_cnts'.
+ */
+int amu_snapshot_update(uint64_t arch_cnts[4])
+{
+	uint64_t group0[AMU_GROUP0_MAX_COUNTERS] = { 0U };
+	uint64_t group0_num, i;
+#if ENABLE_AMU_AUXILIARY_COUNTERS
+	uint64_t group1[AMU_GROUP1_MAX_COUNTERS];
+	uint64_t group1_num;
+#endif
+
+	if (!is_feat_amu_supported()) {
+		return -ENODEV;
+	}
+
+	group0_num = read_amcgcr_el0_cg0nc();
+	for (i = 0U; i < group0_num; i++) {
+		group0[i] = amu_group0_cnt_read(i);
+	}
+
+#if ENABLE_AMU_AUXILIARY_COUNTERS
+	group1_num = (read_amcfgr_el0_ncg() > 0U) ? read_amcgcr_el0_cg1nc() : 0U;
+	for (i = 0U; i < group1_num; i++) {
+		group1[i] = amu_group1_cnt_read(i);
+	}
+
+	amu_snapshot_publish(0U, group0, group0_num, group1, group1_num);
+#else
+	amu_snapshot_publish(0U, group0, group0_num, NULL, 0U);
+#endif
+
+	for (i = 0U; i < 4U; i++) {
+		arch_cnts[i] = group0[i];
+	}
+
+	return 0;
+}
+#endif /* AMU_SNAPSHOT */
+
 static void *amu_context_save(const void *arg)
 {
 	uint64_t i, j;
@@ -496,6 +651,18 @@ static void *amu_context_save(const void *arg)
 #endif
 	}
 
+#if AMU_SNAPSHOT
+	/* The counters are stopped until the core leaves the powerdown state */
+#if ENABLE_AMU_AUXILIARY_COUNTERS
+	amu_snapshot_publish(AMU_SNAPSHOT_CPU_OFF,
+			     ctx->group0_cnts, amcgcr_el0_cg0nc,
+			     ctx->group1_cnts, amcgcr_el0_cg1nc);
+#else
+	amu_snapshot_publish(AMU_SNAPSHOT_CPU_OFF,
+			     ctx->group0_cnts, amcgcr_el0_cg0nc, NULL, 0U);
+#endif
+#endif /* AMU_SNAPSHOT */
+
 	return (void *)0;
 }
 
@@ -585,6 +752,15 @@ static void *amu_context_restore(const void *arg)
 	}
 #endif
 
+#if AMU_SNAPSHOT
+#if ENABLE_AMU_AUXILIARY_COUNTERS
+	amu_snapshot_publish(0U, ctx->group0_cnts, amcgcr_el0_cg0nc,
+			     ctx->group1_cnts, amcgcr_el0_cg1nc);
+#else
+	amu_snapshot_publish(0U, ctx->group0_cnts, amcgcr_el0_cg0nc, NULL, 0U);
+#endif
+#endif /* AMU_SNAPSHOT */
+
 #if ENABLE_MPMM
 	mpmm_enable();
 #endif
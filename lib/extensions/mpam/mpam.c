@@ -1,19 +1,43 @@
 /*
- * Copyright (c) 2018-2023, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2018-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <errno.h>
 #include <stdbool.h>
 
 #include <arch.h>
 #include <arch_features.h>
 #include <arch_helpers.h>
+#include <common/debug.h>
 #include <lib/extensions/mpam.h>
+#include <lib/mmio.h>
+#include <lib/utils_def.h>
+
+#if ENABLE_MPAM_PARTITIONING
+/* MSC memory-mapped registers */
+#define MPAMF_IDR			U(0x0000)
+#define MPAMF_CPOR_IDR			U(0x0030)
+#define MPAMF_MBW_IDR			U(0x0040)
+#define MPAMCFG_PART_SEL		U(0x0100)
+#define MPAMCFG_MBW_MAX			U(0x0208)
+#define MPAMCFG_CPBM			U(0x1000)
+
+#define MPAMF_IDR_PARTID_MAX_MASK	U(0xffff)
+#define MPAMF_IDR_HAS_CPOR_PART		BIT_32(25)
+#define MPAMF_IDR_HAS_MBW_PART		BIT_32(26)
+#define MPAMF_CPOR_IDR_CPBM_WD_MASK	U(0xffff)
+#define MPAMF_MBW_IDR_HAS_MAX		BIT_32(11)
+#define MPAMCFG_MBW_MAX_HARDLIM		BIT_32(31)
+#endif /* ENABLE_MPAM_PARTITIONING */
 
 void mpam_enable_per_world(per_world_context_t *per_world_ctx)
 {
 	u_register_t mpam3_el3;
+#if ENABLE_MPAM_PARTITIONING
+	const struct mpam_partition_config *config;
+#endif
 
 	/*
 	 * Enable MPAM, and disable trapping to EL3 when lower ELs access their
@@ -23,6 +47,20 @@ void mpam_enable_per_world(per_world_context_t *per_world_ctx)
 	mpam3_el3 = (mpam3_el3 | MPAM3_EL3_MPAMEN_BIT) &
 				~(MPAM3_EL3_TRAPLOWER_BIT);
 
+#if ENABLE_MPAM_PARTITIONING
+	/* Label the EL3 accesses made on behalf of the Non-secure world */
+	config = plat_mpam_partition_config();
+	if (config != NULL) {
+		u_register_t partid = config->el3_partid;
+		u_register_t pmg = config->el3_pmg;
+
+		mpam3_el3 |= (partid << MPAM3_EL3_PARTID_I_SHIFT) |
+			     (partid << MPAM3_EL3_PARTID_D_SHIFT) |
+			     (pmg << MPAM3_EL3_PMG_I_SHIFT) |
+			     (pmg << MPAM3_EL3_PMG_D_SHIFT);
+	}
+#endif
+
 	per_world_ctx->ctx_mpam3_el3 = mpam3_el3;
 }
 
@@ -39,3 +77,80 @@ void mpam_init_el2_unused(void)
 	}
 
 }
+
+#if ENABLE_MPAM_PARTITIONING
+/* Program the limits of one partition into its MSC */
+static int mpam_msc_partition_init(const struct mpam_msc_partition *part)
+{
+	uint32_t idr = mmio_read_32(part->base + MPAMF_IDR);
+	unsigned int cpbm_wd, i;
+	uint32_t cpbm;
+
+	if (part->partid > (idr & MPAMF_IDR_PARTID_MAX_MASK)) {
+		return -EINVAL;
+	}
+
+	mmio_write_32(part->base + MPAMCFG_PART_SEL, part->partid);
+
+	if (part->cpbm != 0U) {
+		if ((idr & MPAMF_IDR_HAS_CPOR_PART) == 0U) {
+			return -ENOTSUP;
+		}
+
+		/* Portions 64 and above keep their reset value */
+		cpbm_wd = mmio_read_32(part->base + MPAMF_CPOR_IDR) &
+			  MPAMF_CPOR_IDR_CPBM_WD_MASK;
+		for (i = 0U; (i < 2U) && ((i * 32U) < cpbm_wd); i++) {
+			cpbm = (uint32_t)(part->cpbm >> (i * 32U));
+			if ((cpbm_wd - (i * 32U)) < 32U) {
+				cpbm &= (U(1) << (cpbm_wd - (i * 32U))) - 1U;
+			}
+			mmio_write_32(part->base + MPAMCFG_CPBM + (i * 4U),
+				      cpbm);
+		}
+	}
+
+	if (part->mbw_max != 0U) {
+		if (((idr & MPAMF_IDR_HAS_MBW_PART) == 0U) ||
+		    ((mmio_read_32(part->base + MPAMF_MBW_IDR) &
+		      MPAMF_MBW_IDR_HAS_MAX) == 0U)) {
+			return -ENOTSUP;
+		}
+
+		mmio_write_32(part->base + MPAMCFG_MBW_MAX, part->mbw_max |
+			      (part->mbw_hardlim ? MPAMCFG_MBW_MAX_HARDLIM : 0U));
+	}
+
+	return 0;
+}
+
+/*
+ * Program the cache portion and bandwidth limits of the platform partitions.
+ * A partition the MSC can not apply is reported and skipped, it does not
+ * prevent the others from being set.
+ */
+void mpam_partition_init(void)
+{
+	const struct mpam_partition_config *config;
+	unsigned int i;
+	int rc;
+
+	if (!is_feat_mpam_supported()) {
+		return;
+	}
+
+	config = plat_mpam_partition_config();
+	if (config == NULL) {
+		return;
+	}
+
+	for (i = 0U; i < config->msc_parts_count; i++) {
+		rc = mpam_msc_partition_init(&config->msc_parts[i]);
+		if (rc != 0) {
+			WARN("MPAM: MSC 0x%lx PARTID %u not set (%d)\n",
+			     config->msc_parts[i].base,
+			     config->msc_parts[i].partid, rc);
+		}
+	}
+}
+#endif /* ENABLE_MPAM_PARTITIONING */
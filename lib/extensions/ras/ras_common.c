@@ -19,6 +19,15 @@
 # error Platform must define RAS priority value
 #endif
 
+/*
+ * Largest number of errors handled for one RAS interrupt. The interrupt stays
+ * asserted while there are more, and is taken again once EL3 has let the rest
+ * of the system run, so that a storm of corrected errors can not hold EL3.
+ */
+#ifndef PLAT_RAS_INTR_MAX_ERRORS
+# define PLAT_RAS_INTR_MAX_ERRORS	16U
+#endif
+
 /*
  * Function to convert architecturally-defined primary error code SERR,
  * bits[7:0] from ERR<n>STATUS to its corresponding error string.
@@ -125,8 +134,10 @@ static int ras_interrupt_handler(uint32_t intr_raw, uint32_t flags,
 {
 	struct ras_interrupt *ras_inrs = ras_interrupt_mappings.intrs;
 	struct ras_interrupt *selected = NULL;
+	struct err_record_info *info;
 	int probe_data = 0;
-	int start, end, mid, ret __unused;
+	int start, end, mid;
+	unsigned int n;
 
 	const struct err_handler_data err_data = {
 		.version = ERR_HANDLER_VERSION,
@@ -159,15 +170,27 @@ static int ras_interrupt_handler(uint32_t intr_raw, uint32_t flags,
 		panic();
 	}
 
-	if (selected->err_record->probe != NULL) {
-		ret = selected->err_record->probe(selected->err_record, &probe_data);
-		assert(ret != 0);
+	info = selected->err_record;
+	assert(info->handler != NULL);
+
+	if (info->probe == NULL) {
+		/* Call error handler for the record group */
+		(void) info->handler(info, probe_data, &err_data);
+		return 0;
+	}
+
+	/*
+	 * Handle the errors pending in the record group in one go, rather than
+	 * taking the interrupt again for each of them.
+	 */
+	for (n = 0U; n < PLAT_RAS_INTR_MAX_ERRORS; n++) {
+		if (info->probe(info, &probe_data) == 0)
+			break;
+
+		(void) info->handler(info, probe_data, &err_data);
 	}
 
-	/* Call error handler for the record group */
-	assert(selected->err_record->handler != NULL);
-	(void) selected->err_record->handler(selected->err_record, probe_data,
-			&err_data);
+	assert(n != 0U);
 
 	return 0;
 }
@@ -26,7 +26,7 @@ int ser_probe_memmap(uintptr_t base, unsigned int size_num_k, int *probe_data)
 		(mmio_read_32(ERR_DEVID(base, size_num_k)) & ERR_DEVID_MASK);
 
 	/* A group register shows error status for 2^6 error records */
-	num_group_regs = (num_records >> 6U) + 1U;
+	num_group_regs = div_round_up(num_records, 64U);
 
 	/* Iterate through group registers to find a record in error */
 	for (i = 0; i < num_group_regs; i++) {
@@ -15,6 +15,9 @@
 CASSERT(SVE_VECTOR_LEN <= 2048, assert_sve_vl_too_long);
 CASSERT(SVE_VECTOR_LEN >= 128, assert_sve_vl_too_short);
 CASSERT((SVE_VECTOR_LEN % 128) == 0, assert_sve_vl_granule);
+CASSERT(SVE_VECTOR_LEN_FOR_SWD <= SVE_VECTOR_LEN, assert_sve_swd_vl_too_long);
+CASSERT(SVE_VECTOR_LEN_FOR_SWD >= 128, assert_sve_swd_vl_too_short);
+CASSERT((SVE_VECTOR_LEN_FOR_SWD % 128) == 0, assert_sve_swd_vl_granule);
 
 /*
  * Converts SVE vector size restriction in bytes to LEN according to ZCR_EL3 documentation.
@@ -22,7 +25,8 @@ CASSERT((SVE_VECTOR_LEN % 128) == 0, assert_sve_vl_granule);
  */
 #define CONVERT_SVE_LENGTH(x)	(((x / 128) - 1))
 
-void sve_enable_per_world(per_world_context_t *per_world_ctx)
+void sve_enable_per_world(per_world_context_t *per_world_ctx,
+			  unsigned int vector_len)
 {
 	u_register_t cptr_el3;
 
@@ -31,8 +35,8 @@ void sve_enable_per_world(per_world_context_t *per_world_ctx)
 	cptr_el3 = (cptr_el3 | CPTR_EZ_BIT) & ~(TFP_BIT);
 	per_world_ctx->ctx_cptr_el3 = cptr_el3;
 
-	/* Restrict maximum SVE vector length (SVE_VECTOR_LEN+1) * 128. */
-	per_world_ctx->ctx_zcr_el3 = (ZCR_EL3_LEN_MASK & CONVERT_SVE_LENGTH(SVE_VECTOR_LEN));
+	/* Restrict maximum SVE vector length (LEN+1) * 128 to vector_len. */
+	per_world_ctx->ctx_zcr_el3 = (ZCR_EL3_LEN_MASK & CONVERT_SVE_LENGTH(vector_len));
 }
 
 void sve_init_el2_unused(void)
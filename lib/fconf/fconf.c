@@ -1,19 +1,242 @@
 /*
- * Copyright (c) 2019-2022, Arm Limited. All rights reserved.
+ * Copyright (c) 2019-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
 #include <assert.h>
+#include <stdbool.h>
+#include <string.h>
 
 #include <common/debug.h>
 #include <common/fdt_wrappers.h>
 #include <lib/fconf/fconf.h>
 #include <lib/fconf/fconf_dyn_cfg_getter.h>
+#include <lib/spinlock.h>
 #include <libfdt.h>
 #include <plat/common/platform.h>
 #include <platform_def.h>
 
+#if FCONF_NODE_INDEX
+/* Largest number of nodes of a DTB fconf_populate() indexes */
+#ifndef FCONF_INDEX_MAX_NODES
+#define FCONF_INDEX_MAX_NODES	128U
+#endif
+#define FCONF_INDEX_MAX_DEPTH	16
+
+struct fconf_index_node {
+	int offset;
+	uint32_t phandle;
+	const char *compatible;
+	int compatible_len;
+	int16_t parent;		/* Index of the parent, -1 for the root */
+};
+
+/* Nodes in the order of their offsets, NULL dtb if there is no index */
+static struct fconf_index_node fconf_index[FCONF_INDEX_MAX_NODES];
+static unsigned int fconf_index_count;
+static const void *fconf_index_dtb;
+
+/*
+ * Walk the structure block once and record the offset, phandle, compatible
+ * list and parent of each node, so that the lookups of the populators need
+ * not walk it again from the root. The DTB must not be modified while it is
+ * indexed. If it has too many nodes, it is not indexed and the lookups fall
+ * back on libfdt.
+ */
+static void fconf_index_build(const void *dtb)
+{
+	int16_t parents[FCONF_INDEX_MAX_DEPTH];
+	unsigned int count = 0U;
+	int depth = 0;
+	int offset;
+
+	fconf_index_dtb = NULL;
+
+	/* The walk ends with a negative depth after the end of the root */
+	for (offset = 0; (offset >= 0) && (depth >= 0);
+	     offset = fdt_next_node(dtb, offset, &depth)) {
+		struct fconf_index_node *node;
+		int len;
+
+		if ((count == FCONF_INDEX_MAX_NODES) ||
+		    (depth >= FCONF_INDEX_MAX_DEPTH)) {
+			VERBOSE("FCONF: DTB not indexed\n");
+			return;
+		}
+
+		node = &fconf_index[count];
+		node->offset = offset;
+		node->phandle = fdt_get_phandle(dtb, offset);
+		node->compatible = fdt_getprop(dtb, offset, "compatible", &len);
+		node->compatible_len = (node->compatible != NULL) ? len : 0;
+		node->parent = (depth == 0) ? -1 : parents[depth - 1];
+		parents[depth] = (int16_t)count;
+		count++;
+	}
+
+	if ((offset < 0) && (offset != -FDT_ERR_NOTFOUND)) {
+		VERBOSE("FCONF: DTB not indexed (%d)\n", offset);
+		return;
+	}
+
+	fconf_index_count = count;
+	fconf_index_dtb = dtb;
+}
+
+int fconf_node_offset_by_compatible(const void *dtb, int startoffset,
+				    const char *compatible)
+{
+	const struct fconf_index_node *node;
+	unsigned int i;
+
+	if (dtb != fconf_index_dtb) {
+		return fdt_node_offset_by_compatible(dtb, startoffset,
+						     compatible);
+	}
+
+	for (i = 0U; i < fconf_index_count; i++) {
+		node = &fconf_index[i];
+		if ((node->offset > startoffset) &&
+		    (node->compatible != NULL) &&
+		    (fdt_stringlist_contains(node->compatible,
+					     node->compatible_len,
+					     compatible) != 0)) {
+			return node->offset;
+		}
+	}
+
+	return -FDT_ERR_NOTFOUND;
+}
+
+int fconf_node_offset_by_phandle(const void *dtb, uint32_t phandle)
+{
+	unsigned int i;
+
+	if (dtb != fconf_index_dtb) {
+		return fdt_node_offset_by_phandle(dtb, phandle);
+	}
+
+	if ((phandle == 0U) || (phandle == UINT32_MAX)) {
+		return -FDT_ERR_BADPHANDLE;
+	}
+
+	for (i = 0U; i < fconf_index_count; i++) {
+		if (fconf_index[i].phandle == phandle) {
+			return fconf_index[i].offset;
+		}
+	}
+
+	return -FDT_ERR_NOTFOUND;
+}
+
+/*
+ * Same match as libfdt: the whole name, or the name without its unit address
+ * if the path component has none.
+ */
+static bool fconf_index_name_eq(const void *dtb, int offset, const char *s,
+				size_t len)
+{
+	int name_len;
+	const char *name = fdt_get_name(dtb, offset, &name_len);
+
+	if ((name == NULL) || ((size_t)name_len < len) ||
+	    (memcmp(name, s, len) != 0)) {
+		return false;
+	}
+
+	if (name[len] == '\0') {
+		return true;
+	}
+
+	return (memchr(s, '@', len) == NULL) && (name[len] == '@');
+}
+
+int fconf_path_offset(const void *dtb, const char *path)
+{
+	const char *end = path + strlen(path);
+	const char *p = path;
+	int16_t cur = 0;
+
+	/* Aliases are left to libfdt */
+	if ((dtb != fconf_index_dtb) || (*path != '/')) {
+		return fdt_path_offset(dtb, path);
+	}
+
+	while (p < end) {
+		const char *q;
+		unsigned int i;
+
+		while (*p == '/') {
+			p++;
+		}
+		if (*p == '\0') {
+			break;
+		}
+
+		q = strchr(p, '/');
+		if (q == NULL) {
+			q = end;
+		}
+
+		for (i = (unsigned int)cur + 1U; i < fconf_index_count; i++) {
+			if ((fconf_index[i].parent == cur) &&
+			    fconf_index_name_eq(dtb, fconf_index[i].offset, p,
+						(size_t)(q - p))) {
+				break;
+			}
+		}
+		if (i == fconf_index_count) {
+			return -FDT_ERR_NOTFOUND;
+		}
+
+		cur = (int16_t)i;
+		p = q;
+	}
+
+	return fconf_index[cur].offset;
+}
+#endif /* FCONF_NODE_INDEX */
+
+#if FCONF_LAZY_POPULATE
+/* Serialises the first use of the lazy populators, which may be concurrent */
+static spinlock_t fconf_lazy_lock;
+
+void fconf_populate_lazy(struct fconf_lazy_state *lazy)
+{
+	const struct fconf_populator *populator;
+
+	assert(lazy != NULL);
+
+	spin_lock(&fconf_lazy_lock);
+
+	populator = lazy->populator;
+	if (!lazy->done && (lazy->config != 0UL)) {
+		INFO("FCONF: Reading firmware configuration information for: %s\n", populator->info);
+		if (populator->populate(lazy->config) != 0) {
+			/* TODO: handle property miss */
+			panic();
+		}
+		lazy->done = true;
+	}
+
+	spin_unlock(&fconf_lazy_lock);
+}
+
+void fconf_populate_pending(void)
+{
+	IMPORT_SYM(struct fconf_populator *, __FCONF_POPULATOR_START__, start);
+	IMPORT_SYM(struct fconf_populator *, __FCONF_POPULATOR_END__, end);
+	const struct fconf_populator *populator;
+
+	for (populator = start; populator != end; populator++) {
+		if (populator->lazy != NULL) {
+			fconf_populate_lazy(populator->lazy);
+		}
+	}
+}
+#endif /* FCONF_LAZY_POPULATE */
+
 int fconf_load_config(unsigned int image_id)
 {
 	int err;
@@ -49,6 +272,16 @@ int fconf_load_config(unsigned int image_id)
 
 void fconf_populate(const char *config_type, uintptr_t config)
 {
+	bool has_dtb = true;
+
+#if FCONF_STATIC_CONFIG
+	/* The DTB only overrides the static configuration, if it is present */
+	if ((config == 0UL) || (fdt_check_header((void *)config) != 0)) {
+		INFO("FCONF: Using the static %s firmware configuration\n",
+		     config_type);
+		has_dtb = false;
+	}
+#else
 	assert(config != 0UL);
 
 	/* Check if the pointer to DTB is correct */
@@ -56,23 +289,64 @@ void fconf_populate(const char *config_type, uintptr_t config)
 		ERROR("FCONF: Invalid DTB file passed for %s\n", config_type);
 		panic();
 	}
+#endif
 
-	INFO("FCONF: Reading %s firmware configuration file from: 0x%lx\n", config_type, config);
+	if (has_dtb) {
+		INFO("FCONF: Reading %s firmware configuration file from: 0x%lx\n", config_type, config);
+	}
 
 	/* Go through all registered populate functions */
 	IMPORT_SYM(struct fconf_populator *, __FCONF_POPULATOR_START__, start);
 	IMPORT_SYM(struct fconf_populator *, __FCONF_POPULATOR_END__, end);
 	const struct fconf_populator *populator;
 
+#if FCONF_NODE_INDEX
+	if (has_dtb) {
+		fconf_index_build((const void *)config);
+	}
+#endif
+
 	for (populator = start; populator != end; populator++) {
 		assert((populator->info != NULL) && (populator->populate != NULL));
 
-		if (strcmp(populator->config_type, config_type) == 0) {
-			INFO("FCONF: Reading firmware configuration information for: %s\n", populator->info);
-			if (populator->populate(config) != 0) {
-				/* TODO: handle property miss */
-				panic();
-			}
+		if (strcmp(populator->config_type, config_type) != 0) {
+			continue;
+		}
+
+#if FCONF_STATIC_CONFIG
+		if ((populator->populate_static != NULL) &&
+		    (populator->populate_static() == 0)) {
+			VERBOSE("FCONF: Static configuration information for: %s\n", populator->info);
+		} else if (!has_dtb) {
+			ERROR("FCONF: No static configuration information for: %s\n", populator->info);
+			panic();
+		}
+
+		if (!has_dtb) {
+			continue;
+		}
+#endif
+
+#if FCONF_LAZY_POPULATE
+		if (populator->lazy != NULL) {
+			spin_lock(&fconf_lazy_lock);
+			populator->lazy->populator = populator;
+			populator->lazy->config = config;
+			populator->lazy->done = false;
+			spin_unlock(&fconf_lazy_lock);
+			continue;
+		}
+#endif
+
+		INFO("FCONF: Reading firmware configuration information for: %s\n", populator->info);
+		if (populator->populate(config) != 0) {
+			/* TODO: handle property miss */
+			panic();
 		}
 	}
+
+#if FCONF_NODE_INDEX
+	/* The DTB may be modified from now on */
+	fconf_index_dtb = NULL;
+#endif
 }
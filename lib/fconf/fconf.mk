@@ -1,5 +1,5 @@
 #
-# Copyright (c) 2019-2021, Arm Limited. All rights reserved.
+# Copyright (c) 2019-2026, Arm Limited. All rights reserved.
 #
 # SPDX-License-Identifier: BSD-3-Clause
 #
@@ -17,3 +17,18 @@ FCONF_AMU_SOURCES	+=	${FDT_WRAPPERS_SOURCES}
 
 FCONF_MPMM_SOURCES	:=	lib/fconf/fconf_mpmm_getter.c
 FCONF_MPMM_SOURCES	+=	${FDT_WRAPPERS_SOURCES}
+
+# With FCONF_STATIC_CONFIG=1, the properties of the static populators are
+# compiled into the images from the DTBs listed in FCONF_STATIC_DTBS.
+ifeq (${FCONF_STATIC_CONFIG},1)
+FCONF_STATIC_SOURCES	:=	${BUILD_PLAT}/fconf_static_config.c
+FCONF_DYN_SOURCES	+=	${FCONF_STATIC_SOURCES}
+
+ifndef fconf-static-rule
+        fconf-static-rule := 1
+
+        $(FCONF_STATIC_SOURCES): $$(FCONF_STATIC_DTBS) | $$(@D)/
+		$(if $(host-poetry),$(q)poetry -q install)
+		$(q)$(if $(host-poetry),poetry run )cot-dt2c convert-fconf $@ $^
+endif
+endif
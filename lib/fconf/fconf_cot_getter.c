@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2024, Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -198,7 +198,7 @@ static int get_oid(const void *dtb, int node, const char *prop, char **oid)
 		return rc;
 	}
 
-	node = fdt_node_offset_by_phandle(dtb, phandle);
+	node = fconf_node_offset_by_phandle(dtb, phandle);
 	if (node < 0) {
 		return node;
 	}
@@ -301,7 +301,7 @@ static int get_parent_img_id(const void *dtb, int node,
 		return err;
 	}
 
-	node = fdt_node_offset_by_phandle(dtb, phandle);
+	node = fconf_node_offset_by_phandle(dtb, phandle);
 	if (node < 0) {
 		ERROR("FCONF: Failed to locate node using its phandle\n");
 		return node;
@@ -389,7 +389,7 @@ static int populate_manifest_descs(const void *dtb)
 	 */
 	const char *compatible_str = "arm, cert-descs";
 
-	node = fdt_node_offset_by_compatible(dtb, -1, compatible_str);
+	node = fconf_node_offset_by_compatible(dtb, -1, compatible_str);
 	if (node < 0) {
 		ERROR("FCONF: Can't find %s compatible in node\n",
 			compatible_str);
@@ -424,7 +424,7 @@ static int populate_image_descs(const void *dtb)
 	 */
 	const char *compatible_str = "arm, img-descs";
 
-	node = fdt_node_offset_by_compatible(dtb, -1, compatible_str);
+	node = fconf_node_offset_by_compatible(dtb, -1, compatible_str);
 	if (node < 0) {
 		ERROR("FCONF: Can't find %s compatible in node\n",
 			compatible_str);
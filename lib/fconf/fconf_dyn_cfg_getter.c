@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023, Arm Limited. All rights reserved.
+ * Copyright (c) 2019-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -29,15 +29,21 @@ static OBJECT_POOL_ARRAY(dtb_info_pool, dtb_infos);
 
 /*
  * This function is used to alloc memory for config information from
- * global pool and set the configuration information.
+ * global pool and set the configuration information. The information of a
+ * config already set, e.g. from the static configuration, is overridden.
  */
 void set_config_info(uintptr_t config_addr, uintptr_t secondary_config_addr,
 		     uint32_t config_max_size,
 		     unsigned int config_id)
 {
 	struct dyn_cfg_dtb_info_t *dtb_info;
+	unsigned int index = dyn_cfg_dtb_info_get_index(config_id);
 
-	dtb_info = pool_alloc(&dtb_info_pool);
+	if (index < MAX_DTB_INFO) {
+		dtb_info = &dtb_infos[index];
+	} else {
+		dtb_info = pool_alloc(&dtb_info_pool);
+	}
 	dtb_info->config_addr = config_addr;
 	dtb_info->secondary_config_addr = secondary_config_addr;
 	dtb_info->config_max_size = config_max_size;
@@ -90,14 +96,14 @@ int fconf_populate_dtb_registry(uintptr_t config)
 	 * Other BLs, satisfy below check and populate fw_config information
 	 * in global dtb_infos array.
 	 */
-	if (dtb_infos[0].config_id == 0U) {
+	if (dyn_cfg_dtb_info_get_index(FW_CONFIG_ID) == FCONF_INVALID_IDX) {
 		uint32_t config_max_size = fdt_totalsize(dtb);
 		set_config_info(config, ~0UL, config_max_size, FW_CONFIG_ID);
 	}
 
 	/* Find the node offset point to "fconf,dyn_cfg-dtb_registry" compatible property */
 	const char *compatible_str = "fconf,dyn_cfg-dtb_registry";
-	node = fdt_node_offset_by_compatible(dtb, -1, compatible_str);
+	node = fconf_node_offset_by_compatible(dtb, -1, compatible_str);
 	if (node < 0) {
 		ERROR("FCONF: Can't find %s compatible in dtb\n", compatible_str);
 		return node;
@@ -154,4 +160,25 @@ int fconf_populate_dtb_registry(uintptr_t config)
 	return 0;
 }
 
-FCONF_REGISTER_POPULATOR(FW_CONFIG, dyn_cfg, fconf_populate_dtb_registry);
+#if FCONF_STATIC_CONFIG
+static int fconf_populate_dtb_registry_static(void)
+{
+	const struct dyn_cfg_dtb_info_t *info;
+	unsigned int i;
+
+	if (!fconf_static_dtb_registry_present) {
+		return -1;
+	}
+
+	for (i = 0U; i < fconf_static_dtb_registry_count; i++) {
+		info = &fconf_static_dtb_registry[i];
+		set_config_info(info->config_addr, info->secondary_config_addr,
+				info->config_max_size, info->config_id);
+	}
+
+	return 0;
+}
+#endif /* FCONF_STATIC_CONFIG */
+
+FCONF_REGISTER_STATIC_POPULATOR(FW_CONFIG, dyn_cfg, fconf_populate_dtb_registry,
+				fconf_populate_dtb_registry_static);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, Arm Limited. All rights reserved.
+ * Copyright (c) 2021-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -77,4 +77,4 @@ static int fconf_populate_mpmm(uintptr_t config)
 	return ret;
 }
 
-FCONF_REGISTER_POPULATOR(HW_CONFIG, mpmm, fconf_populate_mpmm);
+FCONF_REGISTER_LAZY_POPULATOR(HW_CONFIG, mpmm, fconf_populate_mpmm);
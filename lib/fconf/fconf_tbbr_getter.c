@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2022, Arm Limited. All rights reserved.
+ * Copyright (c) 2019-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -25,7 +25,7 @@ int fconf_populate_tbbr_dyn_config(uintptr_t config)
 
 	/* Assert the node offset point to "arm,tb_fw" compatible property */
 	const char *compatible_str = "arm,tb_fw";
-	node = fdt_node_offset_by_compatible(dtb, -1, compatible_str);
+	node = fconf_node_offset_by_compatible(dtb, -1, compatible_str);
 	if (node < 0) {
 		ERROR("FCONF: Can't find `%s` compatible in dtb\n",
 						compatible_str);
@@ -81,4 +81,24 @@ int fconf_populate_tbbr_dyn_config(uintptr_t config)
 	return 0;
 }
 
-FCONF_REGISTER_POPULATOR(TB_FW, tbbr, fconf_populate_tbbr_dyn_config);
+#if FCONF_STATIC_CONFIG
+static int fconf_populate_tbbr_dyn_config_static(void)
+{
+	if (!fconf_static_tbbr_dyn_config_present) {
+		return -1;
+	}
+
+	/* The generator has checked that disable_auth is boolean */
+	tbbr_dyn_config = fconf_static_tbbr_dyn_config;
+
+#if defined(DYN_DISABLE_AUTH)
+	if (tbbr_dyn_config.disable_auth == 1)
+		dyn_disable_auth();
+#endif
+
+	return 0;
+}
+#endif /* FCONF_STATIC_CONFIG */
+
+FCONF_REGISTER_STATIC_POPULATOR(TB_FW, tbbr, fconf_populate_tbbr_dyn_config,
+				fconf_populate_tbbr_dyn_config_static);
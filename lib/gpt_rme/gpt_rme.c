@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, Arm Limited. All rights reserved.
+ * Copyright (c) 2022-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -15,10 +15,15 @@
 #include <arch_helpers.h>
 #include <common/debug.h>
 #include "gpt_rme_private.h"
+#include <lib/cache_maint/parallel_cache_maint.h>
+#include <lib/cassert.h>
+#include <lib/cohort_lock.h>
 #include <lib/gpt_rme/gpt_rme.h>
 #include <lib/smccc.h>
 #include <lib/spinlock.h>
+#include <lib/utils.h>
 #include <lib/xlat_tables/xlat_tables_v2.h>
+#include <plat/common/platform.h>
 
 #if !ENABLE_RME
 #error "ENABLE_RME must be enabled to use the GPT library"
@@ -129,16 +134,36 @@ static uintptr_t gpt_l1_tbl;
 /* These variable is used during runtime */
 #if (RME_GPT_BITLOCK_BLOCK == 0)
 /*
- * The GPTs are protected by a global spinlock to ensure
+ * The GPTs are protected by a global lock to ensure
  * that multiple CPUs do not attempt to change the descriptors at once.
  */
-static spinlock_t gpt_lock;
+static cohort_lock_t gpt_lock;
 #else
 
 /* Bitlocks base address */
 static bitlock_t *gpt_bitlock_base;
 #endif
 
+#if RME_GPT_LAZY_L1
+/*
+ * State of the on-demand allocation of L1 tables. It is kept in the L0 memory,
+ * after the L0 table and the bitlocks, so that it is passed on from the stage
+ * building the tables to the one running the granule transition service.
+ */
+typedef struct {
+	uint64_t next;		/* Address of the next free L1 table */
+	uint64_t end;		/* End of the memory available for L1 tables */
+	uint64_t used;		/* Size in bytes of the L1 tables in use */
+	uint64_t reserved;
+	uint64_t lazy[];	/* L0 regions which can get an L1 table */
+} gpt_l1_lazy_t;
+
+static gpt_l1_lazy_t *gpt_l1_lazy;
+
+/* Serialises the allocation of L1 tables at runtime */
+static spinlock_t gpt_l1_lazy_lock;
+#endif
+
 /* Lock/unlock macros for GPT entries */
 #if (RME_GPT_BITLOCK_BLOCK == 0)
 /*
@@ -146,8 +171,8 @@ static bitlock_t *gpt_bitlock_base;
  * that no more than one CPU is allowed to make changes at any
  * given time.
  */
-#define GPT_LOCK	spin_lock(&gpt_lock)
-#define GPT_UNLOCK	spin_unlock(&gpt_lock)
+#define GPT_LOCK	cohort_lock(&gpt_lock)
+#define GPT_UNLOCK	cohort_unlock(&gpt_lock)
 #else
 /*
  * Access to a block of memory is controlled by a bitlock.
@@ -157,6 +182,57 @@ static bitlock_t *gpt_bitlock_base;
 #define GPT_UNLOCK	bit_unlock(gpi_info.lock, gpi_info.mask)
 #endif
 
+/*
+ * Number of shatter and fuse operations per contiguous block size. The counters
+ * are kept per cpu as, with bitlocks, several cpus can update the GPT at once.
+ */
+typedef struct {
+	uint64_t shatter[GPT_BLOCK_LEVELS];
+	uint64_t fuse[GPT_BLOCK_LEVELS];
+} gpt_stats_t;
+
+static gpt_stats_t gpt_stats[PLATFORM_CORE_COUNT];
+
+#if RME_GPT_DEFER_FUSE
+/*
+ * Number of 2MB blocks which can wait to be fused, must be a power of two.
+ * When there is no room left the block is fused inline.
+ */
+#ifndef PLAT_RME_GPT_FUSE_PENDING
+#define PLAT_RME_GPT_FUSE_PENDING	U(64)
+#endif
+
+CASSERT(IS_POWER_OF_TWO(PLAT_RME_GPT_FUSE_PENDING),
+	assert_rme_gpt_fuse_pending_power_of_two);
+
+/* Number of slots looked at to record a 2MB block */
+#define GPT_FUSE_PROBES		U(4)
+
+/*
+ * Number of shards of the set of blocks waiting to be fused. A block goes to
+ * the shard of its 512MB region, the smallest bitlock block, so that cpus
+ * transitioning granules in different regions do not share a lock.
+ */
+#define GPT_FUSE_SHARDS							\
+	((PLAT_RME_GPT_FUSE_PENDING >= (U(8) * GPT_FUSE_PROBES)) ? U(8) : U(1))
+#define GPT_FUSE_SHARD_SLOTS	(PLAT_RME_GPT_FUSE_PENDING / GPT_FUSE_SHARDS)
+
+/* Marks a slot of a shard in use, the addresses are 2MB aligned */
+#define GPT_FUSE_PENDING_VALID	UL(1)
+
+/*
+ * Shard of the set of the 2MB blocks waiting to be fused, hashed on their
+ * address. The lock is never held while taking the GPT lock.
+ */
+typedef struct {
+	spinlock_t lock;
+	unsigned int cnt;
+	uint64_t pending[GPT_FUSE_SHARD_SLOTS];
+} __aligned(CACHE_WRITEBACK_GRANULE) gpt_fuse_shard_t;
+
+static gpt_fuse_shard_t gpt_fuse_shards[GPT_FUSE_SHARDS];
+#endif /* RME_GPT_DEFER_FUSE */
+
 static void tlbi_page_dsbosh(uintptr_t base)
 {
 	/* Look-up table for invalidation TLBs for 4KB, 16KB and 64KB pages */
@@ -490,6 +566,94 @@ static int validate_pas_mappings(pas_region_t *pas_regions,
 	return l1_cnt;
 }
 
+/*
+ * Size in bytes of the bitlocks kept after the L0 table, with
+ * RME_GPT_BITLOCK_BLOCK * 512MB per bitlock.
+ */
+static size_t get_locks_size(void)
+{
+	size_t locks_size = 0UL;
+
+#if (RME_GPT_BITLOCK_BLOCK != 0)
+	locks_size = GPT_PPS_ACTUAL_SIZE(gpt_config.t) /
+			(RME_GPT_BITLOCK_BLOCK * SZ_512M * 8U);
+
+	/*
+	 * If protected space size is less than the size covered
+	 * by 'bitlock' structure, check for a single bitlock.
+	 */
+	if (locks_size < LOCK_SIZE) {
+		locks_size = LOCK_SIZE;
+	}
+#endif
+	return locks_size;
+}
+
+#if RME_GPT_LAZY_L1
+/* Size in bytes of the L1 tables allocation state, one bit per L0 region */
+static size_t get_l1_lazy_size(void)
+{
+	return sizeof(gpt_l1_lazy_t) +
+		(round_up(GPT_L0_REGION_COUNT(gpt_config.t), 64UL) / 8UL);
+}
+
+/* The L1 tables allocation state follows the L0 table and the bitlocks */
+static gpt_l1_lazy_t *get_l1_lazy_base(uintptr_t l0_mem_base)
+{
+	return (gpt_l1_lazy_t *)round_up(l0_mem_base +
+					 GPT_L0_TABLE_SIZE(gpt_config.t) +
+					 get_locks_size(), sizeof(uint64_t));
+}
+
+/*
+ * Size in bytes of the data kept after the L0 table: the bitlocks and
+ * the L1 tables allocation state.
+ */
+static size_t get_l0_meta_size(void)
+{
+	return (size_t)round_up(GPT_L0_TABLE_SIZE(gpt_config.t) +
+				get_locks_size(), sizeof(uint64_t)) -
+		GPT_L0_TABLE_SIZE(gpt_config.t) + get_l1_lazy_size();
+}
+
+static bool is_l1_lazy(unsigned long l0_idx)
+{
+	return (gpt_l1_lazy->lazy[l0_idx / 64UL] &
+		(1UL << (l0_idx & 63UL))) != 0UL;
+}
+
+/*
+ * Number of L1 tables of granule mapped PAS regions that start as L0 block
+ * descriptors. These are the L0 regions a PAS fully covers, except for
+ * GPT_GPI_ANY ones which look unused to later calls to
+ * gpt_init_pas_l1_tables().
+ */
+static unsigned int count_l1_lazy(const pas_region_t *pas_regions,
+				  unsigned int pas_count)
+{
+	unsigned int cnt = 0U;
+
+	for (unsigned int idx = 0U; idx < pas_count; idx++) {
+		uintptr_t first, last;
+
+		if ((GPT_PAS_ATTR_MAP_TYPE(pas_regions[idx].attrs) !=
+		     GPT_PAS_ATTR_MAP_TYPE_GRANULE) ||
+		    (GPT_PAS_ATTR_GPI(pas_regions[idx].attrs) == GPT_GPI_ANY)) {
+			continue;
+		}
+
+		first = round_up(pas_regions[idx].base_pa, GPT_L0_REGION_SIZE);
+		last = round_down(pas_regions[idx].base_pa +
+				  pas_regions[idx].size, GPT_L0_REGION_SIZE);
+		if (last > first) {
+			cnt += (unsigned int)((last - first) >> GPT_L0_IDX_SHIFT);
+		}
+	}
+
+	return cnt;
+}
+#endif /* RME_GPT_LAZY_L1 */
+
 /*
  * This function validates L0 initialization parameters.
  *
@@ -503,7 +667,7 @@ static int validate_pas_mappings(pas_region_t *pas_regions,
 static int validate_l0_params(gpccr_pps_e pps, uintptr_t l0_mem_base,
 				size_t l0_mem_size)
 {
-	size_t l0_alignment, locks_size = 0;
+	size_t l0_alignment, meta_size;
 
 	/*
 	 * Make sure PPS is valid and then store it since macros need this value
@@ -529,27 +693,18 @@ static int validate_l0_params(gpccr_pps_e pps, uintptr_t l0_mem_base,
 		return -EFAULT;
 	}
 
-#if (RME_GPT_BITLOCK_BLOCK != 0)
-	/*
-	 * Size of bitlocks in bytes for the protected address space
-	 * with RME_GPT_BITLOCK_BLOCK * 512MB per bitlock.
-	 */
-	locks_size = GPT_PPS_ACTUAL_SIZE(gpt_config.t) /
-			(RME_GPT_BITLOCK_BLOCK * SZ_512M * 8U);
-
-	/*
-	 * If protected space size is less than the size covered
-	 * by 'bitlock' structure, check for a single bitlock.
-	 */
-	if (locks_size < LOCK_SIZE) {
-		locks_size = LOCK_SIZE;
-	}
+	/* Size of bitlocks and of the L1 tables allocation state */
+#if RME_GPT_LAZY_L1
+	meta_size = get_l0_meta_size();
+#else
+	meta_size = get_locks_size();
 #endif
+
 	/* Check size for L0 tables and bitlocks */
-	if (l0_mem_size < (GPT_L0_TABLE_SIZE(gpt_config.t) + locks_size)) {
+	if (l0_mem_size < (GPT_L0_TABLE_SIZE(gpt_config.t) + meta_size)) {
 		ERROR("GPT: Inadequate L0 memory\n");
 		ERROR("      Expected 0x%lx bytes, got 0x%lx bytes\n",
-			GPT_L0_TABLE_SIZE(gpt_config.t) + locks_size,
+			GPT_L0_TABLE_SIZE(gpt_config.t) + meta_size,
 			l0_mem_size);
 		return -ENOMEM;
 	}
@@ -948,6 +1103,23 @@ static void generate_l0_tbl_desc(pas_region_t *pas)
 	for (l0_idx = (unsigned int)GPT_L0_IDX(pas->base_pa);
 	     l0_idx <= (unsigned int)GPT_L0_IDX(end_pa - 1UL);
 	     l0_idx++) {
+#if RME_GPT_LAZY_L1
+		/*
+		 * A whole L0 region only gets its L1 table when one of its
+		 * granules is first transitioned, see count_l1_lazy().
+		 */
+		if ((gpi != GPT_GPI_ANY) && GPT_IS_L0_ALIGNED(cur_pa) &&
+		    ((end_pa - cur_pa) >= GPT_L0_REGION_SIZE)) {
+			l0_gpt_base[l0_idx] = GPT_L0_BLK_DESC(gpi);
+			gpt_l1_lazy->lazy[l0_idx / 64U] |= 1UL << (l0_idx & 63U);
+
+			VERBOSE("GPT: L0 entry (BLOCK) index %u [%p] ==> L1 deferred\n",
+				l0_idx, &l0_gpt_base[l0_idx]);
+
+			cur_pa += GPT_L0_REGION_SIZE;
+			continue;
+		}
+#endif
 		/*
 		 * See if the L0 entry is already a table descriptor or if we
 		 * need to create one.
@@ -1121,7 +1293,7 @@ int gpt_init_l0_tables(gpccr_pps_e pps, uintptr_t l0_mem_base,
 		       size_t l0_mem_size)
 {
 	uint64_t gpt_desc;
-	size_t locks_size = 0;
+	size_t meta_size;
 	__unused bitlock_t *bit_locks;
 	int ret;
 
@@ -1142,31 +1314,29 @@ int gpt_init_l0_tables(gpccr_pps_e pps, uintptr_t l0_mem_base,
 		((uint64_t *)l0_mem_base)[i] = gpt_desc;
 	}
 
+	/* Size of bitlocks in bytes */
+	meta_size = get_locks_size();
+
 #if (RME_GPT_BITLOCK_BLOCK != 0)
 	/* Initialise bitlocks at the end of L0 table */
 	bit_locks = (bitlock_t *)(l0_mem_base +
 					GPT_L0_TABLE_SIZE(gpt_config.t));
 
-	/* Size of bitlocks in bytes */
-	locks_size = GPT_PPS_ACTUAL_SIZE(gpt_config.t) /
-					(RME_GPT_BITLOCK_BLOCK * SZ_512M * 8U);
-
-	/*
-	 * If protected space size is less than the size covered
-	 * by 'bitlock' structure, initialise a single bitlock.
-	 */
-	if (locks_size < LOCK_SIZE) {
-		locks_size = LOCK_SIZE;
-	}
-
-	for (size_t i = 0UL; i < (locks_size/LOCK_SIZE); i++) {
+	for (size_t i = 0UL; i < (meta_size/LOCK_SIZE); i++) {
 		bit_locks[i].lock = 0U;
 	}
 #endif
 
+#if RME_GPT_LAZY_L1
+	/* Initialise the L1 tables allocation state after the bitlocks */
+	gpt_l1_lazy = get_l1_lazy_base(l0_mem_base);
+	zeromem(gpt_l1_lazy, get_l1_lazy_size());
+	meta_size = get_l0_meta_size();
+#endif
+
 	/* Flush updated L0 tables and bitlocks to memory */
 	flush_dcache_range((uintptr_t)l0_mem_base,
-				GPT_L0_TABLE_SIZE(gpt_config.t) + locks_size);
+				GPT_L0_TABLE_SIZE(gpt_config.t) + meta_size);
 
 	/* Stash the L0 base address once initial setup is complete */
 	gpt_config.plat_gpt_l0_base = l0_mem_base;
@@ -1200,6 +1370,7 @@ int gpt_init_pas_l1_tables(gpccr_pgs_e pgs, uintptr_t l1_mem_base,
 			   unsigned int pas_count)
 {
 	int l1_gpt_cnt, ret;
+	unsigned int l1_lazy_cnt = 0U;
 
 	/* Ensure that MMU and Data caches are enabled */
 	assert((read_sctlr_el3() & SCTLR_C_BIT) != 0U);
@@ -1224,10 +1395,17 @@ int gpt_init_pas_l1_tables(gpccr_pgs_e pgs, uintptr_t l1_mem_base,
 		return l1_gpt_cnt;
 	}
 
-	VERBOSE("GPT: %i L1 GPTs requested\n", l1_gpt_cnt);
+#if RME_GPT_LAZY_L1
+	/* Only the L1 tables which can not be deferred are allocated now */
+	l1_lazy_cnt = count_l1_lazy(pas_regions, pas_count);
+	l1_gpt_cnt -= (int)l1_lazy_cnt;
+#endif
+
+	VERBOSE("GPT: %i L1 GPTs requested, %u deferred\n", l1_gpt_cnt,
+		l1_lazy_cnt);
 
 	/* If L1 tables are needed then validate the L1 parameters */
-	if (l1_gpt_cnt > 0) {
+	if ((l1_gpt_cnt > 0) || (l1_lazy_cnt > 0U)) {
 		ret = validate_l1_params(l1_mem_base, l1_mem_size,
 					(unsigned int)l1_gpt_cnt);
 		if (ret != 0) {
@@ -1278,6 +1456,20 @@ int gpt_init_pas_l1_tables(gpccr_pgs_e pgs, uintptr_t l1_mem_base,
 				   (size_t)l1_gpt_cnt);
 	}
 
+#if RME_GPT_LAZY_L1
+	/* The deferred L1 tables are allocated from what is left */
+	if (l1_lazy_cnt > 0U) {
+		gpt_l1_lazy->next = gpt_l1_tbl;
+		gpt_l1_lazy->end = l1_mem_base + l1_mem_size;
+	}
+	gpt_l1_lazy->used += GPT_L1_TABLE_SIZE(gpt_config.p) *
+			     (uint64_t)l1_gpt_cnt;
+	flush_dcache_range((uintptr_t)gpt_l1_lazy, get_l1_lazy_size());
+
+	INFO("  L1 in use: 0x%"PRIx64" bytes, %u tables deferred\n",
+	     gpt_l1_lazy->used, l1_lazy_cnt);
+#endif
+
 	/* Make sure that all the entries are written to the memory */
 	dsbishst();
 	tlbipaallos();
@@ -1337,6 +1529,10 @@ int gpt_runtime_init(void)
 	/* Bitlocks at the end of L0 table */
 	gpt_bitlock_base = (bitlock_t *)(gpt_config.plat_gpt_l0_base +
 					GPT_L0_TABLE_SIZE(gpt_config.t));
+#endif
+#if RME_GPT_LAZY_L1
+	/* L1 tables allocation state after the bitlocks */
+	gpt_l1_lazy = get_l1_lazy_base(gpt_config.plat_gpt_l0_base);
 #endif
 	VERBOSE("GPT: Runtime Configuration\n");
 	VERBOSE("  PPS/T:     0x%x/%u\n", gpt_config.pps, gpt_config.t);
@@ -1345,6 +1541,10 @@ int gpt_runtime_init(void)
 	VERBOSE("  L0 base:   0x%"PRIxPTR"\n", gpt_config.plat_gpt_l0_base);
 #if (RME_GPT_BITLOCK_BLOCK != 0)
 	VERBOSE("  Bitlocks:  0x%"PRIxPTR"\n", (uintptr_t)gpt_bitlock_base);
+#endif
+#if RME_GPT_LAZY_L1
+	VERBOSE("  L1 in use: 0x%"PRIx64" bytes, 0x%"PRIx64" bytes left\n",
+		gpt_l1_lazy->used, gpt_l1_lazy->end - gpt_l1_lazy->next);
 #endif
 	return 0;
 }
@@ -1364,6 +1564,64 @@ static inline void write_gpt(uint64_t *gpt_l1_desc, uint64_t *gpt_l1_addr,
 	dsboshst();
 }
 
+#if RME_GPT_LAZY_L1
+/*
+ * Helper to replace the L0 block descriptor of the region of 'base' with a
+ * table descriptor, the first time a granule in it is transitioned. The new
+ * L1 table describes the same GPI as the block descriptor.
+ *
+ * Return
+ *   Negative Linux error code in the event of a failure, 0 for success.
+ */
+static int get_lazy_l1_tbl(uint64_t base)
+{
+	uint64_t *l0 = (uint64_t *)gpt_config.plat_gpt_l0_base;
+	unsigned long l0_idx = GPT_L0_IDX(base);
+	uint64_t l0_pa = base & ~(GPT_L0_REGION_SIZE - 1UL);
+	uint64_t *l1;
+	int ret = 0;
+
+	spin_lock(&gpt_l1_lazy_lock);
+
+	/* Another cpu may have allocated the table meanwhile */
+	if (GPT_L0_TYPE(l0[l0_idx]) == GPT_L0_TYPE_TBL_DESC) {
+		spin_unlock(&gpt_l1_lazy_lock);
+		return 0;
+	}
+
+	if ((gpt_l1_lazy->end - gpt_l1_lazy->next) <
+	    GPT_L1_TABLE_SIZE(gpt_config.p)) {
+		ERROR("GPT: No memory left for L1 table of L0[%lu]\n", l0_idx);
+		ret = -ENOMEM;
+	} else {
+		gpt_l1_tbl = gpt_l1_lazy->next;
+		l1 = get_new_l1_tbl();
+		gpt_l1_lazy->next = gpt_l1_tbl;
+		gpt_l1_lazy->used += GPT_L1_TABLE_SIZE(gpt_config.p);
+
+		fill_l1_tbl(l1, l0_pa, l0_pa + GPT_L0_REGION_SIZE -
+			    GPT_PGS_ACTUAL_SIZE(gpt_config.p),
+			    (unsigned int)GPT_L0_BLKD_GPI(l0[l0_idx]));
+
+		/* The L1 table must be complete before it is linked */
+		dsboshst();
+		l0[l0_idx] = GPT_L0_TBL_DESC(l1);
+		dsboshst();
+
+		/* The GPIs are unchanged, drop the cached block descriptor */
+		tlbipaallos();
+		dsbosh();
+
+		VERBOSE("GPT: L0 entry (TABLE) index %lu ==> L1 Addr %p\n",
+			l0_idx, l1);
+	}
+
+	spin_unlock(&gpt_l1_lazy_lock);
+
+	return ret;
+}
+#endif /* RME_GPT_LAZY_L1 */
+
 /*
  * Helper to retrieve the gpt_l1_* information from the base address
  * returned in gpi_info.
@@ -1375,6 +1633,18 @@ static int get_gpi_params(uint64_t base, gpi_info_t *gpi_info)
 
 	gpt_l0_base = (uint64_t *)gpt_config.plat_gpt_l0_base;
 	gpt_l0_desc = gpt_l0_base[GPT_L0_IDX(base)];
+
+#if RME_GPT_LAZY_L1
+	if ((GPT_L0_TYPE(gpt_l0_desc) != GPT_L0_TYPE_TBL_DESC) &&
+	    is_l1_lazy(GPT_L0_IDX(base))) {
+		int ret = get_lazy_l1_tbl(base);
+
+		if (ret != 0) {
+			return ret;
+		}
+		gpt_l0_desc = gpt_l0_base[GPT_L0_IDX(base)];
+	}
+#endif
 	if (GPT_L0_TYPE(gpt_l0_desc) != GPT_L0_TYPE_TBL_DESC) {
 		VERBOSE("GPT: Granule is not covered by a table descriptor!\n");
 		VERBOSE("      Base=0x%"PRIx64"\n", base);
@@ -1416,17 +1686,21 @@ static void read_gpi(gpi_info_t *gpi_info)
 	}
 }
 
-static void flush_page_to_popa(uintptr_t addr)
+static void flush_range_to_popa(uintptr_t addr, size_t size)
 {
-	size_t size = GPT_PGS_ACTUAL_SIZE(gpt_config.p);
-
 	if (is_feat_mte2_supported()) {
-		flush_dcache_to_popa_range_mte2(addr, size);
+		parallel_cache_maint(flush_dcache_to_popa_range_mte2,
+				     addr, size);
 	} else {
-		flush_dcache_to_popa_range(addr, size);
+		parallel_cache_maint(flush_dcache_to_popa_range, addr, size);
 	}
 }
 
+static void flush_page_to_popa(uintptr_t addr)
+{
+	flush_range_to_popa(addr, GPT_PGS_ACTUAL_SIZE(gpt_config.p));
+}
+
 /*
  * Helper function to check if all L1 entries in 2MB block have
  * the same Granules descriptor value.
@@ -1476,6 +1750,8 @@ __unused static void fuse_2mb(uint64_t base, const gpi_info_t *gpi_info,
 	VERBOSE("GPT: %s(0x%"PRIxPTR" 0x%"PRIx64")\n", __func__, base, l1_desc);
 
 	fill_desc(&gpi_info->gpt_l1_addr[idx_2], l1_cont_desc, L1_QWORDS_2MB);
+
+	gpt_stats[plat_my_core_pos()].fuse[GPT_BLOCK_2MB]++;
 }
 
 /*
@@ -1534,6 +1810,8 @@ __unused static void fuse_32mb(uint64_t base, const gpi_info_t *gpi_info,
 	VERBOSE("GPT: %s(0x%"PRIxPTR" 0x%"PRIx64")\n", __func__, base, l1_desc);
 
 	fill_desc(&gpi_info->gpt_l1_addr[idx_32], l1_cont_desc, L1_QWORDS_32MB);
+
+	gpt_stats[plat_my_core_pos()].fuse[GPT_BLOCK_32MB]++;
 }
 
 /*
@@ -1592,6 +1870,8 @@ __unused static void fuse_512mb(uint64_t base, const gpi_info_t *gpi_info,
 	VERBOSE("GPT: %s(0x%"PRIxPTR" 0x%"PRIx64")\n", __func__, base, l1_desc);
 
 	fill_desc(&gpi_info->gpt_l1_addr[idx_512], l1_cont_desc, L1_QWORDS_512MB);
+
+	gpt_stats[plat_my_core_pos()].fuse[GPT_BLOCK_512MB]++;
 }
 
 /*
@@ -1673,6 +1953,7 @@ __unused static void shatter_block(uint64_t base, gpi_info_t *gpi_info,
 
 	/* Shatter contiguous block */
 	gpt_shatter_lookup[level](base, gpi_info, l1_desc);
+	gpt_stats[plat_my_core_pos()].shatter[level]++;
 
 	tlbi_lookup[level].function(base & tlbi_lookup[level].mask);
 	dsbosh();
@@ -1684,12 +1965,69 @@ __unused static void shatter_block(uint64_t base, gpi_info_t *gpi_info,
 	gpi_info->gpt_l1_desc = l1_desc;
 }
 
+#if RME_GPT_DEFER_FUSE
+/*
+ * Helper to record that the 2MB block of 'base' can be fused.
+ *
+ * Return
+ *   true if the block is recorded, false if there was no room left for it.
+ */
+static bool defer_fuse(uint64_t base)
+{
+	gpt_fuse_shard_t *shard =
+		&gpt_fuse_shards[(base / SZ_512M) % GPT_FUSE_SHARDS];
+	uint64_t entry = ALIGN_2MB(base) | GPT_FUSE_PENDING_VALID;
+	unsigned int slot = (unsigned int)(base >> 21);
+	bool recorded = false;
+
+	spin_lock(&shard->lock);
+
+	for (unsigned int i = 0U; i < GPT_FUSE_PROBES; i++, slot++) {
+		slot &= GPT_FUSE_SHARD_SLOTS - 1U;
+
+		if (shard->pending[slot] == entry) {
+			recorded = true;
+			break;
+		}
+
+		if (shard->pending[slot] == 0UL) {
+			shard->pending[slot] = entry;
+			shard->cnt++;
+			recorded = true;
+			break;
+		}
+	}
+
+	spin_unlock(&shard->lock);
+
+	return recorded;
+}
+#endif /* RME_GPT_DEFER_FUSE */
+
+/*
+ * Helper to fuse the 2MB block of 'base' after a transition has left its L1
+ * entry with all GPIs set to the same value, or with RME_GPT_DEFER_FUSE to
+ * leave it to gpt_fuse_deferred(). This function is called with bitlock or
+ * spinlock acquired.
+ */
+__unused static void fuse_or_defer(uint64_t base, const gpi_info_t *gpi_info,
+				   uint64_t l1_desc)
+{
+#if RME_GPT_DEFER_FUSE
+	if (defer_fuse(base)) {
+		return;
+	}
+#endif
+	fuse_block(base, gpi_info, l1_desc);
+}
+
 /*
  * This function is the granule transition delegate service. When a granule
  * transition request occurs it is routed to this function to have the request,
  * if valid, fulfilled following A1.1.1 Delegate of RME supplement.
  *
- * TODO: implement support for transitioning multiple granules at once.
+ * Ranges of granules are transitioned with gpt_delegate_pas_range() and
+ * gpt_undelegate_pas_range().
  *
  * Parameters
  *   base		Base address of the region to transition, must be
@@ -1806,7 +2144,7 @@ int gpt_delegate_pas(uint64_t base, size_t size, unsigned int src_sec_state)
 #if (RME_GPT_MAX_BLOCK != 0)
 	if (gpi_info.gpt_l1_desc == l1_desc) {
 		/* Try to fuse */
-		fuse_block(base, &gpi_info, l1_desc);
+		fuse_or_defer(base, &gpi_info, l1_desc);
 	}
 #endif
 
@@ -1828,7 +2166,8 @@ int gpt_delegate_pas(uint64_t base, size_t size, unsigned int src_sec_state)
  * transition request occurs it is routed to this function where the request is
  * validated then fulfilled if possible.
  *
- * TODO: implement support for transitioning multiple granules at once.
+ * Ranges of granules are transitioned with gpt_delegate_pas_range() and
+ * gpt_undelegate_pas_range().
  *
  * Parameters
  *   base		Base address of the region to transition, must be
@@ -1945,7 +2284,7 @@ int gpt_undelegate_pas(uint64_t base, size_t size, unsigned int src_sec_state)
 #if (RME_GPT_MAX_BLOCK != 0)
 	if (gpi_info.gpt_l1_desc == GPT_L1_NS_DESC) {
 		/* Try to fuse */
-		fuse_block(base, &gpi_info, GPT_L1_NS_DESC);
+		fuse_or_defer(base, &gpi_info, GPT_L1_NS_DESC);
 	}
 #endif
 	/* Unlock the lock to GPT */
@@ -1960,3 +2299,605 @@ int gpt_undelegate_pas(uint64_t base, size_t size, unsigned int src_sec_state)
 
 	return 0;
 }
+
+/* Size in bytes of the region described by a Contiguous descriptor */
+static inline size_t cont_block_size(uint64_t l1_desc)
+{
+	return SZ_2M << (4UL * (GPT_L1_CONT_CONTIG(l1_desc) - 1UL));
+}
+
+/*
+ * Helper to get the end of a range transition chunk starting at 'base'. A
+ * chunk does not cross an L0 region, so that it is covered by a single L1
+ * table, nor a bitlock block, so that a single lock protects it.
+ */
+static uint64_t get_chunk_end(uint64_t base, uint64_t end)
+{
+	uint64_t limit = (base | (GPT_L0_REGION_SIZE - 1UL)) + 1UL;
+
+#if (RME_GPT_BITLOCK_BLOCK != 0)
+	uint64_t block_size = RME_GPT_BITLOCK_BLOCK * SZ_512M;
+
+	limit = MIN(limit, ((base / block_size) + 1UL) * block_size);
+#endif
+	return MIN(limit, end);
+}
+
+/*
+ * Helper to find the end of the run of granules starting at 'base' that are
+ * in the 'gpi' PAS. Whole L1 entries and Contiguous blocks are checked at
+ * once. This function is called with bitlock or spinlock acquired.
+ *
+ * Return
+ *   Address of the first granule in [base, end) not in the 'gpi' PAS, or 'end'.
+ */
+static uint64_t get_gpi_range_end(const gpi_info_t *gpi_info, uint64_t base,
+				  uint64_t end, unsigned int gpi)
+{
+	size_t l1_size = 1UL << GPT_L1_IDX_SHIFT(gpt_config.p);
+	uint64_t l1_gran_desc = build_l1_desc(gpi);
+	uint64_t pa = base;
+
+	while (pa < end) {
+		uint64_t l1_desc = gpi_info->gpt_l1_addr[GPT_L1_INDEX(pa)];
+		unsigned int gpi_shift;
+
+		if ((l1_desc & GPT_L1_TYPE_CONT_DESC_MASK) ==
+						GPT_L1_TYPE_CONT_DESC) {
+			if (GPT_L1_CONT_GPI(l1_desc) != gpi) {
+				break;
+			}
+			pa = (pa | (cont_block_size(l1_desc) - 1UL)) + 1UL;
+		} else if (l1_desc == l1_gran_desc) {
+			pa = (pa | (l1_size - 1UL)) + 1UL;
+		} else {
+			gpi_shift = GPT_L1_GPI_IDX(gpt_config.p, pa) << 2;
+			if (((l1_desc >> gpi_shift) & GPT_L1_GRAN_DESC_GPI_MASK) !=
+									gpi) {
+				break;
+			}
+			pa += GPT_PGS_ACTUAL_SIZE(gpt_config.p);
+		}
+	}
+
+	return MIN(pa, end);
+}
+
+/*
+ * Helper to shatter the Contiguous blocks that [base, end) only partially
+ * covers, so that the range can then be written with Granules descriptors.
+ * The blocks fully covered by the range are left as they are since they are
+ * entirely overwritten. This function is called with bitlock or spinlock
+ * acquired.
+ */
+__unused static void shatter_range(gpi_info_t *gpi_info, uint64_t base,
+				   uint64_t end, uint64_t l1_desc)
+{
+	size_t l1_size = 1UL << GPT_L1_IDX_SHIFT(gpt_config.p);
+	uint64_t pa = base;
+
+	while (pa < end) {
+		uint64_t blk_base;
+		size_t blk_size;
+
+		gpi_info->gpt_l1_desc = gpi_info->gpt_l1_addr[GPT_L1_INDEX(pa)];
+
+		if ((gpi_info->gpt_l1_desc & GPT_L1_TYPE_CONT_DESC_MASK) !=
+						GPT_L1_TYPE_CONT_DESC) {
+			pa = (pa | (l1_size - 1UL)) + 1UL;
+			continue;
+		}
+
+		blk_size = cont_block_size(gpi_info->gpt_l1_desc);
+		blk_base = pa & ~(blk_size - 1UL);
+		if ((blk_base >= base) && ((end - blk_base) >= blk_size)) {
+			pa = blk_base + blk_size;
+		} else {
+			/*
+			 * This turns the 2MB block of 'pa' into Granules, check
+			 * it again on the next iteration.
+			 */
+			shatter_block(pa, gpi_info, l1_desc);
+		}
+	}
+}
+
+/*
+ * Helper to set the GPI of all the granules in [base, end) to 'gpi'. The L1
+ * entries the range fully covers are written at once. This function is called
+ * with bitlock or spinlock acquired.
+ */
+static void write_gpt_range(const gpi_info_t *gpi_info, uint64_t base,
+			    uint64_t end, unsigned int gpi)
+{
+	size_t l1_size = 1UL << GPT_L1_IDX_SHIFT(gpt_config.p);
+	uint64_t l1_gran_desc = build_l1_desc(gpi);
+	uint64_t *l1 = gpi_info->gpt_l1_addr;
+	uint64_t pa = base;
+
+	while (pa < end) {
+		unsigned long idx = GPT_L1_INDEX(pa);
+		unsigned int gpi_shift;
+
+		if (((pa & (l1_size - 1UL)) == 0UL) && ((end - pa) >= l1_size)) {
+			l1[idx] = l1_gran_desc;
+			pa += l1_size;
+		} else {
+			gpi_shift = GPT_L1_GPI_IDX(gpt_config.p, pa) << 2;
+			l1[idx] &= ~(GPT_L1_GRAN_DESC_GPI_MASK << gpi_shift);
+			l1[idx] |= ((uint64_t)gpi << gpi_shift);
+			pa += GPT_PGS_ACTUAL_SIZE(gpt_config.p);
+		}
+	}
+
+	dsboshst();
+}
+
+/*
+ * Invalidate the TLB entries of [base, end) with the fewest TLBI RPALOS
+ * instructions, using the largest aligned range size that fits each time.
+ */
+static void tlbi_range_dsbosh(uint64_t base, uint64_t end)
+{
+	/* Look-up table for invalidation TLBs, from the largest size */
+	static const struct {
+		gpt_tlbi_func function;
+		size_t size;
+	} tlbi_range_lookup[] = {
+		{ tlbirpalos_512m, SZ_512M },
+		{ tlbirpalos_32m, SZ_32M },
+		{ tlbirpalos_2m, SZ_2M },
+		{ tlbirpalos_64k, SZ_64K },
+		{ tlbirpalos_16k, SZ_16K },
+		{ tlbirpalos_4k, SZ_4K }
+	};
+	size_t gran_size = GPT_PGS_ACTUAL_SIZE(gpt_config.p);
+
+	while (base < end) {
+		for (unsigned int i = 0U; i < ARRAY_SIZE(tlbi_range_lookup); i++) {
+			size_t size = tlbi_range_lookup[i].size;
+
+			/*
+			 * 'base' and 'end' are granule aligned so the range
+			 * size matching the granule size always fits.
+			 */
+			if ((size >= gran_size) &&
+			    ((base & (size - 1UL)) == 0UL) &&
+			    ((end - base) >= size)) {
+				tlbi_range_lookup[i].function(base);
+				base += size;
+				break;
+			}
+		}
+	}
+
+	dsbosh();
+}
+
+/*
+ * Helper to fuse every 2MB block [base, end) touches whose granules are all
+ * described by 'l1_desc', and then the larger blocks where possible. Range
+ * transitions already amortise this cost so it is never deferred. This
+ * function is called with bitlock or spinlock acquired.
+ */
+__unused static void fuse_range(const gpi_info_t *gpi_info, uint64_t base,
+				uint64_t end, uint64_t l1_desc)
+{
+	for (uint64_t pa = ALIGN_2MB(base); pa < end; pa += SZ_2M) {
+		fuse_block(pa, gpi_info, l1_desc);
+	}
+}
+
+/*
+ * Helper to check the arguments of a range transition request.
+ */
+static int validate_transition_range(uint64_t base, size_t size)
+{
+	/* Check that base and size are valid */
+	if ((ULONG_MAX - base) < size) {
+		VERBOSE("GPT: Transition request address overflow!\n");
+		VERBOSE("      Base=0x%"PRIx64"\n", base);
+		VERBOSE("      Size=0x%lx\n", size);
+		return -EINVAL;
+	}
+
+	/* Make sure base and size are valid */
+	if (((base & (GPT_PGS_ACTUAL_SIZE(gpt_config.p) - 1UL)) != 0UL) ||
+	    ((size & (GPT_PGS_ACTUAL_SIZE(gpt_config.p) - 1UL)) != 0UL) ||
+	    (size == 0UL) ||
+	    ((base + size) >= GPT_PPS_ACTUAL_SIZE(gpt_config.t))) {
+		VERBOSE("GPT: Invalid granule transition address range!\n");
+		VERBOSE("      Base=0x%"PRIx64"\n", base);
+		VERBOSE("      Size=0x%lx\n", size);
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+/*
+ * Delegate the run of NS granules starting at 'base' and ending at most at
+ * 'end', which must not cross a chunk boundary. The address following the
+ * last granule transitioned is returned in 'next'.
+ */
+static int delegate_pas_chunk(uint64_t base, uint64_t end,
+			      unsigned int src_sec_state, uint64_t *next)
+{
+	gpi_info_t gpi_info;
+	uint64_t nse, __unused l1_desc;
+	unsigned int target_pas;
+	int res;
+
+	if (src_sec_state == SMC_FROM_REALM) {
+		target_pas = GPT_GPI_REALM;
+		nse = (uint64_t)GPT_NSE_REALM << GPT_NSE_SHIFT;
+		l1_desc = GPT_L1_REALM_DESC;
+	} else {
+		target_pas = GPT_GPI_SECURE;
+		nse = (uint64_t)GPT_NSE_SECURE << GPT_NSE_SHIFT;
+		l1_desc = GPT_L1_SECURE_DESC;
+	}
+
+	res = get_gpi_params(base, &gpi_info);
+	if (res != 0) {
+		return res;
+	}
+
+	GPT_LOCK;
+
+	/* Only transition the granules in NS state */
+	end = get_gpi_range_end(&gpi_info, base, end, GPT_GPI_NS);
+	if (end == base) {
+		VERBOSE("GPT: Only Granule in NS state can be delegated.\n");
+		VERBOSE("      Caller: %u, Base: 0x%"PRIx64"\n", src_sec_state,
+			base);
+		GPT_UNLOCK;
+		return -EPERM;
+	}
+
+#if (RME_GPT_MAX_BLOCK != 0)
+	shatter_range(&gpi_info, base, end, GPT_L1_NS_DESC);
+#endif
+	/*
+	 * Remove any data speculatively fetched into the target physical
+	 * address space, see gpt_delegate_pas().
+	 */
+	flush_range_to_popa(base | nse, end - base);
+
+	write_gpt_range(&gpi_info, base, end, target_pas);
+
+	/* Ensure that all agents observe the new configuration */
+	tlbi_range_dsbosh(base, end);
+
+	nse = (uint64_t)GPT_NSE_NS << GPT_NSE_SHIFT;
+
+	/* Ensure that the scrubbed data have made it past the PoPA */
+	flush_range_to_popa(base | nse, end - base);
+
+#if (RME_GPT_MAX_BLOCK != 0)
+	fuse_range(&gpi_info, base, end, l1_desc);
+#endif
+
+	GPT_UNLOCK;
+
+	VERBOSE("GPT: Granules 0x%"PRIx64"-0x%"PRIx64" GPI 0x%x->0x%x\n",
+		base, end, GPT_GPI_NS, target_pas);
+
+	*next = end;
+	return 0;
+}
+
+/*
+ * This function delegates a range of granules at once. The range is handled
+ * in chunks which do not cross an L0 region or a bitlock block, the lock is
+ * held for the whole of each chunk. Within a chunk the GPT is updated in bulk
+ * and the caches are flushed and the TLBs invalidated once for the chunk
+ * rather than once per granule.
+ *
+ * Parameters
+ *   base		Base address of the region to transition, must be
+ *			aligned to granule size.
+ *   size		Size of region to transition, must be aligned to granule
+ *			size.
+ *   src_sec_state	Security state of the caller.
+ *   transitioned	Number of bytes from 'base' that have been delegated,
+ *			also on failure.
+ *
+ * Return
+ *   Negative Linux error code in the event of a failure, 0 for success.
+ */
+int gpt_delegate_pas_range(uint64_t base, size_t size,
+			   unsigned int src_sec_state, size_t *transitioned)
+{
+	uint64_t cur = base;
+	int res;
+
+	/* Ensure that the tables have been set up before taking requests */
+	assert(gpt_config.plat_gpt_l0_base != 0UL);
+
+	/* Ensure that caches are enabled */
+	assert((read_sctlr_el3() & SCTLR_C_BIT) != 0UL);
+
+	*transitioned = 0UL;
+
+	res = validate_transition_range(base, size);
+	if (res != 0) {
+		return res;
+	}
+
+	/* Delegate request can only come from REALM or SECURE */
+	if ((src_sec_state != SMC_FROM_REALM) &&
+	    (src_sec_state != SMC_FROM_SECURE)) {
+		VERBOSE("GPT: Invalid caller security state 0x%x\n",
+							src_sec_state);
+		return -EINVAL;
+	}
+
+	while (cur < (base + size)) {
+		res = delegate_pas_chunk(cur, get_chunk_end(cur, base + size),
+					 src_sec_state, &cur);
+		if (res != 0) {
+			break;
+		}
+	}
+
+	/*
+	 * The isb() will be done as part of context
+	 * synchronization when returning to lower EL.
+	 */
+	*transitioned = cur - base;
+	return res;
+}
+
+/*
+ * Undelegate the run of granules in the 'l1_desc' PAS starting at 'base' and
+ * ending at most at 'end', which must not cross a chunk boundary. The address
+ * following the last granule transitioned is returned in 'next'.
+ */
+static int undelegate_pas_chunk(uint64_t base, uint64_t end,
+				unsigned int src_sec_state, uint64_t *next)
+{
+	gpi_info_t gpi_info;
+	uint64_t nse, __unused l1_desc;
+	unsigned int src_pas;
+	int res;
+
+	if (src_sec_state == SMC_FROM_REALM) {
+		src_pas = GPT_GPI_REALM;
+		nse = (uint64_t)GPT_NSE_REALM << GPT_NSE_SHIFT;
+		l1_desc = GPT_L1_REALM_DESC;
+	} else {
+		src_pas = GPT_GPI_SECURE;
+		nse = (uint64_t)GPT_NSE_SECURE << GPT_NSE_SHIFT;
+		l1_desc = GPT_L1_SECURE_DESC;
+	}
+
+	res = get_gpi_params(base, &gpi_info);
+	if (res != 0) {
+		return res;
+	}
+
+	GPT_LOCK;
+
+	/* Only transition the granules in the caller's state */
+	end = get_gpi_range_end(&gpi_info, base, end, src_pas);
+	if (end == base) {
+		VERBOSE("GPT: Only Granule in REALM or SECURE state can be undelegated\n");
+		VERBOSE("      Caller: %u, Base: 0x%"PRIx64"\n", src_sec_state,
+			base);
+		GPT_UNLOCK;
+		return -EPERM;
+	}
+
+#if (RME_GPT_MAX_BLOCK != 0)
+	shatter_range(&gpi_info, base, end, l1_desc);
+#endif
+	/*
+	 * Remove access first so that writes to the currently-accessible
+	 * physical address space can not later become observable, see
+	 * gpt_undelegate_pas().
+	 */
+	write_gpt_range(&gpi_info, base, end, GPT_GPI_NO_ACCESS);
+
+	/* Ensure that all agents observe the new NO_ACCESS configuration */
+	tlbi_range_dsbosh(base, end);
+
+	/* Ensure that the scrubbed data have made it past the PoPA */
+	flush_range_to_popa(base | nse, end - base);
+
+	/*
+	 * Remove any data loaded speculatively in NS space from before
+	 * the scrubbing.
+	 */
+	nse = (uint64_t)GPT_NSE_NS << GPT_NSE_SHIFT;
+
+	flush_range_to_popa(base | nse, end - base);
+
+	write_gpt_range(&gpi_info, base, end, GPT_GPI_NS);
+
+	/* Ensure that all agents observe the new NS configuration */
+	tlbi_range_dsbosh(base, end);
+
+#if (RME_GPT_MAX_BLOCK != 0)
+	fuse_range(&gpi_info, base, end, GPT_L1_NS_DESC);
+#endif
+
+	GPT_UNLOCK;
+
+	VERBOSE("GPT: Granules 0x%"PRIx64"-0x%"PRIx64" GPI 0x%x->0x%x\n",
+		base, end, src_pas, GPT_GPI_NS);
+
+	*next = end;
+	return 0;
+}
+
+/*
+ * This function undelegates a range of granules at once, in the same chunks
+ * as gpt_delegate_pas_range().
+ *
+ * Parameters
+ *   base		Base address of the region to transition, must be
+ *			aligned to granule size.
+ *   size		Size of region to transition, must be aligned to granule
+ *			size.
+ *   src_sec_state	Security state of the caller.
+ *   transitioned	Number of bytes from 'base' that have been undelegated,
+ *			also on failure.
+ *
+ * Return
+ *   Negative Linux error code in the event of a failure, 0 for success.
+ */
+int gpt_undelegate_pas_range(uint64_t base, size_t size,
+			     unsigned int src_sec_state, size_t *transitioned)
+{
+	uint64_t cur = base;
+	int res;
+
+	/* Ensure that the tables have been set up before taking requests */
+	assert(gpt_config.plat_gpt_l0_base != 0UL);
+
+	/* Ensure that MMU and caches are enabled */
+	assert((read_sctlr_el3() & SCTLR_C_BIT) != 0UL);
+
+	*transitioned = 0UL;
+
+	res = validate_transition_range(base, size);
+	if (res != 0) {
+		return res;
+	}
+
+	/* Only REALM or SECURE granules can be undelegated by their owner */
+	if ((src_sec_state != SMC_FROM_REALM) &&
+	    (src_sec_state != SMC_FROM_SECURE)) {
+		VERBOSE("GPT: Only Granule in REALM or SECURE state can be undelegated\n");
+		return -EPERM;
+	}
+
+	while (cur < (base + size)) {
+		res = undelegate_pas_chunk(cur, get_chunk_end(cur, base + size),
+					   src_sec_state, &cur);
+		if (res != 0) {
+			break;
+		}
+	}
+
+	/*
+	 * The isb() will be done as part of context
+	 * synchronization when returning to lower EL.
+	 */
+	*transitioned = cur - base;
+	return res;
+}
+
+/*
+ * Fuse up to 'max' of the 2MB blocks whose fusing has been deferred, all of
+ * them if 'max' is 0. This is meant to be called when the system is idle,
+ * away from the granule transition path. Without RME_GPT_DEFER_FUSE there is
+ * nothing to do.
+ *
+ * Return
+ *   Number of 2MB blocks still waiting to be fused.
+ */
+unsigned int gpt_fuse_deferred(unsigned int max)
+{
+#if RME_GPT_DEFER_FUSE
+	unsigned int done = 0U;
+	unsigned int left = 0U;
+
+	for (unsigned int i = 0U; i < PLAT_RME_GPT_FUSE_PENDING; i++) {
+		gpt_fuse_shard_t *shard =
+			&gpt_fuse_shards[i / GPT_FUSE_SHARD_SLOTS];
+		unsigned int slot = i % GPT_FUSE_SHARD_SLOTS;
+		gpi_info_t gpi_info;
+		uint64_t base, l1_desc;
+
+		if ((max != 0U) && (done == max)) {
+			break;
+		}
+
+		spin_lock(&shard->lock);
+		base = shard->pending[slot];
+		if (base != 0UL) {
+			shard->pending[slot] = 0UL;
+			shard->cnt--;
+		}
+		spin_unlock(&shard->lock);
+
+		if (base == 0UL) {
+			continue;
+		}
+
+		base &= ~GPT_FUSE_PENDING_VALID;
+		done++;
+
+		if (get_gpi_params(base, &gpi_info) != 0) {
+			continue;
+		}
+
+		GPT_LOCK;
+
+		/*
+		 * The block may have been fused or changed since it was
+		 * recorded, only fuse it if its first L1 entry still has all
+		 * GPIs set to the same value.
+		 */
+		l1_desc = gpi_info.gpt_l1_addr[gpi_info.idx];
+		if (((l1_desc & GPT_L1_TYPE_CONT_DESC_MASK) !=
+						GPT_L1_TYPE_CONT_DESC) &&
+		    (l1_desc == build_l1_desc(
+				(unsigned int)GPT_L1_GRAN_GPI(l1_desc)))) {
+			fuse_block(base, &gpi_info, l1_desc);
+		}
+
+		GPT_UNLOCK;
+	}
+
+	for (unsigned int i = 0U; i < GPT_FUSE_SHARDS; i++) {
+		spin_lock(&gpt_fuse_shards[i].lock);
+		left += gpt_fuse_shards[i].cnt;
+		spin_unlock(&gpt_fuse_shards[i].lock);
+	}
+
+	return left;
+#else
+	return 0U;
+#endif /* RME_GPT_DEFER_FUSE */
+}
+
+/*
+ * Get the number of shatter and fuse operations done on the 'level'
+ * contiguous block size, one of GPT_BLOCK_*, summed over all cpus.
+ *
+ * Return
+ *   Negative Linux error code in the event of a failure, 0 for success.
+ */
+int gpt_get_fuse_stats(unsigned int level, uint64_t *shatter, uint64_t *fuse)
+{
+	if (level >= GPT_BLOCK_LEVELS) {
+		return -EINVAL;
+	}
+
+	*shatter = 0UL;
+	*fuse = 0UL;
+
+	for (unsigned int i = 0U; i < PLATFORM_CORE_COUNT; i++) {
+		*shatter += gpt_stats[i].shatter[level];
+		*fuse += gpt_stats[i].fuse[level];
+	}
+
+	return 0;
+}
+
+#if RME_GPT_LAZY_L1
+/*
+ * Get the size in bytes of the L1 tables in use and of the memory left for
+ * the L1 tables still to be allocated.
+ */
+void gpt_get_l1_usage(size_t *used, size_t *left)
+{
+	spin_lock(&gpt_l1_lazy_lock);
+	*used = (size_t)gpt_l1_lazy->used;
+	*left = (size_t)(gpt_l1_lazy->end - gpt_l1_lazy->next);
+	spin_unlock(&gpt_l1_lazy_lock);
+}
+#endif /* RME_GPT_LAZY_L1 */
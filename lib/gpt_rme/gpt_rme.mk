@@ -1,5 +1,5 @@
 #
-# Copyright (c) 2021-2024, Arm Limited. All rights reserved.
+# Copyright (c) 2021-2026, Arm Limited. All rights reserved.
 #
 # SPDX-License-Identifier: BSD-3-Clause
 #
@@ -18,5 +18,15 @@ ifeq ($(filter 0 2 32 512, ${RME_GPT_MAX_BLOCK}),)
     $(error "Invalid value for RME_GPT_MAX_BLOCK: ${RME_GPT_MAX_BLOCK}")
 endif
 
+ifeq (${RME_GPT_DEFER_FUSE},1)
+    ifeq (${RME_GPT_MAX_BLOCK},0)
+        $(error "RME_GPT_DEFER_FUSE requires RME_GPT_MAX_BLOCK to be non-zero")
+    endif
+endif
+
 GPT_LIB_SRCS	:=	$(addprefix lib/gpt_rme/,        \
 			gpt_rme.c)
+
+ifeq (${COHORT_LOCKS},1)
+GPT_LIB_SRCS	+=	lib/locks/cohort/cohort_lock.c
+endif
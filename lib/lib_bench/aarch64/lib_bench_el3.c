@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <arch.h>
+#include <arch_features.h>
+#include <arch_helpers.h>
+#include <lib/lib_bench.h>
+
+/* PMU state of the caller, given back once the suite is done */
+static u_register_t saved_mdcr_el3;
+static u_register_t saved_pmcr_el0;
+static u_register_t saved_pmccfiltr_el0;
+static u_register_t saved_pmcnten_el0;
+static u_register_t saved_pmccntr_el0;
+static bool use_pmu;
+
+static bool lib_bench_has_pmu(void)
+{
+	unsigned int ver = (unsigned int)((read_id_aa64dfr0_el1() >>
+			ID_AA64DFR0_PMUVER_SHIFT) & ID_AA64DFR0_PMUVER_MASK);
+
+	return (ver != 0U) && (ver != ID_AA64DFR0_PMUVER_IMP_DEF);
+}
+
+/*
+ * Count the cycles spent at EL3 with PMCCNTR_EL0. EL3 normally prohibits
+ * cycle counting in Secure state and at EL3 through MDCR_EL3.SCCD and MCCD,
+ * which are cleared while the suite runs.
+ */
+static int lib_bench_el3_start(void)
+{
+	use_pmu = lib_bench_has_pmu();
+	if (!use_pmu) {
+		lib_bench_el3_counter.unit = "ticks";
+		return 0;
+	}
+
+	saved_mdcr_el3 = read_mdcr_el3();
+	saved_pmcr_el0 = read_pmcr_el0();
+	saved_pmccfiltr_el0 = read_pmccfiltr_el0();
+	saved_pmcnten_el0 = read_pmcntenset_el0();
+	saved_pmccntr_el0 = read_pmccntr_el0();
+
+	write_mdcr_el3(saved_mdcr_el3 & ~(MDCR_SCCD_BIT | MDCR_MCCD_BIT));
+	/* Count at all Exception levels, in both Security states */
+	write_pmccfiltr_el0(0U);
+	write_pmcr_el0((saved_pmcr_el0 | PMCR_EL0_E_BIT | PMCR_EL0_LC_BIT) &
+		       ~(PMCR_EL0_DP_BIT | PMCR_EL0_D_BIT));
+	write_pmcntenset_el0(PMCNTEN_EL0_C_BIT);
+	isb();
+
+	return 0;
+}
+
+static uint64_t lib_bench_el3_read(void)
+{
+	isb();
+
+	return use_pmu ? read_pmccntr_el0() : read_cntpct_el0();
+}
+
+static void lib_bench_el3_stop(void)
+{
+	if (!use_pmu) {
+		return;
+	}
+
+	if ((saved_pmcnten_el0 & PMCNTEN_EL0_C_BIT) == 0U) {
+		write_pmcntenclr_el0(PMCNTEN_EL0_C_BIT);
+	}
+	write_pmccntr_el0(saved_pmccntr_el0);
+	write_pmcr_el0(saved_pmcr_el0);
+	write_pmccfiltr_el0(saved_pmccfiltr_el0);
+	write_mdcr_el3(saved_mdcr_el3);
+	isb();
+}
+
+lib_bench_counter_t lib_bench_el3_counter = {
+	.unit = "cycles",
+	.start = lib_bench_el3_start,
+	.read = lib_bench_el3_read,
+	.stop = lib_bench_el3_stop,
+};
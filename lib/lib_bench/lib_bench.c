@@ -0,0 +1,637 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <common/tf_crc32.h>
+#include <lib/lib_bench.h>
+#include <lib/utils_def.h>
+#include <libfdt.h>
+#include <tf_gunzip.h>
+
+/* Each measurement processes at least this many bytes, and is repeated */
+#define BENCH_MIN_BYTES		(64U * 1024U)
+#define BENCH_MIN_REPS		4U
+#define BENCH_RUNS		3U
+
+/* Number of calls each libfdt measurement is made of */
+#define BENCH_FDT_REPS		256U
+#define BENCH_FDT_SIZE		4096
+
+/* Offset between the source and destination of the overlapping moves */
+#define BENCH_MOVE_DIST		16U
+
+/* Misalignment of the destination and source of the string functions */
+static const struct {
+	uint8_t dst;
+	uint8_t src;
+} bench_align[] = {
+	{ 0U, 0U },
+	{ 0U, 1U },
+	{ 3U, 0U },
+	{ 5U, 11U },
+};
+
+typedef enum {
+	BENCH_MEMCPY,
+	BENCH_MEMMOVE_DOWN,
+	BENCH_MEMMOVE_UP,
+	BENCH_MEMSET,
+	BENCH_MEMCMP,
+	BENCH_STRCMP,
+	BENCH_STRLEN,
+	BENCH_CRC32,
+} bench_op_t;
+
+static const char *const bench_op_names[] = {
+	[BENCH_MEMCPY] = "memcpy",
+	[BENCH_MEMMOVE_DOWN] = "memmove<",
+	[BENCH_MEMMOVE_UP] = "memmove>",
+	[BENCH_MEMSET] = "memset",
+	[BENCH_MEMCMP] = "memcmp",
+	[BENCH_STRCMP] = "strcmp",
+	[BENCH_STRLEN] = "strlen",
+	[BENCH_CRC32] = "crc32",
+};
+
+static const lib_bench_counter_t *counter;
+
+/* Keeps the results of the functions that only return a value alive */
+static volatile uintptr_t bench_sink;
+
+static unsigned int bench_reps(size_t size)
+{
+	return MAX((unsigned int)(BENCH_MIN_BYTES / size), BENCH_MIN_REPS);
+}
+
+/*
+ * Time 'reps' calls of 'op', the best of BENCH_RUNS runs. The arguments are
+ * read back from volatile copies so that the calls of the functions declared
+ * pure are not hoisted out of the loops.
+ */
+static uint64_t bench_time(bench_op_t op, char *dst, char *src, size_t size,
+			   unsigned int reps)
+{
+	char *volatile vdst = dst;
+	char *volatile vsrc = src;
+	uint64_t start, count, best = UINT64_MAX;
+	uintptr_t acc = 0U;
+	unsigned int run, i;
+
+	for (run = 0U; run < BENCH_RUNS; run++) {
+		start = counter->read();
+
+		switch (op) {
+		case BENCH_MEMCPY:
+			for (i = 0U; i < reps; i++) {
+				(void)memcpy(vdst, vsrc, size);
+			}
+			break;
+		case BENCH_MEMMOVE_DOWN:
+			for (i = 0U; i < reps; i++) {
+				(void)memmove(vdst, vdst + BENCH_MOVE_DIST, size);
+			}
+			break;
+		case BENCH_MEMMOVE_UP:
+			for (i = 0U; i < reps; i++) {
+				(void)memmove(vdst + BENCH_MOVE_DIST, vdst, size);
+			}
+			break;
+		case BENCH_MEMSET:
+			for (i = 0U; i < reps; i++) {
+				(void)memset(vdst, 0x5a, size);
+			}
+			break;
+		case BENCH_MEMCMP:
+			for (i = 0U; i < reps; i++) {
+				acc += (uintptr_t)memcmp(vdst, vsrc, size);
+			}
+			break;
+		case BENCH_STRCMP:
+			for (i = 0U; i < reps; i++) {
+				acc += (uintptr_t)strcmp(vdst, vsrc);
+			}
+			break;
+		case BENCH_STRLEN:
+			for (i = 0U; i < reps; i++) {
+				acc += strlen(vsrc);
+			}
+			break;
+		case BENCH_CRC32:
+			for (i = 0U; i < reps; i++) {
+				acc += tf_crc32(0U, (const unsigned char *)vsrc,
+						size);
+			}
+			break;
+		default:
+			break;
+		}
+
+		count = counter->read() - start;
+		best = MIN(best, count);
+	}
+
+	bench_sink = acc;
+
+	return best;
+}
+
+/* printf has no field width for strings */
+static void bench_print_name(const char *name, size_t width)
+{
+	size_t len = strlen(name);
+
+	printf("%s", name);
+	while (len++ < width) {
+		(void)putchar(' ');
+	}
+}
+
+/* Print the cost per byte, with two decimals as printf has no floats */
+static void bench_report_bytes(uint64_t count, uint64_t bytes)
+{
+	uint64_t per_100 = (count * 100U) / bytes;
+
+	printf("%6llu.%02llu %s/B\n", (unsigned long long)(per_100 / 100U),
+	       (unsigned long long)(per_100 % 100U), counter->unit);
+}
+
+static void bench_fill(char *buf, size_t len)
+{
+	size_t i;
+
+	/* Never a NUL, so that the strings end where they are terminated */
+	for (i = 0U; i < len; i++) {
+		buf[i] = (char)('a' + (i % 23U));
+	}
+}
+
+static void bench_string(char *src, char *dst)
+{
+	unsigned int reps, a;
+	char *s, *d;
+	size_t size;
+
+	printf("\nfunction    size dst src\n");
+
+	for (size = 16U; size <= LIB_BENCH_MAX_SIZE; size *= 4U) {
+		reps = bench_reps(size);
+
+		for (a = 0U; a < ARRAY_SIZE(bench_align); a++) {
+			s = src + bench_align[a].src;
+			d = dst + bench_align[a].dst;
+
+			bench_fill(src, LIB_BENCH_MAX_SIZE + LIB_BENCH_SLACK);
+
+#define BENCH_STRING(op, ...)						\
+			bench_print_name(bench_op_names[op], 9U);	\
+			printf("%6zu %3u %3u ", size, bench_align[a].dst,	\
+			       bench_align[a].src);			\
+			bench_report_bytes(bench_time(op, __VA_ARGS__,	\
+						      size, reps),	\
+					   (uint64_t)size * reps)
+
+			BENCH_STRING(BENCH_MEMCPY, d, s);
+			/* The destination now holds a copy of the source */
+			BENCH_STRING(BENCH_MEMCMP, d, s);
+
+			s[size - 1U] = '\0';
+			d[size - 1U] = '\0';
+			BENCH_STRING(BENCH_STRCMP, d, s);
+			BENCH_STRING(BENCH_STRLEN, d, s);
+
+			BENCH_STRING(BENCH_MEMMOVE_DOWN, d, s);
+			BENCH_STRING(BENCH_MEMMOVE_UP, d, s);
+			BENCH_STRING(BENCH_MEMSET, d, s);
+			BENCH_STRING(BENCH_CRC32, d, s);
+#undef BENCH_STRING
+		}
+	}
+}
+
+/* A device tree shaped like the ones platforms pass to BL31 */
+static int bench_fdt_build(void *fdt)
+{
+	char name[32];
+	unsigned int i;
+	int err;
+
+	err = fdt_create(fdt, BENCH_FDT_SIZE);
+	err |= fdt_finish_reservemap(fdt);
+	err |= fdt_begin_node(fdt, "");
+	err |= fdt_property_string(fdt, "compatible", "arm,vexpress");
+	err |= fdt_property_u32(fdt, "#address-cells", 2U);
+	err |= fdt_property_u32(fdt, "#size-cells", 2U);
+
+	err |= fdt_begin_node(fdt, "cpus");
+	err |= fdt_property_u32(fdt, "#address-cells", 1U);
+	err |= fdt_property_u32(fdt, "#size-cells", 0U);
+	for (i = 0U; i < 8U; i++) {
+		(void)snprintf(name, sizeof(name), "cpu@%x", i << 8);
+		err |= fdt_begin_node(fdt, name);
+		err |= fdt_property_string(fdt, "device_type", "cpu");
+		err |= fdt_property_string(fdt, "compatible", "arm,armv8");
+		err |= fdt_property_u32(fdt, "reg", i << 8);
+		err |= fdt_property_string(fdt, "enable-method", "psci");
+		err |= fdt_end_node(fdt);
+	}
+	err |= fdt_end_node(fdt);
+
+	err |= fdt_begin_node(fdt, "memory@80000000");
+	err |= fdt_property_string(fdt, "device_type", "memory");
+	err |= fdt_property_u64(fdt, "reg", 0x80000000ULL);
+	err |= fdt_end_node(fdt);
+
+	err |= fdt_begin_node(fdt, "soc");
+	err |= fdt_property_string(fdt, "compatible", "simple-bus");
+	err |= fdt_property(fdt, "ranges", NULL, 0);
+	for (i = 0U; i < 4U; i++) {
+		(void)snprintf(name, sizeof(name), "uart@%x",
+			       0x1c090000U + (i << 16));
+		err |= fdt_begin_node(fdt, name);
+		err |= fdt_property_string(fdt, "compatible", "arm,pl011");
+		err |= fdt_property_u32(fdt, "reg", 0x1c090000U + (i << 16));
+		err |= fdt_property_u32(fdt, "interrupts", 5U + i);
+		err |= fdt_property_string(fdt, "clock-names", "uartclk");
+		err |= fdt_property_string(fdt, "status", "okay");
+		err |= fdt_end_node(fdt);
+	}
+	err |= fdt_end_node(fdt);
+
+	err |= fdt_begin_node(fdt, "chosen");
+	err |= fdt_property_string(fdt, "stdout-path", "/soc/uart@1c090000");
+	err |= fdt_end_node(fdt);
+
+	err |= fdt_end_node(fdt);
+	err |= fdt_finish(fdt);
+
+	return (err == 0) ? 0 : -EINVAL;
+}
+
+static void bench_report_call(const char *name, const char *arg,
+			      uint64_t count, unsigned int calls)
+{
+	char call[64];
+
+	(void)snprintf(call, sizeof(call), "%s(%s)", name, arg);
+	bench_print_name(call, 36U);
+	printf("%6llu %s/call\n", (unsigned long long)(count / calls),
+	       counter->unit);
+}
+
+static int bench_fdt(void *fdt)
+{
+	static const char *const paths[] = {
+		"/chosen",
+		"/cpus/cpu@700",
+		"/soc/uart@1c0c0000",
+	};
+	static const char *const props[] = {
+		"compatible",
+		"status",
+	};
+	uint64_t start, count;
+	uintptr_t acc = 0U;
+	unsigned int p, i;
+	int node;
+
+	if (bench_fdt_build(fdt) != 0) {
+		return -EINVAL;
+	}
+
+	printf("\nlibfdt, %u byte tree\n", fdt_totalsize(fdt));
+
+	for (p = 0U; p < ARRAY_SIZE(paths); p++) {
+		start = counter->read();
+		for (i = 0U; i < BENCH_FDT_REPS; i++) {
+			acc += (uintptr_t)fdt_path_offset(fdt, paths[p]);
+		}
+		count = counter->read() - start;
+		bench_report_call("fdt_path_offset", paths[p], count,
+				  BENCH_FDT_REPS);
+	}
+
+	node = fdt_path_offset(fdt, paths[ARRAY_SIZE(paths) - 1U]);
+	if (node < 0) {
+		return -EINVAL;
+	}
+
+	/* The first and the last property of the node */
+	for (p = 0U; p < ARRAY_SIZE(props); p++) {
+		start = counter->read();
+		for (i = 0U; i < BENCH_FDT_REPS; i++) {
+			acc += (uintptr_t)fdt_getprop(fdt, node, props[p],
+						      NULL);
+		}
+		count = counter->read() - start;
+		bench_report_call("fdt_getprop", props[p], count,
+				  BENCH_FDT_REPS);
+	}
+
+	bench_sink = acc;
+
+	return 0;
+}
+
+/*
+ * Minimal deflate encoder, greedy matches and the fixed Huffman codes of
+ * RFC 1951, to produce the gzip input of inflate without zlib's encoder,
+ * which TF-A does not carry.
+ */
+#define DEFLATE_HASH_BITS	12U
+#define DEFLATE_NO_POS		UINT32_MAX
+#define DEFLATE_MAX_DIST	32768U
+#define DEFLATE_MIN_MATCH	3U
+#define DEFLATE_MAX_MATCH	258U
+
+static const uint16_t deflate_len_base[] = {
+	3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+	35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258,
+};
+
+static const uint8_t deflate_len_extra[] = {
+	0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+	3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0,
+};
+
+static const uint16_t deflate_dist_base[] = {
+	1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+	257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289,
+	16385, 24577,
+};
+
+static const uint8_t deflate_dist_extra[] = {
+	0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+	7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13,
+};
+
+typedef struct {
+	uint8_t *out;
+	size_t pos;
+	size_t len;
+	uint32_t bits;
+	unsigned int nbits;
+} bench_bits_t;
+
+static void put_bits(bench_bits_t *bs, uint32_t val, unsigned int n)
+{
+	bs->bits |= val << bs->nbits;
+	bs->nbits += n;
+
+	while (bs->nbits >= 8U) {
+		if (bs->pos < bs->len) {
+			bs->out[bs->pos] = (uint8_t)bs->bits;
+		}
+		bs->pos++;
+		bs->bits >>= 8;
+		bs->nbits -= 8U;
+	}
+}
+
+/* Huffman codes are packed starting from their most significant bit */
+static void put_code(bench_bits_t *bs, uint32_t code, unsigned int n)
+{
+	uint32_t rev = 0U;
+	unsigned int i;
+
+	for (i = 0U; i < n; i++) {
+		rev = (rev << 1) | ((code >> i) & 1U);
+	}
+
+	put_bits(bs, rev, n);
+}
+
+static void put_litlen(bench_bits_t *bs, unsigned int sym)
+{
+	if (sym < 144U) {
+		put_code(bs, 0x30U + sym, 8U);
+	} else if (sym < 256U) {
+		put_code(bs, 0x190U + sym - 144U, 9U);
+	} else if (sym < 280U) {
+		put_code(bs, sym - 256U, 7U);
+	} else {
+		put_code(bs, 0xc0U + sym - 280U, 8U);
+	}
+}
+
+static void put_match(bench_bits_t *bs, unsigned int len, unsigned int dist)
+{
+	unsigned int i = ARRAY_SIZE(deflate_len_base) - 1U;
+
+	while (deflate_len_base[i] > len) {
+		i--;
+	}
+	put_litlen(bs, 257U + i);
+	put_bits(bs, len - deflate_len_base[i], deflate_len_extra[i]);
+
+	i = ARRAY_SIZE(deflate_dist_base) - 1U;
+	while (deflate_dist_base[i] > dist) {
+		i--;
+	}
+	put_code(bs, i, 5U);
+	put_bits(bs, dist - deflate_dist_base[i], deflate_dist_extra[i]);
+}
+
+static unsigned int deflate_hash(const uint8_t *p)
+{
+	uint32_t v = ((uint32_t)p[0] << 16) | ((uint32_t)p[1] << 8) | p[2];
+
+	return (v * 2654435761U) >> (32U - DEFLATE_HASH_BITS);
+}
+
+static void put_le32(uint8_t *p, uint32_t v)
+{
+	p[0] = (uint8_t)v;
+	p[1] = (uint8_t)(v >> 8);
+	p[2] = (uint8_t)(v >> 16);
+	p[3] = (uint8_t)(v >> 24);
+}
+
+/* Returns the size of the gzip member, or 0 if it does not fit in 'out' */
+static size_t bench_gzip(const uint8_t *in, size_t in_len, uint8_t *out,
+			 size_t out_len, uint32_t *head)
+{
+	static const uint8_t gz_header[] = {
+		0x1f, 0x8b, 8U, 0U, 0U, 0U, 0U, 0U, 0U, 0xffU,
+	};
+	bench_bits_t bs = { out, sizeof(gz_header), out_len - 8U, 0U, 0U };
+	unsigned int len, max, h;
+	uint32_t cand = DEFLATE_NO_POS;
+	size_t i, k;
+
+	if (out_len < (sizeof(gz_header) + 8U)) {
+		return 0U;
+	}
+	(void)memcpy(out, gz_header, sizeof(gz_header));
+
+	for (i = 0U; i < (1U << DEFLATE_HASH_BITS); i++) {
+		head[i] = DEFLATE_NO_POS;
+	}
+
+	/* A single final block with the fixed codes */
+	put_bits(&bs, 1U, 1U);
+	put_bits(&bs, 1U, 2U);
+
+	i = 0U;
+	while (i < in_len) {
+		len = 0U;
+		if ((i + DEFLATE_MIN_MATCH) <= in_len) {
+			h = deflate_hash(&in[i]);
+			cand = head[h];
+			head[h] = (uint32_t)i;
+			if ((cand != DEFLATE_NO_POS) &&
+			    ((i - cand) <= DEFLATE_MAX_DIST)) {
+				max = (unsigned int)MIN(in_len - i,
+						(size_t)DEFLATE_MAX_MATCH);
+				while ((len < max) &&
+				       (in[cand + len] == in[i + len])) {
+					len++;
+				}
+			}
+		}
+
+		if (len < DEFLATE_MIN_MATCH) {
+			put_litlen(&bs, in[i]);
+			i++;
+			continue;
+		}
+
+		put_match(&bs, len, (unsigned int)(i - cand));
+		for (k = i + 1U; (k < (i + len)) &&
+		     ((k + DEFLATE_MIN_MATCH) <= in_len); k++) {
+			head[deflate_hash(&in[k])] = (uint32_t)k;
+		}
+		i += len;
+	}
+
+	put_litlen(&bs, 256U);
+	put_bits(&bs, 0U, 7U);
+
+	if (bs.pos > bs.len) {
+		return 0U;
+	}
+
+	put_le32(&out[bs.pos], tf_crc32(0U, in, in_len));
+	put_le32(&out[bs.pos + 4U], (uint32_t)in_len);
+
+	return bs.pos + 8U;
+}
+
+/* Something like text, which compresses to about a third of its size */
+static void bench_text(char *buf, size_t len)
+{
+	static const char *const words[] = {
+		"the ", "secure ", "world ", "image ", "is ", "loaded ",
+		"from ", "a ", "firmware ", "package ", "and ", "verified ",
+		"by ", "boot ", "stage ", "before ", "jumping ", "to ", "it ",
+		"with ", "EL3 ", "runtime ", "services. ",
+	};
+	uint32_t seed = 0x12345678U;
+	const char *w;
+	size_t i = 0U;
+
+	while (i < len) {
+		seed = (seed * 1103515245U) + 12345U;
+		w = words[(seed >> 16) % ARRAY_SIZE(words)];
+		while ((*w != '\0') && (i < len)) {
+			buf[i++] = *w++;
+		}
+	}
+}
+
+static int bench_inflate(char *src, char *dst, char *gz, void *work)
+{
+	uintptr_t in, out;
+	uint64_t start, count, best;
+	unsigned int reps, run, i;
+	size_t size, gz_len;
+	int rc;
+
+	printf("\ninflate     size     in\n");
+
+	for (size = 1024U; size <= LIB_BENCH_MAX_SIZE; size *= 4U) {
+		bench_text(src, size);
+		gz_len = bench_gzip((uint8_t *)src, size, (uint8_t *)gz,
+				    LIB_BENCH_MAX_SIZE + (LIB_BENCH_MAX_SIZE / 8U) +
+				    LIB_BENCH_SLACK, work);
+		if (gz_len == 0U) {
+			return -ENOMEM;
+		}
+
+		reps = bench_reps(size);
+		best = UINT64_MAX;
+		for (run = 0U; run < BENCH_RUNS; run++) {
+			start = counter->read();
+			for (i = 0U; i < reps; i++) {
+				in = (uintptr_t)gz;
+				out = (uintptr_t)dst;
+				rc = gunzip(&in, gz_len, &out, size,
+					    (uintptr_t)work, LIB_BENCH_WORK_SIZE);
+				if (rc != 0) {
+					return rc;
+				}
+			}
+			count = counter->read() - start;
+			best = MIN(best, count);
+		}
+
+		if (((out - (uintptr_t)dst) != size) ||
+		    (memcmp(dst, src, size) != 0)) {
+			return -EIO;
+		}
+
+		bench_print_name("gunzip", 9U);
+		printf("%6zu %6zu ", size, gz_len);
+		bench_report_bytes(best, (uint64_t)size * reps);
+	}
+
+	return 0;
+}
+
+int lib_bench_run(const lib_bench_counter_t *ctr, void *buf, size_t size)
+{
+	char *src = buf;
+	char *dst = src + LIB_BENCH_MAX_SIZE + LIB_BENCH_SLACK;
+	char *gz = dst + LIB_BENCH_MAX_SIZE + LIB_BENCH_SLACK;
+	void *work = gz + LIB_BENCH_MAX_SIZE + (LIB_BENCH_MAX_SIZE / 8U) +
+		     LIB_BENCH_SLACK;
+	int rc;
+
+	if ((ctr == NULL) || (buf == NULL) || (size < LIB_BENCH_BUF_SIZE)) {
+		return -EINVAL;
+	}
+
+	/* The workspace holds pointers and 32-bit hash table entries */
+	work = (void *)round_up((uintptr_t)work, sizeof(uint64_t));
+	if (((uintptr_t)work + LIB_BENCH_WORK_SIZE) >
+	    ((uintptr_t)buf + size)) {
+		return -EINVAL;
+	}
+
+	rc = ctr->start();
+	if (rc != 0) {
+		return rc;
+	}
+	counter = ctr;
+
+	printf("lib_bench: best of %u runs, in %s\n", BENCH_RUNS, ctr->unit);
+
+	bench_string(src, dst);
+
+	rc = bench_fdt(work);
+	if (rc == 0) {
+		rc = bench_inflate(src, dst, gz, work);
+	}
+
+	ctr->stop();
+	counter = NULL;
+
+	return rc;
+}
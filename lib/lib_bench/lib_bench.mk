@@ -0,0 +1,13 @@
+#
+# Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+
+# The suite measures the libfdt and zlib of the tree, built with its flags
+include lib/libfdt/libfdt.mk
+include lib/zlib/zlib.mk
+
+LIB_BENCH_SOURCES	:=	lib/lib_bench/lib_bench.c			\
+				lib/lib_bench/${ARCH}/lib_bench_el3.c		\
+				${ZLIB_SOURCES}
@@ -1,5 +1,5 @@
 #
-# Copyright (c) 2020-2024, Arm Limited. All rights reserved.
+# Copyright (c) 2020-2026, Arm Limited. All rights reserved.
 #
 # SPDX-License-Identifier: BSD-3-Clause
 #
@@ -8,8 +8,25 @@ include lib/libc/libc_common.mk
 
 ifeq (${ARCH},aarch64)
 LIBC_SRCS	+=	$(addprefix lib/libc/aarch64/,	\
-			memset.S)
+			memchr.S			\
+			memcmp.S			\
+			memcpy.S			\
+			memmove.S			\
+			memset.S			\
+			strcmp.S			\
+			strlen.S			\
+			strncmp.S			\
+			strnlen.S)
 else
 LIBC_SRCS	+=	$(addprefix lib/libc/aarch32/,	\
+			memcpy.S			\
+			memmove.S			\
 			memset.S)
+LIBC_SRCS	+=	$(addprefix lib/libc/,		\
+			memchr.c			\
+			memcmp.c			\
+			strcmp.c			\
+			strlen.c			\
+			strncmp.c			\
+			strnlen.c)
 endif
@@ -1,5 +1,5 @@
 #
-# Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+# Copyright (c) 2024-2026, Arm Limited and Contributors. All rights reserved.
 #
 # SPDX-License-Identifier: BSD-3-Clause
 #
@@ -8,23 +8,15 @@ LIBC_SRCS	:=	$(addprefix lib/libc/,		\
 			abort.c				\
 			assert.c			\
 			exit.c				\
-			memchr.c			\
-			memcmp.c			\
-			memcpy.c			\
 			memcpy_s.c			\
-			memmove.c			\
 			memrchr.c			\
 			printf.c			\
 			putchar.c			\
 			puts.c				\
 			snprintf.c			\
 			strchr.c			\
-			strcmp.c			\
 			strlcat.c			\
 			strlcpy.c			\
-			strlen.c			\
-			strncmp.c			\
-			strnlen.c			\
 			strrchr.c			\
 			strtok.c			\
 			strtoul.c			\
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014-2023, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2014-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -21,21 +21,51 @@
 	(((_lcount) == 1) ? va_arg(_args, unsigned long int) :		\
 			    va_arg(_args, unsigned int)))
 
-static int string_print(const char *str)
+/*
+ * Characters are gathered in chunks passed to putchars(), so that consoles
+ * which can output several characters at once do so.
+ */
+#define PRINTF_CHUNK_SIZE	64U
+
+struct printf_out {
+	char buf[PRINTF_CHUNK_SIZE];
+	size_t len;
+};
+
+static void out_flush(struct printf_out *out)
+{
+	if (out->len != 0U) {
+		(void)putchars(out->buf, out->len);
+		out->len = 0U;
+	}
+}
+
+static void out_char(struct printf_out *out, char c)
+{
+	if (out->len == PRINTF_CHUNK_SIZE) {
+		out_flush(out);
+	}
+
+	out->buf[out->len] = c;
+	out->len++;
+}
+
+static int string_print(struct printf_out *out, const char *str)
 {
 	int count = 0;
 
 	assert(str != NULL);
 
 	for ( ; *str != '\0'; str++) {
-		(void)putchar(*str);
+		out_char(out, *str);
 		count++;
 	}
 
 	return count;
 }
 
-static int unsigned_num_print(unsigned long long int unum, unsigned int radix,
+static int unsigned_num_print(struct printf_out *out,
+			      unsigned long long int unum, unsigned int radix,
 			      char padc, int padn, bool uppercase)
 {
 	/* Just need enough space to store 64 bit decimal integer */
@@ -64,14 +94,14 @@ static int unsigned_num_print(unsigned long long int unum, unsigned int radix,
 
 	if (padn > 0) {
 		while (i < padn) {
-			(void)putchar(padc);
+			out_char(out, padc);
 			count++;
 			padn--;
 		}
 	}
 
 	while (--i >= 0) {
-		(void)putchar(num_buf[i]);
+		out_char(out, num_buf[i]);
 		count++;
 	}
 
@@ -110,6 +140,7 @@ int vprintf(const char *fmt, va_list args)
 	int padn; /* Number of characters to pad */
 	int count = 0; /* Number of printed characters */
 	bool uppercase; /* Print characters in uppercase */
+	struct printf_out out = { .len = 0U };
 
 	while (*fmt != '\0') {
 		uppercase = false;
@@ -122,37 +153,37 @@ int vprintf(const char *fmt, va_list args)
 loop:
 			switch (*fmt) {
 			case '%':
-				(void)putchar('%');
+				out_char(&out, '%');
 				break;
 			case 'i': /* Fall through to next one */
 			case 'd':
 				num = get_num_va_args(args, l_count);
 				if (num < 0) {
-					(void)putchar('-');
+					out_char(&out, '-');
 					unum = (unsigned long long int)-num;
 					padn--;
 				} else
 					unum = (unsigned long long int)num;
 
-				count += unsigned_num_print(unum, 10,
+				count += unsigned_num_print(&out, unum, 10,
 							    padc, padn, uppercase);
 				break;
 			case 'c':
-				(void)putchar(va_arg(args, int));
+				out_char(&out, (char)va_arg(args, int));
 				count++;
 				break;
 			case 's':
 				str = va_arg(args, char *);
-				count += string_print(str);
+				count += string_print(&out, str);
 				break;
 			case 'p':
 				unum = (uintptr_t)va_arg(args, void *);
 				if (unum > 0U) {
-					count += string_print("0x");
+					count += string_print(&out, "0x");
 					padn -= 2;
 				}
 
-				count += unsigned_num_print(unum, 16,
+				count += unsigned_num_print(&out, unum, 16,
 							    padc, padn, uppercase);
 				break;
 			case 'X':
@@ -160,7 +191,7 @@ loop:
 				// fall through
 			case 'x':
 				unum = get_unum_va_args(args, l_count);
-				count += unsigned_num_print(unum, 16,
+				count += unsigned_num_print(&out, unum, 16,
 							    padc, padn, uppercase);
 				break;
 			case 'z':
@@ -175,7 +206,7 @@ loop:
 				goto loop;
 			case 'u':
 				unum = get_unum_va_args(args, l_count);
-				count += unsigned_num_print(unum, 10,
+				count += unsigned_num_print(&out, unum, 10,
 							    padc, padn, uppercase);
 				break;
 			case '0':
@@ -215,16 +246,19 @@ loop:
 				assert(0); /* Unreachable */
 			default:
 				/* Exit on any other format specifier */
+				out_flush(&out);
 				return -1;
 			}
 			fmt++;
 			continue;
 		}
-		(void)putchar(*fmt);
+		out_char(&out, *fmt);
 		fmt++;
 		count++;
 	}
 
+	out_flush(&out);
+
 	return count;
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013-2023, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2013-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -11,3 +11,17 @@ int putchar(int c)
 {
 	return c;
 }
+
+#pragma weak putchars
+int putchars(const char *s, size_t len)
+{
+	size_t i;
+
+	for (i = 0U; i < len; i++) {
+		if (putchar(s[i]) == EOF) {
+			return EOF;
+		}
+	}
+
+	return (int)len;
+}
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <lib/cassert.h>
+#include <lib/cohort_lock.h>
+#include <lib/spinlock.h>
+#include <plat/common/platform.h>
+
+#include <platform_def.h>
+
+CASSERT((PLAT_COHORT_LOCK_NODES != 0U) &&
+	((PLATFORM_CORE_COUNT % PLAT_COHORT_LOCK_NODES) == 0U),
+	assert_cohort_lock_nodes_split_cores);
+
+CASSERT(PLAT_COHORT_LOCK_BATCH != 0U, assert_cohort_lock_batch_not_zero);
+
+#define CPUS_PER_NODE	(PLATFORM_CORE_COUNT / PLAT_COHORT_LOCK_NODES)
+
+static struct cohort_lock_node *my_node(cohort_lock_t *lock)
+{
+	unsigned int idx = plat_my_core_pos() / CPUS_PER_NODE;
+
+	assert(idx < PLAT_COHORT_LOCK_NODES);
+
+	return &lock->node[idx];
+}
+
+/*
+ * Whether cpus wait for a ticket lock held by the current cpu, i.e. whether
+ * more than one ticket has been taken beyond the one being served.
+ */
+static bool ticket_lock_has_waiters(const ticketlock_t *lock)
+{
+	uint32_t val = lock->lock;
+
+	return (uint16_t)((val >> 16) - val) > 1U;
+}
+
+/*
+ * Acquire a cohort lock. The lock of the node serialises its cpus, and only
+ * the first of a batch of them takes the global lock.
+ */
+void cohort_lock(cohort_lock_t *lock)
+{
+	struct cohort_lock_node *node = my_node(lock);
+
+	ticket_lock(&node->local);
+
+	if (!node->global_held) {
+		ticket_lock(&lock->global);
+		node->global_held = true;
+	}
+}
+
+/*
+ * Release a cohort lock. When another cpu of the node waits and the batch is
+ * not over, the global lock is kept for it, otherwise it is released for the
+ * other nodes.
+ */
+void cohort_unlock(cohort_lock_t *lock)
+{
+	struct cohort_lock_node *node = my_node(lock);
+
+	if (ticket_lock_has_waiters(&node->local) &&
+	    (node->batch < PLAT_COHORT_LOCK_BATCH)) {
+		node->batch++;
+	} else {
+		node->batch = 0U;
+		node->global_held = false;
+		ticket_unlock(&lock->global);
+	}
+
+	ticket_unlock(&node->local);
+}
@@ -0,0 +1,413 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/*
+ * Decoder for the LZ4 frame format, as produced by the reference 'lz4'
+ * command line tool. Dictionaries are not supported. Blocks may be
+ * independent or linked, since the whole output is kept in memory.
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <common/debug.h>
+#include <tf_lz4.h>
+
+#define LZ4_FRAME_MAGIC			U(0x184D2204)
+#define LZ4_SKIPPABLE_MAGIC		U(0x184D2A50)
+#define LZ4_SKIPPABLE_MAGIC_MASK	U(0xFFFFFFF0)
+
+#define LZ4_FLG_VERSION_SHIFT		6
+#define LZ4_FLG_VERSION_MASK		U(0x3)
+#define LZ4_FLG_VERSION			U(0x1)
+#define LZ4_FLG_BLOCK_CHECKSUM		(U(1) << 4)
+#define LZ4_FLG_CONTENT_SIZE		(U(1) << 3)
+#define LZ4_FLG_CONTENT_CHECKSUM	(U(1) << 2)
+#define LZ4_FLG_RESERVED		(U(1) << 1)
+#define LZ4_FLG_DICT_ID			(U(1) << 0)
+
+#define LZ4_BD_BLOCK_MAX_SHIFT		4
+#define LZ4_BD_BLOCK_MAX_MASK		U(0x7)
+#define LZ4_BD_RESERVED			U(0x8F)
+
+#define LZ4_BLOCK_UNCOMPRESSED		U(0x80000000)
+
+#define LZ4_MIN_MATCH			4U
+#define LZ4_MAX_OFFSET			U(0xFFFF)
+
+#define XXH_PRIME32_1			U(0x9E3779B1)
+#define XXH_PRIME32_2			U(0x85EBCA77)
+#define XXH_PRIME32_3			U(0xC2B2AE3D)
+#define XXH_PRIME32_4			U(0x27D4EB2F)
+#define XXH_PRIME32_5			U(0x165667B1)
+
+static inline uint32_t read_le32(const uint8_t *p)
+{
+	return (uint32_t)p[0] | ((uint32_t)p[1] << 8) |
+	       ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static inline uint32_t rotl32(uint32_t x, unsigned int r)
+{
+	return (x << r) | (x >> (32U - r));
+}
+
+static inline uint32_t xxh32_round(uint32_t acc, uint32_t input)
+{
+	acc += input * XXH_PRIME32_2;
+	acc = rotl32(acc, 13);
+
+	return acc * XXH_PRIME32_1;
+}
+
+/* xxHash32 with a seed of 0, as used by the LZ4 frame checksums */
+static uint32_t xxh32(const uint8_t *p, size_t len)
+{
+	const uint8_t *end = p + len;
+	uint32_t h32;
+
+	if (len >= 16U) {
+		const uint8_t *limit = end - 16;
+		uint32_t v1 = XXH_PRIME32_1 + XXH_PRIME32_2;
+		uint32_t v2 = XXH_PRIME32_2;
+		uint32_t v3 = 0U;
+		uint32_t v4 = 0U - XXH_PRIME32_1;
+
+		do {
+			v1 = xxh32_round(v1, read_le32(p));
+			v2 = xxh32_round(v2, read_le32(p + 4));
+			v3 = xxh32_round(v3, read_le32(p + 8));
+			v4 = xxh32_round(v4, read_le32(p + 12));
+			p += 16;
+		} while (p <= limit);
+
+		h32 = rotl32(v1, 1) + rotl32(v2, 7) + rotl32(v3, 12) +
+		      rotl32(v4, 18);
+	} else {
+		h32 = XXH_PRIME32_5;
+	}
+
+	h32 += (uint32_t)len;
+
+	while ((end - p) >= 4) {
+		h32 += read_le32(p) * XXH_PRIME32_3;
+		h32 = rotl32(h32, 17) * XXH_PRIME32_4;
+		p += 4;
+	}
+
+	while (p < end) {
+		h32 += (uint32_t)*p * XXH_PRIME32_5;
+		h32 = rotl32(h32, 11) * XXH_PRIME32_1;
+		p++;
+	}
+
+	h32 ^= h32 >> 15;
+	h32 *= XXH_PRIME32_2;
+	h32 ^= h32 >> 13;
+	h32 *= XXH_PRIME32_3;
+	h32 ^= h32 >> 16;
+
+	return h32;
+}
+
+/*
+ * Read an LZ4 length extension: bytes are added while they are 255.
+ * Return false if the input ends before the length is complete.
+ */
+static bool read_length(const uint8_t **ip, const uint8_t *iend, size_t *len)
+{
+	uint8_t b;
+
+	do {
+		if (*ip >= iend) {
+			return false;
+		}
+		b = *(*ip)++;
+		*len += b;
+	} while (b == 255U);
+
+	return true;
+}
+
+/*
+ * Decode one compressed block of 'in_len' bytes into the output buffer at
+ * '*op'. Matches may refer to any output produced since 'out_start', which
+ * covers linked blocks as well.
+ */
+static int lz4_decode_block(const uint8_t *in, size_t in_len,
+			    const uint8_t *out_start, uint8_t **op,
+			    const uint8_t *oend)
+{
+	const uint8_t *ip = in;
+	const uint8_t *iend = in + in_len;
+	uint8_t *o = *op;
+
+	for (;;) {
+		const uint8_t *match;
+		size_t lit_len, match_len, offset;
+		uint8_t token;
+
+		if (ip >= iend) {
+			return -EIO;
+		}
+		token = *ip++;
+
+		/* Literals */
+		lit_len = token >> 4;
+		if ((lit_len == 15U) && !read_length(&ip, iend, &lit_len)) {
+			return -EIO;
+		}
+		if (lit_len > (size_t)(iend - ip)) {
+			return -EIO;
+		}
+		if (lit_len > (size_t)(oend - o)) {
+			return -ENOSPC;
+		}
+		(void)memcpy(o, ip, lit_len);
+		ip += lit_len;
+		o += lit_len;
+
+		/* The last sequence of a block only has literals */
+		if (ip == iend) {
+			break;
+		}
+
+		/* Match */
+		if ((iend - ip) < 2) {
+			return -EIO;
+		}
+		offset = (size_t)ip[0] | ((size_t)ip[1] << 8);
+		ip += 2;
+		if ((offset == 0U) || (offset > (size_t)(o - out_start))) {
+			return -EIO;
+		}
+
+		match_len = token & 0xFU;
+		if ((match_len == 15U) && !read_length(&ip, iend, &match_len)) {
+			return -EIO;
+		}
+		match_len += LZ4_MIN_MATCH;
+		if (match_len > (size_t)(oend - o)) {
+			return -ENOSPC;
+		}
+
+		match = o - offset;
+		if (offset >= match_len) {
+			(void)memcpy(o, match, match_len);
+			o += match_len;
+		} else {
+			/* Overlapping copy repeating the last 'offset' bytes */
+			while (match_len-- != 0U) {
+				*o++ = *match++;
+			}
+		}
+	}
+
+	*op = o;
+
+	return 0;
+}
+
+/*
+ * Parse and check an LZ4 frame descriptor. On success, '*ip' points to the
+ * first block and '*flg' holds the frame flags.
+ */
+static int lz4_read_frame_header(const uint8_t **ip, const uint8_t *iend,
+				 uint8_t *flg, uint64_t *content_size)
+{
+	const uint8_t *p = *ip;
+	const uint8_t *desc;
+	size_t desc_len = 2U;
+	uint8_t bd;
+
+	if ((iend - p) < 7) {
+		return -EIO;
+	}
+
+	if (read_le32(p) != LZ4_FRAME_MAGIC) {
+		ERROR("lz4: bad frame magic\n");
+		return -EIO;
+	}
+	p += 4;
+	desc = p;
+
+	*flg = p[0];
+	bd = p[1];
+	if ((((*flg >> LZ4_FLG_VERSION_SHIFT) & LZ4_FLG_VERSION_MASK) !=
+	     LZ4_FLG_VERSION) || ((*flg & LZ4_FLG_RESERVED) != 0U) ||
+	    ((bd & LZ4_BD_RESERVED) != 0U) ||
+	    (((bd >> LZ4_BD_BLOCK_MAX_SHIFT) & LZ4_BD_BLOCK_MAX_MASK) < 4U)) {
+		ERROR("lz4: unsupported frame descriptor\n");
+		return -EIO;
+	}
+
+	if ((*flg & LZ4_FLG_DICT_ID) != 0U) {
+		ERROR("lz4: dictionaries are not supported\n");
+		return -EIO;
+	}
+
+	*content_size = 0U;
+	if ((*flg & LZ4_FLG_CONTENT_SIZE) != 0U) {
+		if ((iend - p) < 11) {
+			return -EIO;
+		}
+		*content_size = (uint64_t)read_le32(p + 2) |
+				((uint64_t)read_le32(p + 6) << 32);
+		desc_len += 8U;
+	}
+
+	/* Header checksum: second byte of the xxHash32 of the descriptor */
+	if ((size_t)(iend - desc) <= desc_len) {
+		return -EIO;
+	}
+	if (((xxh32(desc, desc_len) >> 8) & 0xFFU) != desc[desc_len]) {
+		ERROR("lz4: bad frame header checksum\n");
+		return -EIO;
+	}
+
+	*ip = desc + desc_len + 1U;
+
+	return 0;
+}
+
+/*
+ * lz4_decompress - decompress LZ4 frame data
+ * @in_buf: source of compressed input. Upon exit, the end of input.
+ * @in_len: length of in_buf
+ * @out_buf: destination of decompressed output. Upon exit, the end of output.
+ * @out_len: length of out_buf
+ * @work_buf: workspace (unused)
+ * @work_len: length of workspace (unused)
+ *
+ * Skippable frames are ignored and consecutive frames are concatenated.
+ */
+int lz4_decompress(uintptr_t *in_buf, size_t in_len, uintptr_t *out_buf,
+		   size_t out_len, uintptr_t work_buf, size_t work_len)
+{
+	const uint8_t *ip = (const uint8_t *)*in_buf;
+	const uint8_t *iend = ip + in_len;
+	uint8_t *out_start = (uint8_t *)*out_buf;
+	uint8_t *op = out_start;
+	const uint8_t *oend = out_start + out_len;
+	unsigned int frames = 0U;
+	int ret = 0;
+
+	(void)work_buf;
+	(void)work_len;
+
+	while ((ret == 0) && ((iend - ip) >= 4)) {
+		uint8_t *frame_start = op;
+		uint64_t content_size;
+		uint8_t flg;
+
+		/* Skippable frame: magic, 32-bit size and user data */
+		if ((read_le32(ip) & LZ4_SKIPPABLE_MAGIC_MASK) ==
+		    LZ4_SKIPPABLE_MAGIC) {
+			if (((iend - ip) < 8) ||
+			    (read_le32(ip + 4) > (size_t)(iend - ip - 8))) {
+				ret = -EIO;
+				break;
+			}
+			ip += 8U + read_le32(ip + 4);
+			continue;
+		}
+
+		ret = lz4_read_frame_header(&ip, iend, &flg, &content_size);
+		frames++;
+
+		while (ret == 0) {
+			uint32_t block_size;
+			bool compressed;
+
+			if ((iend - ip) < 4) {
+				ret = -EIO;
+				break;
+			}
+			block_size = read_le32(ip);
+			ip += 4;
+
+			/* End mark */
+			if (block_size == 0U) {
+				break;
+			}
+
+			compressed = (block_size & LZ4_BLOCK_UNCOMPRESSED) == 0U;
+			block_size &= ~LZ4_BLOCK_UNCOMPRESSED;
+			if ((size_t)(iend - ip) < block_size) {
+				ret = -EIO;
+				break;
+			}
+
+			if ((flg & LZ4_FLG_BLOCK_CHECKSUM) != 0U) {
+				if (((size_t)(iend - ip) < (block_size + 4U)) ||
+				    (xxh32(ip, block_size) !=
+				     read_le32(ip + block_size))) {
+					ERROR("lz4: bad block checksum\n");
+					ret = -EIO;
+					break;
+				}
+			}
+
+			if (compressed) {
+				ret = lz4_decode_block(ip, block_size,
+						       frame_start, &op, oend);
+			} else if (block_size > (size_t)(oend - op)) {
+				ret = -ENOSPC;
+			} else {
+				(void)memcpy(op, ip, block_size);
+				op += block_size;
+			}
+
+			ip += block_size;
+			if ((flg & LZ4_FLG_BLOCK_CHECKSUM) != 0U) {
+				ip += 4;
+			}
+		}
+
+		if (ret != 0) {
+			break;
+		}
+
+		if (((flg & LZ4_FLG_CONTENT_SIZE) != 0U) &&
+		    (content_size != (uint64_t)(op - frame_start))) {
+			ERROR("lz4: content size mismatch\n");
+			ret = -EIO;
+			break;
+		}
+
+		if ((flg & LZ4_FLG_CONTENT_CHECKSUM) != 0U) {
+			if (((iend - ip) < 4) ||
+			    (xxh32(frame_start, (size_t)(op - frame_start)) !=
+			     read_le32(ip))) {
+				ERROR("lz4: bad content checksum\n");
+				ret = -EIO;
+				break;
+			}
+			ip += 4;
+		}
+	}
+
+	if ((ret == 0) && (frames == 0U)) {
+		ret = -EIO;
+	}
+
+	if (ret == -ENOSPC) {
+		ERROR("lz4: output buffer too small\n");
+	} else if (ret != 0) {
+		ERROR("lz4: corrupted input\n");
+	}
+
+	VERBOSE("lz4: %lu byte input\n",
+		(unsigned long)((uintptr_t)ip - *in_buf));
+	VERBOSE("lz4: %lu byte output\n", (unsigned long)(op - out_start));
+
+	*in_buf = (uintptr_t)ip;
+	*out_buf = (uintptr_t)op;
+
+	return ret;
+}
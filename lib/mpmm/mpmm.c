@@ -1,12 +1,14 @@
 /*
- * Copyright (c) 2021-2022, Arm Limited. All rights reserved.
+ * Copyright (c) 2021-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <errno.h>
 #include <stdbool.h>
 
 #include <common/debug.h>
+#include <lib/extensions/amu.h>
 #include <lib/mpmm/mpmm.h>
 
 #include <plat/common/platform.h>
@@ -65,6 +67,60 @@ static bool mpmm_supported(void)
 /* Defaults to false */
 static bool mpmm_disable_for_errata;
 
+#if MPMM_GEAR_CONTROL
+/*
+ * Gear selected by the Normal world for each core plus one, or 0 to leave the
+ * gear the core resets to.
+ */
+static uint8_t mpmm_gears[PLATFORM_CORE_COUNT];
+
+static void write_cpumpmmcr_el3_mpmm_gear(uint64_t gear)
+{
+	uint64_t value = read_cpumpmmcr_el3();
+
+	value &= ~(CPUMPMMCR_EL3_MPMM_GEAR_MASK << CPUMPMMCR_EL3_MPMM_GEAR_SHIFT);
+	value |= (gear & CPUMPMMCR_EL3_MPMM_GEAR_MASK) <<
+		CPUMPMMCR_EL3_MPMM_GEAR_SHIFT;
+
+	write_cpumpmmcr_el3(value);
+}
+
+int mpmm_gear_get(unsigned int *gear, uint64_t residency[MPMM_GEARS])
+{
+	unsigned int i;
+
+	if (!mpmm_supported() || mpmm_disable_for_errata) {
+		return -ENODEV;
+	}
+
+	*gear = (unsigned int)((read_cpumpmmcr_el3() >>
+				CPUMPMMCR_EL3_MPMM_GEAR_SHIFT) &
+			       CPUMPMMCR_EL3_MPMM_GEAR_MASK);
+
+	for (i = 0U; i < MPMM_GEARS; i++) {
+		residency[i] = amu_aux_cnt_read(PLAT_MPMM_GEAR_AMU_IDX + i);
+	}
+
+	return 0;
+}
+
+int mpmm_gear_set(unsigned int gear)
+{
+	if (!mpmm_supported() || mpmm_disable_for_errata) {
+		return -ENODEV;
+	}
+
+	if (gear >= MPMM_GEARS) {
+		return -EINVAL;
+	}
+
+	mpmm_gears[plat_my_core_pos()] = (uint8_t)(gear + 1U);
+	write_cpumpmmcr_el3_mpmm_gear(gear);
+
+	return 0;
+}
+#endif /* MPMM_GEAR_CONTROL */
+
 void mpmm_enable(void)
 {
 	if (mpmm_supported()) {
@@ -72,6 +128,14 @@ void mpmm_enable(void)
 			WARN("MPMM: disabled by errata workaround\n");
 			return;
 		}
+
+#if MPMM_GEAR_CONTROL
+		/* Restore the gear the core lost when powered down */
+		if (mpmm_gears[plat_my_core_pos()] != 0U) {
+			write_cpumpmmcr_el3_mpmm_gear(
+				mpmm_gears[plat_my_core_pos()] - 1U);
+		}
+#endif
 		write_cpumpmmcr_el3_mpmm_en(1U);
 	}
 }
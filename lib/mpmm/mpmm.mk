@@ -27,3 +27,9 @@ ifneq (${ENABLE_MPMM_FCONF},0)
 
         MPMM_SOURCES	+= ${FCONF_MPMM_SOURCES}
 endif
+
+ifneq (${MPMM_GEAR_CONTROL},0)
+        ifeq (${ENABLE_MPMM},0)
+                $(error MPMM gear control (`MPMM_GEAR_CONTROL`) requires MPMM support (`ENABLE_MPMM`))
+        endif
+endif
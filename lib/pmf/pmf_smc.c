@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2016-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -7,10 +7,72 @@
 #include <assert.h>
 
 #include <common/debug.h>
+#include <common/runtime_svc.h>
 #include <lib/pmf/pmf.h>
+#include <lib/pmf/pmf_trace.h>
 #include <plat/common/platform.h>
 #include <smccc_helpers.h>
 
+#if SMC_LATENCY_HIST
+/*
+ * Return the count of one latency histogram bucket.
+ * x1 --> an SMC function ID owned by the runtime service.
+ * x2 --> mpidr of the cpu the histogram belongs to.
+ * x3 --> bucket number.
+ */
+static uintptr_t pmf_get_latency_hist_smc(u_register_t x1, u_register_t x2,
+					  u_register_t x3, void *handle)
+{
+	uint32_t count = 0U;
+	int rc;
+
+	rc = smc_latency_hist_get((uint32_t)x1,
+			(unsigned int)plat_core_pos_by_mpidr(x2),
+			(unsigned int)x3, &count);
+	if (rc != 0) {
+		SMC_RET1(handle, PSCI_E_INVALID_PARAMS);
+	}
+
+	SMC_RET2(handle, SMC_OK, count);
+}
+#endif /* SMC_LATENCY_HIST */
+
+#if PMF_TRACE
+/*
+ * Handle the trace ring SMCs, only available to the Normal world.
+ * PMF_SMC_TRACE_SET_BUF: x1 --> physical address of the drain buffer.
+ * PMF_SMC_TRACE_DRAIN: x2 --> mpidr of the cpu the ring belongs to.
+ * The drain returns the number of records copied in x1 and the number of
+ * records lost since the previous drain in x2.
+ */
+static uintptr_t pmf_trace_smc(unsigned int smc_fid, u_register_t x1,
+			       u_register_t x2, void *handle,
+			       u_register_t flags)
+{
+	unsigned int count;
+	uint64_t lost;
+
+	if (is_caller_secure(flags)) {
+		SMC_RET1(handle, SMC_UNK);
+	}
+
+	if ((smc_fid == PMF_SMC_TRACE_SET_BUF_32) ||
+	    (smc_fid == PMF_SMC_TRACE_SET_BUF_64)) {
+		if (pmf_trace_set_buffer(x1) != 0) {
+			SMC_RET1(handle, PSCI_E_INVALID_PARAMS);
+		}
+		SMC_RET1(handle, SMC_OK);
+	}
+
+	if (pmf_trace_drain((unsigned int)plat_core_pos_by_mpidr(x2),
+			    &count, &lost) != 0) {
+		SMC_RET1(handle, PSCI_E_INVALID_PARAMS);
+	}
+
+	SMC_RET3(handle, SMC_OK, count, lost);
+}
+#endif /* PMF_TRACE */
+
 /*
  * This function is responsible for handling all PMF SMC calls.
  */
@@ -53,6 +115,19 @@ uintptr_t pmf_smc_handler(unsigned int smc_fid,
 		if (smc_fid == PMF_SMC_GET_VERSION_32) {
 			SMC_RET2(handle, SMC_OK, PMF_SMC_VERSION);
 		}
+
+#if SMC_LATENCY_HIST
+		if (smc_fid == PMF_SMC_GET_LATENCY_HIST_32) {
+			return pmf_get_latency_hist_smc(x1, x2, x3, handle);
+		}
+#endif
+
+#if PMF_TRACE
+		if ((smc_fid == PMF_SMC_TRACE_SET_BUF_32) ||
+		    (smc_fid == PMF_SMC_TRACE_DRAIN_32)) {
+			return pmf_trace_smc(smc_fid, x1, x2, handle, flags);
+		}
+#endif
 	} else {
 		if (smc_fid == PMF_SMC_GET_TIMESTAMP_64 ||
 		    smc_fid == PMF_SMC_GET_TIMESTAMP_64_DEP) {
@@ -70,6 +145,19 @@ uintptr_t pmf_smc_handler(unsigned int smc_fid,
 		if (smc_fid == PMF_SMC_GET_VERSION_64) {
 			SMC_RET2(handle, SMC_OK, PMF_SMC_VERSION);
 		}
+
+#if SMC_LATENCY_HIST
+		if (smc_fid == PMF_SMC_GET_LATENCY_HIST_64) {
+			return pmf_get_latency_hist_smc(x1, x2, x3, handle);
+		}
+#endif
+
+#if PMF_TRACE
+		if ((smc_fid == PMF_SMC_TRACE_SET_BUF_64) ||
+		    (smc_fid == PMF_SMC_TRACE_DRAIN_64)) {
+			return pmf_trace_smc(smc_fid, x1, x2, handle, flags);
+		}
+#endif
 	}
 
 	WARN("Unimplemented PMF Call: 0x%x \n", smc_fid);
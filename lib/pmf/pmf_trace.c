@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <errno.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <arch_helpers.h>
+#include <lib/cassert.h>
+#include <lib/pmf/pmf_trace.h>
+#include <lib/spinlock.h>
+#include <lib/utils_def.h>
+#include <lib/xlat_tables/xlat_tables_v2.h>
+#include <plat/common/platform.h>
+
+#include <platform_def.h>
+
+#if !PLAT_XLAT_TABLES_DYNAMIC
+#error "PMF_TRACE requires PLAT_XLAT_TABLES_DYNAMIC to map the drain buffer"
+#endif
+
+/*
+ * Number of records kept per cpu, must be a power of two. Once a ring is full
+ * the oldest records are overwritten.
+ */
+#ifndef PLAT_PMF_TRACE_RECORDS
+#define PLAT_PMF_TRACE_RECORDS		U(128)
+#endif
+
+CASSERT(IS_POWER_OF_TWO(PLAT_PMF_TRACE_RECORDS),
+	assert_pmf_trace_records_power_of_two);
+
+#define PMF_TRACE_BUF_RECORDS	(PMF_TRACE_BUF_SIZE / \
+				 sizeof(struct pmf_trace_record))
+
+/*
+ * Each cpu is the only writer of its own ring and never waits for a reader.
+ * 'head' counts the records ever written and is only updated once the record
+ * it covers is complete. 'tail' is the next record to hand out to the Normal
+ * world and is only accessed by the drain path, with pmf_trace_lock held.
+ */
+struct pmf_trace_ring {
+	volatile uint64_t head;
+	uint64_t tail;
+	struct pmf_trace_record rec[PLAT_PMF_TRACE_RECORDS];
+} __aligned(CACHE_WRITEBACK_GRANULE);
+
+static struct pmf_trace_ring pmf_trace_rings[PLATFORM_CORE_COUNT];
+
+/* Serialises the drain requests and the buffer setup */
+static spinlock_t pmf_trace_lock;
+
+/* Where the Normal world buffer is mapped, 0 until it is set */
+static uintptr_t pmf_trace_buf_va;
+
+void pmf_trace_event(uint32_t event, u_register_t arg0, u_register_t arg1)
+{
+	struct pmf_trace_ring *ring = &pmf_trace_rings[plat_my_core_pos()];
+	uint64_t head = ring->head;
+	struct pmf_trace_record *rec;
+
+	rec = &ring->rec[head & (PLAT_PMF_TRACE_RECORDS - 1U)];
+	rec->timestamp = read_cntpct_el0();
+	rec->event = event;
+	rec->reserved = 0U;
+	rec->arg0 = arg0;
+	rec->arg1 = arg1;
+
+	/* Publish the record only once it is complete */
+	dmbishst();
+	ring->head = head + 1U;
+}
+
+/*
+ * Map the Normal world buffer the drain requests copy the records into. It can
+ * only be set once. The buffer is mapped as Non-secure memory so it can not be
+ * used to reach Secure memory.
+ */
+int pmf_trace_set_buffer(unsigned long long base_pa)
+{
+	uintptr_t base_va;
+	int rc = -EPERM;
+
+	if ((base_pa & (PMF_TRACE_BUF_SIZE - 1U)) != 0U) {
+		return -EINVAL;
+	}
+
+	spin_lock(&pmf_trace_lock);
+
+	if (pmf_trace_buf_va == 0U) {
+		rc = mmap_add_dynamic_region_alloc_va(base_pa, &base_va,
+				PMF_TRACE_BUF_SIZE,
+				MT_MEMORY | MT_RW | MT_NS | MT_EXECUTE_NEVER);
+		if (rc == 0) {
+			pmf_trace_buf_va = base_va;
+		}
+	}
+
+	spin_unlock(&pmf_trace_lock);
+
+	return rc;
+}
+
+/*
+ * Copy the oldest records of a cpu not yet handed out into the Normal world
+ * buffer. Returns in 'count' the number of records copied and in 'lost' the
+ * number of records overwritten before they could be drained.
+ */
+int pmf_trace_drain(unsigned int core_pos, unsigned int *count,
+		    uint64_t *lost)
+{
+	struct pmf_trace_ring *ring;
+	struct pmf_trace_record *buf;
+	uint64_t head, tail, first;
+	unsigned int n = 0U;
+
+	if (core_pos >= PLATFORM_CORE_COUNT) {
+		return -EINVAL;
+	}
+
+	ring = &pmf_trace_rings[core_pos];
+
+	spin_lock(&pmf_trace_lock);
+
+	if (pmf_trace_buf_va == 0U) {
+		spin_unlock(&pmf_trace_lock);
+		return -EPERM;
+	}
+
+	buf = (struct pmf_trace_record *)pmf_trace_buf_va;
+
+	head = ring->head;
+	dmbishld();
+
+	tail = ring->tail;
+	*lost = 0U;
+	if ((head - tail) > PLAT_PMF_TRACE_RECORDS) {
+		*lost = head - tail - PLAT_PMF_TRACE_RECORDS;
+		tail = head - PLAT_PMF_TRACE_RECORDS;
+	}
+
+	first = tail;
+	while ((tail != head) && (n < PMF_TRACE_BUF_RECORDS)) {
+		buf[n] = ring->rec[tail & (PLAT_PMF_TRACE_RECORDS - 1U)];
+		n++;
+		tail++;
+	}
+
+	/*
+	 * The writer may have lapped the copy. Record 'i' can be overwritten as
+	 * soon as 'head' reaches 'i' + PLAT_PMF_TRACE_RECORDS, drop the copied
+	 * records this happened to and account them as lost.
+	 */
+	dmbishld();
+	head = ring->head;
+	if ((head - first) >= PLAT_PMF_TRACE_RECORDS) {
+		uint64_t stale = head - first - PLAT_PMF_TRACE_RECORDS + 1U;
+
+		if (stale >= n) {
+			stale = n;
+		}
+		(void)memmove(buf, &buf[stale],
+			      (n - stale) * sizeof(struct pmf_trace_record));
+		n -= (unsigned int)stale;
+		*lost += stale;
+	}
+
+	ring->tail = tail;
+	*count = n;
+
+	spin_unlock(&pmf_trace_lock);
+
+	return 0;
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, Arm Limited. All rights reserved.
+ * Copyright (c) 2022-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  *
@@ -8,6 +8,7 @@
 #include <string.h>
 
 #include <common/debug.h>
+#include <drivers/arm/rse_comms.h>
 #include <drivers/measured_boot/metadata.h>
 #include <measured_boot.h>
 #include <psa/client.h>
@@ -115,10 +116,16 @@ rse_measured_boot_extend_measurement(uint8_t index,
 			measurement_algo, measurement_value,
 			measurement_value_size, lock_measurement);
 
+#if RSE_MBOOT_ASYNC_EXTEND
+	return rse_comms_call_async(RSE_MEASURED_BOOT_HANDLE,
+				    RSE_MEASURED_BOOT_EXTEND,
+				    in_vec, IOVEC_LEN(in_vec));
+#else
 	return psa_call(RSE_MEASURED_BOOT_HANDLE,
 			RSE_MEASURED_BOOT_EXTEND,
 			in_vec, IOVEC_LEN(in_vec),
 			NULL, 0);
+#endif
 }
 
 psa_status_t rse_measured_boot_read_measurement(uint8_t index,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2013-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -16,6 +16,7 @@
 #include <drivers/delay_timer.h>
 #include <lib/el3_runtime/context_mgmt.h>
 #include <lib/extensions/spe.h>
+#include <lib/pmf/pmf_trace.h>
 #include <lib/utils.h>
 #include <plat/common/platform.h>
 
@@ -27,6 +28,14 @@
  */
 const spd_pm_ops_t *psci_spd_pm;
 
+/*
+ * Work registered by psci_register_boot_work() and the cores to run it on, see
+ * psci_run_boot_work().
+ */
+void (*psci_boot_work)(void);
+static const u_register_t *psci_boot_work_mpidrs;
+static unsigned int psci_boot_work_nr_mpidrs;
+
 /*
  * PSCI requested local power state map. This array is used to store the local
  * power states requested by a CPU for power levels from level 1 to
@@ -48,23 +57,52 @@ static plat_local_state_t
 
 unsigned int psci_plat_core_count;
 
+#if PSCI_LOCKLESS_COORD
+/*
+ * Number of running CPUs in each level 1 power domain, indexed like
+ * 'psci_non_cpu_pd_nodes'. A running CPU requests RUN at every power level, so
+ * while the count of a domain is not zero none of the domains from it upwards
+ * can leave RUN. Each count sits in its own cache line as the CPUs of the
+ * domain update it on every idle entry and exit.
+ */
+typedef struct psci_pd_running {
+	unsigned int count;
+} __aligned(CACHE_WRITEBACK_GRANULE) psci_pd_running_t;
+
+static psci_pd_running_t psci_pd_running[PSCI_NUM_NON_CPU_PWR_DOMAINS];
+#endif
+
 /*******************************************************************************
  * Arrays that hold the platform's power domain tree information for state
  * management of power domains.
  * Each node in the array 'psci_non_cpu_pd_nodes' corresponds to a power domain
  * which is an ancestor of a CPU power domain.
+ * Each node in the array 'psci_non_cpu_pd_states' holds the local state of the
+ * node of the same index in 'psci_non_cpu_pd_nodes'.
  * Each node in the array 'psci_cpu_pd_nodes' corresponds to a cpu power domain
+ * With PSCI_STATIC_PWR_DOMAIN_TREE, 'psci_non_cpu_pd_nodes' and
+ * 'psci_cpu_pd_nodes' are generated at build time instead.
  ******************************************************************************/
+#if !PSCI_STATIC_PWR_DOMAIN_TREE
 non_cpu_pd_node_t psci_non_cpu_pd_nodes[PSCI_NUM_NON_CPU_PWR_DOMAINS]
 #if USE_COHERENT_MEM
 __section(".tzfw_coherent_mem")
 #endif
 ;
+#endif
+
+non_cpu_pd_state_t psci_non_cpu_pd_states[PSCI_NUM_NON_CPU_PWR_DOMAINS]
+#if USE_COHERENT_MEM
+__section(".tzfw_coherent_mem")
+#endif
+;
 
 /* Lock for PSCI state coordination */
 DEFINE_PSCI_LOCK(psci_locks[PSCI_NUM_NON_CPU_PWR_DOMAINS]);
 
+#if !PSCI_STATIC_PWR_DOMAIN_TREE
 cpu_pd_node_t psci_cpu_pd_nodes[PLATFORM_CORE_COUNT];
+#endif
 
 /*******************************************************************************
  * Pointer to functions exported by the platform to complete power mgmt. ops
@@ -78,6 +116,16 @@ CASSERT((PLAT_MAX_PWR_LVL <= PSCI_MAX_PWR_LVL) &&
 	(PLAT_MAX_PWR_LVL >= PSCI_CPU_PWR_LVL),
 	assert_platform_max_pwrlvl_check);
 
+/******************************************************************************
+ * Check that the nodes written by cpus at runtime take a single cache line
+ *****************************************************************************/
+CASSERT(sizeof(cpu_pd_node_t) == CACHE_WRITEBACK_GRANULE,
+	assert_cpu_pd_node_size_check);
+#if HW_ASSISTED_COHERENCY
+CASSERT(sizeof(psci_lock_t) == CACHE_WRITEBACK_GRANULE,
+	assert_psci_lock_size_check);
+#endif
+
 #if PSCI_OS_INIT_MODE
 /*******************************************************************************
  * The power state coordination mode used in CPU_SUSPEND.
@@ -172,7 +220,7 @@ void psci_query_sys_suspend_pwrstate(psci_power_state_t *state_info)
  ******************************************************************************/
 static bool psci_is_last_cpu_to_idle_at_pwrlvl(unsigned int end_pwrlvl)
 {
-	unsigned int my_idx, lvl;
+	unsigned int my_idx;
 	unsigned int parent_idx = 0;
 	unsigned int cpu_start_idx, ncpus, cpu_idx;
 	plat_local_state_t local_state;
@@ -182,10 +230,7 @@ static bool psci_is_last_cpu_to_idle_at_pwrlvl(unsigned int end_pwrlvl)
 	}
 
 	my_idx = plat_my_core_pos();
-	parent_idx = psci_cpu_pd_nodes[my_idx].parent_node;
-	for (lvl = PSCI_CPU_PWR_LVL + U(1); lvl < end_pwrlvl; lvl++) {
-		parent_idx = psci_non_cpu_pd_nodes[parent_idx].parent_node;
-	}
+	parent_idx = psci_cpu_pd_nodes[my_idx].ancestors[end_pwrlvl - 1U];
 
 	cpu_start_idx = psci_non_cpu_pd_nodes[parent_idx].cpu_start_idx;
 	ncpus = psci_non_cpu_pd_nodes[parent_idx].ncpus;
@@ -401,10 +446,10 @@ static plat_local_state_t get_non_cpu_pd_node_local_state(
 {
 #if !(USE_COHERENT_MEM || HW_ASSISTED_COHERENCY || WARMBOOT_ENABLE_DCACHE_EARLY)
 	flush_dcache_range(
-			(uintptr_t) &psci_non_cpu_pd_nodes[parent_idx],
-			sizeof(psci_non_cpu_pd_nodes[parent_idx]));
+			(uintptr_t) &psci_non_cpu_pd_states[parent_idx],
+			sizeof(psci_non_cpu_pd_states[parent_idx]));
 #endif
-	return psci_non_cpu_pd_nodes[parent_idx].local_state;
+	return psci_non_cpu_pd_states[parent_idx].local_state;
 }
 
 /*
@@ -414,11 +459,11 @@ static plat_local_state_t get_non_cpu_pd_node_local_state(
 static void set_non_cpu_pd_node_local_state(unsigned int parent_idx,
 		plat_local_state_t state)
 {
-	psci_non_cpu_pd_nodes[parent_idx].local_state = state;
+	psci_non_cpu_pd_states[parent_idx].local_state = state;
 #if !(USE_COHERENT_MEM || HW_ASSISTED_COHERENCY || WARMBOOT_ENABLE_DCACHE_EARLY)
 	flush_dcache_range(
-			(uintptr_t) &psci_non_cpu_pd_nodes[parent_idx],
-			sizeof(psci_non_cpu_pd_nodes[parent_idx]));
+			(uintptr_t) &psci_non_cpu_pd_states[parent_idx],
+			sizeof(psci_non_cpu_pd_states[parent_idx]));
 #endif
 }
 
@@ -428,19 +473,20 @@ static void set_non_cpu_pd_node_local_state(unsigned int parent_idx,
  * function will be called after a cpu is powered on to find the local state
  * each power domain has emerged from.
  *****************************************************************************/
-void psci_get_target_local_pwr_states(unsigned int end_pwrlvl,
-				      psci_power_state_t *target_state)
+void __hot_runtime psci_get_target_local_pwr_states(unsigned int end_pwrlvl,
+						    psci_power_state_t *target_state)
 {
-	unsigned int parent_idx, lvl;
+	unsigned int lvl;
+	const unsigned int *ancestors;
 	plat_local_state_t *pd_state = target_state->pwr_domain_state;
 
 	pd_state[PSCI_CPU_PWR_LVL] = psci_get_cpu_local_state();
-	parent_idx = psci_cpu_pd_nodes[plat_my_core_pos()].parent_node;
+	ancestors = psci_cpu_pd_nodes[plat_my_core_pos()].ancestors;
 
 	/* Copy the local power state from node to state_info */
 	for (lvl = PSCI_CPU_PWR_LVL + 1U; lvl <= end_pwrlvl; lvl++) {
-		pd_state[lvl] = get_non_cpu_pd_node_local_state(parent_idx);
-		parent_idx = psci_non_cpu_pd_nodes[parent_idx].parent_node;
+		pd_state[lvl] =
+			get_non_cpu_pd_node_local_state(ancestors[lvl - 1U]);
 	}
 
 	/* Set the the higher levels to RUN */
@@ -457,7 +503,8 @@ void psci_get_target_local_pwr_states(unsigned int end_pwrlvl,
 void psci_set_target_local_pwr_states(unsigned int end_pwrlvl,
 				      const psci_power_state_t *target_state)
 {
-	unsigned int parent_idx, lvl;
+	unsigned int lvl;
+	const unsigned int *ancestors;
 	const plat_local_state_t *pd_state = target_state->pwr_domain_state;
 
 	psci_set_cpu_local_state(pd_state[PSCI_CPU_PWR_LVL]);
@@ -468,30 +515,26 @@ void psci_set_target_local_pwr_states(unsigned int end_pwrlvl,
 	 */
 	psci_flush_cpu_data(psci_svc_cpu_data.local_state);
 
-	parent_idx = psci_cpu_pd_nodes[plat_my_core_pos()].parent_node;
+	ancestors = psci_cpu_pd_nodes[plat_my_core_pos()].ancestors;
 
 	/* Copy the local_state from state_info */
 	for (lvl = 1U; lvl <= end_pwrlvl; lvl++) {
-		set_non_cpu_pd_node_local_state(parent_idx, pd_state[lvl]);
-		parent_idx = psci_non_cpu_pd_nodes[parent_idx].parent_node;
+		set_non_cpu_pd_node_local_state(ancestors[lvl - 1U],
+						pd_state[lvl]);
 	}
 }
 
 /*******************************************************************************
  * PSCI helper function to get the parent nodes corresponding to a cpu_index.
  ******************************************************************************/
-void psci_get_parent_pwr_domain_nodes(unsigned int cpu_idx,
-				      unsigned int end_lvl,
-				      unsigned int *node_index)
+void __hot_runtime psci_get_parent_pwr_domain_nodes(unsigned int cpu_idx,
+						    unsigned int end_lvl,
+						    unsigned int *node_index)
 {
-	unsigned int parent_node = psci_cpu_pd_nodes[cpu_idx].parent_node;
 	unsigned int i;
-	unsigned int *node = node_index;
 
 	for (i = PSCI_CPU_PWR_LVL + 1U; i <= end_lvl; i++) {
-		*node = parent_node;
-		node++;
-		parent_node = psci_non_cpu_pd_nodes[parent_node].parent_node;
+		node_index[i - 1U] = psci_cpu_pd_nodes[cpu_idx].ancestors[i - 1U];
 	}
 }
 
@@ -502,17 +545,16 @@ void psci_get_parent_pwr_domain_nodes(unsigned int cpu_idx,
  *****************************************************************************/
 void psci_set_pwr_domains_to_run(unsigned int end_pwrlvl)
 {
-	unsigned int parent_idx, cpu_idx = plat_my_core_pos(), lvl;
-	parent_idx = psci_cpu_pd_nodes[cpu_idx].parent_node;
+	unsigned int cpu_idx = plat_my_core_pos(), lvl;
+	const unsigned int *ancestors = psci_cpu_pd_nodes[cpu_idx].ancestors;
 
 	/* Reset the local_state to RUN for the non cpu power domains. */
 	for (lvl = PSCI_CPU_PWR_LVL + 1U; lvl <= end_pwrlvl; lvl++) {
-		set_non_cpu_pd_node_local_state(parent_idx,
+		set_non_cpu_pd_node_local_state(ancestors[lvl - 1U],
 				PSCI_LOCAL_STATE_RUN);
 		psci_set_req_local_pwr_state(lvl,
 					     cpu_idx,
 					     PSCI_LOCAL_STATE_RUN);
-		parent_idx = psci_non_cpu_pd_nodes[parent_idx].parent_node;
 	}
 
 	/* Set the affinity info state to ON */
@@ -520,7 +562,100 @@ void psci_set_pwr_domains_to_run(unsigned int end_pwrlvl)
 
 	psci_set_cpu_local_state(PSCI_LOCAL_STATE_RUN);
 	psci_flush_cpu_data(psci_svc_cpu_data);
+
+#if PSCI_LOCKLESS_COORD
+	/*
+	 * Count this CPU as running only now that the power domains above it
+	 * are fully up, as the lockless paths rely on that.
+	 */
+	if (end_pwrlvl > PSCI_CPU_PWR_LVL) {
+		psci_pd_running_inc(&psci_pd_running[ancestors[0]].count);
+	}
+#endif
+}
+
+#if PSCI_LOCKLESS_COORD
+/******************************************************************************
+ * This function is used in platform-coordinated mode, without holding any
+ * power domain lock, when the current CPU wants to suspend or power down to
+ * 'end_pwrlvl'.
+ *
+ * It records the states requested in 'state_info' and then removes this CPU
+ * from the running count of its level 1 power domain. If other CPUs of that
+ * domain are still running, the target state of every level above the CPU is
+ * RUN: 'state_info' is updated with it and the function returns true. The
+ * caller then has no state coordination left to do and needs no lock.
+ *
+ * Otherwise it returns false and the caller must take the power domain locks
+ * and do the full coordination with psci_do_state_coordination().
+ *****************************************************************************/
+bool psci_lockless_state_coordination(unsigned int end_pwrlvl,
+				      psci_power_state_t *state_info)
+{
+	unsigned int lvl, parent_idx, cpu_idx = plat_my_core_pos();
+
+	if (end_pwrlvl == PSCI_CPU_PWR_LVL) {
+		return false;
+	}
+
+	assert(end_pwrlvl <= PLAT_MAX_PWR_LVL);
+	parent_idx = psci_cpu_pd_nodes[cpu_idx].parent_node;
+
+	/*
+	 * The requested states must be visible to whoever finds the count
+	 * dropped to zero, the decrement orders them.
+	 */
+	for (lvl = PSCI_CPU_PWR_LVL + 1U; lvl <= end_pwrlvl; lvl++) {
+		psci_set_req_local_pwr_state(lvl, cpu_idx,
+					     state_info->pwr_domain_state[lvl]);
+	}
+
+	if (psci_pd_running_dec(&psci_pd_running[parent_idx].count) == 0U) {
+		return false;
+	}
+
+	for (lvl = PSCI_CPU_PWR_LVL + 1U; lvl <= end_pwrlvl; lvl++) {
+		state_info->pwr_domain_state[lvl] = PSCI_LOCAL_STATE_RUN;
+	}
+
+	return true;
+}
+
+/******************************************************************************
+ * This function is used, without holding any power domain lock, when the
+ * current CPU wakes up from a suspend state down to 'end_pwrlvl'.
+ *
+ * If other CPUs of its level 1 power domain are running, the power domains
+ * above this CPU did not leave RUN. The CPU then counts itself as running and
+ * returns true, the caller only has the CPU level left to finish. Otherwise it
+ * returns false and the caller must take the power domain locks and finish all
+ * the levels up to 'end_pwrlvl'.
+ *****************************************************************************/
+bool psci_lockless_wake(unsigned int end_pwrlvl)
+{
+	unsigned int lvl, parent_idx, cpu_idx = plat_my_core_pos();
+
+	if (end_pwrlvl == PSCI_CPU_PWR_LVL) {
+		return false;
+	}
+
+	assert(end_pwrlvl <= PLAT_MAX_PWR_LVL);
+	parent_idx = psci_cpu_pd_nodes[cpu_idx].parent_node;
+
+	/*
+	 * This CPU is running whichever path it takes, record it before it can
+	 * count as running so that a concurrent coordination never sees it
+	 * counted while still requesting a low power state.
+	 */
+	for (lvl = PSCI_CPU_PWR_LVL + 1U; lvl <= end_pwrlvl; lvl++) {
+		psci_set_req_local_pwr_state(lvl, cpu_idx,
+					     PSCI_LOCAL_STATE_RUN);
+	}
+
+	return psci_pd_running_inc_nonzero(
+			&psci_pd_running[parent_idx].count) != 0U;
 }
+#endif /* PSCI_LOCKLESS_COORD */
 
 /******************************************************************************
  * This function is used in platform-coordinated mode.
@@ -544,8 +679,8 @@ void psci_set_pwr_domains_to_run(unsigned int end_pwrlvl)
  * This function will only be invoked with data cache enabled and while
  * powering down a core.
  *****************************************************************************/
-void psci_do_state_coordination(unsigned int end_pwrlvl,
-				psci_power_state_t *state_info)
+void __hot_runtime psci_do_state_coordination(unsigned int end_pwrlvl,
+					      psci_power_state_t *state_info)
 {
 	unsigned int lvl, parent_idx, cpu_idx = plat_my_core_pos();
 	unsigned int start_idx;
@@ -791,8 +926,8 @@ unsigned int psci_find_target_suspend_lvl(const psci_power_state_t *state_info)
  * from the node index list in order of increasing power domain level in the
  * range specified.
  ******************************************************************************/
-void psci_acquire_pwr_domain_locks(unsigned int end_pwrlvl,
-				   const unsigned int *parent_nodes)
+void __hot_runtime psci_acquire_pwr_domain_locks(unsigned int end_pwrlvl,
+						 const unsigned int *parent_nodes)
 {
 	unsigned int parent_idx;
 	unsigned int level;
@@ -809,8 +944,8 @@ void psci_acquire_pwr_domain_locks(unsigned int end_pwrlvl,
  * operation should be applied to and a list of node indexes. It releases the
  * locks in order of decreasing power domain level in the range specified.
  ******************************************************************************/
-void psci_release_pwr_domain_locks(unsigned int end_pwrlvl,
-				   const unsigned int *parent_nodes)
+void __hot_runtime psci_release_pwr_domain_locks(unsigned int end_pwrlvl,
+						 const unsigned int *parent_nodes)
 {
 	unsigned int parent_idx;
 	unsigned int level;
@@ -969,16 +1104,18 @@ int psci_validate_entry_point(entry_point_info_t *ep,
  * code to enable the gic cpu interface and for a cluster it will enable
  * coherency at the interconnect level in addition to gic cpu interface.
  ******************************************************************************/
-void psci_warmboot_entrypoint(void)
+void __hot_runtime psci_warmboot_entrypoint(void)
 {
 	unsigned int end_pwrlvl;
 	unsigned int cpu_idx = plat_my_core_pos();
-	unsigned int parent_nodes[PLAT_MAX_PWR_LVL] = {0};
+	const unsigned int *parent_nodes = psci_cpu_pd_nodes[cpu_idx].ancestors;
 	psci_power_state_t state_info = { {PSCI_LOCAL_STATE_RUN} };
 
 	/* Init registers that never change for the lifetime of TF-A */
 	cm_manage_extensions_el3();
 
+	PMF_TRACE_EVENT(PMF_TRACE_PSCI_WARMBOOT, 0U, 0U);
+
 	/*
 	 * Verify that we have been explicitly turned ON or resumed from
 	 * suspend.
@@ -994,8 +1131,16 @@ void psci_warmboot_entrypoint(void)
 	 */
 	end_pwrlvl = get_power_on_target_pwrlvl();
 
-	/* Get the parent nodes */
-	psci_get_parent_pwr_domain_nodes(cpu_idx, end_pwrlvl, parent_nodes);
+#if PSCI_LOCKLESS_COORD
+	/*
+	 * When waking up from suspend while the power domains above this CPU
+	 * kept running, only the CPU level has to be finished.
+	 */
+	if ((psci_get_aff_info_state() == AFF_STATE_ON) &&
+	    psci_lockless_wake(end_pwrlvl)) {
+		end_pwrlvl = PSCI_CPU_PWR_LVL;
+	}
+#endif
 
 	/*
 	 * This function acquires the lock corresponding to each power level so
@@ -1027,6 +1172,11 @@ void psci_warmboot_entrypoint(void)
 	else
 		psci_cpu_suspend_finish(cpu_idx, &state_info);
 
+#if PAUTH_LAZY_RESTORE
+	/* The PAuth keys of the lower ELs were lost with the CPU power */
+	set_cpu_data(pauth_live_ctx, NULL);
+#endif
+
 	/*
 	 * Generic management: Now we just need to retrieve the
 	 * information that we had stashed away during the cpu_on
@@ -1055,6 +1205,16 @@ void psci_warmboot_entrypoint(void)
 	 * in the reverse order to which they were acquired.
 	 */
 	psci_release_pwr_domain_locks(end_pwrlvl, parent_nodes);
+
+	/*
+	 * A core released by psci_run_boot_work() powers off again once it has
+	 * done its share of the work, without ever entering the Normal world.
+	 */
+	if (psci_boot_work != NULL) {
+		psci_boot_work();
+		(void) psci_do_cpu_off(PLAT_MAX_PWR_LVL);
+		panic();
+	}
 }
 
 /*******************************************************************************
@@ -1075,6 +1235,73 @@ void psci_register_spd_pm_hook(const spd_pm_ops_t *pm)
 				| define_psci_cap(PSCI_MIG_INFO_TYPE);
 }
 
+/*******************************************************************************
+ * Register some work to be run in parallel on the cores in 'mpidr_list' once
+ * psci_setup() is done, for instance to clear memory on all the cores of the
+ * system at cold boot. The list must remain valid until then, it may include
+ * the current core.
+ ******************************************************************************/
+void psci_register_boot_work(const u_register_t *mpidr_list,
+			     unsigned int nr_mpidrs,
+			     void (*work)(void))
+{
+	assert((work != NULL) && ((mpidr_list != NULL) || (nr_mpidrs == 0U)));
+
+	psci_boot_work_mpidrs = mpidr_list;
+	psci_boot_work_nr_mpidrs = nr_mpidrs;
+	psci_boot_work = work;
+}
+
+/*******************************************************************************
+ * Run the work registered by psci_register_boot_work(), if any. The other
+ * cores of the list are powered on to run it in EL3 and then power off again,
+ * while the current core runs it as well. This function returns once all the
+ * other cores are off.
+ *
+ * The work must therefore share itself out between whichever cores run it,
+ * as any core may fail to power on. It then runs on the current core only if
+ * a Secure Payload Dispatcher has already registered its power management
+ * hooks, which the cores released here must not call.
+ ******************************************************************************/
+void __init psci_run_boot_work(void)
+{
+	entry_point_info_t ep;
+	u_register_t mpidr, my_mpidr = read_mpidr() & MPIDR_AFFINITY_MASK;
+	unsigned int i;
+	void (*work)(void) = psci_boot_work;
+
+	if (work == NULL) {
+		return;
+	}
+
+	if ((psci_spd_pm == NULL) &&
+	    (psci_plat_pm_ops->pwr_domain_on != NULL) &&
+	    (psci_plat_pm_ops->pwr_domain_off != NULL)) {
+		/* The Normal world entry point is never used */
+		(void) psci_get_ns_ep_info(&ep, 0U, 0U);
+
+		for (i = 0U; i < psci_boot_work_nr_mpidrs; i++) {
+			mpidr = psci_boot_work_mpidrs[i] & MPIDR_AFFINITY_MASK;
+			if ((mpidr == my_mpidr) ||
+			    (plat_core_pos_by_mpidr(mpidr) < 0)) {
+				continue;
+			}
+
+			if (psci_cpu_on_start(mpidr, &ep) != PSCI_E_SUCCESS) {
+				WARN("PSCI: Boot work not run on 0x%llx\n",
+				     (unsigned long long)mpidr);
+			}
+		}
+	}
+
+	work();
+
+	while (!psci_is_last_on_cpu()) {
+	}
+
+	psci_boot_work = NULL;
+}
+
 /*******************************************************************************
  * This function invokes the migrate info hook in the spd_pm_ops. It performs
  * the necessary return value validation. If the Secure Payload is UP and
@@ -1120,13 +1347,13 @@ void psci_print_power_domain_map(void)
 	for (idx = 0; idx < (PSCI_NUM_PWR_DOMAINS - psci_plat_core_count);
 							idx++) {
 		state_type = find_local_state_type(
-				psci_non_cpu_pd_nodes[idx].local_state);
+				psci_non_cpu_pd_states[idx].local_state);
 		INFO("  Domain Node : Level %u, parent_node %u,"
 				" State %s (0x%x)\n",
 				psci_non_cpu_pd_nodes[idx].level,
 				psci_non_cpu_pd_nodes[idx].parent_node,
 				psci_state_type_str[state_type],
-				psci_non_cpu_pd_nodes[idx].local_state);
+				psci_non_cpu_pd_states[idx].local_state);
 	}
 
 	for (idx = 0; idx < psci_plat_core_count; idx++) {
@@ -1192,6 +1419,25 @@ void psci_pwrdown_cpu(unsigned int power_level)
 #endif
 }
 
+/* Wait up to 'wait_ms' milliseconds for the other cores to power down */
+static int psci_wait_other_cores_off(unsigned int wait_ms)
+{
+	/* Need to wait for other cores to shutdown */
+	if (wait_ms != 0U) {
+		while ((wait_ms-- != 0U) && (!psci_is_last_on_cpu())) {
+			mdelay(1U);
+		}
+
+		if (!psci_is_last_on_cpu()) {
+			WARN("Failed to stop all cores!\n");
+			psci_print_power_domain_map();
+			return PSCI_E_DENIED;
+		}
+	}
+
+	return PSCI_E_SUCCESS;
+}
+
 /*******************************************************************************
  * This function invokes the callback 'stop_func()' with the 'mpidr' of each
  * online PE. Caller can pass suitable method to stop a remote core.
@@ -1204,12 +1450,46 @@ void psci_pwrdown_cpu(unsigned int power_level)
  ******************************************************************************/
 int psci_stop_other_cores(unsigned int wait_ms,
 				   void (*stop_func)(u_register_t mpidr))
+{
+	/* Invoke stop_func for each core */
+	(void)psci_for_each_other_on_cpu(stop_func);
+
+	return psci_wait_other_cores_off(wait_ms);
+}
+
+/*******************************************************************************
+ * This function is psci_stop_other_cores() for platforms that can signal all
+ * the other PEs at once, typically by raising an SGI with the routing mode set
+ * to all the other PEs. When all the cores are ON, 'bcast_func()' is invoked
+ * once instead of 'stop_func()' for each core. Otherwise 'stop_func()' is still
+ * used, as signalling a core that is OFF could wake it up.
+ ******************************************************************************/
+int psci_stop_other_cores_bcast(unsigned int wait_ms,
+				void (*bcast_func)(void),
+				void (*stop_func)(u_register_t mpidr))
+{
+	if (psci_are_all_cpus_on()) {
+		(*bcast_func)();
+	} else {
+		(void)psci_for_each_other_on_cpu(stop_func);
+	}
+
+	return psci_wait_other_cores_off(wait_ms);
+}
+
+/*******************************************************************************
+ * This function invokes 'func' with the MPIDR of each core other than the
+ * current one that is ON, typically to raise an SGI to it. The cores may change
+ * state right after being checked, so the caller must cope with a core not
+ * answering. Returns the number of cores 'func' has been invoked for.
+ ******************************************************************************/
+unsigned int psci_for_each_other_on_cpu(void (*func)(u_register_t mpidr))
 {
 	unsigned int idx, this_cpu_idx;
+	unsigned int count = 0U;
 
 	this_cpu_idx = plat_my_core_pos();
 
-	/* Invoke stop_func for each core */
 	for (idx = 0U; idx < psci_plat_core_count; idx++) {
 		/* skip current CPU */
 		if (idx == this_cpu_idx) {
@@ -1218,24 +1498,12 @@ int psci_stop_other_cores(unsigned int wait_ms,
 
 		/* Check if the CPU is ON */
 		if (psci_get_aff_info_state_by_idx(idx) == AFF_STATE_ON) {
-			(*stop_func)(psci_cpu_pd_nodes[idx].mpidr);
+			(*func)(psci_cpu_pd_nodes[idx].mpidr);
+			count++;
 		}
 	}
 
-	/* Need to wait for other cores to shutdown */
-	if (wait_ms != 0U) {
-		while ((wait_ms-- != 0U) && (!psci_is_last_on_cpu())) {
-			mdelay(1U);
-		}
-
-		if (!psci_is_last_on_cpu()) {
-			WARN("Failed to stop all cores!\n");
-			psci_print_power_domain_map();
-			return PSCI_E_DENIED;
-		}
-	}
-
-	return PSCI_E_SUCCESS;
+	return count;
 }
 
 /*******************************************************************************
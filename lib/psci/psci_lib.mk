@@ -1,5 +1,5 @@
 #
-# Copyright (c) 2016-2024, Arm Limited and Contributors. All rights reserved.
+# Copyright (c) 2016-2026, Arm Limited and Contributors. All rights reserved.
 #
 # SPDX-License-Identifier: BSD-3-Clause
 #
@@ -33,3 +33,19 @@ endif
 ifeq (${ENABLE_PSCI_STAT}, 1)
 PSCI_LIB_SOURCES		+=	lib/psci/psci_stat.c
 endif
+
+# With PSCI_PWR_DOMAIN_TREE set, the power domain tree is generated at build
+# time from the descriptor it holds instead of being built by psci_setup().
+ifneq (${PSCI_PWR_DOMAIN_TREE},)
+PSCI_PWR_DOMAIN_TREE_SOURCE	:=	${BUILD_PLAT}/psci_pwr_domain_tree.c
+PSCI_LIB_SOURCES		+=	${PSCI_PWR_DOMAIN_TREE_SOURCE}
+
+ifndef psci-pwr-domain-tree-rule
+        psci-pwr-domain-tree-rule := 1
+
+        $(PSCI_PWR_DOMAIN_TREE_SOURCE): tools/psci_tree/psci_tree_gen.py | $$(@D)/
+		$(s)echo "  GEN     $@"
+		$(q)$(PYTHON) $< "$(PSCI_PWR_DOMAIN_TREE)" $@ \
+			--private-header $(abspath lib/psci/psci_private.h)
+endif
+endif
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013-2022, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2013-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -45,23 +45,152 @@ int psci_cpu_on(u_register_t target_cpu,
 	return psci_cpu_on_start(target_cpu, &ep);
 }
 
+#if PSCI_CPU_ON_BATCH
+/*******************************************************************************
+ * Power on, in one request, the cpus whose MPIDR is 'aff_base' with Aff0
+ * replaced by the position of a bit set in 'aff0_mask', e.g. all the cpus of a
+ * cluster. This is not part of the PSCI specification, it is exposed as a
+ * vendor-specific EL3 call.
+ ******************************************************************************/
+int psci_cpu_on_batch(u_register_t aff_base, u_register_t aff0_mask,
+		      uintptr_t entrypoint, u_register_t context_id,
+		      u_register_t *started)
+{
+	unsigned int aff0;
+	entry_point_info_t ep;
+	int rc;
+
+	*started = 0U;
+
+	if (aff0_mask == 0U)
+		return PSCI_E_INVALID_PARAMS;
+
+	/* Validate all the target CPUs before turning any of them on */
+	for (aff0 = 0U; aff0 < PSCI_CPU_ON_BATCH_MAX; aff0++) {
+		if (((aff0_mask >> aff0) & 1U) == 0U)
+			continue;
+
+		if (!is_valid_mpidr(psci_batch_target_mpidr(aff_base, aff0)))
+			return PSCI_E_INVALID_PARAMS;
+	}
+
+	/* Validate the entry point and get the entry_point_info */
+	rc = psci_validate_entry_point(&ep, entrypoint, context_id);
+	if (rc != PSCI_E_SUCCESS)
+		return rc;
+
+	return psci_cpu_on_batch_start(aff_base, aff0_mask, &ep, started);
+}
+#endif /* PSCI_CPU_ON_BATCH */
+
 unsigned int psci_version(void)
 {
 	return PSCI_MAJOR_VER | PSCI_MINOR_VER;
 }
 
-int psci_cpu_suspend(unsigned int power_state,
-		     uintptr_t entrypoint,
-		     u_register_t context_id)
+#if PSCI_STANDBY_FAST_PATH
+/*
+ * Last CPU_SUSPEND 'power_state' of each CPU found to request a CPU standby
+ * state, and the local state of the CPU in it. Only the owning CPU accesses its
+ * entry, a repeated request enters the standby state without being validated
+ * again.
+ */
+static struct {
+	unsigned int power_state;
+	plat_local_state_t cpu_pd_state;
+} psci_standby_cache[PLATFORM_CORE_COUNT];
+#endif
+
+/*******************************************************************************
+ * Enter the CPU standby state requested in 'state_info' and return once the
+ * CPU has left it. No other power domain is involved.
+ ******************************************************************************/
+static void __hot_runtime psci_cpu_standby(psci_power_state_t *state_info)
+{
+	plat_local_state_t cpu_pd_state =
+		state_info->pwr_domain_state[PSCI_CPU_PWR_LVL];
+#if PSCI_OS_INIT_MODE
+	unsigned int cpu_idx = plat_my_core_pos();
+	plat_local_state_t prev[PLAT_MAX_PWR_LVL];
+#endif
+
+	/*
+	 * Set the state of the CPU power domain to the platform specific
+	 * retention state and enter the standby state.
+	 */
+	psci_set_cpu_local_state(cpu_pd_state);
+
+#if PSCI_OS_INIT_MODE
+	/*
+	 * If in OS-initiated mode, save a copy of the previous requested local
+	 * power states and update the new requested local power states for
+	 * this CPU.
+	 */
+	if (psci_suspend_mode == OS_INIT) {
+		psci_update_req_local_pwr_states(PSCI_CPU_PWR_LVL, cpu_idx,
+						 state_info, prev);
+	}
+#endif
+
+#if ENABLE_PSCI_STAT
+	plat_psci_stat_accounting_start(state_info);
+#endif
+
+#if ENABLE_RUNTIME_INSTRUMENTATION
+	PMF_CAPTURE_TIMESTAMP(rt_instr_svc,
+	    RT_INSTR_ENTER_HW_LOW_PWR,
+	    PMF_NO_CACHE_MAINT);
+#endif
+
+	psci_plat_pm_ops->cpu_standby(cpu_pd_state);
+
+	/* Upon exit from standby, set the state back to RUN. */
+	psci_set_cpu_local_state(PSCI_LOCAL_STATE_RUN);
+
+#if PSCI_OS_INIT_MODE
+	/*
+	 * If in OS-initiated mode, restore the previous requested local power
+	 * states for this CPU.
+	 */
+	if (psci_suspend_mode == OS_INIT) {
+		psci_restore_req_local_pwr_states(cpu_idx, prev);
+	}
+#endif
+
+#if ENABLE_RUNTIME_INSTRUMENTATION
+	PMF_CAPTURE_TIMESTAMP(rt_instr_svc,
+	    RT_INSTR_EXIT_HW_LOW_PWR,
+	    PMF_NO_CACHE_MAINT);
+#endif
+
+#if ENABLE_PSCI_STAT
+	plat_psci_stat_accounting_stop(state_info);
+
+	/* Update PSCI stats */
+	psci_stats_update_pwr_up(PSCI_CPU_PWR_LVL, state_info);
+#endif
+}
+
+int __hot_runtime psci_cpu_suspend(unsigned int power_state,
+				   uintptr_t entrypoint,
+				   u_register_t context_id)
 {
 	int rc;
 	unsigned int target_pwrlvl, is_power_down_state;
 	entry_point_info_t ep;
 	psci_power_state_t state_info = { {PSCI_LOCAL_STATE_RUN} };
-	plat_local_state_t cpu_pd_state;
-#if PSCI_OS_INIT_MODE
+#if PSCI_STANDBY_FAST_PATH
 	unsigned int cpu_idx = plat_my_core_pos();
-	plat_local_state_t prev[PLAT_MAX_PWR_LVL];
+
+	/* Fast path for a CPU standby state already validated */
+	if ((psci_standby_cache[cpu_idx].power_state == power_state) &&
+	    (psci_standby_cache[cpu_idx].cpu_pd_state !=
+	     PSCI_LOCAL_STATE_RUN)) {
+		state_info.pwr_domain_state[PSCI_CPU_PWR_LVL] =
+			psci_standby_cache[cpu_idx].cpu_pd_state;
+		psci_cpu_standby(&state_info);
+		return PSCI_E_SUCCESS;
+	}
 #endif
 
 	/* Validate the power_state parameter */
@@ -86,67 +215,30 @@ int psci_cpu_suspend(unsigned int power_state,
 		panic();
 	}
 
-	/* Fast path for CPU standby.*/
-	if (is_cpu_standby_req(is_power_down_state, target_pwrlvl)) {
-		if  (psci_plat_pm_ops->cpu_standby == NULL)
-			return PSCI_E_INVALID_PARAMS;
-
-		/*
-		 * Set the state of the CPU power domain to the platform
-		 * specific retention state and enter the standby state.
-		 */
-		cpu_pd_state = state_info.pwr_domain_state[PSCI_CPU_PWR_LVL];
-		psci_set_cpu_local_state(cpu_pd_state);
-
-#if PSCI_OS_INIT_MODE
-		/*
-		 * If in OS-initiated mode, save a copy of the previous
-		 * requested local power states and update the new requested
-		 * local power states for this CPU.
-		 */
-		if (psci_suspend_mode == OS_INIT) {
-			psci_update_req_local_pwr_states(target_pwrlvl, cpu_idx,
-							 &state_info, prev);
-		}
-#endif
-
-#if ENABLE_PSCI_STAT
-		plat_psci_stat_accounting_start(&state_info);
-#endif
-
-#if ENABLE_RUNTIME_INSTRUMENTATION
-		PMF_CAPTURE_TIMESTAMP(rt_instr_svc,
-		    RT_INSTR_ENTER_HW_LOW_PWR,
-		    PMF_NO_CACHE_MAINT);
-#endif
-
-		psci_plat_pm_ops->cpu_standby(cpu_pd_state);
-
-		/* Upon exit from standby, set the state back to RUN. */
-		psci_set_cpu_local_state(PSCI_LOCAL_STATE_RUN);
-
-#if PSCI_OS_INIT_MODE
-		/*
-		 * If in OS-initiated mode, restore the previous requested
-		 * local power states for this CPU.
-		 */
-		if (psci_suspend_mode == OS_INIT) {
-			psci_restore_req_local_pwr_states(cpu_idx, prev);
-		}
+#if PSCI_STANDBY_FAST_PATH
+	/*
+	 * Remember the requests for a CPU standby state, before the idle
+	 * predictor can turn deeper requests into one.
+	 */
+	if (is_cpu_standby_req(is_power_down_state, target_pwrlvl) &&
+	    (psci_plat_pm_ops->cpu_standby != NULL)) {
+		psci_standby_cache[cpu_idx].power_state = power_state;
+		psci_standby_cache[cpu_idx].cpu_pd_state =
+			state_info.pwr_domain_state[PSCI_CPU_PWR_LVL];
+	}
 #endif
 
-#if ENABLE_RUNTIME_INSTRUMENTATION
-		PMF_CAPTURE_TIMESTAMP(rt_instr_svc,
-		    RT_INSTR_EXIT_HW_LOW_PWR,
-		    PMF_NO_CACHE_MAINT);
+#if PSCI_IDLE_PREDICT
+	/* Skip the power down of the levels unlikely to pay off */
+	target_pwrlvl = psci_idle_predict(target_pwrlvl, &state_info);
 #endif
 
-#if ENABLE_PSCI_STAT
-		plat_psci_stat_accounting_stop(&state_info);
+	/* Fast path for CPU standby.*/
+	if (is_cpu_standby_req(is_power_down_state, target_pwrlvl)) {
+		if  (psci_plat_pm_ops->cpu_standby == NULL)
+			return PSCI_E_INVALID_PARAMS;
 
-		/* Update PSCI stats */
-		psci_stats_update_pwr_up(PSCI_CPU_PWR_LVL, &state_info);
-#endif
+		psci_cpu_standby(&state_info);
 
 		return PSCI_E_SUCCESS;
 	}
@@ -172,6 +264,10 @@ int psci_cpu_suspend(unsigned int power_state,
 				    &state_info,
 				    is_power_down_state);
 
+#if PSCI_IDLE_PREDICT
+	psci_idle_predict_cancel();
+#endif
+
 	return rc;
 }
 
@@ -428,14 +524,14 @@ int psci_set_suspend_mode(unsigned int mode)
 /*******************************************************************************
  * PSCI top level handler for servicing SMCs.
  ******************************************************************************/
-u_register_t psci_smc_handler(uint32_t smc_fid,
-			  u_register_t x1,
-			  u_register_t x2,
-			  u_register_t x3,
-			  u_register_t x4,
-			  void *cookie,
-			  void *handle,
-			  u_register_t flags)
+u_register_t __hot_runtime psci_smc_handler(uint32_t smc_fid,
+					    u_register_t x1,
+					    u_register_t x2,
+					    u_register_t x3,
+					    u_register_t x4,
+					    void *cookie,
+					    void *handle,
+					    u_register_t flags)
 {
 	u_register_t ret;
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013-2019, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2013-2026, ARM Limited and Contributors. All rights reserved.
  * Copyright (c) 2023, NVIDIA Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
@@ -10,8 +10,11 @@
 
 #include <arch.h>
 #include <arch_helpers.h>
+#include <bl31/deferred_work.h>
 #include <common/debug.h>
+#include <lib/el3_runtime/simd_ctx.h>
 #include <lib/pmf/pmf.h>
+#include <lib/pmf/pmf_trace.h>
 #include <lib/runtime_instr.h>
 #include <plat/common/platform.h>
 
@@ -47,6 +50,7 @@ int psci_do_cpu_off(unsigned int end_pwrlvl)
 	unsigned int idx = plat_my_core_pos();
 	psci_power_state_t state_info;
 	unsigned int parent_nodes[PLAT_MAX_PWR_LVL] = {0};
+	unsigned int coord_pwrlvl = end_pwrlvl;
 
 	/*
 	 * This function must only be called on platforms where the
@@ -54,6 +58,15 @@ int psci_do_cpu_off(unsigned int end_pwrlvl)
 	 */
 	assert(psci_plat_pm_ops->pwr_domain_off != NULL);
 
+	PMF_TRACE_EVENT(PMF_TRACE_PSCI_CPU_OFF, end_pwrlvl, 0U);
+
+	/*
+	 * Run the deferred work and output the buffered logs while the CPU
+	 * has nothing else to do.
+	 */
+	deferred_work_run();
+	console_drain();
+
 	/* Construct the psci_power_state for CPU_OFF */
 	psci_set_power_off_state(&state_info);
 
@@ -97,12 +110,28 @@ int psci_do_cpu_off(unsigned int end_pwrlvl)
 			goto exit;
 	}
 
+#if SIMD_LAZY_SWITCH
+	/* The live FP/SIMD registers do not survive the power down */
+	simd_ctx_lazy_flush();
+#endif
+
+#if PSCI_LOCKLESS_COORD
+	/*
+	 * Stop counting this CPU as running. The locks are held on this rare
+	 * path anyway, the full coordination is only skipped when the cluster
+	 * keeps running.
+	 */
+	if (psci_lockless_state_coordination(end_pwrlvl, &state_info)) {
+		coord_pwrlvl = PSCI_CPU_PWR_LVL;
+	}
+#endif
+
 	/*
 	 * This function is passed the requested state info and
 	 * it returns the negotiated state info for each power level upto
 	 * the end level specified.
 	 */
-	psci_do_state_coordination(end_pwrlvl, &state_info);
+	psci_do_state_coordination(coord_pwrlvl, &state_info);
 
 	/* Update the target state in the power domain nodes */
 	psci_set_target_local_pwr_states(end_pwrlvl, &state_info);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013-2022, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2013-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -13,6 +13,7 @@
 #include <common/debug.h>
 #include <lib/el3_runtime/context_mgmt.h>
 #include <lib/el3_runtime/pubsub_events.h>
+#include <lib/pmf/pmf_trace.h>
 #include <plat/common/platform.h>
 
 #include "psci_private.h"
@@ -47,28 +48,16 @@ static int cpu_on_validate_state(aff_info_state_t aff_state)
 }
 
 /*******************************************************************************
- * Generic handler which is called to physically power on a cpu identified by
- * its mpidr. It performs the generic, architectural, platform setup and state
- * management to power on the target cpu e.g. it will ensure that
- * enough information is stashed for it to resume execution in the non-secure
- * security state.
- *
- * The state of all the relevant power domains are changed after calling the
- * platform handler as it can return error.
+ * This function takes the lock of the cpu requested to be turned on, checks
+ * that it is OFF and marks it ON_PENDING. The lock is only kept on success, it
+ * must then be released by the caller once the cpu context is initialised.
  ******************************************************************************/
-int psci_cpu_on_start(u_register_t target_cpu,
-		      const entry_point_info_t *ep)
+static int cpu_on_prepare(u_register_t target_cpu, unsigned int target_idx)
 {
 	int rc;
 	aff_info_state_t target_aff_state;
-	unsigned int target_idx = (unsigned int)plat_core_pos_by_mpidr(target_cpu);
 
-	/*
-	 * This function must only be called on platforms where the
-	 * CPU_ON platform hooks have been implemented.
-	 */
-	assert((psci_plat_pm_ops->pwr_domain_on != NULL) &&
-	       (psci_plat_pm_ops->pwr_domain_on_finish != NULL));
+	PMF_TRACE_EVENT(PMF_TRACE_PSCI_CPU_ON, target_cpu, 0U);
 
 	/* Protect against multiple CPUs trying to turn ON the same target CPU */
 	psci_spin_lock_cpu(target_idx);
@@ -92,8 +81,10 @@ int psci_cpu_on_start(u_register_t target_cpu,
 	flush_cpu_data_by_index(target_idx,
 				psci_svc_cpu_data.aff_info_state);
 	rc = cpu_on_validate_state(psci_get_aff_info_state_by_idx(target_idx));
-	if (rc != PSCI_E_SUCCESS)
-		goto exit;
+	if (rc != PSCI_E_SUCCESS) {
+		psci_spin_unlock_cpu(target_idx);
+		return rc;
+	}
 
 	/*
 	 * Call the cpu on handler registered by the Secure Payload Dispatcher
@@ -129,6 +120,44 @@ int psci_cpu_on_start(u_register_t target_cpu,
 		       AFF_STATE_ON_PENDING);
 	}
 
+	return PSCI_E_SUCCESS;
+}
+
+/* Restore the state of a cpu which the platform failed to power on */
+static void cpu_on_abort(unsigned int target_idx)
+{
+	psci_set_aff_info_state_by_idx(target_idx, AFF_STATE_OFF);
+	flush_cpu_data_by_index(target_idx,
+				psci_svc_cpu_data.aff_info_state);
+}
+
+/*******************************************************************************
+ * Generic handler which is called to physically power on a cpu identified by
+ * its mpidr. It performs the generic, architectural, platform setup and state
+ * management to power on the target cpu e.g. it will ensure that
+ * enough information is stashed for it to resume execution in the non-secure
+ * security state.
+ *
+ * The state of all the relevant power domains are changed after calling the
+ * platform handler as it can return error.
+ ******************************************************************************/
+int psci_cpu_on_start(u_register_t target_cpu,
+		      const entry_point_info_t *ep)
+{
+	int rc;
+	unsigned int target_idx = (unsigned int)plat_core_pos_by_mpidr(target_cpu);
+
+	/*
+	 * This function must only be called on platforms where the
+	 * CPU_ON platform hooks have been implemented.
+	 */
+	assert((psci_plat_pm_ops->pwr_domain_on != NULL) &&
+	       (psci_plat_pm_ops->pwr_domain_on_finish != NULL));
+
+	rc = cpu_on_prepare(target_cpu, target_idx);
+	if (rc != PSCI_E_SUCCESS)
+		return rc;
+
 	/*
 	 * Perform generic, architecture and platform specific handling.
 	 */
@@ -143,18 +172,109 @@ int psci_cpu_on_start(u_register_t target_cpu,
 	if (rc == PSCI_E_SUCCESS)
 		/* Store the re-entry information for the non-secure world. */
 		cm_init_context_by_index(target_idx, ep);
-	else {
+	else
 		/* Restore the state on error. */
-		psci_set_aff_info_state_by_idx(target_idx, AFF_STATE_OFF);
-		flush_cpu_data_by_index(target_idx,
-					psci_svc_cpu_data.aff_info_state);
-	}
+		cpu_on_abort(target_idx);
 
-exit:
 	psci_spin_unlock_cpu(target_idx);
 	return rc;
 }
 
+#if PSCI_CPU_ON_BATCH
+/*
+ * Working storage of psci_cpu_on_batch_start(), too large for the stack. The
+ * lock also serialises the batches, so their cpu locks are never taken in
+ * conflicting orders.
+ */
+static struct {
+	u_register_t mpidr[PSCI_CPU_ON_BATCH_MAX];
+	int rc[PSCI_CPU_ON_BATCH_MAX];
+	uint8_t aff0[PSCI_CPU_ON_BATCH_MAX];
+} psci_on_batch;
+static spinlock_t psci_on_batch_lock;
+
+/*******************************************************************************
+ * Power on the cpus of a psci_cpu_on_batch() request, all entering the
+ * Non-secure world at 'ep'. The targets are all prepared and their contexts
+ * initialised first, then the platform powers them on in one go through the
+ * optional 'pwr_domain_on_batch' hook, or one by one otherwise. Each target
+ * is released as soon as its own request is done so that its warm boot
+ * overlaps with the remaining ones.
+ *
+ * Returns PSCI_E_SUCCESS if all the targets were powered on, else the first
+ * error, and sets in 'started' the Aff0 bit of each cpu that was powered on.
+ ******************************************************************************/
+int psci_cpu_on_batch_start(u_register_t aff_base, u_register_t aff0_mask,
+			    const entry_point_info_t *ep, u_register_t *started)
+{
+	unsigned int aff0, i, target_idx, n = 0U;
+	u_register_t target_cpu;
+	int ret = PSCI_E_SUCCESS;
+	int rc;
+
+	assert((psci_plat_pm_ops->pwr_domain_on != NULL) &&
+	       (psci_plat_pm_ops->pwr_domain_on_finish != NULL));
+
+	*started = 0U;
+
+	spin_lock(&psci_on_batch_lock);
+
+	for (aff0 = 0U; aff0 < PSCI_CPU_ON_BATCH_MAX; aff0++) {
+		if (((aff0_mask >> aff0) & 1U) == 0U)
+			continue;
+
+		target_cpu = psci_batch_target_mpidr(aff_base, aff0);
+		target_idx = (unsigned int)plat_core_pos_by_mpidr(target_cpu);
+		rc = cpu_on_prepare(target_cpu, target_idx);
+		if (rc != PSCI_E_SUCCESS) {
+			if (ret == PSCI_E_SUCCESS)
+				ret = rc;
+			continue;
+		}
+
+		/*
+		 * The context is only used once the cpu is powered on, so it
+		 * can be initialised ahead of the platform request.
+		 */
+		cm_init_context_by_index(target_idx, ep);
+
+		psci_on_batch.mpidr[n] = target_cpu;
+		psci_on_batch.aff0[n] = (uint8_t)aff0;
+		n++;
+	}
+
+	if ((n != 0U) && (psci_plat_pm_ops->pwr_domain_on_batch != NULL))
+		psci_plat_pm_ops->pwr_domain_on_batch(psci_on_batch.mpidr, n,
+						      psci_on_batch.rc);
+
+	for (i = 0U; i < n; i++) {
+		target_idx = (unsigned int)plat_core_pos_by_mpidr(
+				psci_on_batch.mpidr[i]);
+
+		if (psci_plat_pm_ops->pwr_domain_on_batch != NULL)
+			rc = psci_on_batch.rc[i];
+		else
+			rc = psci_plat_pm_ops->pwr_domain_on(
+					psci_on_batch.mpidr[i]);
+		assert((rc == PSCI_E_SUCCESS) || (rc == PSCI_E_INTERN_FAIL));
+
+		if (rc == PSCI_E_SUCCESS) {
+			*started |= (u_register_t)1U << psci_on_batch.aff0[i];
+		} else {
+			cpu_on_abort(target_idx);
+			if (ret == PSCI_E_SUCCESS)
+				ret = rc;
+		}
+
+		psci_spin_unlock_cpu(target_idx);
+	}
+
+	spin_unlock(&psci_on_batch_lock);
+
+	return ret;
+}
+#endif /* PSCI_CPU_ON_BATCH */
+
 /*******************************************************************************
  * The following function finish an earlier power on request. They
  * are called by the common finisher routine in psci_common.c. The `state_info`
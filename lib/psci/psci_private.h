@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013-2023, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2013-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -111,11 +111,16 @@ static inline bool is_cpu_standby_req(unsigned int is_power_down_state,
 }
 
 /*******************************************************************************
- * The following two data structures implement the power domain tree. The tree
+ * The following data structures implement the power domain tree. The tree
  * is used to track the state of all the nodes i.e. power domain instances
  * described by the platform. The tree consists of nodes that describe CPU power
  * domains i.e. leaf nodes and all other power domains which are parents of a
  * CPU power domain i.e. non-leaf nodes.
+ *
+ * The fields written while cpus enter and leave power states are kept in cache
+ * lines of their own, so that cpus of different power domains do not take the
+ * lines of each other. The topology fields are only written during setup and
+ * are packed together.
  ******************************************************************************/
 typedef struct non_cpu_pwr_domain_node {
 	/*
@@ -137,8 +142,6 @@ typedef struct non_cpu_pwr_domain_node {
 	 */
 	unsigned int parent_node;
 
-	plat_local_state_t local_state;
-
 	unsigned char level;
 
 	/* For indexing the psci_lock array*/
@@ -154,6 +157,14 @@ typedef struct cpu_pwr_domain_node {
 	 */
 	unsigned int parent_node;
 
+	/*
+	 * Index of the ancestor power domain node at each level above the
+	 * CPU, 'ancestors[lvl - 1]' being the one at level 'lvl'. It is set
+	 * up once by psci_setup() so that the power management paths do not
+	 * have to walk the 'parent_node' chain.
+	 */
+	unsigned int ancestors[PLAT_MAX_PWR_LVL];
+
 	/*
 	 * A CPU power domain does not require state coordination like its
 	 * parent power domains. Hence this node does not include a bakery
@@ -161,7 +172,19 @@ typedef struct cpu_pwr_domain_node {
 	 * when multiple CPUs try to turn ON the same target CPU.
 	 */
 	spinlock_t cpu_lock;
-} cpu_pd_node_t;
+} __aligned(CACHE_WRITEBACK_GRANULE) cpu_pd_node_t;
+
+/*
+ * Local state of a non-CPU power domain node. Coherent memory is not cached,
+ * so there is no need to pad it there.
+ */
+typedef struct non_cpu_pd_state {
+	plat_local_state_t local_state;
+#if USE_COHERENT_MEM
+} non_cpu_pd_state_t;
+#else
+} __aligned(CACHE_WRITEBACK_GRANULE) non_cpu_pd_state_t;
+#endif
 
 #if PSCI_OS_INIT_MODE
 /*******************************************************************************
@@ -181,7 +204,20 @@ typedef enum suspend_mode {
  * On systems where participant CPUs are cache-coherent, we can use spinlocks
  * instead of bakery locks.
  */
-#define DEFINE_PSCI_LOCK(_name)		spinlock_t _name
+#if PSCI_TICKET_LOCKS
+/*
+ * Ticket locks serve the CPUs in the order they asked for the lock, so that
+ * none of them starves when many CPUs enter and leave idle together.
+ */
+typedef struct psci_lock {
+	ticketlock_t lock;
+} __aligned(CACHE_WRITEBACK_GRANULE) psci_lock_t;
+#else
+typedef struct psci_lock {
+	spinlock_t lock;
+} __aligned(CACHE_WRITEBACK_GRANULE) psci_lock_t;
+#endif
+#define DEFINE_PSCI_LOCK(_name)		psci_lock_t _name
 #define DECLARE_PSCI_LOCK(_name)	extern DEFINE_PSCI_LOCK(_name)
 
 /* One lock is required per non-CPU power domain node */
@@ -206,16 +242,28 @@ static inline void psci_dsbish(void)
 	/* Empty */
 }
 
+#if PSCI_TICKET_LOCKS
 static inline void psci_lock_get(non_cpu_pd_node_t *non_cpu_pd_node)
 {
-	spin_lock(&psci_locks[non_cpu_pd_node->lock_index]);
+	ticket_lock(&psci_locks[non_cpu_pd_node->lock_index].lock);
 }
 
 static inline void psci_lock_release(non_cpu_pd_node_t *non_cpu_pd_node)
 {
-	spin_unlock(&psci_locks[non_cpu_pd_node->lock_index]);
+	ticket_unlock(&psci_locks[non_cpu_pd_node->lock_index].lock);
+}
+#else
+static inline void psci_lock_get(non_cpu_pd_node_t *non_cpu_pd_node)
+{
+	spin_lock(&psci_locks[non_cpu_pd_node->lock_index].lock);
 }
 
+static inline void psci_lock_release(non_cpu_pd_node_t *non_cpu_pd_node)
+{
+	spin_unlock(&psci_locks[non_cpu_pd_node->lock_index].lock);
+}
+#endif /* PSCI_TICKET_LOCKS */
+
 #else /* if HW_ASSISTED_COHERENCY == 0 */
 /*
  * Use bakery locks for state coordination as not all PSCI participants are
@@ -266,7 +314,15 @@ static inline void psci_lock_init(non_cpu_pd_node_t *non_cpu_pd_node,
  * Data prototypes
  ******************************************************************************/
 extern const plat_psci_ops_t *psci_plat_pm_ops;
+#if PSCI_STATIC_PWR_DOMAIN_TREE
+extern const non_cpu_pd_node_t psci_non_cpu_pd_nodes[PSCI_NUM_NON_CPU_PWR_DOMAINS];
+extern const unsigned char psci_static_pwr_domain_tree_desc[];
+extern const unsigned int psci_static_pwr_domain_tree_desc_len;
+extern const unsigned int psci_static_plat_core_count;
+#else
 extern non_cpu_pd_node_t psci_non_cpu_pd_nodes[PSCI_NUM_NON_CPU_PWR_DOMAINS];
+#endif
+extern non_cpu_pd_state_t psci_non_cpu_pd_states[PSCI_NUM_NON_CPU_PWR_DOMAINS];
 extern cpu_pd_node_t psci_cpu_pd_nodes[PLATFORM_CORE_COUNT];
 extern unsigned int psci_caps;
 extern unsigned int psci_plat_core_count;
@@ -278,6 +334,7 @@ extern suspend_mode_t psci_suspend_mode;
  * SPD's power management hooks registered with PSCI
  ******************************************************************************/
 extern const spd_pm_ops_t *psci_spd_pm;
+extern void (*psci_boot_work)(void);
 
 /*******************************************************************************
  * Function prototypes
@@ -319,8 +376,14 @@ int psci_validate_suspend_req(const psci_power_state_t *state_info,
 unsigned int psci_find_max_off_lvl(const psci_power_state_t *state_info);
 unsigned int psci_find_target_suspend_lvl(const psci_power_state_t *state_info);
 void psci_set_pwr_domains_to_run(unsigned int end_pwrlvl);
+#if PSCI_LOCKLESS_COORD
+bool psci_lockless_state_coordination(unsigned int end_pwrlvl,
+				      psci_power_state_t *state_info);
+bool psci_lockless_wake(unsigned int end_pwrlvl);
+#endif
 void psci_print_power_domain_map(void);
 bool psci_is_last_on_cpu(void);
+void psci_run_boot_work(void);
 int psci_spd_migrate_info(u_register_t *mpidr);
 
 /*
@@ -336,6 +399,19 @@ void apply_cpu_pwr_dwn_errata(void);
 /* Private exported functions from psci_on.c */
 int psci_cpu_on_start(u_register_t target_cpu,
 		      const entry_point_info_t *ep);
+#if PSCI_CPU_ON_BATCH
+int psci_cpu_on_batch_start(u_register_t aff_base, u_register_t aff0_mask,
+			    const entry_point_info_t *ep, u_register_t *started);
+
+/* MPIDR of the cpu 'aff0' of a psci_cpu_on_batch() request */
+static inline u_register_t psci_batch_target_mpidr(u_register_t aff_base,
+						   unsigned int aff0)
+{
+	return (aff_base & ~((u_register_t)MPIDR_AFFLVL_MASK <<
+			     MPIDR_AFF0_SHIFT)) |
+	       ((u_register_t)aff0 << MPIDR_AFF0_SHIFT);
+}
+#endif
 
 void psci_cpu_on_finish(unsigned int cpu_idx, const psci_power_state_t *state_info);
 
@@ -353,6 +429,11 @@ void psci_cpu_suspend_finish(unsigned int cpu_idx, const psci_power_state_t *sta
 /* Private exported functions from psci_helpers.S */
 void psci_do_pwrdown_cache_maintenance(unsigned int pwr_level);
 void psci_do_pwrup_cache_maintenance(void);
+#if PSCI_LOCKLESS_COORD
+unsigned int psci_pd_running_dec(unsigned int *count);
+void psci_pd_running_inc(unsigned int *count);
+unsigned int psci_pd_running_inc_nonzero(unsigned int *count);
+#endif
 
 /* Private exported functions from psci_system_off.c */
 void __dead2 psci_system_off(void);
@@ -368,6 +449,11 @@ u_register_t psci_stat_residency(u_register_t target_cpu,
 			unsigned int power_state);
 u_register_t psci_stat_count(u_register_t target_cpu,
 			unsigned int power_state);
+#if PSCI_IDLE_PREDICT
+unsigned int psci_idle_predict(unsigned int end_pwrlvl,
+			       psci_power_state_t *state_info);
+void psci_idle_predict_cancel(void);
+#endif
 
 /* Private exported functions from psci_mem_protect.c */
 u_register_t psci_mem_protect(unsigned int enable);
@@ -9,6 +9,7 @@
 
 #include <arch.h>
 #include <arch_helpers.h>
+#include <bl31/el3_prof.h>
 #include <common/bl_common.h>
 #include <context.h>
 #include <lib/cpus/errata.h>
@@ -36,6 +37,70 @@ static cpu_context_t psci_ns_context[PLATFORM_CORE_COUNT];
  *****************************************************************************/
 unsigned int psci_caps;
 
+/*******************************************************************************
+ * Functions which initialize the state of a node of 'psci_non_cpu_pd_nodes' or
+ * 'psci_cpu_pd_nodes'.
+ ******************************************************************************/
+static void __init psci_init_non_cpu_pd_state(unsigned int node_idx)
+{
+	assert(node_idx < PSCI_NUM_NON_CPU_PWR_DOMAINS);
+
+	psci_non_cpu_pd_states[node_idx].local_state = PLAT_MAX_OFF_STATE;
+}
+
+static void __init psci_init_cpu_pd_state(unsigned int node_idx)
+{
+	psci_cpu_data_t *svc_cpu_data;
+
+	assert(node_idx < PLATFORM_CORE_COUNT);
+
+	svc_cpu_data = &(_cpu_data_by_index(node_idx)->psci_svc_cpu_data);
+
+	/* Set the Affinity Info for the cores as OFF */
+	svc_cpu_data->aff_info_state = AFF_STATE_OFF;
+
+	/* Invalidate the suspend level for the cpu */
+	svc_cpu_data->target_pwrlvl = PSCI_INVALID_PWR_LVL;
+
+	/* Set the power state to OFF state */
+	svc_cpu_data->local_state = PLAT_MAX_OFF_STATE;
+
+	psci_flush_dcache_range((uintptr_t)svc_cpu_data,
+					 sizeof(*svc_cpu_data));
+
+	cm_set_context_by_index(node_idx,
+				(void *) &psci_ns_context[node_idx],
+				NON_SECURE);
+}
+
+#if PSCI_STATIC_PWR_DOMAIN_TREE
+/*******************************************************************************
+ * The power domain tree was generated at build time from the descriptor in
+ * PSCI_PWR_DOMAIN_TREE, which must be the one the platform exports. Only the
+ * state of its nodes is left to initialize. Returns the number of CPUs.
+ ******************************************************************************/
+static unsigned int __init psci_init_static_pwr_domain_tree(void)
+{
+	unsigned int i;
+#if ENABLE_ASSERTIONS
+	const unsigned char *topology = plat_get_power_domain_tree_desc();
+
+	for (i = 0U; i < psci_static_pwr_domain_tree_desc_len; i++) {
+		assert(topology[i] == psci_static_pwr_domain_tree_desc[i]);
+	}
+#endif
+
+	for (i = 0U; i < PSCI_NUM_NON_CPU_PWR_DOMAINS; i++) {
+		psci_init_non_cpu_pd_state(i);
+	}
+
+	for (i = 0U; i < psci_static_plat_core_count; i++) {
+		psci_init_cpu_pd_state(i);
+	}
+
+	return psci_static_plat_core_count;
+}
+#else /* !PSCI_STATIC_PWR_DOMAIN_TREE */
 /*******************************************************************************
  * Function which initializes the 'psci_non_cpu_pd_nodes' or the
  * 'psci_cpu_pd_nodes' corresponding to the power level.
@@ -50,11 +115,8 @@ static void __init psci_init_pwr_domain_node(uint16_t node_idx,
 		psci_non_cpu_pd_nodes[node_idx].level = level;
 		psci_lock_init(psci_non_cpu_pd_nodes, node_idx);
 		psci_non_cpu_pd_nodes[node_idx].parent_node = parent_idx;
-		psci_non_cpu_pd_nodes[node_idx].local_state =
-							 PLAT_MAX_OFF_STATE;
+		psci_init_non_cpu_pd_state(node_idx);
 	} else {
-		psci_cpu_data_t *svc_cpu_data;
-
 		assert(node_idx < PLATFORM_CORE_COUNT);
 
 		psci_cpu_pd_nodes[node_idx].parent_node = parent_idx;
@@ -62,24 +124,7 @@ static void __init psci_init_pwr_domain_node(uint16_t node_idx,
 		/* Initialize with an invalid mpidr */
 		psci_cpu_pd_nodes[node_idx].mpidr = PSCI_INVALID_MPIDR;
 
-		svc_cpu_data =
-			&(_cpu_data_by_index(node_idx)->psci_svc_cpu_data);
-
-		/* Set the Affinity Info for the cores as OFF */
-		svc_cpu_data->aff_info_state = AFF_STATE_OFF;
-
-		/* Invalidate the suspend level for the cpu */
-		svc_cpu_data->target_pwrlvl = PSCI_INVALID_PWR_LVL;
-
-		/* Set the power state to OFF state */
-		svc_cpu_data->local_state = PLAT_MAX_OFF_STATE;
-
-		psci_flush_dcache_range((uintptr_t)svc_cpu_data,
-						 sizeof(*svc_cpu_data));
-
-		cm_set_context_by_index(node_idx,
-					(void *) &psci_ns_context[node_idx],
-					NON_SECURE);
+		psci_init_cpu_pd_state(node_idx);
 	}
 }
 
@@ -176,6 +221,29 @@ static unsigned int __init populate_power_domain_tree(const unsigned char
 	return j;
 }
 
+/*******************************************************************************
+ * This function records in each CPU power domain node the index of its
+ * ancestor at every power level, as found by walking up the 'parent_node'
+ * chain.
+ ******************************************************************************/
+static void __init psci_init_cpu_ancestors(void)
+{
+	unsigned int cpu_idx, lvl, parent_idx;
+
+	for (cpu_idx = 0U; cpu_idx < psci_plat_core_count; cpu_idx++) {
+		parent_idx = psci_cpu_pd_nodes[cpu_idx].parent_node;
+
+		for (lvl = PSCI_CPU_PWR_LVL + 1U; lvl <= PLAT_MAX_PWR_LVL;
+		     lvl++) {
+			assert(parent_idx < PSCI_NUM_NON_CPU_PWR_DOMAINS);
+			psci_cpu_pd_nodes[cpu_idx].ancestors[lvl - 1U] =
+								parent_idx;
+			parent_idx = psci_non_cpu_pd_nodes[parent_idx].parent_node;
+		}
+	}
+}
+#endif /* PSCI_STATIC_PWR_DOMAIN_TREE */
+
 /*******************************************************************************
  * This function does the architectural setup and takes the warm boot
  * entry-point `mailbox_ep` as an argument. The function also initializes the
@@ -201,21 +269,31 @@ static unsigned int __init populate_power_domain_tree(const unsigned char
  ******************************************************************************/
 int __init psci_setup(const psci_lib_args_t *lib_args)
 {
+#if !PSCI_STATIC_PWR_DOMAIN_TREE
 	const unsigned char *topology_tree;
+#endif
 
 	assert(VERIFY_PSCI_LIB_ARGS_V1(lib_args));
 
 	/* Do the Architectural initialization */
 	psci_arch_setup();
 
+#if PSCI_STATIC_PWR_DOMAIN_TREE
+	/* The power domain arrays were generated at build time */
+	psci_plat_core_count = psci_init_static_pwr_domain_tree();
+#else
 	/* Query the topology map from the platform */
 	topology_tree = plat_get_power_domain_tree_desc();
 
 	/* Populate the power domain arrays using the platform topology map */
 	psci_plat_core_count = populate_power_domain_tree(topology_tree);
 
+	/* Record the ancestors of each CPU power domain */
+	psci_init_cpu_ancestors();
+
 	/* Update the CPU limits for each node in psci_non_cpu_pd_nodes */
 	psci_update_pwrlvl_limits();
+#endif
 
 	/* Populate the mpidr field of cpu node for this CPU */
 	psci_cpu_pd_nodes[plat_my_core_pos()].mpidr =
@@ -277,6 +355,9 @@ int __init psci_setup(const psci_lib_args_t *lib_args)
 	psci_caps |=  define_psci_cap(PSCI_STAT_COUNT_AARCH64);
 #endif
 
+	/* Run any work the platform has registered for all the cores */
+	psci_run_boot_work();
+
 	return 0;
 }
 
@@ -303,6 +384,11 @@ void psci_arch_setup(void)
 	set_cpu_data(apiakey[0], read_apiakeylo_el1());
 	set_cpu_data(apiakey[1], read_apiakeyhi_el1());
 #endif /* ENABLE_PAUTH */
+
+#if EL3_PROFILING
+	/* The profiling timer is reset with the cpu */
+	el3_prof_init();
+#endif
 }
 
 /******************************************************************************
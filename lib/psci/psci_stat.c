@@ -1,10 +1,12 @@
 /*
- * Copyright (c) 2016-2019, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2016-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
 #include <assert.h>
+#include <errno.h>
+#include <stddef.h>
 
 #include <platform_def.h>
 
@@ -30,12 +32,50 @@ typedef struct psci_stat {
 static int last_cpu_in_non_cpu_pd[PSCI_NUM_NON_CPU_PWR_DOMAINS] = {
 		[0 ... PSCI_NUM_NON_CPU_PWR_DOMAINS - 1U] = -1};
 
+#if PSCI_IDLE_PREDICT
+/*
+ * Weight of the last residency in the running average used as the expected
+ * residency of the next suspend, as a power of two divisor.
+ */
+#ifndef PLAT_PSCI_IDLE_PREDICT_SHIFT
+#define PLAT_PSCI_IDLE_PREDICT_SHIFT	2U
+#endif
+
+/*
+ * Idle history of a cpu used to demote its suspend requests. 'expected' is a
+ * running average of the residencies of its last suspends, only meaningful
+ * once 'valid' is set. 'target' is the target residency of the deepest state
+ * requested by the pending suspend, 0 when it was not checked.
+ */
+typedef struct psci_idle_predict {
+	u_register_t expected;
+	u_register_t target;
+	bool valid;
+	bool pending;
+	bool demoted;
+	u_register_t hits;
+	u_register_t misses;
+	u_register_t demotions;
+} psci_idle_predict_t;
+#endif /* PSCI_IDLE_PREDICT */
+
+/*
+ * The stats of a cpu are only written by that cpu, with caches enabled. Keep
+ * them on their own cache lines so that updates never contend with other cpus
+ * and readers only need coherent loads.
+ */
+typedef struct psci_cpu_stat {
+	psci_stat_t stat[PLAT_MAX_PWR_LVL_STATES];
+#if PSCI_IDLE_PREDICT
+	psci_idle_predict_t predict;
+#endif
+} __aligned(CACHE_WRITEBACK_GRANULE) psci_cpu_stat_t;
+
 /*
  * Following are used to store PSCI STAT values for
  * CPU and non CPU power domains.
  */
-static psci_stat_t psci_cpu_stat[PLATFORM_CORE_COUNT]
-				[PLAT_MAX_PWR_LVL_STATES];
+static psci_cpu_stat_t psci_cpu_stat[PLATFORM_CORE_COUNT];
 static psci_stat_t psci_non_cpu_stat[PSCI_NUM_NON_CPU_PWR_DOMAINS]
 				[PLAT_MAX_PWR_LVL_STATES];
 
@@ -101,6 +141,128 @@ void psci_stats_update_pwr_down(unsigned int end_pwrlvl,
 
 }
 
+#if PSCI_IDLE_PREDICT
+/*******************************************************************************
+ * This function is called before the current cpu suspends to 'end_pwrlvl' with
+ * the states in 'state_info'. While the expected residency of the cpu is below
+ * the target residency the platform gives for the state requested at the
+ * highest level, that level is demoted to RUN. The power down of a cluster or
+ * of the system is then skipped when the cpu is likely to wake up before it
+ * pays off. The cpu level itself is never demoted, as a shallower state for it
+ * is platform specific.
+ *
+ * Returns the highest power level left in a low power state.
+ ******************************************************************************/
+unsigned int psci_idle_predict(unsigned int end_pwrlvl,
+			       psci_power_state_t *state_info)
+{
+	psci_idle_predict_t *predict;
+	unsigned int lvl = end_pwrlvl;
+	plat_local_state_t *pd_state = state_info->pwr_domain_state;
+
+	assert(end_pwrlvl <= PLAT_MAX_PWR_LVL);
+
+	predict = &psci_cpu_stat[plat_my_core_pos()].predict;
+	predict->pending = true;
+	predict->demoted = false;
+	predict->target = 0U;
+
+	if ((end_pwrlvl == PSCI_CPU_PWR_LVL) ||
+	    (psci_plat_pm_ops->get_target_residency == NULL)) {
+		return end_pwrlvl;
+	}
+
+	predict->target = psci_plat_pm_ops->get_target_residency(end_pwrlvl,
+							pd_state[end_pwrlvl]);
+	if (!predict->valid) {
+		return end_pwrlvl;
+	}
+
+	while ((lvl > PSCI_CPU_PWR_LVL) &&
+	       (predict->expected < psci_plat_pm_ops->get_target_residency(lvl,
+							pd_state[lvl]))) {
+		pd_state[lvl] = PSCI_LOCAL_STATE_RUN;
+		lvl--;
+	}
+
+	if (lvl != end_pwrlvl) {
+		predict->demoted = true;
+		predict->demotions++;
+	}
+
+	return lvl;
+}
+
+/*
+ * Forget the pending suspend of the current cpu once it returned without
+ * waking up from a low power state, e.g. as it was abandoned.
+ */
+void psci_idle_predict_cancel(void)
+{
+	psci_cpu_stat[plat_my_core_pos()].predict.pending = false;
+}
+
+/*
+ * Account the 'residency' of the suspend the current cpu woke up from. A
+ * suspend kept at the requested depth is a hit when the cpu stayed there for
+ * at least the target residency, a demoted one when it did not.
+ */
+static void psci_idle_predict_update(unsigned int cpu_idx,
+				     u_register_t residency)
+{
+	psci_idle_predict_t *predict = &psci_cpu_stat[cpu_idx].predict;
+
+	if (!predict->pending) {
+		return;
+	}
+
+	predict->pending = false;
+
+	if (predict->target != 0U) {
+		if ((residency < predict->target) == predict->demoted) {
+			predict->hits++;
+		} else {
+			predict->misses++;
+		}
+	}
+
+	if (predict->valid) {
+		predict->expected = predict->expected -
+			(predict->expected >> PLAT_PSCI_IDLE_PREDICT_SHIFT) +
+			(residency >> PLAT_PSCI_IDLE_PREDICT_SHIFT);
+	} else {
+		predict->expected = residency;
+		predict->valid = true;
+	}
+}
+
+/*******************************************************************************
+ * This function returns the idle prediction counters of 'target_cpu'.
+ ******************************************************************************/
+int psci_idle_predict_stats(u_register_t target_cpu, u_register_t *hits,
+			    u_register_t *misses, u_register_t *demotions)
+{
+	const psci_idle_predict_t *predict;
+	int cpu_idx;
+
+	if (!is_valid_mpidr(target_cpu)) {
+		return PSCI_E_INVALID_PARAMS;
+	}
+
+	cpu_idx = plat_core_pos_by_mpidr(target_cpu);
+	if (cpu_idx < 0) {
+		return PSCI_E_INVALID_PARAMS;
+	}
+
+	predict = &psci_cpu_stat[SPECULATION_SAFE_VALUE(cpu_idx)].predict;
+	*hits = predict->hits;
+	*misses = predict->misses;
+	*demotions = predict->demotions;
+
+	return PSCI_E_SUCCESS;
+}
+#endif /* PSCI_IDLE_PREDICT */
+
 /*******************************************************************************
  * This function updates the PSCI STATS(residency time and count) for CPU
  * and NON-CPU power domains.
@@ -127,8 +289,12 @@ void psci_stats_update_pwr_up(unsigned int end_pwrlvl,
 	    state_info, cpu_idx);
 
 	/* Update CPU stats. */
-	psci_cpu_stat[cpu_idx][stat_idx].residency += residency;
-	psci_cpu_stat[cpu_idx][stat_idx].count++;
+	psci_cpu_stat[cpu_idx].stat[stat_idx].residency += residency;
+	psci_cpu_stat[cpu_idx].stat[stat_idx].count++;
+
+#if PSCI_IDLE_PREDICT
+	psci_idle_predict_update(cpu_idx, residency);
+#endif
 
 	/*
 	 * Check what power domains above CPU were off
@@ -215,7 +381,7 @@ static int psci_get_stat(u_register_t target_cpu, unsigned int power_state,
 		*psci_stat = psci_non_cpu_stat[parent_idx][stat_idx];
 	} else {
 		/* Get the cpu power domain stats */
-		*psci_stat = psci_cpu_stat[target_idx][stat_idx];
+		*psci_stat = psci_cpu_stat[target_idx].stat[stat_idx];
 	}
 
 	return PSCI_E_SUCCESS;
@@ -256,3 +422,53 @@ u_register_t psci_stat_count(u_register_t target_cpu,
 	else
 		return 0;
 }
+
+/*******************************************************************************
+ * This function writes the residency and count of every local state of every
+ * power domain into 'buf', laid out as described by psci_stat_table_hdr_t.
+ * It lets a caller collect all the stats at once instead of issuing one
+ * PSCI_STAT_RESIDENCY and one PSCI_STAT_COUNT call per cpu and state. The
+ * stats are read while other cpus may update them, so a residency and its
+ * count can be one power cycle apart.
+ ******************************************************************************/
+int psci_stat_get_all(void *buf, size_t size, size_t *written)
+{
+	psci_stat_table_hdr_t *hdr = buf;
+	psci_stat_table_entry_t *entry;
+	const psci_stat_t *stat;
+	unsigned int i, j;
+	size_t needed;
+
+	needed = sizeof(*hdr) + (sizeof(*entry) * PLAT_MAX_PWR_LVL_STATES *
+		 (PLATFORM_CORE_COUNT + PSCI_NUM_NON_CPU_PWR_DOMAINS));
+	*written = needed;
+	if (size < needed) {
+		return -ENOMEM;
+	}
+
+	hdr->cpu_count = PLATFORM_CORE_COUNT;
+	hdr->non_cpu_count = PSCI_NUM_NON_CPU_PWR_DOMAINS;
+	hdr->states = PLAT_MAX_PWR_LVL_STATES;
+	hdr->reserved = 0U;
+
+	entry = (psci_stat_table_entry_t *)(hdr + 1);
+	for (i = 0U; i < PLATFORM_CORE_COUNT; i++) {
+		stat = psci_cpu_stat[i].stat;
+		for (j = 0U; j < PLAT_MAX_PWR_LVL_STATES; j++) {
+			entry->residency = stat[j].residency;
+			entry->count = stat[j].count;
+			entry++;
+		}
+	}
+
+	for (i = 0U; i < PSCI_NUM_NON_CPU_PWR_DOMAINS; i++) {
+		stat = psci_non_cpu_stat[i];
+		for (j = 0U; j < PLAT_MAX_PWR_LVL_STATES; j++) {
+			entry->residency = stat[j].residency;
+			entry->count = stat[j].count;
+			entry++;
+		}
+	}
+
+	return 0;
+}
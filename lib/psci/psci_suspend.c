@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013-2022, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2013-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -9,13 +9,16 @@
 
 #include <arch.h>
 #include <arch_helpers.h>
+#include <bl31/deferred_work.h>
 #include <common/bl_common.h>
 #include <common/debug.h>
 #include <context.h>
 #include <lib/el3_runtime/context_mgmt.h>
 #include <lib/el3_runtime/cpu_data.h>
 #include <lib/el3_runtime/pubsub_events.h>
+#include <lib/el3_runtime/simd_ctx.h>
 #include <lib/pmf/pmf.h>
+#include <lib/pmf/pmf_trace.h>
 #include <lib/runtime_instr.h>
 #include <plat/common/platform.h>
 
@@ -25,12 +28,19 @@
  * This function does generic and platform specific operations after a wake-up
  * from standby/retention states at multiple power levels.
  ******************************************************************************/
-static void psci_suspend_to_standby_finisher(unsigned int cpu_idx,
-					     unsigned int end_pwrlvl)
+static void __hot_runtime psci_suspend_to_standby_finisher(unsigned int cpu_idx,
+							   unsigned int end_pwrlvl)
 {
 	unsigned int parent_nodes[PLAT_MAX_PWR_LVL] = {0};
 	psci_power_state_t state_info;
 
+#if PSCI_LOCKLESS_COORD
+	/* Only the CPU level is left if the domains above it kept running */
+	if (psci_lockless_wake(end_pwrlvl)) {
+		end_pwrlvl = PSCI_CPU_PWR_LVL;
+	}
+#endif
+
 	/* Get the parent nodes */
 	psci_get_parent_pwr_domain_nodes(cpu_idx, end_pwrlvl, parent_nodes);
 
@@ -67,9 +77,9 @@ static void psci_suspend_to_standby_finisher(unsigned int cpu_idx,
  * This function does generic and platform specific suspend to power down
  * operations.
  ******************************************************************************/
-static void psci_suspend_to_pwrdown_start(unsigned int end_pwrlvl,
-					  const entry_point_info_t *ep,
-					  const psci_power_state_t *state_info)
+static void __hot_runtime psci_suspend_to_pwrdown_start(unsigned int end_pwrlvl,
+							const entry_point_info_t *ep,
+							const psci_power_state_t *state_info)
 {
 	unsigned int max_off_lvl = psci_find_max_off_lvl(state_info);
 
@@ -100,6 +110,11 @@ static void psci_suspend_to_pwrdown_start(unsigned int end_pwrlvl,
 	if ((psci_spd_pm != NULL) && (psci_spd_pm->svc_suspend != NULL))
 		psci_spd_pm->svc_suspend(max_off_lvl);
 
+#if SIMD_LAZY_SWITCH
+	/* The live FP/SIMD registers do not survive the power down */
+	simd_ctx_lazy_flush();
+#endif
+
 #if !HW_ASSISTED_COHERENCY
 	/*
 	 * Plat. management: Allow the platform to perform any early
@@ -159,15 +174,16 @@ static void psci_suspend_to_pwrdown_start(unsigned int end_pwrlvl,
  * the state transition has been done, no further error is expected and it is
  * not possible to undo any of the actions taken beyond that point.
  ******************************************************************************/
-int psci_cpu_suspend_start(const entry_point_info_t *ep,
-			   unsigned int end_pwrlvl,
-			   psci_power_state_t *state_info,
-			   unsigned int is_power_down_state)
+int __hot_runtime psci_cpu_suspend_start(const entry_point_info_t *ep,
+					 unsigned int end_pwrlvl,
+					 psci_power_state_t *state_info,
+					 unsigned int is_power_down_state)
 {
 	int rc = PSCI_E_SUCCESS;
 	bool skip_wfi = false;
 	unsigned int idx = plat_my_core_pos();
 	unsigned int parent_nodes[PLAT_MAX_PWR_LVL] = {0};
+	unsigned int coord_pwrlvl = end_pwrlvl;
 
 	/*
 	 * This function must only be called on platforms where the
@@ -176,22 +192,53 @@ int psci_cpu_suspend_start(const entry_point_info_t *ep,
 	assert((psci_plat_pm_ops->pwr_domain_suspend != NULL) &&
 	       (psci_plat_pm_ops->pwr_domain_suspend_finish != NULL));
 
+	PMF_TRACE_EVENT(PMF_TRACE_PSCI_SUSPEND, end_pwrlvl, is_power_down_state);
+
+	/*
+	 * Run the deferred work and output the buffered logs while the CPU
+	 * has nothing else to do.
+	 */
+	deferred_work_run();
+	console_drain();
+
+#if PSCI_LOCKLESS_COORD
+	/*
+	 * Once the requested states are recorded the suspend can no longer be
+	 * abandoned without a lock, so check for a wake-up interrupt first.
+	 * If other CPUs of the cluster keep running, the levels above this CPU
+	 * stay at RUN and none of the power domain locks is needed.
+	 */
+	if (end_pwrlvl > PSCI_CPU_PWR_LVL) {
+		if (read_isr_el1() != 0U) {
+			return rc;
+		}
+
+		if (psci_lockless_state_coordination(end_pwrlvl, state_info)) {
+			coord_pwrlvl = PSCI_CPU_PWR_LVL;
+		}
+	}
+#endif
+
 	/* Get the parent nodes */
-	psci_get_parent_pwr_domain_nodes(idx, end_pwrlvl, parent_nodes);
+	psci_get_parent_pwr_domain_nodes(idx, coord_pwrlvl, parent_nodes);
 
 	/*
 	 * This function acquires the lock corresponding to each power
 	 * level so that by the time all locks are taken, the system topology
 	 * is snapshot and state management can be done safely.
 	 */
-	psci_acquire_pwr_domain_locks(end_pwrlvl, parent_nodes);
+	psci_acquire_pwr_domain_locks(coord_pwrlvl, parent_nodes);
 
 	/*
 	 * We check if there are any pending interrupts after the delay
 	 * introduced by lock contention to increase the chances of early
 	 * detection that a wake-up interrupt has fired.
 	 */
-	if (read_isr_el1() != 0U) {
+	if ((coord_pwrlvl == end_pwrlvl) && (read_isr_el1() != 0U)) {
+#if PSCI_LOCKLESS_COORD
+		/* Undo the lockless request, this CPU keeps running */
+		psci_set_pwr_domains_to_run(end_pwrlvl);
+#endif
 		skip_wfi = true;
 		goto exit;
 	}
@@ -214,7 +261,7 @@ int psci_cpu_suspend_start(const entry_point_info_t *ep,
 		 * it returns the negotiated state info for each power level upto
 		 * the end level specified.
 		 */
-		psci_do_state_coordination(end_pwrlvl, state_info);
+		psci_do_state_coordination(coord_pwrlvl, state_info);
 #if PSCI_OS_INIT_MODE
 	}
 #endif
@@ -230,11 +277,11 @@ int psci_cpu_suspend_start(const entry_point_info_t *ep,
 #endif
 
 	/* Update the target state in the power domain nodes */
-	psci_set_target_local_pwr_states(end_pwrlvl, state_info);
+	psci_set_target_local_pwr_states(coord_pwrlvl, state_info);
 
 #if ENABLE_PSCI_STAT
 	/* Update the last cpu for each level till end_pwrlvl */
-	psci_stats_update_pwr_down(end_pwrlvl, state_info);
+	psci_stats_update_pwr_down(coord_pwrlvl, state_info);
 #endif
 
 	if (is_power_down_state != 0U)
@@ -258,7 +305,7 @@ exit:
 	 * Release the locks corresponding to each power level in the
 	 * reverse order to which they were acquired.
 	 */
-	psci_release_pwr_domain_locks(end_pwrlvl, parent_nodes);
+	psci_release_pwr_domain_locks(coord_pwrlvl, parent_nodes);
 
 	if (skip_wfi) {
 		return rc;
@@ -318,7 +365,7 @@ exit:
  * are called by the common finisher routine in psci_common.c. The `state_info`
  * is the psci_power_state from which this CPU has woken up from.
  ******************************************************************************/
-void psci_cpu_suspend_finish(unsigned int cpu_idx, const psci_power_state_t *state_info)
+void __hot_runtime psci_cpu_suspend_finish(unsigned int cpu_idx, const psci_power_state_t *state_info)
 {
 	unsigned int counter_freq;
 	unsigned int max_off_lvl;
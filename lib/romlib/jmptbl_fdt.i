@@ -0,0 +1,84 @@
+#
+# Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Entry points of libfdt, for the platforms sharing it from ROM with:
+# include	jmptbl_fdt.i
+#
+# Only append to this list, as the platforms including it have the position
+# of their following entries in the jump table shifted otherwise.
+
+fdt	fdt_header_size
+fdt	fdt_check_header
+fdt	fdt_offset_ptr
+fdt	fdt_next_tag
+fdt	fdt_next_node
+fdt	fdt_first_subnode
+fdt	fdt_next_subnode
+fdt	fdt_move
+fdt	fdt_address_cells
+fdt	fdt_size_cells
+fdt	fdt_appendprop_addrrange
+fdt	fdt_create_empty_tree
+fdt	fdt_get_string
+fdt	fdt_string
+fdt	fdt_find_max_phandle
+fdt	fdt_generate_phandle
+fdt	fdt_get_mem_rsv
+fdt	fdt_num_mem_rsv
+fdt	fdt_subnode_offset_namelen
+fdt	fdt_subnode_offset
+fdt	fdt_path_offset_namelen
+fdt	fdt_path_offset
+fdt	fdt_get_name
+fdt	fdt_first_property_offset
+fdt	fdt_next_property_offset
+fdt	fdt_get_property_by_offset
+fdt	fdt_get_property_namelen
+fdt	fdt_get_property
+fdt	fdt_getprop_namelen
+fdt	fdt_getprop_by_offset
+fdt	fdt_getprop
+fdt	fdt_get_phandle
+fdt	fdt_get_alias_namelen
+fdt	fdt_get_alias
+fdt	fdt_get_path
+fdt	fdt_supernode_atdepth_offset
+fdt	fdt_node_depth
+fdt	fdt_parent_offset
+fdt	fdt_node_offset_by_prop_value
+fdt	fdt_node_offset_by_phandle
+fdt	fdt_stringlist_contains
+fdt	fdt_stringlist_count
+fdt	fdt_stringlist_search
+fdt	fdt_stringlist_get
+fdt	fdt_node_check_compatible
+fdt	fdt_node_offset_by_compatible
+fdt	fdt_add_mem_rsv
+fdt	fdt_del_mem_rsv
+fdt	fdt_set_name
+fdt	fdt_setprop_placeholder
+fdt	fdt_setprop
+fdt	fdt_appendprop
+fdt	fdt_delprop
+fdt	fdt_add_subnode_namelen
+fdt	fdt_add_subnode
+fdt	fdt_del_node
+fdt	fdt_open_into
+fdt	fdt_pack
+fdt	fdt_strerror
+fdt	fdt_create_with_flags
+fdt	fdt_create
+fdt	fdt_resize
+fdt	fdt_add_reservemap_entry
+fdt	fdt_finish_reservemap
+fdt	fdt_begin_node
+fdt	fdt_end_node
+fdt	fdt_property_placeholder
+fdt	fdt_property
+fdt	fdt_finish
+fdt	fdt_setprop_inplace_namelen_partial
+fdt	fdt_setprop_inplace
+fdt	fdt_nop_property
+fdt	fdt_nop_node
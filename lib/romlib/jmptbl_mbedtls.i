@@ -0,0 +1,50 @@
+#
+# Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Entry points of the Mbed TLS crypto backend and X.509 parser, for the
+# platforms sharing them from ROM with:
+# include	jmptbl_mbedtls.i
+#
+# Only append to this list, as the platforms including it have the position
+# of their following entries in the jump table shifted otherwise.
+
+mbedtls	mbedtls_asn1_get_alg
+mbedtls	mbedtls_asn1_get_alg_null
+mbedtls	mbedtls_asn1_get_bitstring_null
+mbedtls	mbedtls_asn1_get_bool
+mbedtls	mbedtls_asn1_get_int
+mbedtls	mbedtls_asn1_get_len
+mbedtls	mbedtls_asn1_get_tag
+mbedtls	mbedtls_free
+mbedtls	mbedtls_memory_buffer_alloc_init
+mbedtls	mbedtls_platform_set_calloc_free
+mbedtls	mbedtls_platform_set_snprintf
+mbedtls	mbedtls_md
+mbedtls	mbedtls_md_finish
+mbedtls	mbedtls_md_free
+mbedtls	mbedtls_md_get_size
+mbedtls	mbedtls_md_get_type
+mbedtls	mbedtls_md_info_from_type
+mbedtls	mbedtls_md_init
+mbedtls	mbedtls_md_setup
+mbedtls	mbedtls_md_starts
+mbedtls	mbedtls_md_update
+mbedtls	mbedtls_oid_get_md_alg
+mbedtls	mbedtls_oid_get_numeric_string
+mbedtls	mbedtls_oid_get_pk_alg
+mbedtls	mbedtls_oid_get_sig_alg
+mbedtls	mbedtls_pk_free
+mbedtls	mbedtls_pk_init
+mbedtls	mbedtls_pk_parse_subpubkey
+mbedtls	mbedtls_pk_verify_ext
+mbedtls	mbedtls_x509_get_alg
+mbedtls	mbedtls_x509_get_alg_null
+mbedtls	mbedtls_x509_get_ext
+mbedtls	mbedtls_x509_get_name
+mbedtls	mbedtls_x509_get_rsassa_pss_params
+mbedtls	mbedtls_x509_get_serial
+mbedtls	mbedtls_x509_get_sig
+mbedtls	mbedtls_x509_get_sig_alg
+mbedtls	mbedtls_x509_get_time
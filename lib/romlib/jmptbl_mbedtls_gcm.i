@@ -0,0 +1,18 @@
+#
+# Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Entry points of the Mbed TLS AES-GCM decryption, for the platforms built with
+# DECRYPTION_SUPPORT=aes_gcm and PSA_CRYPTO=0 sharing it from ROM with:
+# include	jmptbl_mbedtls_gcm.i
+#
+# Only append to this list, as the platforms including it have the position
+# of their following entries in the jump table shifted otherwise.
+
+mbedtls	mbedtls_gcm_init
+mbedtls	mbedtls_gcm_setkey
+mbedtls	mbedtls_gcm_starts
+mbedtls	mbedtls_gcm_update
+mbedtls	mbedtls_gcm_finish
+mbedtls	mbedtls_gcm_free
@@ -0,0 +1,26 @@
+#
+# Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+# Entry points of the PSA Crypto API of Mbed TLS, for the platforms built with
+# PSA_CRYPTO=1 sharing it from ROM with:
+# include	jmptbl_mbedtls_psa.i
+#
+# Only append to this list, as the platforms including it have the position
+# of their following entries in the jump table shifted otherwise.
+
+mbedtls	psa_crypto_init
+mbedtls	psa_import_key
+mbedtls	psa_destroy_key
+mbedtls	psa_hash_compute
+mbedtls	psa_hash_compare
+mbedtls	psa_verify_message
+mbedtls	psa_aead_decrypt_setup
+mbedtls	psa_aead_set_nonce
+mbedtls	psa_aead_update
+mbedtls	psa_aead_verify
+mbedtls	psa_aead_abort
+mbedtls	mbedtls_pk_get_psa_attributes
+mbedtls	mbedtls_pk_import_into_psa
+mbedtls	mbedtls_ecdsa_der_to_raw
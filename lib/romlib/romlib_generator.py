@@ -13,6 +13,7 @@ import os
 import re
 import subprocess
 import string
+import struct
 import sys
 
 class IndexFileParser:
@@ -270,10 +271,100 @@ class VariableGenerator(RomlibApplication):
         with open(self.config.output, "w") as output_file:
             output_file.write(self.build_template("jmptbl_glob_var.S", mapping))
 
+class SizeReport(RomlibApplication):
+    """
+    Reports how much a BL image shrinks by calling the functions of the index file in the library at
+    ROM, from the image built without and with USE_ROMLIB.
+    """
+
+    def __init__(self, prog):
+        RomlibApplication.__init__(self, prog)
+
+        self.args.add_argument("--nm", help="nm command", default="nm")
+        self.args.add_argument("file", help="Index file")
+        self.args.add_argument("before", help="ELF file of the image built without USE_ROMLIB")
+        self.args.add_argument("after", help="ELF file of the image built with USE_ROMLIB")
+
+    @staticmethod
+    def load_size(file_name):
+        """ Returns the size of the PT_LOAD segments of an ELF64 file in the file. """
+        with open(file_name, "rb") as elf_file:
+            data = elf_file.read()
+
+        if data[:4] != b"\x7fELF" or data[4] != 2:
+            raise Exception("%s is not an ELF64 file" % file_name)
+
+        endian = "<" if data[5] == 1 else ">"
+        phoff, = struct.unpack_from(endian + "Q", data, 32)
+        phentsize, phnum = struct.unpack_from(endian + "HH", data, 54)
+
+        size = 0
+        for index in range(phnum):
+            p_type, = struct.unpack_from(endian + "I", data, phoff + index * phentsize)
+            if p_type == 1:
+                size += struct.unpack_from(endian + "Q", data, phoff + index * phentsize + 32)[0]
+
+        return size
+
+    def symbols(self, file_name):
+        """ Returns the sizes of the defined symbols of an ELF file by name. """
+        output = subprocess.check_output([self.config.nm, "-S", "--defined-only", file_name])
+
+        sizes = {}
+        for line in output.decode().splitlines():
+            fields = line.split()
+            if len(fields) == 4:
+                sizes[fields[3]] = int(fields[1], 16)
+
+        return sizes
+
+    def main(self):
+        """
+        Compares the symbols of both images. The symbols that are not linked into the image anymore
+        are accounted to the library of the index file sharing their prefix, as the internal
+        functions of a library have no entry in the index file.
+        """
+
+        index_file_parser = IndexFileParser()
+        index_file_parser.parse(self.config.file)
+
+        functions = [item for item in index_file_parser.items if item["type"] == "function"]
+        libraries = {}
+        for item in functions:
+            libraries[item["function_name"].split("_")[0]] = item["library_name"]
+
+        before = self.symbols(self.config.before)
+        after = self.symbols(self.config.after)
+
+        saved = {}
+        for name, size in before.items():
+            if name not in after:
+                library = libraries.get(name.split("_")[0], "other")
+                saved[library] = saved.get(library, 0) + size
+
+        load_before = self.load_size(self.config.before)
+        load_after = self.load_size(self.config.after)
+
+        print("Load size: %d -> %d bytes (%d saved)" %
+              (load_before, load_after, load_before - load_after))
+        for library in sorted(saved):
+            print("  %-10s %8d bytes moved to ROM" % (library, saved[library]))
+
+        wrapped = [item["function_name"] for item in functions
+                   if "__wrap_" + item["function_name"] in after]
+        print("%d of %d functions called through the jump table" % (len(wrapped), len(functions)))
+
+        # These are called from their own translation unit, or are patched, and keep their whole
+        # object file in the image.
+        for item in functions:
+            if item["function_name"] in after:
+                print("  still linked: %s%s" % (item["function_name"],
+                                                " (patch)" if item["patch"] else ""))
+
 if __name__ == "__main__":
     APPS = {"genvar": VariableGenerator, "pre": IndexPreprocessor,
             "gentbl": TableGenerator, "genwrappers": WrapperGenerator,
-            "link-flags": LinkArgs}
+            "link-flags": LinkArgs, "report": SizeReport}
 
     if len(sys.argv) < 2 or sys.argv[1] not in APPS:
         print("usage: romlib_generator.py [%s] [args]" % "|".join(APPS.keys()), file=sys.stderr)
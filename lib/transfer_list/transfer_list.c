@@ -1,5 +1,6 @@
 /*
  * Copyright (c) 2023, Linaro Limited and Contributors. All rights reserved.
+ * Copyright (c) 2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -13,6 +14,39 @@
 #include <lib/transfer_list.h>
 #include <lib/utils_def.h>
 
+/*
+ * Number of entries transfer_list_find() remembers the offsets of, so that
+ * looking them up again does not walk the list. 0 disables the cache. The
+ * cache relies on the lists only being changed through this library while
+ * the image runs.
+ */
+#ifndef TRANSFER_LIST_FIND_CACHE_SIZE
+#define TRANSFER_LIST_FIND_CACHE_SIZE	4U
+#endif
+
+#if TRANSFER_LIST_FIND_CACHE_SIZE
+static struct {
+	const struct transfer_list_header *tl;
+	uint32_t tag_id;
+	uint32_t offset;
+} find_cache[TRANSFER_LIST_FIND_CACHE_SIZE];
+static unsigned int find_cache_next;
+#endif
+
+/* Forget the entries of a list whose entries may have moved */
+static void find_cache_invalidate(const struct transfer_list_header *tl)
+{
+#if TRANSFER_LIST_FIND_CACHE_SIZE
+	unsigned int i;
+
+	for (i = 0U; i < TRANSFER_LIST_FIND_CACHE_SIZE; i++) {
+		if (find_cache[i].tl == tl) {
+			find_cache[i].tl = NULL;
+		}
+	}
+#endif
+}
+
 void transfer_list_dump(struct transfer_list_header *tl)
 {
 	struct transfer_list_entry *te = NULL;
@@ -41,6 +75,17 @@ void transfer_list_dump(struct transfer_list_header *tl)
 		INFO("data_size  0x%x\n", te->data_size);
 		INFO("data_addr  0x%lx\n",
 		     (unsigned long)transfer_list_entry_data(te));
+		if (te->tag_id == TL_TAG_DATA_REF) {
+			const struct transfer_list_data_ref *ref =
+				transfer_list_entry_ref(tl, te);
+
+			if (ref) {
+				INFO("ref_tag_id 0x%x\n", ref->tag_id);
+				INFO("ref_addr   0x%" PRIx64 "\n", ref->addr);
+				INFO("ref_size   0x%" PRIx64 "\n", ref->size);
+				INFO("ref_attr   0x%x\n", ref->attr);
+			}
+		}
 	}
 }
 
@@ -53,15 +98,14 @@ entry_point_info_t *
 transfer_list_set_handoff_args(struct transfer_list_header *tl,
 			       entry_point_info_t *ep_info)
 {
-	struct transfer_list_entry *te = NULL;
+	size_t dt_size __unused;
 	void *dt = NULL;
 
 	if (!ep_info || !tl || transfer_list_check_header(tl) == TL_OPS_NON) {
 		return NULL;
 	}
 
-	te = transfer_list_find(tl, TL_TAG_FDT);
-	dt = transfer_list_entry_data(te);
+	dt = transfer_list_find_data(tl, TL_TAG_FDT, &dt_size, NULL);
 
 #ifdef __aarch64__
 	if (GET_RW(ep_info->spsr) == MODE_RW_64) {
@@ -100,6 +144,8 @@ struct transfer_list_header *transfer_list_init(void *addr, size_t max_size)
 		return NULL;
 	}
 
+	find_cache_invalidate(tl);
+
 	memset(tl, 0, max_size);
 	tl->signature = TRANSFER_LIST_SIGNATURE;
 	tl->version = TRANSFER_LIST_VERSION;
@@ -147,6 +193,8 @@ transfer_list_relocate(struct transfer_list_header *tl, void *addr,
 	}
 
 	new_tl = (struct transfer_list_header *)new_addr;
+	find_cache_invalidate(tl);
+	find_cache_invalidate(new_tl);
 	memmove(new_tl, tl, tl->size);
 	new_tl->max_size = new_max_size;
 
@@ -257,22 +305,55 @@ struct transfer_list_entry *transfer_list_next(struct transfer_list_header *tl,
 }
 
 /*******************************************************************************
- * Calculate the byte sum of a transfer list
- * Return byte sum of the transfer list
+ * Calculate the byte sum of a memory region
+ * Return byte sum of the region
  ******************************************************************************/
-static uint8_t calc_byte_sum(const struct transfer_list_header *tl)
+static uint8_t byte_sum(const void *addr, size_t size)
 {
-	uint8_t *b = (uint8_t *)tl;
+	const uint8_t *b = addr;
 	uint8_t cs = 0;
 	size_t n = 0;
 
-	for (n = 0; n < tl->size; n++) {
+	for (n = 0; n < size; n++) {
 		cs += b[n];
 	}
 
 	return cs;
 }
 
+/*******************************************************************************
+ * Calculate the byte sum of a transfer list
+ * Return byte sum of the transfer list
+ ******************************************************************************/
+static uint8_t calc_byte_sum(const struct transfer_list_header *tl)
+{
+	return byte_sum(tl, tl->size);
+}
+
+/*******************************************************************************
+ * Calculate the byte sum of a transfer list header, less its checksum
+ * Return byte sum of the header
+ ******************************************************************************/
+static uint8_t calc_hdr_byte_sum(const struct transfer_list_header *tl)
+{
+	return byte_sum(tl, sizeof(*tl)) - tl->checksum;
+}
+
+/*******************************************************************************
+ * Keep the byte sum of a transfer list at zero after bytes of the list whose
+ * sum was old_sum changed to bytes whose sum is new_sum, without summing the
+ * whole list again. A checksum which was wrong stays wrong by the same amount.
+ ******************************************************************************/
+static void adjust_checksum(struct transfer_list_header *tl, uint8_t old_sum,
+			    uint8_t new_sum)
+{
+	if (!(tl->flags & TL_FLAGS_HAS_CHECKSUM)) {
+		return;
+	}
+
+	tl->checksum -= (uint8_t)(new_sum - old_sum);
+}
+
 /*******************************************************************************
  * Update the checksum of a transfer list
  * Return updated checksum of the transfer list
@@ -292,6 +373,24 @@ void transfer_list_update_checksum(struct transfer_list_header *tl)
 	assert(transfer_list_verify_checksum(tl));
 }
 
+/*******************************************************************************
+ * Update the checksum of a transfer list after the data of one of its entries
+ * has been written in place, given the byte sum of the data before. The data
+ * of an entry added without data is zeroed, so its byte sum is 0. Only the
+ * data of the entry is summed, not the whole list.
+ ******************************************************************************/
+void transfer_list_update_entry_checksum(struct transfer_list_header *tl,
+					 struct transfer_list_entry *te,
+					 uint8_t old_data_sum)
+{
+	if (!tl || !te) {
+		return;
+	}
+
+	adjust_checksum(tl, old_data_sum,
+			byte_sum(transfer_list_entry_data(te), te->data_size));
+}
+
 /*******************************************************************************
  * Verify the checksum of a transfer list
  * Return true if verified or false if not
@@ -322,6 +421,8 @@ bool transfer_list_set_data_size(struct transfer_list_header *tl,
 	size_t gap = 0;
 	size_t mov_dis = 0;
 	size_t sz = 0;
+	uintptr_t end = 0;
+	uint8_t old_sum = 0;
 
 	if (!tl || !te) {
 		return false;
@@ -355,12 +456,20 @@ bool transfer_list_set_data_size(struct transfer_list_header *tl,
 		    tl->size + mov_dis > tl->max_size) {
 			return false;
 		}
+		/* the entries after this one change place */
+		find_cache_invalidate(tl);
+		old_sum = calc_hdr_byte_sum(tl) +
+			  byte_sum(te, tl_old_ev - (uintptr_t)te);
 		ru_new_ev = old_ev + mov_dis;
 		memmove((void *)ru_new_ev, (void *)old_ev, tl_old_ev - old_ev);
 		tl->size += mov_dis;
 		gap = ru_new_ev - new_ev;
+		end = tl_old_ev + mov_dis;
 	} else {
+		old_sum = calc_hdr_byte_sum(tl) +
+			  byte_sum(te, old_ev - (uintptr_t)te);
 		gap = old_ev - new_ev;
+		end = old_ev;
 	}
 
 	if (gap >= sizeof(*dummy_te)) {
@@ -373,7 +482,9 @@ bool transfer_list_set_data_size(struct transfer_list_header *tl,
 
 	te->data_size = new_data_size;
 
-	transfer_list_update_checksum(tl);
+	/* only the entry and the ones moved after it changed */
+	adjust_checksum(tl, old_sum, calc_hdr_byte_sum(tl) +
+			byte_sum(te, end - (uintptr_t)te));
 	return true;
 }
 
@@ -384,11 +495,14 @@ bool transfer_list_set_data_size(struct transfer_list_header *tl,
 bool transfer_list_rem(struct transfer_list_header *tl,
 		       struct transfer_list_entry *te)
 {
+	uint8_t old_sum;
+
 	if (!tl || !te || (uintptr_t)te > (uintptr_t)tl + tl->size) {
 		return false;
 	}
+	old_sum = byte_sum(te, sizeof(*te));
 	te->tag_id = TL_TAG_EMPTY;
-	transfer_list_update_checksum(tl);
+	adjust_checksum(tl, old_sum, byte_sum(te, sizeof(*te)));
 	return true;
 }
 
@@ -406,6 +520,7 @@ struct transfer_list_entry *transfer_list_add(struct transfer_list_header *tl,
 	struct transfer_list_entry *te = NULL;
 	uint8_t *te_data = NULL;
 	size_t sz = 0;
+	uint8_t old_sum;
 
 	if (!tl) {
 		return NULL;
@@ -425,22 +540,28 @@ struct transfer_list_entry *transfer_list_add(struct transfer_list_header *tl,
 		return NULL;
 	}
 
+	old_sum = calc_hdr_byte_sum(tl);
 	te = (struct transfer_list_entry *)tl_ev;
 	te->tag_id = tag_id;
 	te->hdr_size = sizeof(*te);
 	te->data_size = data_size;
 	tl->size += ev - tl_ev;
 
+	/* get TE data pointer */
+	te_data = transfer_list_entry_data(te);
+	if (!te_data) {
+		return NULL;
+	}
 	if (data) {
-		/* get TE data pointer */
-		te_data = transfer_list_entry_data(te);
-		if (!te_data) {
-			return NULL;
-		}
 		memmove(te_data, data, data_size);
+	} else {
+		/* known contents for transfer_list_update_entry_checksum() */
+		memset(te_data, 0, data_size);
 	}
 
-	transfer_list_update_checksum(tl);
+	/* only the header and the new entry changed */
+	adjust_checksum(tl, old_sum,
+			calc_hdr_byte_sum(tl) + byte_sum(te, ev - tl_ev));
 
 	return te;
 }
@@ -485,14 +606,93 @@ transfer_list_add_with_align(struct transfer_list_header *tl, uint32_t tag_id,
 
 	te = transfer_list_add(tl, tag_id, data_size, data);
 
-	if (alignment > tl->alignment) {
+	if (te && (alignment > tl->alignment)) {
+		uint8_t old_sum = calc_hdr_byte_sum(tl);
+
 		tl->alignment = alignment;
-		transfer_list_update_checksum(tl);
+		adjust_checksum(tl, old_sum, calc_hdr_byte_sum(tl));
 	}
 
 	return te;
 }
 
+/*******************************************************************************
+ * Check the fields of a reference to data left in place in memory: the data
+ * must be non-empty, addressable and must not overlap the list itself, which
+ * may be relocated over it
+ * Return true if valid or false if not
+ ******************************************************************************/
+static bool data_ref_is_valid(const struct transfer_list_header *tl,
+			      uint32_t tag_id, uint64_t addr, uint64_t size,
+			      uint32_t attr)
+{
+	uint64_t end;
+
+	if ((tag_id == TL_TAG_EMPTY) || (tag_id == TL_TAG_DATA_REF) ||
+	    (tag_id > 0xffffffU) || ((attr & ~TL_REF_ATTR_MASK) != 0U)) {
+		return false;
+	}
+
+	if ((addr == 0U) || (size == 0U) || add_overflow(addr, size, &end) ||
+	    ((uint64_t)(uintptr_t)(end - 1U) != (end - 1U))) {
+		return false;
+	}
+
+	return (end <= (uintptr_t)tl) ||
+	       (addr >= ((uintptr_t)tl + tl->max_size));
+}
+
+/*******************************************************************************
+ * Add an entry referencing data with the specified tag id which is already in
+ * place in memory, so that the data is neither copied into the list nor moved
+ * with it. The data must stay where it is for as long as the list is used.
+ * Return pointer to the added TL_TAG_DATA_REF entry or NULL on error
+ ******************************************************************************/
+struct transfer_list_entry *
+transfer_list_add_ref(struct transfer_list_header *tl, uint32_t tag_id,
+		      uintptr_t addr, size_t size, uint32_t attr)
+{
+	struct transfer_list_data_ref ref = {
+		.addr = addr,
+		.size = size,
+		.tag_id = tag_id,
+		.attr = attr,
+	};
+
+	if (!tl || !data_ref_is_valid(tl, tag_id, addr, size, attr)) {
+		return NULL;
+	}
+
+	return transfer_list_add(tl, TL_TAG_DATA_REF, sizeof(ref), &ref);
+}
+
+/*******************************************************************************
+ * Retrieve the reference held by a TL_TAG_DATA_REF transfer entry
+ * Return pointer to the validated reference or NULL on error
+ ******************************************************************************/
+const struct transfer_list_data_ref *
+transfer_list_entry_ref(const struct transfer_list_header *tl,
+			struct transfer_list_entry *entry)
+{
+	const struct transfer_list_data_ref *ref;
+
+	if (!tl || !entry || (entry->tag_id != TL_TAG_DATA_REF)) {
+		return NULL;
+	}
+
+	ref = transfer_list_entry_data(entry);
+	if ((entry->data_size != sizeof(*ref)) ||
+	    !is_aligned((uintptr_t)ref, sizeof(uint64_t)) ||
+	    !data_ref_is_valid(tl, ref->tag_id, ref->addr, ref->size,
+			       ref->attr)) {
+		ERROR("Bad transfer list data reference at %p\n",
+		      (void *)entry);
+		return NULL;
+	}
+
+	return ref;
+}
+
 /*******************************************************************************
  * Search for an existing transfer entry with the specified tag id from a
  * transfer list
@@ -502,14 +702,91 @@ struct transfer_list_entry *transfer_list_find(struct transfer_list_header *tl,
 					       uint32_t tag_id)
 {
 	struct transfer_list_entry *te = NULL;
+#if TRANSFER_LIST_FIND_CACHE_SIZE
+	unsigned int i;
+
+	for (i = 0U; tl && (i < TRANSFER_LIST_FIND_CACHE_SIZE); i++) {
+		if ((find_cache[i].tl != tl) ||
+		    (find_cache[i].tag_id != tag_id)) {
+			continue;
+		}
+
+		/* the entry may have been removed since */
+		te = (struct transfer_list_entry *)((uintptr_t)tl +
+						    find_cache[i].offset);
+		if (((find_cache[i].offset + sizeof(*te)) <= tl->size) &&
+		    (te->tag_id == tag_id) &&
+		    (te->hdr_size >= sizeof(*te)) &&
+		    ((find_cache[i].offset + te->hdr_size + te->data_size) <=
+		     tl->size)) {
+			return te;
+		}
+
+		find_cache[i].tl = NULL;
+		te = NULL;
+		break;
+	}
+#endif
 
 	do {
 		te = transfer_list_next(tl, te);
 	} while (te && (te->tag_id != tag_id));
 
+#if TRANSFER_LIST_FIND_CACHE_SIZE
+	if (te && (tag_id != TL_TAG_EMPTY)) {
+		i = find_cache_next;
+		find_cache_next = (i + 1U) % TRANSFER_LIST_FIND_CACHE_SIZE;
+		find_cache[i].tl = tl;
+		find_cache[i].tag_id = tag_id;
+		find_cache[i].offset = (uint32_t)((uintptr_t)te - (uintptr_t)tl);
+	}
+#endif
+
 	return te;
 }
 
+/*******************************************************************************
+ * Search for the data with the specified tag id from a transfer list, whether
+ * it is held by an entry with that tag id or referenced by a TL_TAG_DATA_REF
+ * entry. The size of the data is returned in @size and, if @ref is not NULL,
+ * the reference in @ref, or NULL if the data is in the list.
+ * Return pointer to the data or NULL if not found
+ ******************************************************************************/
+void *transfer_list_find_data(struct transfer_list_header *tl, uint32_t tag_id,
+			      size_t *size,
+			      const struct transfer_list_data_ref **ref)
+{
+	const struct transfer_list_data_ref *r = NULL;
+	struct transfer_list_entry *te;
+	void *data = NULL;
+
+	te = transfer_list_find(tl, tag_id);
+	if (te) {
+		data = transfer_list_entry_data(te);
+		*size = te->data_size;
+	} else {
+		while ((te = transfer_list_next(tl, te)) != NULL) {
+			if (te->tag_id != TL_TAG_DATA_REF) {
+				continue;
+			}
+
+			r = transfer_list_entry_ref(tl, te);
+			if (r && (r->tag_id == tag_id)) {
+				data = (void *)(uintptr_t)r->addr;
+				*size = r->size;
+				break;
+			}
+			r = NULL;
+		}
+	}
+
+	if (ref) {
+		*ref = r;
+	}
+
+	return data;
+}
+
 /*******************************************************************************
  * Retrieve the data pointer of a specified transfer entry
  * Return pointer to the transfer entry data or NULL on error
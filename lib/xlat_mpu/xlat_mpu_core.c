@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2021-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -315,9 +315,76 @@ void mmap_add_ctx(xlat_ctx_t *ctx, const mmap_region_t *mm)
 	}
 }
 
+/*
+ * Returns true if region 'next' starts right where region 'mm' ends and both
+ * can be described by a single MPU region.
+ */
+static bool __init mmap_regions_mergeable(const mmap_region_t *mm,
+					  const mmap_region_t *next)
+{
+	if (mm->attr != next->attr) {
+		return false;
+	}
+
+#if PLAT_XLAT_TABLES_DYNAMIC
+	/* Dynamic regions are removed with the base and size they were added */
+	if ((mm->attr & MT_DYNAMIC) != 0U) {
+		return false;
+	}
+#endif /* PLAT_XLAT_TABLES_DYNAMIC */
+
+	return (mm->base_pa + mm->size) == next->base_pa;
+}
+
+/*
+ * Coalesce the regions of the mmap array that are adjacent and have the same
+ * attributes, so that each group of them only takes one MPU region. The MPU
+ * does not translate addresses, so adjacent PAs also mean adjacent VAs.
+ * Returns the number of regions left in the array.
+ */
+static unsigned int __init mmap_merge_regions(xlat_ctx_t *ctx)
+{
+	mmap_region_t *mm = ctx->mmap;
+	unsigned int count = 0U;
+	unsigned int i, j;
+
+	while (mm[count].size != 0U) {
+		count++;
+	}
+
+	i = 0U;
+	while (i < count) {
+		for (j = 0U; j < count; j++) {
+			if ((j != i) && mmap_regions_mergeable(&mm[i], &mm[j])) {
+				break;
+			}
+		}
+
+		if (j == count) {
+			i++;
+			continue;
+		}
+
+		/*
+		 * Grow mm[i] over mm[j] and remove mm[j], moving the empty
+		 * sentinel down as well. Start again from the first region as
+		 * the indices have changed.
+		 */
+		mm[i].size += mm[j].size;
+		(void)memmove(&mm[j], &mm[j + 1U],
+			      (count - j) * sizeof(mmap_region_t));
+		count--;
+		i = 0U;
+	}
+
+	return count;
+}
+
 void __init init_xlat_tables_ctx(xlat_ctx_t *ctx)
 {
 	uint64_t mair = UL(0);
+	unsigned int regions = 0U;
+	unsigned int slots;
 
 	assert(ctx != NULL);
 	assert(!ctx->initialized);
@@ -335,6 +402,19 @@ void __init init_xlat_tables_ctx(xlat_ctx_t *ctx)
 
 	xlat_mmap_print(mm);
 
+	while (mm[regions].size != 0U) {
+		regions++;
+	}
+	slots = mmap_merge_regions(ctx);
+	INFO("xlat_mpu: %u MPU regions used for %u memory regions\n",
+	     slots, regions);
+
+	if (slots > (unsigned int)N_MPU_REGIONS) {
+		ERROR("Not enough MPU regions: %u needed, %u available\n",
+		      slots, (unsigned int)N_MPU_REGIONS);
+		panic();
+	}
+
 	/* All tables must be zeroed before mapping any region. */
 
 	for (unsigned int i = 0U; i < ctx->base_table_entries; i++)
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -119,6 +119,46 @@ void xlat_arch_tlbi_va(uintptr_t va, int xlat_regime)
 	}
 }
 
+void xlat_arch_tlbi_va_range(uintptr_t va, size_t size, int xlat_regime)
+{
+	size_t pages = size / PAGE_SIZE;
+
+	assert((size % PAGE_SIZE) == 0U);
+
+	if (pages > PLAT_XLAT_TLBI_VA_MAX_PAGES) {
+		xlat_arch_tlbi_all(xlat_regime);
+		return;
+	}
+
+	dsbishst();
+
+	for (; pages > 0U; pages--) {
+		if (xlat_regime == EL1_EL0_REGIME) {
+			tlbimvaais(TLBI_ADDR(va));
+		} else {
+			assert(xlat_regime == EL2_REGIME);
+			tlbimvahis(TLBI_ADDR(va));
+		}
+		va += PAGE_SIZE;
+	}
+}
+
+void xlat_arch_tlbi_all(int xlat_regime)
+{
+	/*
+	 * Ensure the translation table writes have drained into memory before
+	 * invalidating the TLB entries.
+	 */
+	dsbishst();
+
+	if (xlat_regime == EL1_EL0_REGIME) {
+		tlbiallis();
+	} else {
+		assert(xlat_regime == EL2_REGIME);
+		tlbiallhis();
+	}
+}
+
 void xlat_arch_tlbi_va_sync(void)
 {
 	/* Invalidate all entries from branch predictors. */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -178,14 +178,8 @@ uint64_t xlat_arch_regime_get_xn_desc(int xlat_regime)
 	}
 }
 
-void xlat_arch_tlbi_va(uintptr_t va, int xlat_regime)
+static void tlbi_va(uintptr_t va, int xlat_regime)
 {
-	/*
-	 * Ensure the translation table write has drained into memory before
-	 * invalidating the TLB entry.
-	 */
-	dsbishst();
-
 	/*
 	 * This function only supports invalidation of TLB entries for the EL3
 	 * and EL1&0 translation regimes.
@@ -206,6 +200,106 @@ void xlat_arch_tlbi_va(uintptr_t va, int xlat_regime)
 	}
 }
 
+static void tlbi_range(u_register_t op, int xlat_regime)
+{
+	if (xlat_regime == EL1_EL0_REGIME) {
+		assert(xlat_arch_current_el() >= 1U);
+		tlbirvaae1is(op);
+	} else if (xlat_regime == EL2_REGIME) {
+		assert(xlat_arch_current_el() >= 2U);
+		tlbirvae2is(op);
+	} else {
+		assert(xlat_regime == EL3_REGIME);
+		assert(xlat_arch_current_el() >= 3U);
+		tlbirvae3is(op);
+	}
+}
+
+void xlat_arch_tlbi_va(uintptr_t va, int xlat_regime)
+{
+	/*
+	 * Ensure the translation table write has drained into memory before
+	 * invalidating the TLB entry.
+	 */
+	dsbishst();
+
+	tlbi_va(va, xlat_regime);
+}
+
+void xlat_arch_tlbi_va_range(uintptr_t va, size_t size, int xlat_regime)
+{
+	size_t pages = size / PAGE_SIZE;
+	unsigned int scale;
+
+	assert((size % PAGE_SIZE) == 0U);
+
+	/*
+	 * Without FEAT_TLBIRANGE, or for more pages than the largest scale can
+	 * describe, invalidate page by page or the whole regime.
+	 */
+	if (!is_feat_tlbirange_present() ||
+	    (pages >> (5U * TLBI_RANGE_SCALE_MAX + 6U)) != 0U) {
+		if (pages > PLAT_XLAT_TLBI_VA_MAX_PAGES) {
+			xlat_arch_tlbi_all(xlat_regime);
+			return;
+		}
+
+		dsbishst();
+		for (; pages > 0U; pages--) {
+			tlbi_va(va, xlat_regime);
+			va += PAGE_SIZE;
+		}
+		return;
+	}
+
+	dsbishst();
+
+	/* Range operations can only cover an even number of pages */
+	if ((pages % 2U) != 0U) {
+		tlbi_va(va, xlat_regime);
+		va += PAGE_SIZE;
+		pages--;
+	}
+
+	/*
+	 * Each scale covers 5 more bits of the page count, starting from the
+	 * lowest ones so that every operation starts where the previous one
+	 * stopped.
+	 */
+	for (scale = 0U; pages > 0U; scale++) {
+		unsigned int shift = (5U * scale) + 1U;
+		unsigned int num = (unsigned int)(pages >> shift) &
+				   TLBI_RANGE_NUM_MASK;
+
+		if (num != 0U) {
+			tlbi_range(TLBI_RANGE(va, num - 1U, scale), xlat_regime);
+			va += ((size_t)num << shift) * PAGE_SIZE;
+			pages -= (size_t)num << shift;
+		}
+	}
+}
+
+void xlat_arch_tlbi_all(int xlat_regime)
+{
+	/*
+	 * Ensure the translation table writes have drained into memory before
+	 * invalidating the TLB entries.
+	 */
+	dsbishst();
+
+	if (xlat_regime == EL1_EL0_REGIME) {
+		assert(xlat_arch_current_el() >= 1U);
+		tlbivmalle1is();
+	} else if (xlat_regime == EL2_REGIME) {
+		assert(xlat_arch_current_el() >= 2U);
+		tlbialle2is();
+	} else {
+		assert(xlat_regime == EL3_REGIME);
+		assert(xlat_arch_current_el() >= 3U);
+		tlbialle3is();
+	}
+}
+
 void xlat_arch_tlbi_va_sync(void)
 {
 	/*
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -42,29 +42,62 @@ static inline __attribute__((unused)) void xlat_clean_dcache_range(uintptr_t add
  */
 static int xlat_table_get_index(const xlat_ctx_t *ctx, const uint64_t *table)
 {
-	for (int i = 0; i < ctx->tables_num; i++)
-		if (ctx->tables[i] == table)
-			return i;
+	uintptr_t offset = (uintptr_t)table - (uintptr_t)ctx->tables;
 
 	/*
 	 * Maybe we were asked to get the index of the base level table, which
 	 * should never happen.
 	 */
-	assert(false);
+	assert((offset % sizeof(ctx->tables[0])) == 0U);
+	assert((offset / sizeof(ctx->tables[0])) <
+	       (unsigned int)ctx->tables_num);
 
-	return -1;
+	return (int)(offset / sizeof(ctx->tables[0]));
 }
 
-/* Returns a pointer to an empty translation table. */
-static uint64_t *xlat_table_get_empty(const xlat_ctx_t *ctx)
+/*
+ * Released tables only contain invalid descriptors. They are kept in a list
+ * linked through their first entry, which holds the index of the next released
+ * table plus one, shifted so that the entry stays an invalid descriptor.
+ */
+#define XLAT_FREE_LINK_SHIFT	U(2)
+
+/*
+ * Returns a pointer to an empty translation table. The tables released by
+ * xlat_table_release() are reused first, then the ones never used so far.
+ */
+static uint64_t *xlat_table_get_empty(xlat_ctx_t *ctx)
 {
-	for (int i = 0; i < ctx->tables_num; i++)
-		if (ctx->tables_mapped_regions[i] == 0)
-			return ctx->tables[i];
+	uint64_t *table;
+
+	if (ctx->free_table >= 0) {
+		table = ctx->tables[ctx->free_table];
+		ctx->free_table = (int)(table[0] >> XLAT_FREE_LINK_SHIFT) - 1;
+		table[0] = INVALID_DESC;
+
+		return table;
+	}
+
+	if (ctx->next_table < ctx->tables_num)
+		return ctx->tables[ctx->next_table++];
 
 	return NULL;
 }
 
+/*
+ * Puts a table that no longer has any region mapped in it, and that is no
+ * longer referenced by any other table, back in the list of empty tables.
+ */
+static void xlat_table_release(xlat_ctx_t *ctx, uint64_t *table)
+{
+	assert(ctx->tables_mapped_regions[xlat_table_get_index(ctx, table)]
+	       == 0);
+	assert(table[0] == INVALID_DESC);
+
+	table[0] = (uint64_t)(ctx->free_table + 1) << XLAT_FREE_LINK_SHIFT;
+	ctx->free_table = xlat_table_get_index(ctx, table);
+}
+
 /* Increments region count for a given table. */
 static void xlat_table_inc_regions_count(const xlat_ctx_t *ctx,
 					 const uint64_t *table)
@@ -350,6 +383,32 @@ static action_t xlat_tables_unmap_region_action(const mmap_region_t *mm,
 
 	return action;
 }
+/*
+ * Invalidate the TLB entries of an entry just removed from the tables, or leave
+ * it to the commit of the open batch.
+ */
+static void xlat_tables_tlbi_va(xlat_ctx_t *ctx, uintptr_t va)
+{
+	if (ctx->batch) {
+		ctx->batch_tlbi_pending = true;
+	} else {
+		xlat_arch_tlbi_va(va, ctx->xlat_regime);
+	}
+}
+
+/*
+ * Complete the TLB invalidations left pending by the regions removed in the
+ * open batch.
+ */
+static void xlat_tables_batch_tlbi(xlat_ctx_t *ctx)
+{
+	if (ctx->batch_tlbi_pending) {
+		xlat_arch_tlbi_all(ctx->xlat_regime);
+		xlat_arch_tlbi_va_sync();
+		ctx->batch_tlbi_pending = false;
+	}
+}
+
 /*
  * Recursive function that writes to the translation tables and unmaps the
  * specified region.
@@ -389,7 +448,7 @@ static void xlat_tables_unmap_region(xlat_ctx_t *ctx, mmap_region_t *mm,
 		if (action == ACTION_WRITE_BLOCK_ENTRY) {
 
 			table_base[table_idx] = INVALID_DESC;
-			xlat_arch_tlbi_va(table_idx_va, ctx->xlat_regime);
+			xlat_tables_tlbi_va(ctx, table_idx_va);
 
 		} else if (action == ACTION_RECURSE_INTO_TABLE) {
 
@@ -408,8 +467,8 @@ static void xlat_tables_unmap_region(xlat_ctx_t *ctx, mmap_region_t *mm,
 			 */
 			if (xlat_table_is_empty(ctx, subtable)) {
 				table_base[table_idx] = INVALID_DESC;
-				xlat_arch_tlbi_va(table_idx_va,
-						  ctx->xlat_regime);
+				xlat_tables_tlbi_va(ctx, table_idx_va);
+				xlat_table_release(ctx, subtable);
 			}
 
 		} else {
@@ -561,6 +620,51 @@ static action_t xlat_tables_map_region_action(const mmap_region_t *mm,
 	}
 }
 
+#if XLAT_TABLES_CONT_HINT
+/*
+ * Returns true if the group of XLAT_CONT_ENTRIES entries starting at
+ * 'table_idx' can all be mapped by the specified region as blocks (or pages)
+ * with the Contiguous hint set. They must all be unused and the output address
+ * of the group must be aligned to its size.
+ */
+static bool xlat_tables_cont_group(const mmap_region_t *mm,
+				   const uint64_t *table_base,
+				   unsigned int table_entries,
+				   unsigned int table_idx,
+				   uintptr_t table_idx_va,
+				   unsigned int level)
+{
+	uintptr_t mm_end_va = mm->base_va + mm->size - 1U;
+	size_t group_size = XLAT_CONT_ENTRIES * XLAT_BLOCK_SIZE(level);
+	unsigned long long group_pa;
+
+	if ((level < MIN_LVL_BLOCK_DESC) ||
+	    (mm->granularity < XLAT_BLOCK_SIZE(level)) ||
+	    ((table_idx % XLAT_CONT_ENTRIES) != 0U) ||
+	    ((table_idx + XLAT_CONT_ENTRIES) > table_entries)) {
+		return false;
+	}
+
+	if ((table_idx_va < mm->base_va) || (table_idx_va > mm_end_va) ||
+	    ((mm_end_va - table_idx_va) < (group_size - 1U))) {
+		return false;
+	}
+
+	group_pa = mm->base_pa + table_idx_va - mm->base_va;
+	if ((group_pa & (group_size - 1U)) != 0U) {
+		return false;
+	}
+
+	for (unsigned int i = 0U; i < XLAT_CONT_ENTRIES; i++) {
+		if ((table_base[table_idx + i] & DESC_MASK) != INVALID_DESC) {
+			return false;
+		}
+	}
+
+	return true;
+}
+#endif /* XLAT_TABLES_CONT_HINT */
+
 /*
  * Recursive function that writes to the translation tables and maps the
  * specified region. On success, it returns the VA of the last byte that was
@@ -584,6 +688,9 @@ static uintptr_t xlat_tables_map_region(xlat_ctx_t *ctx, mmap_region_t *mm,
 	uint64_t desc;
 
 	unsigned int table_idx;
+#if XLAT_TABLES_CONT_HINT
+	uint64_t cont = 0U;
+#endif
 
 	table_idx_va = xlat_tables_find_start_va(mm, table_base_va, level);
 	table_idx = xlat_tables_va_to_index(table_base_va, table_idx_va, level);
@@ -595,6 +702,19 @@ static uintptr_t xlat_tables_map_region(xlat_ctx_t *ctx, mmap_region_t *mm,
 
 	while (table_idx < table_entries) {
 
+#if XLAT_TABLES_CONT_HINT
+		/*
+		 * Decide at the start of each group whether all its entries get
+		 * the Contiguous hint. A group the region only starts in the
+		 * middle of can't be fully covered by it.
+		 */
+		if ((table_idx % XLAT_CONT_ENTRIES) == 0U) {
+			cont = xlat_tables_cont_group(mm, table_base,
+					table_entries, table_idx, table_idx_va,
+					level) ? UPPER_ATTRS(CONT_HINT) : 0U;
+		}
+#endif
+
 		desc = table_base[table_idx];
 
 		table_idx_pa = mm->base_pa + table_idx_va - mm->base_va;
@@ -608,6 +728,9 @@ static uintptr_t xlat_tables_map_region(xlat_ctx_t *ctx, mmap_region_t *mm,
 			table_base[table_idx] =
 				xlat_desc(ctx, (uint32_t)mm->attr, table_idx_pa,
 					  level);
+#if XLAT_TABLES_CONT_HINT
+			table_base[table_idx] |= cont;
+#endif
 
 		} else if (action == ACTION_CREATE_NEW_TABLE) {
 			uintptr_t end_va;
@@ -968,6 +1091,12 @@ int mmap_add_dynamic_region_ctx(xlat_ctx_t *ctx, mmap_region_t *mm)
 	if (ret != 0)
 		return ret;
 
+	/*
+	 * The new region may reuse translations removed earlier in the batch,
+	 * their TLB entries must be gone before it is mapped.
+	 */
+	xlat_tables_batch_tlbi(ctx);
+
 	/*
 	 * Find the adequate entry in the mmap array in the same way done for
 	 * static regions in mmap_add_region_ctx().
@@ -1044,9 +1173,12 @@ int mmap_add_dynamic_region_ctx(xlat_ctx_t *ctx, mmap_region_t *mm)
 		 * Make sure that all entries are written to the memory. There
 		 * is no need to invalidate entries when mapping dynamic regions
 		 * because new table/block/page descriptors only replace old
-		 * invalid descriptors, that aren't TLB cached.
+		 * invalid descriptors, that aren't TLB cached. The commit of an
+		 * open batch does it for all its regions.
 		 */
-		dsbishst();
+		if (!ctx->batch) {
+			dsbishst();
+		}
 	}
 
 	if (end_pa > ctx->max_pa)
@@ -1123,7 +1255,9 @@ int mmap_remove_dynamic_region_ctx(xlat_ctx_t *ctx, uintptr_t base_va,
 		xlat_clean_dcache_range((uintptr_t)ctx->base_table,
 			ctx->base_table_entries * sizeof(uint64_t));
 #endif
-		xlat_arch_tlbi_va_sync();
+		if (!ctx->batch) {
+			xlat_arch_tlbi_va_sync();
+		}
 	}
 
 	/* Remove this region by moving the rest down by one place. */
@@ -1153,6 +1287,31 @@ int mmap_remove_dynamic_region_ctx(xlat_ctx_t *ctx, uintptr_t base_va,
 	return 0;
 }
 
+void mmap_dynamic_batch_begin_ctx(xlat_ctx_t *ctx)
+{
+	assert(!ctx->batch);
+
+	ctx->batch = true;
+}
+
+void mmap_dynamic_batch_commit_ctx(xlat_ctx_t *ctx)
+{
+	assert(ctx->batch);
+
+	ctx->batch = false;
+
+	if (!ctx->initialized) {
+		return;
+	}
+
+	if (ctx->batch_tlbi_pending) {
+		xlat_tables_batch_tlbi(ctx);
+	} else {
+		/* Make sure the entries of the added regions are written */
+		dsbishst();
+	}
+}
+
 void xlat_setup_dynamic_ctx(xlat_ctx_t *ctx, unsigned long long pa_max,
 			    uintptr_t va_max, struct mmap_region *mmap,
 			    unsigned int mmap_num, uint64_t **tables,
@@ -1177,10 +1336,14 @@ void xlat_setup_dynamic_ctx(xlat_ctx_t *ctx, unsigned long long pa_max,
 	ctx->base_table_entries = GET_NUM_BASE_LEVEL_ENTRIES(va_space_size);
 
 	ctx->tables_mapped_regions = mapped_regions;
+	ctx->next_table = 0;
+	ctx->free_table = -1;
 
 	ctx->max_pa = 0;
 	ctx->max_va = 0;
 	ctx->initialized = 0;
+	ctx->batch = false;
+	ctx->batch_tlbi_pending = false;
 }
 
 #endif /* PLAT_XLAT_TABLES_DYNAMIC */
@@ -1208,6 +1371,10 @@ void __init init_xlat_tables_ctx(xlat_ctx_t *ctx)
 	for (unsigned int i = 0U; i < ctx->base_table_entries; i++)
 		ctx->base_table[i] = INVALID_DESC;
 
+#if PLAT_XLAT_TABLES_DYNAMIC
+	ctx->next_table = 0;
+	ctx->free_table = -1;
+#endif
 	for (int j = 0; j < ctx->tables_num; j++) {
 #if PLAT_XLAT_TABLES_DYNAMIC
 		ctx->tables_mapped_regions[j] = 0;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2021, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -38,6 +38,22 @@
 
 #endif /* PLAT_XLAT_TABLES_DYNAMIC */
 
+#if XLAT_TABLES_CONT_HINT
+/*
+ * Number of adjacent entries of a translation table that the Contiguous hint
+ * groups together with a 4KB granule.
+ */
+#define XLAT_CONT_ENTRIES		U(16)
+#endif
+
+/*
+ * Maximum number of pages invalidated one by one when the range TLB
+ * invalidation instructions are not available.
+ */
+#ifndef PLAT_XLAT_TLBI_VA_MAX_PAGES
+#define PLAT_XLAT_TLBI_VA_MAX_PAGES	U(64)
+#endif
+
 extern uint64_t mmu_cfg_params[MMU_CFG_PARAM_MAX];
 
 /* Determine the physical address space encoded in the 'attr' parameter. */
@@ -62,12 +78,28 @@ uint64_t xlat_arch_regime_get_xn_desc(int xlat_regime);
  */
 void xlat_arch_tlbi_va(uintptr_t va, int xlat_regime);
 
+/*
+ * Invalidate all TLB entries that match the 'size' bytes starting at the given
+ * virtual address. It uses the FEAT_TLBIRANGE instructions when they are
+ * implemented. Otherwise the pages are invalidated one by one, or the whole
+ * translation regime is when there are more than PLAT_XLAT_TLBI_VA_MAX_PAGES
+ * of them.
+ */
+void xlat_arch_tlbi_va_range(uintptr_t va, size_t size, int xlat_regime);
+
 /*
  * This function has to be called at the end of any code that uses the function
- * xlat_arch_tlbi_va().
+ * xlat_arch_tlbi_va() or xlat_arch_tlbi_va_range().
  */
 void xlat_arch_tlbi_va_sync(void);
 
+/*
+ * Invalidate all the TLB entries of the specified translation regime in the
+ * Inner Shareable domain. As for xlat_arch_tlbi_va(), it has to be followed by
+ * xlat_arch_tlbi_va_sync().
+ */
+void xlat_arch_tlbi_all(int xlat_regime);
+
 /* Print VA, PA, size and attributes of all regions in the mmap array. */
 void xlat_mmap_print(const mmap_region_t *mmap);
 
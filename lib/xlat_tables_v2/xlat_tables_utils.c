@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -223,7 +223,7 @@ static void xlat_tables_print_internal(xlat_ctx_t *ctx, uintptr_t table_base_va,
 void xlat_tables_print(xlat_ctx_t *ctx)
 {
 	const char *xlat_regime_str;
-	int used_page_tables;
+	unsigned int used_page_tables, max_used_page_tables;
 
 	if (ctx->xlat_regime == EL1_EL0_REGIME) {
 		xlat_regime_str = "1&0";
@@ -244,18 +244,10 @@ void xlat_tables_print(xlat_ctx_t *ctx)
 	VERBOSE("  Entries @initial lookup level: %u\n",
 		ctx->base_table_entries);
 
-#if PLAT_XLAT_TABLES_DYNAMIC
-	used_page_tables = 0;
-	for (int i = 0; i < ctx->tables_num; ++i) {
-		if (ctx->tables_mapped_regions[i] != 0)
-			++used_page_tables;
-	}
-#else
-	used_page_tables = ctx->next_table;
-#endif
-	VERBOSE("  Used %d sub-tables out of %d (spare: %d)\n",
+	xlat_get_tables_usage_ctx(ctx, &used_page_tables, &max_used_page_tables);
+	VERBOSE("  Used %u sub-tables out of %d (spare: %d, max used: %u)\n",
 		used_page_tables, ctx->tables_num,
-		ctx->tables_num - used_page_tables);
+		ctx->tables_num - (int)used_page_tables, max_used_page_tables);
 
 	xlat_tables_print_internal(ctx, 0U, ctx->base_table,
 				   ctx->base_table_entries, ctx->base_level);
@@ -263,6 +255,22 @@ void xlat_tables_print(xlat_ctx_t *ctx)
 
 #endif /* LOG_LEVEL >= LOG_LEVEL_VERBOSE */
 
+void xlat_get_tables_usage_ctx(const xlat_ctx_t *ctx, unsigned int *used,
+			       unsigned int *max_used)
+{
+#if PLAT_XLAT_TABLES_DYNAMIC
+	/* The released tables have no region mapped in them */
+	*used = 0U;
+	for (int i = 0; i < ctx->next_table; ++i) {
+		if (ctx->tables_mapped_regions[i] != 0)
+			++(*used);
+	}
+#else
+	*used = (unsigned int)ctx->next_table;
+#endif
+	*max_used = (unsigned int)ctx->next_table;
+}
+
 /*
  * Do a translation table walk to find the block or page descriptor that maps
  * virtual_addr.
@@ -497,8 +505,6 @@ int xlat_get_mem_attributes_ctx(const xlat_ctx_t *ctx, uintptr_t base_va,
 int xlat_change_mem_attributes_ctx(const xlat_ctx_t *ctx, uintptr_t base_va,
 				   size_t size, uint32_t attr)
 {
-	/* Note: This implementation isn't optimized. */
-
 	assert(ctx != NULL);
 	assert(ctx->initialized);
 
@@ -587,52 +593,123 @@ int xlat_change_mem_attributes_ctx(const xlat_ctx_t *ctx, uintptr_t base_va,
 	/* Restore original value. */
 	base_va = base_va_original;
 
-	for (unsigned int i = 0U; i < pages_count; ++i) {
-
-		uint32_t old_attr = 0U, new_attr;
-		uint64_t *entry = NULL;
+	/*
+	 * The pages are updated one translation table at a time, so that the
+	 * break-before-make sequence only needs one TLB invalidation for all
+	 * the entries of the table.
+	 */
+	while (pages_count > 0U) {
+		uint64_t *table;
 		unsigned int level = 0U;
-		unsigned long long addr_pa = 0ULL;
-
-		(void) xlat_get_mem_attributes_internal(ctx, base_va, &old_attr,
-					    &entry, &addr_pa, &level);
+		size_t table_pages, head = 0U, tail = 0U;
+		uintptr_t table_va;
 
 		/*
-		 * From attr, only MT_RO/MT_RW, MT_EXECUTE/MT_EXECUTE_NEVER and
-		 * MT_USER/MT_PRIVILEGED are taken into account. Any other
-		 * information is ignored.
+		 * All the pages have been checked to be mapped at the last
+		 * level, so the entries up to the end of the table are the
+		 * ones of the next pages.
 		 */
+		table_pages = XLAT_TABLE_ENTRIES -
+			      XLAT_TABLE_IDX(base_va, XLAT_TABLE_LEVEL_MAX);
+		if (table_pages > pages_count) {
+			table_pages = pages_count;
+		}
 
-		/* Clean the old attributes so that they can be rebuilt. */
-		new_attr = old_attr & ~(MT_RW | MT_EXECUTE_NEVER | MT_USER);
+		table = find_xlat_table_entry(base_va, ctx->base_table,
+					      ctx->base_table_entries,
+					      virt_addr_space_size, &level);
+		assert(table != NULL);
 
+#if XLAT_TABLES_CONT_HINT
 		/*
-		 * Update attributes, but filter out the ones this function
-		 * isn't allowed to change.
+		 * The entries of a group with the Contiguous hint must all stay
+		 * consistent, so the hint is removed from the whole groups at
+		 * both ends of the pages that are changed.
 		 */
-		new_attr |= attr & (MT_RW | MT_EXECUTE_NEVER | MT_USER);
+		if ((table[0] & UPPER_ATTRS(CONT_HINT)) != 0U) {
+			head = XLAT_TABLE_IDX(base_va, level) %
+			       XLAT_CONT_ENTRIES;
+		}
+		if ((table[table_pages - 1U] & UPPER_ATTRS(CONT_HINT)) != 0U) {
+			tail = XLAT_CONT_ENTRIES - 1U -
+			       ((XLAT_TABLE_IDX(base_va, level) + table_pages -
+				 1U) % XLAT_CONT_ENTRIES);
+		}
+#endif
+		table -= head;
+		table_va = base_va - (head * PAGE_SIZE);
+
+		for (size_t i = 0U; i < (head + table_pages + tail); ++i) {
+			uint32_t old_attr = 0U, new_attr;
+			uint64_t *entry = NULL;
+			unsigned long long addr_pa = 0ULL;
+			uint64_t desc;
+
+			if ((i < head) || (i >= (head + table_pages))) {
+				/* Outside of the range, only drop the hint */
+				desc = table[i] & ~UPPER_ATTRS(CONT_HINT);
+			} else {
+				(void) xlat_get_mem_attributes_internal(ctx,
+						table_va + (i * PAGE_SIZE),
+						&old_attr, &entry, &addr_pa,
+						&level);
+				assert(entry == &table[i]);
 
-		/*
-		 * The break-before-make sequence requires writing an invalid
-		 * descriptor and making sure that the system sees the change
-		 * before writing the new descriptor.
-		 */
-		*entry = INVALID_DESC;
+				/*
+				 * From attr, only MT_RO/MT_RW,
+				 * MT_EXECUTE/MT_EXECUTE_NEVER and
+				 * MT_USER/MT_PRIVILEGED are taken into account.
+				 * Any other information is ignored.
+				 */
+
+				/*
+				 * Clean the old attributes so that they can be
+				 * rebuilt.
+				 */
+				new_attr = old_attr &
+					   ~(MT_RW | MT_EXECUTE_NEVER | MT_USER);
+
+				/*
+				 * Update attributes, but filter out the ones
+				 * this function isn't allowed to change.
+				 */
+				new_attr |= attr &
+					    (MT_RW | MT_EXECUTE_NEVER | MT_USER);
+
+				desc = xlat_desc(ctx, new_attr, addr_pa, level);
+			}
+
+			/*
+			 * The break-before-make sequence requires writing an
+			 * invalid descriptor and making sure that the system
+			 * sees the change before writing the new descriptor.
+			 * Bit 0 clear is enough to make it invalid, the rest
+			 * of the new descriptor is kept in it until then.
+			 */
+			table[i] = desc & ~(uint64_t)DESC_VALID;
 #if !HW_ASSISTED_COHERENCY
-		dccvac((uintptr_t)entry);
+			dccvac((uintptr_t)&table[i]);
 #endif
-		/* Invalidate any cached copy of this mapping in the TLBs. */
-		xlat_arch_tlbi_va(base_va, ctx->xlat_regime);
+		}
+
+		/* Invalidate any cached copy of these mappings in the TLBs. */
+		xlat_arch_tlbi_va_range(table_va,
+					(head + table_pages + tail) * PAGE_SIZE,
+					ctx->xlat_regime);
 
 		/* Ensure completion of the invalidation. */
 		xlat_arch_tlbi_va_sync();
 
-		/* Write new descriptor */
-		*entry = xlat_desc(ctx, new_attr, addr_pa, level);
+		/* Write new descriptors */
+		for (size_t i = 0U; i < (head + table_pages + tail); ++i) {
+			table[i] |= DESC_VALID;
 #if !HW_ASSISTED_COHERENCY
-		dccvac((uintptr_t)entry);
+			dccvac((uintptr_t)&table[i]);
 #endif
-		base_va += PAGE_SIZE;
+		}
+
+		base_va += table_pages * PAGE_SIZE;
+		pages_count -= table_pages;
 	}
 
 	/* Ensure that the last descriptor written is seen by the system. */
@@ -23,3 +23,9 @@ INCLUDES	+=	-Iinclude/lib/zlib
 
 # REVISIT: the following flags need not be given globally
 TF_CFLAGS	+=	-DZ_SOLO -DDEF_WBITS=31
+
+# Z_SOLO leaves the 32-bit and 64-bit unsigned types undefined, which makes
+# crc32() fall back to a table lookup per byte. Give them, so that it processes
+# a word at a time, and uses the CRC32 instructions on AArch64 when the build
+# enables them (-march=armv8-a+crc or Armv8.1-A onwards).
+TF_CFLAGS	+=	-DZ_U4=__UINT32_TYPE__ -DZ_U8=__UINT64_TYPE__
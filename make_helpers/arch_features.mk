@@ -1,5 +1,5 @@
 #
-# Copyright (c) 2022-2024, Arm Limited. All rights reserved.
+# Copyright (c) 2022-2026, Arm Limited. All rights reserved.
 #
 # SPDX-License-Identifier: BSD-3-Clause
 #
@@ -83,6 +83,7 @@ endif
 
 # Enable the features which are mandatory from ARCH version 8.8 and upwards.
 ifeq "8.8" "$(word 1, $(sort 8.8 $(ARM_ARCH_MAJOR).$(ARM_ARCH_MINOR)))"
+armv8-8-a-feats         := ENABLE_FEAT_MOPS
 # 8.7 Compliant
 armv8-8-a-feats         += ${armv8-7-a-feats}
 FEAT_LIST               := ${armv8-8-a-feats}
@@ -240,6 +241,10 @@ ENABLE_FEAT_CSV2_2			?=	0
 # SCXTNUM_ELx register.
 ENABLE_FEAT_CSV2_3			?=	0
 
+# Flag to let BL1 and BL2 compute SHA-256 digests with the FEAT_SHA256
+# instructions instead of the crypto library's software implementation.
+ENABLE_FEAT_SHA256			?=	0
+
 # By default, disable access of trace system registers from NS lower
 # ELs  i.e. NS-EL2, or NS-EL1 if NS-EL2 implemented but unused if
 # system register trace is implemented. This feature is available if
@@ -284,6 +289,7 @@ ENABLE_FEAT_AMU				?=	0
 ENABLE_AMU_AUXILIARY_COUNTERS		?=	0
 ENABLE_AMU_FCONF			?=	0
 AMU_RESTRICT_COUNTERS			?=	1
+AMU_SNAPSHOT				?=	0
 
 # Build option to enable MPAM for lower ELs.
 # Enabling it by default
@@ -297,6 +303,9 @@ else ifeq (${ARCH},aarch32)
         endif
 endif
 
+# Build option to program the platform's MPAM partitions at boot.
+ENABLE_MPAM_PARTITIONING		?=	0
+
 # Include nested virtualization control (Armv8.4-NV) registers in cpu context.
 # This must be set to 1 if architecture implements Nested Virtualization
 # Extension and platform wants to use this feature in the Secure world.
@@ -346,6 +355,10 @@ ENABLE_FEAT_LS64_ACCDATA		?=	0
 # Flag to enable FEAT_THE (Translation Hardening Extension)
 ENABLE_FEAT_THE				?=	0
 
+# Flag to use the FEAT_MOPS memory copy and set instructions in EL3 and enable
+# them for the Non-secure EL1 and EL0.
+ENABLE_FEAT_MOPS			?=	0
+
 #----
 # 8.9
 #----
@@ -1,5 +1,5 @@
 #
-# Copyright (c) 2015-2024, Arm Limited and Contributors. All rights reserved.
+# Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
 #
 # SPDX-License-Identifier: BSD-3-Clause
 #
@@ -278,6 +278,15 @@ endef
 
 GZIP_SUFFIX := .gz
 
+# LZ4
+define LZ4_RULE
+$(1): $(2)
+	$(s)echo "  LZ4     $$@"
+	$(q)lz4 -9 -f -q --content-size $$< $$@
+endef
+
+LZ4_SUFFIX := .lz4
+
 ################################################################################
 # Auxiliary macros to build TF images from sources
 ################################################################################
@@ -582,9 +591,32 @@ define SOURCES_TO_DTBS
         $(notdir $(patsubst %.dts,%.dtb,$(filter %.dts,$(1))))
 endef
 
+# MAKE_DTBO generate a device tree overlay blob, keeping its symbols
+#   $(1) = output directory
+#   $(2) = input dts
+define MAKE_DTBO
+
+$(eval DOVLPRE := $(1)/$(patsubst %.dts,%.pre.dts,$(notdir $(2))))
+$(eval DOVLOBJ := $(1)/$(patsubst %.dts,%.dtbo,$(notdir $(2))))
+
+$(DOVLPRE): $(2) | $$$$(@D)/
+	$$(s)echo "  CPP     $$<"
+	$$(q)$($(ARCH)-cpp) -E $$(TF_CFLAGS_$(ARCH)) $$(DTC_CPPFLAGS) -MT $(DOVLPRE) -MMD -MF $(DOVLPRE).d -o $$@ $$<
+
+$(DOVLOBJ): $(DOVLPRE) | $$$$(@D)/
+	$$(s)echo "  DTC     $$<"
+	$$(q)$($(ARCH)-dtc) $$(DTC_FLAGS) -@ -o $$@ $$<
+
+-include $(DOVLPRE).d
+
+endef
+
 # MAKE_DTB generate the Flattened device tree binary
 #   $(1) = output directory
 #   $(2) = input dts
+#
+# The overlays listed in DTB_OVERLAYS_<dts basename>, if any, are merged into
+# the DTB at build time, so that it needs no overlay applied at boot.
 define MAKE_DTB
 
 # List of DTB file(s) to generate, based on DTS file basename list
@@ -595,15 +627,29 @@ $(eval DPRE := $(addprefix $(1)/,$(patsubst %.dts,%.pre.dts,$(notdir $(2)))))
 $(eval DTSDEP := $(patsubst %.dtb,%.o.d,$(DOBJ)))
 # Dependencies of the DT compilation on its pre-compiled DTS
 $(eval DTBDEP := $(patsubst %.dtb,%.d,$(DOBJ)))
+# Overlays to merge into the DTB, and their blobs
+$(eval DOVLS := $(DTB_OVERLAYS_$(basename $(notdir $(2)))))
+$(eval DOVLDIR := $(patsubst %.dtb,%-overlays,$(DOBJ)))
+$(eval DOVLOBJS := $(addprefix $(DOVLDIR)/,$(patsubst %.dts,%.dtbo,$(notdir $(DOVLS)))))
+# DTB the overlays are merged into
+$(eval DBASE := $(if $(DOVLS),$(patsubst %.dtb,%.base.dtb,$(DOBJ)),$(DOBJ)))
 
 $(DPRE): $(2) | $$$$(@D)/
 	$$(s)echo "  CPP     $$<"
 	$(eval DTBS       := $(addprefix $(1)/,$(call SOURCES_TO_DTBS,$(2))))
 	$$(q)$($(ARCH)-cpp) -E $$(TF_CFLAGS_$(ARCH)) $$(DTC_CPPFLAGS) -MT $(DTBS) -MMD -MF $(DTSDEP) -o $(DPRE) $$<
 
-$(DOBJ): $(DPRE) $(filter-out %.d,$(MAKEFILE_LIST)) | $$$$(@D)/
+$(DBASE): $(DPRE) $(filter-out %.d,$(MAKEFILE_LIST)) | $$$$(@D)/
 	$$(s)echo "  DTC     $$<"
-	$$(q)$($(ARCH)-dtc) $$(DTC_FLAGS) -d $(DTBDEP) -o $$@ $$<
+	$$(q)$($(ARCH)-dtc) $$(DTC_FLAGS) $(if $(DOVLS),-@) -d $(DTBDEP) -o $$@ $$<
+
+ifneq ($(DOVLS),)
+$(DOBJ): $(DBASE) $(DOVLOBJS)
+	$$(s)echo "  FDTOVL  $$@"
+	$$(q)$$(FDTOVERLAY) -i $(DBASE) -o $$@ $(DOVLOBJS)
+
+$(foreach ovl,$(DOVLS),$(call MAKE_DTBO,$(DOVLDIR),$(ovl)))
+endif
 
 -include $(DTBDEP)
 -include $(DTSDEP)
@@ -1,5 +1,5 @@
 #
-# Copyright (c) 2016-2024, Arm Limited. All rights reserved.
+# Copyright (c) 2016-2026, Arm Limited. All rights reserved.
 #
 # SPDX-License-Identifier: BSD-3-Clause
 #
@@ -22,6 +22,17 @@ ARCH				:= aarch64
 # ARM Architecture feature modifiers: none by default
 ARM_ARCH_FEATURE		:= none
 
+# Skip the signature checks of certificates found in the platform's verified
+# image cache
+AUTH_IMG_CACHE			:= 0
+
+# Cache the platform NV counters and write their upgrades once per boot stage
+AUTH_NV_CTR_CACHE		:= 0
+
+# Keep the public keys verified against the ROTPK, or parsed, for later
+# certificates signed with them
+AUTH_PK_CACHE			:= 0
+
 # ARM Architecture major and minor versions: 8.0 by default.
 ARM_ARCH_MAJOR			:= 8
 ARM_ARCH_MINOR			:= 0
@@ -42,6 +53,22 @@ BL2_IN_XIP_MEM			:= 0
 # Do dcache invalidate upon BL2 entry at EL3
 BL2_INV_DCACHE			:= 1
 
+# Overlap the read of each image with the authentication of the previous one
+BL2_PIPELINED_LOAD		:= 0
+
+# Group the code of the BL31 SMC and idle paths after the exception vectors
+BL31_HOT_TEXT			:= 0
+
+# Linker script fragment adding functions to the BL31 hot text, as written by
+# tools/el3_prof/el3_prof_report.py --hot-list
+BL31_HOT_TEXT_LIST		:=
+
+# Record a timeline of the boot stages and hand it over in the transfer list
+BOOT_TIMELINE			:= 0
+
+# Print the time BL2 spends on each step of loading each image
+BOOT_TIMELINE_REPORT		:= 0
+
 # Select the branch protection features to use.
 BRANCH_PROTECTION		:= 0
 
@@ -72,6 +99,9 @@ DEBUG				:= 0
 # By default disable authenticated decryption support.
 DECRYPTION_SUPPORT		:= none
 
+# Decrypt encrypted images chunk by chunk as they are read
+DECRYPTION_STREAM		:= 0
+
 # Build platform
 DEFAULT_PLAT			:= fvp
 
@@ -88,6 +118,9 @@ ENABLE_MPMM			:= 0
 # Enable MPMM configuration via FCONF.
 ENABLE_MPMM_FCONF		:= 0
 
+# Let the Normal world select the MPMM gear of each core at runtime.
+MPMM_GEAR_CONTROL		:= 0
+
 # Flag to Enable Position Independant support (PIE)
 ENABLE_PIE			:= 0
 
@@ -97,6 +130,9 @@ ENABLE_PMF			:= 0
 # Flag to enable PSCI STATs functionality
 ENABLE_PSCI_STAT		:= 0
 
+# Record EL3 events in per cpu trace rings that the Normal world can drain
+PMF_TRACE			:= 0
+
 # Flag to enable runtime instrumentation using PMF
 ENABLE_RUNTIME_INSTRUMENTATION	:= 0
 
@@ -106,6 +142,21 @@ ENABLE_STACK_PROTECTOR		:= 0
 # Flag to enable exception handling in EL3
 EL3_EXCEPTION_HANDLING		:= 0
 
+# Handle some EL3 interrupts on entry from a lower EL without saving the context
+EL3_FAST_INTR			:= 0
+
+# Emulate some trapped system registers without saving the context
+EL3_FAST_SYSREG_TRAP		:= 0
+
+# Run non-critical work queued by the SMC handlers when the CPU is idle
+DEFERRED_WORK			:= 0
+
+# Sample the PCs of the BL31 SMC handlers with the secure physical timer
+EL3_PROFILING			:= 0
+
+# Spread the maintenance of large address ranges over the cpus that are ON
+PARALLEL_CACHE_MAINT		:= 0
+
 # By default BL31 encryption disabled
 ENCRYPT_BL31			:= 0
 
@@ -124,6 +175,19 @@ ERROR_DEPRECATED		:= 0
 # Fault injection support
 FAULT_INJECTION_SUPPORT		:= 0
 
+# Call the lazy fconf populators on the first read of their properties
+FCONF_LAZY_POPULATE		:= 0
+
+# Index the nodes of each DTB fconf_populate() reads for the lookups of the
+# populators
+FCONF_NODE_INDEX		:= 0
+
+# Compile the FW_CONFIG and TB_FW_CONFIG properties into the images
+FCONF_STATIC_CONFIG		:= 0
+
+# Resolve the property names looked up by the fdt_wrappers helpers once
+FDT_PROP_NAME_CACHE		:= 0
+
 # Flag to enable architectural features detection mechanism
 FEATURE_DETECTION		:= 0
 
@@ -148,6 +212,12 @@ RME_GPT_BITLOCK_BLOCK		:= 1
 # Default maximum size of GPT contiguous block
 RME_GPT_MAX_BLOCK		:= 512
 
+# Defer the fusing of GPT contiguous blocks out of the granule transitions
+RME_GPT_DEFER_FUSE		:= 0
+
+# Allocate the GPT L1 tables of whole L0 regions on their first transition
+RME_GPT_LAZY_L1			:= 0
+
 # Hint platform interrupt control layer that Group 0 interrupts are for EL3. By
 # default, they are for Secure EL1.
 GICV2_G0_FOR_EL3		:= 0
@@ -174,6 +244,9 @@ HW_ASSISTED_COHERENCY		:= 0
 # Flag to enable trapping of implementation defined sytem registers
 IMPDEF_SYSREG_TRAP		:= 0
 
+# Count and time the IO storage operations, reported at the end of BL1 and BL2
+IO_STATS			:= 0
+
 # Set the default algorithm for the generation of Trusted Board Boot keys
 KEY_ALG				:= rsa
 
@@ -182,9 +255,18 @@ ifeq ($(KEY_ALG),rsa)
 KEY_SIZE			:= 2048
 endif
 
+# Provide a vendor-specific EL3 call timing the libc, libfdt and zlib functions
+LIB_BENCH			:= 0
+
+# Hash images while they are being loaded instead of in a separate pass
+LOAD_IMAGE_STREAM_HASH		:= 0
+
 # Option to build TF with Measured Boot support
 MEASURED_BOOT			:= 0
 
+# Measure images with the digest computed when authenticating them
+MBOOT_REUSE_AUTH_DIGEST		:= 0
+
 # Option to enable the DICE Protection Environmnet as a Measured Boot backend
 DICE_PROTECTION_ENVIRONMENT	:=0
 
@@ -194,6 +276,9 @@ NS_TIMER_SWITCH			:= 0
 # Include lib/libc in the final image
 OVERRIDE_LIBC			:= 0
 
+# Only restore the APIAKey on an EL3 exit to the context the keys belong to
+PAUTH_LAZY_RESTORE		:= 0
+
 # Build PL011 UART driver in minimal generic UART mode
 PL011_GENERIC_UART		:= 0
 
@@ -219,12 +304,46 @@ SDEI_SUPPORT			:= 0
 # True Random Number firmware Interface support
 TRNG_SUPPORT			:= 0
 
+# Set up TRNG and DRTM on their first SMC rather than at boot
+STD_SVC_DEFERRED_INIT		:= 0
+
 # Check to see if Errata ABI is supported
 ERRATA_ABI_SUPPORT		:= 0
 
 # Check to enable Errata ABI for platforms with non-arm interconnect
 ERRATA_NON_ARM_INTERCONNECT	:= 0
 
+# Count the SMCs handled by each cpu, per function ID
+SMC_CALL_COUNTERS		:= 0
+
+# Record per cpu histograms of the time spent in each runtime service
+SMC_LATENCY_HIST		:= 0
+
+# Provide a vendor-specific EL3 call powering on several cpus at once
+PSCI_CPU_ON_BATCH		:= 0
+
+# Demote suspend requests the cpu is likely to wake up from too early
+PSCI_IDLE_PREDICT		:= 0
+
+# Skip the PSCI power domain locks on idle entry when the cluster stays up
+PSCI_LOCKLESS_COORD		:= 0
+
+# Power domain tree descriptor to generate the PSCI power domain tree from at
+# build time, empty to build it at runtime
+PSCI_PWR_DOMAIN_TREE		:=
+
+# Enter repeated CPU standby requests without validating them again
+PSCI_STANDBY_FAST_PATH		:= 0
+
+# Use fair ticket locks for the PSCI power domain locks
+PSCI_TICKET_LOCKS		:= 0
+
+# Use locks handed over within a chip first for the hot global EL3 locks
+COHORT_LOCKS			:= 0
+
+# Reuse the images verified by BL2 on a vendor fast warm reboot
+FAST_REBOOT			:= 0
+
 # SMCCC PCI support
 SMC_PCI_SUPPORT			:= 0
 
@@ -248,6 +367,10 @@ SEPARATE_RWDATA_REGION		:= 0
 # have the choice to put it outside of default BSS region of EL3 firmware.
 SEPARATE_SIMD_SECTION		:= 0
 
+# Only switch the SIMD context between Secure and Normal worlds when a world
+# accesses the registers.
+SIMD_LAZY_SWITCH		:= 0
+
 # If the BL31 image initialisation code is recalimed after use for the secondary
 # cores stack
 RECLAIM_INIT_CODE		:= 0
@@ -280,6 +403,9 @@ USE_COHERENT_MEM		:= 1
 # Build option to add debugfs support
 USE_DEBUGFS			:= 0
 
+# Build option to offload large memory copies to a DMA controller
+USE_DMA_COPY			:= 0
+
 # Build option to fconf based io
 ARM_IO_IN_DTB			:= 0
 
@@ -299,6 +425,11 @@ USE_ROMLIB			:= 0
 # level makefile where we can check for incompatible features/build options.
 ALLOW_RO_XLAT_TABLES		:= 0
 
+# Build option to set the Contiguous hint in the translation tables, for the
+# groups of adjacent entries that map contiguous memory with the same
+# attributes.
+XLAT_TABLES_CONT_HINT		:= 0
+
 # Chain of trust.
 COT				:= tbbr
 
@@ -314,6 +445,9 @@ WARMBOOT_ENABLE_DCACHE_EARLY	:= 0
 # Default SVE vector length to maximum architected value
 SVE_VECTOR_LEN			:= 2048
 
+# SVE vector length of the Secure world, by default the same as above
+SVE_VECTOR_LEN_FOR_SWD		= ${SVE_VECTOR_LEN}
+
 SANITIZE_UB := off
 
 # For ARMv8.1 (AArch64) platforms, enabling this option selects the spinlock
@@ -394,6 +528,13 @@ PSA_CRYPTO			:= 0
 # should only be enabled if there is a use case for it.
 ENABLE_CONSOLE_GETC		:= 0
 
+# Record the BL31 log messages in binary form, to be formatted on the host
+LOG_BINARY			:= 0
+
+# Store the console output in memory and write it to the consoles later, rather
+# than waiting on the consoles for each character.
+CONSOLE_BUFFERED		:= 0
+
 # Build option to disable EL2 when it is not used.
 # Most platforms switch from EL3 to NS-EL2 and hence the unused NS-EL2
 # functions must be enabled by platforms if they require it.
@@ -416,3 +557,9 @@ PRESERVE_DSU_PMU_REGS		:= 0
 
 # Enable RMMD to forward attestation requests from RMM to EL3.
 RMMD_ENABLE_EL3_TOKEN_SIGN	:= 0
+
+# Cache the platform attestation token in the RMMD.
+RMMD_ATTEST_TOKEN_CACHE		:= 0
+
+# Build the TRP with the RMI call timing the RMM-EL3 interface
+TRP_BENCHMARK			:= 0
@@ -23,6 +23,7 @@
 
 static entry_point_info_t bl33_image_ep_info;
 static unsigned int system_freq;
+static uint8_t fpga_dtb_fixup_work[FPGA_DTB_FIXUP_WORK_SIZE] __aligned(8);
 volatile uint32_t secondary_core_spinlock;
 
 uintptr_t plat_get_ns_image_entrypoint(void)
@@ -308,7 +309,8 @@ static void fpga_prepare_dtb(void)
 {
 	void *fdt = (void *)(uintptr_t)FPGA_PRELOADED_DTB_BASE;
 	const char *cmdline = (void *)(uintptr_t)FPGA_PRELOADED_CMD_LINE;
-	int err;
+	struct fdt_fixup_session fixup;
+	int err, ret;
 
 	err = fdt_open_into(fdt, fdt, FPGA_MAX_DTB_SIZE);
 	if (err < 0) {
@@ -316,12 +318,6 @@ static void fpga_prepare_dtb(void)
 		panic();
 	}
 
-	/* Reserve memory used by Trusted Firmware. */
-	if (fdt_add_reserved_memory(fdt, "tf-a@80000000", BL31_BASE,
-				    BL31_LIMIT - BL31_BASE)) {
-		WARN("Failed to add reserved memory node to DT\n");
-	}
-
 	/* Check for the command line signature. */
 	if (!strncmp(cmdline, CMDLINE_SIGNATURE, strlen(CMDLINE_SIGNATURE))) {
 		err = fpga_dtb_set_commandline(fdt, cmdline);
@@ -338,27 +334,50 @@ static void fpga_prepare_dtb(void)
 		panic();
 	}
 
-	err = fdt_add_cpus_node(fdt, FPGA_MAX_PE_PER_CPU,
-				FPGA_MAX_CPUS_PER_CLUSTER,
-				FPGA_MAX_CLUSTER_COUNT);
+	/*
+	 * Stage the reserved memory and the CPU nodes in a fixup session, so
+	 * that the DTB is only rewritten once, whatever the number of CPUs.
+	 */
+	err = fdt_fixup_session_init(&fixup, fdt, fpga_dtb_fixup_work,
+				     sizeof(fpga_dtb_fixup_work));
+	if (err < 0) {
+		ERROR("Error %d starting Device Tree fixups\n", err);
+		panic();
+	}
+
+	/* Reserve memory used by Trusted Firmware. */
+	if (fdt_fixup_reserved_memory(&fixup, "tf-a@80000000", BL31_BASE,
+				      BL31_LIMIT - BL31_BASE)) {
+		WARN("Failed to add reserved memory node to DT\n");
+	}
+
+	err = fdt_fixup_cpus_node(&fixup, FPGA_MAX_PE_PER_CPU,
+				  FPGA_MAX_CPUS_PER_CLUSTER,
+				  FPGA_MAX_CLUSTER_COUNT);
 
 	if (err == -EEXIST) {
 		WARN("Not overwriting already existing /cpus node in DTB\n");
-	} else {
+	} else if (err < 0) {
+		ERROR("Error %d creating the /cpus DT node\n", err);
+		panic();
+	}
+
+	ret = fdt_fixup_session_commit(&fixup);
+	if (ret < 0) {
+		ERROR("Error %d applying Device Tree fixups\n", ret);
+		panic();
+	}
+
+	if (err == 0) {
+		unsigned int nr_cores = fpga_get_nr_gic_cores();
+
+		INFO("Adjusting GICR DT region to cover %u cores\n",
+		      nr_cores);
+		err = fdt_adjust_gic_redist(fdt, nr_cores,
+					    fpga_get_redist_base(),
+					    fpga_get_redist_size());
 		if (err < 0) {
-			ERROR("Error %d creating the /cpus DT node\n", err);
-			panic();
-		} else {
-			unsigned int nr_cores = fpga_get_nr_gic_cores();
-
-			INFO("Adjusting GICR DT region to cover %u cores\n",
-			      nr_cores);
-			err = fdt_adjust_gic_redist(fdt, nr_cores,
-						    fpga_get_redist_base(),
-						    fpga_get_redist_size());
-			if (err < 0) {
-				ERROR("Error %d fixing up GIC DT node\n", err);
-			}
+			ERROR("Error %d fixing up GIC DT node\n", err);
 		}
 	}
 
@@ -13,6 +13,7 @@
 #define C_RUNTIME_READY_KEY	(0xaa55aa55)
 #define VALID_MPID		(1U)
 #define FPGA_MAX_DTB_SIZE	0x10000
+#define FPGA_DTB_FIXUP_WORK_SIZE	0x2000
 
 #ifndef __ASSEMBLER__
 
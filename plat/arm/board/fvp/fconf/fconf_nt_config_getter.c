@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, Arm Limited. All rights reserved.
+ * Copyright (c) 2020-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -28,7 +28,7 @@ int fconf_populate_event_log_config(uintptr_t config)
 	 */
 	const char *compatible_str = "arm,tpm_event_log";
 
-	node = fdt_node_offset_by_compatible(dtb, -1, compatible_str);
+	node = fconf_node_offset_by_compatible(dtb, -1, compatible_str);
 	if (node < 0) {
 		ERROR("FCONF: Can't find '%s' compatible in dtb\n",
 			compatible_str);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2013-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -139,6 +139,7 @@ void __init bl31_plat_arch_setup(void)
 
 	/* Populate HW_CONFIG device tree with the mapped address */
 	fconf_populate("HW_CONFIG", hw_config_info->config_addr);
+	fconf_populate_pending();
 
 	/* unmap the HW_CONFIG memory region */
 	rc = mmap_remove_dynamic_region(hw_config_base_align, mapped_size_align);
@@ -608,7 +608,6 @@ int plat_rmmd_load_manifest(struct rmm_manifest *manifest)
 	num_consoles = FVP_RMM_CONSOLE_COUNT;
 
 	manifest->version = RMMD_MANIFEST_VERSION;
-	manifest->padding = 0U; /* RES0 */
 	manifest->plat_data = (uintptr_t)NULL;
 	manifest->plat_dram.num_banks = num_banks;
 	manifest->plat_console.num_consoles = num_consoles;
@@ -620,9 +619,9 @@ int plat_rmmd_load_manifest(struct rmm_manifest *manifest)
 	 * +----------------------------------------+
 	 * | offset |     field      |    comment   |
 	 * +--------+----------------+--------------+
-	 * |   0    |    version     |  0x00000003  |
+	 * |   0    |    version     |  0x00000004  |
 	 * +--------+----------------+--------------+
-	 * |   4    |    padding     |  0x00000000  |
+	 * |   4    |   num_pages    |  0x00000001  |
 	 * +--------+----------------+--------------+
 	 * |   8    |   plat_data    |     NULL     |
 	 * +--------+----------------+--------------+
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2022-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -40,9 +40,10 @@ static uint64_t handle_ffa_direct_request(uint32_t smc_fid,  bool secure_origin,
 
 	/*
 	 * Handle the incoming request. For testing purposes we echo the
-	 * incoming message.
+	 * incoming message. It is also used to measure the round trip cost
+	 * of direct messaging, so do not print at every request by default.
 	 */
-	INFO("LSP: Received Direct Request from %s world (0x%x)\n",
+	VERBOSE("LSP: Received Direct Request from %s world (0x%x)\n",
 	     secure_origin ? "Secure" : "Normal", ffa_endpoint_source(x1));
 
 	/* Populate the source and destination IDs. */
@@ -12,6 +12,9 @@
 #include <arch_helpers.h>
 #include <bl31/sync_handle.h>
 #include <context.h>
+#if EL3_FAST_SYSREG_TRAP
+#include <plat/common/plat_trng.h>
+#endif
 
 /*
  * SCR_EL3.SCR_TRNDR_BIT also affects execution in EL3, so allow to disable
@@ -60,3 +63,15 @@ int plat_handle_rng_trap(uint64_t esr_el3, cpu_context_t *ctx)
 	 */
 	return TRAP_RET_CONTINUE;
 }
+
+#if EL3_FAST_SYSREG_TRAP
+/* Entropy for the cache of the fast RNG trap path, demonstration only too. */
+bool plat_get_entropy(uint64_t *out)
+{
+	enable_rng_trap(false);
+	*out = read_rndrrs();
+	enable_rng_trap(true);
+
+	return true;
+}
+#endif
@@ -1,5 +1,5 @@
 #
-# Copyright (c) 2013-2024, Arm Limited and Contributors. All rights reserved.
+# Copyright (c) 2013-2026, Arm Limited and Contributors. All rights reserved.
 #
 # SPDX-License-Identifier: BSD-3-Clause
 #
@@ -57,6 +57,7 @@ endif
       ENABLE_BRBE_FOR_NS	:= 2
       ENABLE_TRBE_FOR_NS	:= 2
       ENABLE_FEAT_D128		:= 2
+      ENABLE_FEAT_MOPS		:= 2
 endif
 
 ENABLE_SYS_REG_TRACE_FOR_NS	:= 2
@@ -321,6 +322,10 @@ BL31_SOURCES		+=	lib/fconf/fconf.c				\
 				lib/fconf/fconf_dyn_cfg_getter.c		\
 				plat/arm/board/fvp/fconf/fconf_hw_config_getter.c
 
+ifeq (${FCONF_STATIC_CONFIG},1)
+BL31_SOURCES		+=	${FCONF_STATIC_SOURCES}
+endif
+
 BL31_SOURCES		+=	${FDT_WRAPPERS_SOURCES}
 
 ifeq (${SEC_INT_DESC_IN_FCONF},1)
@@ -359,6 +364,9 @@ FVP_FW_CONFIG		:=	${BUILD_PLAT}/fdts/${PLAT}_fw_config.dtb
 FVP_SOC_FW_CONFIG	:=	${BUILD_PLAT}/fdts/${PLAT}_soc_fw_config.dtb
 FVP_NT_FW_CONFIG	:=	${BUILD_PLAT}/fdts/${PLAT}_nt_fw_config.dtb
 
+# FW_CONFIG and TB_FW_CONFIG properties compiled in with FCONF_STATIC_CONFIG=1
+FCONF_STATIC_DTBS	:=	${FVP_FW_CONFIG} ${FVP_TB_FW_CONFIG}
+
 ifeq (${SPD},tspd)
 FDT_SOURCES		+=	plat/arm/board/fvp/fdts/${PLAT}_tsp_fw_config.dts
 FVP_TOS_FW_CONFIG	:=	${BUILD_PLAT}/fdts/${PLAT}_tsp_fw_config.dtb
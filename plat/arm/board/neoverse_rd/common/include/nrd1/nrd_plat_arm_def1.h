@@ -34,6 +34,9 @@
 				NRD_MAX_CPUS_PER_CLUSTER *		\
 				NRD_MAX_PE_PER_CPU)
 
+/* The cohort locks are handed over within a chip first */
+#define PLAT_COHORT_LOCK_NODES		NRD_CHIP_COUNT
+
 /*******************************************************************************
  * PA/VA config
  ******************************************************************************/
@@ -32,6 +32,9 @@
 					NRD_MAX_CPUS_PER_CLUSTER *	\
 					NRD_MAX_PE_PER_CPU)
 
+/* The cohort locks are handed over within a chip first */
+#define PLAT_COHORT_LOCK_NODES		NRD_CHIP_COUNT
+
 #if (NRD_PLATFORM_VARIANT == 1)
 #define PLAT_ARM_CLUSTER_COUNT		U(8)
 #elif (NRD_PLATFORM_VARIANT == 2)
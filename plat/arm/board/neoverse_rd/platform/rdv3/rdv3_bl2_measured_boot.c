@@ -1,11 +1,12 @@
 /*
- * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2024-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
 #include <stdint.h>
 
+#include <common/debug.h>
 #include <drivers/arm/rse_comms.h>
 #include <drivers/measured_boot/rse/rse_measured_boot.h>
 #include <lib/psa/measured_boot.h>
@@ -65,5 +66,9 @@ void bl2_plat_mboot_init(void)
 
 void bl2_plat_mboot_finish(void)
 {
-	/* Nothing to do. */
+	/* The last measurement must be extended before the next stage runs */
+	if (rse_mboot_finish() != 0) {
+		ERROR("Failed to extend the RSE measurements\n");
+		panic();
+	}
 }
@@ -1,11 +1,12 @@
 /*
- * Copyright (c) 2022-2024, Arm Limited. All rights reserved.
+ * Copyright (c) 2022-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
 #include <stdint.h>
 
+#include <common/debug.h>
 #include <drivers/arm/rse_comms.h>
 #include <drivers/measured_boot/metadata.h>
 #include <drivers/measured_boot/rse/rse_measured_boot.h>
@@ -55,5 +56,9 @@ void bl1_plat_mboot_init(void)
 
 void bl1_plat_mboot_finish(void)
 {
-	/* Nothing to do. */
+	/* The last measurement must be extended before the next stage runs */
+	if (rse_mboot_finish() != 0) {
+		ERROR("Failed to extend the RSE measurements\n");
+		panic();
+	}
 }
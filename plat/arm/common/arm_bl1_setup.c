@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -12,6 +12,7 @@
 #include <bl1/bl1.h>
 #include <common/bl_common.h>
 #include <common/debug.h>
+#include <lib/boot_timeline.h>
 #include <lib/fconf/fconf.h>
 #include <lib/fconf/fconf_dyn_cfg_getter.h>
 #if TRANSFER_LIST
@@ -158,7 +159,7 @@ void arm_bl1_platform_setup(void)
 
 	image_desc_t *desc;
 
-	int err = -1;
+	int err __unused = -1;
 
 	/* Initialise the IO layer and register platform IO devices */
 	plat_arm_io_setup();
@@ -198,13 +199,21 @@ void arm_bl1_platform_setup(void)
 		plat_error_handler(err);
 	}
 
-	transfer_list_update_checksum(secure_tl);
+	transfer_list_update_entry_checksum(secure_tl, te, 0U);
 	fconf_populate("TB_FW", (uintptr_t)transfer_list_entry_data(te));
 #else
 	/* Set global DTB info for fixed fw_config information */
 	fw_config_max_size = ARM_FW_CONFIG_LIMIT - ARM_FW_CONFIG_BASE;
 	set_config_info(ARM_FW_CONFIG_BASE, ~0UL, fw_config_max_size, FW_CONFIG_ID);
 
+#if FCONF_STATIC_CONFIG
+	/*
+	 * FW_CONFIG and TB_FW_CONFIG are compiled into the images, so neither
+	 * is loaded nor parsed.
+	 */
+	fconf_populate("FW_CONFIG", 0UL);
+	config_info = FCONF_GET_PROPERTY(dyn_cfg, dtb, FW_CONFIG_ID);
+#else
 	/* Fill the device tree information struct with the info from the config dtb */
 	err = fconf_load_config(FW_CONFIG_ID);
 	if (err < 0) {
@@ -234,6 +243,7 @@ void arm_bl1_platform_setup(void)
 		ERROR("Invalid FW_CONFIG address\n");
 		plat_error_handler(err);
 	}
+#endif /* FCONF_STATIC_CONFIG */
 #endif /* TRANSFER_LIST */
 
 	desc = bl1_plat_get_image_desc(BL2_IMAGE_ID);
@@ -318,7 +328,11 @@ int bl1_plat_handle_post_image_load(unsigned int image_id)
 	bl1_plat_calc_bl2_layout(&bl1_tzram_layout,
 				 (meminfo_t *)transfer_list_entry_data(te));
 
-	transfer_list_update_checksum(secure_tl);
+	transfer_list_update_entry_checksum(secure_tl, te, 0U);
+
+#if BOOT_TIMELINE
+	(void)boot_timeline_handoff(secure_tl, NULL);
+#endif
 
 	/**
 	 * Before exiting make sure the contents of the TL are flushed in case there's no
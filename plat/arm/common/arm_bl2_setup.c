@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -14,12 +14,14 @@
 #include <common/bl_common.h>
 #include <common/debug.h>
 #include <common/desc_image_load.h>
+#include <drivers/fwu/fwu.h>
 #include <drivers/generic_delay_timer.h>
 #include <drivers/partition/partition.h>
 #include <lib/fconf/fconf.h>
 #include <lib/fconf/fconf_dyn_cfg_getter.h>
 #include <lib/gpt_rme/gpt_rme.h>
 #if TRANSFER_LIST
+#include <lib/boot_timeline.h>
 #include <lib/transfer_list.h>
 #endif
 #ifdef SPD_opteed
@@ -139,6 +141,11 @@ void bl2_plat_preload_setup(void)
 #endif
 
 	arm_transfer_list_dyn_cfg_init(secure_tl);
+
+#if PSA_FWU_SUPPORT
+	/* plat_fwu_set_images_source() loads the FIP from the active bank */
+	(void)fwu_transfer_list_add(secure_tl, fwu_get_metadata()->active_index);
+#endif /* PSA_FWU_SUPPORT */
 #else
 #if ARM_FW_CONFIG_LOAD_ENABLE
 	arm_bl2_el3_plat_config_load();
@@ -238,6 +245,16 @@ void bl2_plat_arch_setup(void)
 	fconf_populate("TB_FW", (uintptr_t)transfer_list_entry_data(te));
 	transfer_list_rem(secure_tl, te);
 #else
+#if FCONF_STATIC_CONFIG
+	/*
+	 * BL1 has not loaded FW_CONFIG, which is only read to override the
+	 * static configuration if it is there. Record where BL31 is told to
+	 * look for it.
+	 */
+	set_config_info(config_base, ~0UL,
+			ARM_FW_CONFIG_LIMIT - ARM_FW_CONFIG_BASE, FW_CONFIG_ID);
+#endif
+
 	/* Fill the properties struct with the info from the config dtb */
 	fconf_populate("FW_CONFIG", config_base);
 
@@ -320,7 +337,8 @@ int arm_bl2_plat_handle_post_image_load(unsigned int image_id)
 #if TRANSFER_LIST
 	if (image_id == HW_CONFIG_ID) {
 		/* Refresh the now stale checksum following loading of HW_CONFIG into the TL. */
-		transfer_list_update_checksum(secure_tl);
+		transfer_list_update_entry_checksum(secure_tl,
+			transfer_list_find(secure_tl, TL_TAG_FDT), 0U);
 	}
 #endif /* TRANSFER_LIST */
 
@@ -334,5 +352,9 @@ void arm_bl2_setup_next_ep_info(bl_mem_params_node_t *next_param_node)
 					    &next_param_node->ep_info);
 	assert(ep != NULL);
 
+#if BOOT_TIMELINE
+	(void)boot_timeline_handoff(secure_tl, secure_tl);
+#endif
+
 	arm_transfer_list_populate_ep_info(next_param_node, secure_tl);
 }
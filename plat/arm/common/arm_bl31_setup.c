@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -18,6 +18,7 @@
 #include <lib/gpt_rme/gpt_rme.h>
 #include <lib/mmio.h>
 #if TRANSFER_LIST
+#include <lib/boot_timeline.h>
 #include <lib/transfer_list.h>
 #endif
 #include <lib/xlat_tables/xlat_tables_compat.h>
@@ -365,6 +366,9 @@ void bl31_early_platform_setup2(u_register_t arg0, u_register_t arg1,
 void arm_bl31_platform_setup(void)
 {
 	struct transfer_list_entry *te __unused;
+	const struct transfer_list_data_ref *ref __unused;
+	size_t hw_config_size __unused;
+	void *hw_config __unused;
 
 #if TRANSFER_LIST && !RESET_TO_BL31
 	ns_tl = transfer_list_init((void *)FW_NS_HANDOFF_BASE,
@@ -375,8 +379,10 @@ void arm_bl31_platform_setup(void)
 		panic();
 	}
 
-	te = transfer_list_find(secure_tl, TL_TAG_FDT);
-	assert(te != NULL);
+	/* HW_CONFIG is either in the secure TL or left in place by BL2 */
+	hw_config = transfer_list_find_data(secure_tl, TL_TAG_FDT,
+					    &hw_config_size, &ref);
+	assert(hw_config != NULL);
 
 	/*
 	 * A pre-existing assumption is that FCONF is unsupported w/ RESET_TO_BL2 and
@@ -386,12 +392,26 @@ void arm_bl31_platform_setup(void)
 	 * derived from the DT are statically defined.
 	 */
 #if !RESET_TO_BL2
-	fconf_populate("HW_CONFIG", (uintptr_t)transfer_list_entry_data(te));
+	fconf_populate("HW_CONFIG", (uintptr_t)hw_config);
 #endif
 
-	te = transfer_list_add(ns_tl, TL_TAG_FDT, te->data_size,
-			       transfer_list_entry_data(te));
+	/* Only copy HW_CONFIG if BL33 cannot read it where it is */
+	if ((ref != NULL) && ((ref->attr & TL_REF_ATTR_NS) != 0U)) {
+		te = transfer_list_add_ref(ns_tl, TL_TAG_FDT, (uintptr_t)hw_config,
+					   hw_config_size, TL_REF_ATTR_NS);
+	} else {
+		te = transfer_list_add(ns_tl, TL_TAG_FDT, hw_config_size,
+				       hw_config);
+	}
 	assert(te != NULL);
+
+	/* Pass the FWU metadata validated by BL2 on to BL33 */
+	te = transfer_list_find(secure_tl, TL_TAG_FWU_METADATA);
+	if ((te != NULL) &&
+	    (transfer_list_add(ns_tl, TL_TAG_FWU_METADATA, te->data_size,
+			       transfer_list_entry_data(te)) == NULL)) {
+		WARN("No room for the FWU metadata in the transfer list\n");
+	}
 #endif /* TRANSFER_LIST */
 
 	/* Initialize the GIC driver, cpu and distributor interfaces */
@@ -440,7 +460,17 @@ void arm_bl31_plat_runtime_setup(void)
 	/* Initialize the runtime console */
 	arm_console_runtime_init();
 
+#if !TRANSFER_LIST
+	/* BL33 may overwrite the HW_CONFIG DTB the properties are read from */
+	fconf_populate_pending();
+#endif
+
 #if TRANSFER_LIST && !RESET_TO_BL31
+#if BOOT_TIMELINE
+	/* Hand the timeline of the whole boot over to BL33 */
+	(void)boot_timeline_handoff(ns_tl, secure_tl);
+#endif
+
 	/*
 	 * We assume BL31 has added all TE's required by BL33 at this stage, ensure
 	 * that data is visible to all observers by performing a flush operation, so
@@ -79,6 +79,27 @@ ARM_BL31_IN_DRAM		:=	0
 $(eval $(call assert_boolean,ARM_BL31_IN_DRAM))
 $(eval $(call add_define,ARM_BL31_IN_DRAM))
 
+# Process ARM_FW_CONFIG_PREFETCH_KB flag
+ARM_FW_CONFIG_PREFETCH_KB	:=	0
+$(eval $(call assert_numeric,ARM_FW_CONFIG_PREFETCH_KB))
+$(eval $(call add_define,ARM_FW_CONFIG_PREFETCH_KB))
+
+# Read the SP packages from the FIP with a single I/O in BL2
+ARM_SP_PREFETCH			:=	0
+$(eval $(call assert_boolean,ARM_SP_PREFETCH))
+$(eval $(call add_define,ARM_SP_PREFETCH))
+
+# Process ARM_MEM_PROTECT_PARALLEL flag
+ARM_MEM_PROTECT_PARALLEL	:=	0
+$(eval $(call assert_boolean,ARM_MEM_PROTECT_PARALLEL))
+$(eval $(call add_define,ARM_MEM_PROTECT_PARALLEL))
+
+ifeq (${ARM_MEM_PROTECT_PARALLEL},1)
+  ifneq (${RESET_TO_BL31},1)
+    $(error ARM_MEM_PROTECT_PARALLEL is only available if RESET_TO_BL31=1)
+  endif
+endif
+
 # As per CCA security model, all root firmware must execute from on-chip secure
 # memory. This means we must not run BL31 from TZC-protected DRAM.
 ifeq (${ARM_BL31_IN_DRAM},1)
@@ -183,6 +204,11 @@ ifeq (${ARM_FW_CONFIG_LOAD_ENABLE},1)
     endif
 endif
 
+# Number of 4KB pages of the EL3 <-> RMM shared area, which holds the RMM boot
+# manifest and its tables
+ARM_EL3_RMM_SHARED_PAGES	:=	1
+$(eval $(call add_define,ARM_EL3_RMM_SHARED_PAGES))
+
 # Disable GPT parser support, use FIP image by default
 ARM_GPT_SUPPORT			:=	0
 $(eval $(call assert_boolean,ARM_GPT_SUPPORT))
@@ -244,6 +270,12 @@ ifeq (${SPD},spmd)
     endif
 endif
 
+ifeq (${ARM_SP_PREFETCH},1)
+    ifneq (${SPD}-${BL2_ENABLE_SP_LOAD},spmd-1)
+        $(error "ARM_SP_PREFETCH requires SPD=spmd and BL2_ENABLE_SP_LOAD=1")
+    endif
+endif
+
 BL1_SOURCES		+=	drivers/io/io_fip.c				\
 				drivers/io/io_memmap.c				\
 				drivers/io/io_storage.c				\
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2018-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -15,12 +15,16 @@
 #include <common/debug.h>
 #include <common/desc_image_load.h>
 #include <common/tbbr/tbbr_img_def.h>
+#include <drivers/io/io_driver.h>
+#include <drivers/io/io_fip.h>
+#include <drivers/io/io_storage.h>
 #include <lib/fconf/fconf.h>
 #include <lib/fconf/fconf_dyn_cfg_getter.h>
 #include <lib/fconf/fconf_tbbr_getter.h>
 
 #include <plat/arm/common/arm_dyn_cfg_helpers.h>
 #include <plat/arm/common/plat_arm.h>
+#include <plat/common/platform.h>
 #include <platform_def.h>
 
 #if CRYPTO_SUPPORT
@@ -45,9 +49,13 @@ int arm_get_mbedtls_heap(void **heap_addr, size_t *heap_size)
 	assert(heap_addr != NULL);
 	assert(heap_size != NULL);
 
-#if defined(IMAGE_BL1) || RESET_TO_BL2 || defined(IMAGE_BL31)
+#if defined(IMAGE_BL1) || RESET_TO_BL2 || defined(IMAGE_BL31) || \
+	FCONF_STATIC_CONFIG
 
-	/* If in BL1 or RESET_TO_BL2 define a heap */
+	/*
+	 * If in BL1 or RESET_TO_BL2 define a heap. With FCONF_STATIC_CONFIG
+	 * there is no TB_FW_CONFIG to pass the heap of BL1 to BL2 either.
+	 */
 	static unsigned char heap[TF_MBEDTLS_HEAP_SIZE];
 
 	*heap_addr = heap;
@@ -92,7 +100,8 @@ void arm_bl1_set_mbedtls_heap(void)
 	tb_fw_config_info = FCONF_GET_PROPERTY(dyn_cfg, dtb, TB_FW_CONFIG_ID);
 	assert(tb_fw_config_info != NULL);
 
-	tb_fw_cfg_dtb = tb_fw_config_info->config_addr;
+	/* TB_FW_CONFIG is not loaded with FCONF_STATIC_CONFIG */
+	tb_fw_cfg_dtb = FCONF_STATIC_CONFIG ? 0UL : tb_fw_config_info->config_addr;
 
 	if ((tb_fw_cfg_dtb != 0UL) && (mbedtls_heap_addr != NULL)) {
 		/* As libfdt uses void *, we can't avoid this cast */
@@ -121,6 +130,65 @@ void arm_bl1_set_mbedtls_heap(void)
 #endif /* CRYPTO_SUPPORT */
 
 #if IMAGE_BL2
+#if ARM_FW_CONFIG_PREFETCH_KB > 0
+static uint8_t arm_cfg_prefetch_buf[ARM_FW_CONFIG_PREFETCH_KB * 1024U]
+	__aligned(CACHE_WRITEBACK_GRANULE);
+
+/*
+ * Read the config images to be loaded from the FIP with a single I/O, if they
+ * are close enough in it to fit in the prefetch buffer. Otherwise they are
+ * read one by one as usual.
+ */
+static void arm_bl2_dyn_cfg_prefetch(const unsigned int *config_ids,
+				     unsigned int count)
+{
+	uuid_t uuids[4];
+	uintptr_t fip_dev_handle = 0U;
+	uintptr_t dev_handle, image_spec;
+	const bl_mem_params_node_t *cfg_mem_params;
+	unsigned int i, nr_uuids = 0U;
+	int rc;
+
+	assert(count <= ARRAY_SIZE(uuids));
+
+	for (i = 0U; i < count; i++) {
+		cfg_mem_params = get_bl_mem_params_node(config_ids[i]);
+		if ((cfg_mem_params == NULL) ||
+		    ((cfg_mem_params->image_info.h.attr &
+		      IMAGE_ATTRIB_SKIP_LOADING) != 0U)) {
+			continue;
+		}
+
+		if ((plat_get_image_source(config_ids[i], &dev_handle,
+					   &image_spec) != 0) ||
+		    (((io_dev_info_t *)dev_handle)->funcs->type() !=
+		     IO_TYPE_FIRMWARE_IMAGE_PACKAGE)) {
+			continue;
+		}
+
+		/* Only the configs in the same FIP can be read at once */
+		if (fip_dev_handle == 0U) {
+			fip_dev_handle = dev_handle;
+		} else if (dev_handle != fip_dev_handle) {
+			continue;
+		}
+
+		uuids[nr_uuids++] = ((const io_uuid_spec_t *)image_spec)->uuid;
+	}
+
+	if (nr_uuids < 2U) {
+		return;
+	}
+
+	rc = fip_dev_prefetch((io_dev_info_t *)fip_dev_handle, uuids, nr_uuids,
+			      (uintptr_t)arm_cfg_prefetch_buf,
+			      sizeof(arm_cfg_prefetch_buf));
+	if (rc != 0) {
+		VERBOSE("Config images not prefetched (%d)\n", rc);
+	}
+}
+#endif /* ARM_FW_CONFIG_PREFETCH_KB > 0 */
+
 /*
  * BL2 utility function to initialize dynamic configuration specified by
  * FW_CONFIG. Populate the bl_mem_params_node_t of other FW_CONFIGs if
@@ -229,5 +297,9 @@ void arm_bl2_dyn_cfg_init(void)
 		ERROR("Invalid config file %u\n", error_config_id);
 		panic();
 	}
+
+#if ARM_FW_CONFIG_PREFETCH_KB > 0
+	arm_bl2_dyn_cfg_prefetch(config_ids, ARRAY_SIZE(config_ids));
+#endif
 }
 #endif /* IMAGE_BL2 */
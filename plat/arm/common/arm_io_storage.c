@@ -129,6 +129,10 @@ int plat_get_image_source(unsigned int image_id, uintptr_t *dev_handle,
 	if (result == 0) {
 		*image_spec = policy->image_spec;
 		*dev_handle = *(policy->dev_handle);
+#if IMAGE_BL2 && ARM_SP_PREFETCH
+		/* Read all the SP packages at once before the first one */
+		arm_sp_prefetch(image_id);
+#endif
 	} else {
 		VERBOSE("Trying alternative IO\n");
 		result = plat_arm_get_alt_image_source(image_id, dev_handle,
@@ -4,13 +4,20 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <stdbool.h>
+
 #include <platform_def.h>
 
+#include <arch_helpers.h>
 #include <common/debug.h>
 #include <drivers/cfi/v2m_flash.h>
 #include <lib/psci/psci.h>
+#include <lib/psci/psci_lib.h>
+#include <lib/spinlock.h>
 #include <lib/utils.h>
+#include <lib/xlat_tables/xlat_tables_compat.h>
 #include <plat/arm/common/plat_arm.h>
+#include <plat/common/platform.h>
 
 /*
  * DRAM1 is used also to load the NS boot loader. For this reason we
@@ -92,6 +99,158 @@ int arm_nor_psci_write_mem_protect(int val)
  * 0xc0000000 is not used.
  */
 #if defined(PLAT_XLAT_TABLES_DYNAMIC)
+#if ARM_MEM_PROTECT_PARALLEL
+/*
+ * With ARM_MEM_PROTECT_PARALLEL, the protected regions are mapped flat once and
+ * all the cores clear them after PSCI is set up, each one claiming the next
+ * block of ARM_MEM_PROTECT_BLOCK_SIZE bytes until none is left.
+ */
+#define ARM_MEM_PROTECT_BLOCK_SIZE	(1UL << TWO_MB_SHIFT)
+#define ARM_MEM_PROTECT_ATTR		(MT_MEMORY | MT_RW | MT_NS)
+
+static struct {
+	spinlock_t lock;
+	unsigned int region;
+	uintptr_t next;
+	size_t cleared;
+	size_t reported;
+	size_t total;
+} arm_mem_scrub;
+
+static u_register_t arm_mem_scrub_mpidrs[PLATFORM_CORE_COUNT];
+
+static void arm_mem_scrub_unmap(unsigned int nregions)
+{
+	unsigned int i;
+
+	for (i = 0U; i < nregions; i++) {
+		(void) mmap_remove_dynamic_region(arm_ram_ranges[i].base,
+						  arm_ram_ranges[i].nbytes);
+	}
+}
+
+/*
+ * Work run by each core released by psci_run_boot_work(). The core that
+ * clears the last block removes the mappings.
+ */
+static void arm_mem_scrub_work(void)
+{
+	const mem_region_t *region;
+	uintptr_t base;
+	size_t size;
+
+	spin_lock(&arm_mem_scrub.lock);
+
+	while (arm_mem_scrub.region < ARRAY_SIZE(arm_ram_ranges)) {
+		region = &arm_ram_ranges[arm_mem_scrub.region];
+		if (arm_mem_scrub.next == (region->base + region->nbytes)) {
+			arm_mem_scrub.region++;
+			if (arm_mem_scrub.region < ARRAY_SIZE(arm_ram_ranges)) {
+				arm_mem_scrub.next =
+					arm_ram_ranges[arm_mem_scrub.region].base;
+			}
+			continue;
+		}
+
+		base = arm_mem_scrub.next;
+		size = MIN(ARM_MEM_PROTECT_BLOCK_SIZE,
+			   region->base + region->nbytes - base);
+		arm_mem_scrub.next += size;
+		spin_unlock(&arm_mem_scrub.lock);
+
+		zero_normalmem((void *)base, size);
+
+		spin_lock(&arm_mem_scrub.lock);
+		arm_mem_scrub.cleared += size;
+		if ((arm_mem_scrub.cleared - arm_mem_scrub.reported) >=
+		    (1UL << ONE_GB_SHIFT)) {
+			VERBOSE("PSCI: %lu of %lu MB overwritten\n",
+				(unsigned long)(arm_mem_scrub.cleared >> 20),
+				(unsigned long)(arm_mem_scrub.total >> 20));
+			arm_mem_scrub.reported = arm_mem_scrub.cleared;
+		}
+
+		if (arm_mem_scrub.cleared == arm_mem_scrub.total) {
+			arm_mem_scrub_unmap(ARRAY_SIZE(arm_ram_ranges));
+		}
+	}
+
+	spin_unlock(&arm_mem_scrub.lock);
+}
+
+/*
+ * Fill 'mpidrs' with the MPIDR of each core present on the platform and return
+ * their number.
+ */
+static unsigned int arm_mem_scrub_get_mpidrs(u_register_t *mpidrs)
+{
+	u_register_t mpidr;
+	unsigned int cluster, cpu, pe, nr_mpidrs = 0U;
+	bool mt = (read_mpidr() & MPIDR_MT_MASK) != 0U;
+
+	for (cluster = 0U; cluster < PLAT_ARM_CLUSTER_COUNT; cluster++) {
+		for (cpu = 0U; cpu < PLATFORM_CORE_COUNT; cpu++) {
+			for (pe = 0U; pe < (mt ? PLATFORM_CORE_COUNT : 1U);
+			     pe++) {
+				if (mt) {
+					mpidr = ((u_register_t)cluster <<
+						 MPIDR_AFF2_SHIFT) |
+						(cpu << MPIDR_AFF1_SHIFT) |
+						(pe << MPIDR_AFF0_SHIFT);
+				} else {
+					mpidr = (cluster << MPIDR_AFF1_SHIFT) |
+						(cpu << MPIDR_AFF0_SHIFT);
+				}
+
+				if (plat_core_pos_by_mpidr(mpidr) < 0) {
+					continue;
+				}
+
+				mpidrs[nr_mpidrs++] = mpidr;
+				if (nr_mpidrs == PLATFORM_CORE_COUNT) {
+					return nr_mpidrs;
+				}
+			}
+		}
+	}
+
+	return nr_mpidrs;
+}
+
+/*
+ * Map the protected regions and have all the cores clear them once PSCI is set
+ * up. Returns 0 on success, or -1 if the regions cannot be mapped flat and
+ * must be cleared through the PLAT_ARM_MEM_PROTEC_VA_FRAME window instead.
+ */
+static int arm_mem_scrub_start(void)
+{
+	unsigned int i, nr_mpidrs;
+
+	for (i = 0U; i < ARRAY_SIZE(arm_ram_ranges); i++) {
+		if (mmap_add_dynamic_region(arm_ram_ranges[i].base,
+					    arm_ram_ranges[i].base,
+					    arm_ram_ranges[i].nbytes,
+					    ARM_MEM_PROTECT_ATTR) != 0) {
+			arm_mem_scrub_unmap(i);
+			return -1;
+		}
+		arm_mem_scrub.total += arm_ram_ranges[i].nbytes;
+	}
+
+	arm_mem_scrub.region = 0U;
+	arm_mem_scrub.next = arm_ram_ranges[0].base;
+
+	nr_mpidrs = arm_mem_scrub_get_mpidrs(arm_mem_scrub_mpidrs);
+
+	INFO("PSCI: Overwriting non secure memory on up to %u cores\n",
+	     nr_mpidrs);
+	psci_register_boot_work(arm_mem_scrub_mpidrs, nr_mpidrs,
+				arm_mem_scrub_work);
+
+	return 0;
+}
+#endif /* ARM_MEM_PROTECT_PARALLEL */
+
 void arm_nor_psci_do_dyn_mem_protect(void)
 {
 	int enable;
@@ -100,6 +259,11 @@ void arm_nor_psci_do_dyn_mem_protect(void)
 	if (enable == 0)
 		return;
 
+#if ARM_MEM_PROTECT_PARALLEL
+	if (arm_mem_scrub_start() == 0)
+		return;
+#endif
+
 	INFO("PSCI: Overwriting non secure memory\n");
 	clear_map_dyn_mem_regions(arm_ram_ranges,
 				  ARRAY_SIZE(arm_ram_ranges),
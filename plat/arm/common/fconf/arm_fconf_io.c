@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2023, ARM Limited. All rights reserved.
+ * Copyright (c) 2019-2026, ARM Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -411,7 +411,7 @@ int fconf_populate_arm_io_policies(uintptr_t config)
 
 	/* Assert the node offset point to "arm,io-fip-handle" compatible property */
 	const char *compatible_str = "arm,io-fip-handle";
-	node = fdt_node_offset_by_compatible(dtb, -1, compatible_str);
+	node = fconf_node_offset_by_compatible(dtb, -1, compatible_str);
 	if (node < 0) {
 		ERROR("FCONF: Can't find %s compatible in dtb\n", compatible_str);
 		return node;
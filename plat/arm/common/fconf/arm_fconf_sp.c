@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2024, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2020-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -10,12 +10,15 @@
 #include <common/debug.h>
 #include <common/desc_image_load.h>
 #include <common/fdt_wrappers.h>
+#include <drivers/io/io_driver.h>
+#include <drivers/io/io_fip.h>
 #include <drivers/io/io_storage.h>
 #include <lib/object_pool.h>
 #include <libfdt.h>
 #include <plat/arm/common/arm_fconf_getter.h>
 #include <plat/arm/common/arm_fconf_io_storage.h>
 #include <plat/arm/common/fconf_arm_sp_getter.h>
+#include <plat/arm/common/plat_arm.h>
 #include <platform_def.h>
 #include <tools_share/firmware_image_package.h>
 
@@ -48,7 +51,7 @@ int fconf_populate_arm_sp(uintptr_t config)
 	/* Assert the node offset point to "arm,sp" compatible property */
 	const char *compatible_str = "arm,sp";
 
-	node = fdt_node_offset_by_compatible(dtb, -1, compatible_str);
+	node = fconf_node_offset_by_compatible(dtb, -1, compatible_str);
 	if (node < 0) {
 		ERROR("FCONF: Can't find %s in dtb\n", compatible_str);
 		return node;
@@ -164,4 +167,47 @@ int fconf_populate_arm_sp(uintptr_t config)
 
 FCONF_REGISTER_POPULATOR(TB_FW, arm_sp, fconf_populate_arm_sp);
 
+#if ARM_SP_PREFETCH
+/*
+ * Read the SP packages and their content certificates from the FIP with a
+ * single I/O into the SP prefetch region, the first time one of them is looked
+ * up. They are then loaded from memory, and the content certificates, shared
+ * by the packages, are only authenticated once. If the part of the FIP
+ * spanning them does not fit in the region, they are read one by one.
+ */
+void arm_sp_prefetch(unsigned int image_id)
+{
+	static bool done;
+	uuid_t uuids[MAX_SP_IDS + 2U];
+	const struct plat_io_policy *policy;
+	unsigned int id, nr_uuids = 0U;
+	int rc;
+
+	if (done || (image_id < SIP_SP_CONTENT_CERT_ID) ||
+	    (image_id >= MAX_IMG_IDS_WITH_SPMDS)) {
+		return;
+	}
+
+	done = true;
+
+	for (id = SIP_SP_CONTENT_CERT_ID; id < MAX_IMG_IDS_WITH_SPMDS; id++) {
+		policy = FCONF_GET_PROPERTY(arm, io_policies, id);
+		if ((policy->dev_handle != &fip_dev_handle) ||
+		    (policy->image_spec == 0U)) {
+			continue;
+		}
+
+		uuids[nr_uuids++] =
+			((const io_uuid_spec_t *)policy->image_spec)->uuid;
+	}
+
+	rc = fip_dev_prefetch((io_dev_info_t *)fip_dev_handle, uuids, nr_uuids,
+			      PLAT_ARM_SP_PREFETCH_BASE,
+			      PLAT_ARM_SP_PREFETCH_SIZE);
+	if (rc != 0) {
+		VERBOSE("SP packages not prefetched (%d)\n", rc);
+	}
+}
+#endif /* ARM_SP_PREFETCH */
+
 #endif /* IMAGE_BL2 */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023, Arm Limited. All rights reserved.
+ * Copyright (c) 2021-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -35,7 +35,7 @@ static int fdt_node_read_reserved_memory_addr(const void *fdt,
 		return err;
 	}
 
-	mem_node = fdt_node_offset_by_phandle(fdt, phandle);
+	mem_node = fconf_node_offset_by_phandle(fdt, phandle);
 	if (mem_node < 0) {
 		ERROR("FCONF: Failed to find reserved memory node from phandle\n");
 		return mem_node;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019-2020, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2019-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -30,7 +30,7 @@ int fconf_populate_sdei_dyn_config(uintptr_t config)
 	const void *dtb = (void *)config;
 
 	/* Check that the node offset points to compatible property */
-	node = fdt_node_offset_by_compatible(dtb, -1, "arm,sdei-1.0");
+	node = fconf_node_offset_by_compatible(dtb, -1, "arm,sdei-1.0");
 	if (node < 0) {
 		ERROR("FCONF: Can't find 'arm,sdei-1.0' compatible node in dtb\n");
 		return node;
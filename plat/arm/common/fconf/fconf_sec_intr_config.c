@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2020-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -36,8 +36,8 @@ int fconf_populate_sec_intr_config(uintptr_t config)
 	/* Necessary to work with libfdt APIs */
 	const void *hw_config_dtb = (const void *)config;
 
-	node = fdt_node_offset_by_compatible(hw_config_dtb, -1,
-						"arm,secure_interrupt_desc");
+	node = fconf_node_offset_by_compatible(hw_config_dtb, -1,
+					       "arm,secure_interrupt_desc");
 	if (node < 0) {
 		ERROR("FCONF: Unable to locate node with %s compatible property\n",
 						"arm,secure_interrupt_desc");
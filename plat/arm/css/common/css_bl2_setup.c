@@ -4,10 +4,12 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <stdbool.h>
 #include <string.h>
 
 #include <common/bl_common.h>
 #include <common/debug.h>
+#include <common/desc_image_load.h>
 #include <drivers/arm/css/css_scp.h>
 #include <lib/mmio.h>
 #include <lib/utils.h>
@@ -17,6 +19,58 @@
 /* Weak definition may be overridden in specific CSS based platform */
 #pragma weak plat_arm_bl2_handle_scp_bl2
 
+#if CSS_SCP_BOOT_ASYNC
+/* Whether SCP may still be reading SCP_BL2 from Trusted RAM */
+static bool scp_boot_pending;
+
+/*******************************************************************************
+ * Wait for SCP to be ready after a transfer started by
+ * plat_arm_bl2_handle_scp_bl2(). Return 0 on success, -1 otherwise.
+ ******************************************************************************/
+static int css_scp_boot_wait(void)
+{
+	int ret;
+
+	if (!scp_boot_pending)
+		return 0;
+
+	scp_boot_pending = false;
+
+	ret = css_scp_boot_ready();
+	if (ret == 0)
+		INFO("BL2: SCP_BL2 transferred to SCP\n");
+	else
+		ERROR("BL2: SCP_BL2 transfer failure\n");
+
+	return ret;
+}
+
+/*******************************************************************************
+ * SCP_BL2 must stay in Trusted RAM until SCP is ready, so wait for it before
+ * loading an image over it. Images which do not overlap SCP_BL2 are loaded and
+ * authenticated while SCP boots.
+ ******************************************************************************/
+int bl2_plat_handle_pre_image_load(unsigned int image_id)
+{
+	bl_mem_params_node_t *bl_mem_params = get_bl_mem_params_node(image_id);
+	uintptr_t base, limit;
+
+	if (!scp_boot_pending)
+		return 0;
+
+	if (bl_mem_params == NULL)
+		return css_scp_boot_wait();
+
+	base = bl_mem_params->image_info.image_base;
+	limit = base + bl_mem_params->image_info.image_max_size;
+
+	if ((base < SCP_BL2_LIMIT) && (limit > SCP_BL2_BASE))
+		return css_scp_boot_wait();
+
+	return 0;
+}
+#endif /* CSS_SCP_BOOT_ASYNC */
+
 /*******************************************************************************
  * Transfer SCP_BL2 from Trusted RAM using the SCP Download protocol.
  * Return 0 on success, -1 otherwise.
@@ -30,8 +84,16 @@ int plat_arm_bl2_handle_scp_bl2(image_info_t *scp_bl2_image_info)
 	ret = css_scp_boot_image_xfer((void *)scp_bl2_image_info->image_base,
 		scp_bl2_image_info->image_size);
 
+#if CSS_SCP_BOOT_ASYNC
+	if (ret == 0) {
+		INFO("BL2: SCP_BL2 transfer started\n");
+		scp_boot_pending = true;
+		return 0;
+	}
+#else
 	if (ret == 0)
 		ret = css_scp_boot_ready();
+#endif
 
 	if (ret == 0)
 		INFO("BL2: SCP_BL2 transferred to SCP\n");
@@ -87,5 +149,21 @@ void bl2_platform_setup(void)
 
 int bl2_plat_handle_post_image_load(unsigned int image_id)
 {
+#if CSS_SCP_BOOT_ASYNC
+	bl_mem_params_node_t *bl_mem_params;
+	int err = arm_bl2_plat_handle_post_image_load(image_id);
+
+	if (err != 0)
+		return err;
+
+	/* SCP must be ready before BL2 hands over after the last image */
+	bl_mem_params = get_bl_mem_params_node(image_id);
+	if ((bl_mem_params == NULL) ||
+	    (bl_mem_params->load_node_mem.next_load_info == NULL))
+		return css_scp_boot_wait();
+
+	return 0;
+#else
 	return arm_bl2_plat_handle_post_image_load(image_id);
+#endif
 }
@@ -95,3 +95,23 @@ $(eval $(call add_define,CSS_NON_SECURE_UART))
 # sequence in which only the CPUs are power cycled.
 CSS_SYSTEM_GRACEFUL_RESET	:= 0
 $(eval $(call add_define,CSS_SYSTEM_GRACEFUL_RESET))
+
+# Process CSS_SCMI_ASYNC_PWR_STATE_SET flag
+# This build option makes a core going to suspend or off post its SCMI power
+# state request and go to WFI without waiting for the SCP to respond.
+CSS_SCMI_ASYNC_PWR_STATE_SET	?= 0
+$(eval $(call assert_boolean,CSS_SCMI_ASYNC_PWR_STATE_SET))
+$(eval $(call add_define,CSS_SCMI_ASYNC_PWR_STATE_SET))
+
+ifeq (${CSS_SCMI_ASYNC_PWR_STATE_SET},1)
+  ifneq (${CSS_USE_SCMI_SDS_DRIVER},1)
+    $(error "CSS_SCMI_ASYNC_PWR_STATE_SET requires CSS_USE_SCMI_SDS_DRIVER=1")
+  endif
+endif
+
+# Process CSS_SCP_BOOT_ASYNC flag
+# This build option makes BL2 go on loading the other images while SCP copies
+# SCP_BL2 out of Trusted RAM, and only wait for SCP when it needs that memory.
+CSS_SCP_BOOT_ASYNC	?= 0
+$(eval $(call assert_boolean,CSS_SCP_BOOT_ASYNC))
+$(eval $(call add_define,CSS_SCP_BOOT_ASYNC))
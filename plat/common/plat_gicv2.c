@@ -35,6 +35,8 @@
 #pragma weak plat_ic_set_interrupt_priority
 #pragma weak plat_ic_set_interrupt_type
 #pragma weak plat_ic_raise_el3_sgi
+#pragma weak plat_ic_raise_el3_sgi_others
+#pragma weak plat_ic_raise_el3_sgi_targets
 #pragma weak plat_ic_raise_ns_sgi
 #pragma weak plat_ic_raise_s_el1_sgi
 #pragma weak plat_ic_set_spi_routing
@@ -256,6 +258,42 @@ void plat_ic_raise_el3_sgi(int sgi_num, u_register_t target)
 #endif
 }
 
+void plat_ic_raise_el3_sgi_others(int sgi_num)
+{
+#if GICV2_G0_FOR_EL3
+	/* Verify that this is a secure SGI */
+	assert(plat_ic_get_interrupt_type(sgi_num) == INTR_TYPE_EL3);
+
+	gicv2_raise_sgi_others(sgi_num, false);
+#else
+	assert(false);
+#endif
+}
+
+void plat_ic_raise_el3_sgi_targets(int sgi_num, const u_register_t *targets,
+				   unsigned int count)
+{
+#if GICV2_G0_FOR_EL3
+	int ids[GICV2_MAX_TARGET_PE];
+	unsigned int i;
+
+	assert(count <= GICV2_MAX_TARGET_PE);
+
+	/* Targets must be valid MPIDRs in the system */
+	for (i = 0U; i < count; i++) {
+		ids[i] = plat_core_pos_by_mpidr(targets[i]);
+		assert(ids[i] >= 0);
+	}
+
+	/* Verify that this is a secure SGI */
+	assert(plat_ic_get_interrupt_type(sgi_num) == INTR_TYPE_EL3);
+
+	gicv2_raise_sgi_targets(sgi_num, false, ids, count);
+#else
+	assert(false);
+#endif
+}
+
 void plat_ic_raise_ns_sgi(int sgi_num, u_register_t target)
 {
 	int id;
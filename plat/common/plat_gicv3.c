@@ -41,6 +41,8 @@
 #pragma weak plat_ic_set_interrupt_priority
 #pragma weak plat_ic_set_interrupt_type
 #pragma weak plat_ic_raise_el3_sgi
+#pragma weak plat_ic_raise_el3_sgi_others
+#pragma weak plat_ic_raise_el3_sgi_targets
 #pragma weak plat_ic_raise_ns_sgi
 #pragma weak plat_ic_raise_s_el1_sgi
 #pragma weak plat_ic_set_spi_routing
@@ -280,6 +282,26 @@ void plat_ic_raise_el3_sgi(int sgi_num, u_register_t target)
 	gicv3_raise_sgi((unsigned int)sgi_num, GICV3_G0, target);
 }
 
+void plat_ic_raise_el3_sgi_others(int sgi_num)
+{
+	/* Verify that this is a secure EL3 SGI */
+	assert(plat_ic_get_interrupt_type((unsigned int)sgi_num) ==
+					  INTR_TYPE_EL3);
+
+	gicv3_raise_sgi_others((unsigned int)sgi_num, GICV3_G0);
+}
+
+void plat_ic_raise_el3_sgi_targets(int sgi_num, const u_register_t *targets,
+				   unsigned int count)
+{
+	/* Verify that this is a secure EL3 SGI */
+	assert(plat_ic_get_interrupt_type((unsigned int)sgi_num) ==
+					  INTR_TYPE_EL3);
+
+	gicv3_raise_sgi_targets((unsigned int)sgi_num, GICV3_G0, targets,
+				count);
+}
+
 void plat_ic_raise_ns_sgi(int sgi_num, u_register_t target)
 {
 	/* Target must be a valid MPIDR in the system */
@@ -138,6 +138,13 @@
 #define MBOX_BUSY					-5
 #define MBOX_TIMEOUT					-2047
 
+/*
+ * The mailbox is polled every MBOX_POLL_US, the timeouts are counted in
+ * polls and expressed in units of 10ms.
+ */
+#define MBOX_POLL_US					10U
+#define MBOX_POLLS_PER_10MS				(10000U / MBOX_POLL_US)
+
 /* Key Status */
 #define MBOX_RET_SDOS_DECRYPTION_ERROR_102		-258
 #define MBOX_RET_SDOS_DECRYPTION_ERROR_103		-259
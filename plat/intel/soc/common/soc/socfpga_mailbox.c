@@ -18,6 +18,13 @@
 static mailbox_payload_t mailbox_resp_payload;
 static mailbox_container_t mailbox_resp_ctr = {0, 0, &mailbox_resp_payload};
 
+/*
+ * Response of an asynchronous job read while polling for the one of a blocking
+ * command, kept for the next mailbox_read_response(_async)() call.
+ */
+static mailbox_payload_t mailbox_parked_payload;
+static bool mailbox_parked;
+
 static bool is_mailbox_cmdbuf_full(uint32_t cin)
 {
 	uint32_t cout = mmio_read_32(MBOX_OFFSET + MBOX_COUT);
@@ -34,13 +41,13 @@ static bool is_mailbox_cmdbuf_empty(uint32_t cin)
 
 static int wait_for_mailbox_cmdbuf_empty(uint32_t cin)
 {
-	unsigned int timeout = 200U;
+	unsigned int timeout = 200U * MBOX_POLLS_PER_10MS;
 
 	do {
 		if (is_mailbox_cmdbuf_empty(cin)) {
 			break;
 		}
-		mdelay(10U);
+		udelay(MBOX_POLL_US);
 	} while (--timeout != 0U);
 
 	if (timeout == 0U) {
@@ -54,7 +61,7 @@ static int write_mailbox_cmd_buffer(uint32_t *cin, uint32_t cout,
 				    uint32_t data,
 				    bool *is_doorbell_triggered)
 {
-	unsigned int timeout = 100U;
+	unsigned int timeout = 100U * MBOX_POLLS_PER_10MS;
 
 	do {
 		if (is_mailbox_cmdbuf_full(*cin)) {
@@ -63,7 +70,7 @@ static int write_mailbox_cmd_buffer(uint32_t *cin, uint32_t cout,
 					      MBOX_DOORBELL_TO_SDM, 1U);
 				*is_doorbell_triggered = true;
 			}
-			mdelay(10U);
+			udelay(MBOX_POLL_US);
 		} else {
 			mmio_write_32(MBOX_ENTRY_TO_ADDR(CMD, (*cin)++), data);
 			*cin %= MBOX_CMD_BUFFER_SIZE;
@@ -132,6 +139,37 @@ restart_mailbox:
 	return MBOX_TIMEOUT;
 }
 
+/* Hand over the parked response, as if it was read from the mailbox */
+static int mailbox_take_parked(unsigned int *job_id, uint32_t *header,
+			       uint32_t *response, unsigned int *resp_len)
+{
+	uint32_t resp_data = mailbox_parked_payload.header;
+	unsigned int len = MBOX_RESP_LEN(resp_data);
+
+	mailbox_parked = false;
+
+	*job_id = MBOX_RESP_JOB_ID(resp_data);
+	if (header != NULL) {
+		*header = resp_data;
+	}
+
+	if ((response != NULL) && (resp_len != NULL)) {
+		if (*resp_len > len) {
+			*resp_len = len;
+		}
+		memcpy_s((uint8_t *)response, *resp_len * MBOX_WORD_BYTE,
+			 (uint8_t *)mailbox_parked_payload.data,
+			 *resp_len * MBOX_WORD_BYTE);
+	}
+
+	if (MBOX_RESP_ERR(resp_data) > 0U) {
+		INFO("SDM response: Return Code: 0x%x\n", MBOX_RESP_ERR(resp_data));
+		return -MBOX_RESP_ERR(resp_data);
+	}
+
+	return MBOX_RET_OK;
+}
+
 int mailbox_read_response(unsigned int *job_id, uint32_t *response,
 				unsigned int *resp_len)
 {
@@ -140,6 +178,10 @@ int mailbox_read_response(unsigned int *job_id, uint32_t *response,
 	uint32_t resp_data;
 	unsigned int ret_resp_len;
 
+	if (mailbox_parked) {
+		return mailbox_take_parked(job_id, NULL, response, resp_len);
+	}
+
 	if (mmio_read_32(MBOX_OFFSET + MBOX_DOORBELL_FROM_SDM) == 1U) {
 		mmio_write_32(MBOX_OFFSET + MBOX_DOORBELL_FROM_SDM, 0U);
 	}
@@ -192,6 +234,8 @@ int mailbox_read_response_async(unsigned int *job_id, uint32_t *header,
 		ret_resp_len = MBOX_RESP_LEN(
 				mailbox_resp_ctr.payload->header) -
 				mailbox_resp_ctr.index;
+	} else if (mailbox_parked) {
+		return mailbox_take_parked(job_id, header, response, resp_len);
 	}
 
 	if (mmio_read_32(MBOX_OFFSET + MBOX_DOORBELL_FROM_SDM) == 1U) {
@@ -277,7 +321,7 @@ int mailbox_read_response_async(unsigned int *job_id, uint32_t *header,
 int mailbox_poll_response(uint32_t job_id, uint32_t urgent, uint32_t *response,
 				unsigned int *resp_len)
 {
-	unsigned int timeout = 40U;
+	unsigned int timeout = 40U * MBOX_POLLS_PER_10MS;
 	unsigned int sdm_loop = 255U;
 	unsigned int ret_resp_len;
 	uint32_t rin;
@@ -291,7 +335,7 @@ int mailbox_poll_response(uint32_t job_id, uint32_t urgent, uint32_t *response,
 				== 1U) {
 				break;
 			}
-			mdelay(10U);
+			udelay(MBOX_POLL_US);
 		} while (--timeout != 0U);
 
 		if (timeout == 0U) {
@@ -324,12 +368,41 @@ int mailbox_poll_response(uint32_t job_id, uint32_t urgent, uint32_t *response,
 			rout %= MBOX_RESP_BUFFER_SIZE;
 			mmio_write_32(MBOX_OFFSET + MBOX_ROUT, rout);
 
-			if (MBOX_RESP_CLIENT_ID(resp_data) != MBOX_ATF_CLIENT_ID
-				|| MBOX_RESP_JOB_ID(resp_data) != job_id) {
+			ret_resp_len = MBOX_RESP_LEN(resp_data);
+
+			if (MBOX_RESP_CLIENT_ID(resp_data) != MBOX_ATF_CLIENT_ID) {
 				continue;
 			}
 
-			ret_resp_len = MBOX_RESP_LEN(resp_data);
+			/*
+			 * Keep the response of an asynchronous job in flight
+			 * for its reader rather than dropping it.
+			 */
+			if (MBOX_RESP_JOB_ID(resp_data) != job_id) {
+				unsigned int parked_len = MBOX_DATA_MAX_LEN;
+				uint32_t *parked_buf = NULL;
+
+				/* Only one is kept, the others are dropped */
+				if (!mailbox_parked &&
+				    ((mailbox_resp_ctr.flag &
+				      MBOX_PAYLOAD_FLAG_BUSY) == 0U)) {
+					mailbox_parked_payload.header =
+						resp_data;
+					parked_buf =
+						mailbox_parked_payload.data;
+				}
+
+				if (iterate_resp(ret_resp_len, parked_buf,
+						 &parked_len) != MBOX_RET_OK) {
+					return MBOX_TIMEOUT;
+				}
+				mailbox_parked = mailbox_parked ||
+						 (parked_buf != NULL);
+
+				rin = mmio_read_32(MBOX_OFFSET + MBOX_RIN);
+				rout = mmio_read_32(MBOX_OFFSET + MBOX_ROUT);
+				continue;
+			}
 
 			if (iterate_resp(ret_resp_len, response, resp_len)
 				!= MBOX_RET_OK) {
@@ -360,7 +433,7 @@ int iterate_resp(uint32_t mbox_resp_len, uint32_t *resp_buf,
 	uint32_t rout = mmio_read_32(MBOX_OFFSET + MBOX_ROUT);
 
 	while (mbox_resp_len > 0U) {
-		timeout = 100U;
+		timeout = 100U * MBOX_POLLS_PER_10MS;
 		mbox_resp_len--;
 		resp_data = mmio_read_32(MBOX_ENTRY_TO_ADDR(RESP, (rout)++));
 
@@ -377,7 +450,7 @@ int iterate_resp(uint32_t mbox_resp_len, uint32_t *resp_buf,
 		do {
 			rin = mmio_read_32(MBOX_OFFSET + MBOX_RIN);
 			if (rout == rin) {
-				mdelay(10U);
+				udelay(MBOX_POLL_US);
 			} else {
 				break;
 			}
@@ -36,6 +36,12 @@
 					MT_DEVICE | MT_RW | EL3_PAS)
 #endif
 
+#ifdef QEMU_VIRTIO_MMIO_BASE
+#define MAP_VIRTIO_MMIO	MAP_REGION_FLAT(QEMU_VIRTIO_MMIO_BASE,		\
+					QEMU_VIRTIO_MMIO_SIZE,		\
+					MT_DEVICE | MT_RW | EL3_PAS)
+#endif
+
 #define MAP_SHARED_RAM	MAP_REGION_FLAT(SHARED_RAM_BASE,		\
 					SHARED_RAM_SIZE,		\
 					MT_DEVICE  | MT_RW | EL3_PAS)
@@ -91,6 +97,9 @@ static const mmap_region_t plat_qemu_mmap[] = {
 #endif
 #ifdef MAP_DEVICE2
 	MAP_DEVICE2,
+#endif
+#ifdef MAP_VIRTIO_MMIO
+	MAP_VIRTIO_MMIO,
 #endif
 	MAP_NS_DRAM0,
 #if SPM_MM
@@ -237,7 +246,6 @@ int plat_rmmd_load_manifest(struct rmm_manifest *manifest)
 	assert(manifest != NULL);
 
 	manifest->version = RMMD_MANIFEST_VERSION;
-	manifest->padding = 0U; /* RES0 */
 	manifest->plat_data = (uintptr_t)NULL;
 	manifest->plat_dram.num_banks = num_banks;
 	manifest->plat_console.num_consoles = num_consoles;
@@ -248,9 +256,9 @@ int plat_rmmd_load_manifest(struct rmm_manifest *manifest)
 	 * +----------------------------------------+
 	 * |  offset  |   field      |  comment     |
 	 * +----------+--------------+--------------+
-	 * |    0     |  version     | 0x00000003   |
+	 * |    0     |  version     | 0x00000004   |
 	 * +----------+--------------+--------------+
-	 * |    4     |  padding     | 0x00000000   |
+	 * |    4     | num_pages    | 0x00000001   |
 	 * +----------+--------------+--------------+
 	 * |    8     | plat_data    |    NULL      |
 	 * +----------+--------------+--------------+
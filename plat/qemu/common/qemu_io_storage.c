@@ -5,6 +5,8 @@
  */
 
 #include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
 #include <string.h>
 
 #include <platform_def.h>
@@ -13,12 +15,14 @@
 #include <common/debug.h>
 #include <common/desc_image_load.h>
 #include <common/uuid.h>
+#include <drivers/io/io_block.h>
 #include <drivers/io/io_driver.h>
 #include <drivers/io/io_encrypted.h>
 #include <drivers/io/io_fip.h>
 #include <drivers/io/io_memmap.h>
 #include <drivers/io/io_semihosting.h>
 #include <drivers/io/io_storage.h>
+#include <drivers/virtio/virtio_blk.h>
 #include <lib/semihosting.h>
 #include <tools_share/firmware_image_package.h>
 
@@ -59,12 +63,47 @@ static uintptr_t sh_dev_handle;
 static const io_dev_connector_t *enc_dev_con;
 static uintptr_t enc_dev_handle;
 #endif
+#if defined(IMAGE_BL2) && defined(QEMU_VIRTIO_MMIO_BASE)
+static const io_dev_connector_t *virtio_dev_con;
+static uintptr_t virtio_dev_handle;
+#endif
 
 static const io_block_spec_t fip_block_spec = {
 	.offset = PLAT_QEMU_FIP_BASE,
 	.length = PLAT_QEMU_FIP_MAX_SIZE
 };
 
+#if defined(IMAGE_BL2) && defined(QEMU_VIRTIO_MMIO_BASE)
+/*
+ * The first half of the virtio-blk area is the io_block buffer, the second
+ * one is left to the driver.
+ */
+static const io_block_dev_spec_t virtio_blk_dev_spec = {
+	.buffer = {
+		.offset = PLAT_QEMU_VIRTIO_BLK_BASE,
+		.length = PLAT_QEMU_VIRTIO_BLK_SIZE / 2U,
+	},
+	.ops = {
+		.read = virtio_blk_read,
+	},
+	.block_size = VIRTIO_BLK_SECTOR_SIZE,
+	.max_direct_read = SIZE_MAX,
+};
+
+static const struct virtio_blk_params virtio_blk_params = {
+	.reg_base = QEMU_VIRTIO_MMIO_BASE,
+	.nr_slots = QEMU_VIRTIO_MMIO_COUNT,
+	.work_base = PLAT_QEMU_VIRTIO_BLK_BASE + (PLAT_QEMU_VIRTIO_BLK_SIZE / 2U),
+	.work_size = PLAT_QEMU_VIRTIO_BLK_SIZE / 2U,
+	.dma_base = NS_DRAM0_BASE,
+	.dma_size = NS_DRAM0_SIZE,
+};
+
+/* The FIP is at the start of the disk, its length is set at probe time */
+static io_block_spec_t virtio_fip_block_spec;
+static bool virtio_fip_present;
+#endif
+
 static const io_uuid_spec_t bl2_uuid_spec = {
 	.uuid = UUID_TRUSTED_BOOT_FIRMWARE_BL2,
 };
@@ -210,6 +249,9 @@ static const io_file_spec_t sh_file_spec[] = {
 
 static int open_fip(const uintptr_t spec);
 static int open_memmap(const uintptr_t spec);
+#if defined(IMAGE_BL2) && defined(QEMU_VIRTIO_MMIO_BASE)
+static int open_virtio_blk(const uintptr_t spec);
+#endif
 #ifndef DECRYPTION_SUPPORT_none
 static int open_enc_fip(const uintptr_t spec);
 #endif
@@ -220,6 +262,14 @@ struct plat_io_policy {
 	int (*check)(const uintptr_t spec);
 };
 
+#if defined(IMAGE_BL2) && defined(QEMU_VIRTIO_MMIO_BASE)
+static const struct plat_io_policy virtio_fip_policy = {
+	&virtio_dev_handle,
+	(uintptr_t)&virtio_fip_block_spec,
+	open_virtio_blk
+};
+#endif
+
 /* By default, ARM platforms load images from the FIP */
 static const struct plat_io_policy policies[] = {
 	[FIP_IMAGE_ID] = {
@@ -418,6 +468,12 @@ static const struct plat_io_policy *get_io_policy(unsigned int image_id)
 	}
 #endif
 
+#if defined(IMAGE_BL2) && defined(QEMU_VIRTIO_MMIO_BASE)
+	if ((image_id == FIP_IMAGE_ID) && virtio_fip_present) {
+		return &virtio_fip_policy;
+	}
+#endif
+
 	assert(image_id < ARRAY_SIZE(policies));
 	return &policies[image_id];
 }
@@ -474,6 +530,52 @@ static int open_memmap(const uintptr_t spec)
 	return result;
 }
 
+#if defined(IMAGE_BL2) && defined(QEMU_VIRTIO_MMIO_BASE)
+static int open_virtio_blk(const uintptr_t spec)
+{
+	int result;
+	uintptr_t local_image_handle;
+
+	result = io_dev_init(virtio_dev_handle, (uintptr_t)NULL);
+	if (result == 0) {
+		result = io_open(virtio_dev_handle, spec, &local_image_handle);
+		if (result == 0) {
+			VERBOSE("Using virtio-blk\n");
+			io_close(local_image_handle);
+		}
+	}
+	return result;
+}
+
+/* Load the FIP from a virtio-blk disk rather than flash if there is one */
+static void qemu_io_setup_virtio_blk(void)
+{
+	size_t size;
+	int io_result;
+
+	if (virtio_blk_init(&virtio_blk_params, &size) != 0) {
+		VERBOSE("No virtio-blk device\n");
+		return;
+	}
+
+	io_result = register_io_dev_block(&virtio_dev_con);
+	assert(io_result == 0);
+
+	io_result = io_dev_open(virtio_dev_con, (uintptr_t)&virtio_blk_dev_spec,
+				&virtio_dev_handle);
+	assert(io_result == 0);
+
+	/* Ignore improbable errors in release builds */
+	(void)io_result;
+
+	virtio_fip_block_spec.offset = 0U;
+	virtio_fip_block_spec.length = size;
+	virtio_fip_present = true;
+
+	INFO("Loading the FIP from virtio-blk\n");
+}
+#endif
+
 static int open_semihosting(const uintptr_t spec)
 {
 	int result;
@@ -527,6 +629,10 @@ void plat_qemu_io_setup(void)
 	io_result = io_dev_open(sh_dev_con, (uintptr_t)NULL, &sh_dev_handle);
 	assert(io_result == 0);
 
+#if defined(IMAGE_BL2) && defined(QEMU_VIRTIO_MMIO_BASE)
+	qemu_io_setup_virtio_blk();
+#endif
+
 	/* Ignore improbable errors in release builds */
 	(void)io_result;
 }
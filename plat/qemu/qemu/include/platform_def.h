@@ -200,9 +200,10 @@
 
 #define PLAT_PHY_ADDR_SPACE_SIZE	(1ULL << 32)
 #define PLAT_VIRT_ADDR_SPACE_SIZE	(1ULL << 32)
-#define MAX_MMAP_REGIONS		(13 + MAX_MMAP_REGIONS_SPMC)
+#define MAX_MMAP_REGIONS		(13 + MAX_MMAP_REGIONS_SPMC + \
+					 QEMU_VIRTIO_BLK)
 #define MAX_XLAT_TABLES			(6 + MAX_XLAT_TABLES_SPMC)
-#define MAX_IO_DEVICES			4
+#define MAX_IO_DEVICES			(4 + QEMU_VIRTIO_BLK)
 #define MAX_IO_HANDLES			4
 
 /*
@@ -234,6 +235,19 @@
 #define DEVICE1_BASE			0x09000000
 #define DEVICE1_SIZE			0x00c00000
 
+#if QEMU_VIRTIO_BLK
+/*
+ * virtio-mmio transports of the virt machine, and the NS DRAM below the BL33
+ * load address BL2 gives to the virtio-blk driver and its io_block buffer.
+ */
+#define QEMU_VIRTIO_MMIO_BASE		0x0a000000
+#define QEMU_VIRTIO_MMIO_COUNT		32
+#define QEMU_VIRTIO_MMIO_SIZE		(QEMU_VIRTIO_MMIO_COUNT * 0x200)
+
+#define PLAT_QEMU_VIRTIO_BLK_BASE	(NS_IMAGE_OFFSET - 0x200000)
+#define PLAT_QEMU_VIRTIO_BLK_SIZE	0x00100000
+#endif
+
 /*
  * GIC related constants
  */
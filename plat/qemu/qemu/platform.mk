@@ -213,6 +213,16 @@ endif
 # Process flags
 $(eval $(call add_define,BL32_RAM_LOCATION_ID))
 
+# Load the FIP from a virtio-blk disk in BL2 when QEMU provides one
+QEMU_VIRTIO_BLK			:=	0
+$(eval $(call assert_boolean,QEMU_VIRTIO_BLK))
+$(eval $(call add_define,QEMU_VIRTIO_BLK))
+
+ifeq (${QEMU_VIRTIO_BLK},1)
+BL2_SOURCES		+=	drivers/io/io_block.c				\
+				drivers/virtio/virtio_blk.c
+endif
+
 # Don't have the Linux kernel as a BL33 image by default
 ARM_LINUX_KERNEL_AS_BL33	:=	0
 $(eval $(call assert_boolean,ARM_LINUX_KERNEL_AS_BL33))
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2020, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -15,8 +15,12 @@
 #include <drivers/io/io_storage.h>
 #include <lib/xlat_tables/xlat_tables_v2.h>
 #include <plat/common/platform.h>
-#ifdef UNIPHIER_DECOMPRESS_GZIP
+#if defined(UNIPHIER_DECOMPRESS_GZIP)
 #include <tf_gunzip.h>
+#define UNIPHIER_DECOMPRESSOR	gunzip
+#elif defined(UNIPHIER_DECOMPRESS_LZ4)
+#include <tf_lz4.h>
+#define UNIPHIER_DECOMPRESSOR	lz4_decompress
 #endif
 
 #include "uniphier.h"
@@ -110,7 +114,7 @@ bl_params_t *plat_get_next_bl_params(void)
 
 void bl2_plat_preload_setup(void)
 {
-#ifdef UNIPHIER_DECOMPRESS_GZIP
+#ifdef UNIPHIER_DECOMPRESSOR
 	uintptr_t buf_base = uniphier_mem_base + UNIPHIER_IMAGE_BUF_OFFSET;
 	int ret;
 
@@ -120,7 +124,8 @@ void bl2_plat_preload_setup(void)
 	if (ret)
 		plat_error_handler(ret);
 
-	image_decompress_init(buf_base, UNIPHIER_IMAGE_BUF_SIZE, gunzip);
+	image_decompress_init(buf_base, UNIPHIER_IMAGE_BUF_SIZE,
+			      UNIPHIER_DECOMPRESSOR);
 #endif
 
 	uniphier_init_image_descs(uniphier_mem_base);
@@ -140,7 +145,7 @@ int bl2_plat_handle_pre_image_load(unsigned int image_id)
 	if (ret)
 		return ret;
 
-#ifdef UNIPHIER_DECOMPRESS_GZIP
+#ifdef UNIPHIER_DECOMPRESSOR
 	image_decompress_prepare(image_info);
 #endif
 	return 0;
@@ -149,7 +154,7 @@ int bl2_plat_handle_pre_image_load(unsigned int image_id)
 int bl2_plat_handle_post_image_load(unsigned int image_id)
 {
 	struct image_info *image_info = uniphier_get_image_info(image_id);
-#ifdef UNIPHIER_DECOMPRESS_GZIP
+#ifdef UNIPHIER_DECOMPRESSOR
 	int ret;
 
 	if (!(image_info->h.attr & IMAGE_ATTRIB_SKIP_LOADING)) {
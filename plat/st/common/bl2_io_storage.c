@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -59,6 +59,9 @@ static struct mmc_device_info mmc_info;
 
 static uint8_t block_buffer[MMC_BLOCK_SIZE] __aligned(MMC_BLOCK_SIZE);
 
+/* Keep direct reads within the 25-bit SDMMC data length register */
+#define MMC_MAX_DIRECT_READ	U(0x1000000)
+
 static io_block_dev_spec_t mmc_block_dev_spec = {
 	/* It's used as temp buffer in block driver */
 	.buffer = {
@@ -70,6 +73,7 @@ static io_block_dev_spec_t mmc_block_dev_spec = {
 		.write = NULL,
 	},
 	.block_size = MMC_BLOCK_SIZE,
+	.max_direct_read = MMC_MAX_DIRECT_READ,
 };
 
 static const io_dev_connector_t *mmc_dev_con;
@@ -255,6 +259,11 @@ static void boot_mmc(enum mmc_device_type mmc_dev_type,
 	}
 
 	params.device_info = &mmc_info;
+
+	/*
+	 * The device powers up while BL2 initializes the DDR, the enumeration
+	 * completes when it is first read.
+	 */
 	if (stm32_sdmmc2_mmc_init(&params) != 0) {
 		ERROR("SDMMC%u init failed\n", boot_interface_instance);
 		panic();
@@ -537,6 +546,11 @@ int bl2_plat_handle_pre_image_load(unsigned int image_id)
 		/* fallthrough */
 	case BOOT_API_CTX_BOOT_INTERFACE_SEL_FLASH_SD:
 		if (!gpt_init_done) {
+			if (mmc_init_wait() != 0) {
+				ERROR("SDMMC init failed\n");
+				panic();
+			}
+
 /*
  * With FWU Multi Bank feature enabled, the selection of
  * the image to boot will be done by fwu_init calling the
@@ -23,6 +23,9 @@
 /* Define maximum page size for NAND devices */
 #define PLATFORM_MTD_MAX_PAGE_SIZE	U(0x1000)
 
+/* Keep the bad block status of the first NAND blocks */
+#define PLATFORM_MTD_BBT_MAX_BLOCKS	U(2048)
+
 /* Needed by STM32CubeProgrammer support */
 #define DWL_BUFFER_SIZE			U(0x01000000)
 
@@ -13,8 +13,16 @@
 
 #define DFU_DESCRIPTOR_TYPE		0x21U
 
-/* Max DFU Packet Size = 1024 bytes */
-#define USBD_DFU_XFER_SIZE		1024U
+/*
+ * Max DFU block size, advertised to the host as wTransferSize. Each block
+ * costs a DNLOAD setup and a GETSTATUS round trip on top of its data packets,
+ * so larger blocks cut the overhead of downloading large images. The blocks
+ * are received directly at their destination, so no buffer of this size is
+ * needed.
+ */
+#ifndef USBD_DFU_XFER_SIZE
+#define USBD_DFU_XFER_SIZE		16384U
+#endif
 
 #define TRANSFER_SIZE_BYTES(size) \
 	((uint8_t)((size) & 0xFF)), /* XFERSIZEB0 */\
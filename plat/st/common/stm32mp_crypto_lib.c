@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, STMicroelectronics - All Rights Reserved
+ * Copyright (c) 2022-2026, STMicroelectronics - All Rights Reserved
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -7,6 +7,7 @@
 #include <assert.h>
 #include <endian.h>
 #include <errno.h>
+#include <stdbool.h>
 
 #include <common/debug.h>
 #include <drivers/auth/crypto_mod.h>
@@ -31,6 +32,7 @@
 #define CRYPTO_SIGN_MAX_SIZE	64U
 #define CRYPTO_PUBKEY_MAX_SIZE	64U
 #define CRYPTO_MAX_TAG_SIZE	16U
+#define SAES_BLOCK_SIZE		16U
 
 /* brainpoolP256t1 OID is not defined in mbedTLS */
 #define OID_EC_GRP_BP256T1          MBEDTLS_OID_EC_BRAINPOOL_V1 "\x08"
@@ -443,6 +445,77 @@ static int crypto_verify_signature(void *data_ptr, unsigned int data_len,
 	return verify_signature(image_hash, my_pk, sig, curve_id);
 }
 
+#if LOAD_IMAGE_STREAM_HASH
+/* SHA-256 digest of the last image hashed by the HASH peripheral as it loaded */
+static struct {
+	bool in_progress;
+	bool valid;
+	const uint8_t *base;
+	size_t len;
+	uint8_t digest[BOOT_API_SHA256_DIGEST_SIZE_IN_BYTES];
+} hash_stream;
+
+static void hash_stream_discard(void)
+{
+	hash_stream.in_progress = false;
+	hash_stream.valid = false;
+}
+
+static int hash_stream_start(void)
+{
+	hash_stream_discard();
+
+	/* Image hashes are always SHA-256, see crypto_verify_hash() */
+	stm32_hash_init(HASH_SHA256);
+	hash_stream.in_progress = true;
+	hash_stream.base = NULL;
+	hash_stream.len = 0U;
+
+	return CRYPTO_SUCCESS;
+}
+
+static int hash_stream_update(void *data_ptr, unsigned int data_len)
+{
+	const uint8_t *data = data_ptr;
+
+	if (!hash_stream.in_progress) {
+		return CRYPTO_ERR_HASH;
+	}
+
+	/* The digest only describes a single contiguous buffer */
+	if (hash_stream.base == NULL) {
+		hash_stream.base = data;
+	} else if (data != (hash_stream.base + hash_stream.len)) {
+		hash_stream_discard();
+		return CRYPTO_ERR_HASH;
+	}
+
+	if (stm32_hash_update(data, data_len) != 0) {
+		hash_stream_discard();
+		return CRYPTO_ERR_HASH;
+	}
+	hash_stream.len += data_len;
+
+	return CRYPTO_SUCCESS;
+}
+
+static int hash_stream_finish(void)
+{
+	if (!hash_stream.in_progress || (hash_stream.len == 0U)) {
+		hash_stream_discard();
+		return CRYPTO_ERR_HASH;
+	}
+
+	hash_stream.in_progress = false;
+	hash_stream.valid = (stm32_hash_final(hash_stream.digest) == 0);
+
+	return hash_stream.valid ? CRYPTO_SUCCESS : CRYPTO_ERR_HASH;
+}
+
+REGISTER_CRYPTO_HASH_STREAM(hash_stream_start, hash_stream_update,
+			    hash_stream_finish, hash_stream_discard);
+#endif /* LOAD_IMAGE_STREAM_HASH */
+
 static int crypto_verify_hash(void *data_ptr, unsigned int data_len,
 			      void *digest_info_ptr,
 			      unsigned int digest_info_len)
@@ -464,12 +537,21 @@ static int crypto_verify_hash(void *data_ptr, unsigned int data_len,
 	digest_info_ptr = p;
 	digest_info_len = len;
 
-	stm32_hash_init(HASH_SHA256);
+#if LOAD_IMAGE_STREAM_HASH
+	/* Reuse the digest computed while the image was loaded */
+	if (hash_stream.valid && (data_ptr == hash_stream.base) &&
+	    (data_len == hash_stream.len)) {
+		memcpy(calc_hash, hash_stream.digest, sizeof(calc_hash));
+	} else
+#endif
+	{
+		stm32_hash_init(HASH_SHA256);
 
-	ret = stm32_hash_final_update(data_ptr, data_len, calc_hash);
-	if (ret != 0) {
-		VERBOSE("%s: hash failed\n", __func__);
-		return CRYPTO_ERR_HASH;
+		ret = stm32_hash_final_update(data_ptr, data_len, calc_hash);
+		if (ret != 0) {
+			VERBOSE("%s: hash failed\n", __func__);
+			return CRYPTO_ERR_HASH;
+		}
 	}
 
 	ret = memcmp(calc_hash, digest_info_ptr, digest_info_len);
@@ -655,6 +737,114 @@ static int crypto_auth_decrypt(enum crypto_dec_algo dec_algo, void *data_ptr, si
 	return CRYPTO_SUCCESS;
 }
 
+#if DECRYPTION_STREAM
+/* State of the image being decrypted by the SAES peripheral as it is read */
+static struct {
+	bool in_progress;
+	/* Set once a chunk that is not a multiple of the block size was seen */
+	bool last_block;
+	struct stm32_saes_context ctx;
+} dec_stream;
+
+static void dec_stream_discard(void)
+{
+	if (dec_stream.in_progress) {
+		zeromem(&dec_stream.ctx, sizeof(dec_stream.ctx));
+		dec_stream.in_progress = false;
+	}
+}
+
+static int dec_stream_start(enum crypto_dec_algo dec_algo, const void *key,
+			    unsigned int key_len, unsigned int key_flags,
+			    const void *iv, unsigned int iv_len)
+{
+	uint32_t real_iv[4];
+	int ret;
+
+	dec_stream_discard();
+
+	if (dec_algo != CRYPTO_GCM_DECRYPT) {
+		return CRYPTO_ERR_DECRYPTION;
+	}
+
+	/* Same nonce and counter layout as crypto_auth_decrypt() */
+	memcpy(real_iv, iv, iv_len);
+	real_iv[3] = htobe32(0x2U);
+
+	ret = stm32_saes_init(&dec_stream.ctx, true, STM32_SAES_MODE_GCM,
+			      select_key(key_flags), key, key_len, real_iv,
+			      sizeof(real_iv));
+	if (ret != 0) {
+		return CRYPTO_ERR_INIT;
+	}
+
+	dec_stream.in_progress = true;
+	dec_stream.last_block = false;
+
+	ret = stm32_saes_update_assodata(&dec_stream.ctx, true, NULL, 0U);
+	if (ret != 0) {
+		dec_stream_discard();
+		return CRYPTO_ERR_DECRYPTION;
+	}
+
+	return CRYPTO_SUCCESS;
+}
+
+static int dec_stream_update(void *data_ptr, size_t len)
+{
+	int ret;
+
+	/* Only the last chunk may end with a partial block */
+	if (!dec_stream.in_progress || dec_stream.last_block) {
+		dec_stream_discard();
+		return CRYPTO_ERR_DECRYPTION;
+	}
+
+	dec_stream.last_block = ((len % SAES_BLOCK_SIZE) != 0U);
+
+	ret = stm32_saes_update_load(&dec_stream.ctx, dec_stream.last_block,
+				     data_ptr, data_ptr, len);
+	if (ret != 0) {
+		dec_stream_discard();
+		return CRYPTO_ERR_DECRYPTION;
+	}
+
+	return CRYPTO_SUCCESS;
+}
+
+static int dec_stream_finish(const void *tag, unsigned int tag_len)
+{
+	unsigned char tag_buf[CRYPTO_MAX_TAG_SIZE];
+	unsigned int diff = 0U;
+	unsigned int i;
+	int ret;
+
+	if (!dec_stream.in_progress) {
+		return CRYPTO_ERR_DECRYPTION;
+	}
+
+	ret = stm32_saes_final(&dec_stream.ctx, tag_buf, sizeof(tag_buf));
+	dec_stream_discard();
+	if (ret != 0) {
+		return CRYPTO_ERR_DECRYPTION;
+	}
+
+	/* Check tag in "constant-time" */
+	for (i = 0U; i < tag_len; i++) {
+		diff |= ((const unsigned char *)tag)[i] ^ tag_buf[i];
+	}
+
+	if (diff != 0U) {
+		return CRYPTO_ERR_DECRYPTION;
+	}
+
+	return CRYPTO_SUCCESS;
+}
+
+REGISTER_CRYPTO_DEC_STREAM(dec_stream_start, dec_stream_update,
+			   dec_stream_finish, dec_stream_discard);
+#endif /* DECRYPTION_STREAM */
+
 REGISTER_CRYPTO_LIB("stm32_crypto_lib",
 		    crypto_lib_init,
 		    crypto_verify_signature,
@@ -226,9 +226,10 @@ static void usb_dfu_download(struct usb_handle *pdev, struct usb_setup_req *req)
 
 	/* Data setup request */
 	if (req->length > 0) {
-		/* Unsupported state */
-		if ((hdfu->dev_state != STATE_DFU_IDLE) &&
-		    (hdfu->dev_state != STATE_DFU_DNLOAD_IDLE)) {
+		/* Unsupported state, or block larger than advertised */
+		if (((hdfu->dev_state != STATE_DFU_IDLE) &&
+		     (hdfu->dev_state != STATE_DFU_DNLOAD_IDLE)) ||
+		    (req->length > USBD_DFU_XFER_SIZE)) {
 			/* Call the error management function (command will be nacked) */
 			usb_core_ctl_error(pdev);
 			return;
@@ -13,6 +13,7 @@
 #include <plat/common/common_def.h>
 
 #include "../stm32mp1_def.h"
+#include "stm32mp1_smc.h"
 
 /*******************************************************************************
  * Generic platform constants
@@ -70,6 +71,10 @@
 #define BL32_LIMIT			(STM32MP_BL32_BASE + \
 					 STM32MP_BL32_SIZE)
 #endif
+
+/* SCMI SMT fast calls, dispatched by SP_MIN_FAST_SMC */
+#define PLAT_SP_MIN_FAST_SMC_FIDS	STM32_SIP_SMC_SCMI_AGENT0, \
+					STM32_SIP_SMC_SCMI_AGENT1,
 #endif /* defined(IMAGE_BL32) */
 
 /*******************************************************************************
@@ -121,7 +121,7 @@ static const uint8_t usb_stm32mp1_config_desc[USB_DFU_CONFIG_DESC_SIZ] = {
 	DFU_BM_ATTRIBUTE, /* bmAttribute for DFU */
 	0xFF, /* DetachTimeOut = 255 ms */
 	0x00,
-	TRANSFER_SIZE_BYTES(USBD_DFU_XFER_SIZE), /* TransferSize = 1024 Byte */
+	TRANSFER_SIZE_BYTES(USBD_DFU_XFER_SIZE), /* TransferSize */
 	((USB_DFU_VERSION >> 0) & 0xFF), /* bcdDFUVersion */
 	((USB_DFU_VERSION >> 8) & 0xFF)
 };
@@ -26,6 +26,8 @@ enum pm_ret_status pm_ipi_send_non_blocking(const struct pm_proc *proc,
 enum pm_ret_status pm_ipi_send_sync(const struct pm_proc *proc,
 				    uint32_t payload[PAYLOAD_ARG_CNT],
 				    uint32_t *value, size_t count);
+enum pm_ret_status pm_ipi_collect(const struct pm_proc *proc,
+				  uint32_t *value, size_t count);
 enum pm_ret_status pm_ipi_buff_read_callb(uint32_t *value, size_t count);
 void pm_ipi_irq_enable(const struct pm_proc *proc);
 void pm_ipi_irq_clear(const struct pm_proc *proc);
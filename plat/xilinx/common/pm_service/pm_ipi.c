@@ -50,6 +50,36 @@ static inline void pm_ipi_lock_release(void)
 }
 #endif
 
+/*
+ * Processor whose last request was sent without waiting for the remote
+ * processor to handle it. Protected by 'pm_secure_lock'.
+ */
+static const struct pm_proc *pm_ipi_pending_proc;
+
+/**
+ * pm_ipi_wait_pending() - Waits for the remote processor to handle the last
+ *                         request sent without blocking, if any.
+ *
+ * The request and response buffers can't be used before. Caller needs to hold
+ * the 'pm_secure_lock' lock.
+ *
+ */
+static void pm_ipi_wait_pending(void)
+{
+	const struct pm_proc *proc = pm_ipi_pending_proc;
+
+	if (proc == NULL) {
+		return;
+	}
+
+	while (((uint32_t)ipi_mb_enquire_status(proc->ipi->local_ipi_id,
+						proc->ipi->remote_ipi_id) &
+		IPI_MB_STATUS_SEND_PENDING) != 0U) {
+	}
+
+	pm_ipi_pending_proc = NULL;
+}
+
 /**
  * pm_ipi_init() - Initialize IPI peripheral for communication with
  *                 remote processor.
@@ -90,6 +120,9 @@ static enum pm_ret_status pm_ipi_send_common(const struct pm_proc *proc,
 	payload[PAYLOAD_CRC_POS] = calculate_crc(payload, IPI_W0_TO_W6_SIZE);
 #endif
 
+	/* The previous request may still be read from the buffer */
+	pm_ipi_wait_pending();
+
 	/* Write payload into IPI buffer */
 	for (size_t i = 0; i < PAYLOAD_ARG_CNT; i++) {
 		mmio_write_32(buffer_base + offset, payload[i]);
@@ -109,7 +142,9 @@ static enum pm_ret_status pm_ipi_send_common(const struct pm_proc *proc,
  * @proc: Pointer to the processor who is initiating request.
  * @payload: API id and call arguments to be written in IPI buffer.
  *
- * Send an IPI request to the power controller.
+ * Send an IPI request to the power controller and return while it handles
+ * it. The next request waits for it to be done, and the response can be read
+ * with pm_ipi_collect() until then.
  *
  * Return: Returns status, either success or error+reason.
  *
@@ -122,6 +157,9 @@ enum pm_ret_status pm_ipi_send_non_blocking(const struct pm_proc *proc,
 	pm_ipi_lock_get();
 
 	ret = pm_ipi_send_common(proc, payload, IPI_NON_BLOCKING);
+	if (ret == PM_RET_SUCCESS) {
+		pm_ipi_pending_proc = proc;
+	}
 
 	pm_ipi_lock_release();
 
@@ -281,6 +319,37 @@ unlock:
 	return ret;
 }
 
+/**
+ * pm_ipi_collect() - Reads the response to the last request sent with
+ *                    pm_ipi_send_non_blocking().
+ * @proc: Pointer to the processor who sent the request.
+ * @value: Used to return value from IPI buffer element (optional).
+ * @count: Number of values to return in @value.
+ *
+ * Wait for the power controller to handle the request if it has not yet.
+ *
+ * Return: Returns status, either success or error+reason and, optionally,
+ *         @value. PM_RET_ERROR_CONFLICT if the response has already been
+ *         read, or overwritten by another request.
+ *
+ */
+enum pm_ret_status pm_ipi_collect(const struct pm_proc *proc,
+				  uint32_t *value, size_t count)
+{
+	enum pm_ret_status ret = PM_RET_ERROR_CONFLICT;
+
+	pm_ipi_lock_get();
+
+	if (pm_ipi_pending_proc == proc) {
+		pm_ipi_wait_pending();
+		ret = ERROR_CODE_MASK & (pm_ipi_buff_read(proc, value, count));
+	}
+
+	pm_ipi_lock_release();
+
+	return ret;
+}
+
 void pm_ipi_irq_enable(const struct pm_proc *proc)
 {
 	ipi_mb_enable_irq(proc->ipi->local_ipi_id, proc->ipi->remote_ipi_id);
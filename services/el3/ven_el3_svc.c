@@ -1,16 +1,25 @@
 /*
- * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2024-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <errno.h>
 #include <stdint.h>
 
 #include <common/debug.h>
 #include <common/runtime_svc.h>
 #include <lib/debugfs.h>
+#include <lib/extensions/amu.h>
+#include <lib/lib_bench.h>
+#include <lib/mpmm/mpmm.h>
 #include <lib/pmf/pmf.h>
+#include <lib/psci/psci.h>
+#include <lib/spinlock.h>
+#include <lib/xlat_tables/xlat_tables_v2.h>
+#include <services/pci_svc.h>
 #include <services/ven_el3_svc.h>
+#include <smccc_helpers.h>
 #include <tools_share/uuid.h>
 
 /* vendor-specific EL3 UUID */
@@ -35,6 +44,279 @@ static int ven_el3_svc_setup(void)
 	return 0;
 }
 
+#if ENABLE_PSCI_STAT && PLAT_XLAT_TABLES_DYNAMIC
+/* Serialises the use of the dynamic mapping of the caller's buffer */
+static spinlock_t psci_stat_buf_lock;
+
+/*
+ * Write the PSCI stats table into the Normal world buffer of 'size' bytes at
+ * physical address 'base_pa'. Returns the number of bytes written, or the
+ * number of bytes needed if the buffer is too small.
+ */
+static uintptr_t psci_stat_get_all_smc(u_register_t base_pa, u_register_t size,
+				       void *handle, u_register_t flags)
+{
+	uintptr_t base_va;
+	size_t written = 0U;
+	int rc;
+
+	if (is_caller_secure(flags)) {
+		SMC_RET1(handle, SMC_UNK);
+	}
+
+	if ((size == 0U) || (size > VEN_EL3_PSCI_STAT_BUF_MAX) ||
+	    ((base_pa & (PAGE_SIZE - 1U)) != 0U)) {
+		SMC_RET1(handle, SMC_INVALID_PARAM);
+	}
+
+	spin_lock(&psci_stat_buf_lock);
+
+	/* Mapped as Non-secure so that it can not target Secure memory */
+	rc = mmap_add_dynamic_region_alloc_va(base_pa, &base_va,
+			round_up(size, PAGE_SIZE),
+			MT_MEMORY | MT_RW | MT_NS | MT_EXECUTE_NEVER);
+	if (rc == 0) {
+		rc = psci_stat_get_all((void *)base_va, size, &written);
+		(void)mmap_remove_dynamic_region(base_va,
+				round_up(size, PAGE_SIZE));
+	}
+
+	spin_unlock(&psci_stat_buf_lock);
+
+	if (written > size) {
+		SMC_RET2(handle, SMC_INVALID_PARAM, written);
+	}
+
+	if (rc != 0) {
+		SMC_RET1(handle, SMC_INVALID_PARAM);
+	}
+
+	SMC_RET2(handle, SMC_OK, written);
+}
+#endif /* ENABLE_PSCI_STAT && PLAT_XLAT_TABLES_DYNAMIC */
+
+#if PSCI_CPU_ON_BATCH
+/*
+ * Power on the cpus 'aff_base' with Aff0 set to each of the bits of
+ * 'aff0_mask'. Returns the mask of the cpus actually powered on in x1.
+ */
+static uintptr_t psci_cpu_on_batch_smc(u_register_t aff_base,
+				       u_register_t aff0_mask,
+				       u_register_t entrypoint,
+				       u_register_t context_id,
+				       void *handle, u_register_t flags)
+{
+	u_register_t started;
+	int rc;
+
+	if (is_caller_secure(flags)) {
+		SMC_RET1(handle, SMC_UNK);
+	}
+
+	rc = psci_cpu_on_batch(aff_base, aff0_mask, entrypoint, context_id,
+			       &started);
+
+	SMC_RET2(handle, rc, started);
+}
+#endif /* PSCI_CPU_ON_BATCH */
+
+#if PSCI_IDLE_PREDICT
+/* Return the idle prediction counters of the cpu 'mpidr' */
+static uintptr_t psci_idle_predict_smc(u_register_t mpidr, void *handle)
+{
+	u_register_t hits, misses, demotions;
+
+	if (psci_idle_predict_stats(mpidr, &hits, &misses,
+				    &demotions) != PSCI_E_SUCCESS) {
+		SMC_RET1(handle, SMC_INVALID_PARAM);
+	}
+
+	SMC_RET4(handle, SMC_OK, hits, misses, demotions);
+}
+#endif /* PSCI_IDLE_PREDICT */
+
+#if LIB_BENCH
+#if !PLAT_XLAT_TABLES_DYNAMIC
+#error "LIB_BENCH requires PLAT_XLAT_TABLES_DYNAMIC"
+#endif
+
+/*
+ * Run the library benchmark in the Normal world buffer of 'size' bytes at
+ * physical address 'base_pa' and print the results on the console.
+ */
+static uintptr_t lib_bench_smc(u_register_t base_pa, u_register_t size,
+			       void *handle, u_register_t flags)
+{
+	uintptr_t base_va;
+	int rc;
+
+	if (is_caller_secure(flags)) {
+		SMC_RET1(handle, SMC_UNK);
+	}
+
+	if ((size < LIB_BENCH_BUF_SIZE) || (size > (2U * LIB_BENCH_BUF_SIZE)) ||
+	    ((base_pa & (PAGE_SIZE - 1U)) != 0U)) {
+		SMC_RET1(handle, SMC_INVALID_PARAM);
+	}
+
+	/* Mapped as Non-secure so that it can not target Secure memory */
+	rc = mmap_add_dynamic_region_alloc_va(base_pa, &base_va,
+			round_up(size, PAGE_SIZE),
+			MT_MEMORY | MT_RW | MT_NS | MT_EXECUTE_NEVER);
+	if (rc != 0) {
+		SMC_RET1(handle, SMC_INVALID_PARAM);
+	}
+
+	rc = lib_bench_run(&lib_bench_el3_counter, (void *)base_va, size);
+	(void)mmap_remove_dynamic_region(base_va, round_up(size, PAGE_SIZE));
+
+	if (rc != 0) {
+		ERROR("lib_bench: failed (%d)\n", rc);
+		SMC_RET1(handle, SMC_INVALID_PARAM);
+	}
+
+	SMC_RET1(handle, SMC_OK);
+}
+#endif /* LIB_BENCH */
+
+#if AMU_SNAPSHOT
+/*
+ * Register the Normal world buffer of 'size' bytes at physical address
+ * 'base_pa' the AMU counters are published into. Returns the size required in
+ * x1 if the buffer is too small.
+ */
+static uintptr_t amu_snapshot_set_buf_smc(u_register_t base_pa,
+					  u_register_t size,
+					  void *handle, u_register_t flags)
+{
+	int rc;
+
+	if (is_caller_secure(flags)) {
+		SMC_RET1(handle, SMC_UNK);
+	}
+
+	rc = amu_snapshot_set_buffer(base_pa, size);
+	if (rc == -ENOMEM) {
+		SMC_RET2(handle, SMC_INVALID_PARAM,
+			 PLATFORM_CORE_COUNT * sizeof(struct amu_snapshot));
+	} else if (rc == -EPERM) {
+		SMC_RET1(handle, SMC_DENIED);
+	} else if (rc != 0) {
+		SMC_RET1(handle, SMC_INVALID_PARAM);
+	}
+
+	SMC_RET1(handle, SMC_OK);
+}
+
+/*
+ * Publish the AMU counters of the calling cpu and return its four architected
+ * counters in x1-x4.
+ */
+static uintptr_t amu_snapshot_update_smc(void *handle, u_register_t flags)
+{
+	uint64_t cnts[4];
+
+	if (is_caller_secure(flags) || (amu_snapshot_update(cnts) != 0)) {
+		SMC_RET1(handle, SMC_UNK);
+	}
+
+	SMC_RET5(handle, SMC_OK, cnts[0], cnts[1], cnts[2], cnts[3]);
+}
+#endif /* AMU_SNAPSHOT */
+
+#if MPMM_GEAR_CONTROL
+/*
+ * Return the MPMM gear of the calling cpu in x1 and the cycles it spent in
+ * gears 0 to 2 in x2-x4.
+ */
+static uintptr_t mpmm_gear_get_smc(void *handle, u_register_t flags)
+{
+	uint64_t residency[MPMM_GEARS];
+	unsigned int gear;
+
+	if (is_caller_secure(flags)) {
+		SMC_RET1(handle, SMC_UNK);
+	}
+
+	if (mpmm_gear_get(&gear, residency) != 0) {
+		SMC_RET1(handle, SMC_ARCH_CALL_NOT_SUPPORTED);
+	}
+
+	SMC_RET5(handle, SMC_OK, gear, residency[0], residency[1],
+		 residency[2]);
+}
+
+/* Select the MPMM gear 'gear' for the calling cpu */
+static uintptr_t mpmm_gear_set_smc(u_register_t gear, void *handle,
+				   u_register_t flags)
+{
+	int rc;
+
+	if (is_caller_secure(flags)) {
+		SMC_RET1(handle, SMC_UNK);
+	}
+
+	if (gear >= MPMM_GEARS) {
+		SMC_RET1(handle, SMC_INVALID_PARAM);
+	}
+
+	rc = mpmm_gear_set((unsigned int)gear);
+	if (rc != 0) {
+		SMC_RET1(handle, SMC_ARCH_CALL_NOT_SUPPORTED);
+	}
+
+	SMC_RET1(handle, SMC_OK);
+}
+#endif /* MPMM_GEAR_CONTROL */
+
+#if SMC_PCI_SUPPORT && PLAT_XLAT_TABLES_DYNAMIC
+/* Serialises the use of the dynamic mapping of the caller's buffer */
+static spinlock_t pci_batch_buf_lock;
+
+/*
+ * Perform the 'count' PCI configuration accesses described by the array of
+ * struct pci_batch_op at physical address 'base_pa'. Returns the number of
+ * accesses done in x1, which is less than 'count' if one failed.
+ */
+static uintptr_t pci_batch_smc(u_register_t base_pa, u_register_t count,
+			       void *handle, u_register_t flags)
+{
+	size_t size = count * sizeof(struct pci_batch_op);
+	uintptr_t base_va;
+	size_t done = 0U;
+	int rc;
+
+	if (is_caller_secure(flags)) {
+		SMC_RET1(handle, SMC_UNK);
+	}
+
+	if ((count == 0U) ||
+	    (count > (VEN_EL3_PCI_BATCH_BUF_MAX / sizeof(struct pci_batch_op))) ||
+	    ((base_pa & (PAGE_SIZE - 1U)) != 0U)) {
+		SMC_RET1(handle, SMC_INVALID_PARAM);
+	}
+
+	spin_lock(&pci_batch_buf_lock);
+
+	/* Mapped as Non-secure so that it can not target Secure memory */
+	rc = mmap_add_dynamic_region_alloc_va(base_pa, &base_va,
+			round_up(size, PAGE_SIZE),
+			MT_MEMORY | MT_RW | MT_NS | MT_EXECUTE_NEVER);
+	if (rc == 0) {
+		rc = pci_config_batch((struct pci_batch_op *)base_va, count,
+				      &done);
+		(void)mmap_remove_dynamic_region(base_va,
+				round_up(size, PAGE_SIZE));
+	} else {
+		rc = SMC_INVALID_PARAM;
+	}
+
+	spin_unlock(&pci_batch_buf_lock);
+
+	SMC_RET2(handle, rc, done);
+}
+#endif /* SMC_PCI_SUPPORT && PLAT_XLAT_TABLES_DYNAMIC */
+
 /*
  * This function handles Arm defined vendor-specific EL3 Service Calls.
  */
@@ -79,6 +361,54 @@ static uintptr_t ven_el3_svc_handler(unsigned int smc_fid,
 	case VEN_EL3_SVC_VERSION:
 		SMC_RET2(handle, VEN_EL3_SVC_VERSION_MAJOR, VEN_EL3_SVC_VERSION_MINOR);
 		break;
+#if ENABLE_PSCI_STAT && PLAT_XLAT_TABLES_DYNAMIC
+	case VEN_EL3_PSCI_STAT_GET_ALL_32:
+		return psci_stat_get_all_smc((uint32_t)x1, (uint32_t)x2, handle,
+					     flags);
+	case VEN_EL3_PSCI_STAT_GET_ALL_64:
+		return psci_stat_get_all_smc(x1, x2, handle, flags);
+#endif /* ENABLE_PSCI_STAT && PLAT_XLAT_TABLES_DYNAMIC */
+#if PSCI_CPU_ON_BATCH
+	case VEN_EL3_PSCI_CPU_ON_BATCH_64:
+		return psci_cpu_on_batch_smc(x1, x2, x3, x4, handle, flags);
+#endif /* PSCI_CPU_ON_BATCH */
+#if PSCI_IDLE_PREDICT
+	case VEN_EL3_PSCI_IDLE_PREDICT_32:
+		return psci_idle_predict_smc((uint32_t)x1, handle);
+	case VEN_EL3_PSCI_IDLE_PREDICT_64:
+		return psci_idle_predict_smc(x1, handle);
+#endif /* PSCI_IDLE_PREDICT */
+#if LIB_BENCH
+	case VEN_EL3_LIB_BENCH_32:
+		return lib_bench_smc((uint32_t)x1, (uint32_t)x2, handle, flags);
+	case VEN_EL3_LIB_BENCH_64:
+		return lib_bench_smc(x1, x2, handle, flags);
+#endif /* LIB_BENCH */
+#if AMU_SNAPSHOT
+	case VEN_EL3_AMU_SNAPSHOT_SET_BUF_32:
+		return amu_snapshot_set_buf_smc((uint32_t)x1, (uint32_t)x2,
+						handle, flags);
+	case VEN_EL3_AMU_SNAPSHOT_SET_BUF_64:
+		return amu_snapshot_set_buf_smc(x1, x2, handle, flags);
+	case VEN_EL3_AMU_SNAPSHOT_UPDATE_32:
+	case VEN_EL3_AMU_SNAPSHOT_UPDATE_64:
+		return amu_snapshot_update_smc(handle, flags);
+#endif /* AMU_SNAPSHOT */
+#if MPMM_GEAR_CONTROL
+	case VEN_EL3_MPMM_GEAR_GET_32:
+	case VEN_EL3_MPMM_GEAR_GET_64:
+		return mpmm_gear_get_smc(handle, flags);
+	case VEN_EL3_MPMM_GEAR_SET_32:
+		return mpmm_gear_set_smc((uint32_t)x1, handle, flags);
+	case VEN_EL3_MPMM_GEAR_SET_64:
+		return mpmm_gear_set_smc(x1, handle, flags);
+#endif /* MPMM_GEAR_CONTROL */
+#if SMC_PCI_SUPPORT && PLAT_XLAT_TABLES_DYNAMIC
+	case VEN_EL3_PCI_BATCH_32:
+		return pci_batch_smc((uint32_t)x1, (uint32_t)x2, handle, flags);
+	case VEN_EL3_PCI_BATCH_64:
+		return pci_batch_smc(x1, x2, handle, flags);
+#endif /* SMC_PCI_SUPPORT && PLAT_XLAT_TABLES_DYNAMIC */
 	default:
 		WARN("Unimplemented vendor-specific EL3 Service call: 0x%x\n", smc_fid);
 		SMC_RET1(handle, SMC_UNK);
@@ -34,6 +34,14 @@ $(eval $(call add_define,OPTEE_ALLOW_SMC_LOAD))
 include lib/libfdt/libfdt.mk
 endif
 
+# Lets OP-TEE return from a fast SMC with TEESMC_OPTEED_RETURN_FAST_CALL_DONE
+# when it did not change its EL1 system registers, which skips saving the secure
+# EL1 context on the way back to the normal world. Only enable it with an OP-TEE that
+# uses that return function ID.
+OPTEED_FAST_CALL_KEEP_EL1	:=	0
+$(eval $(call assert_boolean,OPTEED_FAST_CALL_KEEP_EL1))
+$(eval $(call add_define,OPTEED_FAST_CALL_KEEP_EL1))
+
 CROS_WIDEVINE_SMC		:=	0
 ifeq ($(CROS_WIDEVINE_SMC),1)
 ifeq ($(OPTEE_ALLOW_SMC_LOAD),0)
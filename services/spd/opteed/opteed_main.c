@@ -811,6 +811,27 @@ static uintptr_t opteed_smc_handler(uint32_t smc_fid,
 
 		SMC_RET4(ns_cpu_context, x1, x2, x3, x4);
 
+#if OPTEED_FAST_CALL_KEEP_EL1
+	/*
+	 * OPTEE is returning from a fast call which left its EL1 system
+	 * registers as they were restored on entry, so the saved secure
+	 * state is still current and only the non-secure one needs
+	 * switching back.
+	 */
+	case TEESMC_OPTEED_RETURN_FAST_CALL_DONE:
+		assert(handle == cm_get_context(SECURE));
+
+		/* Get a reference to the non-secure context */
+		ns_cpu_context = cm_get_context(NON_SECURE);
+		assert(ns_cpu_context);
+
+		/* Restore non-secure state */
+		cm_el1_sysregs_context_restore(NON_SECURE);
+		cm_set_next_eret_context(NON_SECURE);
+
+		SMC_RET4(ns_cpu_context, x1, x2, x3, x4);
+#endif
+
 	/*
 	 * OPTEE has finished handling a S-EL1 FIQ interrupt. Execution
 	 * should resume in the normal world.
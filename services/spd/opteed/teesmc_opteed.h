@@ -122,6 +122,21 @@
 #define TEESMC_OPTEED_RETURN_SYSTEM_RESET_DONE \
 	TEESMC_OPTEED_RV(TEESMC_OPTEED_FUNCID_RETURN_SYSTEM_RESET_DONE)
 
+/*
+ * Issued instead of TEESMC_OPTEED_RETURN_CALL_DONE when returning from the
+ * "fast_smc" vector without having changed any of the EL1 system registers
+ * since the entry, so that the dispatcher can skip saving them. Only honoured
+ * when the dispatcher is built with OPTEED_FAST_CALL_KEEP_EL1=1.
+ *
+ * Register usage:
+ * r0/x0	SMC Function ID, TEESMC_OPTEED_RETURN_FAST_CALL_DONE
+ * r1-4/x1-4	Return value 0-3 which will passed to normal world in
+ *		r0-3/x0-3
+ */
+#define TEESMC_OPTEED_FUNCID_RETURN_FAST_CALL_DONE	9
+#define TEESMC_OPTEED_RETURN_FAST_CALL_DONE \
+	TEESMC_OPTEED_RV(TEESMC_OPTEED_FUNCID_RETURN_FAST_CALL_DONE)
+
 /*
  * This section specifies SMC function IDs used when the secure monitor is
  * invoked from the non-secure world.
@@ -580,6 +580,12 @@ static uintptr_t tspd_smc_handler(uint32_t smc_fid,
 		 * context registers.
 		 */
 	case TSP_YIELD_FID(TSP_MODIFY_EL1_CTX):
+		/*
+		 * Request from non-secure client to time the world
+		 * switch.
+		 */
+	case TSP_FAST_FID(TSP_NOP):
+	case TSP_YIELD_FID(TSP_NOP):
 		if (ns) {
 			/*
 			 * This is a fresh request from the non-secure client.
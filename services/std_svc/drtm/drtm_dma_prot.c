@@ -113,6 +113,7 @@ enum drtm_retc drtm_dma_prot_engage(const struct_drtm_dl_dma_prot_args *a,
 {
 	const uintptr_t *smmus;
 	size_t num_smmus = 0;
+	int rc;
 
 	if (active_prot.type != PROTECT_NONE) {
 		ERROR("DRTM: launch denied as previous DMA protection"
@@ -133,18 +134,15 @@ enum drtm_retc drtm_dma_prot_engage(const struct_drtm_dl_dma_prot_args *a,
 	 * Only PROTECT_MEM_ALL is implemented currently.
 	 */
 	plat_enumerate_smmus(&smmus, &num_smmus);
-	for (const uintptr_t *smmu = smmus; smmu < smmus+num_smmus; smmu++) {
-		/*
-		 * TODO: Invalidate SMMU's Stage-1 and Stage-2 TLB entries.  This ensures
-		 * that any outstanding device transactions are completed, see Section
-		 * 3.21.1, specification IHI_0070_C_a for an approximate reference.
-		 */
-		int rc = smmuv3_ns_set_abort_all(*smmu);
-		if (rc != 0) {
-			ERROR("DRTM: SMMU at PA 0x%lx failed to engage DMA protection"
-			      " rc=%d\n", *smmu, rc);
-			return INTERNAL_ERROR;
-		}
+	/*
+	 * TODO: Invalidate SMMU's Stage-1 and Stage-2 TLB entries.  This ensures
+	 * that any outstanding device transactions are completed, see Section
+	 * 3.21.1, specification IHI_0070_C_a for an approximate reference.
+	 */
+	rc = smmuv3_ns_set_abort_all_smmus(smmus, (unsigned int)num_smmus);
+	if (rc != 0) {
+		ERROR("DRTM: SMMUs failed to engage DMA protection rc=%d\n", rc);
+		return INTERNAL_ERROR;
 	}
 
 	/*
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024 Arm Limited. All rights reserved.
+ * Copyright (c) 2022-2026, Arm Limited. All rights reserved.
  *
  * SPDX-License-Identifier:    BSD-3-Clause
  *
@@ -22,7 +22,9 @@
 #include "drtm_measurements.h"
 #include "drtm_remediation.h"
 #include <lib/el3_runtime/context_mgmt.h>
+#include <lib/pmf/pmf.h>
 #include <lib/psci/psci_lib.h>
+#include <lib/runtime_instr.h>
 #include <lib/xlat_tables/xlat_tables_v2.h>
 #include <plat/common/platform.h>
 #include <services/drtm_svc.h>
@@ -41,6 +43,12 @@ struct_dlme_data_header dlme_data_hdr_init;
 /* Minimum data memory requirement */
 uint64_t dlme_data_min_size;
 
+void drtm_record_boot_pe(void)
+{
+	/* Read boot PE ID from MPIDR */
+	plat_drtm_features.boot_pe_id = read_mpidr_el1() & MPIDR_AFFINITY_MASK;
+}
+
 int drtm_setup(void)
 {
 	bool rc;
@@ -49,9 +57,6 @@ int drtm_setup(void)
 
 	INFO("DRTM service setup\n");
 
-	/* Read boot PE ID from MPIDR */
-	plat_drtm_features.boot_pe_id = read_mpidr_el1() & MPIDR_AFFINITY_MASK;
-
 	rc = drtm_dma_prot_init();
 	if (rc) {
 		return INTERNAL_ERROR;
@@ -586,6 +591,12 @@ static uint64_t drtm_dynamic_launch(uint64_t x1, void *handle)
 	/* DLME should be highest NS exception level */
 	enum drtm_dlme_el dlme_el = (el_implemented(2) != EL_IMPL_NONE) ? MODE_EL2 : MODE_EL1;
 
+#if ENABLE_RUNTIME_INSTRUMENTATION
+	PMF_CAPTURE_TIMESTAMP(rt_instr_svc,
+	    RT_INSTR_ENTER_DRTM_LAUNCH,
+	    PMF_NO_CACHE_MAINT);
+#endif
+
 	/* Ensure that only boot PE is powered on */
 	ret = drtm_dl_check_cores();
 	if (ret != SUCCESS) {
@@ -630,11 +641,23 @@ static uint64_t drtm_dynamic_launch(uint64_t x1, void *handle)
 	 * protections before returning to the caller.
 	 */
 
+#if ENABLE_RUNTIME_INSTRUMENTATION
+	PMF_CAPTURE_TIMESTAMP(rt_instr_svc,
+	    RT_INSTR_DRTM_DMA_PROT,
+	    PMF_NO_CACHE_MAINT);
+#endif
+
 	ret = drtm_take_measurements(&args);
 	if (ret != SUCCESS) {
 		goto err_undo_dma_prot;
 	}
 
+#if ENABLE_RUNTIME_INSTRUMENTATION
+	PMF_CAPTURE_TIMESTAMP(rt_instr_svc,
+	    RT_INSTR_DRTM_MEASURE,
+	    PMF_NO_CACHE_MAINT);
+#endif
+
 	ret = drtm_dl_prepare_dlme_data(&args);
 	if (ret != SUCCESS) {
 		goto err_undo_dma_prot;
@@ -668,6 +691,12 @@ static uint64_t drtm_dynamic_launch(uint64_t x1, void *handle)
 	 */
 	invalidate_icache_all();
 
+#if ENABLE_RUNTIME_INSTRUMENTATION
+	PMF_CAPTURE_TIMESTAMP(rt_instr_svc,
+	    RT_INSTR_EXIT_DRTM_LAUNCH,
+	    PMF_NO_CACHE_MAINT);
+#endif
+
 	/* Return the DLME region's address in x0, and the DLME data offset in x1.*/
 	SMC_RET2(handle, args.dlme_paddr, args.dlme_data_off);
 
@@ -5,14 +5,51 @@
  */
 
 #include <assert.h>
+#include <string.h>
+
 #include "cpu_errata_info.h"
+#include <common/debug.h>
 #include <lib/cpus/cpu_ops.h>
 #include <lib/cpus/errata.h>
 #include <lib/smccc.h>
+#include <lib/spinlock.h>
 #include <lib/utils_def.h>
+#include <plat/common/platform.h>
 #include <services/errata_abi_svc.h>
 #include <smccc_helpers.h>
 
+#include <platform_def.h>
+
+/*
+ * Queries are answered from a table of the status of each erratum, sorted by
+ * ID and built on the first query from a CPU of a given type and revision.
+ * ERRATA_ABI_MAX_CPU_TYPES bounds the number of different CPUs in the system,
+ * and ERRATA_ABI_MAX_ERRATA the number of errata of each. CPUs beyond these
+ * bounds fall back to scanning the errata lists.
+ */
+#ifndef ERRATA_ABI_MAX_CPU_TYPES
+#define ERRATA_ABI_MAX_CPU_TYPES	U(4)
+#endif
+
+#ifndef ERRATA_ABI_MAX_ERRATA
+#define ERRATA_ABI_MAX_ERRATA		U(64)
+#endif
+
+struct em_lookup_table {
+	struct cpu_ops *cpu_ops;	/* NULL if the table is unused */
+	long rev_var;
+	bool valid;			/* false if the errata did not fit */
+	unsigned int count;
+	struct {
+		uint32_t id;
+		int32_t status;
+	} entries[ERRATA_ABI_MAX_ERRATA];
+};
+
+static struct em_lookup_table em_tables[ERRATA_ABI_MAX_CPU_TYPES];
+static struct em_lookup_table *em_core_table[PLATFORM_CORE_COUNT];
+static spinlock_t em_tables_lock;
+
 /*
  * Global pointer that points to the specific
  * structure based on the MIDR part number
@@ -165,16 +202,14 @@ static int32_t non_arm_interconnect_errata(uint32_t errata_id, long rev_var)
 }
 #endif
 
-/* Function to check if the errata exists for the specific CPU and rxpx */
-int32_t verify_errata_implemented(uint32_t errata_id, uint32_t forward_flag)
+/* Status of an erratum in the lists of the calling CPU, found by a linear scan */
+static int32_t errata_status_linear(uint32_t errata_id, long rev_var)
 {
 	int32_t ret_val;
 	struct cpu_ops *cpu_ops;
 	struct erratum_entry *entry, *end;
-	long rev_var;
 
 	ret_val = EM_UNKNOWN_ERRATUM;
-	rev_var = cpu_get_rev_var();
 
 #if ERRATA_NON_ARM_INTERCONNECT
 	ret_val = non_arm_interconnect_errata(errata_id, rev_var);
@@ -209,6 +244,174 @@ int32_t verify_errata_implemented(uint32_t errata_id, uint32_t forward_flag)
 	return ret_val;
 }
 
+/*
+ * Add an erratum to a lookup table, keeping it sorted by ID. As in the linear
+ * scan, the first status added for an ID wins. Return false if the table is
+ * full.
+ */
+static bool em_table_add(struct em_lookup_table *table, uint32_t errata_id,
+			 int32_t status)
+{
+	unsigned int lo = 0U, hi = table->count, mid;
+
+	while (lo < hi) {
+		mid = (lo + hi) / 2U;
+		if (table->entries[mid].id < errata_id) {
+			lo = mid + 1U;
+		} else {
+			hi = mid;
+		}
+	}
+
+	if ((lo < table->count) && (table->entries[lo].id == errata_id)) {
+		return true;
+	}
+
+	if (table->count == ERRATA_ABI_MAX_ERRATA) {
+		return false;
+	}
+
+	(void)memmove(&table->entries[lo + 1U], &table->entries[lo],
+		      (table->count - lo) * sizeof(table->entries[0]));
+	table->entries[lo].id = errata_id;
+	table->entries[lo].status = status;
+	table->count++;
+
+	return true;
+}
+
+/* Fill a lookup table with the status of all the errata of the calling CPU */
+static bool em_table_build(struct em_lookup_table *table,
+			   struct cpu_ops *cpu_ops, long rev_var)
+{
+	struct erratum_entry *entry, *end;
+	int32_t status;
+
+	table->count = 0U;
+
+#if ERRATA_NON_ARM_INTERCONNECT
+	uint32_t midr_val = read_midr();
+
+	for (unsigned int i = 0U; i < ARRAY_SIZE(cpu_list); i++) {
+		struct em_cpu *ptr;
+
+		if (EXTRACT_PARTNUM(midr_val) !=
+		    EXTRACT_PARTNUM(cpu_list[i].cpu_midr)) {
+			continue;
+		}
+
+		for (int j = 0; j < MAX_PLAT_CPU_ERRATA_ENTRIES; j++) {
+			ptr = &cpu_list[i].cpu_errata_list[j];
+			status = RXPX_RANGE(rev_var, ptr->em_rxpx_lo,
+					    ptr->em_rxpx_hi) ?
+				 EM_AFFECTED : EM_NOT_AFFECTED;
+			if (!em_table_add(table, ptr->em_errata_id, status)) {
+				return false;
+			}
+		}
+		break;
+	}
+#endif
+
+	end = cpu_ops->errata_list_end;
+	for (entry = cpu_ops->errata_list_start; entry < end; entry++) {
+		if (entry->check_func(rev_var)) {
+			status = (entry->chosen != 0U) ?
+				 EM_HIGHER_EL_MITIGATION : EM_AFFECTED;
+		} else {
+			status = EM_NOT_AFFECTED;
+		}
+		if (!em_table_add(table, entry->id, status)) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/*
+ * Return the lookup table of the calling CPU, building it on the first query
+ * from a CPU of its type and revision. Return NULL if the table cannot be
+ * used, in which case the lists are scanned instead.
+ */
+static const struct em_lookup_table *em_get_table(long rev_var)
+{
+	unsigned int core_pos = plat_my_core_pos();
+	struct em_lookup_table *table = em_core_table[core_pos];
+	struct cpu_ops *cpu_ops;
+	unsigned int i;
+
+	if (table == NULL) {
+		cpu_ops = get_cpu_ops_ptr();
+		assert(cpu_ops != NULL);
+		assert(cpu_ops->errata_list_start != NULL);
+		assert(cpu_ops->errata_list_end != NULL);
+
+		spin_lock(&em_tables_lock);
+
+		for (i = 0U; i < ERRATA_ABI_MAX_CPU_TYPES; i++) {
+			table = &em_tables[i];
+			if (table->cpu_ops == NULL) {
+				table->cpu_ops = cpu_ops;
+				table->rev_var = rev_var;
+				table->valid = em_table_build(table, cpu_ops,
+							      rev_var);
+				if (!table->valid) {
+					WARN("Errata ABI: more than %u errata, "
+					     "using linear lookups\n",
+					     ERRATA_ABI_MAX_ERRATA);
+				}
+				break;
+			}
+			if ((table->cpu_ops == cpu_ops) &&
+			    (table->rev_var == rev_var)) {
+				break;
+			}
+		}
+
+		spin_unlock(&em_tables_lock);
+
+		if (i == ERRATA_ABI_MAX_CPU_TYPES) {
+			return NULL;
+		}
+
+		em_core_table[core_pos] = table;
+	}
+
+	return table->valid ? table : NULL;
+}
+
+/* Function to check if the errata exists for the specific CPU and rxpx */
+int32_t verify_errata_implemented(uint32_t errata_id, uint32_t forward_flag)
+{
+	const struct em_lookup_table *table;
+	unsigned int lo, hi, mid;
+	long rev_var;
+
+	rev_var = cpu_get_rev_var();
+
+	table = em_get_table(rev_var);
+	if (table == NULL) {
+		return errata_status_linear(errata_id, rev_var);
+	}
+
+	lo = 0U;
+	hi = table->count;
+	while (lo < hi) {
+		mid = (lo + hi) / 2U;
+		if (table->entries[mid].id == errata_id) {
+			return table->entries[mid].status;
+		}
+		if (table->entries[mid].id < errata_id) {
+			lo = mid + 1U;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return EM_UNKNOWN_ERRATUM;
+}
+
 /* Predicate indicating that a function id is part of EM_ABI */
 bool is_errata_fid(uint32_t smc_fid)
 {
@@ -38,6 +38,47 @@ static uint64_t validate_rw_addr_sz(uint32_t addr, uint64_t off, uint64_t sz)
 	return SMC_PCI_CALL_SUCCESS;
 }
 
+/*
+ * Perform the 'count' accesses in 'ops' in order, and store the value read by
+ * each read back into its entry. 'ops' is shared with the Normal world, so
+ * each entry is copied before being validated. Stops at the first access that
+ * fails and returns its error, with the number of accesses done in 'done'.
+ */
+int pci_config_batch(struct pci_batch_op *ops, size_t count, size_t *done)
+{
+	struct pci_batch_op op;
+	uint32_t val;
+	uint32_t ret = SMC_PCI_CALL_SUCCESS;
+	size_t i;
+
+	for (i = 0U; i < count; i++) {
+		op = ops[i];
+
+		if (validate_rw_addr_sz(op.addr, op.off, op.size) !=
+		    SMC_PCI_CALL_SUCCESS) {
+			ret = SMC_PCI_CALL_INVAL_PARAM;
+		} else if (op.write == PCI_BATCH_OP_WRITE) {
+			ret = pci_write_config(op.addr, op.off, op.size,
+					       op.val);
+		} else if (op.write == PCI_BATCH_OP_READ) {
+			ret = pci_read_config(op.addr, op.off, op.size, &val);
+			if (ret == SMC_PCI_CALL_SUCCESS) {
+				ops[i].val = val;
+			}
+		} else {
+			ret = SMC_PCI_CALL_INVAL_PARAM;
+		}
+
+		if (ret != SMC_PCI_CALL_SUCCESS) {
+			break;
+		}
+	}
+
+	*done = i;
+
+	return (int)ret;
+}
+
 uint64_t pci_smc_handler(uint32_t smc_fid,
 			     u_register_t x1,
 			     u_register_t x2,
@@ -1,10 +1,11 @@
 /*
- * Copyright (c) 2022-2024, Arm Limited. All rights reserved.
+ * Copyright (c) 2022-2026, Arm Limited. All rights reserved.
  * Copyright (c) 2024, NVIDIA Corporation. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 #include <errno.h>
+#include <stdbool.h>
 #include <stdint.h>
 #include <string.h>
 
@@ -16,8 +17,64 @@
 #include <services/rmm_el3_token_sign.h>
 #include <smccc_helpers.h>
 
+#include <platform_def.h>
+
 static spinlock_t lock;
 
+#if RMMD_ATTEST_TOKEN_CACHE
+/* Largest platform token kept in the cache */
+#ifndef PLAT_RMMD_ATTEST_TOKEN_CACHE_SIZE
+#define PLAT_RMMD_ATTEST_TOKEN_CACHE_SIZE	U(0x1000)
+#endif
+
+/*
+ * Last platform token returned by the platform, with the challenge it was
+ * generated for. The RMM uses the hash of the Realm attestation key as the
+ * challenge, which does not change once booted, so every Realm asks for the
+ * same token. Only accessed with 'lock' held. 'challenge_size' is 0 while the
+ * cache is empty.
+ */
+static struct {
+	uint8_t challenge[SHA512_DIGEST_SIZE];
+	size_t challenge_size;
+	size_t token_size;
+	uint8_t token[PLAT_RMMD_ATTEST_TOKEN_CACHE_SIZE];
+} token_cache;
+
+/*
+ * Copy the cached token into the buffer if it was generated for 'challenge'
+ * and fits in the buffer.
+ */
+static bool token_cache_get(uint64_t buf_pa, uint64_t *buf_size,
+			    const uint8_t *challenge, size_t c_size)
+{
+	if ((token_cache.challenge_size != c_size) ||
+	    (memcmp(token_cache.challenge, challenge, c_size) != 0) ||
+	    (token_cache.token_size > *buf_size)) {
+		return false;
+	}
+
+	(void)memcpy((void *)buf_pa, token_cache.token, token_cache.token_size);
+	*buf_size = token_cache.token_size;
+
+	return true;
+}
+
+static void token_cache_put(uint64_t buf_pa, uint64_t token_size,
+			    const uint8_t *challenge, size_t c_size)
+{
+	if (token_size > sizeof(token_cache.token)) {
+		token_cache.challenge_size = 0UL;
+		return;
+	}
+
+	(void)memcpy(token_cache.token, (void *)buf_pa, token_size);
+	(void)memcpy(token_cache.challenge, challenge, c_size);
+	token_cache.token_size = token_size;
+	token_cache.challenge_size = c_size;
+}
+#endif /* RMMD_ATTEST_TOKEN_CACHE */
+
 /* For printing Realm attestation token hash */
 #define DIGITS_PER_BYTE				2UL
 #define LENGTH_OF_TERMINATING_ZERO_IN_BYTES	1UL
@@ -112,12 +169,26 @@ int rmmd_attest_get_platform_token(uint64_t buf_pa, uint64_t *buf_size,
 
 	print_challenge((uint8_t *)temp_buf, c_size);
 
+#if RMMD_ATTEST_TOKEN_CACHE
+	if (token_cache_get(buf_pa, buf_size, temp_buf, c_size)) {
+		*remaining_len = 0UL;
+		spin_unlock(&lock);
+		return E_RMM_OK;
+	}
+#endif
+
 	/* Get the platform token. */
 	err = plat_rmmd_get_cca_attest_token((uintptr_t)buf_pa,
 		buf_size, (uintptr_t)temp_buf, c_size, remaining_len);
 
 	switch (err) {
 	case 0:
+#if RMMD_ATTEST_TOKEN_CACHE
+		/* Only whole tokens are cached */
+		if (*remaining_len == 0UL) {
+			token_cache_put(buf_pa, *buf_size, temp_buf, c_size);
+		}
+#endif
 		err = E_RMM_OK;
 		break;
 	case -EAGAIN:
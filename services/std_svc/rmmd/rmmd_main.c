@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2021-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -22,6 +22,7 @@
 #include <lib/extensions/pmuv3.h>
 #include <lib/extensions/sys_reg_trace.h>
 #include <lib/gpt_rme/gpt_rme.h>
+#include <lib/pmf/pmf_trace.h>
 
 #include <lib/spinlock.h>
 #include <lib/utils.h>
@@ -151,7 +152,8 @@ static void manage_extensions_realm_per_world(void)
 	 * Realm manager must ensure that the SVE and FPU register
 	 * contexts are properly managed.
 	 */
-		sve_enable_per_world(&per_world_context[CPU_CONTEXT_REALM]);
+		sve_enable_per_world(&per_world_context[CPU_CONTEXT_REALM],
+				     SVE_VECTOR_LEN);
 	}
 
 	/* NS can access this but Realm shouldn't */
@@ -265,8 +267,10 @@ int rmmd_setup(void)
 	shared_buf_size =
 			plat_rmmd_get_el3_rmm_shared_mem(&shared_buf_base);
 
-	assert((shared_buf_size == SZ_4K) &&
-					((void *)shared_buf_base != NULL));
+	/* The area is made of whole pages, the first one is the shared buffer */
+	assert((shared_buf_size >= SZ_4K) &&
+	       ((shared_buf_size & (SZ_4K - 1UL)) == 0UL) &&
+	       ((void *)shared_buf_base != NULL));
 
 	/* Zero out and load the boot manifest at the beginning of the share area */
 	manifest = (struct rmm_manifest *)shared_buf_base;
@@ -279,6 +283,12 @@ int rmmd_setup(void)
 		rmm_boot_failed = true;
 		return rc;
 	}
+
+	/*
+	 * The tables the manifest points to may be anywhere in the shared area,
+	 * so that platforms with many DRAM banks are not limited to one page.
+	 */
+	manifest->num_pages = (uint32_t)(shared_buf_size / SZ_4K);
 	flush_dcache_range((uintptr_t)shared_buf_base, shared_buf_size);
 
 	/*
@@ -287,7 +297,8 @@ int rmmd_setup(void)
 	 * arg1: Version for this Boot Interface.
 	 * arg2: PLATFORM_CORE_COUNT.
 	 * arg3: Base address for the EL3 <-> RMM shared area. The boot
-	 *       manifest will be stored at the beginning of this area.
+	 *       manifest will be stored at the beginning of this area, and
+	 *       gives the number of pages the area spans.
 	 */
 	rmm_ep_info->args.arg0 = linear_id;
 	rmm_ep_info->args.arg1 = RMM_EL3_INTERFACE_VERSION;
@@ -337,6 +348,8 @@ static uint64_t	rmmd_smc_forward(uint32_t src_sec_state,
 {
 	cpu_context_t *ctx = cm_get_context(dst_sec_state);
 
+	PMF_TRACE_EVENT(PMF_TRACE_WORLD_SWITCH, x0, dst_sec_state);
+
 	/* Save incoming security state */
 	cm_el2_sysregs_context_save(src_sec_state);
 
@@ -558,6 +571,9 @@ static int gpt_to_gts_error(int error, uint32_t smc_fid, uint64_t address)
 
 	if (error == -EINVAL) {
 		ret = E_RMM_BAD_ADDR;
+	} else if (error == -ENOMEM) {
+		/* No memory left for an L1 table or for mapping the granule */
+		ret = E_RMM_NOMEM;
 	} else {
 		/* This is the only other error code we expect */
 		assert(error == -EPERM);
@@ -569,6 +585,53 @@ static int gpt_to_gts_error(int error, uint32_t smc_fid, uint64_t address)
 	return ret;
 }
 
+/* The RMM_GTSI_STATS block sizes are passed as is to the GPT library */
+CASSERT((RMM_GTSI_BLOCK_2MB == GPT_BLOCK_2MB) &&
+	(RMM_GTSI_BLOCK_32MB == GPT_BLOCK_32MB) &&
+	(RMM_GTSI_BLOCK_512MB == GPT_BLOCK_512MB),
+	assert_rmm_gtsi_block_sizes_match);
+
+#if PLAT_XLAT_TABLES_DYNAMIC
+/* Serialises the use of the dynamic mapping of the granules to scrub */
+static spinlock_t rmmd_scrub_lock;
+
+/*
+ * Delegate the granule at 'pa' and zero it through a Realm mapping. The
+ * delegation cleans and invalidates the Non-secure alias of the granule to the
+ * PoPA before changing its PAS, so the Normal world can not alter the granule
+ * once it has been zeroed.
+ */
+static int rmmd_gtsi_scrub_delegate(uint64_t pa)
+{
+	uintptr_t va;
+	int ret;
+
+	ret = gpt_delegate_pas(pa, PAGE_SIZE_4KB, SMC_FROM_REALM);
+	if (ret != 0) {
+		return ret;
+	}
+
+	spin_lock(&rmmd_scrub_lock);
+
+	ret = mmap_add_dynamic_region_alloc_va(pa, &va, PAGE_SIZE_4KB,
+			MT_MEMORY | MT_RW | MT_REALM | MT_EXECUTE_NEVER);
+	if (ret == 0) {
+		zero_normalmem((void *)va, PAGE_SIZE_4KB);
+		(void)mmap_remove_dynamic_region(va, PAGE_SIZE_4KB);
+	}
+
+	spin_unlock(&rmmd_scrub_lock);
+
+	if (ret != 0) {
+		/* Hand the granule back rather than leave it unscrubbed */
+		(void)gpt_undelegate_pas(pa, PAGE_SIZE_4KB, SMC_FROM_REALM);
+		return -ENOMEM;
+	}
+
+	return 0;
+}
+#endif /* PLAT_XLAT_TABLES_DYNAMIC */
+
 static int rmm_el3_ifc_get_feat_register(uint64_t feat_reg_idx,
 					 uint64_t *feat_reg)
 {
@@ -580,6 +643,12 @@ static int rmm_el3_ifc_get_feat_register(uint64_t feat_reg_idx,
 	*feat_reg = 0UL;
 #if RMMD_ENABLE_EL3_TOKEN_SIGN
 	*feat_reg |= RMM_EL3_FEAT_REG_0_EL3_TOKEN_SIGN_MASK;
+#endif
+	*feat_reg |= RMM_EL3_FEAT_REG_0_GTSI_RANGE_MASK;
+	*feat_reg |= RMM_EL3_FEAT_REG_0_GTSI_FUSE_MASK;
+	*feat_reg |= RMM_EL3_FEAT_REG_0_EL2_SCRATCH_MASK;
+#if PLAT_XLAT_TABLES_DYNAMIC
+	*feat_reg |= RMM_EL3_FEAT_REG_0_GTSI_SCRUB_MASK;
 #endif
 	return E_RMM_OK;
 }
@@ -592,6 +661,7 @@ uint64_t rmmd_rmm_el3_handler(uint32_t smc_fid, uint64_t x1, uint64_t x2,
 				void *handle, uint64_t flags)
 {
 	uint64_t remaining_len = 0UL;
+	size_t transitioned;
 	uint32_t src_sec_state;
 	int ret;
 
@@ -616,6 +686,39 @@ uint64_t rmmd_rmm_el3_handler(uint32_t smc_fid, uint64_t x1, uint64_t x2,
 	case RMM_GTSI_UNDELEGATE:
 		ret = gpt_undelegate_pas(x1, PAGE_SIZE_4KB, SMC_FROM_REALM);
 		SMC_RET1(handle, gpt_to_gts_error(ret, smc_fid, x1));
+	case RMM_GTSI_DELEGATE_RANGE:
+		ret = gpt_delegate_pas_range(x1, x2, SMC_FROM_REALM,
+					     &transitioned);
+		SMC_RET2(handle, gpt_to_gts_error(ret, smc_fid,
+						  x1 + transitioned),
+			 transitioned);
+	case RMM_GTSI_UNDELEGATE_RANGE:
+		ret = gpt_undelegate_pas_range(x1, x2, SMC_FROM_REALM,
+					       &transitioned);
+		SMC_RET2(handle, gpt_to_gts_error(ret, smc_fid,
+						  x1 + transitioned),
+			 transitioned);
+#if PLAT_XLAT_TABLES_DYNAMIC
+	case RMM_GTSI_SCRUB_DELEGATE:
+		ret = rmmd_gtsi_scrub_delegate(x1);
+		SMC_RET1(handle, gpt_to_gts_error(ret, smc_fid, x1));
+#endif
+	case RMM_GTSI_FUSE:
+		x1 = MIN(x1, (uint64_t)UINT32_MAX);
+		SMC_RET2(handle, E_RMM_OK, gpt_fuse_deferred((unsigned int)x1));
+	case RMM_GTSI_STATS:
+		if ((x1 > RMM_GTSI_BLOCK_512MB) ||
+		    (gpt_get_fuse_stats((unsigned int)x1, &x2, &x3) != 0)) {
+			SMC_RET1(handle, E_RMM_INVAL);
+		}
+		SMC_RET3(handle, E_RMM_OK, x2, x3);
+	case RMM_EL2_SCRATCH_REGS:
+		if ((x1 & ~RMM_EL2_SCRATCH_MASK) != 0UL) {
+			SMC_RET1(handle, E_RMM_INVAL);
+		}
+		cm_el2_sysregs_set_syndrome_scratch(REALM,
+				(x1 & RMM_EL2_SCRATCH_SYNDROME) != 0UL);
+		SMC_RET1(handle, E_RMM_OK);
 	case RMM_ATTEST_GET_PLAT_TOKEN:
 		ret = rmmd_attest_get_platform_token(x1, &x2, x3, &remaining_len);
 		SMC_RET3(handle, ret, x2, remaining_len);
@@ -4,8 +4,13 @@
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#include <stdint.h>
+
+#include <arch_helpers.h>
 #include <common/build_message.h>
 #include <common/debug.h>
+#include <lib/utils_def.h>
+#include <lib/xlat_tables/xlat_tables_defs.h>
 #include <plat/common/platform.h>
 #include <services/rmm_core_manifest.h>
 #include <services/rmmd_svc.h>
@@ -153,6 +158,82 @@ static void trp_asc_mark_nonsecure(unsigned long long x1,
 	}
 }
 
+#if TRP_BENCHMARK
+/*******************************************************************************
+ * Time 'iterations' RMM to EL3 calls of an operation with the system counter.
+ * The Normal world caller times the whole RMI round trip on its side.
+ ******************************************************************************/
+static void trp_bench(unsigned long long op, unsigned long long iterations,
+		      unsigned long long granule, uint64_t entry,
+		      struct trp_smc_result *smc_ret)
+{
+	uint64_t start, delta, total = 0ULL, min = UINT64_MAX, max = 0ULL;
+	unsigned long long ret = 0ULL;
+
+	if ((op > TRP_BENCH_GTSI_SWEEP) ||
+	    ((op != TRP_BENCH_NULL) && (iterations == 0ULL))) {
+		smc_ret->x[0] = RMI_ERROR_INPUT;
+		return;
+	}
+
+	if (op == TRP_BENCH_NULL) {
+		iterations = 0ULL;
+		min = 0ULL;
+	}
+
+	for (unsigned long long i = 0ULL; i < iterations; i++) {
+		isb();
+		start = read_cntpct_el0();
+
+		switch (op) {
+		case TRP_BENCH_EL3_FEATURES:
+			ret = trp_smc(set_smc_args(RMM_EL3_FEATURES,
+					RMM_EL3_FEAT_REG_0_IDX,
+					0UL, 0UL, 0UL, 0UL, 0UL, 0UL));
+			break;
+		case TRP_BENCH_GTSI:
+		case TRP_BENCH_GTSI_SWEEP:
+			ret = trp_smc(set_smc_args(RMM_GTSI_DELEGATE, granule,
+					0UL, 0UL, 0UL, 0UL, 0UL, 0UL));
+			if (ret == 0ULL) {
+				ret = trp_smc(set_smc_args(RMM_GTSI_UNDELEGATE,
+					granule, 0UL, 0UL, 0UL, 0UL, 0UL,
+					0UL));
+			}
+			if (op == TRP_BENCH_GTSI_SWEEP) {
+				granule += PAGE_SIZE;
+			}
+			break;
+		default:
+			ret = trp_smc(set_smc_args(RMM_ATTEST_GET_REALM_KEY,
+					trp_shared_region_start, PAGE_SIZE,
+					ATTEST_KEY_CURVE_ECC_SECP384R1,
+					0UL, 0UL, 0UL, 0UL));
+			break;
+		}
+
+		isb();
+		delta = read_cntpct_el0() - start;
+
+		if (ret != 0ULL) {
+			ERROR("TRP: benchmark operation %llu failed 0x%llx\n",
+			      op, ret);
+			break;
+		}
+
+		total += delta;
+		min = MIN(min, delta);
+		max = MAX(max, delta);
+	}
+
+	smc_ret->x[0] = ret;
+	smc_ret->x[1] = total;
+	smc_ret->x[2] = min;
+	smc_ret->x[3] = max;
+	smc_ret->x[4] = entry;
+}
+#endif /* TRP_BENCHMARK */
+
 /*******************************************************************************
  * Main RMI SMC handler function
  ******************************************************************************/
@@ -162,6 +243,11 @@ void trp_rmi_handler(unsigned long fid,
 		     unsigned long long x5, unsigned long long x6,
 		     struct trp_smc_result *smc_ret)
 {
+#if TRP_BENCHMARK
+	/* Sample the counter first to leave out as little of the entry */
+	uint64_t entry = read_cntpct_el0();
+#endif
+
 	/* Not used in the current implementation */
 	(void)x2;
 	(void)x3;
@@ -179,6 +265,11 @@ void trp_rmi_handler(unsigned long fid,
 	case RMI_RMM_GRANULE_UNDELEGATE:
 		trp_asc_mark_nonsecure(x1, smc_ret);
 		break;
+#if TRP_BENCHMARK
+	case RMI_TRP_BENCH:
+		trp_bench(x1, x2, x3, entry, smc_ret);
+		break;
+#endif
 	default:
 		ERROR("Invalid SMC code to %s, FID %lx\n", __func__, fid);
 		smc_ret->x[0] = SMC_UNK;
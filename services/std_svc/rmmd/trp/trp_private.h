@@ -29,6 +29,37 @@
 #define RMI_RMM_GRANULE_DELEGATE	SMC64_RMI_FID(U(1))
 #define RMI_RMM_GRANULE_UNDELEGATE	SMC64_RMI_FID(U(2))
 
+/*
+ * TRP specific benchmark call, with TRP_BENCHMARK=1.
+ * The arguments to this SMC are :
+ *    arg1 - Operation, one of TRP_BENCH_*.
+ *    arg2 - Number of iterations of the operation.
+ *    arg3 - NS granule to delegate and undelegate, for TRP_BENCH_GTSI, or
+ *           first of the NS granules, for TRP_BENCH_GTSI_SWEEP.
+ * The return arguments are :
+ *    ret0 - RMI_SUCCESS or RMI_ERROR_INPUT, or the error of the RMM-EL3 call.
+ *    ret1 - Total time of the iterations, in system counter ticks.
+ *    ret2 - Shortest iteration.
+ *    ret3 - Longest iteration.
+ *    ret4 - System counter when the TRP got the call, for the caller to
+ *           split its round trip into the entry and exit world switches.
+ */
+#define RMI_TRP_BENCH			SMC64_RMI_FID(U(0x3E))
+
+/* Only the round trip from the Normal world, no iteration */
+#define TRP_BENCH_NULL			U(0)
+/* RMM_EL3_FEATURES, the shortest RMM to EL3 call */
+#define TRP_BENCH_EL3_FEATURES		U(1)
+/* RMM_GTSI_DELEGATE then RMM_GTSI_UNDELEGATE of a granule */
+#define TRP_BENCH_GTSI			U(2)
+/* RMM_ATTEST_GET_REALM_KEY into the shared buffer */
+#define TRP_BENCH_ATTEST_KEY		U(3)
+/*
+ * RMM_GTSI_DELEGATE then RMM_GTSI_UNDELEGATE of each of 'iterations'
+ * consecutive granules, for the GPT throughput of several CPUs at once
+ */
+#define TRP_BENCH_GTSI_SWEEP		U(4)
+
 /* Definitions for RMI VERSION */
 #define RMI_ABI_VERSION_MAJOR		U(0x0)
 #define RMI_ABI_VERSION_MINOR		U(0x0)
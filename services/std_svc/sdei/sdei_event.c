@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2022, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -12,6 +12,17 @@
 
 #define MAP_OFF(_map, _mapping) ((_map) - (_mapping)->map)
 
+/* Number of entries of the interrupt lookup caches, must be a power of two */
+#define SDEI_INTR_CACHE_SIZE	64U
+
+/*
+ * Index plus one of the mapping last found for an interrupt, per mapping type
+ * and hashed by interrupt number. 0 means no mapping is cached. Entries are
+ * only hints: the mapping they point to is checked to still be bound to the
+ * interrupt before it is used, so they can be updated without locks.
+ */
+static unsigned int sdei_intr_cache[SDEI_MAP_IDX_MAX_][SDEI_INTR_CACHE_SIZE];
+
 /*
  * Get SDEI entry with the given mapping: on success, returns pointer to SDEI
  * entry. On error, returns NULL.
@@ -59,17 +70,68 @@ sdei_ev_map_t *find_event_map_by_intr(unsigned int intr_num, bool shared)
 {
 	const sdei_mapping_t *mapping;
 	sdei_ev_map_t *map;
-	unsigned int i;
+	unsigned int *cache;
+	unsigned int i, hit;
+
+	mapping = shared ? SDEI_SHARED_MAPPING() : SDEI_PRIVATE_MAPPING();
 
 	/*
-	 * Look for a match in private and shared mappings, as requested. This
-	 * is a linear search. However, if the mappings are required to be
-	 * sorted, for large maps, we could consider binary search.
+	 * Free dynamic mappings all share SDEI_DYN_IRQ, callers looking for
+	 * one expect the first of them so they are never cached.
+	 */
+	if (intr_num == SDEI_DYN_IRQ) {
+		cache = NULL;
+	} else {
+		cache = &sdei_intr_cache[shared ? SDEI_MAP_IDX_SHRD_ :
+					 SDEI_MAP_IDX_PRIV_]
+					[intr_num & (SDEI_INTR_CACHE_SIZE - 1U)];
+
+		hit = *cache;
+		if ((hit != 0U) && (hit <= mapping->num_maps) &&
+		    (mapping->map[hit - 1U].intr == intr_num)) {
+			return &mapping->map[hit - 1U];
+		}
+	}
+
+	/*
+	 * Bound interrupts change at runtime so the mappings can not be kept
+	 * sorted by interrupt, fall back to a linear search.
 	 */
-	mapping = shared ? SDEI_SHARED_MAPPING() : SDEI_PRIVATE_MAPPING();
 	iterate_mapping(mapping, i, map) {
-		if (map->intr == intr_num)
+		if (map->intr == intr_num) {
+			if (cache != NULL) {
+				*cache = i + 1U;
+			}
+			return map;
+		}
+	}
+
+	return NULL;
+}
+
+/*
+ * Binary search of the mapping for an event number, the platform mappings are
+ * sorted by increasing event number.
+ */
+static sdei_ev_map_t *find_event_map_in(const sdei_mapping_t *mapping,
+					int ev_num)
+{
+	size_t lo = 0U, hi = mapping->num_maps, mid;
+	sdei_ev_map_t *map;
+
+	while (lo < hi) {
+		mid = lo + ((hi - lo) / 2U);
+		map = &mapping->map[mid];
+
+		if (map->ev_num == ev_num) {
 			return map;
+		}
+
+		if (map->ev_num < ev_num) {
+			lo = mid + 1U;
+		} else {
+			hi = mid;
+		}
 	}
 
 	return NULL;
@@ -83,18 +145,12 @@ sdei_ev_map_t *find_event_map(int ev_num)
 {
 	const sdei_mapping_t *mapping;
 	sdei_ev_map_t *map;
-	unsigned int i, j;
+	unsigned int i;
 
-	/*
-	 * Iterate through mappings to find a match. This is a linear search.
-	 * However, if the mappings are required to be sorted, for large maps,
-	 * we could consider binary search.
-	 */
 	for_each_mapping_type(i, mapping) {
-		iterate_mapping(mapping, j, map) {
-			if (map->ev_num == ev_num)
-				return map;
-		}
+		map = find_event_map_in(mapping, ev_num);
+		if (map != NULL)
+			return map;
 	}
 
 	return NULL;
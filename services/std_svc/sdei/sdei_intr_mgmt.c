@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2017-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2017-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -18,6 +18,8 @@
 #include <common/debug.h>
 #include <common/runtime_svc.h>
 #include <lib/cassert.h>
+#include <lib/pmf/pmf.h>
+#include <lib/runtime_instr.h>
 #include <services/sdei.h>
 
 #include "sdei_private.h"
@@ -363,9 +365,16 @@ int sdei_intr_handler(uint32_t intr_raw, uint32_t flags, void *handle,
 	unsigned int sec_state;
 	sdei_cpu_state_t *state;
 	uint32_t intr;
+	bool shared;
 	jmp_buf dispatch_jmp;
 	const uint64_t mpidr = read_mpidr_el1();
 
+#if ENABLE_RUNTIME_INSTRUMENTATION
+	PMF_CAPTURE_TIMESTAMP(rt_instr_svc,
+	    RT_INSTR_ENTER_SDEI_DISPATCH,
+	    PMF_NO_CACHE_MAINT);
+#endif
+
 	/*
 	 * To handle an event, the following conditions must be true:
 	 *
@@ -390,7 +399,8 @@ int sdei_intr_handler(uint32_t intr_raw, uint32_t flags, void *handle,
 	 * this interrupt
 	 */
 	intr = plat_ic_get_interrupt_id(intr_raw);
-	map = find_event_map_by_intr(intr, (plat_ic_is_spi(intr) != 0));
+	shared = (plat_ic_is_spi(intr) != 0);
+	map = find_event_map_by_intr(intr, shared);
 	if (map == NULL) {
 		ERROR("No SDEI map for interrupt %u\n", intr);
 		panic();
@@ -402,6 +412,13 @@ int sdei_intr_handler(uint32_t intr_raw, uint32_t flags, void *handle,
 	 */
 	assert((map->ev_num == SDEI_EVENT_0) || is_map_bound(map));
 
+	/*
+	 * Only shared events can be acted on by other PEs while this one
+	 * handles them. Private events, such as the critical events of
+	 * watchdogs and RAS, are handled without taking the event lock.
+	 */
+	assert(shared == is_event_shared(map));
+
 	se = get_event_entry(map);
 	state = sdei_get_this_pe_state();
 
@@ -412,12 +429,12 @@ int sdei_intr_handler(uint32_t intr_raw, uint32_t flags, void *handle,
 		 */
 		SDEI_LOG("interrupt %u on %" PRIx64 " while PE masked\n",
 			 map->intr, mpidr);
-		if (is_event_shared(map))
+		if (shared)
 			sdei_map_lock(map);
 
 		handle_masked_trigger(map, se, state, intr_raw);
 
-		if (is_event_shared(map))
+		if (shared)
 			sdei_map_unlock(map);
 
 		return 0;
@@ -427,11 +444,11 @@ int sdei_intr_handler(uint32_t intr_raw, uint32_t flags, void *handle,
 	if (map->ev_num == SDEI_EVENT_0)
 		dmbld();
 
-	if (is_event_shared(map))
+	if (shared)
 		sdei_map_lock(map);
 
 	/* Assert shared event routed to this PE had been configured so */
-	if (is_event_shared(map) && (se->reg_flags == SDEI_REGF_RM_PE)) {
+	if (shared && (se->reg_flags == SDEI_REGF_RM_PE)) {
 		assert(se->affinity == (mpidr & MPIDR_AFFINITY_MASK));
 	}
 
@@ -453,7 +470,7 @@ int sdei_intr_handler(uint32_t intr_raw, uint32_t flags, void *handle,
 		 */
 		plat_ic_end_of_interrupt(intr_raw);
 
-		if (is_event_shared(map))
+		if (shared)
 			sdei_map_unlock(map);
 
 		return 0;
@@ -479,7 +496,7 @@ int sdei_intr_handler(uint32_t intr_raw, uint32_t flags, void *handle,
 
 	sec_state = get_interrupt_src_ss(flags);
 
-	if (is_event_shared(map))
+	if (shared)
 		sdei_map_unlock(map);
 
 	SDEI_LOG("ACK %" PRIx64 ", ev:0x%x ss:%d spsr:%lx ELR:%lx\n",
@@ -498,6 +515,13 @@ int sdei_intr_handler(uint32_t intr_raw, uint32_t flags, void *handle,
 
 	/* Synchronously dispatch event */
 	setup_ns_dispatch(map, se, ctx, &dispatch_jmp);
+
+#if ENABLE_RUNTIME_INSTRUMENTATION
+	PMF_CAPTURE_TIMESTAMP(rt_instr_svc,
+	    RT_INSTR_EXIT_SDEI_DISPATCH,
+	    PMF_NO_CACHE_MAINT);
+#endif
+
 	begin_sdei_synchronous_dispatch(&dispatch_jmp);
 
 	/*
@@ -563,7 +563,7 @@ static int64_t sdei_event_get_info(int ev_num, int info)
 	se = get_event_entry(map);
 
 	if (is_event_shared(map))
-		sdei_map_lock(map);
+		sdei_map_read_lock(map);
 
 	/* Sample state under lock */
 	registered = GET_EV_STATE(se, REGISTERED);
@@ -571,7 +571,7 @@ static int64_t sdei_event_get_info(int ev_num, int info)
 	affinity = se->affinity;
 
 	if (is_event_shared(map))
-		sdei_map_unlock(map);
+		sdei_map_read_unlock(map);
 
 	switch (info) {
 	case SDEI_INFO_EV_TYPE:
@@ -691,13 +691,13 @@ static int sdei_event_status(int ev_num)
 	se = get_event_entry(map);
 
 	if (is_event_shared(map))
-		sdei_map_lock(map);
+		sdei_map_read_lock(map);
 
 	/* State value directly maps to the expected return format */
 	state = se->state;
 
 	if (is_event_shared(map))
-		sdei_map_unlock(map);
+		sdei_map_read_unlock(map);
 
 	return (int) state;
 }
@@ -216,12 +216,23 @@ typedef enum {
 
 static inline void sdei_map_lock(sdei_ev_map_t *map)
 {
-	spin_lock(&map->lock);
+	write_lock(&map->lock);
 }
 
 static inline void sdei_map_unlock(sdei_ev_map_t *map)
 {
-	spin_unlock(&map->lock);
+	write_unlock(&map->lock);
+}
+
+/* For the calls only sampling the state of an event */
+static inline void sdei_map_read_lock(sdei_ev_map_t *map)
+{
+	read_lock(&map->lock);
+}
+
+static inline void sdei_map_read_unlock(sdei_ev_map_t *map)
+{
+	read_unlock(&map->lock);
 }
 
 extern const sdei_mapping_t sdei_global_mappings[];
@@ -7,6 +7,7 @@
 #ifndef SPMC_H
 #define SPMC_H
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #include <common/bl_common.h>
@@ -15,6 +16,8 @@
 #include <services/el3_spmc_logical_sp.h>
 #include "spm_common.h"
 
+#include <platform_def.h>
+
 /*
  * Ranges of FF-A IDs for Normal world and Secure world components. The
  * convention matches that used by other SPMCs i.e. Hafnium and OP-TEE.
@@ -112,6 +115,47 @@ struct mailbox {
 	spinlock_t lock;
 };
 
+/*
+ * Interrupt IDs of the notifications. The SPMC enters an SP with FFA_INTERRUPT
+ * and the Notification Pending Interrupt (NPI) ID when it is run with pending
+ * notifications. It raises the Schedule Receiver Interrupt (SRI), a non-secure
+ * SGI, for the normal world scheduler to run the receivers.
+ */
+#ifndef SPMC_NPI_ID
+#define SPMC_NPI_ID		U(5)
+#endif
+#ifndef SPMC_SRI_ID
+#define SPMC_SRI_ID		U(8)
+#endif
+
+/* Worlds of the senders, each with its own bitmaps of pending notifications */
+#define SPMC_NOTIF_FROM_SP	U(0)
+#define SPMC_NOTIF_FROM_VM	U(1)
+#define SPMC_NOTIF_WORLDS	U(2)
+
+/*
+ * Notifications state of a receiver, SP or VM. The bindings are only changed
+ * under the lock, by the receiver. The pending notifications are set by the
+ * senders and retrieved by the receiver with atomic operations instead, so
+ * that signalling one takes no lock.
+ */
+struct spmc_notif_state {
+	spinlock_t lock;
+
+	/* Notifications bound to a sender, and those bound as per-vCPU. */
+	uint64_t bound;
+	uint64_t per_vcpu;
+	uint16_t sender[64];
+
+	uint64_t pending[SPMC_NOTIF_WORLDS];
+	uint64_t vcpu_pending[SPMC_NOTIF_WORLDS][PLATFORM_CORE_COUNT];
+	uint64_t framework_pending;
+	unsigned int vcpu_count;
+
+	/* Whether FFA_NOTIFICATION_INFO_GET reported the pending ones. */
+	bool info_reported;
+};
+
 /*
  * Execution context members for an SP. This is a bit like struct
  * vcpu in a hypervisor.
@@ -136,16 +180,26 @@ struct sp_exec_ctx {
 	uint16_t dir_req_origin_id;
 };
 
+/*
+ * Number of execution contexts in the pool the SPs take theirs from. The
+ * default covers SECURE_PARTITION_COUNT S-EL1 SPs, platforms which know the
+ * partitions they run can lower it.
+ */
+#ifndef SPMC_SP_EC_COUNT
+#define SPMC_SP_EC_COUNT	(SECURE_PARTITION_COUNT * PLATFORM_CORE_COUNT)
+#endif
+
 /*
  * Structure to describe the cumulative properties of an SP.
  */
 struct secure_partition_desc {
 	/*
-	 * Execution contexts allocated to this endpoint. Ideally,
-	 * we need as many contexts as there are physical cpus only
-	 * for a S-EL1 SP which is MP-pinned.
+	 * Execution contexts allocated to this endpoint from the pool, as
+	 * many as there are physical cpus for a S-EL1 SP which is MP-pinned
+	 * and a single one for a S-EL0 SP.
 	 */
-	struct sp_exec_ctx ec[PLATFORM_CORE_COUNT];
+	struct sp_exec_ctx *ec;
+	unsigned int ec_count;
 
 	/* ID of the Secure Partition. */
 	uint16_t sp_id;
@@ -187,6 +241,9 @@ struct secure_partition_desc {
 	 * management transactions if it is using FF-A v1.0.
 	 */
 	bool ns_bit_requested;
+
+	/* Notifications received by the SP. */
+	struct spmc_notif_state notif;
 };
 
 /*
@@ -281,11 +338,63 @@ struct mailbox *spmc_get_mbox_desc(bool secure_origin);
  */
 struct secure_partition_desc *spmc_get_sp_ctx(uint16_t id);
 
+/*
+ * Helper function to obtain the context of the SP at a given index of the
+ * descriptors, which may be unused.
+ */
+struct secure_partition_desc *spmc_get_sp_ctx_by_idx(unsigned int idx);
+
+/*
+ * Helper function to obtain the descriptor of the Hypervisor or OS kernel.
+ */
+struct ns_endpoint_desc *spmc_get_hyp_ctx(void);
+
 /*
  * Add helper function to obtain the FF-A version of the calling
  * partition.
  */
 uint32_t get_partition_ffa_version(bool secure_origin);
 
+/*
+ * Notifications and indirect messaging ABIs.
+ */
+void spmc_notif_sp_init(struct secure_partition_desc *sp);
+bool spmc_notif_sp_pending(struct secure_partition_desc *sp,
+			   unsigned int vcpu);
+void spmc_notif_sri_flush(void);
+uint64_t spmc_notif_bitmap_create_handler(uint32_t smc_fid, bool secure_origin,
+					  uint64_t x1, uint64_t x2, uint64_t x3,
+					  uint64_t x4, void *cookie,
+					  void *handle, uint64_t flags);
+uint64_t spmc_notif_bitmap_destroy_handler(uint32_t smc_fid,
+					   bool secure_origin, uint64_t x1,
+					   uint64_t x2, uint64_t x3,
+					   uint64_t x4, void *cookie,
+					   void *handle, uint64_t flags);
+uint64_t spmc_notif_bind_handler(uint32_t smc_fid, bool secure_origin,
+				 uint64_t x1, uint64_t x2, uint64_t x3,
+				 uint64_t x4, void *cookie, void *handle,
+				 uint64_t flags);
+uint64_t spmc_notif_set_handler(uint32_t smc_fid, bool secure_origin,
+				uint64_t x1, uint64_t x2, uint64_t x3,
+				uint64_t x4, void *cookie, void *handle,
+				uint64_t flags);
+uint64_t spmc_notif_get_handler(uint32_t smc_fid, bool secure_origin,
+				uint64_t x1, uint64_t x2, uint64_t x3,
+				uint64_t x4, void *cookie, void *handle,
+				uint64_t flags);
+uint64_t spmc_notif_info_get_handler(uint32_t smc_fid, bool secure_origin,
+				     uint64_t x1, uint64_t x2, uint64_t x3,
+				     uint64_t x4, void *cookie, void *handle,
+				     uint64_t flags);
+uint64_t spmc_msg_send2_handler(uint32_t smc_fid, bool secure_origin,
+				uint64_t x1, uint64_t x2, uint64_t x3,
+				uint64_t x4, void *cookie, void *handle,
+				uint64_t flags);
+
+/* Atomic helpers of the pending notifications, in spmc_helpers.S */
+uint64_t spmc_notif_bitmap_or(uint64_t *bitmap, uint64_t bits);
+uint64_t spmc_notif_bitmap_take(uint64_t *bitmap, uint64_t mask);
+
 
 #endif /* SPMC_H */
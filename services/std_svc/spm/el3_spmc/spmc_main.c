@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2022-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -51,6 +51,13 @@
  */
 static struct secure_partition_desc sp_desc[SECURE_PARTITION_COUNT];
 
+/*
+ * Pool of the execution contexts of the SPs, handed out according to the
+ * number each SP needs when its manifest is parsed.
+ */
+static struct sp_exec_ctx sp_ec_pool[SPMC_SP_EC_COUNT];
+static unsigned int sp_ec_pool_used;
+
 /*
  * Allocate an NS endpoint descriptor to describe each VM and the Hypervisor in
  * the system that interacts with a SP. It is used to track the Hypervisor
@@ -89,7 +96,27 @@ struct secure_partition_desc *spmc_get_current_sp_ctx(void)
  */
 struct sp_exec_ctx *spmc_get_sp_ec(struct secure_partition_desc *sp)
 {
-	return &(sp->ec[get_ec_index(sp)]);
+	unsigned int idx = get_ec_index(sp);
+
+	assert(idx < sp->ec_count);
+	return &(sp->ec[idx]);
+}
+
+/* Helper function to allocate the execution contexts of an SP. */
+static int spmc_sp_ec_alloc(struct secure_partition_desc *sp,
+			    unsigned int ec_count)
+{
+	if (ec_count > (SPMC_SP_EC_COUNT - sp_ec_pool_used)) {
+		ERROR("No room for %u SP execution contexts, %u of %u used.\n",
+		      ec_count, sp_ec_pool_used, SPMC_SP_EC_COUNT);
+		return -ENOMEM;
+	}
+
+	sp->ec = &sp_ec_pool[sp_ec_pool_used];
+	sp->ec_count = ec_count;
+	sp_ec_pool_used += ec_count;
+
+	return 0;
 }
 
 /* Helper function to get pointer to SP context from its ID. */
@@ -104,6 +131,13 @@ struct secure_partition_desc *spmc_get_sp_ctx(uint16_t id)
 	return NULL;
 }
 
+/* Helper function to get pointer to SP context from its index. */
+struct secure_partition_desc *spmc_get_sp_ctx_by_idx(unsigned int idx)
+{
+	assert(idx < SECURE_PARTITION_COUNT);
+	return &(sp_desc[idx]);
+}
+
 /*
  * Helper function to obtain the descriptor of the Hypervisor or OS kernel.
  * We assume that the first descriptor is reserved for this entity.
@@ -221,6 +255,10 @@ static uint64_t spmc_smc_return(uint32_t smc_fid,
 {
 	/* If the destination is in the normal world always go via the SPMD. */
 	if (ffa_is_normal_world_id(dst_id)) {
+		/* Raise the SRI an SP delayed until now. */
+		if (secure_origin) {
+			spmc_notif_sri_flush();
+		}
 		return spmd_smc_handler(smc_fid, x1, x2, x3, x4,
 					cookie, handle, flags);
 	}
@@ -363,6 +401,16 @@ static uint64_t direct_req_smc_handler(uint32_t smc_fid,
 					FFA_ERROR_INVALID_PARAMETER);
 	}
 
+	/*
+	 * Requests from the normal world are mostly targeted at the SP, look it
+	 * up first. Partition IDs are unique across SPs and Logical Partitions
+	 * so there is no need to walk the Logical Partitions when it matches.
+	 */
+	sp = secure_origin ? NULL : spmc_get_sp_ctx(dst_id);
+	if (sp != NULL) {
+		goto sp_req;
+	}
+
 	el3_lp_descs = get_el3_lp_array();
 
 	/* Check if the request is destined for a Logical Partition. */
@@ -393,15 +441,11 @@ static uint64_t direct_req_smc_handler(uint32_t smc_fid,
 					     FFA_ERROR_INVALID_PARAMETER);
 	}
 
-	/* Check if the SP ID is valid. */
-	sp = spmc_get_sp_ctx(dst_id);
-	if (sp == NULL) {
-		VERBOSE("Direct request to unknown partition ID (0x%x).\n",
-			dst_id);
-		return spmc_ffa_error_return(handle,
-					     FFA_ERROR_INVALID_PARAMETER);
-	}
+	/* The destination is neither an SP nor a Logical Partition. */
+	VERBOSE("Direct request to unknown partition ID (0x%x).\n", dst_id);
+	return spmc_ffa_error_return(handle, FFA_ERROR_INVALID_PARAMETER);
 
+sp_req:
 	/* Protect the runtime state of a UP S-EL0 SP with a lock. */
 	if (sp->runtime_el == S_EL0) {
 		spin_lock(&sp->rt_state_lock);
@@ -480,9 +524,13 @@ static uint64_t direct_resp_smc_handler(uint32_t smc_fid,
 					     FFA_ERROR_INVALID_PARAMETER);
 	}
 
-	/* Obtain the SP descriptor and update its runtime state. */
-	sp = spmc_get_sp_ctx(ffa_endpoint_source(x1));
-	if (sp == NULL) {
+	/*
+	 * Obtain the SP descriptor and update its runtime state. A response
+	 * from the secure world can only come from the SP that was run last
+	 * on this cpu.
+	 */
+	sp = spmc_get_current_sp_ctx();
+	if (sp->sp_id != ffa_endpoint_source(x1)) {
 		VERBOSE("Direct response to unknown partition ID (0x%x).\n",
 			dst_id);
 		return spmc_ffa_error_return(handle,
@@ -622,6 +670,8 @@ static uint64_t msg_wait_handler(uint32_t smc_fid,
 			spin_unlock(&sp->rt_state_lock);
 		}
 
+		spmc_notif_sri_flush();
+
 		SMC_RET0(cm_get_context(secure_state_out));
 	}
 
@@ -912,135 +962,132 @@ partition_info_get_populate_properties(uint32_t sp_properties,
 }
 
 /*
- * Collate the partition information in a v1.1 partition information
- * descriptor format, this will be converter later if required.
+ * FFA_PARTITION_INFO_GET responses, built once all the partitions are set up
+ * so that a call is served by a single copy. A Nil UUID gets the whole tables,
+ * in discovery order. A given UUID gets a run of the tables grouped by UUID,
+ * where the v1.1 descriptors carry no UUID, found through the UUID index.
  */
-static int partition_info_get_handler_v1_1(uint32_t *uuid,
-					   struct ffa_partition_info_v1_1
-						  *partitions,
-					   uint32_t max_partitions,
-					   uint32_t *partition_count)
-{
-	uint32_t index;
-	struct ffa_partition_info_v1_1 *desc;
-	bool null_uuid = is_null_uuid(uuid);
-	struct el3_lp_desc *el3_lp_descs = get_el3_lp_array();
+static struct ffa_partition_info_v1_1 part_info_v1_1[MAX_SP_LP_PARTITIONS];
+static struct ffa_partition_info_v1_0 part_info_v1_0[MAX_SP_LP_PARTITIONS];
+static struct ffa_partition_info_v1_1 part_info_by_uuid_v1_1[MAX_SP_LP_PARTITIONS];
+static struct ffa_partition_info_v1_0 part_info_by_uuid_v1_0[MAX_SP_LP_PARTITIONS];
+static uint32_t part_info_count;
 
-	/* Deal with Logical Partitions. */
-	for (index = 0U; index < EL3_LP_DESCS_COUNT; index++) {
-		if (null_uuid || uuid_match(uuid, el3_lp_descs[index].uuid)) {
-			/* Found a matching UUID, populate appropriately. */
-			if (*partition_count >= max_partitions) {
-				return FFA_ERROR_NO_MEMORY;
-			}
+static struct {
+	uint32_t uuid[4];
+	uint32_t start;
+	uint32_t count;
+} part_info_uuid_index[MAX_SP_LP_PARTITIONS];
+static uint32_t part_info_uuid_count;
+
+static void partition_info_add(uint16_t ep_id, uint32_t sp_properties,
+			       enum sp_execution_state sp_ec_state,
+			       uint32_t *uuid)
+{
+	struct ffa_partition_info_v1_1 *desc = &part_info_v1_1[part_info_count];
 
-			desc = &partitions[*partition_count];
-			desc->ep_id = el3_lp_descs[index].sp_id;
-			desc->execution_ctx_count = PLATFORM_CORE_COUNT;
-			/* LSPs must be AArch64. */
-			desc->properties =
-				partition_info_get_populate_properties(
-					el3_lp_descs[index].properties,
-					SP_STATE_AARCH64);
-
-			if (null_uuid) {
-				copy_uuid(desc->uuid, el3_lp_descs[index].uuid);
-			}
-			(*partition_count)++;
-		}
-	}
+	desc->ep_id = ep_id;
+	/* Execution context count must match No. cores for S-EL1 SPs. */
+	desc->execution_ctx_count = PLATFORM_CORE_COUNT;
+	desc->properties = partition_info_get_populate_properties(sp_properties,
+								  sp_ec_state);
+	copy_uuid(desc->uuid, uuid);
 
-	/* Deal with physical SP's. */
-	for (index = 0U; index < SECURE_PARTITION_COUNT; index++) {
-		if (null_uuid || uuid_match(uuid, sp_desc[index].uuid)) {
-			/* Found a matching UUID, populate appropriately. */
-			if (*partition_count >= max_partitions) {
-				return FFA_ERROR_NO_MEMORY;
-			}
+	part_info_count++;
+}
 
-			desc = &partitions[*partition_count];
-			desc->ep_id = sp_desc[index].sp_id;
-			/*
-			 * Execution context count must match No. cores for
-			 * S-EL1 SPs.
-			 */
-			desc->execution_ctx_count = PLATFORM_CORE_COUNT;
-			desc->properties =
-				partition_info_get_populate_properties(
-					sp_desc[index].properties,
-					sp_desc[index].execution_state);
-
-			if (null_uuid) {
-				copy_uuid(desc->uuid, sp_desc[index].uuid);
-			}
-			(*partition_count)++;
-		}
-	}
-	return 0;
+/* Only report v1.0 properties to a v1.0 caller. */
+static void partition_info_to_v1_0(struct ffa_partition_info_v1_0 *v1_0,
+				   const struct ffa_partition_info_v1_1 *v1_1)
+{
+	v1_0->ep_id = v1_1->ep_id;
+	v1_0->execution_ctx_count = v1_1->execution_ctx_count;
+	v1_0->properties = v1_1->properties &
+			   FFA_PARTITION_INFO_GET_PROPERTIES_V1_0_MASK;
 }
 
-/*
- * Handle the case where that caller only wants the count of partitions
- * matching a given UUID and does not want the corresponding descriptors
- * populated.
- */
-static uint32_t partition_info_get_handler_count_only(uint32_t *uuid)
+static void partition_info_init(void)
 {
-	uint32_t index = 0;
-	uint32_t partition_count = 0;
-	bool null_uuid = is_null_uuid(uuid);
 	struct el3_lp_desc *el3_lp_descs = get_el3_lp_array();
+	uint32_t index, group, next = 0U;
 
-	/* Deal with Logical Partitions. */
+	/* Logical Partitions first, they must be AArch64. */
 	for (index = 0U; index < EL3_LP_DESCS_COUNT; index++) {
-		if (null_uuid ||
-		    uuid_match(uuid, el3_lp_descs[index].uuid)) {
-			(partition_count)++;
-		}
+		partition_info_add(el3_lp_descs[index].sp_id,
+				   el3_lp_descs[index].properties,
+				   SP_STATE_AARCH64, el3_lp_descs[index].uuid);
 	}
 
-	/* Deal with physical SP's. */
 	for (index = 0U; index < SECURE_PARTITION_COUNT; index++) {
-		if (null_uuid || uuid_match(uuid, sp_desc[index].uuid)) {
-			(partition_count)++;
+		partition_info_add(sp_desc[index].sp_id,
+				   sp_desc[index].properties,
+				   sp_desc[index].execution_state,
+				   sp_desc[index].uuid);
+	}
+
+	for (index = 0U; index < part_info_count; index++) {
+		partition_info_to_v1_0(&part_info_v1_0[index],
+				       &part_info_v1_1[index]);
+	}
+
+	/* Group the descriptors by UUID, in discovery order within a group. */
+	for (index = 0U; index < part_info_count; index++) {
+		uint32_t *uuid = part_info_v1_1[index].uuid;
+		uint32_t i;
+
+		for (group = 0U; group < part_info_uuid_count; group++) {
+			if (uuid_match(part_info_uuid_index[group].uuid, uuid)) {
+				break;
+			}
+		}
+
+		if (group < part_info_uuid_count) {
+			continue;
+		}
+
+		part_info_uuid_count++;
+		copy_uuid(part_info_uuid_index[group].uuid, uuid);
+		part_info_uuid_index[group].start = next;
+
+		for (i = index; i < part_info_count; i++) {
+			if (!uuid_match(part_info_v1_1[i].uuid, uuid)) {
+				continue;
+			}
+
+			part_info_by_uuid_v1_1[next] = part_info_v1_1[i];
+			zeromem(part_info_by_uuid_v1_1[next].uuid,
+				sizeof(part_info_by_uuid_v1_1[next].uuid));
+			part_info_by_uuid_v1_0[next] = part_info_v1_0[i];
+			next++;
 		}
+
+		part_info_uuid_index[group].count =
+			next - part_info_uuid_index[group].start;
 	}
-	return partition_count;
 }
 
 /*
- * If the caller of the PARTITION_INFO_GET ABI was a v1.0 caller, populate
- * the corresponding descriptor format from the v1.1 descriptor array.
+ * Return the first descriptor matching a UUID in the tables and the number of
+ * matching descriptors, zero for an unknown UUID.
  */
-static uint64_t partition_info_populate_v1_0(struct ffa_partition_info_v1_1
-					     *partitions,
-					     struct mailbox *mbox,
-					     int partition_count)
+static uint32_t partition_info_lookup(uint32_t *uuid, uint32_t *start)
 {
-	uint32_t index;
-	uint32_t buf_size;
-	uint32_t descriptor_size;
-	struct ffa_partition_info_v1_0 *v1_0_partitions =
-		(struct ffa_partition_info_v1_0 *) mbox->rx_buffer;
+	uint32_t group;
 
-	buf_size = mbox->rxtx_page_count * FFA_PAGE_SIZE;
-	descriptor_size = partition_count *
-			  sizeof(struct ffa_partition_info_v1_0);
+	*start = 0U;
 
-	if (descriptor_size > buf_size) {
-		return FFA_ERROR_NO_MEMORY;
+	if (is_null_uuid(uuid)) {
+		return part_info_count;
 	}
 
-	for (index = 0U; index < partition_count; index++) {
-		v1_0_partitions[index].ep_id = partitions[index].ep_id;
-		v1_0_partitions[index].execution_ctx_count =
-			partitions[index].execution_ctx_count;
-		/* Only report v1.0 properties. */
-		v1_0_partitions[index].properties =
-			(partitions[index].properties &
-			FFA_PARTITION_INFO_GET_PROPERTIES_V1_0_MASK);
+	for (group = 0U; group < part_info_uuid_count; group++) {
+		if (uuid_match(part_info_uuid_index[group].uuid, uuid)) {
+			*start = part_info_uuid_index[group].start;
+			return part_info_uuid_index[group].count;
+		}
 	}
-	return 0;
+
+	return 0U;
 }
 
 /*
@@ -1058,7 +1105,8 @@ static uint64_t partition_info_get_handler(uint32_t smc_fid,
 					   uint64_t flags)
 {
 	int ret;
-	uint32_t partition_count = 0;
+	uint32_t partition_count;
+	uint32_t start;
 	uint32_t size = 0;
 	uint32_t ffa_version = get_partition_ffa_version(secure_origin);
 	struct mailbox *mbox;
@@ -1075,36 +1123,32 @@ static uint64_t partition_info_get_handler(uint32_t smc_fid,
 	info_get_flags = SMC_GET_GP(handle, CTX_GPREG_X5);
 	count_only = (info_get_flags & FFA_PARTITION_INFO_GET_COUNT_FLAG_MASK);
 
+	/* If we didn't find any matches the UUID is unknown. */
+	partition_count = partition_info_lookup(uuid, &start);
+	if (partition_count == 0) {
+		return spmc_ffa_error_return(handle,
+					     FFA_ERROR_INVALID_PARAMETER);
+	}
+
 	/* Handle the case where we don't need to populate the descriptors. */
-	if (count_only) {
-		partition_count = partition_info_get_handler_count_only(uuid);
-		if (partition_count == 0) {
-			return spmc_ffa_error_return(handle,
-						FFA_ERROR_INVALID_PARAMETER);
-		}
-	} else {
-		struct ffa_partition_info_v1_1 partitions[MAX_SP_LP_PARTITIONS];
+	if (!count_only) {
+		const void *descs;
+		uint32_t desc_size;
+		uint32_t buf_size;
 
 		/*
-		 * Handle the case where the partition descriptors are required,
-		 * check we have the buffers available and populate the
-		 * appropriate structure version.
+		 * Depending on the FF-A version of the requesting partition
+		 * we copy the v1.0 or the v1.1 format of the descriptors.
 		 */
-
-		/* Obtain the v1.1 format of the descriptors. */
-		ret = partition_info_get_handler_v1_1(uuid, partitions,
-						      MAX_SP_LP_PARTITIONS,
-						      &partition_count);
-
-		/* Check if an error occurred during discovery. */
-		if (ret != 0) {
-			goto err;
-		}
-
-		/* If we didn't find any matches the UUID is unknown. */
-		if (partition_count == 0) {
-			ret = FFA_ERROR_INVALID_PARAMETER;
-			goto err;
+		if (ffa_version == MAKE_FFA_VERSION(U(1), U(0))) {
+			desc_size = sizeof(struct ffa_partition_info_v1_0);
+			descs = is_null_uuid(uuid) ? &part_info_v1_0[start] :
+				&part_info_by_uuid_v1_0[start];
+		} else {
+			size = sizeof(struct ffa_partition_info_v1_1);
+			desc_size = size;
+			descs = is_null_uuid(uuid) ? &part_info_v1_1[start] :
+				&part_info_by_uuid_v1_1[start];
 		}
 
 		/* Obtain the partition mailbox RX/TX buffer pair descriptor. */
@@ -1126,36 +1170,16 @@ static uint64_t partition_info_get_handler(uint32_t smc_fid,
 			goto err_unlock;
 		}
 
-		/* Zero the RX buffer before populating. */
-		(void)memset(mbox->rx_buffer, 0,
-			     mbox->rxtx_page_count * FFA_PAGE_SIZE);
-
-		/*
-		 * Depending on the FF-A version of the requesting partition
-		 * we may need to convert to a v1.0 format otherwise we can copy
-		 * directly.
-		 */
-		if (ffa_version == MAKE_FFA_VERSION(U(1), U(0))) {
-			ret = partition_info_populate_v1_0(partitions,
-							   mbox,
-							   partition_count);
-			if (ret != 0) {
-				goto err_unlock;
-			}
-		} else {
-			uint32_t buf_size = mbox->rxtx_page_count *
-					    FFA_PAGE_SIZE;
-
-			/* Ensure the descriptor will fit in the buffer. */
-			size = sizeof(struct ffa_partition_info_v1_1);
-			if (partition_count * size  > buf_size) {
-				ret = FFA_ERROR_NO_MEMORY;
-				goto err_unlock;
-			}
-			memcpy(mbox->rx_buffer, partitions,
-			       partition_count * size);
+		/* Ensure the descriptors will fit in the buffer. */
+		buf_size = mbox->rxtx_page_count * FFA_PAGE_SIZE;
+		if (partition_count * desc_size > buf_size) {
+			ret = FFA_ERROR_NO_MEMORY;
+			goto err_unlock;
 		}
 
+		(void)memcpy(mbox->rx_buffer, descs,
+			     partition_count * desc_size);
+
 		mbox->state = MAILBOX_STATE_FULL;
 		spin_unlock(&mbox->lock);
 	}
@@ -1163,7 +1187,6 @@ static uint64_t partition_info_get_handler(uint32_t smc_fid,
 
 err_unlock:
 	spin_unlock(&mbox->lock);
-err:
 	return spmc_ffa_error_return(handle, ret);
 }
 
@@ -1227,9 +1250,17 @@ static uint64_t ffa_features_handler(uint32_t smc_fid,
 	uint32_t function_id = (uint32_t) x1;
 	uint32_t input_properties = (uint32_t) x2;
 
-	/* Check if a Feature ID was requested. */
+	/*
+	 * Check if a Feature ID was requested, only the interrupts of the
+	 * notifications are supported: the NPI for SPs and the SRI for the NWd.
+	 */
 	if ((function_id & FFA_FEATURES_BIT31_MASK) == 0U) {
-		/* We currently don't support any additional features. */
+		if ((function_id == FFA_FEATURE_NPI) && secure_origin) {
+			return ffa_feature_success(handle, SPMC_NPI_ID);
+		}
+		if ((function_id == FFA_FEATURE_SRI) && !secure_origin) {
+			return ffa_feature_success(handle, SPMC_SRI_ID);
+		}
 		return spmc_ffa_error_return(handle, FFA_ERROR_NOT_SUPPORTED);
 	}
 
@@ -1273,6 +1304,11 @@ static uint64_t ffa_features_handler(uint32_t smc_fid,
 	case FFA_RXTX_UNMAP:
 	case FFA_MEM_FRAG_TX:
 	case FFA_MSG_RUN:
+	case FFA_MSG_SEND2:
+	case FFA_NOTIFICATION_BIND:
+	case FFA_NOTIFICATION_UNBIND:
+	case FFA_NOTIFICATION_SET:
+	case FFA_NOTIFICATION_GET:
 
 		/*
 		 * We are relying on the fact that the other registers
@@ -1308,6 +1344,10 @@ static uint64_t ffa_features_handler(uint32_t smc_fid,
 	case FFA_MEM_LEND_SMC64:
 	case FFA_MEM_RECLAIM:
 	case FFA_MEM_FRAG_RX:
+	case FFA_NOTIFICATION_BITMAP_CREATE:
+	case FFA_NOTIFICATION_BITMAP_DESTROY:
+	case FFA_NOTIFICATION_INFO_GET:
+	case FFA_NOTIFICATION_INFO_GET_SMC64:
 
 		if (secure_origin) {
 			return spmc_ffa_error_return(handle,
@@ -1450,6 +1490,16 @@ static uint64_t ffa_run_handler(uint32_t smc_fid,
 		spin_unlock(&sp->rt_state_lock);
 	}
 
+	/*
+	 * A waiting SP run for its pending notifications is entered with the
+	 * NPI, for it to retrieve them with FFA_NOTIFICATION_GET.
+	 */
+	if ((*rt_model == RT_MODEL_RUN) && spmc_notif_sp_pending(sp, idx)) {
+		return spmc_smc_return(FFA_INTERRUPT, secure_origin, x1,
+				       SPMC_NPI_ID, 0, 0, handle, cookie,
+				       flags, target_id);
+	}
+
 	return spmc_smc_return(smc_fid, secure_origin, x1, 0, 0, 0,
 			       handle, cookie, flags, target_id);
 }
@@ -1907,9 +1957,10 @@ static int sp_manifest_parse(void *sp_manifest, int offset,
 		return ret;
 	}
 
-	/* Validate this entry, we currently only support direct messaging. */
+	/* Validate this entry, we support direct and indirect messaging. */
 	if ((config_32 & ~(FFA_PARTITION_DIRECT_REQ_RECV |
-			  FFA_PARTITION_DIRECT_REQ_SEND)) != 0U) {
+			  FFA_PARTITION_DIRECT_REQ_SEND |
+			  FFA_PARTITION_INDIRECT_MSG)) != 0U) {
 		WARN("Invalid Secure Partition messaging method (0x%x)\n",
 		     config_32);
 		return -EINVAL;
@@ -1936,6 +1987,16 @@ static int sp_manifest_parse(void *sp_manifest, int offset,
 		return -EINVAL;
 	}
 
+	/* A S-EL0 SP only ever runs in its execution context at index 0. */
+	ret = spmc_sp_ec_alloc(sp, (sp->runtime_el == S_EL0) ?
+			       1U : PLATFORM_CORE_COUNT);
+	if (ret != 0) {
+		return ret;
+	}
+
+	/* Notifications target the vCPUs of the SP, one per context. */
+	spmc_notif_sp_init(sp);
+
 	/*
 	 * Look for the optional fields that are expected to be present in
 	 * an SP manifest.
@@ -2215,6 +2276,8 @@ static void initalize_sp_descs(void)
 		sp->mailbox.tx_buffer = NULL;
 		sp->mailbox.state = MAILBOX_STATE_EMPTY;
 		sp->secondary_ep = 0;
+		sp->ec = NULL;
+		sp->ec_count = 0U;
 	}
 }
 
@@ -2292,6 +2355,9 @@ int32_t spmc_setup(void)
 		return ret;
 	}
 
+	/* The partitions are known, build the PARTITION_INFO_GET responses. */
+	partition_info_init();
+
 	/* Register power management hooks with PSCI */
 	psci_register_spd_pm_hook(&spmc_pm);
 
@@ -2434,6 +2500,39 @@ uint64_t spmc_smc_handler(uint32_t smc_fid,
 		return ffa_mem_perm_set_handler(smc_fid, secure_origin, x1, x2,
 						x3, x4, cookie, handle, flags);
 
+	case FFA_NOTIFICATION_BITMAP_CREATE:
+		return spmc_notif_bitmap_create_handler(smc_fid, secure_origin,
+							x1, x2, x3, x4, cookie,
+							handle, flags);
+
+	case FFA_NOTIFICATION_BITMAP_DESTROY:
+		return spmc_notif_bitmap_destroy_handler(smc_fid, secure_origin,
+							 x1, x2, x3, x4, cookie,
+							 handle, flags);
+
+	case FFA_NOTIFICATION_BIND:
+	case FFA_NOTIFICATION_UNBIND:
+		return spmc_notif_bind_handler(smc_fid, secure_origin, x1, x2,
+					       x3, x4, cookie, handle, flags);
+
+	case FFA_NOTIFICATION_SET:
+		return spmc_notif_set_handler(smc_fid, secure_origin, x1, x2,
+					      x3, x4, cookie, handle, flags);
+
+	case FFA_NOTIFICATION_GET:
+		return spmc_notif_get_handler(smc_fid, secure_origin, x1, x2,
+					      x3, x4, cookie, handle, flags);
+
+	case FFA_NOTIFICATION_INFO_GET:
+	case FFA_NOTIFICATION_INFO_GET_SMC64:
+		return spmc_notif_info_get_handler(smc_fid, secure_origin, x1,
+						   x2, x3, x4, cookie, handle,
+						   flags);
+
+	case FFA_MSG_SEND2:
+		return spmc_msg_send2_handler(smc_fid, secure_origin, x1, x2,
+					      x3, x4, cookie, handle, flags);
+
 	default:
 		WARN("Unsupported FF-A call 0x%08x.\n", smc_fid);
 		break;
@@ -0,0 +1,750 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <assert.h>
+#include <string.h>
+
+#include <arch_helpers.h>
+#include <common/debug.h>
+#include <common/runtime_svc.h>
+#include <lib/spinlock.h>
+#include <plat/common/platform.h>
+#include <services/ffa_svc.h>
+#include "spmc.h"
+
+#include <platform_def.h>
+
+/* Registers of the FFA_NOTIFICATION_INFO_GET response holding the IDs */
+#define INFO_GET_ID_REGS	5U
+#define INFO_GET_MAX_IDS	(INFO_GET_ID_REGS * 4U)
+
+/*
+ * Notifications state of a VM, or of the OS kernel in the absence of a
+ * Hypervisor, created by FFA_NOTIFICATION_BITMAP_CREATE.
+ */
+struct spmc_notif_vm {
+	bool created;
+	uint16_t vm_id;
+	struct spmc_notif_state state;
+};
+
+static struct spmc_notif_vm vm_notif[NS_PARTITION_COUNT];
+
+/* Protects the creation of the VM bitmaps and FFA_NOTIFICATION_INFO_GET. */
+static spinlock_t vm_notif_lock;
+
+/* Cores with an SRI delayed until the SP they run returns to the NWd. */
+static bool sri_delayed[PLATFORM_CORE_COUNT];
+
+static void notif_state_init(struct spmc_notif_state *state,
+			     unsigned int vcpu_count)
+{
+	(void)memset(state, 0, sizeof(*state));
+	state->vcpu_count = vcpu_count;
+}
+
+/*******************************************************************************
+ * Initialise the notifications state of an SP, which has a vCPU per execution
+ * context.
+ ******************************************************************************/
+void spmc_notif_sp_init(struct secure_partition_desc *sp)
+{
+	notif_state_init(&sp->notif, sp->ec_count);
+}
+
+static struct spmc_notif_vm *vm_notif_lookup(uint16_t vm_id)
+{
+	for (unsigned int i = 0U; i < NS_PARTITION_COUNT; i++) {
+		if (vm_notif[i].created && (vm_notif[i].vm_id == vm_id)) {
+			return &vm_notif[i];
+		}
+	}
+
+	return NULL;
+}
+
+/* Notifications state of an SP or a VM with a bitmap, NULL otherwise. */
+static struct spmc_notif_state *notif_state_get(uint16_t id)
+{
+	struct secure_partition_desc *sp;
+	struct spmc_notif_vm *vm;
+
+	if (ffa_is_secure_world_id(id)) {
+		sp = spmc_get_sp_ctx(id);
+		return (sp != NULL) ? &sp->notif : NULL;
+	}
+
+	vm = vm_notif_lookup(id);
+	return (vm != NULL) ? &vm->state : NULL;
+}
+
+/*
+ * An SP can only act on its own behalf, the NWd on behalf of any VM as the
+ * Hypervisor is trusted to pass the right ID.
+ */
+static bool notif_caller_id_valid(bool secure_origin, uint16_t id)
+{
+	if (secure_origin) {
+		return id == spmc_get_current_sp_ctx()->sp_id;
+	}
+
+	return ffa_is_normal_world_id(id);
+}
+
+static uint64_t notif_bitmap(uint64_t lo, uint64_t hi)
+{
+	return (lo & 0xFFFFFFFFULL) | (hi << 32);
+}
+
+static bool notif_state_pending(struct spmc_notif_state *state)
+{
+	uint64_t pending = __atomic_load_n(&state->framework_pending,
+					   __ATOMIC_SEQ_CST);
+
+	for (unsigned int w = 0U; w < SPMC_NOTIF_WORLDS; w++) {
+		pending |= __atomic_load_n(&state->pending[w],
+					   __ATOMIC_SEQ_CST);
+		for (unsigned int v = 0U; v < state->vcpu_count; v++) {
+			pending |= __atomic_load_n(&state->vcpu_pending[w][v],
+						   __ATOMIC_SEQ_CST);
+		}
+	}
+
+	return pending != 0ULL;
+}
+
+static bool notif_vcpu_pending(struct spmc_notif_state *state,
+			       unsigned int vcpu)
+{
+	uint64_t pending = 0ULL;
+
+	for (unsigned int w = 0U; w < SPMC_NOTIF_WORLDS; w++) {
+		pending |= __atomic_load_n(&state->vcpu_pending[w][vcpu],
+					   __ATOMIC_SEQ_CST);
+	}
+
+	return pending != 0ULL;
+}
+
+/*******************************************************************************
+ * Return whether an SP has notifications pending for one of its vCPUs, so that
+ * FFA_RUN enters it with the NPI.
+ ******************************************************************************/
+bool spmc_notif_sp_pending(struct secure_partition_desc *sp,
+			   unsigned int vcpu)
+{
+	struct spmc_notif_state *state = &sp->notif;
+	uint64_t pending = __atomic_load_n(&state->framework_pending,
+					   __ATOMIC_RELAXED);
+
+	for (unsigned int w = 0U; w < SPMC_NOTIF_WORLDS; w++) {
+		pending |= __atomic_load_n(&state->pending[w],
+					   __ATOMIC_RELAXED);
+	}
+
+	return (pending != 0ULL) ||
+	       ((vcpu < state->vcpu_count) && notif_vcpu_pending(state, vcpu));
+}
+
+/*
+ * Mark notifications pending without a lock. The receiver may retrieve them
+ * from another core at any time, and FFA_NOTIFICATION_INFO_GET reports them
+ * again from now on.
+ */
+static void notif_pend(uint64_t *bitmap, struct spmc_notif_state *state,
+		       uint64_t bits)
+{
+	(void)spmc_notif_bitmap_or(bitmap, bits);
+	__atomic_store_n(&state->info_reported, false, __ATOMIC_SEQ_CST);
+}
+
+/*
+ * Raise the SRI for the NWd scheduler to run the receivers. An SP can delay
+ * it until it returns to the NWd, so that it is not preempted by the SRI.
+ */
+static void notif_sri_trigger(bool secure_origin, bool delay)
+{
+	if (secure_origin && delay) {
+		sri_delayed[plat_my_core_pos()] = true;
+		return;
+	}
+
+	plat_ic_raise_ns_sgi(SPMC_SRI_ID, read_mpidr_el1());
+}
+
+/*******************************************************************************
+ * Raise the SRI delayed by the SP running on this core, called on its return
+ * to the normal world.
+ ******************************************************************************/
+void spmc_notif_sri_flush(void)
+{
+	unsigned int core = plat_my_core_pos();
+
+	if (sri_delayed[core]) {
+		sri_delayed[core] = false;
+		plat_ic_raise_ns_sgi(SPMC_SRI_ID, read_mpidr_el1());
+	}
+}
+
+/*******************************************************************************
+ * FFA_NOTIFICATION_BITMAP_CREATE: the Hypervisor, or the OS kernel for itself,
+ * creates the bitmaps of a VM before it can receive notifications from SPs.
+ ******************************************************************************/
+uint64_t spmc_notif_bitmap_create_handler(uint32_t smc_fid, bool secure_origin,
+					  uint64_t x1, uint64_t x2, uint64_t x3,
+					  uint64_t x4, void *cookie,
+					  void *handle, uint64_t flags)
+{
+	uint16_t vm_id = (uint16_t)(x1 & FFA_ID_MASK);
+	uint32_t vcpu_count = (uint32_t)x2;
+	struct spmc_notif_vm *vm = NULL;
+
+	if (secure_origin) {
+		return spmc_ffa_error_return(handle, FFA_ERROR_NOT_SUPPORTED);
+	}
+
+	if (!ffa_is_normal_world_id(vm_id) || (vcpu_count == 0U)) {
+		return spmc_ffa_error_return(handle,
+					     FFA_ERROR_INVALID_PARAMETER);
+	}
+
+	if (vcpu_count > PLATFORM_CORE_COUNT) {
+		return spmc_ffa_error_return(handle, FFA_ERROR_NO_MEMORY);
+	}
+
+	spin_lock(&vm_notif_lock);
+
+	if (vm_notif_lookup(vm_id) != NULL) {
+		spin_unlock(&vm_notif_lock);
+		return spmc_ffa_error_return(handle, FFA_ERROR_DENIED);
+	}
+
+	for (unsigned int i = 0U; i < NS_PARTITION_COUNT; i++) {
+		if (!vm_notif[i].created) {
+			vm = &vm_notif[i];
+			break;
+		}
+	}
+
+	if (vm == NULL) {
+		spin_unlock(&vm_notif_lock);
+		return spmc_ffa_error_return(handle, FFA_ERROR_NO_MEMORY);
+	}
+
+	notif_state_init(&vm->state, vcpu_count);
+	vm->vm_id = vm_id;
+	vm->created = true;
+
+	spin_unlock(&vm_notif_lock);
+
+	SMC_RET1(handle, FFA_SUCCESS_SMC32);
+}
+
+/*******************************************************************************
+ * FFA_NOTIFICATION_BITMAP_DESTROY: only the bitmaps of a VM with no bound or
+ * pending notifications can be destroyed.
+ ******************************************************************************/
+uint64_t spmc_notif_bitmap_destroy_handler(uint32_t smc_fid,
+					   bool secure_origin, uint64_t x1,
+					   uint64_t x2, uint64_t x3,
+					   uint64_t x4, void *cookie,
+					   void *handle, uint64_t flags)
+{
+	struct spmc_notif_vm *vm;
+
+	if (secure_origin) {
+		return spmc_ffa_error_return(handle, FFA_ERROR_NOT_SUPPORTED);
+	}
+
+	spin_lock(&vm_notif_lock);
+
+	vm = vm_notif_lookup((uint16_t)(x1 & FFA_ID_MASK));
+	if ((vm == NULL) || (vm->state.bound != 0ULL) ||
+	    notif_state_pending(&vm->state)) {
+		spin_unlock(&vm_notif_lock);
+		return spmc_ffa_error_return(handle, FFA_ERROR_DENIED);
+	}
+
+	vm->created = false;
+
+	spin_unlock(&vm_notif_lock);
+
+	SMC_RET1(handle, FFA_SUCCESS_SMC32);
+}
+
+/*******************************************************************************
+ * FFA_NOTIFICATION_BIND and FFA_NOTIFICATION_UNBIND: a receiver allows or stops
+ * a sender to signal some of its notifications.
+ ******************************************************************************/
+uint64_t spmc_notif_bind_handler(uint32_t smc_fid, bool secure_origin,
+				 uint64_t x1, uint64_t x2, uint64_t x3,
+				 uint64_t x4, void *cookie, void *handle,
+				 uint64_t flags)
+{
+	uint16_t sender = ffa_endpoint_source((unsigned int)x1);
+	uint16_t receiver = ffa_endpoint_destination((unsigned int)x1);
+	uint32_t bind_flags = (uint32_t)x2;
+	uint64_t bitmap = notif_bitmap(x3, x4);
+	bool bind = (smc_fid == FFA_NOTIFICATION_BIND);
+	struct spmc_notif_state *state;
+	int error_code;
+
+	if ((bitmap == 0ULL) || (sender == receiver) ||
+	    ((bind_flags & ~(bind ? FFA_NOTIFICATION_FLAG_PER_VCPU : 0U)) !=
+	     0U) ||
+	    !notif_caller_id_valid(secure_origin, receiver)) {
+		return spmc_ffa_error_return(handle,
+					     FFA_ERROR_INVALID_PARAMETER);
+	}
+
+	/* VM to VM notifications are handled by the Hypervisor. */
+	if (ffa_is_normal_world_id(sender) &&
+	    ffa_is_normal_world_id(receiver)) {
+		return spmc_ffa_error_return(handle,
+					     FFA_ERROR_INVALID_PARAMETER);
+	}
+
+	if (ffa_is_secure_world_id(sender) &&
+	    (spmc_get_sp_ctx(sender) == NULL)) {
+		return spmc_ffa_error_return(handle,
+					     FFA_ERROR_INVALID_PARAMETER);
+	}
+
+	state = notif_state_get(receiver);
+	if (state == NULL) {
+		return spmc_ffa_error_return(handle, FFA_ERROR_DENIED);
+	}
+
+	spin_lock(&state->lock);
+
+	if (bind) {
+		/* None of the notifications can be bound already. */
+		if ((state->bound & bitmap) != 0ULL) {
+			error_code = FFA_ERROR_DENIED;
+			goto err;
+		}
+
+		for (unsigned int i = 0U; i < 64U; i++) {
+			if ((bitmap & BIT_64(i)) != 0ULL) {
+				state->sender[i] = sender;
+			}
+		}
+
+		if ((bind_flags & FFA_NOTIFICATION_FLAG_PER_VCPU) != 0U) {
+			state->per_vcpu |= bitmap;
+		} else {
+			state->per_vcpu &= ~bitmap;
+		}
+		state->bound |= bitmap;
+	} else {
+		/* All of them must be bound to the sender. */
+		if ((state->bound & bitmap) != bitmap) {
+			error_code = FFA_ERROR_DENIED;
+			goto err;
+		}
+
+		for (unsigned int i = 0U; i < 64U; i++) {
+			if (((bitmap & BIT_64(i)) != 0ULL) &&
+			    (state->sender[i] != sender)) {
+				error_code = FFA_ERROR_DENIED;
+				goto err;
+			}
+		}
+
+		state->bound &= ~bitmap;
+		state->per_vcpu &= ~bitmap;
+
+		/* Drop the notifications the sender left pending. */
+		for (unsigned int w = 0U; w < SPMC_NOTIF_WORLDS; w++) {
+			(void)spmc_notif_bitmap_take(&state->pending[w], bitmap);
+			for (unsigned int v = 0U; v < state->vcpu_count; v++) {
+				(void)spmc_notif_bitmap_take(
+					&state->vcpu_pending[w][v], bitmap);
+			}
+		}
+	}
+
+	spin_unlock(&state->lock);
+
+	SMC_RET1(handle, FFA_SUCCESS_SMC32);
+
+err:
+	spin_unlock(&state->lock);
+	return spmc_ffa_error_return(handle, error_code);
+}
+
+/*******************************************************************************
+ * FFA_NOTIFICATION_SET: a sender signals notifications bound to it. They are
+ * marked pending without taking a lock, and the SRI is raised for the NWd
+ * scheduler when the sender is an SP.
+ ******************************************************************************/
+uint64_t spmc_notif_set_handler(uint32_t smc_fid, bool secure_origin,
+				uint64_t x1, uint64_t x2, uint64_t x3,
+				uint64_t x4, void *cookie, void *handle,
+				uint64_t flags)
+{
+	uint16_t sender = ffa_endpoint_source((unsigned int)x1);
+	uint16_t receiver = ffa_endpoint_destination((unsigned int)x1);
+	uint32_t set_flags = (uint32_t)x2;
+	bool per_vcpu = (set_flags & FFA_NOTIFICATION_FLAG_PER_VCPU) != 0U;
+	bool delay = (set_flags & FFA_NOTIFICATION_FLAG_DELAY_SRI) != 0U;
+	unsigned int vcpu = set_flags >> FFA_NOTIFICATION_SET_VCPU_SHIFT;
+	uint64_t bitmap = notif_bitmap(x3, x4);
+	struct spmc_notif_state *state;
+	unsigned int world;
+
+	if ((bitmap == 0ULL) || (sender == receiver) ||
+	    ((set_flags & ~FFA_NOTIFICATION_SET_FLAGS_MASK) != 0U) ||
+	    (!per_vcpu && (vcpu != 0U)) || (delay && !secure_origin) ||
+	    !notif_caller_id_valid(secure_origin, sender) ||
+	    (ffa_is_normal_world_id(sender) &&
+	     ffa_is_normal_world_id(receiver))) {
+		return spmc_ffa_error_return(handle,
+					     FFA_ERROR_INVALID_PARAMETER);
+	}
+
+	state = notif_state_get(receiver);
+	if ((state == NULL) || (per_vcpu && (vcpu >= state->vcpu_count))) {
+		return spmc_ffa_error_return(handle,
+					     FFA_ERROR_INVALID_PARAMETER);
+	}
+
+	/*
+	 * The bindings are read without the lock. The receiver binds before
+	 * telling the sender to signal, and a racing unbind drops them.
+	 */
+	if ((state->bound & bitmap) != bitmap) {
+		return spmc_ffa_error_return(handle, FFA_ERROR_DENIED);
+	}
+
+	for (unsigned int i = 0U; i < 64U; i++) {
+		if (((bitmap & BIT_64(i)) != 0ULL) &&
+		    (state->sender[i] != sender)) {
+			return spmc_ffa_error_return(handle, FFA_ERROR_DENIED);
+		}
+	}
+
+	if ((state->per_vcpu & bitmap) != (per_vcpu ? bitmap : 0ULL)) {
+		return spmc_ffa_error_return(handle,
+					     FFA_ERROR_INVALID_PARAMETER);
+	}
+
+	world = secure_origin ? SPMC_NOTIF_FROM_SP : SPMC_NOTIF_FROM_VM;
+	notif_pend(per_vcpu ? &state->vcpu_pending[world][vcpu] :
+		   &state->pending[world], state, bitmap);
+
+	/* The NWd knows of the notifications it signals itself. */
+	if (secure_origin) {
+		notif_sri_trigger(secure_origin, delay);
+	}
+
+	SMC_RET1(handle, FFA_SUCCESS_SMC32);
+}
+
+/*******************************************************************************
+ * FFA_NOTIFICATION_GET: a receiver retrieves and clears its pending
+ * notifications, the global ones and those of one of its vCPUs.
+ ******************************************************************************/
+uint64_t spmc_notif_get_handler(uint32_t smc_fid, bool secure_origin,
+				uint64_t x1, uint64_t x2, uint64_t x3,
+				uint64_t x4, void *cookie, void *handle,
+				uint64_t flags)
+{
+	uint16_t receiver = (uint16_t)(x1 & FFA_ID_MASK);
+	unsigned int vcpu = (uint32_t)x1 >> FFA_NOTIFICATION_GET_VCPU_SHIFT;
+	uint32_t get_flags = (uint32_t)x2;
+	uint64_t bitmaps[SPMC_NOTIF_WORLDS] = { 0ULL };
+	uint64_t framework = 0ULL;
+	struct spmc_notif_state *state;
+
+	if (((get_flags & ~(FFA_NOTIFICATION_GET_FLAG_SP |
+			    FFA_NOTIFICATION_GET_FLAG_VM |
+			    FFA_NOTIFICATION_GET_FLAG_SPM |
+			    FFA_NOTIFICATION_GET_FLAG_HYP)) != 0U) ||
+	    !notif_caller_id_valid(secure_origin, receiver)) {
+		return spmc_ffa_error_return(handle,
+					     FFA_ERROR_INVALID_PARAMETER);
+	}
+
+	state = notif_state_get(receiver);
+	if ((state == NULL) || (vcpu >= state->vcpu_count) ||
+	    (secure_origin &&
+	     (vcpu != get_ec_index(spmc_get_current_sp_ctx())))) {
+		return spmc_ffa_error_return(handle,
+					     FFA_ERROR_INVALID_PARAMETER);
+	}
+
+	for (unsigned int w = 0U; w < SPMC_NOTIF_WORLDS; w++) {
+		uint32_t flag = (w == SPMC_NOTIF_FROM_SP) ?
+				FFA_NOTIFICATION_GET_FLAG_SP :
+				FFA_NOTIFICATION_GET_FLAG_VM;
+
+		if ((get_flags & flag) != 0U) {
+			bitmaps[w] = spmc_notif_bitmap_take(&state->pending[w],
+							    ~0ULL) |
+				     spmc_notif_bitmap_take(
+					&state->vcpu_pending[w][vcpu], ~0ULL);
+		}
+	}
+
+	if ((get_flags & FFA_NOTIFICATION_GET_FLAG_SPM) != 0U) {
+		framework = spmc_notif_bitmap_take(&state->framework_pending,
+						   ~0ULL);
+	}
+
+	/* The SPMC has no Hypervisor framework notifications to report. */
+	SMC_RET8(handle, FFA_SUCCESS_SMC32, 0,
+		 (uint32_t)bitmaps[SPMC_NOTIF_FROM_SP],
+		 (uint32_t)(bitmaps[SPMC_NOTIF_FROM_SP] >> 32),
+		 (uint32_t)bitmaps[SPMC_NOTIF_FROM_VM],
+		 (uint32_t)(bitmaps[SPMC_NOTIF_FROM_VM] >> 32),
+		 (uint32_t)framework, 0);
+}
+
+/* Lists of endpoint and vCPU IDs of an FFA_NOTIFICATION_INFO_GET response */
+struct info_get_lists {
+	uint16_t ids[INFO_GET_MAX_IDS];
+	unsigned int nr_ids;
+	unsigned int max_ids;
+	unsigned int nr_lists;
+	uint32_t vcpus_per_list;
+	bool more;
+};
+
+/*
+ * Add the lists of a receiver with pending notifications not reported yet: its
+ * ID alone for the global ones, then with up to three vCPU IDs per list for
+ * the per-vCPU ones. A receiver which does not fit is reported next time.
+ */
+static void info_get_add(struct info_get_lists *lists, uint16_t id,
+			 struct spmc_notif_state *state)
+{
+	uint16_t vcpus[PLATFORM_CORE_COUNT];
+	unsigned int nr_vcpus = 0U, needed;
+
+	if (__atomic_load_n(&state->info_reported, __ATOMIC_SEQ_CST)) {
+		return;
+	}
+
+	/*
+	 * Mark the notifications reported before looking at them, a sender
+	 * signalling more from now on gets them reported again.
+	 */
+	__atomic_store_n(&state->info_reported, true, __ATOMIC_SEQ_CST);
+
+	if (!notif_state_pending(state)) {
+		return;
+	}
+
+	for (unsigned int v = 0U; v < state->vcpu_count; v++) {
+		if (notif_vcpu_pending(state, v)) {
+			vcpus[nr_vcpus++] = (uint16_t)v;
+		}
+	}
+
+	needed = (nr_vcpus == 0U) ? 1U :
+		 div_round_up(nr_vcpus, FFA_NOTIFICATION_INFO_GET_MAX_VCPUS);
+	if (((lists->nr_lists + needed) > FFA_NOTIFICATION_INFO_GET_MAX_LISTS) ||
+	    ((lists->nr_ids + needed + nr_vcpus) > lists->max_ids)) {
+		__atomic_store_n(&state->info_reported, false,
+				 __ATOMIC_SEQ_CST);
+		lists->more = true;
+		return;
+	}
+
+	for (unsigned int l = 0U; l < needed; l++) {
+		unsigned int first = l * FFA_NOTIFICATION_INFO_GET_MAX_VCPUS;
+		unsigned int count = MIN(nr_vcpus - MIN(first, nr_vcpus),
+					 FFA_NOTIFICATION_INFO_GET_MAX_VCPUS);
+
+		lists->ids[lists->nr_ids++] = id;
+		for (unsigned int v = 0U; v < count; v++) {
+			lists->ids[lists->nr_ids++] = vcpus[first + v];
+		}
+
+		lists->vcpus_per_list |= count <<
+			FFA_NOTIFICATION_INFO_GET_LIST_SHIFT(lists->nr_lists);
+		lists->nr_lists++;
+	}
+}
+
+/*******************************************************************************
+ * FFA_NOTIFICATION_INFO_GET: the NWd scheduler, on the SRI, gets the SPs and
+ * VMs with pending notifications and the vCPUs to run for them.
+ ******************************************************************************/
+uint64_t spmc_notif_info_get_handler(uint32_t smc_fid, bool secure_origin,
+				     uint64_t x1, uint64_t x2, uint64_t x3,
+				     uint64_t x4, void *cookie, void *handle,
+				     uint64_t flags)
+{
+	bool smc64 = (smc_fid == FFA_NOTIFICATION_INFO_GET_SMC64);
+	unsigned int ids_per_reg = smc64 ? 4U : 2U;
+	struct info_get_lists lists = { 0 };
+	struct secure_partition_desc *sp;
+	uint64_t regs[INFO_GET_ID_REGS] = { 0ULL };
+	uint32_t info_flags;
+
+	if (secure_origin) {
+		return spmc_ffa_error_return(handle, FFA_ERROR_NOT_SUPPORTED);
+	}
+
+	lists.max_ids = INFO_GET_ID_REGS * ids_per_reg;
+
+	spin_lock(&vm_notif_lock);
+
+	for (unsigned int i = 0U; i < SECURE_PARTITION_COUNT; i++) {
+		sp = spmc_get_sp_ctx_by_idx(i);
+		if (sp->sp_id != INV_SP_ID) {
+			info_get_add(&lists, sp->sp_id, &sp->notif);
+		}
+	}
+
+	for (unsigned int i = 0U; i < NS_PARTITION_COUNT; i++) {
+		if (vm_notif[i].created) {
+			info_get_add(&lists, vm_notif[i].vm_id,
+				     &vm_notif[i].state);
+		}
+	}
+
+	spin_unlock(&vm_notif_lock);
+
+	if (lists.nr_lists == 0U) {
+		return spmc_ffa_error_return(handle, lists.more ?
+					     FFA_ERROR_NO_MEMORY :
+					     FFA_ERROR_NO_DATA);
+	}
+
+	for (unsigned int i = 0U; i < lists.nr_ids; i++) {
+		regs[i / ids_per_reg] |= (uint64_t)lists.ids[i] <<
+					 (16U * (i % ids_per_reg));
+	}
+
+	info_flags = (lists.more ? FFA_NOTIFICATION_INFO_GET_MORE_PENDING :
+		      0U) |
+		     ((lists.nr_lists - 1U) <<
+		      FFA_NOTIFICATION_INFO_GET_LISTS_SHIFT) |
+		     lists.vcpus_per_list;
+
+	SMC_RET8(handle, smc64 ? FFA_SUCCESS_SMC64 : FFA_SUCCESS_SMC32, 0,
+		 info_flags, regs[0], regs[1], regs[2], regs[3], regs[4]);
+}
+
+/*******************************************************************************
+ * FFA_MSG_SEND2: copy an indirect message from the TX buffer of the sender to
+ * the RX buffer of the receiver, and signal it with the RX buffer full
+ * framework notification. Messages go between SPs, or between an SP and the
+ * NWd.
+ ******************************************************************************/
+uint64_t spmc_msg_send2_handler(uint32_t smc_fid, bool secure_origin,
+				uint64_t x1, uint64_t x2, uint64_t x3,
+				uint64_t x4, void *cookie, void *handle,
+				uint64_t flags)
+{
+	struct mailbox *src = spmc_get_mbox_desc(secure_origin);
+	struct mailbox *dst, *first, *second;
+	struct secure_partition_desc *sp;
+	struct spmc_notif_state *state;
+	struct ffa_partition_msg_hdr hdr;
+	bool delay = ((uint32_t)x2 & FFA_MSG_SEND2_FLAG_DELAY_SRI) != 0U;
+	uint16_t sender, receiver;
+	size_t src_size, msg_size;
+	int error_code;
+
+	if ((((uint32_t)x2 & ~FFA_MSG_SEND2_FLAG_DELAY_SRI) != 0U) ||
+	    (delay && !secure_origin)) {
+		return spmc_ffa_error_return(handle,
+					     FFA_ERROR_INVALID_PARAMETER);
+	}
+
+	spin_lock(&src->lock);
+	if (src->tx_buffer == NULL) {
+		spin_unlock(&src->lock);
+		return spmc_ffa_error_return(handle, FFA_ERROR_DENIED);
+	}
+	(void)memcpy(&hdr, src->tx_buffer, sizeof(hdr));
+	src_size = src->rxtx_page_count * FFA_PAGE_SIZE;
+	spin_unlock(&src->lock);
+
+	sender = ffa_endpoint_source(hdr.sender_receiver);
+	receiver = ffa_endpoint_destination(hdr.sender_receiver);
+
+	if (!notif_caller_id_valid(secure_origin, sender) ||
+	    (hdr.offset < sizeof(hdr)) || (hdr.offset > src_size) ||
+	    (hdr.size > (src_size - hdr.offset))) {
+		return spmc_ffa_error_return(handle,
+					     FFA_ERROR_INVALID_PARAMETER);
+	}
+	msg_size = hdr.offset + hdr.size;
+
+	if (ffa_is_secure_world_id(receiver)) {
+		sp = spmc_get_sp_ctx(receiver);
+		if ((sp == NULL) || (receiver == sender)) {
+			return spmc_ffa_error_return(handle,
+						FFA_ERROR_INVALID_PARAMETER);
+		}
+		if ((sp->properties & FFA_PARTITION_INDIRECT_MSG) == 0U) {
+			return spmc_ffa_error_return(handle,
+						     FFA_ERROR_DENIED);
+		}
+		dst = &sp->mailbox;
+		state = &sp->notif;
+	} else {
+		/* VM to VM messages are handled by the Hypervisor. */
+		if (!secure_origin) {
+			return spmc_ffa_error_return(handle,
+						FFA_ERROR_INVALID_PARAMETER);
+		}
+		dst = &spmc_get_hyp_ctx()->mailbox;
+		state = notif_state_get(receiver);
+	}
+
+	/* Take the locks in a fixed order, as a reply may go the other way. */
+	first = (src < dst) ? src : dst;
+	second = (src < dst) ? dst : src;
+	spin_lock(&first->lock);
+	spin_lock(&second->lock);
+
+	if ((src->tx_buffer == NULL) ||
+	    ((src->rxtx_page_count * FFA_PAGE_SIZE) != src_size)) {
+		error_code = FFA_ERROR_DENIED;
+		goto err;
+	}
+
+	if ((dst->rx_buffer == NULL) ||
+	    (msg_size > (dst->rxtx_page_count * FFA_PAGE_SIZE))) {
+		error_code = FFA_ERROR_DENIED;
+		goto err;
+	}
+
+	if (dst->state != MAILBOX_STATE_EMPTY) {
+		error_code = FFA_ERROR_BUSY;
+		goto err;
+	}
+
+	(void)memcpy(dst->rx_buffer, &hdr, sizeof(hdr));
+	(void)memcpy((uint8_t *)dst->rx_buffer + hdr.offset,
+		     (const uint8_t *)src->tx_buffer + hdr.offset, hdr.size);
+	dst->state = MAILBOX_STATE_FULL;
+
+	spin_unlock(&second->lock);
+	spin_unlock(&first->lock);
+
+	if (state != NULL) {
+		notif_pend(&state->framework_pending, state,
+			   FFA_FRAMEWORK_NOTIF_RX_BUFFER_FULL);
+	}
+
+	if (secure_origin) {
+		notif_sri_trigger(secure_origin, delay);
+	}
+
+	SMC_RET1(handle, FFA_SUCCESS_SMC32);
+
+err:
+	spin_unlock(&second->lock);
+	spin_unlock(&first->lock);
+	return spmc_ffa_error_return(handle, error_code);
+}
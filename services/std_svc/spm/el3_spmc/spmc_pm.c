@@ -50,7 +50,7 @@ static void spmc_cpu_on_finish_handler(u_register_t unused)
 	assert(sp != NULL);
 
 	/* Obtain a reference to the SP execution context */
-	ec = &sp->ec[get_ec_index(sp)];
+	ec = spmc_get_sp_ec(sp);
 
 	/*
 	 * In case of a S-EL0 SP, only initialise the context data structure for
@@ -189,7 +189,7 @@ static void read_optional_string(void *manifest, int32_t offset,
 	const fdt32_t *prop;
 	int lenp;
 
-	prop = fdt_getprop(manifest, offset, property, &lenp);
+	prop = fdtw_getprop(manifest, offset, property, &lenp);
 	if (prop == NULL) {
 		out[0] = '\0';
 	} else {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2023, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2022-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -24,12 +24,18 @@
  * @desc_filled:    Size of @desc already received.
  * @in_use:         Number of clients that have called ffa_mem_retrieve_req
  *                  without a matching ffa_mem_relinquish call.
+ * @checking:       @desc is being checked without holding the state lock. The
+ *                  object is not found by other operations until then.
+ * @freed:          Object freed while others were being checked, its space is
+ *                  reclaimed once none is.
  * @desc:           FF-A memory region descriptor passed in ffa_mem_share.
  */
 struct spmc_shmem_obj {
 	size_t desc_size;
 	size_t desc_filled;
 	size_t in_use;
+	bool checking;
+	bool freed;
 	struct ffa_mtd desc;
 };
 
@@ -57,6 +63,44 @@ static size_t spmc_shmem_obj_size(size_t desc_size)
 	return desc_size + offsetof(struct spmc_shmem_obj, desc);
 }
 
+/**
+ * spmc_shmem_handle_slot - Get the handle table slot of a handle.
+ * @state:      Global state.
+ * @handle:     Handle of the object.
+ *
+ * Return: Pointer to the slot in @state->handle_slots.
+ */
+static size_t *spmc_shmem_handle_slot(struct spmc_shmem_obj_state *state,
+				      uint64_t handle)
+{
+	return &state->handle_slots[handle % SPMC_SHMEM_HANDLE_SLOTS];
+}
+
+/**
+ * spmc_shmem_handle_set - Record the location of an object by its handle.
+ * @state:      Global state.
+ * @obj:        Object whose handle has been assigned.
+ */
+static void spmc_shmem_handle_set(struct spmc_shmem_obj_state *state,
+				  struct spmc_shmem_obj *obj)
+{
+	*spmc_shmem_handle_slot(state, obj->desc.handle) =
+		(size_t)((uint8_t *)obj - state->data) + 1U;
+}
+
+/**
+ * spmc_shmem_obj_is_live - Check whether other operations may use an object.
+ * @obj:        Object to check.
+ *
+ * Return: %false if @obj is being checked or has been freed, %true otherwise.
+ */
+static bool spmc_shmem_obj_is_live(const struct spmc_shmem_obj *obj)
+{
+	return !obj->checking && !obj->freed;
+}
+
+static void spmc_shmem_obj_compact(struct spmc_shmem_obj_state *state);
+
 /**
  * spmc_shmem_obj_alloc - Allocate struct spmc_shmem_obj.
  * @state:      Global state.
@@ -96,6 +140,12 @@ spmc_shmem_obj_alloc(struct spmc_shmem_obj_state *state, size_t desc_size)
 		return NULL;
 	}
 
+	/* Reclaim the objects freed while others were being checked */
+	if ((obj_size > free) && (state->checking == 0U)) {
+		spmc_shmem_obj_compact(state);
+		free = state->data_size - state->allocated;
+	}
+
 	if (obj_size > free) {
 		WARN("%s(0x%zx) failed, free 0x%zx\n",
 		     __func__, desc_size, free);
@@ -106,35 +156,92 @@ spmc_shmem_obj_alloc(struct spmc_shmem_obj_state *state, size_t desc_size)
 	obj->desc_size = desc_size;
 	obj->desc_filled = 0;
 	obj->in_use = 0;
+	obj->checking = false;
+	obj->freed = false;
 	state->allocated += obj_size;
 	return obj;
 }
 
 /**
- * spmc_shmem_obj_free - Free struct spmc_shmem_obj.
+ * spmc_shmem_obj_remove - Remove struct spmc_shmem_obj from the datastore.
  * @state:      Global state.
- * @obj:        Object to free.
+ * @obj:        Object to remove.
  *
- * Release memory used by @obj. Other objects may move, so on return all
- * pointers to struct spmc_shmem_obj object should be considered invalid, not
- * just @obj.
- *
- * The current implementation always compacts the remaining objects to simplify
- * the allocator and to avoid fragmentation.
+ * The objects after @obj are moved down over it. The handle table is updated to
+ * follow the objects that moved.
  */
-
-static void spmc_shmem_obj_free(struct spmc_shmem_obj_state *state,
+static void spmc_shmem_obj_remove(struct spmc_shmem_obj_state *state,
 				  struct spmc_shmem_obj *obj)
 {
 	size_t free_size = spmc_shmem_obj_size(obj->desc_size);
 	uint8_t *shift_dest = (uint8_t *)obj;
 	uint8_t *shift_src = shift_dest + free_size;
 	size_t shift_size = state->allocated - (shift_src - state->data);
+	size_t slot_val = (size_t)(shift_dest - state->data) + 1U;
+	unsigned int i;
 
 	if (shift_size != 0U) {
 		memmove(shift_dest, shift_src, shift_size);
 	}
 	state->allocated -= free_size;
+
+	/* Follow the objects which have been moved down */
+	for (i = 0U; i < SPMC_SHMEM_HANDLE_SLOTS; i++) {
+		if (state->handle_slots[i] == slot_val) {
+			state->handle_slots[i] = 0U;
+		} else if (state->handle_slots[i] > slot_val) {
+			state->handle_slots[i] -= free_size;
+		} else {
+			/* Objects before @obj did not move */
+		}
+	}
+}
+
+/**
+ * spmc_shmem_obj_compact - Remove the objects freed while others were being
+ *                          checked.
+ * @state:      Global state, with no object being checked.
+ */
+static void spmc_shmem_obj_compact(struct spmc_shmem_obj_state *state)
+{
+	size_t offset = 0U;
+
+	assert(state->checking == 0U);
+
+	while (offset < state->allocated) {
+		struct spmc_shmem_obj *obj =
+			(struct spmc_shmem_obj *)(state->data + offset);
+
+		if (obj->freed) {
+			spmc_shmem_obj_remove(state, obj);
+		} else {
+			offset += spmc_shmem_obj_size(obj->desc_size);
+		}
+	}
+}
+
+/**
+ * spmc_shmem_obj_free - Free struct spmc_shmem_obj.
+ * @state:      Global state.
+ * @obj:        Object to free.
+ *
+ * Release memory used by @obj. Other objects may move, so on return all
+ * pointers to struct spmc_shmem_obj object should be considered invalid, not
+ * just @obj.
+ *
+ * The current implementation always compacts the remaining objects to simplify
+ * the allocator and to avoid fragmentation. While objects are being checked
+ * without the state lock, nothing may move and @obj is only marked as freed
+ * until the next free or failed allocation after the checks.
+ */
+static void spmc_shmem_obj_free(struct spmc_shmem_obj_state *state,
+				struct spmc_shmem_obj *obj)
+{
+	obj->freed = true;
+
+	if (state->checking == 0U) {
+		spmc_shmem_obj_compact(state);
+	}
 }
 
 /**
@@ -148,12 +255,28 @@ static void spmc_shmem_obj_free(struct spmc_shmem_obj_state *state,
 static struct spmc_shmem_obj *
 spmc_shmem_obj_lookup(struct spmc_shmem_obj_state *state, uint64_t handle)
 {
-	uint8_t *curr = state->data;
+	size_t *slot = spmc_shmem_handle_slot(state, handle);
+	uint8_t *curr;
+
+	/* The slot may hold another handle sharing it, or nothing */
+	if (*slot != 0U) {
+		struct spmc_shmem_obj *obj =
+			(struct spmc_shmem_obj *)(state->data + *slot - 1U);
 
+		assert((*slot - 1U) < state->allocated);
+		if ((obj->desc.handle == handle) &&
+		    spmc_shmem_obj_is_live(obj)) {
+			return obj;
+		}
+	}
+
+	curr = state->data;
 	while (curr - state->data < state->allocated) {
 		struct spmc_shmem_obj *obj = (struct spmc_shmem_obj *)curr;
 
-		if (obj->desc.handle == handle) {
+		if ((obj->desc.handle == handle) &&
+		    spmc_shmem_obj_is_live(obj)) {
+			spmc_shmem_handle_set(state, obj);
 			return obj;
 		}
 		curr += spmc_shmem_obj_size(obj->desc_size);
@@ -167,20 +290,21 @@ spmc_shmem_obj_lookup(struct spmc_shmem_obj_state *state, uint64_t handle)
  *              returned.
  *
  * Return: the next struct spmc_shmem_obj_state object from the provided
- *	   offset.
+ *	   offset, skipping the objects being checked or freed.
  *	   %NULL, if there are no more objects.
  */
 static struct spmc_shmem_obj *
 spmc_shmem_obj_get_next(struct spmc_shmem_obj_state *state, size_t *offset)
 {
-	uint8_t *curr = state->data + *offset;
-
-	if (curr - state->data < state->allocated) {
-		struct spmc_shmem_obj *obj = (struct spmc_shmem_obj *)curr;
+	while (*offset < state->allocated) {
+		struct spmc_shmem_obj *obj =
+			(struct spmc_shmem_obj *)(state->data + *offset);
 
 		*offset += spmc_shmem_obj_size(obj->desc_size);
 
-		return obj;
+		if (spmc_shmem_obj_is_live(obj)) {
+			return obj;
+		}
 	}
 	return NULL;
 }
@@ -640,7 +764,11 @@ spmc_populate_ffa_v1_0_descriptor(void *dst, struct spmc_shmem_obj *orig_obj,
 				 size_t buf_size, size_t offset,
 				 size_t *copy_size, size_t *v1_0_desc_size)
 {
+		struct ffa_mtd *orig = &orig_obj->desc;
 		struct spmc_shmem_obj *v1_0_obj;
+		size_t mrd_out_offset;
+		size_t mrd_in_offset;
+		size_t in_offset;
 
 		/* Calculate the size that the v1.0 descriptor will require. */
 		*v1_0_desc_size = spmc_shm_get_v1_0_descriptor_size(
@@ -652,6 +780,38 @@ spmc_populate_ffa_v1_0_descriptor(void *dst, struct spmc_shmem_obj *orig_obj,
 			return FFA_ERROR_INVALID_PARAMETER;
 		}
 
+		if (offset >= *v1_0_desc_size) {
+			return FFA_ERROR_INVALID_PARAMETER;
+		}
+
+		/*
+		 * Past the header and emad array the v1.0 descriptor is a plain
+		 * copy of the memory region descriptors of the v1.1 one. Later
+		 * fragments of large descriptors only cover that part, copy them
+		 * straight from the original rather than converting it all
+		 * again for each fragment.
+		 */
+		mrd_out_offset = offsetof(struct ffa_mtd_v1_0, emad) +
+				 (orig->emad_count *
+				  sizeof(struct ffa_emad_v1_0));
+		mrd_in_offset = orig->emad_offset +
+				(orig->emad_size * orig->emad_count);
+
+		if (offset >= mrd_out_offset) {
+			in_offset = mrd_in_offset + (offset - mrd_out_offset);
+			*copy_size = MIN(*v1_0_desc_size - offset, buf_size);
+
+			if ((in_offset > orig_obj->desc_size) ||
+			    (*copy_size > (orig_obj->desc_size - in_offset))) {
+				ERROR("%s: Invalid mrd structure.\n", __func__);
+				return FFA_ERROR_INVALID_PARAMETER;
+			}
+
+			memcpy(dst, (uint8_t *)orig + in_offset, *copy_size);
+
+			return 0;
+		}
+
 		/* Get a new obj to store the v1.0 descriptor. */
 		v1_0_obj = spmc_shmem_obj_alloc(&spmc_shmem_obj_state,
 						*v1_0_desc_size);
@@ -1069,6 +1229,7 @@ static long spmc_ffa_fill_desc(struct mailbox *mbox,
 		}
 
 		obj->desc.handle = spmc_shmem_obj_state.next_handle++;
+		spmc_shmem_handle_set(&spmc_shmem_obj_state, obj);
 		obj->desc.flags |= mtd_flag;
 	}
 
@@ -1083,9 +1244,23 @@ static long spmc_ffa_fill_desc(struct mailbox *mbox,
 			 (uint32_t)obj->desc.sender_id << 16, 0, 0, 0);
 	}
 
-	/* The full descriptor has been received, perform any final checks. */
+	/*
+	 * The full descriptor has been received, perform any final checks.
+	 * Checking the descriptor itself does not need the other objects, so
+	 * release the state lock meanwhile for the operations on them. @obj
+	 * does not move until then. The check against the memory regions of
+	 * the other objects is done once the lock is held again, so that it
+	 * covers any object they have added meanwhile.
+	 */
+	obj->checking = true;
+	spmc_shmem_obj_state.checking++;
+	cohort_unlock(&spmc_shmem_obj_state.lock);
 
 	ret = spmc_shmem_check_obj(obj, ffa_version);
+
+	cohort_lock(&spmc_shmem_obj_state.lock);
+	spmc_shmem_obj_state.checking--;
+	obj->checking = false;
 	if (ret != 0) {
 		goto err_bad_desc;
 	}
@@ -1238,23 +1413,24 @@ long spmc_ffa_mem_send(uint32_t smc_fid,
 					     FFA_ERROR_INVALID_PARAMETER);
 	}
 
-	spin_lock(&spmc_shmem_obj_state.lock);
+	spin_lock(&mbox->lock);
+	cohort_lock(&spmc_shmem_obj_state.lock);
 	obj = spmc_shmem_obj_alloc(&spmc_shmem_obj_state, total_length);
 	if (obj == NULL) {
 		ret = FFA_ERROR_NO_MEMORY;
 		goto err_unlock;
 	}
 
-	spin_lock(&mbox->lock);
 	ret = spmc_ffa_fill_desc(mbox, obj, fragment_length, mtd_flag,
 				 ffa_version, handle);
-	spin_unlock(&mbox->lock);
 
-	spin_unlock(&spmc_shmem_obj_state.lock);
+	cohort_unlock(&spmc_shmem_obj_state.lock);
+	spin_unlock(&mbox->lock);
 	return ret;
 
 err_unlock:
-	spin_unlock(&spmc_shmem_obj_state.lock);
+	cohort_unlock(&spmc_shmem_obj_state.lock);
+	spin_unlock(&mbox->lock);
 	return spmc_ffa_error_return(handle, ret);
 }
 
@@ -1288,7 +1464,8 @@ long spmc_ffa_mem_frag_tx(uint32_t smc_fid,
 	struct spmc_shmem_obj *obj;
 	uint64_t mem_handle = handle_low | (((uint64_t)handle_high) << 32);
 
-	spin_lock(&spmc_shmem_obj_state.lock);
+	spin_lock(&mbox->lock);
+	cohort_lock(&spmc_shmem_obj_state.lock);
 
 	obj = spmc_shmem_obj_lookup(&spmc_shmem_obj_state, mem_handle);
 	if (obj == NULL) {
@@ -1313,16 +1490,16 @@ long spmc_ffa_mem_frag_tx(uint32_t smc_fid,
 		goto err_unlock;
 	}
 
-	spin_lock(&mbox->lock);
 	ret = spmc_ffa_fill_desc(mbox, obj, fragment_length, 0, ffa_version,
 				 handle);
-	spin_unlock(&mbox->lock);
 
-	spin_unlock(&spmc_shmem_obj_state.lock);
+	cohort_unlock(&spmc_shmem_obj_state.lock);
+	spin_unlock(&mbox->lock);
 	return ret;
 
 err_unlock:
-	spin_unlock(&spmc_shmem_obj_state.lock);
+	cohort_unlock(&spmc_shmem_obj_state.lock);
+	spin_unlock(&mbox->lock);
 	return spmc_ffa_error_return(handle, ret);
 }
 
@@ -1460,7 +1637,7 @@ spmc_ffa_mem_retrieve_req(uint32_t smc_fid,
 		goto err_unlock_mailbox;
 	}
 
-	spin_lock(&spmc_shmem_obj_state.lock);
+	cohort_lock(&spmc_shmem_obj_state.lock);
 
 	obj = spmc_shmem_obj_lookup(&spmc_shmem_obj_state, req->handle);
 	if (obj == NULL) {
@@ -1616,14 +1793,14 @@ spmc_ffa_mem_retrieve_req(uint32_t smc_fid,
 	/* Set the NS bit in the response if applicable. */
 	spmc_ffa_mem_retrieve_set_ns_bit(resp, sp_ctx);
 
-	spin_unlock(&spmc_shmem_obj_state.lock);
+	cohort_unlock(&spmc_shmem_obj_state.lock);
 	spin_unlock(&mbox->lock);
 
 	SMC_RET8(handle, FFA_MEM_RETRIEVE_RESP, out_desc_size,
 		 copy_size, 0, 0, 0, 0, 0);
 
 err_unlock_all:
-	spin_unlock(&spmc_shmem_obj_state.lock);
+	cohort_unlock(&spmc_shmem_obj_state.lock);
 err_unlock_mailbox:
 	spin_unlock(&mbox->lock);
 	return spmc_ffa_error_return(handle, ret);
@@ -1670,14 +1847,15 @@ long spmc_ffa_mem_frag_rx(uint32_t smc_fid,
 					     FFA_ERROR_INVALID_PARAMETER);
 	}
 
-	spin_lock(&spmc_shmem_obj_state.lock);
+	spin_lock(&mbox->lock);
+	cohort_lock(&spmc_shmem_obj_state.lock);
 
 	obj = spmc_shmem_obj_lookup(&spmc_shmem_obj_state, mem_handle);
 	if (obj == NULL) {
 		WARN("%s: invalid handle, 0x%lx, not a valid handle.\n",
 		     __func__, mem_handle);
 		ret = FFA_ERROR_INVALID_PARAMETER;
-		goto err_unlock_shmem;
+		goto err_unlock_all;
 	}
 
 	desc_sender_id = (uint32_t)obj->desc.sender_id << 16;
@@ -1685,18 +1863,16 @@ long spmc_ffa_mem_frag_rx(uint32_t smc_fid,
 		WARN("%s: invalid sender_id 0x%x != 0x%x\n", __func__,
 		     sender_id, desc_sender_id);
 		ret = FFA_ERROR_INVALID_PARAMETER;
-		goto err_unlock_shmem;
+		goto err_unlock_all;
 	}
 
 	if (fragment_offset >= obj->desc_size) {
 		WARN("%s: invalid fragment_offset 0x%x >= 0x%zx\n",
 		     __func__, fragment_offset, obj->desc_size);
 		ret = FFA_ERROR_INVALID_PARAMETER;
-		goto err_unlock_shmem;
+		goto err_unlock_all;
 	}
 
-	spin_lock(&mbox->lock);
-
 	if (mbox->rxtx_page_count == 0U) {
 		WARN("%s: buffer pair not registered.\n", __func__);
 		ret = FFA_ERROR_INVALID_PARAMETER;
@@ -1738,16 +1914,15 @@ long spmc_ffa_mem_frag_rx(uint32_t smc_fid,
 		memcpy(mbox->rx_buffer, src + fragment_offset, copy_size);
 	}
 
+	cohort_unlock(&spmc_shmem_obj_state.lock);
 	spin_unlock(&mbox->lock);
-	spin_unlock(&spmc_shmem_obj_state.lock);
 
 	SMC_RET8(handle, FFA_MEM_FRAG_TX, handle_low, handle_high,
 		 copy_size, sender_id, 0, 0, 0);
 
 err_unlock_all:
+	cohort_unlock(&spmc_shmem_obj_state.lock);
 	spin_unlock(&mbox->lock);
-err_unlock_shmem:
-	spin_unlock(&spmc_shmem_obj_state.lock);
 	return spmc_ffa_error_return(handle, ret);
 }
 
@@ -1806,7 +1981,7 @@ int spmc_ffa_mem_relinquish(uint32_t smc_fid,
 		goto err_unlock_mailbox;
 	}
 
-	spin_lock(&spmc_shmem_obj_state.lock);
+	cohort_lock(&spmc_shmem_obj_state.lock);
 
 	obj = spmc_shmem_obj_lookup(&spmc_shmem_obj_state, req->handle);
 	if (obj == NULL) {
@@ -1847,13 +2022,13 @@ int spmc_ffa_mem_relinquish(uint32_t smc_fid,
 	}
 	obj->in_use--;
 
-	spin_unlock(&spmc_shmem_obj_state.lock);
+	cohort_unlock(&spmc_shmem_obj_state.lock);
 	spin_unlock(&mbox->lock);
 
 	SMC_RET1(handle, FFA_SUCCESS_SMC32);
 
 err_unlock_all:
-	spin_unlock(&spmc_shmem_obj_state.lock);
+	cohort_unlock(&spmc_shmem_obj_state.lock);
 err_unlock_mailbox:
 	spin_unlock(&mbox->lock);
 	return spmc_ffa_error_return(handle, ret);
@@ -1898,7 +2073,7 @@ int spmc_ffa_mem_reclaim(uint32_t smc_fid,
 					     FFA_ERROR_INVALID_PARAMETER);
 	}
 
-	spin_lock(&spmc_shmem_obj_state.lock);
+	cohort_lock(&spmc_shmem_obj_state.lock);
 
 	obj = spmc_shmem_obj_lookup(&spmc_shmem_obj_state, mem_handle);
 	if (obj == NULL) {
@@ -1924,11 +2099,11 @@ int spmc_ffa_mem_reclaim(uint32_t smc_fid,
 	}
 
 	spmc_shmem_obj_free(&spmc_shmem_obj_state, obj);
-	spin_unlock(&spmc_shmem_obj_state.lock);
+	cohort_unlock(&spmc_shmem_obj_state.lock);
 
 	SMC_RET1(handle, FFA_SUCCESS_SMC32);
 
 err_unlock:
-	spin_unlock(&spmc_shmem_obj_state.lock);
+	cohort_unlock(&spmc_shmem_obj_state.lock);
 	return spmc_ffa_error_return(handle, ret);
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2022-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -7,8 +7,20 @@
 #ifndef SPMC_SHARED_MEM_H
 #define SPMC_SHARED_MEM_H
 
+#include <lib/cohort_lock.h>
 #include <services/el3_spmc_ffa_memory.h>
 
+#include <platform_def.h>
+
+/*
+ * Number of slots of the table used to find shared memory objects from their
+ * handle. Handles are allocated sequentially so up to this many live objects
+ * are found without walking the datastore.
+ */
+#ifndef SPMC_SHMEM_HANDLE_SLOTS
+#define SPMC_SHMEM_HANDLE_SLOTS		U(64)
+#endif
+
 /**
  * struct ffa_mem_relinquish_descriptor - Relinquish request descriptor.
  * @handle:
@@ -37,14 +49,21 @@ CASSERT(sizeof(struct ffa_mem_relinquish_descriptor) == 16,
  * @data_size:      The size allocated for the backing store.
  * @allocated:      Number of bytes allocated in @data.
  * @next_handle:    Handle used for next allocated object.
- * @lock:           Lock protecting all state in this file.
+ * @handle_slots:   Offset in @data plus one of the object last seen with a
+ *                  handle hashing to each slot, 0 if the slot is empty.
+ * @checking:       Number of objects whose descriptor is being checked without
+ *                  holding @lock. No object moves in @data until it is 0.
+ * @lock:           Lock protecting all state in this file. It is taken after
+ *                  the lock of the mailbox, if any.
  */
 struct spmc_shmem_obj_state {
 	uint8_t *data;
 	size_t data_size;
 	size_t allocated;
 	uint64_t next_handle;
-	spinlock_t lock;
+	size_t handle_slots[SPMC_SHMEM_HANDLE_SLOTS];
+	unsigned int checking;
+	cohort_lock_t lock;
 };
 
 extern struct spmc_shmem_obj_state spmc_shmem_obj_state;
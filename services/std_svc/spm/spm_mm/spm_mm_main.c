@@ -14,6 +14,9 @@
 #include <common/runtime_svc.h>
 #include <lib/el3_runtime/context_mgmt.h>
 #include <lib/el3_runtime/simd_ctx.h>
+#include <lib/pmf/pmf.h>
+#include <lib/psci/psci_lib.h>
+#include <lib/runtime_instr.h>
 #include <lib/smccc.h>
 #include <lib/spinlock.h>
 #include <lib/utils.h>
@@ -31,6 +34,14 @@
  ******************************************************************************/
 static sp_context_t sp_ctx;
 
+/*
+ * Whether the TLBs of a CPU are known to hold no stale secure EL1&0 entry. The
+ * translation tables of the SP only change through MM_SP_MEMORY_ATTRIBUTES_SET,
+ * which invalidates the TLBs of all the CPUs, so they only need invalidating on
+ * the first entry into the SP after the CPU powered up.
+ */
+static bool sp_tlb_clean[PLATFORM_CORE_COUNT];
+
 /*******************************************************************************
  * Set state of a Secure Partition context.
  ******************************************************************************/
@@ -100,9 +111,12 @@ static uint64_t spm_sp_synchronous_entry(sp_context_t *ctx)
 	cm_el1_sysregs_context_restore(SECURE);
 	cm_set_next_eret_context(SECURE);
 
-	/* Invalidate TLBs at EL1. */
-	tlbivmalle1();
-	dsbish();
+	/* Invalidate TLBs at EL1 unless the SP translations are still valid. */
+	if (!sp_tlb_clean[plat_my_core_pos()]) {
+		tlbivmalle1();
+		dsbish();
+		sp_tlb_clean[plat_my_core_pos()] = true;
+	}
 
 	/* Enter Secure Partition */
 	rc = spm_secure_partition_enter(&ctx->c_rt_ctx);
@@ -131,6 +145,24 @@ __dead2 static void spm_sp_synchronous_exit(uint64_t rc)
 	panic();
 }
 
+/*******************************************************************************
+ * The TLBs of a CPU coming out of a power down state may hold anything.
+ ******************************************************************************/
+static void spm_mm_cpu_on_finish(u_register_t unused)
+{
+	sp_tlb_clean[plat_my_core_pos()] = false;
+}
+
+static void spm_mm_cpu_suspend_finish(u_register_t max_off_pwrlvl)
+{
+	sp_tlb_clean[plat_my_core_pos()] = false;
+}
+
+static const spd_pm_ops_t spm_mm_pm = {
+	.svc_on_finish = spm_mm_cpu_on_finish,
+	.svc_suspend_finish = spm_mm_cpu_suspend_finish,
+};
+
 /*******************************************************************************
  * Jump to each Secure Partition for the first time.
  ******************************************************************************/
@@ -175,6 +207,9 @@ int32_t spm_mm_setup(void)
 
 	spm_sp_setup(ctx);
 
+	/* Register power management hooks with PSCI */
+	psci_register_spd_pm_hook(&spm_mm_pm);
+
 	/* Register init function for deferred init.  */
 	bl31_register_bl32_init(&spm_init);
 
@@ -237,6 +272,12 @@ static uint64_t mm_communicate(uint32_t smc_fid, uint64_t mm_cookie,
 {
 	uint64_t rc;
 
+#if ENABLE_RUNTIME_INSTRUMENTATION
+	PMF_CAPTURE_TIMESTAMP(rt_instr_svc,
+	    RT_INSTR_ENTER_MM_COMMUNICATE,
+	    PMF_NO_CACHE_MAINT);
+#endif
+
 	/* Cookie. Reserved for future use. It must be zero. */
 	if (mm_cookie != 0U) {
 		ERROR("MM_COMMUNICATE: cookie is not zero\n");
@@ -281,6 +322,12 @@ static uint64_t mm_communicate(uint32_t smc_fid, uint64_t mm_cookie,
 	 */
 	ehf_deactivate_priority(PLAT_SP_PRI);
 
+#if ENABLE_RUNTIME_INSTRUMENTATION
+	PMF_CAPTURE_TIMESTAMP(rt_instr_svc,
+	    RT_INSTR_EXIT_MM_COMMUNICATE,
+	    PMF_NO_CACHE_MAINT);
+#endif
+
 	SMC_RET1(handle, rc);
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2020-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -20,6 +20,9 @@
 #include <lib/el3_runtime/context_mgmt.h>
 #include <lib/fconf/fconf.h>
 #include <lib/fconf/fconf_dyn_cfg_getter.h>
+#include <lib/pmf/pmf.h>
+#include <lib/pmf/pmf_trace.h>
+#include <lib/runtime_instr.h>
 #include <lib/smccc.h>
 #include <lib/spinlock.h>
 #include <lib/utils.h>
@@ -387,6 +390,9 @@ static void spmd_do_sec_cpy(uintptr_t root_base_addr, uintptr_t sec_base_addr,
 	assert(sec_base_addr != 0UL);
 	assert(size != 0UL);
 
+	/* Map both regions with a single batch of table updates */
+	mmap_dynamic_batch_begin();
+
 	/* Map the memory with required attributes */
 	rc = spmd_dynamic_map_mem(root_base_addr, size, MT_RO_DATA | MT_ROOT,
 				  &root_base_addr_align,
@@ -405,9 +411,14 @@ static void spmd_do_sec_cpy(uintptr_t root_base_addr, uintptr_t sec_base_addr,
 		panic();
 	}
 
+	mmap_dynamic_batch_commit();
+
 	/* Do copy operation */
 	(void)memcpy((void *)sec_base_addr, (void *)root_base_addr, size);
 
+	/* Unmap both regions with a single TLB invalidation */
+	mmap_dynamic_batch_begin();
+
 	/* Unmap root memory region */
 	rc = mmap_remove_dynamic_region(root_base_addr_align,
 					root_mapped_size_align);
@@ -425,6 +436,8 @@ static void spmd_do_sec_cpy(uintptr_t root_base_addr, uintptr_t sec_base_addr,
 		      "secure region", sec_base_addr_align, rc);
 		panic();
 	}
+
+	mmap_dynamic_batch_commit();
 }
 #endif /* ENABLE_RME && SPMD_SPM_AT_SEL2 && !RESET_TO_BL31 */
 
@@ -669,19 +682,21 @@ int spmd_setup(void)
 /*******************************************************************************
  * Forward FF-A SMCs to the other security state.
  ******************************************************************************/
-uint64_t spmd_smc_switch_state(uint32_t smc_fid,
-			       bool secure_origin,
-			       uint64_t x1,
-			       uint64_t x2,
-			       uint64_t x3,
-			       uint64_t x4,
-			       void *handle,
-			       uint64_t flags)
+uint64_t __hot_runtime spmd_smc_switch_state(uint32_t smc_fid,
+					     bool secure_origin,
+					     uint64_t x1,
+					     uint64_t x2,
+					     uint64_t x3,
+					     uint64_t x4,
+					     void *handle,
+					     uint64_t flags)
 {
 	unsigned int secure_state_in = (secure_origin) ? SECURE : NON_SECURE;
 	unsigned int secure_state_out = (!secure_origin) ? SECURE : NON_SECURE;
 	void *ctx_out;
 
+	PMF_TRACE_EVENT(PMF_TRACE_WORLD_SWITCH, smc_fid, secure_state_out);
+
 #if SPMD_SPM_AT_SEL2
 	if ((secure_state_out == SECURE) && (is_sve_hint_set(flags) == true)) {
 		/*
@@ -692,6 +707,12 @@ uint64_t spmd_smc_switch_state(uint32_t smc_fid,
 	}
 #endif
 
+#if ENABLE_RUNTIME_INSTRUMENTATION
+	PMF_CAPTURE_TIMESTAMP(rt_instr_svc,
+	    RT_INSTR_ENTER_WORLD_SWITCH,
+	    PMF_NO_CACHE_MAINT);
+#endif
+
 	/* Save incoming security state */
 #if SPMD_SPM_AT_SEL2
 	cm_el2_sysregs_context_save(secure_state_in);
@@ -714,6 +735,12 @@ uint64_t spmd_smc_switch_state(uint32_t smc_fid,
 #endif
 	cm_set_next_eret_context(secure_state_out);
 
+#if ENABLE_RUNTIME_INSTRUMENTATION
+	PMF_CAPTURE_TIMESTAMP(rt_instr_svc,
+	    RT_INSTR_EXIT_WORLD_SWITCH,
+	    PMF_NO_CACHE_MAINT);
+#endif
+
 	ctx_out = cm_get_context(secure_state_out);
 #if SPMD_SPM_AT_SEL2
 	/*
@@ -842,14 +869,14 @@ uint64_t spmd_ffa_smc_handler(uint32_t smc_fid,
  * This function handles all SMCs in the range reserved for FFA. Each call is
  * either forwarded to the other security state or handled by the SPM dispatcher
  ******************************************************************************/
-uint64_t spmd_smc_handler(uint32_t smc_fid,
-			  uint64_t x1,
-			  uint64_t x2,
-			  uint64_t x3,
-			  uint64_t x4,
-			  void *cookie,
-			  void *handle,
-			  uint64_t flags)
+uint64_t __hot_runtime spmd_smc_handler(uint32_t smc_fid,
+					uint64_t x1,
+					uint64_t x2,
+					uint64_t x3,
+					uint64_t x4,
+					void *cookie,
+					void *handle,
+					uint64_t flags)
 {
 	spmd_spm_core_context_t *ctx = spmd_get_context();
 	bool secure_origin;
@@ -859,6 +886,8 @@ uint64_t spmd_smc_handler(uint32_t smc_fid,
 	/* Determine which security state this SMC originated from */
 	secure_origin = is_caller_secure(flags);
 
+	PMF_TRACE_EVENT(PMF_TRACE_FFA_CALL, smc_fid, secure_origin);
+
 	VERBOSE("SPM(%u): 0x%x 0x%" PRIx64 " 0x%" PRIx64 " 0x%" PRIx64 " 0x%" PRIx64
 		" 0x%" PRIx64 " 0x%" PRIx64 " 0x%" PRIx64 "\n",
 		    plat_my_core_pos(), smc_fid, x1, x2, x3, x4,
@@ -13,6 +13,7 @@
 #include <lib/pmf/pmf.h>
 #include <lib/psci/psci.h>
 #include <lib/runtime_instr.h>
+#include <lib/spinlock.h>
 #include <services/drtm_svc.h>
 #include <services/errata_abi_svc.h>
 #include <services/pci_svc.h>
@@ -35,6 +36,49 @@ static uuid_t arm_svc_uid = {
 	{0xc0, 0xfb, 0x56, 0x41, 0xf6, 0xe2}
 };
 
+#if STD_SVC_DEFERRED_INIT && (TRNG_SUPPORT || DRTM_SUPPORT)
+/*
+ * Services whose setup is not needed to boot are only set up on the first SMC
+ * they receive, on whichever CPU it is issued.
+ */
+#define STD_SVC_SETUP_PENDING	U(0)
+#define STD_SVC_SETUP_DONE	U(1)
+#define STD_SVC_SETUP_FAILED	U(2)
+
+static spinlock_t std_svc_setup_lock;
+
+#if TRNG_SUPPORT
+static unsigned int trng_setup_state;
+
+static int trng_deferred_setup(void)
+{
+	trng_setup();
+	return 0;
+}
+#endif /* TRNG_SUPPORT */
+
+#if DRTM_SUPPORT
+static unsigned int drtm_setup_state;
+#endif /* DRTM_SUPPORT */
+
+/* Run a deferred setup once, return true if the service is usable */
+static bool std_svc_deferred_setup(unsigned int *state, int (*setup)(void))
+{
+	if (__atomic_load_n(state, __ATOMIC_ACQUIRE) == STD_SVC_SETUP_PENDING) {
+		spin_lock(&std_svc_setup_lock);
+		if (*state == STD_SVC_SETUP_PENDING) {
+			__atomic_store_n(state, (setup() == 0) ?
+					 STD_SVC_SETUP_DONE :
+					 STD_SVC_SETUP_FAILED,
+					 __ATOMIC_RELEASE);
+		}
+		spin_unlock(&std_svc_setup_lock);
+	}
+
+	return *state == STD_SVC_SETUP_DONE;
+}
+#endif /* STD_SVC_DEFERRED_INIT && (TRNG_SUPPORT || DRTM_SUPPORT) */
+
 /* Setup Standard Services */
 static int32_t std_svc_setup(void)
 {
@@ -75,15 +119,18 @@ static int32_t std_svc_setup(void)
 	sdei_init();
 #endif
 
-#if TRNG_SUPPORT
+#if TRNG_SUPPORT && !STD_SVC_DEFERRED_INIT
 	/* TRNG initialisation */
 	trng_setup();
-#endif /* TRNG_SUPPORT */
+#endif /* TRNG_SUPPORT && !STD_SVC_DEFERRED_INIT */
 
 #if DRTM_SUPPORT
+	drtm_record_boot_pe();
+#if !STD_SVC_DEFERRED_INIT
 	if (drtm_setup() != 0) {
 		ret = 1;
 	}
+#endif
 #endif /* DRTM_SUPPORT */
 
 	return ret;
@@ -93,14 +140,14 @@ static int32_t std_svc_setup(void)
  * Top-level Standard Service SMC handler. This handler will in turn dispatch
  * calls to PSCI SMC handler
  */
-static uintptr_t std_svc_smc_handler(uint32_t smc_fid,
-			     u_register_t x1,
-			     u_register_t x2,
-			     u_register_t x3,
-			     u_register_t x4,
-			     void *cookie,
-			     void *handle,
-			     u_register_t flags)
+static uintptr_t __hot_runtime std_svc_smc_handler(uint32_t smc_fid,
+						   u_register_t x1,
+						   u_register_t x2,
+						   u_register_t x3,
+						   u_register_t x4,
+						   void *cookie,
+						   void *handle,
+						   u_register_t flags)
 {
 	if (((smc_fid >> FUNCID_CC_SHIFT) & FUNCID_CC_MASK) == SMC_32) {
 		/* 32-bit SMC function, clear top parameter bits */
@@ -173,6 +220,12 @@ static uintptr_t std_svc_smc_handler(uint32_t smc_fid,
 
 #if TRNG_SUPPORT
 	if (is_trng_fid(smc_fid)) {
+#if STD_SVC_DEFERRED_INIT
+		if (!std_svc_deferred_setup(&trng_setup_state,
+					    trng_deferred_setup)) {
+			SMC_RET1(handle, SMC_UNK);
+		}
+#endif
 		return trng_smc_handler(smc_fid, x1, x2, x3, x4, cookie, handle,
 				flags);
 	}
@@ -207,6 +260,11 @@ static uintptr_t std_svc_smc_handler(uint32_t smc_fid,
 
 #if DRTM_SUPPORT
 	if (is_drtm_fid(smc_fid)) {
+#if STD_SVC_DEFERRED_INIT
+		if (!std_svc_deferred_setup(&drtm_setup_state, drtm_setup)) {
+			SMC_RET1(handle, SMC_UNK);
+		}
+#endif
 		return drtm_smc_handler(smc_fid, x1, x2, x3, x4, cookie, handle,
 					flags);
 	}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2022, ARM Limited. All rights reserved.
+ * Copyright (c) 2021-2026, ARM Limited. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -7,55 +7,108 @@
 #include <assert.h>
 #include <stdbool.h>
 #include <stdint.h>
-#include <lib/spinlock.h>
+#include <bl31/deferred_work.h>
+#include <lib/cassert.h>
+#include <lib/cohort_lock.h>
 #include <plat/common/plat_trng.h>
+#include <plat/common/platform.h>
+
+#include <platform_def.h>
 
 /*
  * # Entropy pool
  * Note that the TRNG Firmware interface can request up to 192 bits of entropy
- * in a single call or three 64bit words per call. We have 4 words in the pool
- * so that when we have 1-63 bits in the pool, and we have a request for
- * 192 bits of entropy, we don't have to throw out the leftover 1-63 bits of
+ * in a single call or three 64bit words per call. We have at least 4 words in
+ * the pool so that when we have 1-63 bits in the pool, and we have a request
+ * for 192 bits of entropy, we don't have to throw out the leftover 1-63 bits of
  * entropy.
+ *
+ * Each CPU has its own pool, which only it accesses, so that CPUs requesting
+ * entropy at the same time do not wait for each other. Only the calls to the
+ * entropy source are serialised. A platform may make the pools larger so that
+ * each call to the source fills the pool for several requests.
  */
-#define WORDS_IN_POOL	(4)
-static uint64_t entropy[WORDS_IN_POOL];
-/* index in bits of the first bit of usable entropy */
-static uint32_t entropy_bit_index;
-/* then number of valid bits in the entropy pool */
-static uint32_t entropy_bit_size;
+#ifndef PLAT_TRNG_ENTROPY_POOL_WORDS
+#define PLAT_TRNG_ENTROPY_POOL_WORDS	U(4)
+#endif
+
+CASSERT(PLAT_TRNG_ENTROPY_POOL_WORDS >= 4U, assert_trng_entropy_pool_words);
+
+#define WORDS_IN_POOL	PLAT_TRNG_ENTROPY_POOL_WORDS
+
+typedef struct trng_pool {
+	uint64_t entropy[WORDS_IN_POOL];
+	/* index in bits of the first bit of usable entropy */
+	uint32_t bit_index;
+	/* then number of valid bits in the entropy pool */
+	uint32_t bit_size;
+} __aligned(CACHE_WRITEBACK_GRANULE) trng_pool_t;
+
+static trng_pool_t trng_pools[PLATFORM_CORE_COUNT];
 
-static spinlock_t trng_pool_lock;
+/* Serialises the calls to plat_get_entropy() */
+static cohort_lock_t trng_source_lock;
 
-#define BITS_PER_WORD		(sizeof(entropy[0]) * 8)
+#define BITS_PER_WORD		(sizeof(uint64_t) * 8)
 #define BITS_IN_POOL		(WORDS_IN_POOL * BITS_PER_WORD)
-#define ENTROPY_MIN_WORD	(entropy_bit_index / BITS_PER_WORD)
-#define ENTROPY_FREE_BIT	(entropy_bit_size + entropy_bit_index)
-#define _ENTROPY_FREE_WORD	(ENTROPY_FREE_BIT / BITS_PER_WORD)
-#define ENTROPY_FREE_INDEX	(_ENTROPY_FREE_WORD % WORDS_IN_POOL)
+#define ENTROPY_MIN_WORD(p)	((p)->bit_index / BITS_PER_WORD)
+#define ENTROPY_FREE_BIT(p)	((p)->bit_size + (p)->bit_index)
+#define _ENTROPY_FREE_WORD(p)	(ENTROPY_FREE_BIT(p) / BITS_PER_WORD)
+#define ENTROPY_FREE_INDEX(p)	(_ENTROPY_FREE_WORD(p) % WORDS_IN_POOL)
 /* ENTROPY_WORD_INDEX(0) includes leftover bits in the lower bits */
-#define ENTROPY_WORD_INDEX(i)	((ENTROPY_MIN_WORD + i) % WORDS_IN_POOL)
+#define ENTROPY_WORD_INDEX(p, i)	((ENTROPY_MIN_WORD(p) + i) % WORDS_IN_POOL)
 
 /*
- * Fill the entropy pool until we have at least as many bits as requested.
+ * Fill the entropy pool until we have at least as many bits as requested, and
+ * then top it up with as many whole words as it can take.
  * Returns true after filling the pool, and false if the entropy source is out
  * of entropy and the pool could not be filled.
- * Assumes locks are taken.
  */
-static bool trng_fill_entropy(uint32_t nbits)
+static bool trng_fill_entropy(trng_pool_t *pool, uint32_t nbits)
 {
-	while (nbits > entropy_bit_size) {
-		bool valid = plat_get_entropy(&entropy[ENTROPY_FREE_INDEX]);
+	bool ret = true;
+
+	cohort_lock(&trng_source_lock);
+
+	while (nbits > pool->bit_size) {
+		bool valid = plat_get_entropy(
+				&pool->entropy[ENTROPY_FREE_INDEX(pool)]);
 
 		if (valid) {
-			entropy_bit_size += BITS_PER_WORD;
-			assert(entropy_bit_size <= BITS_IN_POOL);
+			pool->bit_size += BITS_PER_WORD;
+			assert(pool->bit_size <= BITS_IN_POOL);
 		} else {
-			return false;
+			ret = false;
+			break;
 		}
 	}
-	return true;
+
+	/*
+	 * The word holding the leftover bits, if any, is only partly free and
+	 * can not be refilled.
+	 */
+	while (ret &&
+	       ((pool->bit_size + BITS_PER_WORD +
+		 (pool->bit_index % BITS_PER_WORD)) <= BITS_IN_POOL)) {
+		if (!plat_get_entropy(
+				&pool->entropy[ENTROPY_FREE_INDEX(pool)])) {
+			break;
+		}
+		pool->bit_size += BITS_PER_WORD;
+	}
+
+	cohort_unlock(&trng_source_lock);
+
+	return ret;
+}
+
+#if DEFERRED_WORK
+/* Top up the pool of the current CPU once it is idle */
+static void trng_refill_work(void *arg)
+{
+	(void)trng_fill_entropy(arg, 0U);
 }
+#endif
 
 /*
  * Pack entropy into the out buffer, filling and taking locks as needed.
@@ -65,16 +118,14 @@ static bool trng_fill_entropy(uint32_t nbits)
  */
 bool trng_pack_entropy(uint32_t nbits, uint64_t *out)
 {
-	bool ret = true;
+	trng_pool_t *pool = &trng_pools[plat_my_core_pos()];
 	uint32_t bits_to_discard = nbits;
-	spin_lock(&trng_pool_lock);
 
-	if (!trng_fill_entropy(nbits)) {
-		ret = false;
-		goto out;
+	if ((nbits > pool->bit_size) && !trng_fill_entropy(pool, nbits)) {
+		return false;
 	}
 
-	const unsigned int rshift = entropy_bit_index % BITS_PER_WORD;
+	const unsigned int rshift = pool->bit_index % BITS_PER_WORD;
 	const unsigned int lshift = BITS_PER_WORD - rshift;
 	const int to_fill = ((nbits + BITS_PER_WORD - 1) / BITS_PER_WORD);
 	int word_i;
@@ -111,7 +162,7 @@ bool trng_pack_entropy(uint32_t nbits, uint64_t *out)
 		 *                   5 4 3 2 1 0 7 6
 		 *                  [e,e,e,e,e,e,e,e]
 		 */
-		out[word_i] |= entropy[ENTROPY_WORD_INDEX(word_i)] >> rshift;
+		out[word_i] |= pool->entropy[ENTROPY_WORD_INDEX(pool, word_i)] >> rshift;
 
 		/**
 		 * Discarding the used/packed entropy bits from the respective
@@ -156,7 +207,7 @@ bool trng_pack_entropy(uint32_t nbits, uint64_t *out)
 		 * amount of bits only.
 		 */
 		if (bits_to_discard < (BITS_PER_WORD - rshift)) {
-			entropy[ENTROPY_WORD_INDEX(word_i)] &=
+			pool->entropy[ENTROPY_WORD_INDEX(pool, word_i)] &=
 			(~0ULL << ((bits_to_discard+rshift) % BITS_PER_WORD));
 			bits_to_discard = 0;
 		} else {
@@ -167,7 +218,7 @@ bool trng_pack_entropy(uint32_t nbits, uint64_t *out)
 		 * will be already zeros from previous operations, and the
 		 * bits_to_discard is updated precisely.
 		 */
-			entropy[ENTROPY_WORD_INDEX(word_i)] = 0;
+			pool->entropy[ENTROPY_WORD_INDEX(pool, word_i)] = 0;
 			bits_to_discard -= (BITS_PER_WORD - rshift);
 		}
 
@@ -178,7 +229,7 @@ bool trng_pack_entropy(uint32_t nbits, uint64_t *out)
 		 * the `|=` operation.
 		 */
 		if (lshift != BITS_PER_WORD) {
-			out[word_i] |= entropy[ENTROPY_WORD_INDEX(word_i + 1)]
+			out[word_i] |= pool->entropy[ENTROPY_WORD_INDEX(pool, word_i + 1)]
 				<< lshift;
 			/**
 			 * Discarding the remaining packed bits from upperword
@@ -191,7 +242,7 @@ bool trng_pack_entropy(uint32_t nbits, uint64_t *out)
 			 * amount of bits only.
 			 */
 			if (bits_to_discard < (BITS_PER_WORD - lshift)) {
-				entropy[ENTROPY_WORD_INDEX(word_i+1)]  &=
+				pool->entropy[ENTROPY_WORD_INDEX(pool, word_i+1)]  &=
 				(~0ULL << ((bits_to_discard) % BITS_PER_WORD));
 				bits_to_discard = 0;
 			} else {
@@ -204,7 +255,7 @@ bool trng_pack_entropy(uint32_t nbits, uint64_t *out)
 			 * there are still some unused valid entropy bits at the
 			 * upper end for future use.
 			 */
-				entropy[ENTROPY_WORD_INDEX(word_i+1)]  &=
+				pool->entropy[ENTROPY_WORD_INDEX(pool, word_i+1)]  &=
 				(~0ULL << ((BITS_PER_WORD - lshift) % BITS_PER_WORD));
 				bits_to_discard -= (BITS_PER_WORD - lshift);
 		}
@@ -215,22 +266,31 @@ bool trng_pack_entropy(uint32_t nbits, uint64_t *out)
 
 	out[to_fill - 1] &= mask;
 
-	entropy_bit_index = (entropy_bit_index + nbits) % BITS_IN_POOL;
-	entropy_bit_size -= nbits;
+	pool->bit_index = (pool->bit_index + nbits) % BITS_IN_POOL;
+	pool->bit_size -= nbits;
 
-out:
-	spin_unlock(&trng_pool_lock);
+#if DEFERRED_WORK
+	/*
+	 * Refill the pool outside of the SMC so that the next request is
+	 * served without calling the entropy source.
+	 */
+	if (pool->bit_size < (BITS_IN_POOL / 2U)) {
+		(void)deferred_work_queue(trng_refill_work, pool);
+	}
+#endif
 
-	return ret;
+	return true;
 }
 
 void trng_entropy_pool_setup(void)
 {
-	int i;
+	unsigned int cpu, i;
 
-	for (i = 0; i < WORDS_IN_POOL; i++) {
-		entropy[i] = 0;
+	for (cpu = 0U; cpu < PLATFORM_CORE_COUNT; cpu++) {
+		for (i = 0U; i < WORDS_IN_POOL; i++) {
+			trng_pools[cpu].entropy[i] = 0;
+		}
+		trng_pools[cpu].bit_index = 0;
+		trng_pools[cpu].bit_size = 0;
 	}
-	entropy_bit_index = 0;
-	entropy_bit_size = 0;
 }
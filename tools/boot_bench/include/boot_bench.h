@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef BOOT_BENCH_H
+#define BOOT_BENCH_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <drivers/io/io_storage.h>
+
+/* Image known to the fake platform, loaded from the FIP */
+typedef struct bench_image_s {
+	unsigned int id;
+	const char *name;
+	io_uuid_spec_t spec;
+} bench_image_t;
+
+/* Time spent on an image, accumulated over all the boots */
+typedef struct bench_stats_s {
+	unsigned int loads;
+	uint64_t bytes;
+	uint64_t read_ns;
+	uint64_t hash_ns;
+	uint64_t sig_ns;
+	uint64_t auth_ns;
+} bench_stats_t;
+
+/* Fake platform */
+int bench_io_setup(const char *path, size_t offset, size_t length,
+		   size_t block_size);
+int bench_set_rotpk(const char *path);
+const bench_image_t *bench_get_image(unsigned int image_id);
+int bench_image_present(unsigned int image_id);
+
+/* Timing */
+void bench_set_current_image(unsigned int image_id);
+uint64_t bench_now_ns(void);
+
+#endif /* BOOT_BENCH_H */
@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef HOST_COMPAT_H
+#define HOST_COMPAT_H
+
+/*
+ * Included ahead of every file of the tool. The firmware sources are built
+ * against the C library of the host, which lacks the few definitions the
+ * firmware C library adds.
+ */
+#include <errno.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef long register_t;
+typedef unsigned long u_register_t;
+
+#ifndef EAUTH
+#define EAUTH		80	/* Authentication error */
+#endif
+
+#endif /* HOST_COMPAT_H */
@@ -0,0 +1,21 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef IO_HOST_H
+#define IO_HOST_H
+
+#include <stddef.h>
+
+#include <drivers/io/io_block.h>
+
+struct io_dev_connector;
+
+int register_io_dev_host_file(const struct io_dev_connector **dev_con);
+int host_block_ops_init(const char *path, size_t block_size,
+			io_block_ops_t *ops, size_t *dev_size);
+size_t host_file_get_size(void);
+
+#endif /* IO_HOST_H */
@@ -0,0 +1,30 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef PLATFORM_DEF_H
+#define PLATFORM_DEF_H
+
+#include <lib/utils_def.h>
+
+/* Platform definitions of the fake platform the firmware modules run on */
+
+/* The FIP, its backend device and the block device */
+#define MAX_IO_DEVICES			U(3)
+#define MAX_IO_HANDLES			U(4)
+#define MAX_IO_BLOCK_DEVICES		U(1)
+
+#define PLATFORM_CORE_COUNT		U(1)
+#define PLAT_MAX_PWR_LVL		U(1)
+#define PLAT_MAX_RET_STATE		U(1)
+#define PLAT_MAX_OFF_STATE		U(2)
+
+#define CACHE_WRITEBACK_GRANULE		U(64)
+
+/* Not used for loading but needed by the firmware headers */
+#define NR_OF_FW_BANKS			U(1)
+#define NR_OF_IMAGES_IN_FW_BANK		U(1)
+
+#endif /* PLATFORM_DEF_H */
@@ -0,0 +1,289 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <arch_helpers.h>
+#include <common/debug.h>
+#include <common/tbbr/tbbr_img_def.h>
+#include <drivers/io/io_block.h>
+#include <drivers/io/io_driver.h>
+#include <drivers/io/io_fip.h>
+#include <drivers/io/io_storage.h>
+#include <lib/utils.h>
+#include <plat/common/platform.h>
+#include <tools_share/firmware_image_package.h>
+
+#include "boot_bench.h"
+#include "io_host.h"
+
+/*
+ * Fake platform layer: the image policies of a typical platform loading
+ * everything from a FIP, the trusted boot hooks and the few architectural
+ * helpers the modules use, implemented for the host.
+ */
+static const bench_image_t bench_images[] = {
+	{ HW_CONFIG_ID, "hw-config", {UUID_HW_CONFIG} },
+	{ SCP_BL2_IMAGE_ID, "scp-fw", {UUID_SCP_FIRMWARE_SCP_BL2} },
+	{ BL31_IMAGE_ID, "soc-fw", {UUID_EL3_RUNTIME_FIRMWARE_BL31} },
+	{ SOC_FW_CONFIG_ID, "soc-fw-config", {UUID_SOC_FW_CONFIG} },
+	{ BL32_IMAGE_ID, "tos-fw", {UUID_SECURE_PAYLOAD_BL32} },
+	{ BL32_EXTRA1_IMAGE_ID, "tos-fw-extra1",
+	  {UUID_SECURE_PAYLOAD_BL32_EXTRA1} },
+	{ BL32_EXTRA2_IMAGE_ID, "tos-fw-extra2",
+	  {UUID_SECURE_PAYLOAD_BL32_EXTRA2} },
+	{ TOS_FW_CONFIG_ID, "tos-fw-config", {UUID_TOS_FW_CONFIG} },
+	{ BL33_IMAGE_ID, "nt-fw", {UUID_NON_TRUSTED_FIRMWARE_BL33} },
+	{ NT_FW_CONFIG_ID, "nt-fw-config", {UUID_NT_FW_CONFIG} },
+#if TRUSTED_BOARD_BOOT
+	{ TRUSTED_BOOT_FW_CERT_ID, "tb-fw-cert", {UUID_TRUSTED_BOOT_FW_CERT} },
+	{ TRUSTED_KEY_CERT_ID, "trusted-key-cert", {UUID_TRUSTED_KEY_CERT} },
+	{ SCP_FW_KEY_CERT_ID, "scp-fw-key-cert", {UUID_SCP_FW_KEY_CERT} },
+	{ SOC_FW_KEY_CERT_ID, "soc-fw-key-cert", {UUID_SOC_FW_KEY_CERT} },
+	{ TRUSTED_OS_FW_KEY_CERT_ID, "tos-fw-key-cert",
+	  {UUID_TRUSTED_OS_FW_KEY_CERT} },
+	{ NON_TRUSTED_FW_KEY_CERT_ID, "nt-fw-key-cert",
+	  {UUID_NON_TRUSTED_FW_KEY_CERT} },
+	{ SCP_FW_CONTENT_CERT_ID, "scp-fw-cert", {UUID_SCP_FW_CONTENT_CERT} },
+	{ SOC_FW_CONTENT_CERT_ID, "soc-fw-cert", {UUID_SOC_FW_CONTENT_CERT} },
+	{ TRUSTED_OS_FW_CONTENT_CERT_ID, "tos-fw-cert",
+	  {UUID_TRUSTED_OS_FW_CONTENT_CERT} },
+	{ NON_TRUSTED_FW_CONTENT_CERT_ID, "nt-fw-cert",
+	  {UUID_NON_TRUSTED_FW_CONTENT_CERT} },
+#endif /* TRUSTED_BOARD_BOOT */
+};
+
+static const io_dev_connector_t *fip_dev_con;
+static uintptr_t fip_dev_handle;
+static const io_dev_connector_t *backend_dev_con;
+static uintptr_t backend_dev_handle;
+
+static io_block_spec_t fip_block_spec;
+static io_block_dev_spec_t block_dev_spec;
+
+static unsigned char *rotpk;
+static unsigned int rotpk_len;
+
+const struct plat_try_images_ops *plat_try_img_ops;
+
+const bench_image_t *bench_get_image(unsigned int image_id)
+{
+	unsigned int i;
+
+	for (i = 0U; i < ARRAY_SIZE(bench_images); i++) {
+		if (bench_images[i].id == image_id) {
+			return &bench_images[i];
+		}
+	}
+
+	return NULL;
+}
+
+/*
+ * Set up the FIP device on top of the host file, either directly or through
+ * io_block when 'block_size' is not zero.
+ */
+int bench_io_setup(const char *path, size_t offset, size_t length,
+		   size_t block_size)
+{
+	size_t dev_size;
+	void *buf;
+	int result;
+
+	result = register_io_dev_fip(&fip_dev_con);
+	if (result != 0) {
+		return result;
+	}
+
+	result = io_dev_open(fip_dev_con, (uintptr_t)NULL, &fip_dev_handle);
+	if (result != 0) {
+		return result;
+	}
+
+	if (block_size == 0U) {
+		result = register_io_dev_host_file(&backend_dev_con);
+		if (result == 0) {
+			result = io_dev_open(backend_dev_con, (uintptr_t)path,
+					     &backend_dev_handle);
+		}
+		dev_size = host_file_get_size();
+	} else {
+		result = host_block_ops_init(path, block_size,
+					     &block_dev_spec.ops, &dev_size);
+		if (result != 0) {
+			return result;
+		}
+
+		if (posix_memalign(&buf, block_size, block_size) != 0) {
+			return -ENOMEM;
+		}
+		block_dev_spec.buffer.offset = (uintptr_t)buf;
+		block_dev_spec.buffer.length = block_size;
+		block_dev_spec.block_size = block_size;
+		block_dev_spec.max_direct_read = dev_size;
+
+		result = register_io_dev_block(&backend_dev_con);
+		if (result == 0) {
+			result = io_dev_open(backend_dev_con,
+					     (uintptr_t)&block_dev_spec,
+					     &backend_dev_handle);
+		}
+	}
+	if (result != 0) {
+		return result;
+	}
+
+	if (offset > dev_size) {
+		return -EINVAL;
+	}
+
+	fip_block_spec.offset = offset;
+	fip_block_spec.length = (length != 0U) ? length : (dev_size - offset);
+
+	/* io_block works on whole blocks, the last one is padded with zeroes */
+	if (block_size != 0U) {
+		if ((offset % block_size) != 0U) {
+			return -EINVAL;
+		}
+		fip_block_spec.length = round_up(fip_block_spec.length,
+						 block_size);
+	}
+
+	return io_dev_init(fip_dev_handle, (uintptr_t)FIP_IMAGE_ID);
+}
+
+/* Tell whether the FIP has an entry for the image */
+int bench_image_present(unsigned int image_id)
+{
+	const bench_image_t *image = bench_get_image(image_id);
+	uintptr_t handle;
+
+	if ((image == NULL) ||
+	    (io_open(fip_dev_handle, (uintptr_t)&image->spec, &handle) != 0)) {
+		return 0;
+	}
+	io_close(handle);
+
+	return 1;
+}
+
+int plat_get_image_source(unsigned int image_id, uintptr_t *dev_handle,
+			  uintptr_t *image_spec)
+{
+	const bench_image_t *image;
+
+	if (image_id == FIP_IMAGE_ID) {
+		*dev_handle = backend_dev_handle;
+		*image_spec = (uintptr_t)&fip_block_spec;
+		return 0;
+	}
+
+	image = bench_get_image(image_id);
+	if (image == NULL) {
+		return -ENOENT;
+	}
+
+	bench_set_current_image(image_id);
+
+	*dev_handle = fip_dev_handle;
+	*image_spec = (uintptr_t)&image->spec;
+
+	/* Each image is requested from the FIP device afresh, as on hardware */
+	return io_dev_init(fip_dev_handle, (uintptr_t)FIP_IMAGE_ID);
+}
+
+/* Read the DER public key the root certificates must be signed with */
+int bench_set_rotpk(const char *path)
+{
+	FILE *fp;
+	long len;
+
+	fp = fopen(path, "rb");
+	if (fp == NULL) {
+		return -ENOENT;
+	}
+
+	if ((fseek(fp, 0L, SEEK_END) != 0) || ((len = ftell(fp)) <= 0) ||
+	    (fseek(fp, 0L, SEEK_SET) != 0)) {
+		fclose(fp);
+		return -EIO;
+	}
+
+	rotpk = malloc((size_t)len);
+	if ((rotpk == NULL) || (fread(rotpk, 1, (size_t)len, fp) != (size_t)len)) {
+		fclose(fp);
+		return -EIO;
+	}
+	rotpk_len = (unsigned int)len;
+
+	fclose(fp);
+
+	return 0;
+}
+
+int plat_get_rotpk_info(void *cookie, void **key_ptr, unsigned int *key_len,
+			unsigned int *flags)
+{
+	if (rotpk == NULL) {
+		*key_ptr = NULL;
+		*key_len = 0U;
+		*flags = ROTPK_NOT_DEPLOYED;
+		return 0;
+	}
+
+	*key_ptr = rotpk;
+	*key_len = rotpk_len;
+	*flags = 0U;
+
+	return 0;
+}
+
+/* The counters are not checked against anything persistent */
+int plat_get_nv_ctr(void *cookie, unsigned int *nv_ctr)
+{
+	*nv_ctr = 0U;
+
+	return 0;
+}
+
+int plat_set_nv_ctr(void *cookie, unsigned int nv_ctr)
+{
+	return 0;
+}
+
+int plat_get_mbedtls_heap(void **heap_addr, size_t *heap_size)
+{
+	return get_mbedtls_heap_helper(heap_addr, heap_size);
+}
+
+/* Architectural helpers, the host needs no cache maintenance */
+void flush_dcache_range(uintptr_t addr, size_t size)
+{
+}
+
+void zeromem(void *mem, u_register_t length)
+{
+	memset(mem, 0, length);
+}
+
+void zero_normalmem(void *mem, u_register_t length)
+{
+	memset(mem, 0, length);
+}
+
+void console_flush(void)
+{
+	(void)fflush(stdout);
+}
+
+void el3_panic(void)
+{
+	abort();
+}
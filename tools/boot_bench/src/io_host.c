@@ -0,0 +1,278 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <assert.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <drivers/io/io_driver.h>
+#include <drivers/io/io_storage.h>
+
+#include "io_host.h"
+
+/*
+ * Host file device. The device is opened with the path of the file as its
+ * device specification and files on it are regions of the file described by
+ * an io_block_spec_t, as on a memory-mapped device. Reads go through pread()
+ * so that they cost what reading the storage costs on the host.
+ */
+#define HOST_FILE_MAX_OPEN	4
+
+typedef struct {
+	int in_use;
+	unsigned long long base;
+	unsigned long long file_pos;
+	unsigned long long size;
+} host_file_state_t;
+
+static int host_fd = -1;
+static unsigned long long host_file_size;
+static host_file_state_t host_files[HOST_FILE_MAX_OPEN];
+
+static io_type_t device_type_host(void)
+{
+	return IO_TYPE_MEMMAP;
+}
+
+static int host_dev_open(const uintptr_t dev_spec, io_dev_info_t **dev_info);
+static int host_file_open(io_dev_info_t *dev_info, const uintptr_t spec,
+			  io_entity_t *entity);
+static int host_file_seek(io_entity_t *entity, int mode,
+			  signed long long offset);
+static int host_file_len(io_entity_t *entity, size_t *length);
+static int host_file_read(io_entity_t *entity, uintptr_t buffer,
+			  size_t length, size_t *length_read);
+static int host_file_close(io_entity_t *entity);
+static int host_dev_close(io_dev_info_t *dev_info);
+
+static const io_dev_connector_t host_dev_connector = {
+	.dev_open = host_dev_open
+};
+
+static const io_dev_funcs_t host_dev_funcs = {
+	.type = device_type_host,
+	.open = host_file_open,
+	.seek = host_file_seek,
+	.size = host_file_len,
+	.read = host_file_read,
+	.write = NULL,
+	.close = host_file_close,
+	.dev_init = NULL,
+	.dev_close = host_dev_close,
+};
+
+static io_dev_info_t host_dev_info = {
+	.funcs = &host_dev_funcs,
+	.info = (uintptr_t)NULL
+};
+
+/* Open the backing file, shared by the file device and the block device */
+static int host_backing_open(const char *path)
+{
+	struct stat st;
+
+	if (host_fd >= 0) {
+		return 0;
+	}
+
+	host_fd = open(path, O_RDONLY);
+	if (host_fd < 0) {
+		return -ENOENT;
+	}
+
+	if (fstat(host_fd, &st) != 0) {
+		close(host_fd);
+		host_fd = -1;
+		return -EIO;
+	}
+	host_file_size = (unsigned long long)st.st_size;
+
+	return 0;
+}
+
+static int host_dev_open(const uintptr_t dev_spec, io_dev_info_t **dev_info)
+{
+	int result;
+
+	assert(dev_info != NULL);
+
+	result = host_backing_open((const char *)dev_spec);
+	if (result == 0) {
+		*dev_info = &host_dev_info;
+	}
+
+	return result;
+}
+
+static int host_dev_close(io_dev_info_t *dev_info)
+{
+	return 0;
+}
+
+static int host_file_open(io_dev_info_t *dev_info, const uintptr_t spec,
+			  io_entity_t *entity)
+{
+	const io_block_spec_t *block_spec = (io_block_spec_t *)spec;
+	unsigned int i;
+
+	assert(block_spec != NULL);
+	assert(entity != NULL);
+
+	if ((block_spec->offset > host_file_size) ||
+	    (block_spec->length > (host_file_size - block_spec->offset))) {
+		return -ENOENT;
+	}
+
+	for (i = 0U; i < HOST_FILE_MAX_OPEN; i++) {
+		if (host_files[i].in_use == 0) {
+			host_files[i].in_use = 1;
+			host_files[i].base = block_spec->offset;
+			host_files[i].file_pos = 0U;
+			host_files[i].size = block_spec->length;
+			entity->info = (uintptr_t)&host_files[i];
+			return 0;
+		}
+	}
+
+	return -ENOMEM;
+}
+
+static int host_file_seek(io_entity_t *entity, int mode,
+			  signed long long offset)
+{
+	host_file_state_t *fp;
+
+	assert(entity != NULL);
+
+	if (mode != IO_SEEK_SET) {
+		return -ENOENT;
+	}
+
+	fp = (host_file_state_t *)entity->info;
+	if ((offset < 0) || ((unsigned long long)offset > fp->size)) {
+		return -EINVAL;
+	}
+
+	fp->file_pos = (unsigned long long)offset;
+
+	return 0;
+}
+
+static int host_file_len(io_entity_t *entity, size_t *length)
+{
+	assert(entity != NULL);
+	assert(length != NULL);
+
+	*length = (size_t)((host_file_state_t *)entity->info)->size;
+
+	return 0;
+}
+
+static int host_file_read(io_entity_t *entity, uintptr_t buffer,
+			  size_t length, size_t *length_read)
+{
+	host_file_state_t *fp;
+	ssize_t n;
+
+	assert(entity != NULL);
+	assert(length_read != NULL);
+
+	fp = (host_file_state_t *)entity->info;
+	if (length > (fp->size - fp->file_pos)) {
+		return -EINVAL;
+	}
+
+	*length_read = 0U;
+	while (*length_read < length) {
+		n = pread(host_fd, (void *)(buffer + *length_read),
+			  length - *length_read,
+			  (off_t)(fp->base + fp->file_pos + *length_read));
+		if (n <= 0) {
+			return -EIO;
+		}
+		*length_read += (size_t)n;
+	}
+
+	fp->file_pos += length;
+
+	return 0;
+}
+
+static int host_file_close(io_entity_t *entity)
+{
+	assert(entity != NULL);
+
+	memset((void *)entity->info, 0, sizeof(host_file_state_t));
+	entity->info = 0;
+
+	return 0;
+}
+
+int register_io_dev_host_file(const io_dev_connector_t **dev_con)
+{
+	int result;
+
+	assert(dev_con != NULL);
+
+	result = io_register_device(&host_dev_info);
+	if (result == 0) {
+		*dev_con = &host_dev_connector;
+	}
+
+	return result;
+}
+
+/*
+ * Block device operations over the same file, for running io_block between
+ * io_fip and the storage. 'lba' is in units of the block size given here.
+ */
+static size_t host_block_size;
+
+static size_t host_block_read(int lba, uintptr_t buf, size_t size)
+{
+	ssize_t n;
+
+	n = pread(host_fd, (void *)buf, size,
+		  (off_t)lba * (off_t)host_block_size);
+	if (n < 0) {
+		return 0U;
+	}
+
+	/* The last block is read past the end of the file */
+	if ((size_t)n < size) {
+		memset((void *)(buf + (size_t)n), 0, size - (size_t)n);
+	}
+
+	return size;
+}
+
+int host_block_ops_init(const char *path, size_t block_size,
+			io_block_ops_t *ops, size_t *dev_size)
+{
+	int result;
+
+	assert(block_size != 0U);
+
+	result = host_backing_open(path);
+	if (result != 0) {
+		return result;
+	}
+
+	host_block_size = block_size;
+	ops->read = host_block_read;
+	ops->write = NULL;
+	*dev_size = (size_t)host_file_size;
+
+	return 0;
+}
+
+size_t host_file_get_size(void)
+{
+	return (size_t)host_file_size;
+}
@@ -0,0 +1,353 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <assert.h>
+#include <getopt.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <common/bl_common.h>
+#include <common/debug.h>
+#include <common/tbbr/tbbr_img_def.h>
+#include <drivers/auth/auth_mod.h>
+#include <drivers/auth/crypto_mod.h>
+#include <drivers/io/io_storage.h>
+
+#include "boot_bench.h"
+#include "io_host.h"
+
+#define DEFAULT_ITERATIONS	10U
+
+/* Images loaded by BL2 from the FIP, in the order BL2 loads them */
+static const unsigned int boot_images[] = {
+	HW_CONFIG_ID,
+	SCP_BL2_IMAGE_ID,
+	BL31_IMAGE_ID,
+	SOC_FW_CONFIG_ID,
+	BL32_IMAGE_ID,
+	BL32_EXTRA1_IMAGE_ID,
+	BL32_EXTRA2_IMAGE_ID,
+	TOS_FW_CONFIG_ID,
+	BL33_IMAGE_ID,
+	NT_FW_CONFIG_ID,
+};
+
+static bench_stats_t stats[MAX_NUMBER_IDS];
+static unsigned int current_image;
+
+/* Order in which the images, certificates included, were first loaded */
+static unsigned int load_order[MAX_NUMBER_IDS];
+static unsigned int nr_loaded;
+
+uint64_t bench_now_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+void bench_set_current_image(unsigned int image_id)
+{
+	assert(image_id < MAX_NUMBER_IDS);
+
+	current_image = image_id;
+	if (stats[image_id].loads++ == 0U) {
+		load_order[nr_loaded++] = image_id;
+	}
+}
+
+/*
+ * The modules are linked with --wrap so that the calls they make to each other
+ * go through the functions below, which charge the time spent to the image
+ * being loaded. Reads issued by io_fip to its backend happen within the read
+ * of the image and are not counted twice.
+ */
+int __real_io_read(uintptr_t handle, uintptr_t buffer, size_t length,
+		   size_t *length_read);
+int __wrap_io_read(uintptr_t handle, uintptr_t buffer, size_t length,
+		   size_t *length_read);
+int __real_auth_mod_verify_img(unsigned int img_id, void *img_ptr,
+			       unsigned int img_len);
+int __wrap_auth_mod_verify_img(unsigned int img_id, void *img_ptr,
+			       unsigned int img_len);
+int __real_crypto_mod_verify_hash(void *data_ptr, unsigned int data_len,
+				  void *digest_info_ptr,
+				  unsigned int digest_info_len);
+int __wrap_crypto_mod_verify_hash(void *data_ptr, unsigned int data_len,
+				  void *digest_info_ptr,
+				  unsigned int digest_info_len);
+int __real_crypto_mod_verify_signature(void *data_ptr, unsigned int data_len,
+				       void *sig_ptr, unsigned int sig_len,
+				       void *sig_alg_ptr,
+				       unsigned int sig_alg_len,
+				       void *pk_ptr, unsigned int pk_len);
+int __wrap_crypto_mod_verify_signature(void *data_ptr, unsigned int data_len,
+				       void *sig_ptr, unsigned int sig_len,
+				       void *sig_alg_ptr,
+				       unsigned int sig_alg_len,
+				       void *pk_ptr, unsigned int pk_len);
+
+int __wrap_io_read(uintptr_t handle, uintptr_t buffer, size_t length,
+		   size_t *length_read)
+{
+	static unsigned int depth;
+	uint64_t start;
+	int rc;
+
+	if (depth++ != 0U) {
+		rc = __real_io_read(handle, buffer, length, length_read);
+		depth--;
+		return rc;
+	}
+
+	start = bench_now_ns();
+	rc = __real_io_read(handle, buffer, length, length_read);
+	stats[current_image].read_ns += bench_now_ns() - start;
+	stats[current_image].bytes += *length_read;
+	depth--;
+
+	return rc;
+}
+
+int __wrap_auth_mod_verify_img(unsigned int img_id, void *img_ptr,
+			       unsigned int img_len)
+{
+	uint64_t start = bench_now_ns();
+	int rc;
+
+	rc = __real_auth_mod_verify_img(img_id, img_ptr, img_len);
+	stats[img_id].auth_ns += bench_now_ns() - start;
+
+	return rc;
+}
+
+int __wrap_crypto_mod_verify_hash(void *data_ptr, unsigned int data_len,
+				  void *digest_info_ptr,
+				  unsigned int digest_info_len)
+{
+	uint64_t start = bench_now_ns();
+	int rc;
+
+	rc = __real_crypto_mod_verify_hash(data_ptr, data_len,
+					   digest_info_ptr, digest_info_len);
+	stats[current_image].hash_ns += bench_now_ns() - start;
+
+	return rc;
+}
+
+int __wrap_crypto_mod_verify_signature(void *data_ptr, unsigned int data_len,
+				       void *sig_ptr, unsigned int sig_len,
+				       void *sig_alg_ptr,
+				       unsigned int sig_alg_len,
+				       void *pk_ptr, unsigned int pk_len)
+{
+	uint64_t start = bench_now_ns();
+	int rc;
+
+	rc = __real_crypto_mod_verify_signature(data_ptr, data_len, sig_ptr,
+						sig_len, sig_alg_ptr,
+						sig_alg_len, pk_ptr, pk_len);
+	stats[current_image].sig_ns += bench_now_ns() - start;
+
+	return rc;
+}
+
+static void usage(const char *prog)
+{
+	printf("Usage: %s [options] <fip>\n\n", prog);
+	printf("Load and authenticate the images of a FIP as BL2 does, and report\n");
+	printf("the time spent reading, hashing and verifying signatures.\n\n");
+	printf("Options:\n");
+	printf("  --block-size <n>      Read the FIP through io_block, in blocks of <n> bytes\n");
+	printf("  --offset <n>          Offset of the FIP in the file\n");
+	printf("  --iterations <n>      Number of boots to average over (default %u)\n",
+	       DEFAULT_ITERATIONS);
+	printf("  --rotpk <file>        DER public key the root certificates must match\n");
+	printf("  --verbose             Print the messages logged by the modules\n");
+	printf("  --help                Print this message\n");
+}
+
+static unsigned long long get_number(const char *arg, const char *name)
+{
+	unsigned long long val;
+	char *end;
+
+	val = strtoull(arg, &end, 0);
+	if ((*arg == '\0') || (*end != '\0')) {
+		fprintf(stderr, "Invalid %s: %s\n", name, arg);
+		exit(1);
+	}
+
+	return val;
+}
+
+static double per_boot_us(uint64_t ns, unsigned int iterations)
+{
+	return (double)ns / 1000.0 / (double)iterations;
+}
+
+static void report(const uint64_t *boot_ns, unsigned int iterations)
+{
+	const bench_stats_t *st;
+	const bench_image_t *image;
+	uint64_t total = 0U, other;
+	unsigned int i, id;
+
+	printf("Per boot, averaged over %u boots (times in us):\n\n",
+	       iterations);
+	printf("%-18s %5s %10s %10s %10s %10s %10s\n", "Image", "Loads",
+	       "Bytes", "Read", "Hash", "Signature", "Other auth");
+
+	for (i = 0U; i < nr_loaded; i++) {
+		id = load_order[i];
+		st = &stats[id];
+		image = bench_get_image(id);
+		other = st->auth_ns - MIN(st->auth_ns, st->hash_ns + st->sig_ns);
+
+		printf("%-18s %5u %10llu %10.1f %10.1f %10.1f %10.1f\n",
+		       image->name, st->loads / iterations,
+		       (unsigned long long)(st->bytes / iterations),
+		       per_boot_us(st->read_ns, iterations),
+		       per_boot_us(st->hash_ns, iterations),
+		       per_boot_us(st->sig_ns, iterations),
+		       per_boot_us(other, iterations));
+	}
+
+	printf("\nload_auth_image(), certificates included:\n\n");
+	for (i = 0U; i < ARRAY_SIZE(boot_images); i++) {
+		if (boot_ns[i] == 0U) {
+			continue;
+		}
+		image = bench_get_image(boot_images[i]);
+		printf("%-18s %10.1f\n", image->name,
+		       per_boot_us(boot_ns[i], iterations));
+		total += boot_ns[i];
+	}
+	printf("%-18s %10.1f\n", "Total", per_boot_us(total, iterations));
+}
+
+int main(int argc, char *argv[])
+{
+	static const struct option opts[] = {
+		{ "block-size", required_argument, NULL, 'b' },
+		{ "offset", required_argument, NULL, 'o' },
+		{ "iterations", required_argument, NULL, 'n' },
+		{ "rotpk", required_argument, NULL, 'r' },
+		{ "verbose", no_argument, NULL, 'v' },
+		{ "help", no_argument, NULL, 'h' },
+		{ NULL, 0, NULL, 0 }
+	};
+	uint64_t boot_ns[ARRAY_SIZE(boot_images)] = { 0U };
+	bool present[ARRAY_SIZE(boot_images)];
+	unsigned int iterations = DEFAULT_ITERATIONS;
+	size_t block_size = 0U, offset = 0U, max_size;
+	const char *rotpk = NULL;
+	bool verbose = false;
+	image_info_t info;
+	unsigned int i, it;
+	uint64_t start;
+	void *buf;
+	int c, rc;
+
+	while ((c = getopt_long(argc, argv, "b:hn:o:r:v", opts, NULL)) != -1) {
+		switch (c) {
+		case 'b':
+			block_size = get_number(optarg, "block size");
+			break;
+		case 'o':
+			offset = get_number(optarg, "offset");
+			break;
+		case 'n':
+			iterations = get_number(optarg, "number of iterations");
+			if (iterations == 0U) {
+				fprintf(stderr, "At least one iteration is needed\n");
+				return 1;
+			}
+			break;
+		case 'r':
+			rotpk = optarg;
+			break;
+		case 'v':
+			verbose = true;
+			break;
+		case 'h':
+			usage(argv[0]);
+			return 0;
+		default:
+			usage(argv[0]);
+			return 1;
+		}
+	}
+
+	if (optind != (argc - 1)) {
+		usage(argv[0]);
+		return 1;
+	}
+
+	if (!verbose) {
+		tf_log_set_max_level(LOG_LEVEL_ERROR);
+	}
+
+	rc = bench_io_setup(argv[optind], offset, 0U, block_size);
+	if (rc != 0) {
+		fprintf(stderr, "Cannot open the FIP %s (%d)\n", argv[optind],
+			rc);
+		return 1;
+	}
+
+	if ((rotpk != NULL) && (bench_set_rotpk(rotpk) != 0)) {
+		fprintf(stderr, "Cannot read the ROTPK %s\n", rotpk);
+		return 1;
+	}
+
+	/* Any image in the FIP fits in a buffer the size of the FIP */
+	max_size = host_file_get_size() - offset;
+	buf = malloc(max_size);
+	if (buf == NULL) {
+		fprintf(stderr, "Cannot allocate %zu bytes\n", max_size);
+		return 1;
+	}
+
+	for (i = 0U; i < ARRAY_SIZE(boot_images); i++) {
+		present[i] = (bench_image_present(boot_images[i]) != 0);
+	}
+
+	auth_mod_init();
+
+	for (it = 0U; it < iterations; it++) {
+		for (i = 0U; i < ARRAY_SIZE(boot_images); i++) {
+			if (!present[i]) {
+				continue;
+			}
+
+			memset(&info, 0, sizeof(info));
+			SET_PARAM_HEAD(&info, PARAM_IMAGE_BINARY, VERSION_2, 0U);
+			info.image_base = (uintptr_t)buf;
+			info.image_max_size = (uint32_t)MIN(max_size,
+							    (size_t)UINT32_MAX);
+
+			start = bench_now_ns();
+			rc = load_auth_image(boot_images[i], &info);
+			boot_ns[i] += bench_now_ns() - start;
+			if (rc != 0) {
+				fprintf(stderr, "Failed to load %s (%d)\n",
+					bench_get_image(boot_images[i])->name,
+					rc);
+				return 1;
+			}
+		}
+	}
+
+	report(boot_ns, iterations);
+
+	free(buf);
+
+	return 0;
+}
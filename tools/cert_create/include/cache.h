@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef CACHE_H
+#define CACHE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/* Size of the fingerprint of the inputs of a certificate */
+#define CACHE_FP_LEN		32
+
+/* Identity of a file, used to tell whether it changed since it was cached */
+typedef struct file_id_s {
+	long long size;
+	long long mtime_sec;
+	long mtime_nsec;
+} file_id_t;
+
+/* Exported API */
+int file_id_get(const char *path, file_id_t *id);
+int cache_load(const char *dir);
+int cache_save(void);
+bool cache_get_digest(const char *path, const file_id_t *id, int hash_alg,
+		      unsigned char *md, size_t md_len);
+void cache_set_digest(const char *path, const file_id_t *id, int hash_alg,
+		      const unsigned char *md, size_t md_len);
+bool cache_get_cert(const char *path, const unsigned char *fp);
+void cache_set_cert(const char *path, const unsigned char *fp);
+void cache_cleanup(void);
+
+#endif /* CACHE_H */
@@ -0,0 +1,356 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include <openssl/sha.h>
+
+#include "cache.h"
+#include "debug.h"
+
+/*
+ * The cache directory holds two text files. 'digests' has one line per image
+ * with the digest of the image, keyed by the path, the size and the
+ * modification time of the image and the hash algorithm. 'certs' has one
+ * line per certificate with the fingerprint of the inputs the certificate was
+ * created from, and the size and modification time of the certificate file
+ * once it was written.
+ */
+#define CACHE_MAGIC		"cert_create cache 1"
+#define CACHE_DIGESTS		"digests"
+#define CACHE_CERTS		"certs"
+#define CACHE_LINE_MAX		4352
+#define CACHE_PATH_MAX		4096
+
+typedef struct cache_entry_s cache_entry_t;
+struct cache_entry_s {
+	cache_entry_t *next;
+	char *path;		/* Image or certificate file */
+	int hash_alg;		/* Hash algorithm of the digest */
+	file_id_t id;		/* Identity of the file when cached */
+	unsigned char md[SHA512_DIGEST_LENGTH];
+	size_t md_len;
+};
+
+static char *cache_dir;
+static cache_entry_t *digests;
+static cache_entry_t *certs_fp;
+
+int file_id_get(const char *path, file_id_t *id)
+{
+	struct stat st;
+
+	if (stat(path, &st) != 0) {
+		return -1;
+	}
+
+	id->size = st.st_size;
+#if defined(__APPLE__)
+	id->mtime_sec = st.st_mtimespec.tv_sec;
+	id->mtime_nsec = st.st_mtimespec.tv_nsec;
+#elif defined(_WIN32)
+	id->mtime_sec = st.st_mtime;
+	id->mtime_nsec = 0;
+#else
+	id->mtime_sec = st.st_mtim.tv_sec;
+	id->mtime_nsec = st.st_mtim.tv_nsec;
+#endif
+
+	return 0;
+}
+
+static bool file_id_equal(const file_id_t *a, const file_id_t *b)
+{
+	return (a->size == b->size) && (a->mtime_sec == b->mtime_sec) &&
+	       (a->mtime_nsec == b->mtime_nsec);
+}
+
+static int hex_to_bin(const char *hex, unsigned char *buf, size_t max_len,
+		      size_t *len)
+{
+	size_t n = strlen(hex);
+	size_t i;
+	unsigned int byte;
+
+	if (((n % 2U) != 0U) || ((n / 2U) > max_len)) {
+		return -1;
+	}
+
+	for (i = 0; i < n / 2U; i++) {
+		if (sscanf(&hex[2U * i], "%2x", &byte) != 1) {
+			return -1;
+		}
+		buf[i] = (unsigned char)byte;
+	}
+	*len = n / 2U;
+
+	return 0;
+}
+
+static void bin_to_hex(FILE *fp, const unsigned char *buf, size_t len)
+{
+	size_t i;
+
+	for (i = 0; i < len; i++) {
+		fprintf(fp, "%02x", buf[i]);
+	}
+}
+
+static cache_entry_t *cache_find(cache_entry_t *list, const char *path,
+				 int hash_alg)
+{
+	for (; list != NULL; list = list->next) {
+		if ((list->hash_alg == hash_alg) &&
+		    (strcmp(list->path, path) == 0)) {
+			return list;
+		}
+	}
+
+	return NULL;
+}
+
+static void cache_set(cache_entry_t **list, const char *path, int hash_alg,
+		      const file_id_t *id, const unsigned char *md,
+		      size_t md_len)
+{
+	cache_entry_t *entry = cache_find(*list, path, hash_alg);
+
+	if (entry == NULL) {
+		entry = calloc(1, sizeof(*entry));
+		if (entry == NULL) {
+			return;
+		}
+		entry->path = strdup(path);
+		if (entry->path == NULL) {
+			free(entry);
+			return;
+		}
+		entry->hash_alg = hash_alg;
+		entry->next = *list;
+		*list = entry;
+	}
+
+	entry->id = *id;
+	memcpy(entry->md, md, md_len);
+	entry->md_len = md_len;
+}
+
+/*
+ * Read one of the cache files. Lines that can not be parsed are dropped, an
+ * entry missing from the cache only means that its file is processed again.
+ */
+static void cache_read(cache_entry_t **list, const char *name, bool has_alg)
+{
+	char line[CACHE_LINE_MAX], path[CACHE_PATH_MAX];
+	char hex[2 * SHA512_DIGEST_LENGTH + 1];
+	unsigned char md[SHA512_DIGEST_LENGTH];
+	file_id_t id;
+	size_t md_len;
+	int hash_alg = -1, n = 0, rc;
+	FILE *fp;
+
+	snprintf(path, sizeof(path), "%s/%s", cache_dir, name);
+	fp = fopen(path, "r");
+	if (fp == NULL) {
+		return;
+	}
+
+	if ((fgets(line, sizeof(line), fp) == NULL) ||
+	    (strncmp(line, CACHE_MAGIC "\n", sizeof(CACHE_MAGIC)) != 0)) {
+		fclose(fp);
+		return;
+	}
+
+	while (fgets(line, sizeof(line), fp) != NULL) {
+		line[strcspn(line, "\n")] = '\0';
+
+		if (has_alg) {
+			rc = sscanf(line, "%d %lld %lld %ld %128s %n",
+				    &hash_alg, &id.size, &id.mtime_sec,
+				    &id.mtime_nsec, hex, &n);
+			rc -= 5;
+		} else {
+			rc = sscanf(line, "%lld %lld %ld %128s %n",
+				    &id.size, &id.mtime_sec, &id.mtime_nsec,
+				    hex, &n);
+			rc -= 4;
+		}
+
+		if ((rc != 0) || (n == 0) || (line[n] == '\0') ||
+		    (hex_to_bin(hex, md, sizeof(md), &md_len) != 0)) {
+			continue;
+		}
+
+		cache_set(list, &line[n], hash_alg, &id, md, md_len);
+	}
+
+	fclose(fp);
+}
+
+static int cache_write(cache_entry_t *list, const char *name, bool has_alg)
+{
+	char tmp[CACHE_PATH_MAX], path[CACHE_PATH_MAX];
+	FILE *fp;
+	int rc;
+
+	/* Runs sharing the cache write their own copy, the last one wins */
+	snprintf(tmp, sizeof(tmp), "%s/%s.%ld.tmp", cache_dir, name,
+		 (long)getpid());
+	snprintf(path, sizeof(path), "%s/%s", cache_dir, name);
+
+	fp = fopen(tmp, "w");
+	if (fp == NULL) {
+		ERROR("Cannot write the cache in %s\n", cache_dir);
+		return -1;
+	}
+
+	fprintf(fp, "%s\n", CACHE_MAGIC);
+	for (; list != NULL; list = list->next) {
+		if (has_alg) {
+			fprintf(fp, "%d ", list->hash_alg);
+		}
+		fprintf(fp, "%lld %lld %ld ", list->id.size,
+			list->id.mtime_sec, list->id.mtime_nsec);
+		bin_to_hex(fp, list->md, list->md_len);
+		fprintf(fp, " %s\n", list->path);
+	}
+
+	rc = ferror(fp);
+	if (fclose(fp) != 0) {
+		rc = -1;
+	}
+
+#ifdef _WIN32
+	remove(path);
+#endif
+	if ((rc != 0) || (rename(tmp, path) != 0)) {
+		ERROR("Cannot write the cache in %s\n", cache_dir);
+		remove(tmp);
+		return -1;
+	}
+
+	return 0;
+}
+
+int cache_load(const char *dir)
+{
+	int rc;
+
+#ifdef _WIN32
+	rc = mkdir(dir);
+#else
+	rc = mkdir(dir, 0755);
+#endif
+	if ((rc != 0) && (errno != EEXIST)) {
+		ERROR("Cannot create the cache directory %s\n", dir);
+		return -1;
+	}
+
+	cache_dir = strdup(dir);
+	if (cache_dir == NULL) {
+		return -1;
+	}
+
+	cache_read(&digests, CACHE_DIGESTS, true);
+	cache_read(&certs_fp, CACHE_CERTS, false);
+
+	return 0;
+}
+
+int cache_save(void)
+{
+	if (cache_dir == NULL) {
+		return 0;
+	}
+
+	if ((cache_write(digests, CACHE_DIGESTS, true) != 0) ||
+	    (cache_write(certs_fp, CACHE_CERTS, false) != 0)) {
+		return -1;
+	}
+
+	return 0;
+}
+
+/*
+ * Look up the digest of an image. The digest is only returned if the image
+ * still has the size and modification time it had when it was cached.
+ */
+bool cache_get_digest(const char *path, const file_id_t *id, int hash_alg,
+		      unsigned char *md, size_t md_len)
+{
+	cache_entry_t *entry = cache_find(digests, path, hash_alg);
+
+	if ((entry == NULL) || (entry->md_len != md_len) ||
+	    !file_id_equal(&entry->id, id)) {
+		return false;
+	}
+
+	memcpy(md, entry->md, md_len);
+	return true;
+}
+
+void cache_set_digest(const char *path, const file_id_t *id, int hash_alg,
+		      const unsigned char *md, size_t md_len)
+{
+	cache_set(&digests, path, hash_alg, id, md, md_len);
+}
+
+/*
+ * Tell whether the certificate file was created from inputs with the given
+ * fingerprint, and has not been modified since.
+ */
+bool cache_get_cert(const char *path, const unsigned char *fp)
+{
+	cache_entry_t *entry = cache_find(certs_fp, path, -1);
+	file_id_t id;
+
+	if ((entry == NULL) || (entry->md_len != CACHE_FP_LEN) ||
+	    (memcmp(entry->md, fp, CACHE_FP_LEN) != 0) ||
+	    (file_id_get(path, &id) != 0)) {
+		return false;
+	}
+
+	return file_id_equal(&entry->id, &id);
+}
+
+/* Record the fingerprint of the inputs of a certificate file just written */
+void cache_set_cert(const char *path, const unsigned char *fp)
+{
+	file_id_t id;
+
+	if (file_id_get(path, &id) == 0) {
+		cache_set(&certs_fp, path, -1, &id, fp, CACHE_FP_LEN);
+	}
+}
+
+static void cache_free(cache_entry_t *list)
+{
+	cache_entry_t *next;
+
+	for (; list != NULL; list = next) {
+		next = list->next;
+		free(list->path);
+		free(list);
+	}
+}
+
+void cache_cleanup(void)
+{
+	cache_free(digests);
+	cache_free(certs_fp);
+	digests = NULL;
+	certs_fp = NULL;
+	free(cache_dir);
+	cache_dir = NULL;
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -9,10 +9,13 @@
 #include <assert.h>
 #include <ctype.h>
 #include <getopt.h>
+#include <pthread.h>
+#include <stdarg.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
+#include <unistd.h>
 
 #include <openssl/conf.h>
 #include <openssl/engine.h>
@@ -21,6 +24,7 @@
 #include <openssl/sha.h>
 #include <openssl/x509v3.h>
 
+#include "cache.h"
 #include "cert.h"
 #include "cmd_opt.h"
 #include "debug.h"
@@ -59,6 +63,7 @@
 #define ID_TO_BIT_MASK(id)		(1 << id)
 #define NUM_ELEM(x)			((sizeof(x)) / (sizeof(x[0])))
 #define HELP_OPT_MAX_LEN		128
+#define MAX_THREADS			64
 
 /* Global options */
 static int key_alg;
@@ -67,6 +72,18 @@ static int key_size;
 static int new_keys;
 static int save_keys;
 static int print_cert;
+static long nr_threads;
+static const char *cache_dir;
+
+/* Digest algorithm of the image hashes */
+static const EVP_MD *md_info;
+static unsigned int md_len;
+
+/* Digest of each image, indexed like the extensions */
+static unsigned char (*ext_md)[SHA512_DIGEST_LENGTH];
+
+/* Keys generated rather than loaded from a file, indexed like the keys */
+static bool *key_created;
 
 static const char build_msg[] = "Built : " __TIME__ ", " __DATE__;
 static const char platform_msg[] = PLAT_MSG;
@@ -253,6 +270,383 @@ static void check_cmd_params(void)
 	}
 }
 
+struct job_pool {
+	pthread_mutex_t lock;
+	int next;
+	int nr_jobs;
+	void (*fn)(int idx, void *arg);
+	void *arg;
+};
+
+static void *job_worker(void *arg)
+{
+	struct job_pool *pool = arg;
+	int idx;
+
+	for (;;) {
+		pthread_mutex_lock(&pool->lock);
+		idx = pool->next++;
+		pthread_mutex_unlock(&pool->lock);
+		if (idx >= pool->nr_jobs) {
+			break;
+		}
+		pool->fn(idx, pool->arg);
+	}
+
+	return NULL;
+}
+
+/*
+ * Call fn() for each index below nr_jobs, spreading the calls over up to
+ * nr_threads threads. The jobs must be independent of each other.
+ */
+static void run_jobs(int nr_jobs, void (*fn)(int idx, void *arg), void *arg)
+{
+	struct job_pool pool = { .nr_jobs = nr_jobs, .fn = fn, .arg = arg };
+	pthread_t threads[MAX_THREADS - 1];
+	int i, nr_workers;
+
+	nr_workers = (nr_threads < nr_jobs) ? nr_threads : nr_jobs;
+	if (nr_workers <= 1) {
+		for (i = 0; i < nr_jobs; i++) {
+			fn(i, arg);
+		}
+		return;
+	}
+
+	if (pthread_mutex_init(&pool.lock, NULL) != 0) {
+		ERROR("Cannot initialize the job lock\n");
+		exit(1);
+	}
+
+	/* The calling thread is one of the workers */
+	for (i = 0; i < nr_workers - 1; i++) {
+		if (pthread_create(&threads[i], NULL, job_worker, &pool) != 0) {
+			ERROR("Cannot create a worker thread\n");
+			exit(1);
+		}
+	}
+	job_worker(&pool);
+	for (i = 0; i < nr_workers - 1; i++) {
+		pthread_join(threads[i], NULL);
+	}
+
+	pthread_mutex_destroy(&pool.lock);
+}
+
+/* Load a private key from its file, or generate a new one */
+static void load_key_job(int idx, void *arg)
+{
+	const int *key_idx = arg;
+	cert_key_t *key = &keys[key_idx[idx]];
+	unsigned int err_code;
+
+#if !USING_OPENSSL3
+	if (!key_new(key)) {
+		ERROR("Failed to allocate key container\n");
+		exit(1);
+	}
+#endif
+
+	/* First try to load the key from disk */
+	err_code = key_load(key);
+	if (err_code == KEY_ERR_NONE) {
+		/* Key loaded successfully */
+		return;
+	}
+
+	/* Key not loaded. Check the error code */
+	if (err_code == KEY_ERR_LOAD) {
+		/* File exists, but it does not contain a valid private
+		 * key. Abort. */
+		ERROR("Error loading '%s'\n", key->fn);
+		exit(1);
+	}
+
+	/* File does not exist, could not be opened or no filename was
+	 * given */
+	if (new_keys) {
+		/* Try to create a new key */
+		NOTICE("Creating new key for '%s'\n", key->desc);
+		if (!key_create(key, key_alg, key_size)) {
+			ERROR("Error creating key '%s'\n", key->desc);
+			exit(1);
+		}
+		key_created[key_idx[idx]] = true;
+	} else {
+		if (err_code == KEY_ERR_OPEN) {
+			ERROR("Error opening '%s'\n", key->fn);
+		} else {
+			ERROR("Key '%s' not specified\n", key->desc);
+		}
+		exit(1);
+	}
+}
+
+/* Calculate the hash of the image of a hash extension */
+static void hash_image_job(int idx, void *arg)
+{
+	const int *ext_idx = arg;
+	ext_t *ext = &extensions[ext_idx[idx]];
+
+	if (!sha_file(hash_alg, ext->arg, ext_md[ext_idx[idx]])) {
+		ERROR("Cannot calculate hash of %s\n", ext->arg);
+		exit(1);
+	}
+}
+
+/* Create a certificate and sign it with the corresponding key */
+static void create_cert_job(int idx, void *arg)
+{
+	const int *cert_idx = arg;
+	cert_t *cert = &certs[cert_idx[idx]];
+	STACK_OF(X509_EXTENSION) * sk;
+	X509_EXTENSION *cert_ext = NULL;
+	ext_t *ext;
+	int j, ext_nid, nvctr;
+	unsigned char md[SHA512_DIGEST_LENGTH];
+
+	/* Create a new stack of extensions. This stack will be used
+	 * to create the certificate */
+	CHECK_NULL(sk, sk_X509_EXTENSION_new_null());
+
+	for (j = 0 ; j < cert->num_ext ; j++) {
+
+		ext = &extensions[cert->ext[j]];
+
+		/* Get OpenSSL internal ID for this extension */
+		CHECK_OID(ext_nid, ext->oid);
+
+		/*
+		 * Three types of extensions are currently supported:
+		 *     - EXT_TYPE_NVCOUNTER
+		 *     - EXT_TYPE_HASH
+		 *     - EXT_TYPE_PKEY
+		 */
+		switch (ext->type) {
+		case EXT_TYPE_NVCOUNTER:
+			if (ext->optional && ext->arg == NULL) {
+				/* Skip this NVCounter */
+				continue;
+			} else {
+				/* Checked by `check_cmd_params` */
+				assert(ext->arg != NULL);
+				nvctr = atoi(ext->arg);
+				CHECK_NULL(cert_ext, ext_new_nvcounter(ext_nid,
+					EXT_CRIT, nvctr));
+			}
+			break;
+		case EXT_TYPE_HASH:
+			if (ext->arg == NULL) {
+				if (ext->optional) {
+					/* Include a hash filled with zeros */
+					memset(md, 0x0, SHA512_DIGEST_LENGTH);
+				} else {
+					/* Do not include this hash in the certificate */
+					continue;
+				}
+			} else {
+				/* Hashed before the certificates are created */
+				memcpy(md, ext_md[cert->ext[j]],
+				       SHA512_DIGEST_LENGTH);
+			}
+			CHECK_NULL(cert_ext, ext_new_hash(ext_nid,
+					EXT_CRIT, md_info, md,
+					md_len));
+			break;
+		case EXT_TYPE_PKEY:
+			CHECK_NULL(cert_ext, ext_new_key(ext_nid,
+				EXT_CRIT, keys[ext->attr.key].key));
+			break;
+		default:
+			ERROR("Unknown extension type '%d' in %s\n",
+					ext->type, cert->cn);
+			exit(1);
+		}
+
+		/* Push the extension into the stack */
+		sk_X509_EXTENSION_push(sk, cert_ext);
+	}
+
+	/* Create certificate. Signed with corresponding key */
+	if (!cert_new(hash_alg, cert, VAL_DAYS, 0, sk)) {
+		ERROR("Cannot create %s\n", cert->cn);
+		exit(1);
+	}
+
+	for (cert_ext = sk_X509_EXTENSION_pop(sk); cert_ext != NULL;
+			cert_ext = sk_X509_EXTENSION_pop(sk)) {
+		X509_EXTENSION_free(cert_ext);
+	}
+
+	sk_X509_EXTENSION_free(sk);
+}
+
+static bool cert_has_ext(const cert_t *cert, int ext_idx)
+{
+	int j;
+
+	for (j = 0 ; j < cert->num_ext ; j++) {
+		if (cert->ext[j] == ext_idx) {
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static void fp_add(EVP_MD_CTX *ctx, const char *fmt, ...)
+{
+	char buf[MAX_FILENAME_LEN + 64];
+	va_list ap;
+	int len;
+
+	va_start(ap, fmt);
+	len = vsnprintf(buf, sizeof(buf), fmt, ap);
+	va_end(ap);
+
+	if (len >= (int)sizeof(buf)) {
+		len = sizeof(buf) - 1;
+	}
+
+	/* Include the terminator to keep the fields apart */
+	EVP_DigestUpdate(ctx, buf, len + 1);
+}
+
+/*
+ * Add a key to the fingerprint. Key files are known by their path, size and
+ * modification time, the key itself is not loaded. Returns -1 if the key does
+ * not exist yet.
+ */
+static int fp_add_key(EVP_MD_CTX *ctx, const cert_key_t *key)
+{
+	file_id_t id;
+
+	if (key->fn == NULL) {
+		return -1;
+	}
+
+	if (strncmp(key->fn, "pkcs11:", 7) == 0) {
+		fp_add(ctx, "key %s", key->fn);
+		return 0;
+	}
+
+	if (file_id_get(key->fn, &id) != 0) {
+		return -1;
+	}
+
+	fp_add(ctx, "key %s %lld %lld %ld", key->fn, id.size, id.mtime_sec,
+	       id.mtime_nsec);
+	return 0;
+}
+
+/*
+ * Fingerprint everything a certificate is created from but the random
+ * serial number and the signature: the tool, the keys, the image digests and
+ * the values of the extensions. Returns -1 if the fingerprint can not be
+ * worked out, the certificate must then be created.
+ */
+static int cert_fingerprint(const cert_t *cert, unsigned char *fp)
+{
+	const cert_t *issuer = &certs[cert->issuer];
+	EVP_MD_CTX *ctx;
+	ext_t *ext;
+	int j, rc = -1;
+
+	ctx = EVP_MD_CTX_create();
+	if ((ctx == NULL) || !EVP_DigestInit_ex(ctx, EVP_sha256(), NULL)) {
+		goto END;
+	}
+
+	fp_add(ctx, "%s %s", build_msg, platform_msg);
+	fp_add(ctx, "cert %d %s %s %d", cert->id, cert->cn, issuer->cn,
+	       hash_alg);
+	if ((fp_add_key(ctx, &keys[cert->key]) != 0) ||
+	    (fp_add_key(ctx, &keys[issuer->key]) != 0)) {
+		goto END;
+	}
+
+	for (j = 0 ; j < cert->num_ext ; j++) {
+		ext = &extensions[cert->ext[j]];
+
+		fp_add(ctx, "ext %d %s", ext->type, ext->oid);
+		switch (ext->type) {
+		case EXT_TYPE_NVCOUNTER:
+			fp_add(ctx, "%s", (ext->arg != NULL) ? ext->arg : "");
+			break;
+		case EXT_TYPE_HASH:
+			if (ext->arg != NULL) {
+				EVP_DigestUpdate(ctx, ext_md[cert->ext[j]],
+						 md_len);
+			}
+			break;
+		case EXT_TYPE_PKEY:
+			if (fp_add_key(ctx, &keys[ext->attr.key]) != 0) {
+				goto END;
+			}
+			break;
+		default:
+			goto END;
+		}
+	}
+
+	if (EVP_DigestFinal_ex(ctx, fp, NULL)) {
+		rc = 0;
+	}
+
+END:
+	EVP_MD_CTX_destroy(ctx);
+	return rc;
+}
+
+/*
+ * Reuse a certificate file created from the same inputs by a previous run.
+ * The certificate is read back as it may issue other certificates.
+ */
+static bool cert_reuse(cert_t *cert)
+{
+	unsigned char fp[CACHE_FP_LEN];
+	FILE *file;
+
+	if ((cert_fingerprint(cert, fp) != 0) ||
+	    !cache_get_cert(cert->fn, fp)) {
+		return false;
+	}
+
+	file = fopen(cert->fn, "rb");
+	if (file == NULL) {
+		return false;
+	}
+	cert->x = d2i_X509_fp(file, NULL);
+	fclose(file);
+
+	return cert->x != NULL;
+}
+
+/*
+ * A certificate is created from the certificate of its issuer. To get the
+ * same certificates as when creating them in order, a certificate waits for
+ * its issuer when the issuer comes first, and an issuer that comes later
+ * waits for the certificates it issues.
+ */
+static bool cert_is_ready(int i, const bool *created)
+{
+	int j = certs[i].issuer;
+
+	if ((j < i) && (certs[j].fn != NULL) && !created[j]) {
+		return false;
+	}
+
+	for (j = 0; j < i; j++) {
+		if ((certs[j].issuer == i) && (certs[j].fn != NULL) &&
+		    !created[j]) {
+			return false;
+		}
+	}
+
+	return true;
+}
+
 /* Common command line options */
 static const cmd_opt_t common_cmd_opt[] = {
 	{
@@ -287,25 +681,34 @@ static const cmd_opt_t common_cmd_opt[] = {
 	{
 		{ "print-cert", no_argument, NULL, 'p' },
 		"Print the certificates in the standard output"
+	},
+	{
+		{ "cache-dir", required_argument, NULL, 'c' },
+		"Directory to cache the image hashes and reuse the certificates"
+		" whose inputs did not change"
+	},
+	{
+		{ "threads", required_argument, NULL, 'j' },
+		"Number of threads to load keys, hash images and sign certificates"
+		" (default: number of online CPUs)"
 	}
 };
 
 int main(int argc, char *argv[])
 {
-	STACK_OF(X509_EXTENSION) * sk;
-	X509_EXTENSION *cert_ext = NULL;
 	ext_t *ext;
 	cert_key_t *key;
 	cert_t *cert;
 	FILE *file;
-	int i, j, ext_nid, nvctr;
+	int i, j, nr_jobs;
 	int c, opt_idx = 0;
 	const struct option *cmd_opt;
 	const char *cur_opt;
-	unsigned int err_code;
-	unsigned char md[SHA512_DIGEST_LENGTH];
-	unsigned int  md_len;
-	const EVP_MD *md_info;
+	int *job_idx;
+	bool *created, *reused, *key_used;
+	file_id_t *ext_id;
+	unsigned char fp[CACHE_FP_LEN];
+	char *end;
 
 	NOTICE("CoT Generation Tool: %s\n", build_msg);
 	NOTICE("Target platform: %s\n", platform_msg);
@@ -314,6 +717,14 @@ int main(int argc, char *argv[])
 	key_alg = KEY_ALG_RSA;
 	hash_alg = HASH_ALG_SHA256;
 	key_size = -1;
+#ifdef _SC_NPROCESSORS_ONLN
+	nr_threads = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+	if (nr_threads < 1) {
+		nr_threads = 1;
+	} else if (nr_threads > MAX_THREADS) {
+		nr_threads = MAX_THREADS;
+	}
 
 	/* Add common command line options */
 	for (i = 0; i < NUM_ELEM(common_cmd_opt); i++) {
@@ -343,7 +754,7 @@ int main(int argc, char *argv[])
 
 	while (1) {
 		/* getopt_long stores the option index here. */
-		c = getopt_long(argc, argv, "a:b:hknps:", cmd_opt, &opt_idx);
+		c = getopt_long(argc, argv, "a:b:c:hj:knps:", cmd_opt, &opt_idx);
 
 		/* Detect the end of the options. */
 		if (c == -1) {
@@ -365,9 +776,20 @@ int main(int argc, char *argv[])
 				exit(1);
 			}
 			break;
+		case 'c':
+			cache_dir = optarg;
+			break;
 		case 'h':
 			print_help(argv[0], cmd_opt);
 			exit(0);
+		case 'j':
+			nr_threads = strtol(optarg, &end, 10);
+			if ((*end != '\0') || (nr_threads < 1) ||
+			    (nr_threads > MAX_THREADS)) {
+				ERROR("Invalid number of threads '%s'\n", optarg);
+				exit(1);
+			}
+			break;
 		case 'k':
 			save_keys = 1;
 			break;
@@ -427,138 +849,117 @@ int main(int argc, char *argv[])
 		md_len  = SHA256_DIGEST_LENGTH;
 	}
 
-	/* Load private keys from files (or generate new ones) */
-	for (i = 0 ; i < num_keys ; i++) {
-#if !USING_OPENSSL3
-		if (!key_new(&keys[i])) {
-			ERROR("Failed to allocate key container\n");
-			exit(1);
-		}
-#endif
+	if ((cache_dir != NULL) && (cache_load(cache_dir) != 0)) {
+		exit(1);
+	}
+
+	ext_md = calloc(num_extensions, sizeof(*ext_md));
+	ext_id = calloc(num_extensions, sizeof(*ext_id));
+	job_idx = calloc(num_extensions + num_certs + num_keys,
+			 sizeof(*job_idx));
+	created = calloc(num_certs, sizeof(*created));
+	reused = calloc(num_certs, sizeof(*reused));
+	key_used = calloc(num_keys, sizeof(*key_used));
+	key_created = calloc(num_keys, sizeof(*key_created));
+	if ((ext_md == NULL) || (ext_id == NULL) || (job_idx == NULL) ||
+	    (created == NULL) || (reused == NULL) || (key_used == NULL) ||
+	    (key_created == NULL)) {
+		ERROR("%s:%d Failed to allocate memory.\n", __func__, __LINE__);
+		exit(1);
+	}
 
-		/* First try to load the key from disk */
-		err_code = key_load(&keys[i]);
-		if (err_code == KEY_ERR_NONE) {
-			/* Key loaded successfully */
+	/*
+	 * Calculate the hashes of the images of the requested certificates,
+	 * each image once. With a cache, only the images that changed since
+	 * the previous run are hashed.
+	 */
+	nr_jobs = 0;
+	for (i = 0 ; i < num_extensions ; i++) {
+		ext = &extensions[i];
+		if ((ext->type != EXT_TYPE_HASH) || (ext->arg == NULL)) {
+			continue;
+		}
+		for (j = 0 ; j < num_certs ; j++) {
+			if ((certs[j].fn != NULL) &&
+			    cert_has_ext(&certs[j], i)) {
+				break;
+			}
+		}
+		if (j == num_certs) {
+			continue;
+		}
+		if ((cache_dir != NULL) &&
+		    (file_id_get(ext->arg, &ext_id[i]) == 0) &&
+		    cache_get_digest(ext->arg, &ext_id[i], hash_alg,
+				     ext_md[i], md_len)) {
 			continue;
 		}
+		job_idx[nr_jobs++] = i;
+	}
+	run_jobs(nr_jobs, hash_image_job, job_idx);
 
-		/* Key not loaded. Check the error code */
-		if (err_code == KEY_ERR_LOAD) {
-			/* File exists, but it does not contain a valid private
-			 * key. Abort. */
-			ERROR("Error loading '%s'\n", keys[i].fn);
-			exit(1);
+	if (cache_dir != NULL) {
+		for (i = 0 ; i < nr_jobs ; i++) {
+			ext = &extensions[job_idx[i]];
+			cache_set_digest(ext->arg, &ext_id[job_idx[i]],
+					 hash_alg, ext_md[job_idx[i]], md_len);
 		}
 
-		/* File does not exist, could not be opened or no filename was
-		 * given */
-		if (new_keys) {
-			/* Try to create a new key */
-			NOTICE("Creating new key for '%s'\n", keys[i].desc);
-			if (!key_create(&keys[i], key_alg, key_size)) {
-				ERROR("Error creating key '%s'\n", keys[i].desc);
-				exit(1);
-			}
-		} else {
-			if (err_code == KEY_ERR_OPEN) {
-				ERROR("Error opening '%s'\n", keys[i].fn);
-			} else {
-				ERROR("Key '%s' not specified\n", keys[i].desc);
+		/* Reuse the certificates whose inputs did not change */
+		for (i = 0 ; i < num_certs ; i++) {
+			if ((certs[i].fn != NULL) && cert_reuse(&certs[i])) {
+				reused[i] = created[i] = true;
 			}
-			exit(1);
 		}
 	}
 
-	/* Create the certificates */
+	/*
+	 * Load private keys from files (or generate new ones). With a cache,
+	 * only the keys needed by the certificates to create are loaded.
+	 */
 	for (i = 0 ; i < num_certs ; i++) {
-
 		cert = &certs[i];
-
-		if (cert->fn == NULL) {
-			/* Certificate not requested. Skip to the next one */
+		if ((cert->fn == NULL) || reused[i]) {
 			continue;
 		}
-
-		/* Create a new stack of extensions. This stack will be used
-		 * to create the certificate */
-		CHECK_NULL(sk, sk_X509_EXTENSION_new_null());
-
+		key_used[cert->key] = true;
+		key_used[certs[cert->issuer].key] = true;
 		for (j = 0 ; j < cert->num_ext ; j++) {
-
 			ext = &extensions[cert->ext[j]];
-
-			/* Get OpenSSL internal ID for this extension */
-			CHECK_OID(ext_nid, ext->oid);
-
-			/*
-			 * Three types of extensions are currently supported:
-			 *     - EXT_TYPE_NVCOUNTER
-			 *     - EXT_TYPE_HASH
-			 *     - EXT_TYPE_PKEY
-			 */
-			switch (ext->type) {
-			case EXT_TYPE_NVCOUNTER:
-				if (ext->optional && ext->arg == NULL) {
-					/* Skip this NVCounter */
-					continue;
-				} else {
-					/* Checked by `check_cmd_params` */
-					assert(ext->arg != NULL);
-					nvctr = atoi(ext->arg);
-					CHECK_NULL(cert_ext, ext_new_nvcounter(ext_nid,
-						EXT_CRIT, nvctr));
-				}
-				break;
-			case EXT_TYPE_HASH:
-				if (ext->arg == NULL) {
-					if (ext->optional) {
-						/* Include a hash filled with zeros */
-						memset(md, 0x0, SHA512_DIGEST_LENGTH);
-					} else {
-						/* Do not include this hash in the certificate */
-						continue;
-					}
-				} else {
-					/* Calculate the hash of the file */
-					if (!sha_file(hash_alg, ext->arg, md)) {
-						ERROR("Cannot calculate hash of %s\n",
-							ext->arg);
-						exit(1);
-					}
-				}
-				CHECK_NULL(cert_ext, ext_new_hash(ext_nid,
-						EXT_CRIT, md_info, md,
-						md_len));
-				break;
-			case EXT_TYPE_PKEY:
-				CHECK_NULL(cert_ext, ext_new_key(ext_nid,
-					EXT_CRIT, keys[ext->attr.key].key));
-				break;
-			default:
-				ERROR("Unknown extension type '%d' in %s\n",
-						ext->type, cert->cn);
-				exit(1);
+			if (ext->type == EXT_TYPE_PKEY) {
+				key_used[ext->attr.key] = true;
 			}
-
-			/* Push the extension into the stack */
-			sk_X509_EXTENSION_push(sk, cert_ext);
-		}
-
-		/* Create certificate. Signed with corresponding key */
-		if (!cert_new(hash_alg, cert, VAL_DAYS, 0, sk)) {
-			ERROR("Cannot create %s\n", cert->cn);
-			exit(1);
 		}
+	}
 
-		for (cert_ext = sk_X509_EXTENSION_pop(sk); cert_ext != NULL;
-				cert_ext = sk_X509_EXTENSION_pop(sk)) {
-			X509_EXTENSION_free(cert_ext);
+	nr_jobs = 0;
+	for (i = 0 ; i < num_keys ; i++) {
+		if ((cache_dir == NULL) || key_used[i]) {
+			job_idx[nr_jobs++] = i;
 		}
-
-		sk_X509_EXTENSION_free(sk);
 	}
+	run_jobs(nr_jobs, load_key_job, job_idx);
 
+	/*
+	 * Create the certificates. The certificates that do not depend on each
+	 * other are signed in parallel.
+	 */
+	do {
+		nr_jobs = 0;
+		for (i = 0 ; i < num_certs ; i++) {
+			/* Skip the certificates not requested or created */
+			if ((certs[i].fn == NULL) || created[i]) {
+				continue;
+			}
+			if (cert_is_ready(i, created)) {
+				job_idx[nr_jobs++] = i;
+			}
+		}
+		run_jobs(nr_jobs, create_cert_job, job_idx);
+		for (i = 0 ; i < nr_jobs ; i++) {
+			created[job_idx[i]] = true;
+		}
+	} while (nr_jobs != 0);
 
 	/* Print the certificates */
 	if (print_cert) {
@@ -573,7 +974,7 @@ int main(int argc, char *argv[])
 
 	/* Save created certificates to files */
 	for (i = 0 ; i < num_certs ; i++) {
-		if (certs[i].x && certs[i].fn) {
+		if (certs[i].x && certs[i].fn && !reused[i]) {
 			file = fopen(certs[i].fn, "w");
 			if (file != NULL) {
 				i2d_X509_fp(file, certs[i].x);
@@ -584,15 +985,45 @@ int main(int argc, char *argv[])
 		}
 	}
 
-	/* Save keys */
+	/*
+	 * Save keys. With a cache, the keys loaded from a file are left alone
+	 * so that the certificates they sign remain up to date.
+	 */
 	if (save_keys) {
 		for (i = 0 ; i < num_keys ; i++) {
+			if ((cache_dir != NULL) && !key_created[i]) {
+				continue;
+			}
 			if (!key_store(&keys[i])) {
 				ERROR("Cannot save %s\n", keys[i].desc);
 			}
 		}
 	}
 
+	/* Record what the new certificates were created from */
+	if (cache_dir != NULL) {
+		for (i = 0 ; i < num_certs ; i++) {
+			if (!created[i] || reused[i]) {
+				continue;
+			}
+			if (cert_fingerprint(&certs[i], fp) == 0) {
+				cache_set_cert(certs[i].fn, fp);
+			}
+		}
+		if (cache_save() != 0) {
+			exit(1);
+		}
+		cache_cleanup();
+	}
+
+	free(key_created);
+	free(key_used);
+	free(reused);
+	free(created);
+	free(job_idx);
+	free(ext_id);
+	free(ext_md);
+
 	/* If we got here, then we must have filled the key array completely.
 	 * We can then safely call free on all of the keys in the array
 	 */
@@ -1,10 +1,16 @@
 /*
- * Copyright (c) 2015-2022, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2015-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#define _POSIX_C_SOURCE 200809L
+
 #include <stdio.h>
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
 #include "debug.h"
 #include "key.h"
 #if USING_OPENSSL3
@@ -14,7 +20,60 @@
 #include <openssl/sha.h>
 #endif
 
-#define BUFFER_SIZE	256
+#define BUFFER_SIZE	(64 * 1024)
+
+typedef void (*sha_update_t)(void *ctx, const void *data, size_t len);
+
+/*
+ * Feed the content of the file to the digest. The file is mapped when
+ * possible, it is otherwise read in large chunks.
+ */
+static void sha_update_file(FILE *inFile, sha_update_t update, void *ctx)
+{
+	unsigned char data[BUFFER_SIZE];
+	size_t bytes;
+#ifndef _WIN32
+	struct stat st;
+	void *map;
+
+	if ((fstat(fileno(inFile), &st) == 0) && S_ISREG(st.st_mode) &&
+	    (st.st_size > 0)) {
+		map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE,
+			   fileno(inFile), 0);
+		if (map != MAP_FAILED) {
+			update(ctx, map, st.st_size);
+			munmap(map, st.st_size);
+			return;
+		}
+	}
+#endif
+
+	while ((bytes = fread(data, 1, BUFFER_SIZE, inFile)) != 0) {
+		update(ctx, data, bytes);
+	}
+}
+
+#if USING_OPENSSL3
+static void evp_update(void *ctx, const void *data, size_t len)
+{
+	EVP_DigestUpdate(ctx, data, len);
+}
+#else
+static void sha256_update(void *ctx, const void *data, size_t len)
+{
+	SHA256_Update(ctx, data, len);
+}
+
+static void sha384_update(void *ctx, const void *data, size_t len)
+{
+	SHA384_Update(ctx, data, len);
+}
+
+static void sha512_update(void *ctx, const void *data, size_t len)
+{
+	SHA512_Update(ctx, data, len);
+}
+#endif
 
 #if USING_OPENSSL3
 static int get_algorithm_nid(int hash_alg)
@@ -30,8 +89,6 @@ static int get_algorithm_nid(int hash_alg)
 int sha_file(int md_alg, const char *filename, unsigned char *md)
 {
 	FILE *inFile;
-	int bytes;
-	unsigned char data[BUFFER_SIZE];
 #if USING_OPENSSL3
 	EVP_MD_CTX *mdctx;
 	const EVP_MD *md_type;
@@ -74,9 +131,7 @@ int sha_file(int md_alg, const char *filename, unsigned char *md)
 		goto err;
 	}
 
-	while ((bytes = fread(data, 1, BUFFER_SIZE, inFile)) != 0) {
-		EVP_DigestUpdate(mdctx, data, bytes);
-	}
+	sha_update_file(inFile, evp_update, mdctx);
 	EVP_DigestFinal_ex(mdctx, md, &total_bytes);
 
 	fclose(inFile);
@@ -92,21 +147,15 @@ err:
 
 	if (md_alg == HASH_ALG_SHA384) {
 		SHA384_Init(&sha512Context);
-		while ((bytes = fread(data, 1, BUFFER_SIZE, inFile)) != 0) {
-			SHA384_Update(&sha512Context, data, bytes);
-		}
+		sha_update_file(inFile, sha384_update, &sha512Context);
 		SHA384_Final(md, &sha512Context);
 	} else if (md_alg == HASH_ALG_SHA512) {
 		SHA512_Init(&sha512Context);
-		while ((bytes = fread(data, 1, BUFFER_SIZE, inFile)) != 0) {
-			SHA512_Update(&sha512Context, data, bytes);
-		}
+		sha_update_file(inFile, sha512_update, &sha512Context);
 		SHA512_Final(md, &sha512Context);
 	} else {
 		SHA256_Init(&shaContext);
-		while ((bytes = fread(data, 1, BUFFER_SIZE, inFile)) != 0) {
-			SHA256_Update(&shaContext, data, bytes);
-		}
+		sha_update_file(inFile, sha256_update, &shaContext);
 		SHA256_Final(md, &shaContext);
 	}
 
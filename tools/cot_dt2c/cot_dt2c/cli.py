@@ -1,5 +1,5 @@
 #
-# Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+# Copyright (c) 2024-2026, Arm Limited and Contributors. All rights reserved.
 #
 # SPDX-License-Identifier: BSD-3-Clause
 #
@@ -9,6 +9,7 @@ from cot_dt2c.cot_dt2c import generateMain
 from cot_dt2c.cot_dt2c import validateMain
 from cot_dt2c.cot_dt2c import visualizeMain
 from cot_dt2c.dt_validator import dtValidatorMain
+from cot_dt2c.fconf_dt2c import generateFconfMain
 
 import click
 
@@ -23,6 +24,13 @@ def cli():
 def convert_to_c(inputfile, outputfile):
     generateMain(inputfile, outputfile)
 
+@cli.command()
+@click.argument("outputfile", type=click.Path(dir_okay=True))
+@click.argument("inputfiles", nargs=-1, required=True,
+                type=click.Path(exists=True, dir_okay=False))
+def convert_fconf(outputfile, inputfiles):
+    generateFconfMain(outputfile, list(inputfiles))
+
 @cli.command()
 @click.argument("inputfile", type=click.Path(dir_okay=True))
 def validate_cot(inputfile):
@@ -0,0 +1,215 @@
+#
+# Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+
+"""
+Generate the const tables of the FCONF_STATIC_CONFIG populators from the
+FW_CONFIG and TB_FW_CONFIG DTBs.
+
+The DTBs are read rather than their sources, so that the C preprocessor and
+dtc have already resolved the includes, the macros and the cell expressions.
+"""
+
+import struct
+import sys
+from pathlib import Path
+from typing import Dict, List, Optional
+
+FDT_MAGIC = 0xd00dfeed
+FDT_BEGIN_NODE = 0x1
+FDT_END_NODE = 0x2
+FDT_PROP = 0x3
+FDT_NOP = 0x4
+FDT_END = 0x9
+
+
+class FdtNode:
+    def __init__(self, name: str, parent: Optional["FdtNode"]):
+        self.name = name
+        self.parent = parent
+        self.props: Dict[str, bytes] = {}
+        self.children: List["FdtNode"] = []
+
+    def path(self) -> str:
+        if self.parent is None:
+            return "/"
+        return self.parent.path().rstrip("/") + "/" + self.name
+
+    def walk(self):
+        yield self
+        for c in self.children:
+            yield from c.walk()
+
+    def is_compatible(self, compatible: str) -> bool:
+        prop = self.props.get("compatible", b"")
+        return compatible.encode() in prop.split(b"\0")
+
+
+def parse_dtb(data: bytes) -> FdtNode:
+    (magic, totalsize, off_struct, off_strings, _, _, _, _,
+     size_strings, size_struct) = struct.unpack_from(">10I", data)
+    if magic != FDT_MAGIC or totalsize > len(data):
+        raise ValueError("not a valid DTB")
+
+    strings = data[off_strings:off_strings + size_strings]
+    offset = off_struct
+    end = off_struct + size_struct
+    root = None
+    node = None
+
+    while offset < end:
+        tag, = struct.unpack_from(">I", data, offset)
+        offset += 4
+
+        if tag == FDT_BEGIN_NODE:
+            name_end = data.index(b"\0", offset)
+            name = data[offset:name_end].decode()
+            offset = (name_end + 4) & ~3
+            child = FdtNode(name, node)
+            if node is None:
+                root = child
+            else:
+                node.children.append(child)
+            node = child
+        elif tag == FDT_END_NODE:
+            if node is None:
+                raise ValueError("unbalanced FDT_END_NODE")
+            node = node.parent
+        elif tag == FDT_PROP:
+            length, nameoff = struct.unpack_from(">II", data, offset)
+            offset += 8
+            name = strings[nameoff:strings.index(b"\0", nameoff)].decode()
+            node.props[name] = data[offset:offset + length]
+            offset = (offset + length + 3) & ~3
+        elif tag == FDT_NOP:
+            continue
+        elif tag == FDT_END:
+            break
+        else:
+            raise ValueError("bad tag 0x{:x} at offset {}".format(tag, offset - 4))
+
+    if root is None or node is not None:
+        raise ValueError("truncated structure block")
+
+    return root
+
+
+class FconfStatic:
+    def __init__(self, inputfiles: List[str]):
+        self.inputfiles = inputfiles
+        self.roots = []
+
+        for f in inputfiles:
+            try:
+                self.roots.append(parse_dtb(Path(f).read_bytes()))
+            except (OSError, ValueError, struct.error) as e:
+                self.error("{}: {}".format(f, e))
+
+    def error(self, msg: str):
+        print("cot-dt2c: " + msg, file=sys.stderr)
+        sys.exit(1)
+
+    def find_compatible(self, compatible: str) -> Optional[FdtNode]:
+        found = [n for r in self.roots for n in r.walk()
+                 if n.is_compatible(compatible)]
+
+        if len(found) > 1:
+            self.error("more than one \"{}\" node".format(compatible))
+
+        return found[0] if found else None
+
+    def read_cells(self, node: FdtNode, prop: str, cells: int,
+                   optional=False) -> Optional[int]:
+        value = node.props.get(prop)
+
+        if value is None:
+            if optional:
+                return None
+            self.error("{}: missing \"{}\"".format(node.path(), prop))
+
+        if len(value) != 4 * cells:
+            self.error("{}: \"{}\" is not {} cell(s)".format(node.path(), prop,
+                                                           cells))
+
+        return int.from_bytes(value, "big")
+
+    def dtb_registry_to_c(self, f):
+        node = self.find_compatible("fconf,dyn_cfg-dtb_registry")
+
+        f.write("const bool fconf_static_dtb_registry_present = {};\n\n"
+                .format("true" if node else "false"))
+
+        if node is None or not node.children:
+            f.write("const struct dyn_cfg_dtb_info_t fconf_static_dtb_registry[1];\n")
+            f.write("const unsigned int fconf_static_dtb_registry_count = 0U;\n\n")
+            return
+
+        f.write("const struct dyn_cfg_dtb_info_t fconf_static_dtb_registry[] = {\n")
+        for c in node.children:
+            addr = self.read_cells(c, "load-address", 2)
+            size = self.read_cells(c, "max-size", 1)
+            config_id = self.read_cells(c, "id", 1)
+            secondary = self.read_cells(c, "secondary-load-address", 2,
+                                        optional=True)
+
+            f.write("\t/* {} */\n".format(c.name))
+            f.write("\t{\n")
+            f.write("\t\t.config_addr = 0x{:x}UL,\n".format(addr))
+            f.write("\t\t.config_max_size = 0x{:x}U,\n".format(size))
+            f.write("\t\t.config_id = {}U,\n".format(config_id))
+            if secondary is None:
+                f.write("\t\t.secondary_config_addr = ~0UL,\n")
+            else:
+                f.write("\t\t.secondary_config_addr = 0x{:x}UL,\n"
+                        .format(secondary))
+            f.write("\t},\n")
+        f.write("};\n\n")
+        f.write("const unsigned int fconf_static_dtb_registry_count =\n")
+        f.write("\tARRAY_SIZE(fconf_static_dtb_registry);\n\n")
+
+    def tbbr_dyn_config_to_c(self, f):
+        node = self.find_compatible("arm,tb_fw")
+
+        f.write("const bool fconf_static_tbbr_dyn_config_present = {};\n\n"
+                .format("true" if node else "false"))
+
+        if node is None:
+            f.write("const struct tbbr_dyn_config_t fconf_static_tbbr_dyn_config;\n")
+            return
+
+        disable_auth = self.read_cells(node, "disable_auth", 1)
+        if disable_auth not in (0, 1):
+            self.error("{}: invalid value for \"disable_auth\" {}"
+                       .format(node.path(), disable_auth))
+        heap_addr = self.read_cells(node, "mbedtls_heap_addr", 2)
+        heap_size = self.read_cells(node, "mbedtls_heap_size", 1)
+
+        f.write("const struct tbbr_dyn_config_t fconf_static_tbbr_dyn_config = {\n")
+        f.write("\t.disable_auth = {}U,\n".format(disable_auth))
+        f.write("\t.mbedtls_heap_addr = (void *)0x{:x}UL,\n".format(heap_addr))
+        f.write("\t.mbedtls_heap_size = 0x{:x}U,\n".format(heap_size))
+        f.write("};\n")
+
+    def generate_c_file(self, output: str):
+        filename = Path(output)
+        filename.parent.mkdir(exist_ok=True, parents=True)
+
+        with open(output, "w+") as f:
+            f.write("/*\n")
+            f.write(" * Generated by cot-dt2c convert-fconf from:\n")
+            for i in self.inputfiles:
+                f.write(" *   {}\n".format(Path(i).name))
+            f.write(" */\n\n")
+            f.write("#include <stdbool.h>\n\n")
+            f.write("#include <lib/fconf/fconf_dyn_cfg_getter.h>\n")
+            f.write("#include <lib/fconf/fconf_tbbr_getter.h>\n")
+            f.write("#include <lib/utils_def.h>\n\n")
+
+            self.dtb_registry_to_c(f)
+            self.tbbr_dyn_config_to_c(f)
+
+
+def generateFconfMain(output: str, inputfiles: List[str]):
+    FconfStatic(inputfiles).generate_c_file(output)
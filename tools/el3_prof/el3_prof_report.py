@@ -0,0 +1,172 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026, Arm Limited. All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+
+"""
+Report where BL31 spent its time from the PCs sampled with EL3_PROFILING=1.
+
+The input is a raw dump of the el3_prof_bufs array of a running or crashed
+system, for instance taken by a debugger with:
+
+    dump binary memory prof.bin &el3_prof_bufs \\
+        ((char *)&el3_prof_bufs + sizeof(el3_prof_bufs))
+
+and the ELF file of the same BL31 build, which holds the symbols:
+
+    el3_prof_report.py build/fvp/debug/bl31/bl31.elf prof.bin
+"""
+
+import argparse
+import bisect
+import collections
+import struct
+import sys
+
+SHT_SYMTAB = 2
+STT_FUNC = 2
+
+
+class Elf:
+    """Minimal reader of the symbols of a 64-bit ELF file."""
+
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.data = f.read()
+
+        if self.data[:4] != b"\x7fELF" or self.data[4] != 2:
+            raise ValueError("{}: not a 64-bit ELF file".format(path))
+        self.endian = "<" if self.data[5] == 1 else ">"
+
+        (shoff,) = struct.unpack_from(self.endian + "Q", self.data, 0x28)
+        shentsize, shnum = struct.unpack_from(self.endian + "HH", self.data,
+                                              0x3a)
+
+        self.sections = []
+        for i in range(shnum):
+            (_, sh_type, _, _, offset, size, link, _, _,
+             entsize) = struct.unpack_from(self.endian + "IIQQQQIIQQ",
+                                           self.data, shoff + i * shentsize)
+            self.sections.append((sh_type, offset, size, link, entsize))
+
+    def symbols(self):
+        """Yield the (name, address, size, type) of all symbols."""
+        for sh_type, offset, size, link, entsize in self.sections:
+            if sh_type != SHT_SYMTAB:
+                continue
+            strtab = self.sections[link][1]
+            for off in range(offset, offset + size, entsize):
+                st_name, st_info, _, _, value, st_size = struct.unpack_from(
+                    self.endian + "IBBHQQ", self.data, off)
+                end = self.data.index(b"\0", strtab + st_name)
+                yield (self.data[strtab + st_name:end].decode(), value,
+                       st_size, st_info & 0xf)
+
+
+class Functions:
+    """Map addresses to the functions holding them."""
+
+    def __init__(self, elf):
+        funcs = sorted((addr, size, name) for name, addr, size, st_type
+                       in elf.symbols() if st_type == STT_FUNC and name)
+        self.addrs = [f[0] for f in funcs]
+        self.funcs = funcs
+
+    def lookup(self, pc):
+        i = bisect.bisect_right(self.addrs, pc) - 1
+        if i >= 0:
+            addr, size, name = self.funcs[i]
+            if pc < addr + max(size, 4):
+                return name
+        return None
+
+
+def write_hot_list(path, hits, total, cover):
+    """Write the input sections of the functions making up 'cover' percent of
+    the samples, as a fragment of the .text output section of bl31.ld.S."""
+    covered = 0
+    with open(path, "w") as f:
+        f.write("/* Generated by el3_prof_report.py --hot-list */\n")
+        for name, count in hits.most_common():
+            if covered * 100.0 >= cover * total:
+                break
+            covered += count
+            # Addresses that are not in a function have no section
+            if name.startswith("0x"):
+                continue
+            # C functions built with -ffunction-sections, assembly ones
+            # declared with the func macro
+            f.write("*(.text.{0} .text.asm.{0})\n".format(name))
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Report the PCs sampled by BL31 with EL3_PROFILING=1")
+    parser.add_argument("elf", help="ELF file of BL31")
+    parser.add_argument("dump", help="raw dump of el3_prof_bufs")
+    parser.add_argument("--buf-size", type=int, default=4096,
+                        help="EL3_PROF_BUF_SIZE of the build (default 4096)")
+    parser.add_argument("--cpu", type=int, action="append",
+                        help="only report this CPU (may be repeated)")
+    parser.add_argument("--pc", action="store_true",
+                        help="report each PC rather than each function")
+    parser.add_argument("--hot-list", metavar="FILE",
+                        help="also write the most sampled functions to FILE, "
+                        "for BL31_HOT_TEXT_LIST")
+    parser.add_argument("--hot-cover", type=float, default=90.0,
+                        help="percentage of the samples the functions of "
+                        "--hot-list account for (default 90)")
+    args = parser.parse_args()
+    if args.pc and args.hot_list:
+        sys.exit("--hot-list needs the samples by function, not by PC")
+
+    elf = Elf(args.elf)
+    bufs_size = next((size for name, _, size, _ in elf.symbols()
+                      if name == "el3_prof_bufs"), None)
+    if bufs_size is None:
+        sys.exit("{}: no symbol el3_prof_bufs".format(args.elf))
+    with open(args.dump, "rb") as f:
+        dump = f.read()
+    if len(dump) < bufs_size:
+        sys.exit("{}: {} bytes, el3_prof_bufs is {} bytes".format(
+            args.dump, len(dump), bufs_size))
+
+    if args.buf_size < 16 or args.buf_size % 8 or bufs_size % args.buf_size:
+        sys.exit("el3_prof_bufs is {} bytes, not a multiple of {}".format(
+            bufs_size, args.buf_size))
+
+    funcs = Functions(elf)
+    nr_pcs = args.buf_size // 8 - 1
+    hits = collections.Counter()
+
+    for cpu in range(bufs_size // args.buf_size):
+        if args.cpu and cpu not in args.cpu:
+            continue
+        offset = cpu * args.buf_size
+        (head,) = struct.unpack_from(elf.endian + "Q", dump, offset)
+        pcs = struct.unpack_from(elf.endian + "{}Q".format(nr_pcs), dump,
+                                 offset + 8)
+        for pc in pcs[:min(head, nr_pcs)]:
+            name = funcs.lookup(pc)
+            if args.pc:
+                hits["0x{:x} {}".format(pc, name or "?")] += 1
+            else:
+                hits[name or "0x{:x}".format(pc)] += 1
+
+    total = sum(hits.values())
+    if total == 0:
+        sys.exit("no samples")
+
+    print("{:>8} {:>7}  {}".format("samples", "%", "function"))
+    for name, count in hits.most_common():
+        print("{:>8} {:>6.2f}%  {}".format(count, 100.0 * count / total,
+                                           name))
+
+    if args.hot_list:
+        write_hot_list(args.hot_list, hits, total, args.hot_cover)
+
+
+if __name__ == "__main__":
+    main()
@@ -1,4 +1,5 @@
 /*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
  * Copyright (c) 2019, Linaro Limited. All rights reserved.
  * Author: Sumit Garg <sumit.garg@linaro.org>
  *
@@ -8,12 +9,15 @@
 #ifndef ENCRYPT_H
 #define ENCRYPT_H
 
+#include <stdbool.h>
+
 /* Supported key algorithms */
 enum {
 	KEY_ALG_GCM		/* AES-GCM (default) */
 };
 
 int encrypt_file(unsigned short fw_enc_status, int enc_alg, char *key_string,
-		 char *nonce_string, const char *ip_name, const char *op_name);
+		 char *nonce_string, const char *ip_name, const char *op_name,
+		 bool benchmark);
 
 #endif /* ENCRYPT_H */
@@ -1,34 +1,77 @@
 /*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
  * Copyright (c) 2019, Linaro Limited. All rights reserved.
  * Author: Sumit Garg <sumit.garg@linaro.org>
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
 
+#define _POSIX_C_SOURCE 200809L
+
 #include <firmware_encrypted.h>
+#include <openssl/crypto.h>
 #include <openssl/evp.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <time.h>
 #include "debug.h"
 #include "encrypt.h"
 
-#define BUFFER_SIZE		256
+/*
+ * The image is streamed through a single page aligned buffer, encrypted in
+ * place, so the memory used does not depend on the size of the image.
+ */
+#define BUFFER_SIZE		(1024 * 1024)
+#define BUFFER_ALIGN		4096
 #define IV_SIZE			12
 #define IV_STRING_SIZE		24
 #define TAG_SIZE		16
 #define KEY_SIZE		32
 #define KEY_STRING_SIZE		64
 
+static double now(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+static void *alloc_buffer(size_t size)
+{
+#ifdef _WIN32
+	return malloc(size);
+#else
+	void *buf;
+
+	if (posix_memalign(&buf, BUFFER_ALIGN, size) != 0) {
+		return NULL;
+	}
+	return buf;
+#endif
+}
+
+static void report_rate(const char *what, unsigned long long bytes,
+			double secs)
+{
+	printf("%s: %llu bytes in %.3f s, %.1f MB/s\n", what, bytes, secs,
+	       (secs > 0.0) ? (bytes / secs / 1e6) : 0.0);
+}
+
 static int gcm_encrypt(unsigned short fw_enc_status, char *key_string,
 		       char *nonce_string, const char *ip_name,
-		       const char *op_name)
+		       const char *op_name, bool benchmark)
 {
 	FILE *ip_file;
 	FILE *op_file;
 	EVP_CIPHER_CTX *ctx;
-	unsigned char data[BUFFER_SIZE], enc_data[BUFFER_SIZE];
+	unsigned char *data;
 	unsigned char key[KEY_SIZE], iv[IV_SIZE], tag[TAG_SIZE];
-	int bytes, enc_len = 0, i, j, ret = 0;
+	int enc_len = 0, i, j, ret = 0;
+	size_t bytes;
+	unsigned long long total = 0ULL;
+	double start, t, enc_time = 0.0;
 	struct fw_enc_hdr header;
 
 	memset(&header, 0, sizeof(struct fw_enc_hdr));
@@ -57,9 +100,16 @@ static int gcm_encrypt(unsigned short fw_enc_status, char *key_string,
 		}
 	}
 
+	data = alloc_buffer(BUFFER_SIZE);
+	if (data == NULL) {
+		ERROR("Cannot allocate the data buffer\n");
+		return -1;
+	}
+
 	ip_file = fopen(ip_name, "rb");
 	if (ip_file == NULL) {
 		ERROR("Cannot read %s\n", ip_name);
+		free(data);
 		return -1;
 	}
 
@@ -67,9 +117,14 @@ static int gcm_encrypt(unsigned short fw_enc_status, char *key_string,
 	if (op_file == NULL) {
 		ERROR("Cannot write %s\n", op_name);
 		fclose(ip_file);
+		free(data);
 		return -1;
 	}
 
+	/* Large blocks for the streams too, rather than the stdio default */
+	setvbuf(ip_file, NULL, _IOFBF, BUFFER_SIZE);
+	setvbuf(op_file, NULL, _IOFBF, BUFFER_SIZE);
+
 	ret = fseek(op_file, sizeof(struct fw_enc_hdr), SEEK_SET);
 	if (ret) {
 		ERROR("fseek failed\n");
@@ -96,18 +151,33 @@ static int gcm_encrypt(unsigned short fw_enc_status, char *key_string,
 		goto out;
 	}
 
+	start = now();
 	while ((bytes = fread(data, 1, BUFFER_SIZE, ip_file)) != 0) {
-		ret = EVP_EncryptUpdate(ctx, enc_data, &enc_len, data, bytes);
+		t = now();
+		/* GCM is a stream mode, the output is as long as the input */
+		ret = EVP_EncryptUpdate(ctx, data, &enc_len, data, bytes);
 		if (ret != 1) {
 			ERROR("EVP_EncryptUpdate failed\n");
 			ret = -1;
 			goto out;
 		}
+		enc_time += now() - t;
 
-		fwrite(enc_data, 1, enc_len, op_file);
+		if (fwrite(data, 1, enc_len, op_file) != (size_t)enc_len) {
+			ERROR("Cannot write %s\n", op_name);
+			ret = -1;
+			goto out;
+		}
+		total += bytes;
+	}
+
+	if (ferror(ip_file)) {
+		ERROR("Cannot read %s\n", ip_name);
+		ret = -1;
+		goto out;
 	}
 
-	ret = EVP_EncryptFinal_ex(ctx, enc_data, &enc_len);
+	ret = EVP_EncryptFinal_ex(ctx, data, &enc_len);
 	if (ret != 1) {
 		ERROR("EVP_EncryptFinal_ex failed\n");
 		ret = -1;
@@ -135,7 +205,24 @@ static int gcm_encrypt(unsigned short fw_enc_status, char *key_string,
 		goto out;
 	}
 
-	fwrite(&header, 1, sizeof(struct fw_enc_hdr), op_file);
+	if (fwrite(&header, 1, sizeof(struct fw_enc_hdr), op_file) !=
+	    sizeof(struct fw_enc_hdr)) {
+		ERROR("Cannot write %s\n", op_name);
+		ret = -1;
+		goto out;
+	}
+
+	if (fflush(op_file) != 0) {
+		ERROR("Cannot write %s\n", op_name);
+		ret = -1;
+		goto out;
+	}
+
+	if (benchmark) {
+		report_rate("Encryption", total, enc_time);
+		report_rate("Read, encryption and write", total,
+			    now() - start);
+	}
 
 out:
 	EVP_CIPHER_CTX_free(ctx);
@@ -143,6 +230,8 @@ out:
 out_file:
 	fclose(ip_file);
 	fclose(op_file);
+	OPENSSL_cleanse(key, sizeof(key));
+	free(data);
 
 	/*
 	 * EVP_* APIs returns 1 as success but enctool considers
@@ -155,12 +244,13 @@ out_file:
 }
 
 int encrypt_file(unsigned short fw_enc_status, int enc_alg, char *key_string,
-		 char *nonce_string, const char *ip_name, const char *op_name)
+		 char *nonce_string, const char *ip_name, const char *op_name,
+		 bool benchmark)
 {
 	switch (enc_alg) {
 	case KEY_ALG_GCM:
 		return gcm_encrypt(fw_enc_status, key_string, nonce_string,
-				   ip_name, op_name);
+				   ip_name, op_name, benchmark);
 	default:
 		return -1;
 	}
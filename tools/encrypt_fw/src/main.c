@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2024-2026, Arm Limited and Contributors. All rights reserved.
  * Copyright (c) 2019, Linaro Limited. All rights reserved.
  * Author: Sumit Garg <sumit.garg@linaro.org>
  *
@@ -128,6 +128,10 @@ static const cmd_opt_t common_cmd_opt[] = {
 		{ "out", required_argument, NULL, 'o' },
 		"Encrypted output filename."
 	},
+	{
+		{ "benchmark", no_argument, NULL, 'b' },
+		"Report the encryption throughput in MB/s."
+	},
 };
 
 int main(int argc, char *argv[])
@@ -140,6 +144,7 @@ int main(int argc, char *argv[])
 	char *in_fn = NULL;
 	char *out_fn = NULL;
 	unsigned short fw_enc_status = 0;
+	bool benchmark = false;
 
 	NOTICE("Firmware Encryption Tool: %s\n", build_msg);
 
@@ -156,7 +161,7 @@ int main(int argc, char *argv[])
 
 	while (1) {
 		/* getopt_long stores the option index here. */
-		c = getopt_long(argc, argv, "a:f:hi:k:n:o:", cmd_opt, &opt_idx);
+		c = getopt_long(argc, argv, "a:bf:hi:k:n:o:", cmd_opt, &opt_idx);
 
 		/* Detect the end of the options. */
 		if (c == -1) {
@@ -171,6 +176,9 @@ int main(int argc, char *argv[])
 				exit(1);
 			}
 			break;
+		case 'b':
+			benchmark = true;
+			break;
 		case 'f':
 			parse_fw_enc_status_flag(optarg, &fw_enc_status);
 			break;
@@ -216,7 +224,8 @@ int main(int argc, char *argv[])
 		exit(1);
 	}
 
-	ret = encrypt_file(fw_enc_status, key_alg, key, nonce, in_fn, out_fn);
+	ret = encrypt_file(fw_enc_status, key_alg, key, nonce, in_fn, out_fn,
+			   benchmark);
 
 	CRYPTO_cleanup_all_ex_data();
 
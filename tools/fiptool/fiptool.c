@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2024, Arm Limited and Contributors. All rights reserved.
+ * Copyright (c) 2016-2026, Arm Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -8,6 +8,11 @@
 #include <sys/mount.h>
 #endif
 
+#ifndef _MSC_VER
+#include <sys/mman.h>
+#include <pthread.h>
+#endif
+
 #include <sys/types.h>
 #include <sys/stat.h>
 
@@ -26,6 +31,12 @@
 #define OPT_TOC_ENTRY 0
 #define OPT_PLAT_TOC_FLAGS 1
 #define OPT_ALIGN 2
+#define OPT_RESERVE 3
+#define OPT_IN_PLACE 4
+#define OPT_GEOMETRY 5
+
+/* Upper bound of the --threads global option */
+#define MAX_THREADS 64
 
 static int info_cmd(int argc, char *argv[]);
 static void info_usage(int);
@@ -57,6 +68,35 @@ static image_desc_t *image_desc_head;
 static size_t nr_image_descs;
 static const uuid_t uuid_null;
 static int verbose;
+static unsigned long nr_threads = 1;
+
+/* Geometry of the storage the FIP is laid out for, all zero if not given. */
+static struct {
+	uint64_t block;	/* Smallest addressable unit */
+	uint64_t page;	/* Optimal transfer size */
+	uint64_t erase;	/* Erase block size */
+} geometry;
+
+/*
+ * Images loaded first at boot, placed contiguously at the front of the FIP
+ * when laying it out for a storage geometry.
+ */
+static const char *hot_images[] = {
+	"fw-config",
+	"tb-fw-cert",
+	"tb-fw",
+	"tb-fw-config",
+	"rot-cert",
+	"cca-cert",
+	"trusted-key-cert",
+	"plat-key-cert",
+	"soc-fw-key-cert",
+	"soc-fw-cert",
+	"soc-fw",
+	"soc-fw-config",
+	"hw-config",
+	NULL
+};
 
 static void vlog(int prio, const char *msg, va_list ap)
 {
@@ -138,6 +178,77 @@ static void xfwrite(void *buf, size_t size, FILE *fp, const char *filename)
 		log_errx("Failed to write %s", filename);
 }
 
+static void free_image(image_t *image)
+{
+#ifndef _MSC_VER
+	if (image->map_size != 0) {
+		munmap(image->buffer, image->map_size);
+		free(image);
+		return;
+	}
+#endif
+	free(image->buffer);
+	free(image);
+}
+
+#ifndef _MSC_VER
+struct job_pool {
+	pthread_mutex_t lock;
+	size_t next;
+	size_t nr_jobs;
+	void (*fn)(size_t idx, void *arg);
+	void *arg;
+};
+
+static void *job_worker(void *arg)
+{
+	struct job_pool *pool = arg;
+	size_t idx;
+
+	for (;;) {
+		pthread_mutex_lock(&pool->lock);
+		idx = pool->next++;
+		pthread_mutex_unlock(&pool->lock);
+		if (idx >= pool->nr_jobs)
+			break;
+		pool->fn(idx, pool->arg);
+	}
+	return NULL;
+}
+
+/*
+ * Call fn() for each index below nr_jobs, spreading the calls over up to
+ * nr_threads threads. The jobs are independent and run in no specific order.
+ */
+static void run_jobs(size_t nr_jobs, void (*fn)(size_t idx, void *arg),
+    void *arg)
+{
+	struct job_pool pool = { .nr_jobs = nr_jobs, .fn = fn, .arg = arg };
+	pthread_t threads[MAX_THREADS - 1];
+	size_t i, nr_workers;
+
+	nr_workers = nr_threads < nr_jobs ? nr_threads : nr_jobs;
+	if (nr_workers <= 1) {
+		for (i = 0; i < nr_jobs; i++)
+			fn(i, arg);
+		return;
+	}
+
+	if (pthread_mutex_init(&pool.lock, NULL) != 0)
+		log_errx("Failed to initialise the job lock");
+
+	/* The calling thread is one of the workers. */
+	for (i = 0; i < nr_workers - 1; i++)
+		if (pthread_create(&threads[i], NULL, job_worker, &pool) != 0)
+			log_errx("Failed to create a worker thread");
+	job_worker(&pool);
+	for (i = 0; i < nr_workers - 1; i++)
+		pthread_join(threads[i], NULL);
+
+	pthread_mutex_destroy(&pool.lock);
+}
+#endif
+
 static image_desc_t *new_image_desc(const uuid_t *uuid,
     const char *name, const char *cmdline_name)
 {
@@ -173,10 +284,8 @@ static void free_image_desc(image_desc_t *desc)
 	free(desc->name);
 	free(desc->cmdline_name);
 	free(desc->action_arg);
-	if (desc->image) {
-		free(desc->image->buffer);
-		free(desc->image);
-	}
+	if (desc->image)
+		free_image(desc->image);
 	free(desc);
 }
 
@@ -415,10 +524,27 @@ static image_t *read_image_from_file(const uuid_t *uuid, const char *filename)
 
 	image = xzalloc(sizeof(*image), "failed to allocate memory for image");
 	image->toc_e.uuid = *uuid;
+	image->toc_e.size = st.st_size;
+
+#ifndef _MSC_VER
+	/*
+	 * Map the image rather than reading it, the pages then only go through
+	 * the page cache once when the FIP is written.
+	 */
+	if (st.st_size > 0) {
+		image->buffer = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE,
+		    fileno(fp), 0);
+		if (image->buffer != MAP_FAILED) {
+			image->map_size = st.st_size;
+			fclose(fp);
+			return image;
+		}
+	}
+#endif
+
 	image->buffer = xmalloc(st.st_size, "failed to allocate image buffer");
 	if (fread(image->buffer, 1, st.st_size, fp) != st.st_size)
 		log_errx("Failed to read %s", filename);
-	image->toc_e.size = st.st_size;
 
 	fclose(fp);
 	return image;
@@ -471,10 +597,29 @@ static void md_print(const unsigned char *md, size_t len)
 }
 #endif
 
+#if !defined(_MSC_VER) && !STATIC
+struct hash_jobs {
+	image_t **images;
+	unsigned char (*mds)[SHA256_DIGEST_LENGTH];
+};
+
+static void hash_image_job(size_t idx, void *arg)
+{
+	struct hash_jobs *jobs = arg;
+
+	SHA256(jobs->images[idx]->buffer, jobs->images[idx]->toc_e.size,
+	    jobs->mds[idx]);
+}
+#endif
+
 static int info_cmd(int argc, char *argv[])
 {
 	image_desc_t *desc;
 	fip_toc_header_t toc_header;
+#if !defined(_MSC_VER) && !STATIC
+	struct hash_jobs jobs = { NULL, NULL };
+	size_t nr_images = 0, idx = 0;
+#endif
 
 	if (argc != 2)
 		info_usage(EXIT_FAILURE);
@@ -491,6 +636,26 @@ static int info_cmd(int argc, char *argv[])
 		    (unsigned long long)toc_header.flags);
 	}
 
+#if !defined(_MSC_VER) && !STATIC
+	/* Hash all the images up front, in parallel with --threads. */
+	if (verbose) {
+		for (desc = image_desc_head; desc != NULL; desc = desc->next)
+			if (desc->image != NULL)
+				nr_images++;
+
+		jobs.images = xmalloc(nr_images * sizeof(*jobs.images) + 1,
+		    "failed to allocate memory for image list");
+		jobs.mds = xmalloc(nr_images * sizeof(*jobs.mds) + 1,
+		    "failed to allocate memory for image digests");
+		for (desc = image_desc_head; desc != NULL; desc = desc->next)
+			if (desc->image != NULL)
+				jobs.images[idx++] = desc->image;
+
+		run_jobs(nr_images, hash_image_job, &jobs);
+		idx = 0;
+	}
+#endif
+
 	for (desc = image_desc_head; desc != NULL; desc = desc->next) {
 		image_t *image = desc->image;
 
@@ -509,16 +674,17 @@ static int info_cmd(int argc, char *argv[])
 		 */
 #if !defined(_MSC_VER) && !STATIC
 		if (verbose) {
-			unsigned char md[SHA256_DIGEST_LENGTH];
-
-			SHA256(image->buffer, image->toc_e.size, md);
 			printf(", sha256=");
-			md_print(md, sizeof(md));
+			md_print(jobs.mds[idx++], SHA256_DIGEST_LENGTH);
 		}
 #endif
 		putchar('\n');
 	}
 
+#if !defined(_MSC_VER) && !STATIC
+	free(jobs.images);
+	free(jobs.mds);
+#endif
 	return 0;
 }
 
@@ -528,7 +694,176 @@ static void info_usage(int exit_status)
 	exit(exit_status);
 }
 
-static int pack_images(const char *filename, uint64_t toc_flags, unsigned long align)
+#ifndef _MSC_VER
+/* Largest single write, below what pwrite() can report */
+#define MAX_WRITE_SIZE (1UL << 30)
+
+struct write_jobs {
+	image_t **images;
+	int fd;
+	const char *filename;
+};
+
+static void write_image_job(size_t idx, void *arg)
+{
+	struct write_jobs *jobs = arg;
+	const image_t *image = jobs->images[idx];
+	const char *p = image->buffer;
+	uint64_t offset = image->toc_e.offset_address;
+	uint64_t left = image->toc_e.size;
+	ssize_t n;
+
+	while (left > 0) {
+		n = pwrite(jobs->fd, p,
+		    left < MAX_WRITE_SIZE ? left : MAX_WRITE_SIZE, offset);
+		if (n < 0 && errno == EINTR)
+			continue;
+		if (n <= 0)
+			log_errx("Failed to write %s", jobs->filename);
+		p += n;
+		offset += n;
+		left -= n;
+	}
+}
+
+/*
+ * Write each image at its offset in the FIP. The images do not overlap, so
+ * with --threads they are written in parallel.
+ */
+static void write_images(FILE *fp, const char *filename, size_t nr_images)
+{
+	struct write_jobs jobs = { NULL, fileno(fp), filename };
+	image_desc_t *desc;
+	size_t idx = 0;
+
+	jobs.images = xmalloc(nr_images * sizeof(*jobs.images) + 1,
+	    "failed to allocate memory for image list");
+	for (desc = image_desc_head; desc != NULL; desc = desc->next)
+		if (desc->image != NULL)
+			jobs.images[idx++] = desc->image;
+
+	if (fflush(fp) != 0)
+		log_err("Failed to write %s", filename);
+	run_jobs(nr_images, write_image_job, &jobs);
+	free(jobs.images);
+}
+#endif
+
+static uint64_t round_up_to(uint64_t x, uint64_t align)
+{
+	return align > 1 ? (x + align - 1) / align * align : x;
+}
+
+static uint64_t place_image(image_t *image, uint64_t *cursor,
+    uint64_t granule, uint64_t reserve)
+{
+	uint64_t offset = round_up_to(*cursor, granule);
+	uint64_t size = image->toc_e.size;
+
+	/* Move an image that would straddle an erase block it fits in. */
+	if (geometry.erase != 0 && size <= geometry.erase &&
+	    offset / geometry.erase != (offset + size - 1) / geometry.erase)
+		offset = round_up_to(offset, geometry.erase);
+
+	image->toc_e.offset_address = offset;
+	*cursor = offset + size + reserve;
+	return offset + size;
+}
+
+/*
+ * Lay the images out for the storage geometry: each image starts on a block
+ * and page boundary, does not straddle an erase block when it fits in one,
+ * and the images loaded first at boot come first. Returns the end of the
+ * last image placed.
+ */
+static uint64_t plan_images(uint64_t start, unsigned long align,
+    uint64_t reserve)
+{
+	image_desc_t *desc;
+	uint64_t granule = align, cursor = start, end = start;
+	size_t i;
+
+	if (geometry.block > granule)
+		granule = geometry.block;
+	if (geometry.page > granule)
+		granule = geometry.page;
+
+	for (desc = image_desc_head; desc != NULL; desc = desc->next)
+		if (desc->image != NULL)
+			desc->image->toc_e.offset_address = UINT64_MAX;
+
+	for (i = 0; hot_images[i] != NULL; i++) {
+		desc = lookup_image_desc_from_opt(hot_images[i]);
+		if (desc == NULL || desc->image == NULL ||
+		    desc->image->toc_e.size == 0ULL)
+			continue;
+		end = place_image(desc->image, &cursor, granule, reserve);
+	}
+
+	for (desc = image_desc_head; desc != NULL; desc = desc->next) {
+		image_t *image = desc->image;
+
+		if (image == NULL || image->toc_e.size == 0ULL ||
+		    image->toc_e.offset_address != UINT64_MAX)
+			continue;
+		end = place_image(image, &cursor, granule, reserve);
+	}
+
+	return end;
+}
+
+/*
+ * Print, in FIP order, the number of reads of the optimal transfer size, or
+ * of blocks, and the number of erase blocks each image takes on the device.
+ */
+static void report_layout(void)
+{
+	uint64_t unit = geometry.page != 0 ? geometry.page : geometry.block;
+	unsigned long long total = 0;
+	image_desc_t *desc, *next;
+	uint64_t last = 0;
+
+	if (unit == 0)
+		unit = 1;
+
+	for (;;) {
+		uint64_t offset, size, reads, erases = 0;
+
+		/* Pick the image following the last one reported. */
+		next = NULL;
+		for (desc = image_desc_head; desc != NULL; desc = desc->next) {
+			image_t *image = desc->image;
+
+			if (image == NULL || image->toc_e.size == 0ULL ||
+			    image->toc_e.offset_address < last)
+				continue;
+			if (next == NULL || image->toc_e.offset_address <
+			    next->image->toc_e.offset_address)
+				next = desc;
+		}
+		if (next == NULL)
+			break;
+
+		offset = next->image->toc_e.offset_address;
+		size = next->image->toc_e.size;
+		reads = (offset + size - 1) / unit - offset / unit + 1;
+		if (geometry.erase != 0)
+			erases = (offset + size - 1) / geometry.erase -
+			    offset / geometry.erase + 1;
+		total += reads;
+		printf("%s: offset=0x%llX, size=0x%llX, reads=%llu, erase-blocks=%llu%s\n",
+		    next->cmdline_name, (unsigned long long)offset,
+		    (unsigned long long)size, (unsigned long long)reads,
+		    (unsigned long long)erases,
+		    offset % unit != 0 ? ", unaligned" : "");
+		last = offset + 1;
+	}
+	printf("Total reads: %llu of 0x%llX bytes\n", total,
+	    (unsigned long long)unit);
+}
+
+static int pack_images(const char *filename, uint64_t toc_flags,
+    unsigned long align, uint64_t reserve)
 {
 	FILE *fp;
 	image_desc_t *desc;
@@ -557,16 +892,21 @@ static int pack_images(const char *filename, uint64_t toc_flags, unsigned long a
 	toc_entry = (fip_toc_entry_t *)(toc_header + 1);
 
 	entry_offset = buf_size;
+	if (geometry.block != 0)
+		entry_offset = plan_images(buf_size, align, reserve);
 	for (desc = image_desc_head; desc != NULL; desc = desc->next) {
 		image_t *image = desc->image;
 
 		if (image == NULL || (image->toc_e.size == 0ULL))
 			continue;
 		payload_size += image->toc_e.size;
-		entry_offset = (entry_offset + align - 1) & ~(align - 1);
-		image->toc_e.offset_address = entry_offset;
+		if (geometry.block == 0) {
+			entry_offset = (entry_offset + align - 1) &
+			    ~(align - 1);
+			image->toc_e.offset_address = entry_offset;
+			entry_offset += image->toc_e.size + reserve;
+		}
 		*toc_entry++ = image->toc_e;
-		entry_offset += image->toc_e.size;
 	}
 
 	/*
@@ -590,6 +930,9 @@ static int pack_images(const char *filename, uint64_t toc_flags, unsigned long a
 	if (verbose)
 		log_dbgx("Payload size: %zu bytes", payload_size);
 
+#ifndef _MSC_VER
+	write_images(fp, filename, nr_images);
+#else
 	for (desc = image_desc_head; desc != NULL; desc = desc->next) {
 		image_t *image = desc->image;
 
@@ -600,6 +943,7 @@ static int pack_images(const char *filename, uint64_t toc_flags, unsigned long a
 
 		xfwrite(image->buffer, image->toc_e.size, fp, filename);
 	}
+#endif
 
 	if (fseek(fp, entry_offset, SEEK_SET))
 		log_errx("Failed to set file position");
@@ -610,6 +954,9 @@ static int pack_images(const char *filename, uint64_t toc_flags, unsigned long a
 
 	free(buf);
 	fclose(fp);
+
+	if (geometry.block != 0)
+		report_layout();
 	return 0;
 }
 
@@ -639,7 +986,7 @@ static void update_fip(void)
 				    desc->cmdline_name,
 				    desc->action_arg);
 			}
-			free(desc->image);
+			free_image(desc->image);
 			desc->image = image;
 		} else {
 			if (verbose)
@@ -650,6 +997,172 @@ static void update_fip(void)
 	}
 }
 
+/* Where an image of the FIP being updated sat before the update. */
+struct fip_slot {
+	image_desc_t *desc;
+	uint64_t offset;
+	uint64_t end;	/* Offset of the next image, or UINT64_MAX */
+};
+
+static void write_fip_range(FILE *fp, const char *filename, uint64_t offset,
+    const void *buf, uint64_t size, const char *what)
+{
+	if (fseek(fp, offset, SEEK_SET))
+		log_errx("Failed to set file position");
+	xfwrite((void *)buf, size, fp, filename);
+	printf("0x%08llX-0x%08llX %s\n", (unsigned long long)offset,
+	    (unsigned long long)(offset + size), what);
+}
+
+/*
+ * Update the FIP in place: the images that are not replaced stay where they
+ * are, and so does a replaced image that still fits before the image that
+ * follows it, in the padding left by --align or --reserve. The other images
+ * are appended at the end of the FIP. Only the ToC, the new payloads and the
+ * padding at the end are written, and the ranges touched are printed so that
+ * the flash can be updated partially.
+ *
+ * Returns -1 without writing anything if the ToC no longer fits before the
+ * first image, the FIP is then to be packed again.
+ */
+static int update_fip_in_place(const char *filename, uint64_t toc_flags,
+    unsigned long align, uint64_t reserve)
+{
+	struct fip_slot *slots;
+	size_t nr_slots = 0, nr_images = 0, i, j;
+	image_desc_t *desc;
+	fip_toc_header_t *toc_header;
+	fip_toc_entry_t *toc_entry;
+	char *buf;
+	uint64_t buf_size, fip_end = 0, cursor, first = UINT64_MAX;
+	long file_size;
+	FILE *fp;
+
+	for (desc = image_desc_head; desc != NULL; desc = desc->next)
+		nr_slots++;
+	slots = xzalloc(nr_slots * sizeof(*slots) + 1,
+	    "failed to allocate memory for image slots");
+
+	/* Record where the images of the FIP are before replacing them. */
+	nr_slots = 0;
+	for (desc = image_desc_head; desc != NULL; desc = desc->next) {
+		image_t *image = desc->image;
+
+		if (image == NULL || image->toc_e.size == 0ULL)
+			continue;
+		slots[nr_slots].desc = desc;
+		slots[nr_slots].offset = image->toc_e.offset_address;
+		slots[nr_slots].end = UINT64_MAX;
+		if (image->toc_e.offset_address + image->toc_e.size > fip_end)
+			fip_end = image->toc_e.offset_address +
+			    image->toc_e.size;
+		nr_slots++;
+	}
+	for (i = 0; i < nr_slots; i++)
+		for (j = 0; j < nr_slots; j++)
+			if (slots[j].offset > slots[i].offset &&
+			    slots[j].offset < slots[i].end)
+				slots[i].end = slots[j].offset;
+
+	update_fip();
+
+	/* Keep the images that still fit in their slot where they are. */
+	for (desc = image_desc_head; desc != NULL; desc = desc->next) {
+		image_t *image = desc->image;
+		struct fip_slot *slot = NULL;
+
+		if (image == NULL || image->toc_e.size == 0ULL)
+			continue;
+		nr_images++;
+		for (i = 0; i < nr_slots; i++)
+			if (slots[i].desc == desc)
+				slot = &slots[i];
+
+		if (slot != NULL && (slot->offset & (align - 1)) == 0 &&
+		    image->toc_e.size <= slot->end - slot->offset) {
+			image->toc_e.offset_address = slot->offset;
+			if (slot->offset + image->toc_e.size > fip_end)
+				fip_end = slot->offset + image->toc_e.size;
+		} else {
+			/* Placed below, once the end of the FIP is known. */
+			image->toc_e.offset_address = UINT64_MAX;
+		}
+	}
+
+	cursor = fip_end;
+	for (desc = image_desc_head; desc != NULL; desc = desc->next) {
+		image_t *image = desc->image;
+
+		if (image == NULL || image->toc_e.size == 0ULL)
+			continue;
+		if (image->toc_e.offset_address == UINT64_MAX) {
+			cursor = (cursor + align - 1) & ~(align - 1);
+			image->toc_e.offset_address = cursor;
+			cursor += image->toc_e.size + reserve;
+		}
+		if (image->toc_e.offset_address < first)
+			first = image->toc_e.offset_address;
+	}
+	free(slots);
+
+	buf_size = sizeof(fip_toc_header_t) +
+	    sizeof(fip_toc_entry_t) * (nr_images + 1);
+	if (buf_size > first)
+		return -1;
+
+	buf = xzalloc(buf_size, "failed to allocate memory for ToC");
+	toc_header = (fip_toc_header_t *)buf;
+	toc_header->name = TOC_HEADER_NAME;
+	toc_header->serial_number = TOC_HEADER_SERIAL_NUMBER;
+	toc_header->flags = toc_flags;
+
+	toc_entry = (fip_toc_entry_t *)(toc_header + 1);
+	for (desc = image_desc_head; desc != NULL; desc = desc->next) {
+		image_t *image = desc->image;
+
+		if (image == NULL || image->toc_e.size == 0ULL)
+			continue;
+		*toc_entry++ = image->toc_e;
+	}
+
+	/* The offset of the terminator must match the FIP size. */
+	memset(toc_entry, 0, sizeof(*toc_entry));
+	toc_entry->offset_address = (cursor + align - 1) & ~(align - 1);
+
+	fp = fopen(filename, "r+b");
+	if (fp == NULL)
+		log_err("fopen %s", filename);
+
+	write_fip_range(fp, filename, 0, buf, buf_size, "ToC");
+
+	for (desc = image_desc_head; desc != NULL; desc = desc->next) {
+		image_t *image = desc->image;
+
+		if (image == NULL || image->toc_e.size == 0ULL ||
+		    desc->action != DO_PACK)
+			continue;
+		write_fip_range(fp, filename, image->toc_e.offset_address,
+		    image->buffer, image->toc_e.size, desc->cmdline_name);
+	}
+
+	/* Pad the end of the FIP if it grew. */
+	if (fseek(fp, 0, SEEK_END) || (file_size = ftell(fp)) < 0)
+		log_errx("Failed to set file position");
+	if ((uint64_t)file_size < toc_entry->offset_address) {
+		uint64_t pad_size = toc_entry->offset_address - file_size;
+
+		printf("0x%08llX-0x%08llX padding\n",
+		    (unsigned long long)file_size,
+		    (unsigned long long)toc_entry->offset_address);
+		while (pad_size--)
+			fputc(0x0, fp);
+	}
+
+	free(buf);
+	fclose(fp);
+	return 0;
+}
+
 static void parse_plat_toc_flags(const char *arg, unsigned long long *toc_flags)
 {
 	unsigned long long flags;
@@ -681,6 +1194,55 @@ static unsigned long get_image_align(char *arg)
 	return align;
 }
 
+static uint64_t get_image_reserve(char *arg)
+{
+	char *endptr;
+	unsigned long long reserve;
+
+	errno = 0;
+	reserve = strtoull(arg, &endptr, 0);
+	if (*endptr != '\0' || errno != 0)
+		log_errx("Invalid reserve: %s", arg);
+
+	return reserve;
+}
+
+static uint64_t get_geometry_size(const char *arg, const char *name)
+{
+	char *endptr;
+	unsigned long long size;
+
+	errno = 0;
+	size = strtoull(arg, &endptr, 0);
+	if (*endptr != '\0' || size == 0 || errno != 0)
+		log_errx("Invalid %s size: %s", name, arg);
+
+	return size;
+}
+
+static void parse_geometry_opt(char *arg)
+{
+	char *p;
+
+	for (p = strtok(arg, ","); p != NULL; p = strtok(NULL, ",")) {
+		if (strncmp(p, "block=", strlen("block=")) == 0)
+			geometry.block = get_geometry_size(p + strlen("block="),
+			    "block");
+		else if (strncmp(p, "page=", strlen("page=")) == 0)
+			geometry.page = get_geometry_size(p + strlen("page="),
+			    "page");
+		else if (strncmp(p, "erase=", strlen("erase=")) == 0)
+			geometry.erase = get_geometry_size(p + strlen("erase="),
+			    "erase");
+		else
+			log_errx("Invalid geometry: %s", p);
+	}
+
+	/* The block size defaults to the page size, or a byte. */
+	if (geometry.block == 0)
+		geometry.block = geometry.page != 0 ? geometry.page : 1;
+}
+
 static void parse_blob_opt(char *arg, uuid_t *uuid, char *filename, size_t len)
 {
 	char *p;
@@ -702,6 +1264,7 @@ static int create_cmd(int argc, char *argv[])
 	size_t nr_opts = 0;
 	unsigned long long toc_flags = 0;
 	unsigned long align = 1;
+	uint64_t reserve = 0;
 
 	if (argc < 2)
 		create_usage(EXIT_FAILURE);
@@ -711,6 +1274,10 @@ static int create_cmd(int argc, char *argv[])
 	    OPT_PLAT_TOC_FLAGS);
 	opts = add_opt(opts, &nr_opts, "align", required_argument, OPT_ALIGN);
 	opts = add_opt(opts, &nr_opts, "blob", required_argument, 'b');
+	opts = add_opt(opts, &nr_opts, "reserve", required_argument,
+	    OPT_RESERVE);
+	opts = add_opt(opts, &nr_opts, "geometry", required_argument,
+	    OPT_GEOMETRY);
 	opts = add_opt(opts, &nr_opts, NULL, 0, 0);
 
 	while (1) {
@@ -734,6 +1301,12 @@ static int create_cmd(int argc, char *argv[])
 		case OPT_ALIGN:
 			align = get_image_align(optarg);
 			break;
+		case OPT_RESERVE:
+			reserve = get_image_reserve(optarg);
+			break;
+		case OPT_GEOMETRY:
+			parse_geometry_opt(optarg);
+			break;
 		case 'b': {
 			char name[_UUID_STR_LEN + 1];
 			char filename[PATH_MAX] = { 0 };
@@ -769,7 +1342,7 @@ static int create_cmd(int argc, char *argv[])
 
 	update_fip();
 
-	pack_images(argv[0], toc_flags, align);
+	pack_images(argv[0], toc_flags, align, reserve);
 	return 0;
 }
 
@@ -782,7 +1355,10 @@ static void create_usage(int exit_status)
 	printf("Options:\n");
 	printf("  --align <value>\t\tEach image is aligned to <value> (default: 1).\n");
 	printf("  --blob uuid=...,file=...\tAdd an image with the given UUID pointed to by file.\n");
+	printf("  --geometry block=...,page=...,erase=...\n");
+	printf("\t\t\t\tLay the images out for the storage geometry and report the reads per image.\n");
 	printf("  --plat-toc-flags <value>\t16-bit platform specific flag field occupying bits 32-47 in 64-bit ToC header.\n");
+	printf("  --reserve <value>\t\tLeave <value> bytes of padding after each image (default: 0).\n");
 	printf("\n");
 	printf("Specific images are packed with the following options:\n");
 	for (; toc_entry->cmdline_name != NULL; toc_entry++)
@@ -805,7 +1381,8 @@ static int update_cmd(int argc, char *argv[])
 	fip_toc_header_t toc_header = { 0 };
 	unsigned long long toc_flags = 0;
 	unsigned long align = 1;
-	int pflag = 0;
+	uint64_t reserve = 0;
+	int pflag = 0, iflag = 0;
 
 	if (argc < 2)
 		update_usage(EXIT_FAILURE);
@@ -813,9 +1390,14 @@ static int update_cmd(int argc, char *argv[])
 	opts = fill_common_opts(opts, &nr_opts, required_argument);
 	opts = add_opt(opts, &nr_opts, "align", required_argument, OPT_ALIGN);
 	opts = add_opt(opts, &nr_opts, "blob", required_argument, 'b');
+	opts = add_opt(opts, &nr_opts, "in-place", no_argument, OPT_IN_PLACE);
 	opts = add_opt(opts, &nr_opts, "out", required_argument, 'o');
 	opts = add_opt(opts, &nr_opts, "plat-toc-flags", required_argument,
 	    OPT_PLAT_TOC_FLAGS);
+	opts = add_opt(opts, &nr_opts, "reserve", required_argument,
+	    OPT_RESERVE);
+	opts = add_opt(opts, &nr_opts, "geometry", required_argument,
+	    OPT_GEOMETRY);
 	opts = add_opt(opts, &nr_opts, NULL, 0, 0);
 
 	while (1) {
@@ -862,6 +1444,15 @@ static int update_cmd(int argc, char *argv[])
 		case OPT_ALIGN:
 			align = get_image_align(optarg);
 			break;
+		case OPT_RESERVE:
+			reserve = get_image_reserve(optarg);
+			break;
+		case OPT_GEOMETRY:
+			parse_geometry_opt(optarg);
+			break;
+		case OPT_IN_PLACE:
+			iflag = 1;
+			break;
 		case 'o':
 			snprintf(outfile, sizeof(outfile), "%s", optarg);
 			break;
@@ -879,16 +1470,31 @@ static int update_cmd(int argc, char *argv[])
 	if (outfile[0] == '\0')
 		snprintf(outfile, sizeof(outfile), "%s", argv[0]);
 
+	if (iflag && strcmp(outfile, argv[0]) != 0)
+		log_errx("--in-place cannot be used with a different --out");
+	if (iflag && geometry.block != 0)
+		log_errx("--in-place cannot be used with --geometry");
+
 	if (access(argv[0], F_OK) == 0)
 		parse_fip(argv[0], &toc_header);
+	else if (iflag)
+		log_errx("--in-place needs an existing FIP %s", argv[0]);
 
 	if (pflag)
 		toc_header.flags &= ~(0xffffULL << 32);
 	toc_flags = (toc_header.flags |= toc_flags);
 
-	update_fip();
+	if (iflag) {
+		if (update_fip_in_place(outfile, toc_flags, align,
+		    reserve) == 0)
+			return 0;
+		log_warnx("The ToC of %s does not fit, packing it again",
+		    outfile);
+	} else {
+		update_fip();
+	}
 
-	pack_images(outfile, toc_flags, align);
+	pack_images(outfile, toc_flags, align, reserve);
 	return 0;
 }
 
@@ -901,8 +1507,12 @@ static void update_usage(int exit_status)
 	printf("Options:\n");
 	printf("  --align <value>\t\tEach image is aligned to <value> (default: 1).\n");
 	printf("  --blob uuid=...,file=...\tAdd or update an image with the given UUID pointed to by file.\n");
+	printf("  --geometry block=...,page=...,erase=...\n");
+	printf("\t\t\t\tLay the images out for the storage geometry and report the reads per image.\n");
+	printf("  --in-place\t\t\tOnly rewrite the ToC and the updated images, print the ranges written.\n");
 	printf("  --out FIP_FILENAME\t\tSet an alternative output FIP file.\n");
 	printf("  --plat-toc-flags <value>\t16-bit platform specific flag field occupying bits 32-47 in 64-bit ToC header.\n");
+	printf("  --reserve <value>\t\tLeave <value> bytes of padding after each image (default: 0).\n");
 	printf("\n");
 	printf("Specific images are packed with the following options:\n");
 	for (; toc_entry->cmdline_name != NULL; toc_entry++)
@@ -1151,7 +1761,7 @@ static int remove_cmd(int argc, char *argv[])
 			if (verbose)
 				log_dbgx("Removing %s",
 				    desc->cmdline_name);
-			free(desc->image);
+			free_image(desc->image);
 			desc->image = NULL;
 		} else {
 			log_warnx("%s does not exist in %s",
@@ -1159,7 +1769,7 @@ static int remove_cmd(int argc, char *argv[])
 		}
 	}
 
-	pack_images(outfile, toc_header.flags, align);
+	pack_images(outfile, toc_header.flags, align, 0);
 	return 0;
 }
 
@@ -1225,9 +1835,12 @@ static int help_cmd(int argc, char *argv[])
 
 static void usage(void)
 {
-	printf("usage: fiptool [--verbose] <command> [<args>]\n");
+	printf("usage: fiptool [--verbose] [--threads N] <command> [<args>]\n");
 	printf("Global options supported:\n");
 	printf("  --verbose\tEnable verbose output for all commands.\n");
+#ifndef _MSC_VER
+	printf("  --threads N\tHash and write up to N images in parallel.\n");
+#endif
 	printf("\n");
 	printf("Commands supported:\n");
 	printf("  info\t\tList images contained in FIP.\n");
@@ -1248,8 +1861,14 @@ int main(int argc, char *argv[])
 		int c, opt_index = 0;
 		static struct option opts[] = {
 			{ "verbose", no_argument, NULL, 'v' },
+#ifndef _MSC_VER
+			{ "threads", required_argument, NULL, 'j' },
+#endif
 			{ NULL, no_argument, NULL, 0 }
 		};
+#ifndef _MSC_VER
+		char *endptr;
+#endif
 
 		/*
 		 * Set POSIX mode so getopt stops at the first non-option
@@ -1263,6 +1882,16 @@ int main(int argc, char *argv[])
 		case 'v':
 			verbose = 1;
 			break;
+#ifndef _MSC_VER
+		case 'j':
+			errno = 0;
+			nr_threads = strtoul(optarg, &endptr, 0);
+			if (*endptr != '\0' || errno != 0 || nr_threads == 0 ||
+			    nr_threads > MAX_THREADS)
+				log_errx("Invalid number of threads: %s, must be "
+				    "between 1 and %d", optarg, MAX_THREADS);
+			break;
+#endif
 		default:
 			usage();
 		}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016-2017, ARM Limited and Contributors. All rights reserved.
+ * Copyright (c) 2016-2026, ARM Limited and Contributors. All rights reserved.
  *
  * SPDX-License-Identifier: BSD-3-Clause
  */
@@ -43,6 +43,7 @@ typedef struct image_desc {
 typedef struct image {
 	struct fip_toc_entry toc_e;
 	void                *buffer;
+	size_t               map_size;	/* Non-zero if buffer is mapped */
 } image_t;
 
 typedef struct cmd {
@@ -0,0 +1,19 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#ifndef HOST_COMPAT_H
+#define HOST_COMPAT_H
+
+/*
+ * Included ahead of the firmware sources, which are built against the C
+ * library of the host. It lacks the register types of the firmware one.
+ */
+#include <stdint.h>
+
+typedef long register_t;
+typedef unsigned long u_register_t;
+
+#endif /* HOST_COMPAT_H */
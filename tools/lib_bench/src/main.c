@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2026, Arm Limited and Contributors. All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+#include <errno.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#endif
+
+#include <lib/lib_bench.h>
+
+/*
+ * The suite is timed with the cycle counter of the cpu through the perf
+ * events of Linux when they are available, and in nanoseconds otherwise.
+ */
+static int perf_fd = -1;
+
+static uint64_t host_ns(void)
+{
+	struct timespec ts;
+
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+
+	return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+static uint64_t host_cycles(void)
+{
+	uint64_t count = 0U;
+
+	if (read(perf_fd, &count, sizeof(count)) != (ssize_t)sizeof(count)) {
+		return 0U;
+	}
+
+	return count;
+}
+
+static int host_start(void)
+{
+	return 0;
+}
+
+static void host_stop(void)
+{
+	if (perf_fd >= 0) {
+		(void)close(perf_fd);
+		perf_fd = -1;
+	}
+}
+
+static lib_bench_counter_t host_counter = {
+	.unit = "ns",
+	.start = host_start,
+	.read = host_ns,
+	.stop = host_stop,
+};
+
+static void host_counter_init(void)
+{
+#ifdef __linux__
+	struct perf_event_attr attr;
+
+	memset(&attr, 0, sizeof(attr));
+	attr.type = PERF_TYPE_HARDWARE;
+	attr.size = sizeof(attr);
+	attr.config = PERF_COUNT_HW_CPU_CYCLES;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+
+	perf_fd = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+	if (perf_fd >= 0) {
+		host_counter.unit = "cycles";
+		host_counter.read = host_cycles;
+	}
+#endif
+}
+
+/* Messages logged by the libraries, which start with their log level */
+void tf_log(const char *fmt, ...);
+void tf_log(const char *fmt, ...)
+{
+	va_list args;
+
+	va_start(args, fmt);
+	(void)vfprintf(stderr, fmt + 1, args);
+	va_end(args);
+}
+
+int main(int argc, char *argv[])
+{
+	void *buf;
+	int rc;
+
+	if (argc > 1) {
+		printf("Usage: %s\n\n", argv[0]);
+		printf("Time the memcpy(), memmove(), memset(), memcmp(), strcmp() and\n");
+		printf("strlen() of the firmware C library, libfdt and the zlib crc32()\n");
+		printf("and inflate, built with the flags of the firmware, over sizes\n");
+		printf("of up to %u bytes.\n", LIB_BENCH_MAX_SIZE);
+		return (strcmp(argv[1], "-h") == 0) ? 0 : 1;
+	}
+
+	buf = malloc(LIB_BENCH_BUF_SIZE);
+	if (buf == NULL) {
+		fprintf(stderr, "Cannot allocate %u bytes\n", LIB_BENCH_BUF_SIZE);
+		return 1;
+	}
+
+	host_counter_init();
+
+	rc = lib_bench_run(&host_counter, buf, LIB_BENCH_BUF_SIZE);
+	if (rc != 0) {
+		fprintf(stderr, "The benchmark failed (%d)\n", rc);
+	}
+
+	free(buf);
+
+	return (rc == 0) ? 0 : 1;
+}
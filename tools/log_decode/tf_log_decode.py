@@ -0,0 +1,195 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026, Arm Limited. All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+
+"""
+Format the messages BL31 recorded with LOG_BINARY=1.
+
+The input is a raw dump of the tf_log_bin_bufs array of a running or crashed
+system, for instance taken by a debugger with:
+
+    dump binary memory log.bin &tf_log_bin_bufs \\
+        ((char *)&tf_log_bin_bufs + sizeof(tf_log_bin_bufs))
+
+and the ELF file of the same BL31 build, which holds the format strings:
+
+    tf_log_decode.py build/fvp/release/bl31/bl31.elf log.bin
+"""
+
+import argparse
+import re
+import struct
+import sys
+
+LOG_BIN_MAGIC = 0x7f1b
+LOG_LEVELS = {10: "ERROR", 20: "NOTICE", 30: "WARNING", 40: "INFO",
+              50: "VERBOSE"}
+
+SHT_SYMTAB = 2
+SHT_NOBITS = 8
+SHF_ALLOC = 0x2
+
+FORMAT_RE = re.compile(r"%([0-9]*)(l{0,2}|z)([diuxXcsp%])")
+
+
+class Elf:
+    """Minimal reader of the sections and symbols of a 64-bit ELF file."""
+
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.data = f.read()
+
+        if self.data[:4] != b"\x7fELF" or self.data[4] != 2:
+            raise ValueError("{}: not a 64-bit ELF file".format(path))
+        self.endian = "<" if self.data[5] == 1 else ">"
+
+        (shoff,) = struct.unpack_from(self.endian + "Q", self.data, 0x28)
+        shentsize, shnum = struct.unpack_from(self.endian + "HH", self.data,
+                                              0x3a)
+
+        self.sections = []
+        for i in range(shnum):
+            (_, sh_type, flags, addr, offset, size, link, _, _,
+             entsize) = struct.unpack_from(self.endian + "IIQQQQIIQQ",
+                                           self.data, shoff + i * shentsize)
+            self.sections.append((sh_type, flags, addr, offset, size, link,
+                                  entsize))
+
+    def read(self, addr, size):
+        """Return the bytes at a load address, or None if not in the file."""
+        for sh_type, flags, base, offset, sec_size, _, _ in self.sections:
+            if (not (flags & SHF_ALLOC) or sh_type == SHT_NOBITS or
+                    not base <= addr < base + sec_size):
+                continue
+            size = min(size, base + sec_size - addr)
+            return self.data[offset + addr - base:offset + addr - base + size]
+        return None
+
+    def read_string(self, addr):
+        data = self.read(addr, 1024)
+        if data is None or b"\0" not in data:
+            return None
+        return data[:data.index(b"\0")].decode(errors="replace")
+
+    def symbol(self, name):
+        """Return the (address, size) of a symbol."""
+        for sh_type, _, _, offset, size, link, entsize in self.sections:
+            if sh_type != SHT_SYMTAB:
+                continue
+            strtab = self.sections[link][3]
+            for off in range(offset, offset + size, entsize):
+                st_name, _, _, _, value, st_size = struct.unpack_from(
+                    self.endian + "IBBHQQ", self.data, off)
+                end = self.data.index(b"\0", strtab + st_name)
+                if self.data[strtab + st_name:end].decode() == name:
+                    return value, st_size
+        raise ValueError("no symbol {}".format(name))
+
+
+def format_message(elf, fmt, args):
+    """Format a message as vprintf() in lib/libc/printf.c would."""
+    args = list(args)
+
+    def convert(match):
+        pad, length, conv = match.groups()
+        if conv == "%":
+            return "%"
+        if not args:
+            return "<missing>"
+        value = args.pop(0)
+        if conv in "di":
+            bits = 32 if length == "" else 64
+            value &= (1 << bits) - 1
+            if value >> (bits - 1):
+                value -= 1 << bits
+            text = str(value)
+        elif conv in "uxX":
+            if length == "":
+                value &= 0xffffffff
+            text = "{:{}}".format(value, {"u": "d", "x": "x", "X": "X"}[conv])
+        elif conv == "c":
+            text = chr(value & 0xff)
+        elif conv == "s":
+            text = elf.read_string(value)
+            if text is None:
+                text = "<string at 0x{:x}>".format(value)
+        else:
+            text = "0x{:x}".format(value) if value else "0"
+        if pad:
+            fill = "0" if pad.startswith("0") else " "
+            text = text.rjust(int(pad), fill)
+        return text
+
+    return FORMAT_RE.sub(convert, fmt)
+
+
+def decode_cpu(elf, words, head, cpu):
+    """Yield the (timestamp, cpu, text) of the records left in a buffer."""
+    nr_words = len(words)
+    pos = max(0, head - nr_words)
+
+    while pos < head:
+        word = words[pos % nr_words]
+        nargs = (word >> 40) & 0xff
+        end = pos + 3 + nargs
+
+        # The oldest records may have been partially overwritten
+        if (word >> 48 != LOG_BIN_MAGIC or word & 0xffffffff !=
+                pos & 0xffffffff or end > head):
+            pos += 1
+            continue
+
+        fmt_addr = words[(pos + 1) % nr_words]
+        fmt = elf.read_string(fmt_addr)
+        if not fmt:
+            pos += 1
+            continue
+
+        args = [words[i % nr_words] for i in range(pos + 3, end)]
+        level = LOG_LEVELS.get(ord(fmt[0]), "?")
+        yield (words[(pos + 2) % nr_words], cpu,
+               "{}: {}".format(level, format_message(elf, fmt[1:], args)))
+        pos = end
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Format the messages recorded by BL31 with LOG_BINARY=1")
+    parser.add_argument("elf", help="ELF file of BL31")
+    parser.add_argument("dump", help="raw dump of tf_log_bin_bufs")
+    parser.add_argument("--buf-size", type=int, default=4096,
+                        help="LOG_BINARY_BUF_SIZE of the build (default 4096)")
+    args = parser.parse_args()
+
+    elf = Elf(args.elf)
+    _, bufs_size = elf.symbol("tf_log_bin_bufs")
+    with open(args.dump, "rb") as f:
+        dump = f.read()
+    if len(dump) < bufs_size:
+        sys.exit("{}: {} bytes, tf_log_bin_bufs is {} bytes".format(
+            args.dump, len(dump), bufs_size))
+
+    if args.buf_size < 16 or args.buf_size % 8 or bufs_size % args.buf_size:
+        sys.exit("tf_log_bin_bufs is {} bytes, not a multiple of {}".format(
+            bufs_size, args.buf_size))
+
+    records = []
+    for cpu in range(bufs_size // args.buf_size):
+        offset = cpu * args.buf_size
+        (head,) = struct.unpack_from(elf.endian + "Q", dump, offset)
+        words = struct.unpack_from(
+            elf.endian + "{}Q".format(args.buf_size // 8 - 1), dump,
+            offset + 8)
+        records.extend(decode_cpu(elf, words, head, cpu))
+
+    for timestamp, cpu, text in sorted(records):
+        sys.stdout.write("[{:>16}] CPU{}: {}".format(timestamp, cpu, text))
+        if not text.endswith("\n"):
+            sys.stdout.write("\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,162 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026, Arm Limited. All rights reserved.
+#
+# SPDX-License-Identifier: BSD-3-Clause
+#
+
+"""
+Generate the PSCI power domain tree of a platform at build time.
+
+The input is the power domain tree descriptor the platform returns from
+plat_get_power_domain_tree_desc(), in the same breadth-first format: the number
+of root power domains, then the number of children of each power domain down to
+the CPUs. For two clusters of four CPUs under a system power domain:
+
+    psci_tree_gen.py "1 2 4 4" psci_pwr_domain_tree.c
+
+The output defines the power domain nodes as psci_setup() would build them at
+runtime with populate_power_domain_tree() and psci_update_pwrlvl_limits().
+"""
+
+import argparse
+import sys
+
+PSCI_INVALID_NODE = "0xffffffffU"
+
+
+def parse_tree(desc):
+    """Return the non-CPU nodes as (level, parent) and the CPU parents."""
+    # Find the number of power levels, as only the descriptor length tells it
+    nr_levels, pos, nr_nodes = 0, 0, 1
+    while pos < len(desc):
+        if pos + nr_nodes > len(desc):
+            raise ValueError("descriptor ends in the middle of a level")
+        nr_nodes, pos = sum(desc[pos:pos + nr_nodes]), pos + nr_nodes
+        nr_levels += 1
+    if nr_levels == 0 or nr_nodes == 0:
+        raise ValueError("no CPU power domain")
+
+    # Walk the descriptor the way populate_power_domain_tree() does
+    nodes, cpus = [], []
+    pos, nr_nodes = 0, 1
+    for level in range(nr_levels - 1, -1, -1):
+        nr_next = 0
+        for _ in range(nr_nodes):
+            parent = pos - 1
+            for _ in range(desc[pos]):
+                if level > 0:
+                    nodes.append((level, parent))
+                else:
+                    cpus.append(parent)
+            nr_next += desc[pos]
+            pos += 1
+        nr_nodes = nr_next
+
+    return nr_levels - 1, nodes, cpus
+
+
+def ancestors_of(nodes, parent):
+    """Return the ancestors of a CPU from level 1 upwards."""
+    ancestors = []
+    while parent >= 0:
+        ancestors.append(parent)
+        parent = nodes[parent][1]
+    return ancestors
+
+
+def generate(desc, max_pwr_lvl, nodes, cpus, private_header):
+    cpu_ancestors = [ancestors_of(nodes, p) for p in cpus]
+
+    # The CPUs of a power domain must have adjacent indices, as
+    # psci_update_pwrlvl_limits() assumes.
+    limits = []
+    for idx in range(len(nodes)):
+        idxs = [c for c, a in enumerate(cpu_ancestors) if idx in a]
+        if not idxs or idxs != list(range(idxs[0], idxs[-1] + 1)):
+            raise ValueError("power domain {} has no CPU or non adjacent "
+                             "ones".format(idx))
+        limits.append((idxs[0], len(idxs)))
+
+    out = []
+    out.append("/*")
+    out.append(" * Generated by psci_tree_gen.py from the power domain tree "
+               "descriptor:")
+    out.append(" *   {}".format(" ".join(str(d) for d in desc)))
+    out.append(" */")
+    out.append("")
+    out.append("#include <lib/utils_def.h>")
+    out.append("#include <plat/common/platform.h>")
+    out.append("")
+    out.append("#include \"{}\"".format(private_header))
+    out.append("")
+    out.append("CASSERT(PLAT_MAX_PWR_LVL == {}U, "
+               "assert_psci_tree_max_pwr_lvl);".format(max_pwr_lvl))
+    out.append("CASSERT(PSCI_NUM_NON_CPU_PWR_DOMAINS >= {}U, "
+               "assert_psci_tree_non_cpu_pwr_domains);".format(len(nodes)))
+    out.append("CASSERT(PLATFORM_CORE_COUNT >= {}U, "
+               "assert_psci_tree_core_count);".format(len(cpus)))
+    out.append("")
+    out.append("const unsigned char psci_static_pwr_domain_tree_desc[] = {")
+    out.append("\t{}".format(", ".join("{}U".format(d) for d in desc)))
+    out.append("};")
+    out.append("")
+    out.append("const unsigned int psci_static_pwr_domain_tree_desc_len = {}U;"
+               .format(len(desc)))
+    out.append("const unsigned int psci_static_plat_core_count = {}U;"
+               .format(len(cpus)))
+    out.append("")
+    out.append("const non_cpu_pd_node_t "
+               "psci_non_cpu_pd_nodes[PSCI_NUM_NON_CPU_PWR_DOMAINS] = {")
+    for idx, (level, parent) in enumerate(nodes):
+        start, ncpus = limits[idx]
+        out.append("\t[{}] = {{".format(idx))
+        out.append("\t\t.cpu_start_idx = {}U,".format(start))
+        out.append("\t\t.ncpus = {}U,".format(ncpus))
+        out.append("\t\t.parent_node = {},".format(
+            "{}U".format(parent) if parent >= 0 else PSCI_INVALID_NODE))
+        out.append("\t\t.level = {}U,".format(level))
+        out.append("\t\t.lock_index = {}U,".format(idx))
+        out.append("\t},")
+    out.append("};")
+    out.append("")
+    out.append("cpu_pd_node_t psci_cpu_pd_nodes[PLATFORM_CORE_COUNT] = {")
+    for idx, parent in enumerate(cpus):
+        out.append("\t[{}] = {{".format(idx))
+        out.append("\t\t.mpidr = PSCI_INVALID_MPIDR,")
+        out.append("\t\t.parent_node = {}U,".format(parent))
+        if cpu_ancestors[idx]:
+            out.append("\t\t.ancestors = {{ {} }},".format(
+                ", ".join("{}U".format(a) for a in cpu_ancestors[idx])))
+        out.append("\t},")
+    out.append("};")
+
+    return "\n".join(out) + "\n"
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description="Generate the PSCI power domain tree of a platform")
+    parser.add_argument("desc", help="power domain tree descriptor, as "
+                        "returned by plat_get_power_domain_tree_desc()")
+    parser.add_argument("output", help="C file to generate")
+    parser.add_argument("--private-header", default="psci_private.h",
+                        help="path to include lib/psci/psci_private.h from "
+                        "the output (default psci_private.h)")
+    args = parser.parse_args()
+
+    try:
+        desc = [int(d, 0) for d in args.desc.replace(",", " ").split()]
+        if any(d < 0 or d > 255 for d in desc):
+            raise ValueError("entries must fit in an unsigned char")
+        max_pwr_lvl, nodes, cpus = parse_tree(desc)
+        text = generate(desc, max_pwr_lvl, nodes, cpus, args.private_header)
+    except ValueError as e:
+        sys.exit("psci_tree_gen.py: {}".format(e))
+
+    with open(args.output, "w") as f:
+        f.write(text)
+
+
+if __name__ == "__main__":
+    main()